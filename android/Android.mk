@@ -5,14 +5,23 @@ ne10_neon_source := \
     modules/math/NE10_addc.neon.c \
     modules/math/NE10_addmat.neon.c \
     modules/math/NE10_add.neon.s \
+    modules/math/NE10_aligned.neon.c \
+    modules/math/NE10_convert.neon.c \
+    modules/math/NE10_cpx.neon.c \
     modules/math/NE10_cross.neon.s \
+    modules/math/NE10_decomp.neon.c \
     modules/math/NE10_detmat.neon.s \
     modules/math/NE10_divc.neon.c \
     modules/math/NE10_div.neon.s \
     modules/math/NE10_dot.neon.s \
+    modules/math/NE10_fused.neon.c \
+    modules/math/NE10_gemm.neon.c \
+    modules/math/NE10_gemm_s8.neon.c \
     modules/math/NE10_identitymat.neon.s \
     modules/math/NE10_invmat.neon.s \
     modules/math/NE10_len.neon.s \
+    modules/math/NE10_mat_f32.neon.c \
+    modules/math/NE10_mat_x4.neon.c \
     modules/math/NE10_mla.neon.s \
     modules/math/NE10_mlac.neon.c \
     modules/math/NE10_mulcmatvec.neon.s \
@@ -20,11 +29,15 @@ ne10_neon_source := \
     modules/math/NE10_mulmat.neon.s \
     modules/math/NE10_mul.neon.s \
     modules/math/NE10_normalize.neon.s \
+    modules/math/NE10_quat.neon.c \
+    modules/math/NE10_reduce.neon.c \
     modules/math/NE10_rsbc.neon.c \
     modules/math/NE10_setc.neon.c \
+    modules/math/NE10_soa.neon.c \
     modules/math/NE10_subc.neon.c \
     modules/math/NE10_submat.neon.c \
     modules/math/NE10_sub.neon.s \
+    modules/math/NE10_transcendental.neon.c \
     modules/math/NE10_transmat.neon.s \
 
 ne10_source_files := \
@@ -57,14 +70,23 @@ ne10_source_files := \
     modules/math/NE10_addc.c \
     modules/math/NE10_addmat.c \
     modules/math/NE10_add.c \
+    modules/math/NE10_aligned.c \
+    modules/math/NE10_convert.c \
+    modules/math/NE10_cpx.c \
     modules/math/NE10_cross.c \
+    modules/math/NE10_decomp.c \
     modules/math/NE10_detmat.c \
     modules/math/NE10_divc.c \
     modules/math/NE10_div.c \
     modules/math/NE10_dot.c \
+    modules/math/NE10_fused.c \
+    modules/math/NE10_gemm.c \
+    modules/math/NE10_gemm_s8.c \
     modules/math/NE10_identitymat.c \
     modules/math/NE10_invmat.c \
     modules/math/NE10_len.c \
+    modules/math/NE10_mat_f32.c \
+    modules/math/NE10_mat_x4.c \
     modules/math/NE10_mla.c \
     modules/math/NE10_mlac.c \
     modules/math/NE10_mulcmatvec.c \
@@ -72,14 +94,19 @@ ne10_source_files := \
     modules/math/NE10_mulmat.c \
     modules/math/NE10_mul.c \
     modules/math/NE10_normalize.c \
+    modules/math/NE10_quat.c \
+    modules/math/NE10_reduce.c \
     modules/math/NE10_rsbc.c \
     modules/math/NE10_setc.c \
+    modules/math/NE10_soa.c \
     modules/math/NE10_subc.c \
     modules/math/NE10_submat.c \
     modules/math/NE10_sub.c \
+    modules/math/NE10_transcendental.c \
     modules/math/NE10_transmat.c \
     modules/math/NE10_init_math.c \
     modules/NE10_init.c \
+    modules/NE10_memory.c \
 
 include $(CLEAR_VARS)
 
@@ -44,6 +44,7 @@
 //
 // Group 4 = These take a dst, and two src inputs, src2 and scr2 ("DstSrc1Src2")
 // Group 5 = These take a dst, an acc, and two src inputs ("DstAccSrc1Src2")
+// Group 6 = The ones that take a dst, and a src only ("DstSrc" for short)
 
 // A few macros to check pointers and their address range to make sure there's
 // no unwanted overlap between any two of them
@@ -527,7 +528,7 @@
       float32x2_t n_rest = { 0.0f , 0.0f }; /* temporary storage to be used with NEON load/store intrinsics */ \
       float32x2_t n_rest2 = { 0.0f , 0.0f }; \
       n_rest = vld1_lane_f32 ( (float32_t*)src1, n_rest, 0); /* load into the first lane of d0 */ \
-      n_rest2 = vld1_lane_f32 ( (float32_t*)src2, n_rest, 0); \
+      n_rest2 = vld1_lane_f32 ( (float32_t*)src2, n_rest2, 0); \
       loopCode; /* the actual operation is placed here ... */ /* exceptional cases where the count is not a multiple of 4 */ \
       vst1_lane_f32( (float32_t*)dst, n_rest, 0); /* store the lane back into the memory */ \
       /* move to the next item in the stream */ \
@@ -576,3 +577,32 @@
      }
 
 #define NE10_DstAccSrc1Src2_OPERATION_FLOAT_NEON NE10_DstAccSrcCst_OPERATION_FLOAT_NEON
+
+/****************************************************
+ *                                                  *
+ *  The "DstSrc" group of functions                 *
+ *                                                  *
+ ****************************************************/
+
+///// - FLOAT - /////
+
+#define NE10_DstSrc_MAINLOOP_FLOAT_NEON(loopCode) { \
+     /* load 4 values  */ \
+     n_src = vld1q_f32( (float32_t*)src ); \
+     src += 4; /* move to the next 4 float items; 4*float */ \
+     loopCode; /* the actual operation is placed here... */ /* The main loop iterates through four float values each time */ \
+     vst1q_f32 ( (float32_t*)dst , n_dst ); /* store the results back */ \
+     dst += 4; /* move to the next items; 4*float */ \
+    }
+
+#define NE10_DstSrc_SECONDLOOP_FLOAT_NEON(loopCode) { \
+      float32x2_t n_rest = { 0.0f , 0.0f }; /* temporary storage to be used with NEON load/store intrinsics */ \
+      n_rest = vld1_lane_f32 ( (float32_t*)src, n_rest, 0); /* load into the first lane of d0 */ \
+      loopCode; /* the actual operation is placed here ... */ /* exceptional cases where the count is not a multiple of 4 */ \
+      vst1_lane_f32( (float32_t*)dst, n_rest, 0); /* store the lane back into the memory */ \
+      /* move to the next item in the stream */ \
+      src++; \
+      dst++; \
+     }
+
+#define NE10_DstSrc_OPERATION_FLOAT_NEON NE10_DstSrcCst_OPERATION_FLOAT_NEON
@@ -161,3 +161,21 @@
         NE10_DstAccSrc1Src2_SECONDLOOP_FLOAT_NEON(loopCode2); \
     ); \
 }
+
+#define NE10_DstSrc_DO_COUNT_TIMES_FLOAT_NEON(loopCode1, loopCode2) { \
+    NE10_CHECKPOINTER_DstSrc; \
+    NE10_DstSrc_OPERATION_FLOAT_NEON(  \
+        NE10_DstSrc_MAINLOOP_FLOAT_NEON(loopCode1); , \
+        NE10_DstSrc_SECONDLOOP_FLOAT_NEON(loopCode2); \
+    ); \
+}
+
+/*
+ * Lets the compiler assume that a pointer is aligned to NE10_MALLOC_ALIGNMENT bytes, so
+ * that the _aligned functions get aligned loads and stores (the :128 hint on ARMv7).
+ */
+#if defined(__GNUC__)
+#define NE10_ASSUME_ALIGNED(p) __builtin_assume_aligned ((p), NE10_MALLOC_ALIGNMENT)
+#else
+#define NE10_ASSUME_ALIGNED(p) (p)
+#endif
@@ -92,8 +92,8 @@ extern "C" {
  * {
  *     ne10_int32_t fftSize = 1024;
  *     ne10_fft_cfg_float32_t cfg = ne10_fft_alloc_c2c_float32_neon(fftSize);          // Allocate a configuration structure for C2C FP32 NEON FFTs of size fftSize
- *     ne10_fft_cpx_float32_t *in  = malloc(fftSize * sizeof(ne10_fft_cpx_float32_t)); // Allocate an input array of samples
- *     ne10_fft_cpx_float32_t *out = malloc(fftSize * sizeof(ne10_fft_cpx_float32_t)); // Allocate an output array of samples
+ *     ne10_fft_cpx_float32_t *in  = NE10_MALLOC(fftSize * sizeof(ne10_fft_cpx_float32_t)); // Allocate an input array of samples
+ *     ne10_fft_cpx_float32_t *out = NE10_MALLOC(fftSize * sizeof(ne10_fft_cpx_float32_t)); // Allocate an output array of samples
  *
  *     ...
  *
@@ -131,7 +131,7 @@ extern "C" {
      * @brief Creates a configuration structure for @ref ne10_fft_c2c_1d_float32.
      *
      * @param[in]   nfft             input length
-     * @retval      st               pointer to an FFT configuration structure (allocated with `malloc`), or `NULL` to indicate an error
+     * @retval      st               pointer to an FFT configuration structure (allocated with `NE10_MALLOC`), or `NULL` to indicate an error
      *
      * Allocates and initialises an @ref ne10_fft_cfg_float32_t configuration structure for
      * the complex-to-complex single precision floating point FFT/IFFT. As part of this, it reserves
@@ -145,6 +145,31 @@ extern "C" {
     extern ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_c (ne10_int32_t nfft);
     extern ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_neon (ne10_int32_t nfft);
 
+    /**
+     * @brief Returns the size in bytes of the memory needed by @ref ne10_fft_alloc_c2c_float32_inplace.
+     *
+     * @param[in]   nfft             input length
+     * @retval      size             number of bytes, for both the C and the NEON configurations
+     */
+    extern ne10_uint32_t ne10_fft_alloc_c2c_float32_size (ne10_int32_t nfft);
+
+    /**
+     * @brief Creates a configuration structure for @ref ne10_fft_c2c_1d_float32 in caller-provided memory.
+     *
+     * @param[in]   mem              memory for the configuration structure, aligned to at least 8 bytes
+     * @param[in]   mem_size         size of mem in bytes, at least @ref ne10_fft_alloc_c2c_float32_size (nfft)
+     * @param[in]   nfft             input length
+     * @retval      st               pointer to the FFT configuration structure, placed at mem, or `NULL` to indicate an error
+     *
+     * Same as @ref ne10_fft_alloc_c2c_float32, without any allocation, so that configurations can be
+     * placed in pre-reserved memory. The structure is owned by the caller: do not pass it to
+     * @ref ne10_fft_destroy_c2c_float32. Points to @ref ne10_fft_alloc_c2c_float32_inplace_c or
+     * @ref ne10_fft_alloc_c2c_float32_inplace_neon.
+     */
+    extern ne10_fft_cfg_float32_t (*ne10_fft_alloc_c2c_float32_inplace) (void *mem, ne10_uint32_t mem_size, ne10_int32_t nfft);
+    extern ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_inplace_c (void *mem, ne10_uint32_t mem_size, ne10_int32_t nfft);
+    extern ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_inplace_neon (void *mem, ne10_uint32_t mem_size, ne10_int32_t nfft);
+
     /**
      * @brief Mixed radix-2/3/4/5 complex FFT/IFFT of single precision floating point data.
      *
@@ -179,7 +204,7 @@ extern "C" {
      * @brief Creates a configuration structure for @ref ne10_fft_c2c_1d_int32.
      *
      * @param[in]   nfft             input length
-     * @retval      st               pointer to an FFT configuration structure (allocated with `malloc`), or `NULL` to indicate an error
+     * @retval      st               pointer to an FFT configuration structure (allocated with `NE10_MALLOC`), or `NULL` to indicate an error
      *
      * Allocates and initialises an @ref ne10_fft_cfg_int32_t configuration structure for
      * the complex-to-complex 32-bit integer fixed point FFT/IFFT. As part of this, it reserves a
@@ -319,8 +344,8 @@ extern "C" {
  * {
  *     ne10_int32_t fftSize = 1024;
  *     ne10_fft_r2c_cfg_float32_t cfg = ne10_fft_alloc_r2c_float32_neon(fftSize);      // Allocate a configuration structure for R2C/C2R FP32 NEON FFTs of size fftSize
- *     ne10_float32_t *in          = malloc(fftSize * sizeof(ne10_float32_t));         // Allocate an input array of samples
- *     ne10_fft_cpx_float32_t *out = malloc(fftSize * sizeof(ne10_fft_cpx_float32_t)); // Allocate an (oversized) output array of samples
+ *     ne10_float32_t *in          = NE10_MALLOC(fftSize * sizeof(ne10_float32_t));         // Allocate an input array of samples
+ *     ne10_fft_cpx_float32_t *out = NE10_MALLOC(fftSize * sizeof(ne10_fft_cpx_float32_t)); // Allocate an (oversized) output array of samples
  *
  *     ...
  *
@@ -643,6 +668,166 @@ extern "C" {
 #endif // ENABLE_NE10_FIR_INTERPOLATE_FLOAT_NEON
     /** @} */ // FIR_interpolate
 
+    /**
+     * @addtogroup FIR_Halfband
+     * @{
+     */
+    extern ne10_result_t ne10_fir_halfband_decimate_init_float (ne10_fir_halfband_instance_f32_t * S,
+            ne10_uint16_t numTaps,
+            ne10_float32_t * pCoeffs,
+            ne10_float32_t * pState,
+            ne10_uint32_t blockSize);
+
+    extern ne10_result_t ne10_fir_halfband_interpolate_init_float (ne10_fir_halfband_instance_f32_t * S,
+            ne10_uint16_t numTaps,
+            ne10_float32_t * pCoeffs,
+            ne10_float32_t * pState,
+            ne10_uint32_t blockSize);
+
+    /**
+     * @brief Processing function for the floating-point halfband decimator.
+     *
+     * @param[in] *S        points to an instance of the floating-point halfband filter structure.
+     * @param[in] *pSrc     points to the block of input data.
+     * @param[out] *pDst    points to the block of output data, of length blockSize/2.
+     * @param[in] blockSize number of input samples to process per call, must be even.
+     *
+     * Points to @ref ne10_fir_halfband_decimate_float_c or @ref ne10_fir_halfband_decimate_float_neon.
+     */
+    extern void (*ne10_fir_halfband_decimate_float) (const ne10_fir_halfband_instance_f32_t * S,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+    extern void ne10_fir_halfband_decimate_float_c (const ne10_fir_halfband_instance_f32_t * S,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+    extern void ne10_fir_halfband_decimate_float_neon (const ne10_fir_halfband_instance_f32_t * S,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+
+    /**
+     * @brief Processing function for the floating-point halfband interpolator.
+     *
+     * @param[in] *S        points to an instance of the floating-point halfband filter structure.
+     * @param[in] *pSrc     points to the block of input data.
+     * @param[out] *pDst    points to the block of output data, of length 2*blockSize.
+     * @param[in] blockSize number of input samples to process per call.
+     *
+     * Points to @ref ne10_fir_halfband_interpolate_float_c or @ref ne10_fir_halfband_interpolate_float_neon.
+     */
+    extern void (*ne10_fir_halfband_interpolate_float) (const ne10_fir_halfband_instance_f32_t * S,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+    extern void ne10_fir_halfband_interpolate_float_c (const ne10_fir_halfband_instance_f32_t * S,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+    extern void ne10_fir_halfband_interpolate_float_neon (const ne10_fir_halfband_instance_f32_t * S,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+
+    extern ne10_fir_cascade_cfg_f32_t ne10_fir_decimate_cascade_alloc_float (ne10_uint16_t numHalfbands,
+            ne10_uint16_t halfbandTaps,
+            ne10_float32_t * pHalfbandCoeffs,
+            ne10_uint8_t M,
+            ne10_uint16_t numTaps,
+            ne10_float32_t * pCoeffs,
+            ne10_uint32_t maxBlockSize);
+
+    extern ne10_fir_cascade_cfg_f32_t ne10_fir_interpolate_cascade_alloc_float (ne10_uint16_t numHalfbands,
+            ne10_uint16_t halfbandTaps,
+            ne10_float32_t * pHalfbandCoeffs,
+            ne10_uint8_t L,
+            ne10_uint16_t numTaps,
+            ne10_float32_t * pCoeffs,
+            ne10_uint32_t maxBlockSize);
+
+    extern void ne10_fir_cascade_destroy_float (ne10_fir_cascade_cfg_f32_t cfg);
+
+    /**
+     * @brief Processing function for a multi-stage decimator or interpolator.
+     *
+     * @param[in] cfg       cascade created by @ref ne10_fir_decimate_cascade_alloc_float or
+     *                      @ref ne10_fir_interpolate_cascade_alloc_float.
+     * @param[in] *pSrc     points to the block of input data.
+     * @param[out] *pDst    points to the block of output data.
+     * @param[in] blockSize number of input samples, at most the configured maximum; for a decimator,
+     *                      a multiple of the total decimation factor.
+     * @return the number of output samples written to pDst.
+     *
+     * Points to @ref ne10_fir_cascade_float_c or @ref ne10_fir_cascade_float_neon.
+     */
+    extern ne10_uint32_t (*ne10_fir_cascade_float) (ne10_fir_cascade_cfg_f32_t cfg,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+    extern ne10_uint32_t ne10_fir_cascade_float_c (ne10_fir_cascade_cfg_f32_t cfg,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+    extern ne10_uint32_t ne10_fir_cascade_float_neon (ne10_fir_cascade_cfg_f32_t cfg,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+    /** @} */ // FIR_Halfband
+
+    /**
+     * @addtogroup Resampler
+     * @{
+     */
+    extern ne10_result_t ne10_resampler_init_float (ne10_resampler_instance_f32_t * S,
+            ne10_uint16_t L,
+            ne10_uint16_t M,
+            ne10_uint16_t numTaps,
+            const ne10_float32_t * pCoeffs,
+            ne10_float32_t * pPhaseCoeffs,
+            ne10_float32_t * pState,
+            ne10_uint32_t maxBlockSize);
+
+    extern ne10_result_t ne10_resampler_fractional_init_float (ne10_resampler_instance_f32_t * S,
+            ne10_uint16_t numPhases,
+            ne10_uint16_t numTaps,
+            const ne10_float32_t * pCoeffs,
+            ne10_float32_t * pPhaseCoeffs,
+            ne10_float32_t * pState,
+            ne10_uint32_t maxBlockSize,
+            ne10_float64_t ratio);
+
+    extern ne10_result_t ne10_resampler_set_ratio_float (ne10_resampler_instance_f32_t * S,
+            ne10_float64_t ratio);
+
+    /**
+     * @brief Processing function for the floating-point resampler.
+     *
+     * @param[in,out] *S         points to an instance of the floating-point resampler structure.
+     * @param[in]     *pSrc      points to the block of input data.
+     * @param[out]    *pDst      points to the block of output data.
+     * @param[in]     blockSize  number of input samples to process, at most maxBlockSize.
+     * @return the number of output samples written to pDst.
+     *
+     * Points to @ref ne10_resampler_float_c or @ref ne10_resampler_float_neon.
+     */
+    extern ne10_uint32_t (*ne10_resampler_float) (ne10_resampler_instance_f32_t * S,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+    extern ne10_uint32_t ne10_resampler_float_c (ne10_resampler_instance_f32_t * S,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+    /**
+     * Specific implementation of @ref ne10_resampler_float using NEON SIMD capabilities.
+     */
+    extern ne10_uint32_t ne10_resampler_float_neon (ne10_resampler_instance_f32_t * S,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+    /** @} */ // Resampler
+
     /**
      * @addtogroup FIR_Lattice
      * @{
@@ -725,6 +910,39 @@ extern "C" {
                                             ne10_uint32_t blockSize)
     asm ("ne10_fir_sparse_float_neon");
 #endif // ENABLE_NE10_FIR_SPARSE_FLOAT_NEON
+
+    extern ne10_result_t ne10_fir_sparse_linear_init_float (ne10_fir_sparse_linear_instance_f32_t * S,
+            ne10_uint16_t numTaps,
+            const ne10_float32_t * pCoeffs,
+            const ne10_int32_t * pTapDelay,
+            ne10_float32_t * pSortedCoeffs,
+            ne10_int32_t * pSortedTapDelay,
+            ne10_float32_t * pState,
+            ne10_uint32_t maxDelay,
+            ne10_uint32_t blockSize);
+
+    /**
+     * @brief Processing function for the floating-point sparse FIR filter with a linear delay line.
+     *
+     * @param[in]  *S          points to an instance of the floating-point sparse FIR structure.
+     * @param[in]  *pSrc       points to the block of input data.
+     * @param[out] *pDst       points to the block of output data
+     * @param[in]  blockSize   number of input samples to process per call, at most the initialized blockSize.
+     *
+     * Points to @ref ne10_fir_sparse_linear_float_c or @ref ne10_fir_sparse_linear_float_neon.
+     */
+    extern void (*ne10_fir_sparse_linear_float) (ne10_fir_sparse_linear_instance_f32_t * S,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+    extern void ne10_fir_sparse_linear_float_c (ne10_fir_sparse_linear_instance_f32_t * S,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
+    extern void ne10_fir_sparse_linear_float_neon (ne10_fir_sparse_linear_instance_f32_t * S,
+            ne10_float32_t * pSrc,
+            ne10_float32_t * pDst,
+            ne10_uint32_t blockSize);
     /** @} */ // FIR_sparse
 
 
@@ -768,6 +986,711 @@ extern "C" {
 #endif // ENABLE_NE10_IIR_LATTICE_FLOAT_NEON
     /** @} */ // IIR_Lattice
 
+    /**
+     * @addtogroup IIR_Block
+     * @{
+     */
+
+    /**
+     * @brief Initialization function for the floating-point block IIR filter from a biquad cascade.
+     *
+     * @param[out] *S             points to an instance of the floating-point block IIR structure.
+     * @param[in]  numStages      number of 2nd order stages in the filter.
+     * @param[in]  *pBiquadCoeffs points to the biquad coefficients {b0, b1, b2, a1, a2} of each stage.
+     *                            The array is of length 5*numStages.
+     * @param[out] *pCoeffs       points to the matrix buffer. The array is of length
+     *                            numStages*NE10_IIR_BLOCK_COEFFS_LEN(2, stepSize).
+     * @param[in]  *pState        points to the state buffer. The array is of length 2*(numStages+1).
+     * @param[in]  stepSize       number of samples per look-ahead step, 4 or 8.
+     * @return NE10_OK on success, NE10_ERR for unsupported arguments.
+     *
+     * The instance only refers to the caller's buffers, so there is nothing to free.
+     */
+    extern ne10_result_t ne10_iir_block_biquad_init_float (ne10_iir_block_instance_f32_t * S,
+            ne10_uint16_t numStages,
+            const ne10_float32_t * pBiquadCoeffs,
+            ne10_float32_t * pCoeffs,
+            ne10_float32_t * pState,
+            ne10_uint16_t stepSize);
+
+    /**
+     * @brief Initialization function for the floating-point block IIR filter from an IIR lattice.
+     *
+     * @param[out] *S        points to an instance of the floating-point block IIR structure.
+     * @param[in]  numStages number of stages in the lattice filter.
+     * @param[in]  *pkCoeffs points to the reflection coefficient buffer. The array is of length numStages.
+     * @param[in]  *pvCoeffs points to the ladder coefficient buffer. The array is of length numStages+1.
+     * @param[out] *pCoeffs  points to the matrix buffer. The array is of length
+     *                       NE10_IIR_BLOCK_COEFFS_LEN(numStages, stepSize).
+     * @param[in]  *pState   points to the state buffer. The array is of length 2*numStages.
+     * @param[in]  stepSize  number of samples per look-ahead step, 4 or 8.
+     * @return NE10_OK on success, NE10_ERR for unsupported arguments or if the temporary memory
+     *         cannot be allocated.
+     */
+    extern ne10_result_t ne10_iir_block_lattice_init_float (ne10_iir_block_instance_f32_t * S,
+            ne10_uint16_t numStages,
+            const ne10_float32_t * pkCoeffs,
+            const ne10_float32_t * pvCoeffs,
+            ne10_float32_t * pCoeffs,
+            ne10_float32_t * pState,
+            ne10_uint16_t stepSize);
+
+    /**
+     * @brief Processing function for the floating-point block IIR filter.
+     *
+     * @param[in] *S points to an instance of the floating-point block IIR structure.
+     * @param[in] *pSrc points to the block of input data.
+     * @param[out] *pDst points to the block of output data. It may be the same buffer as pSrc.
+     * @param[in] blockSize number of samples to process.
+     *
+     * Points to @ref ne10_iir_block_float_c or @ref ne10_iir_block_float_neon.
+     */
+    extern void (*ne10_iir_block_float) (const ne10_iir_block_instance_f32_t * S,
+                                         ne10_float32_t * pSrc,
+                                         ne10_float32_t * pDst,
+                                         ne10_uint32_t blockSize);
+    extern void ne10_iir_block_float_c (const ne10_iir_block_instance_f32_t * S,
+                                        ne10_float32_t * pSrc,
+                                        ne10_float32_t * pDst,
+                                        ne10_uint32_t blockSize);
+    /**
+     * Specific implementation of @ref ne10_iir_block_float using NEON SIMD capabilities.
+     */
+    extern void ne10_iir_block_float_neon (const ne10_iir_block_instance_f32_t * S,
+                                           ne10_float32_t * pSrc,
+                                           ne10_float32_t * pDst,
+                                           ne10_uint32_t blockSize);
+    /** @} */ // IIR_Block
+
+    /**
+     * @addtogroup LMS_Norm
+     * @{
+     */
+    extern ne10_result_t ne10_lms_norm_init_float (ne10_lms_norm_instance_f32_t * S,
+            ne10_uint16_t numTaps,
+            ne10_float32_t * pCoeffs,
+            ne10_float32_t * pState,
+            ne10_float32_t mu,
+            ne10_uint32_t blockSize);
+
+    extern ne10_result_t ne10_lms_norm_init_int32 (ne10_lms_norm_instance_int32_t * S,
+            ne10_uint16_t numTaps,
+            ne10_int32_t * pCoeffs,
+            ne10_int32_t * pState,
+            ne10_int32_t mu,
+            ne10_uint32_t blockSize,
+            ne10_uint8_t postShift);
+
+    /**
+     * @brief Processing function for the floating-point normalized LMS filter.
+     *
+     * @param[in] *S points to an instance of the floating-point normalized LMS structure.
+     * @param[in] *pSrc points to the block of input data.
+     * @param[in] *pRef points to the block of reference data.
+     * @param[out] *pOut points to the block of output data.
+     * @param[out] *pErr points to the block of error data.
+     * @param[in] blockSize number of samples to process.
+     *
+     * Points to @ref ne10_lms_norm_float_c or @ref ne10_lms_norm_float_neon.
+     */
+    extern void (*ne10_lms_norm_float) (ne10_lms_norm_instance_f32_t * S,
+                                        ne10_float32_t * pSrc,
+                                        ne10_float32_t * pRef,
+                                        ne10_float32_t * pOut,
+                                        ne10_float32_t * pErr,
+                                        ne10_uint32_t blockSize);
+    extern void ne10_lms_norm_float_c (ne10_lms_norm_instance_f32_t * S,
+                                       ne10_float32_t * pSrc,
+                                       ne10_float32_t * pRef,
+                                       ne10_float32_t * pOut,
+                                       ne10_float32_t * pErr,
+                                       ne10_uint32_t blockSize);
+    /**
+     * Specific implementation of @ref ne10_lms_norm_float using NEON SIMD capabilities.
+     */
+    extern void ne10_lms_norm_float_neon (ne10_lms_norm_instance_f32_t * S,
+                                          ne10_float32_t * pSrc,
+                                          ne10_float32_t * pRef,
+                                          ne10_float32_t * pOut,
+                                          ne10_float32_t * pErr,
+                                          ne10_uint32_t blockSize);
+
+    /**
+     * @brief Processing function for the Q31 normalized LMS filter.
+     *
+     * @param[in] *S points to an instance of the Q31 normalized LMS structure.
+     * @param[in] *pSrc points to the block of Q31 input data.
+     * @param[in] *pRef points to the block of Q31 reference data.
+     * @param[out] *pOut points to the block of Q31 output data.
+     * @param[out] *pErr points to the block of Q31 error data.
+     * @param[in] blockSize number of samples to process.
+     *
+     * Points to @ref ne10_lms_norm_int32_c or @ref ne10_lms_norm_int32_neon.
+     */
+    extern void (*ne10_lms_norm_int32) (ne10_lms_norm_instance_int32_t * S,
+                                        ne10_int32_t * pSrc,
+                                        ne10_int32_t * pRef,
+                                        ne10_int32_t * pOut,
+                                        ne10_int32_t * pErr,
+                                        ne10_uint32_t blockSize);
+    extern void ne10_lms_norm_int32_c (ne10_lms_norm_instance_int32_t * S,
+                                       ne10_int32_t * pSrc,
+                                       ne10_int32_t * pRef,
+                                       ne10_int32_t * pOut,
+                                       ne10_int32_t * pErr,
+                                       ne10_uint32_t blockSize);
+    /**
+     * Specific implementation of @ref ne10_lms_norm_int32 using NEON SIMD capabilities.
+     */
+    extern void ne10_lms_norm_int32_neon (ne10_lms_norm_instance_int32_t * S,
+                                          ne10_int32_t * pSrc,
+                                          ne10_int32_t * pRef,
+                                          ne10_int32_t * pOut,
+                                          ne10_int32_t * pErr,
+                                          ne10_uint32_t blockSize);
+    /** @} */ // LMS_Norm
+
+    /**
+     * @addtogroup LMS_FD
+     * @{
+     */
+    extern ne10_result_t ne10_lms_fd_init_float (ne10_lms_fd_instance_f32_t * S,
+            ne10_uint16_t numTaps,
+            ne10_fft_r2c_cfg_float32_t cfg,
+            ne10_fft_cpx_float32_t * pCoeffs,
+            ne10_float32_t * pState,
+            ne10_float32_t mu,
+            ne10_float32_t beta);
+
+    /**
+     * @brief Processing function for the floating-point frequency domain block LMS filter.
+     *
+     * @param[in] *S points to an instance of the frequency domain block LMS structure.
+     * @param[in] *pSrc points to the block of input data.
+     * @param[in] *pRef points to the block of reference data.
+     * @param[out] *pOut points to the block of output data.
+     * @param[out] *pErr points to the block of error data.
+     * @param[in] blockSize number of samples to process, a multiple of numTaps.
+     *
+     * Points to @ref ne10_lms_fd_float_c or @ref ne10_lms_fd_float_neon.
+     */
+    extern void (*ne10_lms_fd_float) (ne10_lms_fd_instance_f32_t * S,
+                                      ne10_float32_t * pSrc,
+                                      ne10_float32_t * pRef,
+                                      ne10_float32_t * pOut,
+                                      ne10_float32_t * pErr,
+                                      ne10_uint32_t blockSize);
+    extern void ne10_lms_fd_float_c (ne10_lms_fd_instance_f32_t * S,
+                                     ne10_float32_t * pSrc,
+                                     ne10_float32_t * pRef,
+                                     ne10_float32_t * pOut,
+                                     ne10_float32_t * pErr,
+                                     ne10_uint32_t blockSize);
+    /**
+     * Specific implementation of @ref ne10_lms_fd_float using NEON SIMD capabilities.
+     */
+    extern void ne10_lms_fd_float_neon (ne10_lms_fd_instance_f32_t * S,
+                                        ne10_float32_t * pSrc,
+                                        ne10_float32_t * pRef,
+                                        ne10_float32_t * pOut,
+                                        ne10_float32_t * pErr,
+                                        ne10_uint32_t blockSize);
+    /** @} */ // LMS_FD
+
+    /**
+     * @addtogroup Correlation
+     * @{
+     */
+    extern ne10_corr_cfg_float32_t ne10_corr_alloc_float32 (ne10_uint32_t srcALen,
+            ne10_uint32_t srcBLen,
+            ne10_uint32_t mode,
+            ne10_uint32_t flags);
+
+    extern ne10_corr_cfg_float32_t ne10_autocorr_alloc_float32 (ne10_uint32_t srcLen,
+            ne10_uint32_t maxLag,
+            ne10_uint32_t flags);
+
+    extern void ne10_corr_destroy_float32 (ne10_corr_cfg_float32_t cfg);
+
+    /**
+     * @brief Cross-correlation of floating-point signals.
+     *
+     * Points to @ref ne10_correlate_float_c or @ref ne10_correlate_float_neon.
+     */
+    extern void (*ne10_correlate_float) (ne10_corr_cfg_float32_t cfg,
+                                         ne10_float32_t * pDst,
+                                         ne10_float32_t * pSrcA,
+                                         ne10_float32_t * pSrcB);
+    extern void ne10_correlate_float_c (ne10_corr_cfg_float32_t cfg,
+                                        ne10_float32_t * pDst,
+                                        ne10_float32_t * pSrcA,
+                                        ne10_float32_t * pSrcB);
+    /**
+     * Specific implementation of @ref ne10_correlate_float using NEON SIMD capabilities.
+     */
+    extern void ne10_correlate_float_neon (ne10_corr_cfg_float32_t cfg,
+                                           ne10_float32_t * pDst,
+                                           ne10_float32_t * pSrcA,
+                                           ne10_float32_t * pSrcB);
+
+    /**
+     * @brief Auto-correlation of a floating-point signal.
+     *
+     * Points to @ref ne10_autocorr_float_c or @ref ne10_autocorr_float_neon.
+     */
+    extern void (*ne10_autocorr_float) (ne10_corr_cfg_float32_t cfg,
+                                        ne10_float32_t * pDst,
+                                        ne10_float32_t * pSrc);
+    extern void ne10_autocorr_float_c (ne10_corr_cfg_float32_t cfg,
+                                       ne10_float32_t * pDst,
+                                       ne10_float32_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_autocorr_float using NEON SIMD capabilities.
+     */
+    extern void ne10_autocorr_float_neon (ne10_corr_cfg_float32_t cfg,
+                                          ne10_float32_t * pDst,
+                                          ne10_float32_t * pSrc);
+
+    /**
+     * @brief Cross-correlation of Q15 signals.
+     *
+     * Points to @ref ne10_correlate_int16_c or @ref ne10_correlate_int16_neon.
+     */
+    extern void (*ne10_correlate_int16) (ne10_corr_cfg_float32_t cfg,
+                                         ne10_int16_t * pDst,
+                                         ne10_int16_t * pSrcA,
+                                         ne10_int16_t * pSrcB);
+    extern void ne10_correlate_int16_c (ne10_corr_cfg_float32_t cfg,
+                                        ne10_int16_t * pDst,
+                                        ne10_int16_t * pSrcA,
+                                        ne10_int16_t * pSrcB);
+    /**
+     * Specific implementation of @ref ne10_correlate_int16 using NEON SIMD capabilities.
+     */
+    extern void ne10_correlate_int16_neon (ne10_corr_cfg_float32_t cfg,
+                                           ne10_int16_t * pDst,
+                                           ne10_int16_t * pSrcA,
+                                           ne10_int16_t * pSrcB);
+
+    /**
+     * @brief Auto-correlation of a Q15 signal.
+     *
+     * Points to @ref ne10_autocorr_int16_c or @ref ne10_autocorr_int16_neon.
+     */
+    extern void (*ne10_autocorr_int16) (ne10_corr_cfg_float32_t cfg,
+                                        ne10_int16_t * pDst,
+                                        ne10_int16_t * pSrc);
+    extern void ne10_autocorr_int16_c (ne10_corr_cfg_float32_t cfg,
+                                       ne10_int16_t * pDst,
+                                       ne10_int16_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_autocorr_int16 using NEON SIMD capabilities.
+     */
+    extern void ne10_autocorr_int16_neon (ne10_corr_cfg_float32_t cfg,
+                                          ne10_int16_t * pDst,
+                                          ne10_int16_t * pSrc);
+    /** @} */ // Correlation
+
+    /**
+     * @addtogroup STFT
+     * @{
+     */
+    extern ne10_stft_cfg_float32_t ne10_stft_alloc_float32 (ne10_uint32_t frameLen,
+            ne10_uint32_t hopSize,
+            ne10_uint32_t numFrames,
+            ne10_uint32_t windowType,
+            ne10_float32_t beta,
+            const ne10_float32_t * pCustomWindow);
+
+    extern ne10_stft_cfg_float32_t ne10_istft_alloc_float32 (ne10_uint32_t frameLen,
+            ne10_uint32_t hopSize,
+            ne10_uint32_t windowType,
+            ne10_float32_t beta,
+            const ne10_float32_t * pCustomWindow);
+
+    extern void ne10_stft_destroy_float32 (ne10_stft_cfg_float32_t cfg);
+
+    extern ne10_fft_cpx_float32_t* ne10_stft_read_float32 (ne10_stft_cfg_float32_t cfg);
+
+    /**
+     * @brief Streaming short-time Fourier transform.
+     *
+     * Points to @ref ne10_stft_float32_c or @ref ne10_stft_float32_neon.
+     */
+    extern ne10_uint32_t (*ne10_stft_float32) (ne10_stft_cfg_float32_t cfg,
+            ne10_float32_t * pSrc,
+            ne10_uint32_t srcLen);
+    extern ne10_uint32_t ne10_stft_float32_c (ne10_stft_cfg_float32_t cfg,
+            ne10_float32_t * pSrc,
+            ne10_uint32_t srcLen);
+    /**
+     * Specific implementation of @ref ne10_stft_float32 using NEON SIMD capabilities.
+     */
+    extern ne10_uint32_t ne10_stft_float32_neon (ne10_stft_cfg_float32_t cfg,
+            ne10_float32_t * pSrc,
+            ne10_uint32_t srcLen);
+
+    /**
+     * @brief Streaming inverse short-time Fourier transform.
+     *
+     * Points to @ref ne10_istft_float32_c or @ref ne10_istft_float32_neon.
+     */
+    extern ne10_uint32_t (*ne10_istft_float32) (ne10_stft_cfg_float32_t cfg,
+            ne10_float32_t * pDst,
+            ne10_fft_cpx_float32_t * pSrc);
+    extern ne10_uint32_t ne10_istft_float32_c (ne10_stft_cfg_float32_t cfg,
+            ne10_float32_t * pDst,
+            ne10_fft_cpx_float32_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_istft_float32 using NEON SIMD capabilities.
+     */
+    extern ne10_uint32_t ne10_istft_float32_neon (ne10_stft_cfg_float32_t cfg,
+            ne10_float32_t * pDst,
+            ne10_fft_cpx_float32_t * pSrc);
+    /** @} */ // STFT
+
+    /**
+     * @addtogroup MFCC
+     * @{
+     */
+    extern ne10_mfcc_cfg_float32_t ne10_mfcc_alloc_float32 (ne10_uint32_t fftLen,
+            ne10_float32_t sampleRate,
+            ne10_uint32_t numMels,
+            ne10_uint32_t numCeps,
+            ne10_float32_t fMin,
+            ne10_float32_t fMax);
+
+    extern void ne10_mfcc_destroy_float32 (ne10_mfcc_cfg_float32_t cfg);
+
+    /**
+     * @brief Log mel energies and MFCC of a floating-point spectrum.
+     *
+     * Points to @ref ne10_mfcc_float32_c or @ref ne10_mfcc_float32_neon.
+     */
+    extern void (*ne10_mfcc_float32) (ne10_mfcc_cfg_float32_t cfg,
+                                      ne10_float32_t * pCeps,
+                                      ne10_float32_t * pLogMel,
+                                      const ne10_fft_cpx_float32_t * pSrc);
+    extern void ne10_mfcc_float32_c (ne10_mfcc_cfg_float32_t cfg,
+                                     ne10_float32_t * pCeps,
+                                     ne10_float32_t * pLogMel,
+                                     const ne10_fft_cpx_float32_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_mfcc_float32 using NEON SIMD capabilities.
+     */
+    extern void ne10_mfcc_float32_neon (ne10_mfcc_cfg_float32_t cfg,
+                                        ne10_float32_t * pCeps,
+                                        ne10_float32_t * pLogMel,
+                                        const ne10_fft_cpx_float32_t * pSrc);
+
+    /**
+     * @brief Log mel energies and MFCC of a Q15 spectrum.
+     *
+     * Points to @ref ne10_mfcc_int16_c or @ref ne10_mfcc_int16_neon.
+     */
+    extern void (*ne10_mfcc_int16) (ne10_mfcc_cfg_float32_t cfg,
+                                    ne10_float32_t * pCeps,
+                                    ne10_float32_t * pLogMel,
+                                    const ne10_fft_cpx_int16_t * pSrc,
+                                    ne10_int32_t scaled_flag);
+    extern void ne10_mfcc_int16_c (ne10_mfcc_cfg_float32_t cfg,
+                                   ne10_float32_t * pCeps,
+                                   ne10_float32_t * pLogMel,
+                                   const ne10_fft_cpx_int16_t * pSrc,
+                                   ne10_int32_t scaled_flag);
+    /**
+     * Specific implementation of @ref ne10_mfcc_int16 using NEON SIMD capabilities.
+     */
+    extern void ne10_mfcc_int16_neon (ne10_mfcc_cfg_float32_t cfg,
+                                      ne10_float32_t * pCeps,
+                                      ne10_float32_t * pLogMel,
+                                      const ne10_fft_cpx_int16_t * pSrc,
+                                      ne10_int32_t scaled_flag);
+    /** @} */ // MFCC
+
+    /**
+     * @addtogroup DCT
+     * @{
+     */
+    extern ne10_dct_cfg_float32_t ne10_dct_alloc_float32 (ne10_uint32_t nfft);
+
+    extern void ne10_dct_destroy_float32 (ne10_dct_cfg_float32_t cfg);
+
+    extern ne10_mdct_cfg_float32_t ne10_mdct_alloc_float32 (ne10_uint32_t nfft,
+            const ne10_float32_t * pWindow);
+
+    extern void ne10_mdct_destroy_float32 (ne10_mdct_cfg_float32_t cfg);
+
+    /**
+     * @brief DCT-II.
+     *
+     * Points to @ref ne10_dct2_float32_c or @ref ne10_dct2_float32_neon.
+     */
+    extern void (*ne10_dct2_float32) (ne10_dct_cfg_float32_t cfg,
+                                      ne10_float32_t * pDst,
+                                      ne10_float32_t * pSrc);
+    extern void ne10_dct2_float32_c (ne10_dct_cfg_float32_t cfg,
+                                     ne10_float32_t * pDst,
+                                     ne10_float32_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_dct2_float32 using NEON SIMD capabilities.
+     */
+    extern void ne10_dct2_float32_neon (ne10_dct_cfg_float32_t cfg,
+                                        ne10_float32_t * pDst,
+                                        ne10_float32_t * pSrc);
+
+    /**
+     * @brief DCT-III, the inverse of the DCT-II.
+     *
+     * Points to @ref ne10_dct3_float32_c or @ref ne10_dct3_float32_neon.
+     */
+    extern void (*ne10_dct3_float32) (ne10_dct_cfg_float32_t cfg,
+                                      ne10_float32_t * pDst,
+                                      ne10_float32_t * pSrc);
+    extern void ne10_dct3_float32_c (ne10_dct_cfg_float32_t cfg,
+                                     ne10_float32_t * pDst,
+                                     ne10_float32_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_dct3_float32 using NEON SIMD capabilities.
+     */
+    extern void ne10_dct3_float32_neon (ne10_dct_cfg_float32_t cfg,
+                                        ne10_float32_t * pDst,
+                                        ne10_float32_t * pSrc);
+
+    /**
+     * @brief DCT-IV.
+     *
+     * Points to @ref ne10_dct4_float32_c or @ref ne10_dct4_float32_neon.
+     */
+    extern void (*ne10_dct4_float32) (ne10_dct_cfg_float32_t cfg,
+                                      ne10_float32_t * pDst,
+                                      ne10_float32_t * pSrc);
+    extern void ne10_dct4_float32_c (ne10_dct_cfg_float32_t cfg,
+                                     ne10_float32_t * pDst,
+                                     ne10_float32_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_dct4_float32 using NEON SIMD capabilities.
+     */
+    extern void ne10_dct4_float32_neon (ne10_dct_cfg_float32_t cfg,
+                                        ne10_float32_t * pDst,
+                                        ne10_float32_t * pSrc);
+
+    /**
+     * @brief Windowed MDCT of one block.
+     *
+     * Points to @ref ne10_mdct_float32_c or @ref ne10_mdct_float32_neon.
+     */
+    extern void (*ne10_mdct_float32) (ne10_mdct_cfg_float32_t cfg,
+                                      ne10_float32_t * pDst,
+                                      ne10_float32_t * pSrc);
+    extern void ne10_mdct_float32_c (ne10_mdct_cfg_float32_t cfg,
+                                     ne10_float32_t * pDst,
+                                     ne10_float32_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_mdct_float32 using NEON SIMD capabilities.
+     */
+    extern void ne10_mdct_float32_neon (ne10_mdct_cfg_float32_t cfg,
+                                        ne10_float32_t * pDst,
+                                        ne10_float32_t * pSrc);
+
+    /**
+     * @brief Windowed IMDCT of one block with overlap-add.
+     *
+     * Points to @ref ne10_imdct_float32_c or @ref ne10_imdct_float32_neon.
+     */
+    extern void (*ne10_imdct_float32) (ne10_mdct_cfg_float32_t cfg,
+                                       ne10_float32_t * pDst,
+                                       ne10_float32_t * pSrc);
+    extern void ne10_imdct_float32_c (ne10_mdct_cfg_float32_t cfg,
+                                      ne10_float32_t * pDst,
+                                      ne10_float32_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_imdct_float32 using NEON SIMD capabilities.
+     */
+    extern void ne10_imdct_float32_neon (ne10_mdct_cfg_float32_t cfg,
+                                         ne10_float32_t * pDst,
+                                         ne10_float32_t * pSrc);
+
+    /**
+     * @brief Orthonormal 2-D DCT-II of a 8x8 block.
+     *
+     * Points to @ref ne10_dct_8x8_float32_c or @ref ne10_dct_8x8_float32_neon.
+     */
+    extern void (*ne10_dct_8x8_float32) (ne10_float32_t * pDst,
+                                         const ne10_float32_t * pSrc);
+    extern void ne10_dct_8x8_float32_c (ne10_float32_t * pDst,
+                                        const ne10_float32_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_dct_8x8_float32 using NEON SIMD capabilities.
+     */
+    extern void ne10_dct_8x8_float32_neon (ne10_float32_t * pDst,
+                                           const ne10_float32_t * pSrc);
+
+    /**
+     * @brief Inverse 2-D DCT of a 8x8 block.
+     *
+     * Points to @ref ne10_idct_8x8_float32_c or @ref ne10_idct_8x8_float32_neon.
+     */
+    extern void (*ne10_idct_8x8_float32) (ne10_float32_t * pDst,
+                                          const ne10_float32_t * pSrc);
+    extern void ne10_idct_8x8_float32_c (ne10_float32_t * pDst,
+                                         const ne10_float32_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_idct_8x8_float32 using NEON SIMD capabilities.
+     */
+    extern void ne10_idct_8x8_float32_neon (ne10_float32_t * pDst,
+                                            const ne10_float32_t * pSrc);
+
+    /**
+     * @brief Orthonormal 2-D DCT-II of a 4x4 block.
+     *
+     * Points to @ref ne10_dct_4x4_float32_c or @ref ne10_dct_4x4_float32_neon.
+     */
+    extern void (*ne10_dct_4x4_float32) (ne10_float32_t * pDst,
+                                         const ne10_float32_t * pSrc);
+    extern void ne10_dct_4x4_float32_c (ne10_float32_t * pDst,
+                                        const ne10_float32_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_dct_4x4_float32 using NEON SIMD capabilities.
+     */
+    extern void ne10_dct_4x4_float32_neon (ne10_float32_t * pDst,
+                                           const ne10_float32_t * pSrc);
+
+    /**
+     * @brief Inverse 2-D DCT of a 4x4 block.
+     *
+     * Points to @ref ne10_idct_4x4_float32_c or @ref ne10_idct_4x4_float32_neon.
+     */
+    extern void (*ne10_idct_4x4_float32) (ne10_float32_t * pDst,
+                                          const ne10_float32_t * pSrc);
+    extern void ne10_idct_4x4_float32_c (ne10_float32_t * pDst,
+                                         const ne10_float32_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_idct_4x4_float32 using NEON SIMD capabilities.
+     */
+    extern void ne10_idct_4x4_float32_neon (ne10_float32_t * pDst,
+                                            const ne10_float32_t * pSrc);
+
+    /**
+     * @brief Orthonormal 2-D DCT-II of a 8x8 block of integers.
+     *
+     * Points to @ref ne10_dct_8x8_int16_c or @ref ne10_dct_8x8_int16_neon.
+     */
+    extern void (*ne10_dct_8x8_int16) (ne10_int16_t * pDst,
+                                       const ne10_int16_t * pSrc);
+    extern void ne10_dct_8x8_int16_c (ne10_int16_t * pDst,
+                                      const ne10_int16_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_dct_8x8_int16 using NEON SIMD capabilities.
+     */
+    extern void ne10_dct_8x8_int16_neon (ne10_int16_t * pDst,
+                                         const ne10_int16_t * pSrc);
+
+    /**
+     * @brief Inverse 2-D DCT of a 8x8 block of integers.
+     *
+     * Points to @ref ne10_idct_8x8_int16_c or @ref ne10_idct_8x8_int16_neon.
+     */
+    extern void (*ne10_idct_8x8_int16) (ne10_int16_t * pDst,
+                                        const ne10_int16_t * pSrc);
+    extern void ne10_idct_8x8_int16_c (ne10_int16_t * pDst,
+                                       const ne10_int16_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_idct_8x8_int16 using NEON SIMD capabilities.
+     */
+    extern void ne10_idct_8x8_int16_neon (ne10_int16_t * pDst,
+                                          const ne10_int16_t * pSrc);
+
+    /**
+     * @brief Orthonormal 2-D DCT-II of a 4x4 block of integers.
+     *
+     * Points to @ref ne10_dct_4x4_int16_c or @ref ne10_dct_4x4_int16_neon.
+     */
+    extern void (*ne10_dct_4x4_int16) (ne10_int16_t * pDst,
+                                       const ne10_int16_t * pSrc);
+    extern void ne10_dct_4x4_int16_c (ne10_int16_t * pDst,
+                                      const ne10_int16_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_dct_4x4_int16 using NEON SIMD capabilities.
+     */
+    extern void ne10_dct_4x4_int16_neon (ne10_int16_t * pDst,
+                                         const ne10_int16_t * pSrc);
+
+    /**
+     * @brief Inverse 2-D DCT of a 4x4 block of integers.
+     *
+     * Points to @ref ne10_idct_4x4_int16_c or @ref ne10_idct_4x4_int16_neon.
+     */
+    extern void (*ne10_idct_4x4_int16) (ne10_int16_t * pDst,
+                                        const ne10_int16_t * pSrc);
+    extern void ne10_idct_4x4_int16_c (ne10_int16_t * pDst,
+                                       const ne10_int16_t * pSrc);
+    /**
+     * Specific implementation of @ref ne10_idct_4x4_int16 using NEON SIMD capabilities.
+     */
+    extern void ne10_idct_4x4_int16_neon (ne10_int16_t * pDst,
+                                          const ne10_int16_t * pSrc);
+    /** @} */ // DCT
+
+    /**
+     * @addtogroup Goertzel
+     * @{
+     */
+    extern ne10_goertzel_cfg_float32_t ne10_goertzel_alloc_float32 (ne10_uint32_t numBins,
+            const ne10_float32_t * pFreqs,
+            ne10_uint32_t blockLen);
+
+    extern void ne10_goertzel_destroy_float32 (ne10_goertzel_cfg_float32_t cfg);
+
+    extern ne10_sdft_cfg_float32_t ne10_sdft_alloc_float32 (ne10_uint32_t numBins,
+            const ne10_uint32_t * pBins,
+            ne10_uint32_t windowLen);
+
+    extern void ne10_sdft_destroy_float32 (ne10_sdft_cfg_float32_t cfg);
+
+    /**
+     * @brief Bank of Goertzel filters over a streaming input.
+     *
+     * Points to @ref ne10_goertzel_float32_c or @ref ne10_goertzel_float32_neon.
+     */
+    extern ne10_uint32_t (*ne10_goertzel_float32) (ne10_goertzel_cfg_float32_t cfg,
+                                                   ne10_float32_t * pPower,
+                                                   ne10_float32_t * pSrc,
+                                                   ne10_uint32_t srcLen);
+    extern ne10_uint32_t ne10_goertzel_float32_c (ne10_goertzel_cfg_float32_t cfg,
+                                                  ne10_float32_t * pPower,
+                                                  ne10_float32_t * pSrc,
+                                                  ne10_uint32_t srcLen);
+    /**
+     * Specific implementation of @ref ne10_goertzel_float32 using NEON SIMD capabilities.
+     */
+    extern ne10_uint32_t ne10_goertzel_float32_neon (ne10_goertzel_cfg_float32_t cfg,
+                                                     ne10_float32_t * pPower,
+                                                     ne10_float32_t * pSrc,
+                                                     ne10_uint32_t srcLen);
+
+    /**
+     * @brief Sliding DFT over a streaming input.
+     *
+     * Points to @ref ne10_sdft_float32_c or @ref ne10_sdft_float32_neon.
+     */
+    extern void (*ne10_sdft_float32) (ne10_sdft_cfg_float32_t cfg,
+                                      ne10_fft_cpx_float32_t * pDst,
+                                      ne10_float32_t * pSrc,
+                                      ne10_uint32_t srcLen);
+    extern void ne10_sdft_float32_c (ne10_sdft_cfg_float32_t cfg,
+                                     ne10_fft_cpx_float32_t * pDst,
+                                     ne10_float32_t * pSrc,
+                                     ne10_uint32_t srcLen);
+    /**
+     * Specific implementation of @ref ne10_sdft_float32 using NEON SIMD capabilities.
+     */
+    extern void ne10_sdft_float32_neon (ne10_sdft_cfg_float32_t cfg,
+                                        ne10_fft_cpx_float32_t * pDst,
+                                        ne10_float32_t * pSrc,
+                                        ne10_uint32_t srcLen);
+    /** @} */ // Goertzel
+
 #ifdef __cplusplus
 }
 #endif
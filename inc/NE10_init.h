@@ -39,6 +39,11 @@ extern "C" {
      */
     extern ne10_result_t ne10_HasNEON(void);
 
+    /*!
+        This routine returns NE10_OK if the running platform supports the ARMv8.2 dot product instructions (SDOT/UDOT), otherwise it returns NE10_ERR
+     */
+    extern ne10_result_t ne10_HasDotProd(void);
+
     /*!
         This routine initializes all the function pointers.
      */
@@ -50,6 +55,28 @@ extern "C" {
     extern ne10_result_t ne10_init_math (ne10_int32_t is_NEON_available);
     extern ne10_result_t ne10_init_dsp (ne10_int32_t is_NEON_available);
 
+    /*!
+        This routine installs the allocator used for all the memory the library allocates: FFT and filter
+        configurations, and the temporary buffers of functions such as the image resize. alloc_func is called
+        as alloc_func (size, ctx) and must return memory aligned for any type, or NULL on failure; free_func is
+        called as free_func (ptr, ctx). Passing NULL for both restores malloc and free. It returns NE10_ERR if
+        only one of them is NULL. The allocator should be set before anything is allocated, as memory must be
+        released with the allocator it came from.
+     */
+    extern ne10_result_t ne10_set_allocator (ne10_malloc_func_t alloc_func, ne10_free_func_t free_func, void * ctx);
+
+    /*!
+        This routine allocates size bytes aligned to NE10_MALLOC_ALIGNMENT bytes, padded up to a multiple
+        of NE10_MALLOC_ALIGNMENT bytes, as the _aligned math functions expect. It returns NULL on failure.
+        The memory must be released with ne10_free_aligned.
+     */
+    extern void * ne10_malloc_aligned (ne10_uint32_t size);
+
+    /*!
+        This routine releases memory returned by ne10_malloc_aligned. Passing NULL does nothing.
+     */
+    extern void ne10_free_aligned (void * ptr);
+
 #ifdef __cplusplus
 }
 #endif
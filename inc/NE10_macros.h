@@ -37,6 +37,7 @@
 #define NE10_MACROS_H
 
 #include <stdlib.h>
+#include "NE10_types.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -51,10 +52,16 @@ extern "C" {
 // some external macro definitions to be exposed to the users
 /////////////////////////////////////////////////////////
 
-#define NE10_MALLOC malloc
+// All the allocations of the library go through the allocator installed with
+// ne10_set_allocator, malloc and free by default. Memory from NE10_MALLOC must be
+// released with NE10_FREE.
+extern void * ne10_malloc (ne10_uint32_t size);
+extern void ne10_free (void * ptr);
+
+#define NE10_MALLOC(size) ne10_malloc (size)
 #define NE10_FREE(p) \
     do { \
-        free(p); \
+        ne10_free(p); \
         p = 0; \
     }while(0)
 
@@ -66,6 +73,14 @@ extern "C" {
         (address) = (((address) + ((alignment) - 1)) & ~ ((alignment) - 1)); \
     }while (0)
 
+// ne10_malloc_aligned returns memory aligned to NE10_MALLOC_ALIGNMENT bytes and
+// padded to a multiple of it. The _aligned math functions work on whole blocks
+// of NE10_ALIGNED_BLOCK single precision items, i.e. on NE10_ALIGNED_COUNT(count) items.
+#define NE10_MALLOC_ALIGNMENT 64
+#define NE10_ALIGNED_BLOCK 16     // NE10_MALLOC_ALIGNMENT / sizeof (ne10_float32_t)
+#define NE10_ALIGNED_COUNT(count) \
+    (((count) + (NE10_ALIGNED_BLOCK - 1)) & ~ (NE10_ALIGNED_BLOCK - 1))
+
 /////////////////////////////////////////////////////////
 // macro definitions for float to fixed point
 /////////////////////////////////////////////////////////
@@ -880,6 +880,461 @@ extern "C" {
     extern ne10_result_t ne10_vmla_vec4f_asm (ne10_vec4f_t * dst, ne10_vec4f_t * acc, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
     /** @} */
 
+    /**
+     * @ingroup groupMaths
+     * @defgroup FUSED_VEC Fused Vector Expressions
+     *
+     * \par
+     * These functions evaluate short element-wise expressions over single precision floating point
+     * arrays in a single pass, keeping the intermediate values in registers. For arrays larger than
+     * the data cache, this avoids the memory traffic of chaining one Ne10 call per operation. For
+     * dst[i] = acc[i] + src1[i] * src2[i], see @ref ne10_mla_float.
+     * @{
+     */
+
+    /**
+     * Computes a linear combination of two input arrays (dst[i] = src1[i] * a + src2[i] * b) in a
+     * single pass. This operation can be performed in-place. Points to @ref ne10_axpby_float_c or
+     * @ref ne10_axpby_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  a     The constant to multiply the first source array by
+     * @param[in]  b     The constant to multiply the second source array by
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_axpby_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, const ne10_float32_t a, const ne10_float32_t b, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_axpby_float using plain C code. */
+    extern ne10_result_t ne10_axpby_float_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, const ne10_float32_t a, const ne10_float32_t b, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_axpby_float using NEON intrinsics. */
+    extern ne10_result_t ne10_axpby_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, const ne10_float32_t a, const ne10_float32_t b, ne10_uint32_t count) asm ("ne10_axpby_float_neon");
+
+    /**
+     * Multiplies all elements of an input array by a constant and adds another constant to the
+     * products (dst[i] = src[i] * scale + offset), replacing a call to @ref ne10_mulc_float followed
+     * by one to @ref ne10_addc_float. This operation can be performed in-place. Points to
+     * @ref ne10_mulcaddc_float_c or @ref ne10_mulcaddc_float_neon.
+     *
+     * @param[out] dst    Pointer to the destination array
+     * @param[in]  src    Pointer to the source array
+     * @param[in]  scale  The constant to multiply by
+     * @param[in]  offset The constant to add
+     * @param[in]  count  The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_mulcaddc_float) (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t scale, const ne10_float32_t offset, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulcaddc_float using plain C code. */
+    extern ne10_result_t ne10_mulcaddc_float_c (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t scale, const ne10_float32_t offset, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulcaddc_float using NEON intrinsics. */
+    extern ne10_result_t ne10_mulcaddc_float_neon (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t scale, const ne10_float32_t offset, ne10_uint32_t count) asm ("ne10_mulcaddc_float_neon");
+
+    /**
+     * Limits all elements of an input array to the range [lo, hi]. lo must not be greater than hi.
+     * This operation can be performed in-place. Points to @ref ne10_clamp_float_c or
+     * @ref ne10_clamp_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  lo    The lower bound
+     * @param[in]  hi    The upper bound
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_clamp_float) (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t lo, const ne10_float32_t hi, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_clamp_float using plain C code. */
+    extern ne10_result_t ne10_clamp_float_c (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t lo, const ne10_float32_t hi, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_clamp_float using NEON intrinsics. */
+    extern ne10_result_t ne10_clamp_float_neon (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t lo, const ne10_float32_t hi, ne10_uint32_t count) asm ("ne10_clamp_float_neon");
+
+    /**
+     * Linearly interpolates between two input arrays (dst[i] = src1[i] + (src2[i] - src1[i]) * t). t =
+     * 0 gives src1 and t = 1 gives src2. This operation can be performed in-place. Points to
+     * @ref ne10_lerp_float_c or @ref ne10_lerp_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  t     The interpolation factor
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_lerp_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, const ne10_float32_t t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_lerp_float using plain C code. */
+    extern ne10_result_t ne10_lerp_float_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, const ne10_float32_t t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_lerp_float using NEON intrinsics. */
+    extern ne10_result_t ne10_lerp_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, const ne10_float32_t t, ne10_uint32_t count) asm ("ne10_lerp_float_neon");
+
+    /**
+     * Adds the squared differences of two input arrays to a third array (dst[i] = acc[i] + (src1[i] -
+     * src2[i])^2), as used to accumulate squared errors or distances over several blocks. This
+     * operation can be performed in-place. Points to @ref ne10_sqdiff_acc_float_c or
+     * @ref ne10_sqdiff_acc_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  acc   Pointer to the array of elements to be added to the squared differences
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_sqdiff_acc_float) (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sqdiff_acc_float using plain C code. */
+    extern ne10_result_t ne10_sqdiff_acc_float_c (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sqdiff_acc_float using NEON intrinsics. */
+    extern ne10_result_t ne10_sqdiff_acc_float_neon (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) asm ("ne10_sqdiff_acc_float_neon");
+
+    /**
+     * Multiplies all elements of an input array by a constant and converts the products to 16-bit
+     * integers, rounding to nearest with ties away from zero and saturating to [-32768, 32767]. With
+     * scale = 32768 this converts floating point samples in [-1, 1) to Q15. Points to
+     * @ref ne10_scale_float_s16_c or @ref ne10_scale_float_s16_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  scale The constant to multiply by before the conversion
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_scale_float_s16) (ne10_int16_t * dst, ne10_float32_t * src, const ne10_float32_t scale, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_scale_float_s16 using plain C code. */
+    extern ne10_result_t ne10_scale_float_s16_c (ne10_int16_t * dst, ne10_float32_t * src, const ne10_float32_t scale, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_scale_float_s16 using NEON intrinsics. */
+    extern ne10_result_t ne10_scale_float_s16_neon (ne10_int16_t * dst, ne10_float32_t * src, const ne10_float32_t scale, ne10_uint32_t count) asm ("ne10_scale_float_s16_neon");
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup CONVERT Type Conversions
+     *
+     * \par
+     * These functions convert arrays between single precision floating point, half precision, fixed
+     * point and integer formats, as needed between the fixed point FFTs, the image processing kernels
+     * and the floating point math functions. The NEON versions give bit exact results with the C
+     * versions on both ARMv7 and AArch64: subnormal values round as zero, as under the flush to zero
+     * of ARMv7 NEON. In-place conversion is not supported.
+     * @{
+     */
+
+    /**
+     * Converts floating point values to Q15 (or any 16-bit fixed point format): each value is
+     * multiplied by scale, rounded in the given mode and saturated to [-32768, 32767]. Use scale =
+     * 32768 for Q15. Returns NE10_ERR for an invalid rounding mode. Also suitable for
+     * ne10_fft_cpx_int16_t arrays, taking count as twice the number of complex values. Points to
+     * @ref ne10_convert_float_q15_c or @ref ne10_convert_float_q15_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  scale The constant to multiply by before rounding
+     * @param[in]  mode  The rounding applied to the scaled values
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_convert_float_q15) (ne10_int16_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_float_q15 using plain C code. */
+    extern ne10_result_t ne10_convert_float_q15_c (ne10_int16_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_float_q15 using NEON intrinsics. */
+    extern ne10_result_t ne10_convert_float_q15_neon (ne10_int16_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count) asm ("ne10_convert_float_q15_neon");
+
+    /**
+     * Converts Q15 (or any 16-bit fixed point) values to floating point, multiplying them by scale.
+     * Use scale = 1/32768 for Q15. Points to @ref ne10_convert_q15_float_c or
+     * @ref ne10_convert_q15_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  scale The constant to multiply by after the conversion
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_convert_q15_float) (ne10_float32_t * dst, ne10_int16_t * src, ne10_float32_t scale, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_q15_float using plain C code. */
+    extern ne10_result_t ne10_convert_q15_float_c (ne10_float32_t * dst, ne10_int16_t * src, ne10_float32_t scale, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_q15_float using NEON intrinsics. */
+    extern ne10_result_t ne10_convert_q15_float_neon (ne10_float32_t * dst, ne10_int16_t * src, ne10_float32_t scale, ne10_uint32_t count) asm ("ne10_convert_q15_float_neon");
+
+    /**
+     * Converts floating point values to Q31 (or any 32-bit fixed point format): each value is
+     * multiplied by scale, rounded in the given mode and saturated to the int32 range. Use scale =
+     * 2147483648 for Q31; single precision keeps 24 significant bits of the result. NaN converts to 0.
+     * Returns NE10_ERR for an invalid rounding mode. Points to @ref ne10_convert_float_q31_c or
+     * @ref ne10_convert_float_q31_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  scale The constant to multiply by before rounding
+     * @param[in]  mode  The rounding applied to the scaled values
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_convert_float_q31) (ne10_int32_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_float_q31 using plain C code. */
+    extern ne10_result_t ne10_convert_float_q31_c (ne10_int32_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_float_q31 using NEON intrinsics. */
+    extern ne10_result_t ne10_convert_float_q31_neon (ne10_int32_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count) asm ("ne10_convert_float_q31_neon");
+
+    /**
+     * Converts Q31 (or any 32-bit fixed point) values to floating point, multiplying them by scale.
+     * Use scale = 1/2147483648 for Q31. Points to @ref ne10_convert_q31_float_c or
+     * @ref ne10_convert_q31_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  scale The constant to multiply by after the conversion
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_convert_q31_float) (ne10_float32_t * dst, ne10_int32_t * src, ne10_float32_t scale, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_q31_float using plain C code. */
+    extern ne10_result_t ne10_convert_q31_float_c (ne10_float32_t * dst, ne10_int32_t * src, ne10_float32_t scale, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_q31_float using NEON intrinsics. */
+    extern ne10_result_t ne10_convert_q31_float_neon (ne10_float32_t * dst, ne10_int32_t * src, ne10_float32_t scale, ne10_uint32_t count) asm ("ne10_convert_q31_float_neon");
+
+    /**
+     * Converts floating point values to 8-bit unsigned integers, such as pixel values: each value is
+     * multiplied by scale, rounded in the given mode and saturated to [0, 255]. Returns NE10_ERR for
+     * an invalid rounding mode. Points to @ref ne10_convert_float_u8_c or
+     * @ref ne10_convert_float_u8_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  scale The constant to multiply by before rounding
+     * @param[in]  mode  The rounding applied to the scaled values
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_convert_float_u8) (ne10_uint8_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_float_u8 using plain C code. */
+    extern ne10_result_t ne10_convert_float_u8_c (ne10_uint8_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_float_u8 using NEON intrinsics. */
+    extern ne10_result_t ne10_convert_float_u8_neon (ne10_uint8_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count) asm ("ne10_convert_float_u8_neon");
+
+    /**
+     * Converts 8-bit unsigned integers to floating point, multiplying them by scale. Points to
+     * @ref ne10_convert_u8_float_c or @ref ne10_convert_u8_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  scale The constant to multiply by after the conversion
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_convert_u8_float) (ne10_float32_t * dst, ne10_uint8_t * src, ne10_float32_t scale, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_u8_float using plain C code. */
+    extern ne10_result_t ne10_convert_u8_float_c (ne10_float32_t * dst, ne10_uint8_t * src, ne10_float32_t scale, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_u8_float using NEON intrinsics. */
+    extern ne10_result_t ne10_convert_u8_float_neon (ne10_float32_t * dst, ne10_uint8_t * src, ne10_float32_t scale, ne10_uint32_t count) asm ("ne10_convert_u8_float_neon");
+
+    /**
+     * Converts single precision values to IEEE 754 half precision, rounding to nearest even. Values
+     * too large for half precision become infinities, and NaNs become the quiet NaN 0x7e00 with their
+     * sign. The NEON version does not need the ARMv7 half precision extension. Points to
+     * @ref ne10_convert_float_f16_c or @ref ne10_convert_float_f16_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_convert_float_f16) (ne10_float16_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_float_f16 using plain C code. */
+    extern ne10_result_t ne10_convert_float_f16_c (ne10_float16_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_float_f16 using NEON intrinsics. */
+    extern ne10_result_t ne10_convert_float_f16_neon (ne10_float16_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_convert_float_f16_neon");
+
+    /**
+     * Converts IEEE 754 half precision values, including subnormals, to single precision. The
+     * conversion is exact. Points to @ref ne10_convert_f16_float_c or
+     * @ref ne10_convert_f16_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_convert_f16_float) (ne10_float32_t * dst, ne10_float16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_f16_float using plain C code. */
+    extern ne10_result_t ne10_convert_f16_float_c (ne10_float32_t * dst, ne10_float16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_f16_float using NEON intrinsics. */
+    extern ne10_result_t ne10_convert_f16_float_neon (ne10_float32_t * dst, ne10_float16_t * src, ne10_uint32_t count) asm ("ne10_convert_f16_float_neon");
+
+    /**
+     * Widens 16-bit integers to 32 bits, shifting them left by shift bits (16 to convert Q15 to Q31).
+     * Returns NE10_ERR if shift is greater than 16. Points to @ref ne10_convert_int16_int32_c or
+     * @ref ne10_convert_int16_int32_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  shift The number of bits to shift left by, from 0 to 16
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_convert_int16_int32) (ne10_int32_t * dst, ne10_int16_t * src, ne10_uint32_t shift, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_int16_int32 using plain C code. */
+    extern ne10_result_t ne10_convert_int16_int32_c (ne10_int32_t * dst, ne10_int16_t * src, ne10_uint32_t shift, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_int16_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_convert_int16_int32_neon (ne10_int32_t * dst, ne10_int16_t * src, ne10_uint32_t shift, ne10_uint32_t count) asm ("ne10_convert_int16_int32_neon");
+
+    /**
+     * Narrows 32-bit integers to 16 bits, shifting them right by shift bits with rounding (ties toward
+     * plus infinity) and saturating to [-32768, 32767]. Use shift = 16 to convert Q31 to Q15. Returns
+     * NE10_ERR if shift is greater than 31. Points to @ref ne10_convert_int32_int16_c or
+     * @ref ne10_convert_int32_int16_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  shift The number of bits to shift right by, from 0 to 31
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_convert_int32_int16) (ne10_int16_t * dst, ne10_int32_t * src, ne10_uint32_t shift, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_int32_int16 using plain C code. */
+    extern ne10_result_t ne10_convert_int32_int16_c (ne10_int16_t * dst, ne10_int32_t * src, ne10_uint32_t shift, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_convert_int32_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_convert_int32_int16_neon (ne10_int16_t * dst, ne10_int32_t * src, ne10_uint32_t shift, ne10_uint32_t count) asm ("ne10_convert_int32_int16_neon");
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup ALIGNED_VEC Aligned Vector Arithmetic
+     *
+     * \par
+     * These functions are fast path versions of the single precision vector arithmetic functions
+     * for buffers from @ref ne10_malloc_aligned. They require every array to be aligned to
+     * NE10_MALLOC_ALIGNMENT bytes, and always process NE10_ALIGNED_COUNT(count) items, i.e. count
+     * rounded up to a multiple of NE10_ALIGNED_BLOCK, so the arrays must be padded accordingly. In
+     * return there is no scalar loop for the leftover items, the loads and stores are aligned, and
+     * the pointer overlap checks are skipped. In-place operation on an input array is supported.
+     * @{
+     */
+
+    /**
+     * Adds a constant to each element of an input array, like @ref ne10_addc_float, on aligned and
+     * padded arrays. Points to @ref ne10_addc_float_aligned_c or @ref ne10_addc_float_aligned_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  cst   The constant to add
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_addc_float_aligned) (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_addc_float_aligned using plain C code. */
+    extern ne10_result_t ne10_addc_float_aligned_c (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_addc_float_aligned using NEON intrinsics. */
+    extern ne10_result_t ne10_addc_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count) asm ("ne10_addc_float_aligned_neon");
+
+    /**
+     * Subtracts a constant from each element of an input array, like @ref ne10_subc_float, on aligned
+     * and padded arrays. Points to @ref ne10_subc_float_aligned_c or
+     * @ref ne10_subc_float_aligned_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  cst   The constant to subtract
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_subc_float_aligned) (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_subc_float_aligned using plain C code. */
+    extern ne10_result_t ne10_subc_float_aligned_c (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_subc_float_aligned using NEON intrinsics. */
+    extern ne10_result_t ne10_subc_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count) asm ("ne10_subc_float_aligned_neon");
+
+    /**
+     * Multiplies each element of an input array by a constant, like @ref ne10_mulc_float, on aligned
+     * and padded arrays. Points to @ref ne10_mulc_float_aligned_c or
+     * @ref ne10_mulc_float_aligned_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  cst   The constant to multiply by
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_mulc_float_aligned) (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulc_float_aligned using plain C code. */
+    extern ne10_result_t ne10_mulc_float_aligned_c (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulc_float_aligned using NEON intrinsics. */
+    extern ne10_result_t ne10_mulc_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count) asm ("ne10_mulc_float_aligned_neon");
+
+    /**
+     * Multiplies each element of an input array by a constant and adds the products to an accumulator
+     * array, like @ref ne10_mlac_float, on aligned and padded arrays. Points to
+     * @ref ne10_mlac_float_aligned_c or @ref ne10_mlac_float_aligned_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  acc   Pointer to the accumulator array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  cst   The constant to multiply by
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_mlac_float_aligned) (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mlac_float_aligned using plain C code. */
+    extern ne10_result_t ne10_mlac_float_aligned_c (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mlac_float_aligned using NEON intrinsics. */
+    extern ne10_result_t ne10_mlac_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count) asm ("ne10_mlac_float_aligned_neon");
+
+    /**
+     * Sets each element of an array to a constant, like @ref ne10_setc_float, on aligned and padded
+     * arrays. Points to @ref ne10_setc_float_aligned_c or @ref ne10_setc_float_aligned_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  cst   The constant to set
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_setc_float_aligned) (ne10_float32_t * dst, const ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_setc_float_aligned using plain C code. */
+    extern ne10_result_t ne10_setc_float_aligned_c (ne10_float32_t * dst, const ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_setc_float_aligned using NEON intrinsics. */
+    extern ne10_result_t ne10_setc_float_aligned_neon (ne10_float32_t * dst, const ne10_float32_t cst, ne10_uint32_t count) asm ("ne10_setc_float_aligned_neon");
+
+    /**
+     * Adds the elements of two input arrays, like @ref ne10_add_float, on aligned and padded arrays.
+     * Points to @ref ne10_add_float_aligned_c or @ref ne10_add_float_aligned_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_add_float_aligned) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_float_aligned using plain C code. */
+    extern ne10_result_t ne10_add_float_aligned_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_float_aligned using NEON intrinsics. */
+    extern ne10_result_t ne10_add_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) asm ("ne10_add_float_aligned_neon");
+
+    /**
+     * Subtracts the elements of the second input array from those of the first, like
+     * @ref ne10_sub_float, on aligned and padded arrays. Points to @ref ne10_sub_float_aligned_c or
+     * @ref ne10_sub_float_aligned_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_sub_float_aligned) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_float_aligned using plain C code. */
+    extern ne10_result_t ne10_sub_float_aligned_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_float_aligned using NEON intrinsics. */
+    extern ne10_result_t ne10_sub_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) asm ("ne10_sub_float_aligned_neon");
+
+    /**
+     * Multiplies the elements of two input arrays, like @ref ne10_mul_float, on aligned and padded
+     * arrays. Points to @ref ne10_mul_float_aligned_c or @ref ne10_mul_float_aligned_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_mul_float_aligned) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mul_float_aligned using plain C code. */
+    extern ne10_result_t ne10_mul_float_aligned_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mul_float_aligned using NEON intrinsics. */
+    extern ne10_result_t ne10_mul_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) asm ("ne10_mul_float_aligned_neon");
+
+    /**
+     * Multiplies the elements of two input arrays and adds the products to an accumulator array, like
+     * @ref ne10_mla_float, on aligned and padded arrays. Points to @ref ne10_mla_float_aligned_c or
+     * @ref ne10_mla_float_aligned_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  acc   Pointer to the accumulator array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of items in the arrays
+     */
+    extern ne10_result_t (*ne10_mla_float_aligned) (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mla_float_aligned using plain C code. */
+    extern ne10_result_t ne10_mla_float_aligned_c (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mla_float_aligned using NEON intrinsics. */
+    extern ne10_result_t ne10_mla_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) asm ("ne10_mla_float_aligned_neon");
+    /** @} */
+
     /**
      * @ingroup groupMaths
      * @defgroup MUL_MAT Matrix Multiplication
@@ -1603,111 +2058,492 @@ extern "C" {
 
     /**
      * @ingroup groupMaths
-     * @defgroup DET_MAT Matrix Determinant Calculation
+     * @defgroup SOA_VEC Structure-of-Arrays Vector Math
      *
      * \par
-     * These functions implement matrix determinant operations for single precision floating point values.
+     * These functions implement vector arithmetic, dot and cross products, lengths and normalization
+     * for vectors stored as separate x[], y[], z[] (and w[]) component arrays, as well as the
+     * conversions between that layout and the interleaved ne10_vec2f_t, ne10_vec3f_t and ne10_vec4f_t
+     * arrays. Every NEON load and store is then a contiguous four-lane access, with no lanes left idle
+     * for 3D data. Results match the interleaved functions of the same name.
      * @{
      */
 
     /**
-     * Calculates the determinant of 4x4 matrices within an input array, storing the results
-     * in an output array. Points to @ref ne10_detmat_4x4f_c, @ref ne10_detmat_4x4f_neon, or
-     * @ref ne10_detmat_4x4f_asm.
+     * Adds the 2D vectors of one structure-of-arrays set to those of the same index in another,
+     * component by component. Points to @ref ne10_add_vec2f_soa_c or @ref ne10_add_vec2f_soa_neon.
      *
-     * @param[out] dst   Pointer to the destination array
-     * @param[in]  src   Pointer to the source array
-     * @param[in]  count The number of matrices to be processed
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
      */
-    extern ne10_result_t (*ne10_detmat_4x4f) (ne10_float32_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
-    /** Specific implementation of @ref ne10_detmat_4x4f using plain C code. */
-    extern ne10_result_t ne10_detmat_4x4f_c (ne10_float32_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
-    /** Specific implementation of @ref ne10_detmat_4x4f using NEON intrinsics. */
-    extern ne10_result_t ne10_detmat_4x4f_neon (ne10_float32_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count) asm ("ne10_detmat_4x4f_neon");
-    /** Specific implementation of @ref ne10_detmat_4x4f using NEON assembly. */
-    extern ne10_result_t ne10_detmat_4x4f_asm (ne10_float32_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
+    extern ne10_result_t (*ne10_add_vec2f_soa) (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_vec2f_soa using plain C code. */
+    extern ne10_result_t ne10_add_vec2f_soa_c (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_vec2f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_add_vec2f_soa_neon (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count) asm ("ne10_add_vec2f_soa_neon");
 
     /**
-     * Calculates the determinant of 3x3 matrices within an input array, storing the results
-     * in an output array. Points to @ref ne10_detmat_3x3f_c, @ref ne10_detmat_3x3f_neon, or
-     * @ref ne10_detmat_3x3f_asm.
+     * Adds the 3D vectors of one structure-of-arrays set to those of the same index in another,
+     * component by component. Points to @ref ne10_add_vec3f_soa_c or @ref ne10_add_vec3f_soa_neon.
      *
-     * @param[out] dst   Pointer to the destination array
-     * @param[in]  src   Pointer to the source array
-     * @param[in]  count The number of matrices to be processed
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
      */
-    extern ne10_result_t (*ne10_detmat_3x3f) (ne10_float32_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
-    /** Specific implementation of @ref ne10_detmat_3x3f using plain C code. */
-    extern ne10_result_t ne10_detmat_3x3f_c (ne10_float32_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
-    /** Specific implementation of @ref ne10_detmat_3x3f using NEON intrinsics. */
-    extern ne10_result_t ne10_detmat_3x3f_neon (ne10_float32_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count) asm ("ne10_detmat_3x3f_neon");
-    /** Specific implementation of @ref ne10_detmat_3x3f using NEON assembly. */
-    extern ne10_result_t ne10_detmat_3x3f_asm (ne10_float32_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+    extern ne10_result_t (*ne10_add_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_vec3f_soa using plain C code. */
+    extern ne10_result_t ne10_add_vec3f_soa_c (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_vec3f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_add_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count) asm ("ne10_add_vec3f_soa_neon");
 
     /**
-     * Calculates the determinant of 2x2 matrices within an input array, storing the results
-     * in an output array. Points to @ref ne10_detmat_2x2f_c, @ref ne10_detmat_2x2f_neon, or
-     * @ref ne10_detmat_2x2f_asm.
+     * Adds the 4D vectors of one structure-of-arrays set to those of the same index in another,
+     * component by component. Points to @ref ne10_add_vec4f_soa_c or @ref ne10_add_vec4f_soa_neon.
      *
-     * @param[out] dst   Pointer to the destination array
-     * @param[in]  src   Pointer to the source array
-     * @param[in]  count The number of matrices to be processed
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
      */
-    extern ne10_result_t (*ne10_detmat_2x2f) (ne10_float32_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count);
-    /** Specific implementation of @ref ne10_detmat_2x2f using plain C code. */
-    extern ne10_result_t ne10_detmat_2x2f_c (ne10_float32_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count);
-    /** Specific implementation of @ref ne10_detmat_2x2f using NEON intrinsics. */
-    extern ne10_result_t ne10_detmat_2x2f_neon (ne10_float32_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count) asm ("ne10_detmat_2x2f_neon");
-    /** Specific implementation of @ref ne10_detmat_2x2f using NEON assembly. */
-    extern ne10_result_t ne10_detmat_2x2f_asm (ne10_float32_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count);
-    /** @} */
+    extern ne10_result_t (*ne10_add_vec4f_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_vec4f_soa using plain C code. */
+    extern ne10_result_t ne10_add_vec4f_soa_c (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_vec4f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_add_vec4f_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count) asm ("ne10_add_vec4f_soa_neon");
 
     /**
-     * @ingroup groupMaths
-     * @defgroup INV_MAT Matrix Inversion
+     * Subtracts the 2D vectors of the second structure-of-arrays set from those of the same index in
+     * the first, component by component. Points to @ref ne10_sub_vec2f_soa_c or
+     * @ref ne10_sub_vec2f_soa_neon.
      *
-     * \par
-     * These functions implement matrix inversion operations for single precision floating point values.
-     * @{
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
      */
+    extern ne10_result_t (*ne10_sub_vec2f_soa) (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_vec2f_soa using plain C code. */
+    extern ne10_result_t ne10_sub_vec2f_soa_c (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_vec2f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_sub_vec2f_soa_neon (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count) asm ("ne10_sub_vec2f_soa_neon");
 
     /**
-     * Calculates the inverse of 4x4 matrices within an input array, storing the results
-     * in an output array. Points to @ref ne10_invmat_4x4f_c, @ref ne10_invmat_4x4f_neon, or
-     * @ref ne10_invmat_4x4f_asm.
+     * Subtracts the 3D vectors of the second structure-of-arrays set from those of the same index in
+     * the first, component by component. Points to @ref ne10_sub_vec3f_soa_c or
+     * @ref ne10_sub_vec3f_soa_neon.
      *
-     * @param[out] dst   Pointer to the destination array
-     * @param[in]  src   Pointer to the source array
-     * @param[in]  count The number of matrices to be processed
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
      */
-    extern ne10_result_t (*ne10_invmat_4x4f) (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
-    /** Specific implementation of @ref ne10_invmat_4x4f using plain C code. */
-    extern ne10_result_t ne10_invmat_4x4f_c (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
-    /** Specific implementation of @ref ne10_invmat_4x4f using NEON intrinsics. */
-    extern ne10_result_t ne10_invmat_4x4f_neon (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count) asm ("ne10_invmat_4x4f_neon");
-    /** Specific implementation of @ref ne10_invmat_4x4f using NEON assembly. */
-    extern ne10_result_t ne10_invmat_4x4f_asm (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
+    extern ne10_result_t (*ne10_sub_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_vec3f_soa using plain C code. */
+    extern ne10_result_t ne10_sub_vec3f_soa_c (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_vec3f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_sub_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count) asm ("ne10_sub_vec3f_soa_neon");
 
     /**
-     * Calculates the inverse of 3x3 matrices within an input array, storing the results
-     * in an output array. Points to @ref ne10_invmat_3x3f_c, @ref ne10_invmat_3x3f_neon, or
-     * @ref ne10_invmat_3x3f_asm.
+     * Subtracts the 4D vectors of the second structure-of-arrays set from those of the same index in
+     * the first, component by component. Points to @ref ne10_sub_vec4f_soa_c or
+     * @ref ne10_sub_vec4f_soa_neon.
      *
-     * @param[out] dst   Pointer to the destination array
-     * @param[in]  src   Pointer to the source array
-     * @param[in]  count The number of matrices to be processed
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
      */
-    extern ne10_result_t (*ne10_invmat_3x3f) (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
-    /** Specific implementation of @ref ne10_invmat_3x3f using plain C code. */
-    extern ne10_result_t ne10_invmat_3x3f_c (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
-    /** Specific implementation of @ref ne10_invmat_3x3f using NEON intrinsics. */
-    extern ne10_result_t ne10_invmat_3x3f_neon (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count) asm ("ne10_invmat_3x3f_neon");
-    /** Specific implementation of @ref ne10_invmat_3x3f using NEON assembly. */
-    extern ne10_result_t ne10_invmat_3x3f_asm (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+    extern ne10_result_t (*ne10_sub_vec4f_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_vec4f_soa using plain C code. */
+    extern ne10_result_t ne10_sub_vec4f_soa_c (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_vec4f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_sub_vec4f_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count) asm ("ne10_sub_vec4f_soa_neon");
 
     /**
-     * Calculates the inverse of 2x2 matrices within an input array, storing the results
-     * in an output array. Points to @ref ne10_invmat_2x2f_c, @ref ne10_invmat_2x2f_neon, or
+     * Multiplies the 2D vectors of one structure-of-arrays set by those of the same index in another,
+     * component by component. Points to @ref ne10_vmul_vec2f_soa_c or @ref ne10_vmul_vec2f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vmul_vec2f_soa) (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmul_vec2f_soa using plain C code. */
+    extern ne10_result_t ne10_vmul_vec2f_soa_c (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmul_vec2f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_vmul_vec2f_soa_neon (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count) asm ("ne10_vmul_vec2f_soa_neon");
+
+    /**
+     * Multiplies the 3D vectors of one structure-of-arrays set by those of the same index in another,
+     * component by component. Points to @ref ne10_vmul_vec3f_soa_c or @ref ne10_vmul_vec3f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vmul_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmul_vec3f_soa using plain C code. */
+    extern ne10_result_t ne10_vmul_vec3f_soa_c (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmul_vec3f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_vmul_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count) asm ("ne10_vmul_vec3f_soa_neon");
+
+    /**
+     * Multiplies the 4D vectors of one structure-of-arrays set by those of the same index in another,
+     * component by component. Points to @ref ne10_vmul_vec4f_soa_c or @ref ne10_vmul_vec4f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vmul_vec4f_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmul_vec4f_soa using plain C code. */
+    extern ne10_result_t ne10_vmul_vec4f_soa_c (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmul_vec4f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_vmul_vec4f_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count) asm ("ne10_vmul_vec4f_soa_neon");
+
+    /**
+     * Calculates the dot products of the 2D vectors of one structure-of-arrays set with those of the
+     * same index in another. Points to @ref ne10_dot_vec2f_soa_c or @ref ne10_dot_vec2f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_dot_vec2f_soa) (ne10_float32_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec2f_soa using plain C code. */
+    extern ne10_result_t ne10_dot_vec2f_soa_c (ne10_float32_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec2f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_dot_vec2f_soa_neon (ne10_float32_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count) asm ("ne10_dot_vec2f_soa_neon");
+
+    /**
+     * Calculates the dot products of the 3D vectors of one structure-of-arrays set with those of the
+     * same index in another. Points to @ref ne10_dot_vec3f_soa_c or @ref ne10_dot_vec3f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_dot_vec3f_soa) (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec3f_soa using plain C code. */
+    extern ne10_result_t ne10_dot_vec3f_soa_c (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec3f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_dot_vec3f_soa_neon (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count) asm ("ne10_dot_vec3f_soa_neon");
+
+    /**
+     * Calculates the dot products of the 4D vectors of one structure-of-arrays set with those of the
+     * same index in another. Points to @ref ne10_dot_vec4f_soa_c or @ref ne10_dot_vec4f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_dot_vec4f_soa) (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec4f_soa using plain C code. */
+    extern ne10_result_t ne10_dot_vec4f_soa_c (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec4f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_dot_vec4f_soa_neon (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count) asm ("ne10_dot_vec4f_soa_neon");
+
+    /**
+     * Calculates the cross products of the 3D vectors of one structure-of-arrays set with those of the
+     * same index in another. This operation cannot be performed in-place. Points to
+     * @ref ne10_cross_vec3f_soa_c or @ref ne10_cross_vec3f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src1  Pointer to the first source component arrays
+     * @param[in]  src2  Pointer to the second source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_cross_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cross_vec3f_soa using plain C code. */
+    extern ne10_result_t ne10_cross_vec3f_soa_c (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cross_vec3f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_cross_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count) asm ("ne10_cross_vec3f_soa_neon");
+
+    /**
+     * Calculates the lengths of a structure-of-arrays set of 2D vectors. Points to
+     * @ref ne10_len_vec2f_soa_c or @ref ne10_len_vec2f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_len_vec2f_soa) (ne10_float32_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec2f_soa using plain C code. */
+    extern ne10_result_t ne10_len_vec2f_soa_c (ne10_float32_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec2f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_len_vec2f_soa_neon (ne10_float32_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count) asm ("ne10_len_vec2f_soa_neon");
+
+    /**
+     * Calculates the lengths of a structure-of-arrays set of 3D vectors. Points to
+     * @ref ne10_len_vec3f_soa_c or @ref ne10_len_vec3f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_len_vec3f_soa) (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec3f_soa using plain C code. */
+    extern ne10_result_t ne10_len_vec3f_soa_c (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec3f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_len_vec3f_soa_neon (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count) asm ("ne10_len_vec3f_soa_neon");
+
+    /**
+     * Calculates the lengths of a structure-of-arrays set of 4D vectors. Points to
+     * @ref ne10_len_vec4f_soa_c or @ref ne10_len_vec4f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_len_vec4f_soa) (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec4f_soa using plain C code. */
+    extern ne10_result_t ne10_len_vec4f_soa_c (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec4f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_len_vec4f_soa_neon (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count) asm ("ne10_len_vec4f_soa_neon");
+
+    /**
+     * Normalizes a structure-of-arrays set of 2D vectors to unit length. Points to
+     * @ref ne10_normalize_vec2f_soa_c or @ref ne10_normalize_vec2f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src   Pointer to the source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_normalize_vec2f_soa) (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec2f_soa using plain C code. */
+    extern ne10_result_t ne10_normalize_vec2f_soa_c (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec2f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_normalize_vec2f_soa_neon (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count) asm ("ne10_normalize_vec2f_soa_neon");
+
+    /**
+     * Normalizes a structure-of-arrays set of 3D vectors to unit length. Points to
+     * @ref ne10_normalize_vec3f_soa_c or @ref ne10_normalize_vec3f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src   Pointer to the source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_normalize_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec3f_soa using plain C code. */
+    extern ne10_result_t ne10_normalize_vec3f_soa_c (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec3f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_normalize_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count) asm ("ne10_normalize_vec3f_soa_neon");
+
+    /**
+     * Normalizes a structure-of-arrays set of 4D vectors to unit length. Points to
+     * @ref ne10_normalize_vec4f_soa_c or @ref ne10_normalize_vec4f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src   Pointer to the source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_normalize_vec4f_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec4f_soa using plain C code. */
+    extern ne10_result_t ne10_normalize_vec4f_soa_c (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec4f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_normalize_vec4f_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count) asm ("ne10_normalize_vec4f_soa_neon");
+
+    /**
+     * Splits an array of 2D vectors into separate component arrays. Points to
+     * @ref ne10_vec2f_aos_to_soa_c or @ref ne10_vec2f_aos_to_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src   Pointer to the source vector array
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vec2f_aos_to_soa) (ne10_vec2f_soa_t * dst, ne10_vec2f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec2f_aos_to_soa using plain C code. */
+    extern ne10_result_t ne10_vec2f_aos_to_soa_c (ne10_vec2f_soa_t * dst, ne10_vec2f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec2f_aos_to_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_vec2f_aos_to_soa_neon (ne10_vec2f_soa_t * dst, ne10_vec2f_t * src, ne10_uint32_t count) asm ("ne10_vec2f_aos_to_soa_neon");
+
+    /**
+     * Interleaves separate component arrays into an array of 2D vectors. Points to
+     * @ref ne10_vec2f_soa_to_aos_c or @ref ne10_vec2f_soa_to_aos_neon.
+     *
+     * @param[out] dst   Pointer to the destination vector array
+     * @param[in]  src   Pointer to the source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vec2f_soa_to_aos) (ne10_vec2f_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec2f_soa_to_aos using plain C code. */
+    extern ne10_result_t ne10_vec2f_soa_to_aos_c (ne10_vec2f_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec2f_soa_to_aos using NEON intrinsics. */
+    extern ne10_result_t ne10_vec2f_soa_to_aos_neon (ne10_vec2f_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count) asm ("ne10_vec2f_soa_to_aos_neon");
+
+    /**
+     * Splits an array of 3D vectors into separate component arrays. Points to
+     * @ref ne10_vec3f_aos_to_soa_c or @ref ne10_vec3f_aos_to_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src   Pointer to the source vector array
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vec3f_aos_to_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec3f_aos_to_soa using plain C code. */
+    extern ne10_result_t ne10_vec3f_aos_to_soa_c (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec3f_aos_to_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_vec3f_aos_to_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count) asm ("ne10_vec3f_aos_to_soa_neon");
+
+    /**
+     * Interleaves separate component arrays into an array of 3D vectors. Points to
+     * @ref ne10_vec3f_soa_to_aos_c or @ref ne10_vec3f_soa_to_aos_neon.
+     *
+     * @param[out] dst   Pointer to the destination vector array
+     * @param[in]  src   Pointer to the source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vec3f_soa_to_aos) (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec3f_soa_to_aos using plain C code. */
+    extern ne10_result_t ne10_vec3f_soa_to_aos_c (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec3f_soa_to_aos using NEON intrinsics. */
+    extern ne10_result_t ne10_vec3f_soa_to_aos_neon (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count) asm ("ne10_vec3f_soa_to_aos_neon");
+
+    /**
+     * Splits an array of 4D vectors into separate component arrays. Points to
+     * @ref ne10_vec4f_aos_to_soa_c or @ref ne10_vec4f_aos_to_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination component arrays
+     * @param[in]  src   Pointer to the source vector array
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vec4f_aos_to_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec4f_aos_to_soa using plain C code. */
+    extern ne10_result_t ne10_vec4f_aos_to_soa_c (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec4f_aos_to_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_vec4f_aos_to_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count) asm ("ne10_vec4f_aos_to_soa_neon");
+
+    /**
+     * Interleaves separate component arrays into an array of 4D vectors. Points to
+     * @ref ne10_vec4f_soa_to_aos_c or @ref ne10_vec4f_soa_to_aos_neon.
+     *
+     * @param[out] dst   Pointer to the destination vector array
+     * @param[in]  src   Pointer to the source component arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vec4f_soa_to_aos) (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec4f_soa_to_aos using plain C code. */
+    extern ne10_result_t ne10_vec4f_soa_to_aos_c (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec4f_soa_to_aos using NEON intrinsics. */
+    extern ne10_result_t ne10_vec4f_soa_to_aos_neon (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count) asm ("ne10_vec4f_soa_to_aos_neon");
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup DET_MAT Matrix Determinant Calculation
+     *
+     * \par
+     * These functions implement matrix determinant operations for single precision floating point values.
+     * @{
+     */
+
+    /**
+     * Calculates the determinant of 4x4 matrices within an input array, storing the results
+     * in an output array. Points to @ref ne10_detmat_4x4f_c, @ref ne10_detmat_4x4f_neon, or
+     * @ref ne10_detmat_4x4f_asm.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of matrices to be processed
+     */
+    extern ne10_result_t (*ne10_detmat_4x4f) (ne10_float32_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_4x4f using plain C code. */
+    extern ne10_result_t ne10_detmat_4x4f_c (ne10_float32_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_4x4f using NEON intrinsics. */
+    extern ne10_result_t ne10_detmat_4x4f_neon (ne10_float32_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count) asm ("ne10_detmat_4x4f_neon");
+    /** Specific implementation of @ref ne10_detmat_4x4f using NEON assembly. */
+    extern ne10_result_t ne10_detmat_4x4f_asm (ne10_float32_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
+
+    /**
+     * Calculates the determinant of 3x3 matrices within an input array, storing the results
+     * in an output array. Points to @ref ne10_detmat_3x3f_c, @ref ne10_detmat_3x3f_neon, or
+     * @ref ne10_detmat_3x3f_asm.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of matrices to be processed
+     */
+    extern ne10_result_t (*ne10_detmat_3x3f) (ne10_float32_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_3x3f using plain C code. */
+    extern ne10_result_t ne10_detmat_3x3f_c (ne10_float32_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_3x3f using NEON intrinsics. */
+    extern ne10_result_t ne10_detmat_3x3f_neon (ne10_float32_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count) asm ("ne10_detmat_3x3f_neon");
+    /** Specific implementation of @ref ne10_detmat_3x3f using NEON assembly. */
+    extern ne10_result_t ne10_detmat_3x3f_asm (ne10_float32_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+
+    /**
+     * Calculates the determinant of 2x2 matrices within an input array, storing the results
+     * in an output array. Points to @ref ne10_detmat_2x2f_c, @ref ne10_detmat_2x2f_neon, or
+     * @ref ne10_detmat_2x2f_asm.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of matrices to be processed
+     */
+    extern ne10_result_t (*ne10_detmat_2x2f) (ne10_float32_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_2x2f using plain C code. */
+    extern ne10_result_t ne10_detmat_2x2f_c (ne10_float32_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_2x2f using NEON intrinsics. */
+    extern ne10_result_t ne10_detmat_2x2f_neon (ne10_float32_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count) asm ("ne10_detmat_2x2f_neon");
+    /** Specific implementation of @ref ne10_detmat_2x2f using NEON assembly. */
+    extern ne10_result_t ne10_detmat_2x2f_asm (ne10_float32_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count);
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup INV_MAT Matrix Inversion
+     *
+     * \par
+     * These functions implement matrix inversion operations for single precision floating point values.
+     * @{
+     */
+
+    /**
+     * Calculates the inverse of 4x4 matrices within an input array, storing the results
+     * in an output array. Points to @ref ne10_invmat_4x4f_c, @ref ne10_invmat_4x4f_neon, or
+     * @ref ne10_invmat_4x4f_asm.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of matrices to be processed
+     */
+    extern ne10_result_t (*ne10_invmat_4x4f) (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_4x4f using plain C code. */
+    extern ne10_result_t ne10_invmat_4x4f_c (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_4x4f using NEON intrinsics. */
+    extern ne10_result_t ne10_invmat_4x4f_neon (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count) asm ("ne10_invmat_4x4f_neon");
+    /** Specific implementation of @ref ne10_invmat_4x4f using NEON assembly. */
+    extern ne10_result_t ne10_invmat_4x4f_asm (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
+
+    /**
+     * Calculates the inverse of 3x3 matrices within an input array, storing the results
+     * in an output array. Points to @ref ne10_invmat_3x3f_c, @ref ne10_invmat_3x3f_neon, or
+     * @ref ne10_invmat_3x3f_asm.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of matrices to be processed
+     */
+    extern ne10_result_t (*ne10_invmat_3x3f) (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_3x3f using plain C code. */
+    extern ne10_result_t ne10_invmat_3x3f_c (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_3x3f using NEON intrinsics. */
+    extern ne10_result_t ne10_invmat_3x3f_neon (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count) asm ("ne10_invmat_3x3f_neon");
+    /** Specific implementation of @ref ne10_invmat_3x3f using NEON assembly. */
+    extern ne10_result_t ne10_invmat_3x3f_asm (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+
+    /**
+     * Calculates the inverse of 2x2 matrices within an input array, storing the results
+     * in an output array. Points to @ref ne10_invmat_2x2f_c, @ref ne10_invmat_2x2f_neon, or
      * @ref ne10_invmat_2x2f_asm.
      *
      * @param[out] dst   Pointer to the destination array
@@ -1839,6 +2675,1803 @@ extern "C" {
     extern ne10_result_t ne10_identity_mat2x2f_asm (ne10_mat2x2f_t * dst, ne10_uint32_t count);
     /** @} */
 
+    /**
+     * @ingroup groupMaths
+     * @defgroup MAT_X4 Batched Matrix Math (AoSoA)
+     *
+     * \par
+     * These functions work on small matrices stored in blocks of four, interleaved entry by entry
+     * (ne10_mat2x2f_x4_t, ne10_mat3x3f_x4_t and ne10_mat4x4f_x4_t), so that each NEON lane handles one
+     * matrix and every load or store is a whole register. count is the number of matrices; the
+     * multiplication, inversion and transposition process the last block in full, including any unused
+     * lanes, which ne10_mat4x4f_aos_to_x4 and friends set to the identity matrix. Results match the
+     * functions of the same name on packed matrices.
+     * @{
+     */
+
+    /**
+     * Interleaves an array of 4x4 matrices into blocks of four. The unused lanes of the last block are
+     * set to the identity matrix. Points to @ref ne10_mat4x4f_aos_to_x4_c or
+     * @ref ne10_mat4x4f_aos_to_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination blocks
+     * @param[in]  src   Pointer to the source matrices
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_mat4x4f_aos_to_x4) (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat4x4f_aos_to_x4 using plain C code. */
+    extern ne10_result_t ne10_mat4x4f_aos_to_x4_c (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat4x4f_aos_to_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_mat4x4f_aos_to_x4_neon (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count) asm ("ne10_mat4x4f_aos_to_x4_neon");
+
+    /**
+     * Splits blocks of four interleaved 4x4 matrices back into an array of matrices. Points to
+     * @ref ne10_mat4x4f_x4_to_aos_c or @ref ne10_mat4x4f_x4_to_aos_neon.
+     *
+     * @param[out] dst   Pointer to the destination matrices
+     * @param[in]  src   Pointer to the source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_mat4x4f_x4_to_aos) (ne10_mat4x4f_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat4x4f_x4_to_aos using plain C code. */
+    extern ne10_result_t ne10_mat4x4f_x4_to_aos_c (ne10_mat4x4f_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat4x4f_x4_to_aos using NEON intrinsics. */
+    extern ne10_result_t ne10_mat4x4f_x4_to_aos_neon (ne10_mat4x4f_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count) asm ("ne10_mat4x4f_x4_to_aos_neon");
+
+    /**
+     * Multiplies the interleaved 4x4 matrices of one set of blocks by those of the same index in
+     * another. Points to @ref ne10_mulmat_4x4f_x4_c or @ref ne10_mulmat_4x4f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination blocks
+     * @param[in]  src1  Pointer to the first source blocks
+     * @param[in]  src2  Pointer to the second source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_mulmat_4x4f_x4) (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src1, ne10_mat4x4f_x4_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_4x4f_x4 using plain C code. */
+    extern ne10_result_t ne10_mulmat_4x4f_x4_c (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src1, ne10_mat4x4f_x4_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_4x4f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_mulmat_4x4f_x4_neon (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src1, ne10_mat4x4f_x4_t * src2, ne10_uint32_t count) asm ("ne10_mulmat_4x4f_x4_neon");
+
+    /**
+     * Calculates the inverses of interleaved 4x4 matrices. Points to @ref ne10_invmat_4x4f_x4_c or
+     * @ref ne10_invmat_4x4f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination blocks
+     * @param[in]  src   Pointer to the source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_invmat_4x4f_x4) (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_4x4f_x4 using plain C code. */
+    extern ne10_result_t ne10_invmat_4x4f_x4_c (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_4x4f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_invmat_4x4f_x4_neon (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count) asm ("ne10_invmat_4x4f_x4_neon");
+
+    /**
+     * Calculates the determinants of interleaved 4x4 matrices. Points to @ref ne10_detmat_4x4f_x4_c or
+     * @ref ne10_detmat_4x4f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination array, one determinant per matrix
+     * @param[in]  src   Pointer to the source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_detmat_4x4f_x4) (ne10_float32_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_4x4f_x4 using plain C code. */
+    extern ne10_result_t ne10_detmat_4x4f_x4_c (ne10_float32_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_4x4f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_detmat_4x4f_x4_neon (ne10_float32_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count) asm ("ne10_detmat_4x4f_x4_neon");
+
+    /**
+     * Transposes interleaved 4x4 matrices. Points to @ref ne10_transmat_4x4f_x4_c or
+     * @ref ne10_transmat_4x4f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination blocks
+     * @param[in]  src   Pointer to the source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_transmat_4x4f_x4) (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_4x4f_x4 using plain C code. */
+    extern ne10_result_t ne10_transmat_4x4f_x4_c (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_4x4f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_transmat_4x4f_x4_neon (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count) asm ("ne10_transmat_4x4f_x4_neon");
+
+    /**
+     * Multiplies each 4D vector of an array by the interleaved 4x4 matrix of the same index. Points to
+     * @ref ne10_mulmatvec_4x4f_v4f_x4_c or @ref ne10_mulmatvec_4x4f_v4f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination vectors
+     * @param[in]  mat   Pointer to the source blocks
+     * @param[in]  src   Pointer to the source vectors
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_mulmatvec_4x4f_v4f_x4) (ne10_vec4f_t * dst, ne10_mat4x4f_x4_t * mat, ne10_vec4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmatvec_4x4f_v4f_x4 using plain C code. */
+    extern ne10_result_t ne10_mulmatvec_4x4f_v4f_x4_c (ne10_vec4f_t * dst, ne10_mat4x4f_x4_t * mat, ne10_vec4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmatvec_4x4f_v4f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_mulmatvec_4x4f_v4f_x4_neon (ne10_vec4f_t * dst, ne10_mat4x4f_x4_t * mat, ne10_vec4f_t * src, ne10_uint32_t count) asm ("ne10_mulmatvec_4x4f_v4f_x4_neon");
+
+    /**
+     * Interleaves an array of 3x3 matrices into blocks of four. The unused lanes of the last block are
+     * set to the identity matrix. Points to @ref ne10_mat3x3f_aos_to_x4_c or
+     * @ref ne10_mat3x3f_aos_to_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination blocks
+     * @param[in]  src   Pointer to the source matrices
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_mat3x3f_aos_to_x4) (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat3x3f_aos_to_x4 using plain C code. */
+    extern ne10_result_t ne10_mat3x3f_aos_to_x4_c (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat3x3f_aos_to_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_mat3x3f_aos_to_x4_neon (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count) asm ("ne10_mat3x3f_aos_to_x4_neon");
+
+    /**
+     * Splits blocks of four interleaved 3x3 matrices back into an array of matrices. Points to
+     * @ref ne10_mat3x3f_x4_to_aos_c or @ref ne10_mat3x3f_x4_to_aos_neon.
+     *
+     * @param[out] dst   Pointer to the destination matrices
+     * @param[in]  src   Pointer to the source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_mat3x3f_x4_to_aos) (ne10_mat3x3f_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat3x3f_x4_to_aos using plain C code. */
+    extern ne10_result_t ne10_mat3x3f_x4_to_aos_c (ne10_mat3x3f_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat3x3f_x4_to_aos using NEON intrinsics. */
+    extern ne10_result_t ne10_mat3x3f_x4_to_aos_neon (ne10_mat3x3f_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count) asm ("ne10_mat3x3f_x4_to_aos_neon");
+
+    /**
+     * Multiplies the interleaved 3x3 matrices of one set of blocks by those of the same index in
+     * another. Points to @ref ne10_mulmat_3x3f_x4_c or @ref ne10_mulmat_3x3f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination blocks
+     * @param[in]  src1  Pointer to the first source blocks
+     * @param[in]  src2  Pointer to the second source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_mulmat_3x3f_x4) (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src1, ne10_mat3x3f_x4_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_3x3f_x4 using plain C code. */
+    extern ne10_result_t ne10_mulmat_3x3f_x4_c (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src1, ne10_mat3x3f_x4_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_3x3f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_mulmat_3x3f_x4_neon (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src1, ne10_mat3x3f_x4_t * src2, ne10_uint32_t count) asm ("ne10_mulmat_3x3f_x4_neon");
+
+    /**
+     * Calculates the inverses of interleaved 3x3 matrices. Points to @ref ne10_invmat_3x3f_x4_c or
+     * @ref ne10_invmat_3x3f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination blocks
+     * @param[in]  src   Pointer to the source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_invmat_3x3f_x4) (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_3x3f_x4 using plain C code. */
+    extern ne10_result_t ne10_invmat_3x3f_x4_c (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_3x3f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_invmat_3x3f_x4_neon (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count) asm ("ne10_invmat_3x3f_x4_neon");
+
+    /**
+     * Calculates the determinants of interleaved 3x3 matrices. Points to @ref ne10_detmat_3x3f_x4_c or
+     * @ref ne10_detmat_3x3f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination array, one determinant per matrix
+     * @param[in]  src   Pointer to the source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_detmat_3x3f_x4) (ne10_float32_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_3x3f_x4 using plain C code. */
+    extern ne10_result_t ne10_detmat_3x3f_x4_c (ne10_float32_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_3x3f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_detmat_3x3f_x4_neon (ne10_float32_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count) asm ("ne10_detmat_3x3f_x4_neon");
+
+    /**
+     * Transposes interleaved 3x3 matrices. Points to @ref ne10_transmat_3x3f_x4_c or
+     * @ref ne10_transmat_3x3f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination blocks
+     * @param[in]  src   Pointer to the source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_transmat_3x3f_x4) (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_3x3f_x4 using plain C code. */
+    extern ne10_result_t ne10_transmat_3x3f_x4_c (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_3x3f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_transmat_3x3f_x4_neon (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count) asm ("ne10_transmat_3x3f_x4_neon");
+
+    /**
+     * Multiplies each 3D vector of an array by the interleaved 3x3 matrix of the same index. Points to
+     * @ref ne10_mulmatvec_3x3f_v3f_x4_c or @ref ne10_mulmatvec_3x3f_v3f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination vectors
+     * @param[in]  mat   Pointer to the source blocks
+     * @param[in]  src   Pointer to the source vectors
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_mulmatvec_3x3f_v3f_x4) (ne10_vec3f_t * dst, ne10_mat3x3f_x4_t * mat, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmatvec_3x3f_v3f_x4 using plain C code. */
+    extern ne10_result_t ne10_mulmatvec_3x3f_v3f_x4_c (ne10_vec3f_t * dst, ne10_mat3x3f_x4_t * mat, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmatvec_3x3f_v3f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_mulmatvec_3x3f_v3f_x4_neon (ne10_vec3f_t * dst, ne10_mat3x3f_x4_t * mat, ne10_vec3f_t * src, ne10_uint32_t count) asm ("ne10_mulmatvec_3x3f_v3f_x4_neon");
+
+    /**
+     * Interleaves an array of 2x2 matrices into blocks of four. The unused lanes of the last block are
+     * set to the identity matrix. Points to @ref ne10_mat2x2f_aos_to_x4_c or
+     * @ref ne10_mat2x2f_aos_to_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination blocks
+     * @param[in]  src   Pointer to the source matrices
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_mat2x2f_aos_to_x4) (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat2x2f_aos_to_x4 using plain C code. */
+    extern ne10_result_t ne10_mat2x2f_aos_to_x4_c (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat2x2f_aos_to_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_mat2x2f_aos_to_x4_neon (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count) asm ("ne10_mat2x2f_aos_to_x4_neon");
+
+    /**
+     * Splits blocks of four interleaved 2x2 matrices back into an array of matrices. Points to
+     * @ref ne10_mat2x2f_x4_to_aos_c or @ref ne10_mat2x2f_x4_to_aos_neon.
+     *
+     * @param[out] dst   Pointer to the destination matrices
+     * @param[in]  src   Pointer to the source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_mat2x2f_x4_to_aos) (ne10_mat2x2f_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat2x2f_x4_to_aos using plain C code. */
+    extern ne10_result_t ne10_mat2x2f_x4_to_aos_c (ne10_mat2x2f_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat2x2f_x4_to_aos using NEON intrinsics. */
+    extern ne10_result_t ne10_mat2x2f_x4_to_aos_neon (ne10_mat2x2f_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count) asm ("ne10_mat2x2f_x4_to_aos_neon");
+
+    /**
+     * Multiplies the interleaved 2x2 matrices of one set of blocks by those of the same index in
+     * another. Points to @ref ne10_mulmat_2x2f_x4_c or @ref ne10_mulmat_2x2f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination blocks
+     * @param[in]  src1  Pointer to the first source blocks
+     * @param[in]  src2  Pointer to the second source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_mulmat_2x2f_x4) (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src1, ne10_mat2x2f_x4_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_2x2f_x4 using plain C code. */
+    extern ne10_result_t ne10_mulmat_2x2f_x4_c (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src1, ne10_mat2x2f_x4_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_2x2f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_mulmat_2x2f_x4_neon (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src1, ne10_mat2x2f_x4_t * src2, ne10_uint32_t count) asm ("ne10_mulmat_2x2f_x4_neon");
+
+    /**
+     * Calculates the inverses of interleaved 2x2 matrices. Points to @ref ne10_invmat_2x2f_x4_c or
+     * @ref ne10_invmat_2x2f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination blocks
+     * @param[in]  src   Pointer to the source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_invmat_2x2f_x4) (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_2x2f_x4 using plain C code. */
+    extern ne10_result_t ne10_invmat_2x2f_x4_c (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_2x2f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_invmat_2x2f_x4_neon (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count) asm ("ne10_invmat_2x2f_x4_neon");
+
+    /**
+     * Calculates the determinants of interleaved 2x2 matrices. Points to @ref ne10_detmat_2x2f_x4_c or
+     * @ref ne10_detmat_2x2f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination array, one determinant per matrix
+     * @param[in]  src   Pointer to the source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_detmat_2x2f_x4) (ne10_float32_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_2x2f_x4 using plain C code. */
+    extern ne10_result_t ne10_detmat_2x2f_x4_c (ne10_float32_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_2x2f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_detmat_2x2f_x4_neon (ne10_float32_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count) asm ("ne10_detmat_2x2f_x4_neon");
+
+    /**
+     * Transposes interleaved 2x2 matrices. Points to @ref ne10_transmat_2x2f_x4_c or
+     * @ref ne10_transmat_2x2f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination blocks
+     * @param[in]  src   Pointer to the source blocks
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_transmat_2x2f_x4) (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_2x2f_x4 using plain C code. */
+    extern ne10_result_t ne10_transmat_2x2f_x4_c (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_2x2f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_transmat_2x2f_x4_neon (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count) asm ("ne10_transmat_2x2f_x4_neon");
+
+    /**
+     * Multiplies each 2D vector of an array by the interleaved 2x2 matrix of the same index. Points to
+     * @ref ne10_mulmatvec_2x2f_v2f_x4_c or @ref ne10_mulmatvec_2x2f_v2f_x4_neon.
+     *
+     * @param[out] dst   Pointer to the destination vectors
+     * @param[in]  mat   Pointer to the source blocks
+     * @param[in]  src   Pointer to the source vectors
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_mulmatvec_2x2f_v2f_x4) (ne10_vec2f_t * dst, ne10_mat2x2f_x4_t * mat, ne10_vec2f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmatvec_2x2f_v2f_x4 using plain C code. */
+    extern ne10_result_t ne10_mulmatvec_2x2f_v2f_x4_c (ne10_vec2f_t * dst, ne10_mat2x2f_x4_t * mat, ne10_vec2f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmatvec_2x2f_v2f_x4 using NEON intrinsics. */
+    extern ne10_result_t ne10_mulmatvec_2x2f_v2f_x4_neon (ne10_vec2f_t * dst, ne10_mat2x2f_x4_t * mat, ne10_vec2f_t * src, ne10_uint32_t count) asm ("ne10_mulmatvec_2x2f_v2f_x4_neon");
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup QUAT Quaternions and Rigid Transforms
+     *
+     * \par
+     * These functions work on quaternions (ne10_quatf_t, with the scalar part w last) and dual
+     * quaternions (ne10_dualquatf_t), either interleaved or, for the _soa variants, in the
+     * structure-of-arrays layout ne10_quatf_soa_t, which ne10_vec4f_aos_to_soa and
+     * ne10_vec4f_soa_to_aos convert. Except for ne10_slerp_quatf, the NEON versions give the same
+     * results as the C versions.
+     * @{
+     */
+
+    /**
+     * Multiplies the quaternions of one array by those of the same index in another (Hamilton product
+     * src1 * src2). Points to @ref ne10_mul_quatf_c or @ref ne10_mul_quatf_neon.
+     *
+     * @param[out] dst   Pointer to the destination quaternions
+     * @param[in]  src1  Pointer to the first source quaternions
+     * @param[in]  src2  Pointer to the second source quaternions
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_mul_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mul_quatf using plain C code. */
+    extern ne10_result_t ne10_mul_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mul_quatf using NEON intrinsics. */
+    extern ne10_result_t ne10_mul_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count) asm ("ne10_mul_quatf_neon");
+
+    /**
+     * Calculates the conjugates of an array of quaternions. Points to @ref ne10_conj_quatf_c or
+     * @ref ne10_conj_quatf_neon.
+     *
+     * @param[out] dst   Pointer to the destination quaternions
+     * @param[in]  src   Pointer to the source quaternions
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_conj_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_conj_quatf using plain C code. */
+    extern ne10_result_t ne10_conj_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_conj_quatf using NEON intrinsics. */
+    extern ne10_result_t ne10_conj_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count) asm ("ne10_conj_quatf_neon");
+
+    /**
+     * Scales an array of quaternions to unit length. Points to @ref ne10_normalize_quatf_c or
+     * @ref ne10_normalize_quatf_neon.
+     *
+     * @param[out] dst   Pointer to the destination quaternions
+     * @param[in]  src   Pointer to the source quaternions
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_normalize_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_quatf using plain C code. */
+    extern ne10_result_t ne10_normalize_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_quatf using NEON intrinsics. */
+    extern ne10_result_t ne10_normalize_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count) asm ("ne10_normalize_quatf_neon");
+
+    /**
+     * Rotates each 3D vector of an array by the unit quaternion of the same index (q v q*). Points to
+     * @ref ne10_rotate_quatf_vec3f_c or @ref ne10_rotate_quatf_vec3f_neon.
+     *
+     * @param[out] dst   Pointer to the destination vectors
+     * @param[in]  quat  Pointer to the unit rotation quaternions
+     * @param[in]  src   Pointer to the source vectors
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_rotate_quatf_vec3f) (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rotate_quatf_vec3f using plain C code. */
+    extern ne10_result_t ne10_rotate_quatf_vec3f_c (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rotate_quatf_vec3f using NEON intrinsics. */
+    extern ne10_result_t ne10_rotate_quatf_vec3f_neon (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count) asm ("ne10_rotate_quatf_vec3f_neon");
+
+    /**
+     * Interpolates linearly between pairs of unit quaternions along the shorter arc and normalizes the
+     * result. Points to @ref ne10_nlerp_quatf_c or @ref ne10_nlerp_quatf_neon.
+     *
+     * @param[out] dst   Pointer to the destination quaternions
+     * @param[in]  src1  Pointer to the first source quaternions
+     * @param[in]  src2  Pointer to the second source quaternions
+     * @param[in]  t     The interpolation parameter, 0 giving src1 and 1 giving src2
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_nlerp_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_nlerp_quatf using plain C code. */
+    extern ne10_result_t ne10_nlerp_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_nlerp_quatf using NEON intrinsics. */
+    extern ne10_result_t ne10_nlerp_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t t, ne10_uint32_t count) asm ("ne10_nlerp_quatf_neon");
+
+    /**
+     * Interpolates spherically between pairs of unit quaternions along the shorter arc. Nearly
+     * parallel pairs fall back to normalized linear interpolation. The NEON version uses polynomial
+     * acos and sin, with an error of a few units in the last place. Points to @ref ne10_slerp_quatf_c
+     * or @ref ne10_slerp_quatf_neon.
+     *
+     * @param[out] dst   Pointer to the destination quaternions
+     * @param[in]  src1  Pointer to the first source quaternions
+     * @param[in]  src2  Pointer to the second source quaternions
+     * @param[in]  t     The interpolation parameter, 0 giving src1 and 1 giving src2
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_slerp_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_slerp_quatf using plain C code. */
+    extern ne10_result_t ne10_slerp_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_slerp_quatf using NEON intrinsics. */
+    extern ne10_result_t ne10_slerp_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t t, ne10_uint32_t count) asm ("ne10_slerp_quatf_neon");
+
+    /**
+     * Converts an array of unit quaternions to rotation matrices. Points to
+     * @ref ne10_quatf_to_mat3x3f_c or @ref ne10_quatf_to_mat3x3f_neon.
+     *
+     * @param[out] dst   Pointer to the destination matrices
+     * @param[in]  src   Pointer to the source quaternions
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_quatf_to_mat3x3f) (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_quatf_to_mat3x3f using plain C code. */
+    extern ne10_result_t ne10_quatf_to_mat3x3f_c (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_quatf_to_mat3x3f using NEON intrinsics. */
+    extern ne10_result_t ne10_quatf_to_mat3x3f_neon (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count) asm ("ne10_quatf_to_mat3x3f_neon");
+
+    /**
+     * Converts an array of rotation matrices to unit quaternions (Shepperd's method). Points to
+     * @ref ne10_mat3x3f_to_quatf_c or @ref ne10_mat3x3f_to_quatf_neon.
+     *
+     * @param[out] dst   Pointer to the destination quaternions
+     * @param[in]  src   Pointer to the source rotation matrices
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_mat3x3f_to_quatf) (ne10_quatf_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat3x3f_to_quatf using plain C code. */
+    extern ne10_result_t ne10_mat3x3f_to_quatf_c (ne10_quatf_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mat3x3f_to_quatf using NEON intrinsics. */
+    extern ne10_result_t ne10_mat3x3f_to_quatf_neon (ne10_quatf_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count) asm ("ne10_mat3x3f_to_quatf_neon");
+
+    /**
+     * Multiplies the dual quaternions of one array by those of the same index in another, composing
+     * the rigid transforms (src2 first, then src1). Points to @ref ne10_mul_dualquatf_c or
+     * @ref ne10_mul_dualquatf_neon.
+     *
+     * @param[out] dst   Pointer to the destination dual quaternions
+     * @param[in]  src1  Pointer to the first source dual quaternions
+     * @param[in]  src2  Pointer to the second source dual quaternions
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_mul_dualquatf) (ne10_dualquatf_t * dst, ne10_dualquatf_t * src1, ne10_dualquatf_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mul_dualquatf using plain C code. */
+    extern ne10_result_t ne10_mul_dualquatf_c (ne10_dualquatf_t * dst, ne10_dualquatf_t * src1, ne10_dualquatf_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mul_dualquatf using NEON intrinsics. */
+    extern ne10_result_t ne10_mul_dualquatf_neon (ne10_dualquatf_t * dst, ne10_dualquatf_t * src1, ne10_dualquatf_t * src2, ne10_uint32_t count) asm ("ne10_mul_dualquatf_neon");
+
+    /**
+     * Applies the rigid transform of each unit dual quaternion of an array to the 3D point of the same
+     * index. Points to @ref ne10_transform_dualquatf_vec3f_c or
+     * @ref ne10_transform_dualquatf_vec3f_neon.
+     *
+     * @param[out] dst   Pointer to the destination points
+     * @param[in]  dq    Pointer to the unit dual quaternions
+     * @param[in]  src   Pointer to the source points
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_transform_dualquatf_vec3f) (ne10_vec3f_t * dst, ne10_dualquatf_t * dq, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transform_dualquatf_vec3f using plain C code. */
+    extern ne10_result_t ne10_transform_dualquatf_vec3f_c (ne10_vec3f_t * dst, ne10_dualquatf_t * dq, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transform_dualquatf_vec3f using NEON intrinsics. */
+    extern ne10_result_t ne10_transform_dualquatf_vec3f_neon (ne10_vec3f_t * dst, ne10_dualquatf_t * dq, ne10_vec3f_t * src, ne10_uint32_t count) asm ("ne10_transform_dualquatf_vec3f_neon");
+
+    /**
+     * Multiplies the quaternions of one array by those of the same index in another (Hamilton product
+     * src1 * src2). The quaternions are in structure-of-arrays layout. Points to
+     * @ref ne10_mul_quatf_soa_c or @ref ne10_mul_quatf_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination quaternions
+     * @param[in]  src1  Pointer to the first source quaternions
+     * @param[in]  src2  Pointer to the second source quaternions
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_mul_quatf_soa) (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mul_quatf_soa using plain C code. */
+    extern ne10_result_t ne10_mul_quatf_soa_c (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mul_quatf_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_mul_quatf_soa_neon (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_uint32_t count) asm ("ne10_mul_quatf_soa_neon");
+
+    /**
+     * Calculates the conjugates of an array of quaternions. The quaternions are in structure-of-arrays
+     * layout. Points to @ref ne10_conj_quatf_soa_c or @ref ne10_conj_quatf_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination quaternions
+     * @param[in]  src   Pointer to the source quaternions
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_conj_quatf_soa) (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_conj_quatf_soa using plain C code. */
+    extern ne10_result_t ne10_conj_quatf_soa_c (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_conj_quatf_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_conj_quatf_soa_neon (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src, ne10_uint32_t count) asm ("ne10_conj_quatf_soa_neon");
+
+    /**
+     * Scales an array of quaternions to unit length. The quaternions are in structure-of-arrays
+     * layout. Points to @ref ne10_normalize_quatf_soa_c or @ref ne10_normalize_quatf_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination quaternions
+     * @param[in]  src   Pointer to the source quaternions
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_normalize_quatf_soa) (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_quatf_soa using plain C code. */
+    extern ne10_result_t ne10_normalize_quatf_soa_c (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_quatf_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_normalize_quatf_soa_neon (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src, ne10_uint32_t count) asm ("ne10_normalize_quatf_soa_neon");
+
+    /**
+     * Rotates each 3D vector of an array by the unit quaternion of the same index (q v q*). The
+     * quaternions are in structure-of-arrays layout. Points to @ref ne10_rotate_quatf_vec3f_soa_c or
+     * @ref ne10_rotate_quatf_vec3f_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination vectors
+     * @param[in]  quat  Pointer to the unit rotation quaternions
+     * @param[in]  src   Pointer to the source vectors
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_rotate_quatf_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_quatf_soa_t * quat, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rotate_quatf_vec3f_soa using plain C code. */
+    extern ne10_result_t ne10_rotate_quatf_vec3f_soa_c (ne10_vec3f_soa_t * dst, ne10_quatf_soa_t * quat, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rotate_quatf_vec3f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_rotate_quatf_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_quatf_soa_t * quat, ne10_vec3f_soa_t * src, ne10_uint32_t count) asm ("ne10_rotate_quatf_vec3f_soa_neon");
+
+    /**
+     * Interpolates linearly between pairs of unit quaternions along the shorter arc and normalizes the
+     * result. The quaternions are in structure-of-arrays layout. Points to @ref ne10_nlerp_quatf_soa_c
+     * or @ref ne10_nlerp_quatf_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination quaternions
+     * @param[in]  src1  Pointer to the first source quaternions
+     * @param[in]  src2  Pointer to the second source quaternions
+     * @param[in]  t     The interpolation parameter, 0 giving src1 and 1 giving src2
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_nlerp_quatf_soa) (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_float32_t t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_nlerp_quatf_soa using plain C code. */
+    extern ne10_result_t ne10_nlerp_quatf_soa_c (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_float32_t t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_nlerp_quatf_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_nlerp_quatf_soa_neon (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_float32_t t, ne10_uint32_t count) asm ("ne10_nlerp_quatf_soa_neon");
+
+    /**
+     * Interpolates spherically between pairs of unit quaternions along the shorter arc. Nearly
+     * parallel pairs fall back to normalized linear interpolation. The NEON version uses polynomial
+     * acos and sin, with an error of a few units in the last place. The quaternions are in
+     * structure-of-arrays layout. Points to @ref ne10_slerp_quatf_soa_c or @ref ne10_slerp_quatf_soa_neon.
+     *
+     * @param[out] dst   Pointer to the destination quaternions
+     * @param[in]  src1  Pointer to the first source quaternions
+     * @param[in]  src2  Pointer to the second source quaternions
+     * @param[in]  t     The interpolation parameter, 0 giving src1 and 1 giving src2
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_slerp_quatf_soa) (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_float32_t t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_slerp_quatf_soa using plain C code. */
+    extern ne10_result_t ne10_slerp_quatf_soa_c (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_float32_t t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_slerp_quatf_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_slerp_quatf_soa_neon (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_float32_t t, ne10_uint32_t count) asm ("ne10_slerp_quatf_soa_neon");
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup DECOMP Matrix Decompositions
+     *
+     * \par
+     * These functions factorize batches of small matrices and solve the matching linear systems, as a
+     * numerically safer alternative to inverting with ne10_invmat. The n x n matrices are stored
+     * column-major, one after the other, and the functions return NE10_ERR for an n outside 2 to
+     * NE10_DECOMP_MAX_N. The NEON versions work on four matrices at a time, one per lane, and follow
+     * the same steps as the C versions.
+     * @{
+     */
+
+    /**
+     * Calculates the Cholesky factors L (A = L L^T) of a batch of symmetric positive definite
+     * matrices. The upper triangle of each result is set to zero. A matrix whose pivot is not positive
+     * gets a non-zero status, the rest of the batch is still factorized, and the function returns
+     * NE10_ERR. dst may equal src. Points to @ref ne10_cholesky_f32_c or @ref ne10_cholesky_f32_neon.
+     *
+     * @param[out] dst    Pointer to the destination factors
+     * @param[out] status Pointer to one status per matrix: 0, or 1 + the index of the first failing pivot
+     * @param[in]  src    Pointer to the source matrices
+     * @param[in]  n      The order of the matrices, from 2 to NE10_DECOMP_MAX_N
+     * @param[in]  count  The number of matrices in the batch
+     */
+    extern ne10_result_t (*ne10_cholesky_f32) (ne10_float32_t * dst, ne10_int32_t * status, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cholesky_f32 using plain C code. */
+    extern ne10_result_t ne10_cholesky_f32_c (ne10_float32_t * dst, ne10_int32_t * status, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cholesky_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cholesky_f32_neon (ne10_float32_t * dst, ne10_int32_t * status, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count) asm ("ne10_cholesky_f32_neon");
+
+    /**
+     * Solves A x = b for a batch of systems, given the Cholesky factors of the matrices from
+     * @ref ne10_cholesky_f32. dst may equal src. Points to @ref ne10_cholesky_solve_f32_c or
+     * @ref ne10_cholesky_solve_f32_neon.
+     *
+     * @param[out] dst   Pointer to the solutions, n floats per system
+     * @param[in]  chol  Pointer to the Cholesky factors
+     * @param[in]  src   Pointer to the right-hand sides, n floats per system
+     * @param[in]  n     The order of the matrices, from 2 to NE10_DECOMP_MAX_N
+     * @param[in]  count The number of matrices in the batch
+     */
+    extern ne10_result_t (*ne10_cholesky_solve_f32) (ne10_float32_t * dst, ne10_float32_t * chol, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cholesky_solve_f32 using plain C code. */
+    extern ne10_result_t ne10_cholesky_solve_f32_c (ne10_float32_t * dst, ne10_float32_t * chol, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cholesky_solve_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cholesky_solve_f32_neon (ne10_float32_t * dst, ne10_float32_t * chol, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count) asm ("ne10_cholesky_solve_f32_neon");
+
+    /**
+     * Calculates the LU factorization with partial pivoting (P A = L U) of a batch of matrices. Each
+     * result holds U on and above the diagonal and the multipliers of the unit lower triangular L
+     * below it. A singular matrix, one with a pivot of at most NE10_LU_PIVOT_EPS times its largest
+     * magnitude, gets a non-zero status, the rest of the batch is still factorized, and the function
+     * returns NE10_ERR. dst may equal src. Points to @ref ne10_lu_f32_c or
+     * @ref ne10_lu_f32_neon.
+     *
+     * @param[out] dst    Pointer to the destination factors
+     * @param[out] piv    Pointer to the row interchanges, n per matrix: row k was swapped with row piv[k]
+     * @param[out] status Pointer to one status per matrix: 0, or 1 + the index of the first failing pivot
+     * @param[in]  src    Pointer to the source matrices
+     * @param[in]  n      The order of the matrices, from 2 to NE10_DECOMP_MAX_N
+     * @param[in]  count  The number of matrices in the batch
+     */
+    extern ne10_result_t (*ne10_lu_f32) (ne10_float32_t * dst, ne10_uint8_t * piv, ne10_int32_t * status, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_lu_f32 using plain C code. */
+    extern ne10_result_t ne10_lu_f32_c (ne10_float32_t * dst, ne10_uint8_t * piv, ne10_int32_t * status, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_lu_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_lu_f32_neon (ne10_float32_t * dst, ne10_uint8_t * piv, ne10_int32_t * status, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count) asm ("ne10_lu_f32_neon");
+
+    /**
+     * Solves A x = b for a batch of systems, given the LU factorizations of the matrices from
+     * @ref ne10_lu_f32. dst may equal src. Points to @ref ne10_lu_solve_f32_c or
+     * @ref ne10_lu_solve_f32_neon.
+     *
+     * @param[out] dst   Pointer to the solutions, n floats per system
+     * @param[in]  lu    Pointer to the LU factors
+     * @param[in]  piv   Pointer to the row interchanges
+     * @param[in]  src   Pointer to the right-hand sides, n floats per system
+     * @param[in]  n     The order of the matrices, from 2 to NE10_DECOMP_MAX_N
+     * @param[in]  count The number of matrices in the batch
+     */
+    extern ne10_result_t (*ne10_lu_solve_f32) (ne10_float32_t * dst, ne10_float32_t * lu, ne10_uint8_t * piv, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_lu_solve_f32 using plain C code. */
+    extern ne10_result_t ne10_lu_solve_f32_c (ne10_float32_t * dst, ne10_float32_t * lu, ne10_uint8_t * piv, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_lu_solve_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_lu_solve_f32_neon (ne10_float32_t * dst, ne10_float32_t * lu, ne10_uint8_t * piv, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count) asm ("ne10_lu_solve_f32_neon");
+
+    /**
+     * Calculates the QR factorization (A = Q R, Q orthogonal, R upper triangular) of a batch of
+     * matrices with Householder reflections. r may equal src. Points to @ref ne10_qr_f32_c or
+     * @ref ne10_qr_f32_neon.
+     *
+     * @param[out] q     Pointer to the destination orthogonal factors
+     * @param[out] r     Pointer to the destination upper triangular factors
+     * @param[in]  src   Pointer to the source matrices
+     * @param[in]  n     The order of the matrices, from 2 to NE10_DECOMP_MAX_N
+     * @param[in]  count The number of matrices in the batch
+     */
+    extern ne10_result_t (*ne10_qr_f32) (ne10_float32_t * q, ne10_float32_t * r, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_qr_f32 using plain C code. */
+    extern ne10_result_t ne10_qr_f32_c (ne10_float32_t * q, ne10_float32_t * r, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_qr_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_qr_f32_neon (ne10_float32_t * q, ne10_float32_t * r, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count) asm ("ne10_qr_f32_neon");
+
+    /**
+     * Calculates the singular value decomposition (A = U diag(s) V^T) of an array of 3x3 matrices with
+     * NE10_SVD_SWEEPS one-sided Jacobi sweeps. The singular values are non-negative and in decreasing
+     * order, and U and V are orthogonal. Points to @ref ne10_svd_3x3f_c or @ref ne10_svd_3x3f_neon.
+     *
+     * @param[out] u     Pointer to the destination left singular vectors
+     * @param[out] s     Pointer to the destination singular values
+     * @param[out] v     Pointer to the destination right singular vectors
+     * @param[in]  src   Pointer to the source matrices
+     * @param[in]  count The number of matrices in the input array
+     */
+    extern ne10_result_t (*ne10_svd_3x3f) (ne10_mat3x3f_t * u, ne10_vec3f_t * s, ne10_mat3x3f_t * v, ne10_mat3x3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_svd_3x3f using plain C code. */
+    extern ne10_result_t ne10_svd_3x3f_c (ne10_mat3x3f_t * u, ne10_vec3f_t * s, ne10_mat3x3f_t * v, ne10_mat3x3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_svd_3x3f using NEON intrinsics. */
+    extern ne10_result_t ne10_svd_3x3f_neon (ne10_mat3x3f_t * u, ne10_vec3f_t * s, ne10_mat3x3f_t * v, ne10_mat3x3f_t * src, ne10_uint32_t count) asm ("ne10_svd_3x3f_neon");
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup CPX_VEC Complex Vector Arithmetic
+     *
+     * \par
+     * These functions implement element-wise operations on arrays of complex values, as produced
+     * by the FFT functions, in single precision floating point, Q31 and Q15 formats.
+     * @{
+     */
+
+    /**
+     * Multiplies the complex values of one input array with those of the same index in another,
+     * storing the results in an output array. This operation can be performed in-place. Points to
+     * @ref ne10_cpx_mul_float_c or @ref ne10_cpx_mul_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_mul_float) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mul_float using plain C code. */
+    extern ne10_result_t ne10_cpx_mul_float_c (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mul_float using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_mul_float_neon (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count) asm ("ne10_cpx_mul_float_neon");
+
+    /**
+     * Multiplies the complex values of one input array with the complex conjugates of those of the
+     * same index in another (src1 * conj(src2)), storing the results in an output array. This
+     * operation can be performed in-place. Points to
+     * @ref ne10_cpx_conj_mul_float_c or @ref ne10_cpx_conj_mul_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the source array to be conjugated
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_conj_mul_float) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_conj_mul_float using plain C code. */
+    extern ne10_result_t ne10_cpx_conj_mul_float_c (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_conj_mul_float using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_conj_mul_float_neon (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count) asm ("ne10_cpx_conj_mul_float_neon");
+
+    /**
+     * Multiplies the complex values of two input arrays and adds the products to the values of an
+     * accumulator array (dst = acc + src1 * src2). Passing the same pointer as dst and acc
+     * accumulates in-place, e.g. over the partitions of a partitioned convolution. Points to
+     * @ref ne10_cpx_mul_acc_float_c or @ref ne10_cpx_mul_acc_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  acc   Pointer to the accumulator array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_mul_acc_float) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mul_acc_float using plain C code. */
+    extern ne10_result_t ne10_cpx_mul_acc_float_c (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mul_acc_float using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_mul_acc_float_neon (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count) asm ("ne10_cpx_mul_acc_float_neon");
+
+    /**
+     * Calculates the magnitude |z| of the complex values in an input array, storing the results in
+     * an output array. Points to
+     * @ref ne10_cpx_mag_float_c or @ref ne10_cpx_mag_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_mag_float) (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mag_float using plain C code. */
+    extern ne10_result_t ne10_cpx_mag_float_c (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mag_float using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_mag_float_neon (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count) asm ("ne10_cpx_mag_float_neon");
+
+    /**
+     * Calculates the squared magnitude |z|^2 of the complex values in an input array, storing the
+     * results in an output array. Points to
+     * @ref ne10_cpx_mag_sqr_float_c or @ref ne10_cpx_mag_sqr_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_mag_sqr_float) (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mag_sqr_float using plain C code. */
+    extern ne10_result_t ne10_cpx_mag_sqr_float_c (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mag_sqr_float using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_mag_sqr_float_neon (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count) asm ("ne10_cpx_mag_sqr_float_neon");
+
+    /**
+     * Calculates the phase atan2(z.i, z.r) of the complex values in an input array, storing the
+     * results in radians in an output array. The NEON version uses a polynomial approximation
+     * with an absolute error of at most 1e-5 radians. Points to
+     * @ref ne10_cpx_phase_float_c or @ref ne10_cpx_phase_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_phase_float) (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_phase_float using plain C code. */
+    extern ne10_result_t ne10_cpx_phase_float_c (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_phase_float using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_phase_float_neon (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count) asm ("ne10_cpx_phase_float_neon");
+
+    /**
+     * Converts the complex values in an input array to polar form, storing the magnitudes and the
+     * phases (in radians) in two output arrays. The phases are computed as in @ref ne10_cpx_phase_float. Points to
+     * @ref ne10_cpx_to_polar_float_c or @ref ne10_cpx_to_polar_float_neon.
+     *
+     * @param[out] mag   Pointer to the destination magnitude array
+     * @param[out] phase Pointer to the destination phase array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_to_polar_float) (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_to_polar_float using plain C code. */
+    extern ne10_result_t ne10_cpx_to_polar_float_c (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_to_polar_float using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_to_polar_float_neon (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count) asm ("ne10_cpx_to_polar_float_neon");
+
+    /**
+     * Converts magnitude and phase (in radians) arrays to complex values, storing the results in an
+     * output array. Points to
+     * @ref ne10_cpx_from_polar_float_c or @ref ne10_cpx_from_polar_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  mag   Pointer to the source magnitude array
+     * @param[in]  phase Pointer to the source phase array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_from_polar_float) (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_from_polar_float using plain C code. */
+    extern ne10_result_t ne10_cpx_from_polar_float_c (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_from_polar_float using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_from_polar_float_neon (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count) asm ("ne10_cpx_from_polar_float_neon");
+
+    /**
+     * Multiplies the complex values of one input array with those of the same index in another,
+     * storing the results in an output array. The Q31 products are rounded and saturated. This operation can be performed in-place. Points to
+     * @ref ne10_cpx_mul_int32_c or @ref ne10_cpx_mul_int32_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_mul_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mul_int32 using plain C code. */
+    extern ne10_result_t ne10_cpx_mul_int32_c (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mul_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_mul_int32_neon (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count) asm ("ne10_cpx_mul_int32_neon");
+
+    /**
+     * Multiplies the complex values of one input array with the complex conjugates of those of the
+     * same index in another (src1 * conj(src2)), storing the results in an output array. The Q31 products are rounded and saturated. This
+     * operation can be performed in-place. Points to
+     * @ref ne10_cpx_conj_mul_int32_c or @ref ne10_cpx_conj_mul_int32_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the source array to be conjugated
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_conj_mul_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_conj_mul_int32 using plain C code. */
+    extern ne10_result_t ne10_cpx_conj_mul_int32_c (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_conj_mul_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_conj_mul_int32_neon (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count) asm ("ne10_cpx_conj_mul_int32_neon");
+
+    /**
+     * Multiplies the complex values of two input arrays and adds the products to the values of an
+     * accumulator array (dst = acc + src1 * src2). The Q31 products are rounded, and the sums saturated. Passing the same pointer as dst and acc
+     * accumulates in-place, e.g. over the partitions of a partitioned convolution. Points to
+     * @ref ne10_cpx_mul_acc_int32_c or @ref ne10_cpx_mul_acc_int32_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  acc   Pointer to the accumulator array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_mul_acc_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * acc, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mul_acc_int32 using plain C code. */
+    extern ne10_result_t ne10_cpx_mul_acc_int32_c (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * acc, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mul_acc_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_mul_acc_int32_neon (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * acc, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count) asm ("ne10_cpx_mul_acc_int32_neon");
+
+    /**
+     * Calculates the magnitude |z| of the complex values in an input array, storing the results in
+     * an output array. The results are in Q31 and saturate at full scale. Points to
+     * @ref ne10_cpx_mag_int32_c or @ref ne10_cpx_mag_int32_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_mag_int32) (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mag_int32 using plain C code. */
+    extern ne10_result_t ne10_cpx_mag_int32_c (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mag_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_mag_int32_neon (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count) asm ("ne10_cpx_mag_int32_neon");
+
+    /**
+     * Calculates the squared magnitude |z|^2 of the complex values in an input array, storing the
+     * results in an output array. The results are rounded to Q31 and saturate at full scale. Points to
+     * @ref ne10_cpx_mag_sqr_int32_c or @ref ne10_cpx_mag_sqr_int32_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_mag_sqr_int32) (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mag_sqr_int32 using plain C code. */
+    extern ne10_result_t ne10_cpx_mag_sqr_int32_c (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mag_sqr_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_mag_sqr_int32_neon (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count) asm ("ne10_cpx_mag_sqr_int32_neon");
+
+    /**
+     * Multiplies the complex values of one input array with those of the same index in another,
+     * storing the results in an output array. The Q15 products are rounded and saturated. This operation can be performed in-place. Points to
+     * @ref ne10_cpx_mul_int16_c or @ref ne10_cpx_mul_int16_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_mul_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mul_int16 using plain C code. */
+    extern ne10_result_t ne10_cpx_mul_int16_c (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mul_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_mul_int16_neon (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count) asm ("ne10_cpx_mul_int16_neon");
+
+    /**
+     * Multiplies the complex values of one input array with the complex conjugates of those of the
+     * same index in another (src1 * conj(src2)), storing the results in an output array. The Q15 products are rounded and saturated. This
+     * operation can be performed in-place. Points to
+     * @ref ne10_cpx_conj_mul_int16_c or @ref ne10_cpx_conj_mul_int16_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the source array to be conjugated
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_conj_mul_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_conj_mul_int16 using plain C code. */
+    extern ne10_result_t ne10_cpx_conj_mul_int16_c (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_conj_mul_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_conj_mul_int16_neon (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count) asm ("ne10_cpx_conj_mul_int16_neon");
+
+    /**
+     * Multiplies the complex values of two input arrays and adds the products to the values of an
+     * accumulator array (dst = acc + src1 * src2). The Q15 products are rounded, and the sums saturated. Passing the same pointer as dst and acc
+     * accumulates in-place, e.g. over the partitions of a partitioned convolution. Points to
+     * @ref ne10_cpx_mul_acc_int16_c or @ref ne10_cpx_mul_acc_int16_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  acc   Pointer to the accumulator array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_mul_acc_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * acc, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mul_acc_int16 using plain C code. */
+    extern ne10_result_t ne10_cpx_mul_acc_int16_c (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * acc, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mul_acc_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_mul_acc_int16_neon (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * acc, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count) asm ("ne10_cpx_mul_acc_int16_neon");
+
+    /**
+     * Calculates the magnitude |z| of the complex values in an input array, storing the results in
+     * an output array. The results are in Q15 and saturate at full scale. Points to
+     * @ref ne10_cpx_mag_int16_c or @ref ne10_cpx_mag_int16_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_mag_int16) (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mag_int16 using plain C code. */
+    extern ne10_result_t ne10_cpx_mag_int16_c (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mag_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_mag_int16_neon (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count) asm ("ne10_cpx_mag_int16_neon");
+
+    /**
+     * Calculates the squared magnitude |z|^2 of the complex values in an input array, storing the
+     * results in an output array. The results are rounded to Q15 and saturate at full scale. Points to
+     * @ref ne10_cpx_mag_sqr_int16_c or @ref ne10_cpx_mag_sqr_int16_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of complex values to be processed
+     */
+    extern ne10_result_t (*ne10_cpx_mag_sqr_int16) (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mag_sqr_int16 using plain C code. */
+    extern ne10_result_t ne10_cpx_mag_sqr_int16_c (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpx_mag_sqr_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_cpx_mag_sqr_int16_neon (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count) asm ("ne10_cpx_mag_sqr_int16_neon");
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup TRANSCENDENTAL Transcendental Functions
+     *
+     * \par
+     * These functions evaluate elementary functions on arrays of single precision values. The C
+     * versions call the C library; the NEON versions use range reduction and minimax polynomials
+     * and process four elements per step. The error bounds below are those of the NEON versions
+     * against the correctly rounded result. Functions with a _fast suffix trade accuracy for speed
+     * in the NEON version only.
+     * @{
+     */
+
+    /**
+     * Computes e raised to the power of each element of the input array. Results overflow to infinity
+     * above 88.72 and underflow to zero below -103.97. The NEON version is accurate to 2 ULP. Points to
+     * @ref ne10_exp_float_c or @ref ne10_exp_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_exp_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_exp_float using plain C code. */
+    extern ne10_result_t ne10_exp_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_exp_float using NEON intrinsics. */
+    extern ne10_result_t ne10_exp_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_exp_float_neon");
+
+    /**
+     * Computes e raised to the power of each element of the input array with a shorter polynomial than
+     * @ref ne10_exp_float. The NEON version has a relative error below 1e-5 (about 128 ULP). Points to
+     * @ref ne10_exp_fast_float_c or @ref ne10_exp_fast_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_exp_fast_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_exp_fast_float using plain C code. */
+    extern ne10_result_t ne10_exp_fast_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_exp_fast_float using NEON intrinsics. */
+    extern ne10_result_t ne10_exp_fast_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_exp_fast_float_neon");
+
+    /**
+     * Computes the natural logarithm of each element of the input array. Zero gives -infinity and
+     * negative elements give NaN. The NEON version is accurate to 1 ULP. Points to
+     * @ref ne10_log_float_c or @ref ne10_log_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_log_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_log_float using plain C code. */
+    extern ne10_result_t ne10_log_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_log_float using NEON intrinsics. */
+    extern ne10_result_t ne10_log_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_log_float_neon");
+
+    /**
+     * Computes the natural logarithm of each element of the input array with a shorter polynomial than
+     * @ref ne10_log_float. The NEON version has an absolute error below 4e-5. Points to
+     * @ref ne10_log_fast_float_c or @ref ne10_log_fast_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_log_fast_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_log_fast_float using plain C code. */
+    extern ne10_result_t ne10_log_fast_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_log_fast_float using NEON intrinsics. */
+    extern ne10_result_t ne10_log_fast_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_log_fast_float_neon");
+
+    /**
+     * Raises each element of the first input array to the power of the element of the same index in
+     * the second. A negative base gives a negative result for odd integer exponents and NaN for non-
+     * integer exponents; a zero exponent gives 1. The NEON version computes exp(y * log|x|), so its
+     * relative error grows with |y * ln|x||: it is about (1 + |y * ln|x||) * 2^-23, below 2.1e-6 for
+     * |y * ln|x|| <= 28. Points to @ref ne10_pow_float_c or @ref ne10_pow_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the array of bases
+     * @param[in]  src2  Pointer to the array of exponents
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_pow_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_pow_float using plain C code. */
+    extern ne10_result_t ne10_pow_float_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_pow_float using NEON intrinsics. */
+    extern ne10_result_t ne10_pow_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) asm ("ne10_pow_float_neon");
+
+    /**
+     * Computes the sine of each element (in radians) of the input array. The NEON version is accurate
+     * to 2 ULP on [-pi, pi] and to an absolute error of 1e-7 for |x| <= 8192; larger inputs lose the
+     * range reduction and should be reduced by the caller. Points to @ref ne10_sin_float_c or
+     * @ref ne10_sin_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_sin_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sin_float using plain C code. */
+    extern ne10_result_t ne10_sin_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sin_float using NEON intrinsics. */
+    extern ne10_result_t ne10_sin_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_sin_float_neon");
+
+    /**
+     * Computes the cosine of each element (in radians) of the input array, with the same accuracy and
+     * range as @ref ne10_sin_float. Points to @ref ne10_cos_float_c or @ref ne10_cos_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_cos_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cos_float using plain C code. */
+    extern ne10_result_t ne10_cos_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cos_float using NEON intrinsics. */
+    extern ne10_result_t ne10_cos_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_cos_float_neon");
+
+    /**
+     * Computes the sine and cosine of each element (in radians) of the input array in a single pass,
+     * with the same accuracy and range as @ref ne10_sin_float. Points to @ref ne10_sincos_float_c or
+     * @ref ne10_sincos_float_neon.
+     *
+     * @param[out] dst_sin Pointer to the destination array of sines
+     * @param[out] dst_cos Pointer to the destination array of cosines
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_sincos_float) (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sincos_float using plain C code. */
+    extern ne10_result_t ne10_sincos_float_c (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sincos_float using NEON intrinsics. */
+    extern ne10_result_t ne10_sincos_float_neon (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_sincos_float_neon");
+
+    /**
+     * Computes the hyperbolic tangent of each element of the input array. The NEON version is accurate
+     * to 2 ULP. Points to @ref ne10_tanh_float_c or @ref ne10_tanh_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_tanh_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_tanh_float using plain C code. */
+    extern ne10_result_t ne10_tanh_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_tanh_float using NEON intrinsics. */
+    extern ne10_result_t ne10_tanh_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_tanh_float_neon");
+
+    /**
+     * Computes the square root of each element of the input array. Negative elements give NaN. The
+     * NEON version is accurate to 1 ULP on ARMv7 and correctly rounded on AArch64. Points to
+     * @ref ne10_sqrt_float_c or @ref ne10_sqrt_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_sqrt_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sqrt_float using plain C code. */
+    extern ne10_result_t ne10_sqrt_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sqrt_float using NEON intrinsics. */
+    extern ne10_result_t ne10_sqrt_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_sqrt_float_neon");
+
+    /**
+     * Computes the reciprocal square root of each element of the input array, using the hardware
+     * estimate refined by two Newton-Raphson steps. Zero gives infinity and infinity gives zero. The
+     * NEON version is accurate to 3 ULP. Points to @ref ne10_rsqrt_float_c or
+     * @ref ne10_rsqrt_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_rsqrt_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rsqrt_float using plain C code. */
+    extern ne10_result_t ne10_rsqrt_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rsqrt_float using NEON intrinsics. */
+    extern ne10_result_t ne10_rsqrt_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_rsqrt_float_neon");
+
+    /**
+     * Computes the reciprocal square root of each element of the input array with a single Newton-
+     * Raphson step. The NEON version has a relative error below 5e-5. Points to
+     * @ref ne10_rsqrt_fast_float_c or @ref ne10_rsqrt_fast_float_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_rsqrt_fast_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rsqrt_fast_float using plain C code. */
+    extern ne10_result_t ne10_rsqrt_fast_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rsqrt_fast_float using NEON intrinsics. */
+    extern ne10_result_t ne10_rsqrt_fast_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_rsqrt_fast_float_neon");
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup REDUCE Reductions
+     *
+     * \par
+     * These functions reduce an array to a few scalars: sums, extrema and their positions, mean and
+     * variance, RMS and vector norms. The floating point sums use compensated (Kahan) accumulation in
+     * both the C and NEON versions; the fixed-point reductions are exact. Apart from the order of
+     * summation, the C and NEON versions return the same results.
+     * @{
+     */
+
+    /**
+     * Computes the sum of the elements of the input array with compensated (Kahan) summation, so that
+     * the rounding error does not grow with count. Points to @ref ne10_sum_float_c or
+     * @ref ne10_sum_float_neon.
+     *
+     * @param[out] dst   Pointer to the sum
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_sum_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_float using plain C code. */
+    extern ne10_result_t ne10_sum_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_float using NEON intrinsics. */
+    extern ne10_result_t ne10_sum_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_sum_float_neon");
+
+    /**
+     * Finds the smallest and largest elements of the input array. Returns NE10_ERR if count is 0.
+     * Points to @ref ne10_minmax_float_c or @ref ne10_minmax_float_neon.
+     *
+     * @param[out] min   Pointer to the minimum
+     * @param[out] max   Pointer to the maximum
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_minmax_float) (ne10_float32_t * min, ne10_float32_t * max, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_minmax_float using plain C code. */
+    extern ne10_result_t ne10_minmax_float_c (ne10_float32_t * min, ne10_float32_t * max, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_minmax_float using NEON intrinsics. */
+    extern ne10_result_t ne10_minmax_float_neon (ne10_float32_t * min, ne10_float32_t * max, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_minmax_float_neon");
+
+    /**
+     * Finds the smallest element of the input array and the index of its first occurrence. Returns
+     * NE10_ERR if count is 0. Points to @ref ne10_argmin_float_c or @ref ne10_argmin_float_neon.
+     *
+     * @param[out] value Pointer to the minimum
+     * @param[out] index Pointer to the index of the minimum
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_argmin_float) (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_argmin_float using plain C code. */
+    extern ne10_result_t ne10_argmin_float_c (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_argmin_float using NEON intrinsics. */
+    extern ne10_result_t ne10_argmin_float_neon (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_argmin_float_neon");
+
+    /**
+     * Finds the largest element of the input array and the index of its first occurrence. Returns
+     * NE10_ERR if count is 0. Points to @ref ne10_argmax_float_c or @ref ne10_argmax_float_neon.
+     *
+     * @param[out] value Pointer to the maximum
+     * @param[out] index Pointer to the index of the maximum
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_argmax_float) (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_argmax_float using plain C code. */
+    extern ne10_result_t ne10_argmax_float_c (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_argmax_float using NEON intrinsics. */
+    extern ne10_result_t ne10_argmax_float_neon (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_argmax_float_neon");
+
+    /**
+     * Computes the mean and the population variance (divided by count) of the elements of the input
+     * array. The variance is accumulated from the deviations to the mean in a second pass, which
+     * avoids the cancellation of E[x^2] - E[x]^2. Returns NE10_ERR if count is 0. Points to
+     * @ref ne10_mean_var_float_c or @ref ne10_mean_var_float_neon.
+     *
+     * @param[out] mean  Pointer to the mean
+     * @param[out] var   Pointer to the variance
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_mean_var_float) (ne10_float32_t * mean, ne10_float32_t * var, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mean_var_float using plain C code. */
+    extern ne10_result_t ne10_mean_var_float_c (ne10_float32_t * mean, ne10_float32_t * var, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mean_var_float using NEON intrinsics. */
+    extern ne10_result_t ne10_mean_var_float_neon (ne10_float32_t * mean, ne10_float32_t * var, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_mean_var_float_neon");
+
+    /**
+     * Computes the root mean square of the elements of the input array. Returns NE10_ERR if count is
+     * 0. Points to @ref ne10_rms_float_c or @ref ne10_rms_float_neon.
+     *
+     * @param[out] dst   Pointer to the root mean square
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_rms_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rms_float using plain C code. */
+    extern ne10_result_t ne10_rms_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rms_float using NEON intrinsics. */
+    extern ne10_result_t ne10_rms_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_rms_float_neon");
+
+    /**
+     * Computes the L1 norm (the sum of absolute values) of the input array, with compensated
+     * summation. Points to @ref ne10_norm_l1_float_c or @ref ne10_norm_l1_float_neon.
+     *
+     * @param[out] dst   Pointer to the norm
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_norm_l1_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_l1_float using plain C code. */
+    extern ne10_result_t ne10_norm_l1_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_l1_float using NEON intrinsics. */
+    extern ne10_result_t ne10_norm_l1_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_norm_l1_float_neon");
+
+    /**
+     * Computes the L2 norm of the input array, with compensated summation of the squares. Elements
+     * larger than about 1.8e19 in magnitude overflow the squares. Points to @ref ne10_norm_l2_float_c
+     * or @ref ne10_norm_l2_float_neon.
+     *
+     * @param[out] dst   Pointer to the norm
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_norm_l2_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_l2_float using plain C code. */
+    extern ne10_result_t ne10_norm_l2_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_l2_float using NEON intrinsics. */
+    extern ne10_result_t ne10_norm_l2_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_norm_l2_float_neon");
+
+    /**
+     * Computes the infinity norm (the largest absolute value) of the input array; 0 if count is 0.
+     * Points to @ref ne10_norm_linf_float_c or @ref ne10_norm_linf_float_neon.
+     *
+     * @param[out] dst   Pointer to the norm
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_norm_linf_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_linf_float using plain C code. */
+    extern ne10_result_t ne10_norm_linf_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_linf_float using NEON intrinsics. */
+    extern ne10_result_t ne10_norm_linf_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_norm_linf_float_neon");
+
+    /**
+     * Computes the exact sum of the elements of the input array in 64 bits. Points to
+     * @ref ne10_sum_int32_c or @ref ne10_sum_int32_neon.
+     *
+     * @param[out] dst   Pointer to the sum
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_sum_int32) (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_int32 using plain C code. */
+    extern ne10_result_t ne10_sum_int32_c (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_sum_int32_neon (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count) asm ("ne10_sum_int32_neon");
+
+    /**
+     * Finds the smallest and largest elements of the input array. Returns NE10_ERR if count is 0.
+     * Points to @ref ne10_minmax_int32_c or @ref ne10_minmax_int32_neon.
+     *
+     * @param[out] min   Pointer to the minimum
+     * @param[out] max   Pointer to the maximum
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_minmax_int32) (ne10_int32_t * min, ne10_int32_t * max, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_minmax_int32 using plain C code. */
+    extern ne10_result_t ne10_minmax_int32_c (ne10_int32_t * min, ne10_int32_t * max, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_minmax_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_minmax_int32_neon (ne10_int32_t * min, ne10_int32_t * max, ne10_int32_t * src, ne10_uint32_t count) asm ("ne10_minmax_int32_neon");
+
+    /**
+     * Finds the smallest element of the input array and the index of its first occurrence. Returns
+     * NE10_ERR if count is 0. Points to @ref ne10_argmin_int32_c or @ref ne10_argmin_int32_neon.
+     *
+     * @param[out] value Pointer to the minimum
+     * @param[out] index Pointer to the index of the minimum
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_argmin_int32) (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_argmin_int32 using plain C code. */
+    extern ne10_result_t ne10_argmin_int32_c (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_argmin_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_argmin_int32_neon (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count) asm ("ne10_argmin_int32_neon");
+
+    /**
+     * Finds the largest element of the input array and the index of its first occurrence. Returns
+     * NE10_ERR if count is 0. Points to @ref ne10_argmax_int32_c or @ref ne10_argmax_int32_neon.
+     *
+     * @param[out] value Pointer to the maximum
+     * @param[out] index Pointer to the index of the maximum
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_argmax_int32) (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_argmax_int32 using plain C code. */
+    extern ne10_result_t ne10_argmax_int32_c (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_argmax_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_argmax_int32_neon (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count) asm ("ne10_argmax_int32_neon");
+
+    /**
+     * Computes the exact L1 norm (the sum of absolute values) of the input array in 64 bits. Points to
+     * @ref ne10_norm_l1_int32_c or @ref ne10_norm_l1_int32_neon.
+     *
+     * @param[out] dst   Pointer to the norm
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_norm_l1_int32) (ne10_uint64_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_l1_int32 using plain C code. */
+    extern ne10_result_t ne10_norm_l1_int32_c (ne10_uint64_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_l1_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_norm_l1_int32_neon (ne10_uint64_t * dst, ne10_int32_t * src, ne10_uint32_t count) asm ("ne10_norm_l1_int32_neon");
+
+    /**
+     * Computes the infinity norm (the largest absolute value) of the input array. The result is
+     * unsigned so that the magnitude of the most negative value is representable; 0 if count is 0.
+     * Points to @ref ne10_norm_linf_int32_c or @ref ne10_norm_linf_int32_neon.
+     *
+     * @param[out] dst   Pointer to the norm
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_norm_linf_int32) (ne10_uint32_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_linf_int32 using plain C code. */
+    extern ne10_result_t ne10_norm_linf_int32_c (ne10_uint32_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_linf_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_norm_linf_int32_neon (ne10_uint32_t * dst, ne10_int32_t * src, ne10_uint32_t count) asm ("ne10_norm_linf_int32_neon");
+
+    /**
+     * Computes the exact sum of the elements of the input array in 64 bits. Points to
+     * @ref ne10_sum_int16_c or @ref ne10_sum_int16_neon.
+     *
+     * @param[out] dst   Pointer to the sum
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_sum_int16) (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_int16 using plain C code. */
+    extern ne10_result_t ne10_sum_int16_c (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_sum_int16_neon (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count) asm ("ne10_sum_int16_neon");
+
+    /**
+     * Finds the smallest and largest elements of the input array. Returns NE10_ERR if count is 0.
+     * Points to @ref ne10_minmax_int16_c or @ref ne10_minmax_int16_neon.
+     *
+     * @param[out] min   Pointer to the minimum
+     * @param[out] max   Pointer to the maximum
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_minmax_int16) (ne10_int16_t * min, ne10_int16_t * max, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_minmax_int16 using plain C code. */
+    extern ne10_result_t ne10_minmax_int16_c (ne10_int16_t * min, ne10_int16_t * max, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_minmax_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_minmax_int16_neon (ne10_int16_t * min, ne10_int16_t * max, ne10_int16_t * src, ne10_uint32_t count) asm ("ne10_minmax_int16_neon");
+
+    /**
+     * Finds the smallest element of the input array and the index of its first occurrence. Returns
+     * NE10_ERR if count is 0. Points to @ref ne10_argmin_int16_c or @ref ne10_argmin_int16_neon.
+     *
+     * @param[out] value Pointer to the minimum
+     * @param[out] index Pointer to the index of the minimum
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_argmin_int16) (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_argmin_int16 using plain C code. */
+    extern ne10_result_t ne10_argmin_int16_c (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_argmin_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_argmin_int16_neon (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count) asm ("ne10_argmin_int16_neon");
+
+    /**
+     * Finds the largest element of the input array and the index of its first occurrence. Returns
+     * NE10_ERR if count is 0. Points to @ref ne10_argmax_int16_c or @ref ne10_argmax_int16_neon.
+     *
+     * @param[out] value Pointer to the maximum
+     * @param[out] index Pointer to the index of the maximum
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_argmax_int16) (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_argmax_int16 using plain C code. */
+    extern ne10_result_t ne10_argmax_int16_c (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_argmax_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_argmax_int16_neon (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count) asm ("ne10_argmax_int16_neon");
+
+    /**
+     * Computes the exact L1 norm (the sum of absolute values) of the input array in 64 bits. Points to
+     * @ref ne10_norm_l1_int16_c or @ref ne10_norm_l1_int16_neon.
+     *
+     * @param[out] dst   Pointer to the norm
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_norm_l1_int16) (ne10_uint64_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_l1_int16 using plain C code. */
+    extern ne10_result_t ne10_norm_l1_int16_c (ne10_uint64_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_l1_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_norm_l1_int16_neon (ne10_uint64_t * dst, ne10_int16_t * src, ne10_uint32_t count) asm ("ne10_norm_l1_int16_neon");
+
+    /**
+     * Computes the infinity norm (the largest absolute value) of the input array. The result is
+     * unsigned so that the magnitude of the most negative value is representable; 0 if count is 0.
+     * Points to @ref ne10_norm_linf_int16_c or @ref ne10_norm_linf_int16_neon.
+     *
+     * @param[out] dst   Pointer to the norm
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of items in the input array
+     */
+    extern ne10_result_t (*ne10_norm_linf_int16) (ne10_uint32_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_linf_int16 using plain C code. */
+    extern ne10_result_t ne10_norm_linf_int16_c (ne10_uint32_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm_linf_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_norm_linf_int16_neon (ne10_uint32_t * dst, ne10_int16_t * src, ne10_uint32_t count) asm ("ne10_norm_linf_int16_neon");
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup GEMM General Matrix Multiplication
+     *
+     * \par
+     * These functions implement the BLAS level 2 and 3 products for dense single precision matrices of
+     * arbitrary size, stored in row-major or column-major order with a leading dimension that may
+     * exceed the row (or column) length, so that sub-matrices can be addressed in place.
+     * @{
+     */
+
+    /**
+     * Computes C = alpha * op(A) * op(B) + beta * C for general single precision matrices of any size.
+     * The C version is the plain triple loop; the NEON version packs op(A) and op(B) into cache-sized
+     * panels and runs a 4x8 register-blocked micro-kernel over them, which needs 320 KB of temporary
+     * buffers. C is not read when beta is 0. Returns NE10_ERR if a leading dimension is too small or
+     * the buffer cannot be allocated. Points to @ref ne10_gemm_f32_c or @ref ne10_gemm_f32_neon.
+     *
+     * @param[in]  layout  Storage order of A, B and C
+     * @param[in]  trans_a Whether op(A) is A or its transpose
+     * @param[in]  trans_b Whether op(B) is B or its transpose
+     * @param[in]  m       Number of rows of op(A) and C
+     * @param[in]  n       Number of columns of op(B) and C
+     * @param[in]  k       Number of columns of op(A) and rows of op(B)
+     * @param[in]  alpha   Scale of the product
+     * @param[in]  a       Pointer to the matrix A
+     * @param[in]  lda     Leading dimension (row or column stride) of A
+     * @param[in]  b       Pointer to the matrix B
+     * @param[in]  ldb     Leading dimension of B
+     * @param[in]  beta    Scale of the previous contents of C
+     * @param[out] c       Pointer to the matrix C
+     * @param[in]  ldc     Leading dimension of C
+     */
+    extern ne10_result_t (*ne10_gemm_f32) (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans_a, ne10_matrix_trans_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_float32_t alpha, ne10_float32_t * a, ne10_uint32_t lda, ne10_float32_t * b, ne10_uint32_t ldb, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc);
+    /** Specific implementation of @ref ne10_gemm_f32 using plain C code. */
+    extern ne10_result_t ne10_gemm_f32_c (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans_a, ne10_matrix_trans_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_float32_t alpha, ne10_float32_t * a, ne10_uint32_t lda, ne10_float32_t * b, ne10_uint32_t ldb, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc);
+    /** Specific implementation of @ref ne10_gemm_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_gemm_f32_neon (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans_a, ne10_matrix_trans_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_float32_t alpha, ne10_float32_t * a, ne10_uint32_t lda, ne10_float32_t * b, ne10_uint32_t ldb, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc) asm ("ne10_gemm_f32_neon");
+
+    /**
+     * Computes y = alpha * op(A) * x + beta * y for a general single precision matrix of any size. y
+     * is not read when beta is 0. Returns NE10_ERR if the leading dimension is too small. Points to
+     * @ref ne10_gemv_f32_c or @ref ne10_gemv_f32_neon.
+     *
+     * @param[in]  layout Storage order of A
+     * @param[in]  trans  Whether op(A) is A or its transpose
+     * @param[in]  m      Number of rows of A
+     * @param[in]  n      Number of columns of A
+     * @param[in]  alpha  Scale of the product
+     * @param[in]  a      Pointer to the matrix A
+     * @param[in]  lda    Leading dimension (row or column stride) of A
+     * @param[in]  x      Pointer to the input vector, of n elements (m if transposed)
+     * @param[in]  beta   Scale of the previous contents of y
+     * @param[out] y      Pointer to the output vector, of m elements (n if transposed)
+     */
+    extern ne10_result_t (*ne10_gemv_f32) (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans, ne10_uint32_t m, ne10_uint32_t n, ne10_float32_t alpha, ne10_float32_t * a, ne10_uint32_t lda, ne10_float32_t * x, ne10_float32_t beta, ne10_float32_t * y);
+    /** Specific implementation of @ref ne10_gemv_f32 using plain C code. */
+    extern ne10_result_t ne10_gemv_f32_c (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans, ne10_uint32_t m, ne10_uint32_t n, ne10_float32_t alpha, ne10_float32_t * a, ne10_uint32_t lda, ne10_float32_t * x, ne10_float32_t beta, ne10_float32_t * y);
+    /** Specific implementation of @ref ne10_gemv_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_gemv_f32_neon (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans, ne10_uint32_t m, ne10_uint32_t n, ne10_float32_t alpha, ne10_float32_t * a, ne10_uint32_t lda, ne10_float32_t * x, ne10_float32_t beta, ne10_float32_t * y) asm ("ne10_gemv_f32_neon");
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup MAT_F32 General Matrix Operations
+     *
+     * \par
+     * These functions work on general single precision matrices of any size, described by
+     * ne10_mat_f32_t: the number of rows and columns, the row stride and a pointer to the row-major
+     * data. A descriptor with a stride larger than its number of columns addresses a sub-matrix in
+     * place. The NEON versions give the same results as the C versions, except for the rounding of the
+     * products, which go through the GEMM kernels.
+     * @{
+     */
+
+    /**
+     * Adds two general matrices element by element. All three matrices must have the same size,
+     * otherwise NE10_ERR is returned. dst may equal src1 or src2. Points to @ref ne10_mat_add_f32_c or
+     * @ref ne10_mat_add_f32_neon.
+     *
+     * @param[out] dst   Pointer to the destination matrix
+     * @param[in]  src1  Pointer to the first source matrix
+     * @param[in]  src2  Pointer to the second source matrix
+     */
+    extern ne10_result_t (*ne10_mat_add_f32) (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2);
+    /** Specific implementation of @ref ne10_mat_add_f32 using plain C code. */
+    extern ne10_result_t ne10_mat_add_f32_c (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2);
+    /** Specific implementation of @ref ne10_mat_add_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_mat_add_f32_neon (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2) asm ("ne10_mat_add_f32_neon");
+
+    /**
+     * Subtracts one general matrix from another element by element (src1 - src2). All three matrices
+     * must have the same size, otherwise NE10_ERR is returned. dst may equal src1 or src2. Points to
+     * @ref ne10_mat_sub_f32_c or @ref ne10_mat_sub_f32_neon.
+     *
+     * @param[out] dst   Pointer to the destination matrix
+     * @param[in]  src1  Pointer to the first source matrix
+     * @param[in]  src2  Pointer to the second source matrix
+     */
+    extern ne10_result_t (*ne10_mat_sub_f32) (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2);
+    /** Specific implementation of @ref ne10_mat_sub_f32 using plain C code. */
+    extern ne10_result_t ne10_mat_sub_f32_c (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2);
+    /** Specific implementation of @ref ne10_mat_sub_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_mat_sub_f32_neon (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2) asm ("ne10_mat_sub_f32_neon");
+
+    /**
+     * Multiplies two general matrices element by element (Hadamard product). All three matrices must
+     * have the same size, otherwise NE10_ERR is returned. dst may equal src1 or src2. Points to
+     * @ref ne10_mat_mul_elem_f32_c or @ref ne10_mat_mul_elem_f32_neon.
+     *
+     * @param[out] dst   Pointer to the destination matrix
+     * @param[in]  src1  Pointer to the first source matrix
+     * @param[in]  src2  Pointer to the second source matrix
+     */
+    extern ne10_result_t (*ne10_mat_mul_elem_f32) (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2);
+    /** Specific implementation of @ref ne10_mat_mul_elem_f32 using plain C code. */
+    extern ne10_result_t ne10_mat_mul_elem_f32_c (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2);
+    /** Specific implementation of @ref ne10_mat_mul_elem_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_mat_mul_elem_f32_neon (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2) asm ("ne10_mat_mul_elem_f32_neon");
+
+    /**
+     * Multiplies every element of a general matrix by a constant. Both matrices must have the same
+     * size, otherwise NE10_ERR is returned. dst may equal src. Points to @ref ne10_mat_scale_f32_c or
+     * @ref ne10_mat_scale_f32_neon.
+     *
+     * @param[out] dst   Pointer to the destination matrix
+     * @param[in]  src   Pointer to the source matrix
+     * @param[in]  scale The constant to multiply by
+     */
+    extern ne10_result_t (*ne10_mat_scale_f32) (ne10_mat_f32_t * dst, ne10_mat_f32_t * src, ne10_float32_t scale);
+    /** Specific implementation of @ref ne10_mat_scale_f32 using plain C code. */
+    extern ne10_result_t ne10_mat_scale_f32_c (ne10_mat_f32_t * dst, ne10_mat_f32_t * src, ne10_float32_t scale);
+    /** Specific implementation of @ref ne10_mat_scale_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_mat_scale_f32_neon (ne10_mat_f32_t * dst, ne10_mat_f32_t * src, ne10_float32_t scale) asm ("ne10_mat_scale_f32_neon");
+
+    /**
+     * Transposes a general matrix. dst must have as many rows as src has columns and the reverse,
+     * otherwise NE10_ERR is returned, and the two must not overlap. The NEON version works on
+     * blocks that fit in the L1 cache, transposing 4x4 tiles in registers. Points to
+     * @ref ne10_mat_transpose_f32_c or @ref ne10_mat_transpose_f32_neon.
+     *
+     * @param[out] dst   Pointer to the destination matrix
+     * @param[in]  src   Pointer to the source matrix
+     */
+    extern ne10_result_t (*ne10_mat_transpose_f32) (ne10_mat_f32_t * dst, ne10_mat_f32_t * src);
+    /** Specific implementation of @ref ne10_mat_transpose_f32 using plain C code. */
+    extern ne10_result_t ne10_mat_transpose_f32_c (ne10_mat_f32_t * dst, ne10_mat_f32_t * src);
+    /** Specific implementation of @ref ne10_mat_transpose_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_mat_transpose_f32_neon (ne10_mat_f32_t * dst, ne10_mat_f32_t * src) asm ("ne10_mat_transpose_f32_neon");
+
+    /**
+     * Multiplies two general matrices (dst = src1 * src2) through @ref ne10_gemm_f32. dst must be
+     * src1->rows x src2->cols and src1->cols must equal src2->rows, otherwise NE10_ERR is returned.
+     * dst must not overlap the sources. Points to @ref ne10_mat_mul_f32_c or
+     * @ref ne10_mat_mul_f32_neon.
+     *
+     * @param[out] dst   Pointer to the destination matrix
+     * @param[in]  src1  Pointer to the first source matrix
+     * @param[in]  src2  Pointer to the second source matrix
+     */
+    extern ne10_result_t (*ne10_mat_mul_f32) (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2);
+    /** Specific implementation of @ref ne10_mat_mul_f32 using plain C code. */
+    extern ne10_result_t ne10_mat_mul_f32_c (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2);
+    /** Specific implementation of @ref ne10_mat_mul_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_mat_mul_f32_neon (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2) asm ("ne10_mat_mul_f32_neon");
+
+    /**
+     * Multiplies a vector by a general matrix (dst = mat * src) through @ref ne10_gemv_f32. Points to
+     * @ref ne10_mat_mulvec_f32_c or @ref ne10_mat_mulvec_f32_neon.
+     *
+     * @param[out] dst   Pointer to the destination vector, of mat->rows elements
+     * @param[in]  mat   Pointer to the matrix
+     * @param[in]  src   Pointer to the source vector, of mat->cols elements
+     */
+    extern ne10_result_t (*ne10_mat_mulvec_f32) (ne10_float32_t * dst, ne10_mat_f32_t * mat, ne10_float32_t * src);
+    /** Specific implementation of @ref ne10_mat_mulvec_f32 using plain C code. */
+    extern ne10_result_t ne10_mat_mulvec_f32_c (ne10_float32_t * dst, ne10_mat_f32_t * mat, ne10_float32_t * src);
+    /** Specific implementation of @ref ne10_mat_mulvec_f32 using NEON intrinsics. */
+    extern ne10_result_t ne10_mat_mulvec_f32_neon (ne10_float32_t * dst, ne10_mat_f32_t * mat, ne10_float32_t * src) asm ("ne10_mat_mulvec_f32_neon");
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup GEMM_S8 Quantized Matrix Multiplication
+     *
+     * \par
+     * These functions implement the int8 building blocks of quantized inference: int8 x int8 -> int32
+     * dot products and matrix products, laid out like @ref GEMM, and the per-channel requantization of
+     * their int32 results back to int8.
+     * @{
+     */
+
+    /**
+     * Computes the int32 dot product of two int8 vectors. The result is exact while it fits in int32,
+     * which always holds for count <= 131072. On AArch64 CPUs with the ARMv8.2 dot product extension,
+     * @ref ne10_init selects the SDOT version @ref ne10_dot_s8_dotprod instead. Points to
+     * @ref ne10_dot_s8_c or @ref ne10_dot_s8_neon.
+     *
+     * @param[out] dst   Pointer to the result
+     * @param[in]  src1  Pointer to the first source vector
+     * @param[in]  src2  Pointer to the second source vector
+     * @param[in]  count The number of items in the input arrays
+     */
+    extern ne10_result_t (*ne10_dot_s8) (ne10_int32_t * dst, ne10_int8_t * src1, ne10_int8_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_s8 using plain C code. */
+    extern ne10_result_t ne10_dot_s8_c (ne10_int32_t * dst, ne10_int8_t * src1, ne10_int8_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_s8 using NEON intrinsics. */
+    extern ne10_result_t ne10_dot_s8_neon (ne10_int32_t * dst, ne10_int8_t * src1, ne10_int8_t * src2, ne10_uint32_t count) asm ("ne10_dot_s8_neon");
+#if defined (__aarch64__)
+    /** Specific implementation of @ref ne10_dot_s8 using the ARMv8.2 SDOT instruction. */
+    extern ne10_result_t ne10_dot_s8_dotprod (ne10_int32_t * dst, ne10_int8_t * src1, ne10_int8_t * src2, ne10_uint32_t count) asm ("ne10_dot_s8_dotprod");
+#endif
+
+    /**
+     * Computes C = op(A) * op(B) for general int8 matrices of any size, with int32 results. The C
+     * version is the plain triple loop; the NEON version packs op(A) and op(B) into cache-sized panels
+     * of four consecutive k, as the VMULL/VPADAL and SDOT micro-kernels consume them, which needs 160
+     * KB of temporary buffers. On AArch64 CPUs with the ARMv8.2 dot product extension, @ref ne10_init
+     * selects the SDOT version @ref ne10_gemm_s8s8s32_dotprod. The results are exact while they fit in
+     * int32, which always holds for k <= 131072. Returns NE10_ERR if a leading dimension is too small
+     * or the buffer cannot be allocated. Points to @ref ne10_gemm_s8s8s32_c or
+     * @ref ne10_gemm_s8s8s32_neon.
+     *
+     * @param[in]  layout  Storage order of A, B and C
+     * @param[in]  trans_a Whether op(A) is A or its transpose
+     * @param[in]  trans_b Whether op(B) is B or its transpose
+     * @param[in]  m       Number of rows of op(A) and C
+     * @param[in]  n       Number of columns of op(B) and C
+     * @param[in]  k       Number of columns of op(A) and rows of op(B)
+     * @param[in]  a       Pointer to the matrix A
+     * @param[in]  lda     Leading dimension (row or column stride) of A
+     * @param[in]  b       Pointer to the matrix B
+     * @param[in]  ldb     Leading dimension of B
+     * @param[out] c       Pointer to the matrix C
+     * @param[in]  ldc     Leading dimension of C
+     */
+    extern ne10_result_t (*ne10_gemm_s8s8s32) (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans_a, ne10_matrix_trans_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_int8_t * a, ne10_uint32_t lda, ne10_int8_t * b, ne10_uint32_t ldb, ne10_int32_t * c, ne10_uint32_t ldc);
+    /** Specific implementation of @ref ne10_gemm_s8s8s32 using plain C code. */
+    extern ne10_result_t ne10_gemm_s8s8s32_c (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans_a, ne10_matrix_trans_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_int8_t * a, ne10_uint32_t lda, ne10_int8_t * b, ne10_uint32_t ldb, ne10_int32_t * c, ne10_uint32_t ldc);
+    /** Specific implementation of @ref ne10_gemm_s8s8s32 using NEON intrinsics. */
+    extern ne10_result_t ne10_gemm_s8s8s32_neon (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans_a, ne10_matrix_trans_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_int8_t * a, ne10_uint32_t lda, ne10_int8_t * b, ne10_uint32_t ldb, ne10_int32_t * c, ne10_uint32_t ldc) asm ("ne10_gemm_s8s8s32_neon");
+#if defined (__aarch64__)
+    /** Specific implementation of @ref ne10_gemm_s8s8s32 using the ARMv8.2 SDOT instruction. */
+    extern ne10_result_t ne10_gemm_s8s8s32_dotprod (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans_a, ne10_matrix_trans_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_int8_t * a, ne10_uint32_t lda, ne10_int8_t * b, ne10_uint32_t ldb, ne10_int32_t * c, ne10_uint32_t ldc) asm ("ne10_gemm_s8s8s32_dotprod");
+#endif
+
+    /**
+     * Requantizes a row-major matrix of int32 accumulators, such as the output of
+     * @ref ne10_gemm_s8s8s32, to int8 with per-channel (per-column) parameters: dst = sat8 (rshift
+     * (sqrdmulh (acc + bias, multiplier), shift) + zero_point), where sqrdmulh is the rounding
+     * doubling high multiply by a Q31 multiplier, rshift rounds half up and every addition saturates.
+     * The C and NEON versions are bit-exact. Returns NE10_ERR if a leading dimension is too small or a
+     * shift is outside [0, 31]. Points to @ref ne10_requantize_s32s8_c or
+     * @ref ne10_requantize_s32s8_neon.
+     *
+     * @param[out] dst        Pointer to the int8 output matrix
+     * @param[in]  ldd        Row stride of dst
+     * @param[in]  src        Pointer to the int32 input matrix
+     * @param[in]  lds        Row stride of src
+     * @param[in]  m          Number of rows
+     * @param[in]  n          Number of columns (channels)
+     * @param[in]  bias       Pointer to n per-channel biases, added before scaling, or NULL
+     * @param[in]  multiplier Pointer to n per-channel Q31 multipliers
+     * @param[in]  shift      Pointer to n per-channel right shifts, in [0, 31]
+     * @param[in]  zero_point Output zero point
+     */
+    extern ne10_result_t (*ne10_requantize_s32s8) (ne10_int8_t * dst, ne10_uint32_t ldd, ne10_int32_t * src, ne10_uint32_t lds, ne10_uint32_t m, ne10_uint32_t n, ne10_int32_t * bias, ne10_int32_t * multiplier, ne10_int32_t * shift, ne10_int8_t zero_point);
+    /** Specific implementation of @ref ne10_requantize_s32s8 using plain C code. */
+    extern ne10_result_t ne10_requantize_s32s8_c (ne10_int8_t * dst, ne10_uint32_t ldd, ne10_int32_t * src, ne10_uint32_t lds, ne10_uint32_t m, ne10_uint32_t n, ne10_int32_t * bias, ne10_int32_t * multiplier, ne10_int32_t * shift, ne10_int8_t zero_point);
+    /** Specific implementation of @ref ne10_requantize_s32s8 using NEON intrinsics. */
+    extern ne10_result_t ne10_requantize_s32s8_neon (ne10_int8_t * dst, ne10_uint32_t ldd, ne10_int32_t * src, ne10_uint32_t lds, ne10_uint32_t m, ne10_uint32_t n, ne10_int32_t * bias, ne10_int32_t * multiplier, ne10_int32_t * shift, ne10_int8_t zero_point) asm ("ne10_requantize_s32s8_neon");
+    /** @} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -75,8 +75,13 @@ typedef int64_t  ne10_int64_t;
 typedef uint64_t ne10_uint64_t;
 typedef float    ne10_float32_t;
 typedef double   ne10_float64_t;
+typedef ne10_uint16_t ne10_float16_t;  // IEEE 754 half precision value, stored as its bit pattern
 typedef int      ne10_result_t;     // resulting [error-]code
 
+// Memory allocation hooks, installed with ne10_set_allocator
+typedef void * (*ne10_malloc_func_t) (ne10_uint32_t size, void * ctx);
+typedef void (*ne10_free_func_t) (void * ptr, void * ctx);
+
 /**
  * @brief A 2-tuple of ne10_float32_t values.
  */
@@ -107,6 +112,63 @@ typedef struct
     ne10_float32_t w;
 } ne10_vec4f_t;
 
+/**
+ * @brief Separate x and y component arrays of a set of 2D vectors (structure-of-arrays layout).
+ */
+typedef struct
+{
+    ne10_float32_t * x;
+    ne10_float32_t * y;
+} ne10_vec2f_soa_t;
+
+/**
+ * @brief Separate x, y and z component arrays of a set of 3D vectors (structure-of-arrays layout).
+ */
+typedef struct
+{
+    ne10_float32_t * x;
+    ne10_float32_t * y;
+    ne10_float32_t * z;
+} ne10_vec3f_soa_t;
+
+/**
+ * @brief Separate x, y, z and w component arrays of a set of 4D vectors (structure-of-arrays layout).
+ */
+typedef struct
+{
+    ne10_float32_t * x;
+    ne10_float32_t * y;
+    ne10_float32_t * z;
+    ne10_float32_t * w;
+} ne10_vec4f_soa_t;
+
+/**
+ * @brief A quaternion x i + y j + z k + w, with the scalar part w stored last.
+ */
+typedef struct
+{
+    ne10_float32_t x;
+    ne10_float32_t y;
+    ne10_float32_t z;
+    ne10_float32_t w;
+} ne10_quatf_t;
+
+/**
+ * @brief Separate x, y, z and w component arrays of a set of quaternions. This is the layout of
+ * ne10_vec4f_soa_t, so ne10_vec4f_aos_to_soa and ne10_vec4f_soa_to_aos convert to and from it.
+ */
+typedef ne10_vec4f_soa_t ne10_quatf_soa_t;
+
+/**
+ * @brief A dual quaternion real + e dual. For a rigid transform, real is the unit rotation and
+ * dual is half of the translation (as a pure quaternion) multiplied by real.
+ */
+typedef struct
+{
+    ne10_quatf_t real;
+    ne10_quatf_t dual;
+} ne10_dualquatf_t;
+
 /////////////////////////////////////////////////////////
 // definitions for matrix
 /////////////////////////////////////////////////////////
@@ -215,6 +277,102 @@ static inline void createColumnMajorMatrix4x4 (ne10_mat4x4f_t * outMat, ne10_flo
     outMat->c4.r4 = m44;
 }
 
+/**
+ * Number of matrices interleaved in one block of @ref ne10_mat2x2f_x4_t, @ref ne10_mat3x3f_x4_t
+ * or @ref ne10_mat4x4f_x4_t, one per NEON lane.
+ */
+#define NE10_MAT_X4_LANES 4
+
+/**
+ * Largest order accepted by @ref ne10_cholesky_f32, @ref ne10_lu_f32, @ref ne10_qr_f32 and the
+ * solvers that go with them; the smallest is 2.
+ */
+#define NE10_DECOMP_MAX_N 8
+
+/** Number of Jacobi sweeps over the three column pairs made by @ref ne10_svd_3x3f. */
+#define NE10_SVD_SWEEPS 6
+
+/**
+ * @ref ne10_svd_3x3f completes U with a cross product when the smallest singular value is at most
+ * this fraction of the largest.
+ */
+#define NE10_SVD_RANK_EPS 1.0e-5f
+
+/**
+ * @ref ne10_lu_f32 takes a matrix as singular when a pivot is at most this fraction of the largest
+ * magnitude in the matrix.
+ */
+#define NE10_LU_PIVOT_EPS 1.0e-6f
+
+/**
+ * @brief Four 2x2 matrices interleaved entry by entry (array-of-structures-of-arrays layout).
+ * m[e][l] is entry e of matrix l, with the entries in the column-major order of ne10_mat2x2f_t.
+ */
+typedef struct
+{
+    ne10_float32_t m[4][NE10_MAT_X4_LANES];
+} ne10_mat2x2f_x4_t;
+
+/**
+ * @brief Four 3x3 matrices interleaved entry by entry (array-of-structures-of-arrays layout).
+ * m[e][l] is entry e of matrix l, with the entries in the column-major order of ne10_mat3x3f_t.
+ */
+typedef struct
+{
+    ne10_float32_t m[9][NE10_MAT_X4_LANES];
+} ne10_mat3x3f_x4_t;
+
+/**
+ * @brief Four 4x4 matrices interleaved entry by entry (array-of-structures-of-arrays layout).
+ * m[e][l] is entry e of matrix l, with the entries in the column-major order of ne10_mat4x4f_t.
+ */
+typedef struct
+{
+    ne10_float32_t m[16][NE10_MAT_X4_LANES];
+} ne10_mat4x4f_x4_t;
+
+/**
+ * Storage order of a general matrix, as used by @ref ne10_gemm_f32 and @ref ne10_gemv_f32.
+ */
+typedef enum
+{
+    NE10_ROW_MAJOR = 0,     /**< The elements of a row are contiguous; the leading dimension is the row stride. */
+    NE10_COL_MAJOR          /**< The elements of a column are contiguous; the leading dimension is the column stride. */
+} ne10_matrix_layout_t;
+
+/**
+ * Whether a matrix operand is used as stored or transposed.
+ */
+typedef enum
+{
+    NE10_NO_TRANS = 0,
+    NE10_TRANS
+} ne10_matrix_trans_t;
+
+/**
+ * @brief Descriptor of a general single precision matrix of any size, stored row-major.
+ * Element (i, j) is data[i * stride + j]. A stride larger than cols lets the descriptor address a
+ * sub-matrix of a larger one in place.
+ */
+typedef struct
+{
+    ne10_uint32_t rows;
+    ne10_uint32_t cols;
+    ne10_uint32_t stride;       /**< Distance in elements between the starts of consecutive rows, at least cols */
+    ne10_float32_t * data;
+} ne10_mat_f32_t;
+
+/**
+ * Rounding applied when converting floating point values to integers, as used by the
+ * ne10_convert_* functions.
+ */
+typedef enum
+{
+    NE10_ROUND_NEAREST = 0, /**< Round to the nearest integer, with ties away from zero. */
+    NE10_ROUND_ZERO,        /**< Round toward zero (truncate). */
+    NE10_ROUND_FLOOR        /**< Round toward minus infinity. */
+} ne10_round_mode_t;
+
 /////////////////////////////////////////////////////////
 // definitions for fft
 /////////////////////////////////////////////////////////
@@ -393,6 +551,33 @@ typedef struct
     ne10_float32_t *pState;          /**< Points to the state variable array. The array is of length numTaps+maxBlockSize-1. */
 } ne10_fir_interpolate_instance_f32_t;
 
+/**
+ * @brief Instance structure for the floating-point halfband FIR decimator and interpolator.
+ */
+typedef struct
+{
+    ne10_uint16_t numTaps;           /**< Length of the filter, 4*K-1. */
+    ne10_float32_t *pCoeffs;         /**< Points to the coefficient array. The array is of length numTaps. */
+    ne10_float32_t *pState;          /**< Points to the state variable array. The array is of length numTaps+maxBlockSize-1 for decimation and (numTaps-1)/2+maxBlockSize for interpolation. */
+} ne10_fir_halfband_instance_f32_t;
+
+/**
+ * @brief State of a multi-stage decimator or interpolator made of halfband stages and one FIR stage.
+ */
+typedef struct
+{
+    ne10_uint16_t numHalfbands;                     /**< Number of halfband stages. */
+    ne10_uint32_t factor;                           /**< Total rate change factor, 2^numHalfbands times the factor of the FIR stage. */
+    ne10_uint32_t maxBlockSize;                     /**< Maximum number of input samples per call. */
+    ne10_fir_halfband_instance_f32_t *pHalfband;    /**< Points to the halfband stages, in processing order. */
+    ne10_fir_decimate_instance_f32_t *pDecimate;    /**< Points to the final FIR decimator, NULL for interpolation. */
+    ne10_fir_interpolate_instance_f32_t *pInterpolate; /**< Points to the first FIR interpolator, NULL for decimation. */
+    ne10_float32_t *pBuffer;                        /**< Points to two buffers for the intermediate signals. */
+    ne10_uint32_t bufferSize;                       /**< Length of each intermediate buffer. */
+} ne10_fir_cascade_state_f32_t;
+
+typedef ne10_fir_cascade_state_f32_t* ne10_fir_cascade_cfg_f32_t;
+
 /**
  * @brief Instance structure for the floating-point FIR Sparse filter.
  */
@@ -406,6 +591,35 @@ typedef struct
     ne10_int32_t  *pTapDelay;    /**< Pointer to the array containing positions of the non-zero tap values. */
 } ne10_fir_sparse_instance_f32_t;
 
+/**
+ * @brief Instance structure for the floating-point sparse FIR filter with a linear delay line.
+ */
+typedef struct
+{
+    ne10_uint16_t numTaps;      /**< Number of non-zero taps. */
+    ne10_uint32_t writeIndex;   /**< Position of the next input sample in the delay line. */
+    ne10_uint32_t delaySize;    /**< Length of the delay line, maxDelay+blockSize. */
+    ne10_uint32_t blockSize;    /**< Largest number of samples processed per call. */
+    ne10_float32_t *pState;     /**< Points to the state array of length maxDelay+2*blockSize; the last blockSize words mirror the first ones. */
+    ne10_float32_t *pCoeffs;    /**< Points to the coefficients, sorted by increasing delay. */
+    ne10_int32_t *pTapDelay;    /**< Points to the tap delays, in increasing order. */
+} ne10_fir_sparse_linear_instance_f32_t;
+
+/**
+ * @brief Instance structure for the floating-point polyphase resampler.
+ */
+typedef struct
+{
+    ne10_uint16_t L;               /**< Number of polyphase branches (interpolation factor). */
+    ne10_uint16_t M;               /**< Decimation factor, 0 in fractional mode. */
+    ne10_uint16_t phaseLength;     /**< Length of each polyphase branch. */
+    ne10_uint32_t phase;           /**< Rational mode: position of the next output in units of 1/L input samples. */
+    ne10_float64_t position;       /**< Fractional mode: position of the next output in input samples. */
+    ne10_float64_t step;           /**< Fractional mode: input samples advanced per output sample. */
+    ne10_float32_t *pCoeffs;       /**< Points to the polyphase coefficient array. The array is of length L*phaseLength. */
+    ne10_float32_t *pState;        /**< Points to the state variable array. The array is of length phaseLength+maxBlockSize. */
+} ne10_resampler_instance_f32_t;
+
 /**
    * @brief Instance structure for the floating point IIR Lattice filter.
    */
@@ -417,6 +631,218 @@ typedef struct
     ne10_float32_t *pvCoeffs;    /**< Points to the ladder coefficient array. The array is of length numStages+1. */
 } ne10_iir_lattice_instance_f32_t;
 
+/**
+ * Number of precomputed coefficients of one section of a block IIR filter with the given order
+ * and look-ahead step size.
+ */
+#define NE10_IIR_BLOCK_COEFFS_LEN(order, stepSize) \
+    (2 * (order) * (order) + 2 * (order) * (stepSize) + (stepSize) * (stepSize) + 2 * (order) + 1)
+
+/**
+   * @brief Instance structure for the floating point block (state-space) IIR filter.
+   */
+typedef struct
+{
+    ne10_uint16_t numSections;  /**< number of state-space sections in the cascade. */
+    ne10_uint16_t order;        /**< number of state variables of each section. */
+    ne10_uint16_t stepSize;     /**< number of samples computed per look-ahead step, 4 or 8. */
+    ne10_float32_t *pState;     /**< Points to the state variable array. The array is of length (numSections+1)*order. */
+    ne10_float32_t *pCoeffs;    /**< Points to the precomputed matrix array. The array is of length numSections*NE10_IIR_BLOCK_COEFFS_LEN(order, stepSize). */
+} ne10_iir_block_instance_f32_t;
+
+/**
+   * @brief Instance structure for the floating point normalized LMS filter.
+   */
+typedef struct
+{
+    ne10_uint16_t numTaps;      /**< Number of coefficients in the filter. */
+    ne10_float32_t *pState;     /**< Points to the state variable array. The array is of length numTaps+blockSize-1. */
+    ne10_float32_t *pCoeffs;    /**< Points to the coefficient array, in time reversed order. The array is of length numTaps. */
+    ne10_float32_t mu;          /**< Step size. */
+    ne10_float32_t energy;      /**< Energy of the samples in the filter window. */
+    ne10_float32_t x0;          /**< Oldest sample of the filter window. */
+} ne10_lms_norm_instance_f32_t;
+
+/**
+   * @brief Instance structure for the Q31 normalized LMS filter.
+   */
+typedef struct
+{
+    ne10_uint16_t numTaps;      /**< Number of coefficients in the filter. */
+    ne10_int32_t *pState;       /**< Points to the state variable array. The array is of length numTaps+blockSize-1. */
+    ne10_int32_t *pCoeffs;      /**< Points to the coefficient array, in time reversed order, scaled by 2^-postShift. */
+    ne10_int32_t mu;            /**< Step size in Q31. */
+    ne10_uint8_t postShift;     /**< Left shift applied to the filter output. */
+    ne10_int64_t energy;        /**< Energy of the samples in the filter window, in Q31. */
+    ne10_int32_t x0;            /**< Oldest sample of the filter window. */
+} ne10_lms_norm_instance_int32_t;
+
+/**
+   * @brief Instance structure for the floating point frequency domain block LMS filter.
+   */
+#define NE10_LMS_FD_STATE_LEN(numTaps) (9 * (numTaps) + 5)
+typedef struct
+{
+    ne10_uint16_t numTaps;              /**< Number of coefficients, also the block length. The FFT length is 2*numTaps. */
+    ne10_uint8_t powerValid;            /**< Whether pState holds a bin power estimate. */
+    ne10_float32_t mu;                  /**< Step size. */
+    ne10_float32_t beta;                /**< Forgetting factor of the bin power estimate. */
+    ne10_fft_r2c_cfg_float32_t cfg;     /**< Real FFT configuration of length 2*numTaps. */
+    ne10_fft_cpx_float32_t *pCoeffs;    /**< Points to the frequency domain coefficients. The array is of length numTaps+1. */
+    ne10_float32_t *pState;             /**< Points to the state array. The array is of length NE10_LMS_FD_STATE_LEN(numTaps). */
+} ne10_lms_fd_instance_f32_t;
+
+/**
+ * @brief Output ranges and options of the cross-correlation and auto-correlation functions.
+ */
+#define NE10_CORR_FULL              0   /**< All srcALen+srcBLen-1 lags. */
+#define NE10_CORR_SAME              1   /**< max(srcALen, srcBLen) lags around the centre of the full output. */
+#define NE10_CORR_VALID             2   /**< The max(srcALen, srcBLen)-min(srcALen, srcBLen)+1 lags without zero padding. */
+
+#define NE10_CORR_NORMALIZE         1   /**< Divide by the geometric mean of the signal energies. */
+#define NE10_CORR_FORCE_DIRECT      2   /**< Always use the direct method. */
+#define NE10_CORR_FORCE_FFT         4   /**< Always use the FFT method. */
+
+/**
+ * @brief Configuration of a cross-correlation or auto-correlation of fixed lengths.
+ */
+typedef struct
+{
+    ne10_uint32_t srcALen;              /**< Length of the first signal. */
+    ne10_uint32_t srcBLen;              /**< Length of the second signal, or maxLag+1 for auto-correlation. */
+    ne10_uint32_t outOffset;            /**< Index of the first output in the full correlation. */
+    ne10_uint32_t outLen;               /**< Number of outputs. */
+    ne10_uint32_t flags;                /**< NE10_CORR_NORMALIZE and the method options. */
+    ne10_uint32_t nfft;                 /**< Length of the FFT, 0 when the direct method is used. */
+    ne10_fft_r2c_cfg_float32_t fftCfg;  /**< Real FFT configuration of length nfft, NULL for the direct method. */
+    ne10_float32_t *pBuffer;            /**< Points to the work buffer. */
+} ne10_corr_state_float32_t;
+
+typedef ne10_corr_state_float32_t* ne10_corr_cfg_float32_t;
+
+/**
+ * @brief Analysis and synthesis windows of the short-time Fourier transform.
+ */
+#define NE10_WINDOW_HANN            0   /**< 0.5 - 0.5 * cos(2 * pi * n / N) */
+#define NE10_WINDOW_HAMMING         1   /**< 0.54 - 0.46 * cos(2 * pi * n / N) */
+#define NE10_WINDOW_BLACKMAN        2   /**< 0.42 - 0.5 * cos(2 * pi * n / N) + 0.08 * cos(4 * pi * n / N) */
+#define NE10_WINDOW_KAISER          3   /**< I0(beta * sqrt(1 - (2 * n / N - 1)^2)) / I0(beta) */
+#define NE10_WINDOW_CUSTOM          4   /**< Window supplied by the caller. */
+
+/**
+ * @brief State of a streaming short-time Fourier transform or of its inverse.
+ */
+typedef struct
+{
+    ne10_uint32_t frameLen;                 /**< Length of the frames and of the FFT. */
+    ne10_uint32_t hopSize;                  /**< Distance between the starts of consecutive frames. */
+    ne10_uint32_t numFrames;                /**< Capacity of the spectrum ring, 0 for the inverse transform. */
+    ne10_uint32_t readIndex;                /**< Ring slot of the oldest spectrum. */
+    ne10_uint32_t count;                    /**< Number of spectra in the ring. */
+    ne10_uint32_t histStart;                /**< Start of the next frame in the input history. */
+    ne10_uint32_t histEnd;                  /**< End of the buffered input in the input history. */
+    ne10_fft_r2c_cfg_float32_t fftCfg;      /**< Real FFT configuration of length frameLen. */
+    ne10_float32_t *pWindow;                /**< Points to the window. The array is of length frameLen. */
+    ne10_float32_t *pBuffer;                /**< Points to the input history of length 2*frameLen, or the overlap-add accumulator of length frameLen. */
+    ne10_float32_t *pFrame;                 /**< Points to the windowed frame. The array is of length frameLen. */
+    ne10_float32_t *pNorm;                  /**< Points to the hopSize overlap-add gains of the inverse transform. */
+    ne10_fft_cpx_float32_t *pSpectra;       /**< Points to the ring of numFrames spectra of frameLen/2+1 bins. */
+} ne10_stft_state_float32_t;
+
+typedef ne10_stft_state_float32_t* ne10_stft_cfg_float32_t;
+
+/** Smallest mel energy whose logarithm the MFCC functions take. */
+#define NE10_MFCC_LOG_FLOOR         1e-10f
+
+/**
+ * @brief Configuration of the mel filterbank and MFCC feature extraction.
+ */
+typedef struct
+{
+    ne10_uint32_t fftLen;                   /**< Length of the real FFT whose output is processed. */
+    ne10_uint32_t numMels;                  /**< Number of mel bands. */
+    ne10_uint32_t numCeps;                  /**< Number of cepstral coefficients. */
+    ne10_uint16_t *pBandStart;              /**< Points to the first FFT bin of each band. */
+    ne10_uint16_t *pBandLen;                /**< Points to the number of bins of each band. */
+    ne10_float32_t *pWeights;               /**< Points to the nonzero triangle weights of all bands, one band after the other. */
+    ne10_float32_t *pDct;                   /**< Points to the numCeps x numMels orthonormal DCT-II table. */
+    ne10_float32_t *pPower;                 /**< Points to the power spectrum scratch of fftLen/2+1 bins. */
+    ne10_float32_t *pLogMel;                /**< Points to the log mel energy scratch of numMels bands. */
+} ne10_mfcc_state_float32_t;
+
+typedef ne10_mfcc_state_float32_t* ne10_mfcc_cfg_float32_t;
+
+/**
+ * @brief Configuration of the DCT-II, DCT-III and DCT-IV.
+ */
+typedef struct
+{
+    ne10_uint32_t nfft;                     /**< Length N of the transforms, a power of 2. */
+    ne10_fft_cpx_float32_t *pTwiddle2;      /**< Points to exp(-i*pi*k/(2N)), k = 0 .. N/2, of the DCT-II and DCT-III. */
+    ne10_fft_cpx_float32_t *pTwiddle4;      /**< Points to the N/2 pre-twiddles exp(-i*pi*(4n+1)/(4N)) and N/2 post-twiddles exp(-i*pi*k/N) of the DCT-IV. */
+    ne10_fft_cpx_float32_t *pCpxBuffer;     /**< Points to the complex scratch of N bins. */
+    ne10_float32_t *pBuffer;                /**< Points to the real scratch of N samples. */
+    ne10_fft_r2c_cfg_float32_t r2cCfg;      /**< Real FFT configuration of length N. */
+    ne10_fft_cfg_float32_t c2cCfg;          /**< Complex FFT configuration of length N/2 for the C DCT-IV. */
+    ne10_fft_cfg_float32_t c2cCfgNeon;      /**< Complex FFT configuration of length N/2 for the NEON DCT-IV. */
+} ne10_dct_state_float32_t;
+
+typedef ne10_dct_state_float32_t* ne10_dct_cfg_float32_t;
+
+/**
+ * @brief Configuration of the windowed MDCT and IMDCT.
+ */
+typedef struct
+{
+    ne10_uint32_t nfft;                     /**< Number N of coefficients; blocks are 2N samples long. */
+    ne10_float32_t *pWindow;                /**< Points to the 2N window coefficients. */
+    ne10_float32_t *pOverlap;               /**< Points to the N samples of the previous IMDCT block still to be added. */
+    ne10_float32_t *pBuffer;                /**< Points to the scratch of 2N samples. */
+    ne10_dct_cfg_float32_t dctCfg;          /**< DCT-IV configuration of length N. */
+} ne10_mdct_state_float32_t;
+
+typedef ne10_mdct_state_float32_t* ne10_mdct_cfg_float32_t;
+
+/** Number of input samples the sliding DFT processes per pass over its bins. */
+#define NE10_SDFT_BLOCK_LEN         64
+/** Damping factor r per sample that keeps the rounding errors of the sliding DFT from accumulating. */
+#define NE10_SDFT_DAMPING           0.9999999
+
+/**
+ * @brief Configuration of a bank of Goertzel filters.
+ *
+ * The per-bin arrays are padded with zeros to a multiple of 4 bins.
+ */
+typedef struct
+{
+    ne10_uint32_t numBins;                  /**< Number of bins evaluated. */
+    ne10_uint32_t blockLen;                 /**< Number of samples of each evaluation. */
+    ne10_uint32_t count;                    /**< Number of samples of the current block processed so far. */
+    ne10_float32_t *pCoeff;                 /**< Points to the coefficients 2*cos(2*pi*f) of the bins. */
+    ne10_float32_t *pState;                 /**< Points to the last outputs s[n-1] of the bins, followed by s[n-2]. */
+} ne10_goertzel_state_float32_t;
+
+typedef ne10_goertzel_state_float32_t* ne10_goertzel_cfg_float32_t;
+
+/**
+ * @brief Configuration of a sliding DFT over a set of bins.
+ *
+ * The per-bin arrays are padded with zeros to a multiple of 4 bins.
+ */
+typedef struct
+{
+    ne10_uint32_t numBins;                  /**< Number of bins evaluated. */
+    ne10_uint32_t windowLen;                /**< Length N of the sliding window. */
+    ne10_uint32_t delayIndex;               /**< Index of the oldest sample in the delay line. */
+    ne10_float32_t dampingN;                /**< Damping factor raised to the power N. */
+    ne10_float32_t *pTwiddle;               /**< Points to the real parts of the damped twiddles r*exp(2*pi*i*k/N), followed by the imaginary parts. */
+    ne10_float32_t *pBins;                  /**< Points to the real parts of the bins, followed by the imaginary parts. */
+    ne10_float32_t *pDelay;                 /**< Points to the delay line of N samples. */
+    ne10_float32_t *pDelta;                 /**< Points to the scratch of NE10_SDFT_BLOCK_LEN input differences. */
+} ne10_sdft_state_float32_t;
+
+typedef ne10_sdft_state_float32_t* ne10_sdft_cfg_float32_t;
+
 /////////////////////////////////////////////////////////
 // definitions for imgproc module
 /////////////////////////////////////////////////////////
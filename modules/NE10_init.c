@@ -41,6 +41,14 @@ ne10_result_t ne10_HasNEON()
     return is_NEON_available;
 }
 
+// This local variable indicates whether or not the running platform supports the ARMv8.2 dot product instructions
+static ne10_result_t is_DOTPROD_available = NE10_ERR;
+
+ne10_result_t ne10_HasDotProd()
+{
+    return is_DOTPROD_available;
+}
+
 ne10_result_t ne10_init()
 {
     ne10_result_t status = NE10_ERR;
@@ -79,6 +87,12 @@ ne10_result_t ne10_init()
     {
         is_NEON_available = NE10_OK;
     }
+
+    // AArch64 kernels list the dot product extension as "asimddp"
+    if (strstr ((const char *)cpuinfo, "asimddp") != NULL)
+    {
+        is_DOTPROD_available = NE10_OK;
+    }
 #else  //__MACH__
     is_NEON_available = NE10_OK;
 #endif //__MACH__
@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * NE10 Library : NE10_memory.c
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "NE10.h"
+
+static void * ne10_default_malloc (ne10_uint32_t size, void * ctx)
+{
+    (void) ctx;
+    return malloc (size);
+}
+
+static void ne10_default_free (void * ptr, void * ctx)
+{
+    (void) ctx;
+    free (ptr);
+}
+
+// The allocator behind NE10_MALLOC and NE10_FREE
+static ne10_malloc_func_t ne10_malloc_func = ne10_default_malloc;
+static ne10_free_func_t ne10_free_func = ne10_default_free;
+static void * ne10_allocator_ctx = NULL;
+
+ne10_result_t ne10_set_allocator (ne10_malloc_func_t alloc_func, ne10_free_func_t free_func, void * ctx)
+{
+    if (!alloc_func && !free_func)
+    {
+        ne10_malloc_func = ne10_default_malloc;
+        ne10_free_func = ne10_default_free;
+        ne10_allocator_ctx = NULL;
+        return NE10_OK;
+    }
+    if (!alloc_func || !free_func)
+    {
+        return NE10_ERR;
+    }
+
+    ne10_malloc_func = alloc_func;
+    ne10_free_func = free_func;
+    ne10_allocator_ctx = ctx;
+    return NE10_OK;
+}
+
+void * ne10_malloc (ne10_uint32_t size)
+{
+    return ne10_malloc_func (size, ne10_allocator_ctx);
+}
+
+void ne10_free (void * ptr)
+{
+    if (ptr)
+    {
+        ne10_free_func (ptr, ne10_allocator_ctx);
+    }
+}
+
+/*
+ * The block is over-allocated so that it can be moved up to the next
+ * NE10_MALLOC_ALIGNMENT boundary, and the pointer returned by NE10_MALLOC is
+ * kept just below the aligned address for ne10_free_aligned.
+ */
+void * ne10_malloc_aligned (ne10_uint32_t size)
+{
+    ne10_uint8_t * raw;
+    uintptr_t address;
+    ne10_uint32_t padded;
+
+    // the padding below must not wrap around
+    if (size > UINT32_MAX - 2 * NE10_MALLOC_ALIGNMENT - sizeof (void *))
+    {
+        return NULL;
+    }
+    padded = (size + (NE10_MALLOC_ALIGNMENT - 1)) & ~ (NE10_MALLOC_ALIGNMENT - 1);
+
+    raw = (ne10_uint8_t *) NE10_MALLOC (padded + NE10_MALLOC_ALIGNMENT + sizeof (void *));
+    if (!raw)
+    {
+        return NULL;
+    }
+
+    address = (uintptr_t) (raw + sizeof (void *));
+    NE10_BYTE_ALIGNMENT (address, NE10_MALLOC_ALIGNMENT);
+    ((void **) address)[-1] = raw;
+    return (void *) address;
+}
+
+void ne10_free_aligned (void * ptr)
+{
+    void * raw;
+
+    if (!ptr)
+    {
+        return;
+    }
+    raw = ((void **) ptr)[-1];
+    NE10_FREE (raw);
+}
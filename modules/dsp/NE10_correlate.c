@@ -0,0 +1,548 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_correlate.c
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_dsp.h"
+
+/**
+ * @ingroup groupDSPs
+ */
+
+/**
+ * @defgroup Correlation Cross-Correlation and Auto-Correlation
+ *
+ * \par
+ * These functions compute the cross-correlation of two signals, as used in time delay estimation, and
+ * the auto-correlation of one signal, as used in pitch detection and linear prediction:
+ * <pre>
+ *    c[j] = sum_n a[n + j - (srcBLen-1)] * b[n],   0 <= j < srcALen+srcBLen-1
+ *    r[k] = sum_n x[n] * x[n + k],                 0 <= k <= maxLag
+ * </pre>
+ * where samples outside the signals are zero, so <code>c[srcBLen-1]</code> is the correlation at lag 0.
+ * <code>NE10_CORR_FULL</code> returns all lags, <code>NE10_CORR_SAME</code> the <code>max(srcALen, srcBLen)</code>
+ * central ones and <code>NE10_CORR_VALID</code> only the lags where the shorter signal fully overlaps the longer
+ * one, with the same ranges as the usual <code>full/same/valid</code> modes. With <code>NE10_CORR_NORMALIZE</code>
+ * the cross-correlation is divided by <code>sqrt(sum(a^2) * sum(b^2))</code> and the auto-correlation by
+ * <code>r[0]</code>, so the outputs are in <code>[-1, 1]</code>.
+ * \par
+ * The sizes are fixed when the configuration is allocated with @ref ne10_corr_alloc_float32 or
+ * @ref ne10_autocorr_alloc_float32, which also chooses the method. The direct method costs one multiply-accumulate
+ * per output and overlapping sample. The FFT method zero-pads both signals to a power of 2 <code>nfft</code> at
+ * least as long as the linear correlation and costs three real FFTs. The FFT method is chosen when the direct cost is
+ * larger than <code>NE10_CORR_FFT_COST_FACTOR * nfft * log2(nfft)</code>. The performance test of this module times
+ * both methods around the crossover, so the factor can be tuned for a given core; <code>NE10_CORR_FORCE_DIRECT</code>
+ * and <code>NE10_CORR_FORCE_FFT</code> override the choice. A configuration can be used with both the float and
+ * the Q15 functions and is freed with @ref ne10_corr_destroy_float32.
+ *
+ * \par Q15
+ * @ref ne10_correlate_int16 and @ref ne10_autocorr_int16 take Q15 signals. The direct method accumulates the
+ * products in 64 bits and rounds the sums to Q15, the FFT method computes in floating point. The outputs saturate.
+ */
+
+/**
+ * @addtogroup Correlation
+ * @{
+ */
+
+/* Direct multiply-accumulates per FFT butterfly operation above which the FFT method is used */
+#define NE10_CORR_FFT_COST_FACTOR   (6)
+
+static ne10_corr_cfg_float32_t ne10_corr_alloc (ne10_uint32_t srcALen,
+        ne10_uint32_t srcBLen,
+        ne10_uint32_t outOffset,
+        ne10_uint32_t outLen,
+        ne10_uint32_t linearLen,
+        ne10_uint64_t directCost,
+        ne10_uint32_t flags)
+{
+    ne10_corr_cfg_float32_t st;
+    ne10_uint32_t nfft = 32;
+    ne10_uint32_t log2nfft = 5;
+    ne10_uint32_t bufferLen;
+    ne10_int32_t useFft;
+
+    while (nfft < linearLen)
+    {
+        nfft <<= 1;
+        log2nfft++;
+    }
+
+    if (flags & NE10_CORR_FORCE_FFT)
+    {
+        useFft = 1;
+    }
+    else if (flags & NE10_CORR_FORCE_DIRECT)
+    {
+        useFft = 0;
+    }
+    else
+    {
+        useFft = directCost > (ne10_uint64_t) NE10_CORR_FFT_COST_FACTOR * nfft * log2nfft;
+    }
+
+    /* Two real signals and two spectra for the FFT method, one zero-padded signal for the direct one */
+    bufferLen = useFft ? (4 * nfft + 4) : (srcALen + 2 * srcBLen + 4);
+
+    st = (ne10_corr_cfg_float32_t) NE10_MALLOC (sizeof (ne10_corr_state_float32_t) + bufferLen * sizeof (ne10_float32_t));
+    if (st == NULL)
+    {
+        return NULL;
+    }
+
+    st->srcALen = srcALen;
+    st->srcBLen = srcBLen;
+    st->outOffset = outOffset;
+    st->outLen = outLen;
+    st->flags = flags;
+    st->nfft = 0;
+    st->fftCfg = NULL;
+    st->pBuffer = (ne10_float32_t *) (st + 1);
+
+    if (useFft)
+    {
+        st->fftCfg = ne10_fft_alloc_r2c_float32 (nfft);
+        if (st->fftCfg == NULL)
+        {
+            NE10_FREE (st);
+            return NULL;
+        }
+        st->nfft = nfft;
+    }
+    return st;
+}
+
+/**
+ * @brief Allocates the configuration of a cross-correlation.
+ * @param[in]   srcALen    length of the first signal.
+ * @param[in]   srcBLen    length of the second signal.
+ * @param[in]   mode       NE10_CORR_FULL, NE10_CORR_SAME or NE10_CORR_VALID.
+ * @param[in]   flags      NE10_CORR_NORMALIZE, optionally with NE10_CORR_FORCE_DIRECT or NE10_CORR_FORCE_FFT.
+ * @return      the configuration, or NULL if a length is zero, the mode is unknown or the memory allocation fails.
+ */
+ne10_corr_cfg_float32_t ne10_corr_alloc_float32 (ne10_uint32_t srcALen,
+        ne10_uint32_t srcBLen,
+        ne10_uint32_t mode,
+        ne10_uint32_t flags)
+{
+    ne10_uint32_t minLen = (srcALen < srcBLen) ? srcALen : srcBLen;
+    ne10_uint32_t maxLen = (srcALen < srcBLen) ? srcBLen : srcALen;
+    ne10_uint32_t outOffset, outLen;
+
+    if (minLen == 0)
+    {
+        return NULL;
+    }
+
+    switch (mode)
+    {
+    case NE10_CORR_FULL:
+        outOffset = 0;
+        outLen = srcALen + srcBLen - 1;
+        break;
+    case NE10_CORR_SAME:
+        outOffset = (minLen - 1) / 2;
+        outLen = maxLen;
+        break;
+    case NE10_CORR_VALID:
+        outOffset = minLen - 1;
+        outLen = maxLen - minLen + 1;
+        break;
+    default:
+        return NULL;
+    }
+
+    return ne10_corr_alloc (srcALen, srcBLen, outOffset, outLen, srcALen + srcBLen - 1,
+                            (ne10_uint64_t) outLen * srcBLen, flags);
+}
+
+/**
+ * @brief Allocates the configuration of an auto-correlation.
+ * @param[in]   srcLen     length of the signal.
+ * @param[in]   maxLag     largest lag, smaller than srcLen. The auto-correlation has maxLag+1 outputs.
+ * @param[in]   flags      NE10_CORR_NORMALIZE, optionally with NE10_CORR_FORCE_DIRECT or NE10_CORR_FORCE_FFT.
+ * @return      the configuration, or NULL if maxLag is not smaller than srcLen or the memory allocation fails.
+ */
+ne10_corr_cfg_float32_t ne10_autocorr_alloc_float32 (ne10_uint32_t srcLen,
+        ne10_uint32_t maxLag,
+        ne10_uint32_t flags)
+{
+    if (maxLag >= srcLen)
+    {
+        return NULL;
+    }
+    return ne10_corr_alloc (srcLen, maxLag + 1, 0, maxLag + 1, srcLen + maxLag,
+                            (ne10_uint64_t) srcLen * (maxLag + 1), flags);
+}
+
+/**
+ * @brief Frees a configuration allocated by @ref ne10_corr_alloc_float32 or @ref ne10_autocorr_alloc_float32.
+ */
+void ne10_corr_destroy_float32 (ne10_corr_cfg_float32_t cfg)
+{
+    if (cfg == NULL)
+    {
+        return;
+    }
+    ne10_fft_destroy_r2c_float32 (cfg->fftCfg);
+    NE10_FREE (cfg);
+}
+
+static inline ne10_int16_t ne10_corr_sat_q15 (ne10_int64_t x)
+{
+    if (x > 0x7fff)
+    {
+        return 0x7fff;
+    }
+    if (x < -0x8000)
+    {
+        return -0x8000;
+    }
+    return (ne10_int16_t) x;
+}
+
+static inline ne10_int16_t ne10_corr_float_to_q15 (ne10_float32_t x)
+{
+    x *= 32768.0f;
+    if (x >= 32767.0f)
+    {
+        return 0x7fff;
+    }
+    if (x <= -32768.0f)
+    {
+        return -0x8000;
+    }
+    return (ne10_int16_t) floorf (x + 0.5f);
+}
+
+/* Cross-correlation through the spectrum A * conj(B). The results are left at pBuffer[0..nfft-1] */
+static void ne10_corr_fft_c (ne10_corr_cfg_float32_t cfg, ne10_uint32_t autocorr)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+    ne10_uint32_t numBins = nfft / 2 + 1;
+    ne10_float32_t *pA = cfg->pBuffer;
+    ne10_float32_t *pB = pA + nfft;
+    ne10_fft_cpx_float32_t *pAf = (ne10_fft_cpx_float32_t *) (pB + nfft);
+    ne10_fft_cpx_float32_t *pBf = pAf + numBins;
+    ne10_float32_t re, im;
+    ne10_uint32_t i;
+
+    ne10_fft_r2c_1d_float32_c (pAf, pA, cfg->fftCfg);
+    if (autocorr)
+    {
+        for (i = 0; i < numBins; i++)
+        {
+            pAf[i].r = pAf[i].r * pAf[i].r + pAf[i].i * pAf[i].i;
+            pAf[i].i = 0.0f;
+        }
+    }
+    else
+    {
+        ne10_fft_r2c_1d_float32_c (pBf, pB, cfg->fftCfg);
+        for (i = 0; i < numBins; i++)
+        {
+            re = pAf[i].r * pBf[i].r + pAf[i].i * pBf[i].i;
+            im = pAf[i].i * pBf[i].r - pAf[i].r * pBf[i].i;
+            pAf[i].r = re;
+            pAf[i].i = im;
+        }
+    }
+    ne10_fft_c2r_1d_float32_c (pA, pAf, cfg->fftCfg);
+}
+
+/* Copies a signal to the start of an nfft buffer, followed by zeros */
+static void ne10_corr_load_float (ne10_float32_t * pDst, const ne10_float32_t * pSrc, ne10_uint32_t srcLen, ne10_uint32_t nfft)
+{
+    memcpy (pDst, pSrc, srcLen * sizeof (ne10_float32_t));
+    memset (pDst + srcLen, 0, (nfft - srcLen) * sizeof (ne10_float32_t));
+}
+
+static void ne10_corr_load_int16 (ne10_float32_t * pDst, const ne10_int16_t * pSrc, ne10_uint32_t srcLen, ne10_uint32_t nfft)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < srcLen; i++)
+    {
+        pDst[i] = (ne10_float32_t) pSrc[i] * (1.0f / 32768.0f);
+    }
+    memset (pDst + srcLen, 0, (nfft - srcLen) * sizeof (ne10_float32_t));
+}
+
+/**
+ * @brief Cross-correlation of floating-point signals.
+ * @param[in]   cfg        configuration from @ref ne10_corr_alloc_float32.
+ * @param[out]  *pDst      points to the <code>cfg->outLen</code> outputs.
+ * @param[in]   *pSrcA     points to the first signal, of length <code>srcALen</code>.
+ * @param[in]   *pSrcB     points to the second signal, of length <code>srcBLen</code>.
+ */
+void ne10_correlate_float_c (ne10_corr_cfg_float32_t cfg,
+                             ne10_float32_t * pDst,
+                             ne10_float32_t * pSrcA,
+                             ne10_float32_t * pSrcB)
+{
+    ne10_int32_t srcALen = cfg->srcALen;
+    ne10_int32_t srcBLen = cfg->srcBLen;
+    ne10_int32_t lag, n, nStart, nEnd;
+    ne10_uint32_t j;
+    ne10_float32_t acc, energyA, energyB, scale;
+
+    if (cfg->nfft)
+    {
+        ne10_corr_load_float (cfg->pBuffer, pSrcA, srcALen, cfg->nfft);
+        ne10_corr_load_float (cfg->pBuffer + cfg->nfft, pSrcB, srcBLen, cfg->nfft);
+        ne10_corr_fft_c (cfg, 0);
+        for (j = 0; j < cfg->outLen; j++)
+        {
+            lag = (ne10_int32_t) (cfg->outOffset + j) - (srcBLen - 1);
+            pDst[j] = cfg->pBuffer[ (lag + (ne10_int32_t) cfg->nfft) & (cfg->nfft - 1)];
+        }
+    }
+    else
+    {
+        for (j = 0; j < cfg->outLen; j++)
+        {
+            lag = (ne10_int32_t) (cfg->outOffset + j) - (srcBLen - 1);
+            nStart = (lag < 0) ? -lag : 0;
+            nEnd = (srcALen - lag < srcBLen) ? (srcALen - lag) : srcBLen;
+            acc = 0.0f;
+            for (n = nStart; n < nEnd; n++)
+            {
+                acc += pSrcA[n + lag] * pSrcB[n];
+            }
+            pDst[j] = acc;
+        }
+    }
+
+    if (cfg->flags & NE10_CORR_NORMALIZE)
+    {
+        energyA = 0.0f;
+        energyB = 0.0f;
+        for (n = 0; n < srcALen; n++)
+        {
+            energyA += pSrcA[n] * pSrcA[n];
+        }
+        for (n = 0; n < srcBLen; n++)
+        {
+            energyB += pSrcB[n] * pSrcB[n];
+        }
+        /* the product of the energies over- or underflows in single precision for large or tiny signals */
+        if ( (energyA > 0.0f) && (energyB > 0.0f))
+        {
+            scale = (ne10_float32_t) (1.0 / sqrt ( (ne10_float64_t) energyA * (ne10_float64_t) energyB));
+        }
+        else
+        {
+            scale = 0.0f;
+        }
+        for (j = 0; j < cfg->outLen; j++)
+        {
+            pDst[j] *= scale;
+        }
+    }
+}
+
+/**
+ * @brief Auto-correlation of a floating-point signal.
+ * @param[in]   cfg        configuration from @ref ne10_autocorr_alloc_float32.
+ * @param[out]  *pDst      points to the <code>maxLag+1</code> outputs.
+ * @param[in]   *pSrc      points to the signal, of length <code>srcLen</code>.
+ */
+void ne10_autocorr_float_c (ne10_corr_cfg_float32_t cfg,
+                            ne10_float32_t * pDst,
+                            ne10_float32_t * pSrc)
+{
+    ne10_uint32_t srcLen = cfg->srcALen;
+    ne10_uint32_t k, n;
+    ne10_float32_t acc, scale;
+
+    if (cfg->nfft)
+    {
+        ne10_corr_load_float (cfg->pBuffer, pSrc, srcLen, cfg->nfft);
+        ne10_corr_fft_c (cfg, 1);
+        memcpy (pDst, cfg->pBuffer, cfg->outLen * sizeof (ne10_float32_t));
+    }
+    else
+    {
+        for (k = 0; k < cfg->outLen; k++)
+        {
+            acc = 0.0f;
+            for (n = 0; n + k < srcLen; n++)
+            {
+                acc += pSrc[n] * pSrc[n + k];
+            }
+            pDst[k] = acc;
+        }
+    }
+
+    if (cfg->flags & NE10_CORR_NORMALIZE)
+    {
+        scale = (pDst[0] > 0.0f) ? 1.0f / pDst[0] : 0.0f;
+        for (k = 0; k < cfg->outLen; k++)
+        {
+            pDst[k] *= scale;
+        }
+    }
+}
+
+/**
+ * @brief Cross-correlation of Q15 signals.
+ * @param[in]   cfg        configuration from @ref ne10_corr_alloc_float32.
+ * @param[out]  *pDst      points to the <code>cfg->outLen</code> Q15 outputs.
+ * @param[in]   *pSrcA     points to the first signal, of length <code>srcALen</code>.
+ * @param[in]   *pSrcB     points to the second signal, of length <code>srcBLen</code>.
+ */
+void ne10_correlate_int16_c (ne10_corr_cfg_float32_t cfg,
+                             ne10_int16_t * pDst,
+                             ne10_int16_t * pSrcA,
+                             ne10_int16_t * pSrcB)
+{
+    ne10_int32_t srcALen = cfg->srcALen;
+    ne10_int32_t srcBLen = cfg->srcBLen;
+    ne10_int32_t lag, n, nStart, nEnd;
+    ne10_uint32_t j;
+    ne10_int64_t acc, energyA = 0, energyB = 0;
+    ne10_float32_t scale = 1.0f;
+
+    if (cfg->flags & NE10_CORR_NORMALIZE)
+    {
+        for (n = 0; n < srcALen; n++)
+        {
+            energyA += (ne10_int32_t) pSrcA[n] * pSrcA[n];
+        }
+        for (n = 0; n < srcBLen; n++)
+        {
+            energyB += (ne10_int32_t) pSrcB[n] * pSrcB[n];
+        }
+        /* each energy can reach srcLen * 2^30, so the product is only formed in double */
+        if ( (energyA > 0) && (energyB > 0))
+        {
+            scale = (ne10_float32_t) (1.0 / sqrt ( (ne10_float64_t) energyA * (ne10_float64_t) energyB));
+        }
+        else
+        {
+            scale = 0.0f;
+        }
+    }
+
+    if (cfg->nfft)
+    {
+        ne10_corr_load_int16 (cfg->pBuffer, pSrcA, srcALen, cfg->nfft);
+        ne10_corr_load_int16 (cfg->pBuffer + cfg->nfft, pSrcB, srcBLen, cfg->nfft);
+        ne10_corr_fft_c (cfg, 0);
+        /* The energies are in Q30 and the spectra in floating point */
+        scale *= (cfg->flags & NE10_CORR_NORMALIZE) ? 1073741824.0f : 1.0f;
+        for (j = 0; j < cfg->outLen; j++)
+        {
+            lag = (ne10_int32_t) (cfg->outOffset + j) - (srcBLen - 1);
+            pDst[j] = ne10_corr_float_to_q15 (cfg->pBuffer[ (lag + (ne10_int32_t) cfg->nfft) & (cfg->nfft - 1)] * scale);
+        }
+    }
+    else
+    {
+        for (j = 0; j < cfg->outLen; j++)
+        {
+            lag = (ne10_int32_t) (cfg->outOffset + j) - (srcBLen - 1);
+            nStart = (lag < 0) ? -lag : 0;
+            nEnd = (srcALen - lag < srcBLen) ? (srcALen - lag) : srcBLen;
+            acc = 0;
+            for (n = nStart; n < nEnd; n++)
+            {
+                acc += (ne10_int32_t) pSrcA[n + lag] * pSrcB[n];
+            }
+            if (cfg->flags & NE10_CORR_NORMALIZE)
+            {
+                pDst[j] = ne10_corr_float_to_q15 ( (ne10_float32_t) acc * scale);
+            }
+            else
+            {
+                pDst[j] = ne10_corr_sat_q15 ( (acc + 0x4000) >> 15);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Auto-correlation of a Q15 signal.
+ * @param[in]   cfg        configuration from @ref ne10_autocorr_alloc_float32.
+ * @param[out]  *pDst      points to the <code>maxLag+1</code> Q15 outputs.
+ * @param[in]   *pSrc      points to the signal, of length <code>srcLen</code>.
+ */
+void ne10_autocorr_int16_c (ne10_corr_cfg_float32_t cfg,
+                            ne10_int16_t * pDst,
+                            ne10_int16_t * pSrc)
+{
+    ne10_uint32_t srcLen = cfg->srcALen;
+    ne10_uint32_t k, n;
+    ne10_int64_t acc, energy = 0;
+    ne10_float32_t scale;
+
+    if (cfg->nfft)
+    {
+        ne10_corr_load_int16 (cfg->pBuffer, pSrc, srcLen, cfg->nfft);
+        ne10_corr_fft_c (cfg, 1);
+        scale = 1.0f;
+        if (cfg->flags & NE10_CORR_NORMALIZE)
+        {
+            scale = (cfg->pBuffer[0] > 0.0f) ? 1.0f / cfg->pBuffer[0] : 0.0f;
+        }
+        for (k = 0; k < cfg->outLen; k++)
+        {
+            pDst[k] = ne10_corr_float_to_q15 (cfg->pBuffer[k] * scale);
+        }
+        return;
+    }
+
+    for (n = 0; n < srcLen; n++)
+    {
+        energy += (ne10_int32_t) pSrc[n] * pSrc[n];
+    }
+    scale = (energy > 0) ? 1.0f / (ne10_float32_t) energy : 0.0f;
+    for (k = 0; k < cfg->outLen; k++)
+    {
+        acc = 0;
+        for (n = 0; n + k < srcLen; n++)
+        {
+            acc += (ne10_int32_t) pSrc[n] * pSrc[n + k];
+        }
+        if (cfg->flags & NE10_CORR_NORMALIZE)
+        {
+            pDst[k] = ne10_corr_float_to_q15 ( (ne10_float32_t) acc * scale);
+        }
+        else
+        {
+            pDst[k] = ne10_corr_sat_q15 ( (acc + 0x4000) >> 15);
+        }
+    }
+}
+/** @} */ //end of Correlation group
@@ -0,0 +1,483 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_correlate.neonintrinsic.c
+ */
+
+#include <arm_neon.h>
+#include <math.h>
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_dsp.h"
+
+/**
+ * @addtogroup Correlation
+ * @{
+ */
+
+static inline ne10_int16_t ne10_corr_sat_q15 (ne10_int64_t x)
+{
+    if (x > 0x7fff)
+    {
+        return 0x7fff;
+    }
+    if (x < -0x8000)
+    {
+        return -0x8000;
+    }
+    return (ne10_int16_t) x;
+}
+
+static inline ne10_int16_t ne10_corr_float_to_q15 (ne10_float32_t x)
+{
+    x *= 32768.0f;
+    if (x >= 32767.0f)
+    {
+        return 0x7fff;
+    }
+    if (x <= -32768.0f)
+    {
+        return -0x8000;
+    }
+    return (ne10_int16_t) floorf (x + 0.5f);
+}
+
+static ne10_float32_t ne10_corr_energy_float_neon (const ne10_float32_t * pSrc, ne10_uint32_t srcLen)
+{
+    float32x4_t q_acc = vdupq_n_f32 (0.0f);
+    float32x4_t q_x;
+    float32x2_t d_acc;
+    ne10_float32_t acc;
+    ne10_uint32_t n;
+
+    for (n = 0; n + 4 <= srcLen; n += 4)
+    {
+        q_x = vld1q_f32 (pSrc + n);
+        q_acc = vmlaq_f32 (q_acc, q_x, q_x);
+    }
+    d_acc = vpadd_f32 (vget_low_f32 (q_acc), vget_high_f32 (q_acc));
+    d_acc = vpadd_f32 (d_acc, d_acc);
+    acc = vget_lane_f32 (d_acc, 0);
+    for (; n < srcLen; n++)
+    {
+        acc += pSrc[n] * pSrc[n];
+    }
+    return acc;
+}
+
+static ne10_int64_t ne10_corr_energy_int16_neon (const ne10_int16_t * pSrc, ne10_uint32_t srcLen)
+{
+    int64x2_t q_acc = vdupq_n_s64 (0);
+    int16x4_t d_x;
+    ne10_int64_t acc;
+    ne10_uint32_t n;
+
+    for (n = 0; n + 4 <= srcLen; n += 4)
+    {
+        d_x = vld1_s16 (pSrc + n);
+        q_acc = vpadalq_s32 (q_acc, vmull_s16 (d_x, d_x));
+    }
+    acc = vgetq_lane_s64 (q_acc, 0) + vgetq_lane_s64 (q_acc, 1);
+    for (; n < srcLen; n++)
+    {
+        acc += (ne10_int32_t) pSrc[n] * pSrc[n];
+    }
+    return acc;
+}
+
+/*
+ * pDst[j] = sum_n pB[n] * pPad[n + j] for j < count. Four outputs are computed at once from unaligned loads of the
+ * padded signal, so every coefficient is broadcast once per four outputs. pPad must be readable up to
+ * count + srcBLen + 2.
+ */
+static void ne10_corr_direct_float_neon (ne10_float32_t * pDst,
+        const ne10_float32_t * pPad,
+        const ne10_float32_t * pB,
+        ne10_uint32_t srcBLen,
+        ne10_uint32_t count)
+{
+    float32x4_t q_acc, q_b;
+    ne10_uint32_t j, n;
+    ne10_float32_t acc;
+
+    for (j = 0; j + 4 <= count; j += 4)
+    {
+        const ne10_float32_t *pA = pPad + j;
+        q_acc = vdupq_n_f32 (0.0f);
+        for (n = 0; n + 4 <= srcBLen; n += 4)
+        {
+            q_b = vld1q_f32 (pB + n);
+            q_acc = vmlaq_lane_f32 (q_acc, vld1q_f32 (pA + n), vget_low_f32 (q_b), 0);
+            q_acc = vmlaq_lane_f32 (q_acc, vld1q_f32 (pA + n + 1), vget_low_f32 (q_b), 1);
+            q_acc = vmlaq_lane_f32 (q_acc, vld1q_f32 (pA + n + 2), vget_high_f32 (q_b), 0);
+            q_acc = vmlaq_lane_f32 (q_acc, vld1q_f32 (pA + n + 3), vget_high_f32 (q_b), 1);
+        }
+        for (; n < srcBLen; n++)
+        {
+            q_acc = vmlaq_n_f32 (q_acc, vld1q_f32 (pA + n), pB[n]);
+        }
+        vst1q_f32 (pDst + j, q_acc);
+    }
+    for (; j < count; j++)
+    {
+        acc = 0.0f;
+        for (n = 0; n < srcBLen; n++)
+        {
+            acc += pB[n] * pPad[n + j];
+        }
+        pDst[j] = acc;
+    }
+}
+
+/* Q15 version of ne10_corr_direct_float_neon with 64-bit sums */
+static void ne10_corr_direct_int16_neon (ne10_int64_t * pDst,
+        const ne10_int16_t * pPad,
+        const ne10_int16_t * pB,
+        ne10_uint32_t srcBLen,
+        ne10_uint32_t count)
+{
+    int64x2_t q_acc0, q_acc1;
+    int32x4_t q_p;
+    ne10_uint32_t j, n;
+    ne10_int64_t acc;
+
+    for (j = 0; j + 4 <= count; j += 4)
+    {
+        const ne10_int16_t *pA = pPad + j;
+        q_acc0 = vdupq_n_s64 (0);
+        q_acc1 = vdupq_n_s64 (0);
+        for (n = 0; n < srcBLen; n++)
+        {
+            q_p = vmull_n_s16 (vld1_s16 (pA + n), pB[n]);
+            q_acc0 = vaddw_s32 (q_acc0, vget_low_s32 (q_p));
+            q_acc1 = vaddw_s32 (q_acc1, vget_high_s32 (q_p));
+        }
+        vst1q_s64 (pDst + j, q_acc0);
+        vst1q_s64 (pDst + j + 2, q_acc1);
+    }
+    for (; j < count; j++)
+    {
+        acc = 0;
+        for (n = 0; n < srcBLen; n++)
+        {
+            acc += (ne10_int32_t) pB[n] * pPad[n + j];
+        }
+        pDst[j] = acc;
+    }
+}
+
+static void ne10_corr_fft_neon (ne10_corr_cfg_float32_t cfg, ne10_uint32_t autocorr)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+    ne10_uint32_t numBins = nfft / 2 + 1;
+    ne10_float32_t *pA = cfg->pBuffer;
+    ne10_float32_t *pB = pA + nfft;
+    ne10_fft_cpx_float32_t *pAf = (ne10_fft_cpx_float32_t *) (pB + nfft);
+    ne10_fft_cpx_float32_t *pBf = pAf + numBins;
+    float32x4x2_t q2_a, q2_b, q2_c;
+    ne10_float32_t re, im;
+    ne10_uint32_t i;
+
+    ne10_fft_r2c_1d_float32_neon (pAf, pA, cfg->fftCfg);
+    if (autocorr)
+    {
+        q2_c.val[1] = vdupq_n_f32 (0.0f);
+        for (i = 0; i + 4 <= numBins; i += 4)
+        {
+            q2_a = vld2q_f32 ( (ne10_float32_t *) (pAf + i));
+            q2_c.val[0] = vmlaq_f32 (vmulq_f32 (q2_a.val[0], q2_a.val[0]), q2_a.val[1], q2_a.val[1]);
+            vst2q_f32 ( (ne10_float32_t *) (pAf + i), q2_c);
+        }
+        for (; i < numBins; i++)
+        {
+            pAf[i].r = pAf[i].r * pAf[i].r + pAf[i].i * pAf[i].i;
+            pAf[i].i = 0.0f;
+        }
+    }
+    else
+    {
+        ne10_fft_r2c_1d_float32_neon (pBf, pB, cfg->fftCfg);
+        for (i = 0; i + 4 <= numBins; i += 4)
+        {
+            q2_a = vld2q_f32 ( (ne10_float32_t *) (pAf + i));
+            q2_b = vld2q_f32 ( (ne10_float32_t *) (pBf + i));
+            q2_c.val[0] = vmlaq_f32 (vmulq_f32 (q2_a.val[0], q2_b.val[0]), q2_a.val[1], q2_b.val[1]);
+            q2_c.val[1] = vmlsq_f32 (vmulq_f32 (q2_a.val[1], q2_b.val[0]), q2_a.val[0], q2_b.val[1]);
+            vst2q_f32 ( (ne10_float32_t *) (pAf + i), q2_c);
+        }
+        for (; i < numBins; i++)
+        {
+            re = pAf[i].r * pBf[i].r + pAf[i].i * pBf[i].i;
+            im = pAf[i].i * pBf[i].r - pAf[i].r * pBf[i].i;
+            pAf[i].r = re;
+            pAf[i].i = im;
+        }
+    }
+    ne10_fft_c2r_1d_float32_neon (pA, pAf, cfg->fftCfg);
+}
+
+static void ne10_corr_load_float (ne10_float32_t * pDst, const ne10_float32_t * pSrc, ne10_uint32_t srcLen, ne10_uint32_t nfft)
+{
+    memcpy (pDst, pSrc, srcLen * sizeof (ne10_float32_t));
+    memset (pDst + srcLen, 0, (nfft - srcLen) * sizeof (ne10_float32_t));
+}
+
+static void ne10_corr_load_int16 (ne10_float32_t * pDst, const ne10_int16_t * pSrc, ne10_uint32_t srcLen, ne10_uint32_t nfft)
+{
+    const float32x4_t q_scale = vdupq_n_f32 (1.0f / 32768.0f);
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= srcLen; i += 4)
+    {
+        vst1q_f32 (pDst + i, vmulq_f32 (vcvtq_f32_s32 (vmovl_s16 (vld1_s16 (pSrc + i))), q_scale));
+    }
+    for (; i < srcLen; i++)
+    {
+        pDst[i] = (ne10_float32_t) pSrc[i] * (1.0f / 32768.0f);
+    }
+    memset (pDst + srcLen, 0, (nfft - srcLen) * sizeof (ne10_float32_t));
+}
+
+/* Lays out srcALen samples after lead zeros in a buffer of srcALen+2*srcBLen+4 samples, with zeros after them */
+#define NE10_CORR_PAD(TYPE, pPad, pSrc, srcALen, srcBLen, lead) \
+    do { \
+        memset ((pPad), 0, ((srcALen) + 2 * (srcBLen) + 4) * sizeof (TYPE)); \
+        memcpy ((pPad) + (lead), (pSrc), (srcALen) * sizeof (TYPE)); \
+    } while (0)
+
+/**
+ * Specific implementation of @ref ne10_correlate_float using NEON SIMD capabilities.
+ */
+void ne10_correlate_float_neon (ne10_corr_cfg_float32_t cfg,
+                                ne10_float32_t * pDst,
+                                ne10_float32_t * pSrcA,
+                                ne10_float32_t * pSrcB)
+{
+    ne10_int32_t srcBLen = cfg->srcBLen;
+    ne10_int32_t lag;
+    ne10_uint32_t j;
+    ne10_float32_t energyA, energyB, scale;
+
+    if (cfg->nfft)
+    {
+        ne10_corr_load_float (cfg->pBuffer, pSrcA, cfg->srcALen, cfg->nfft);
+        ne10_corr_load_float (cfg->pBuffer + cfg->nfft, pSrcB, srcBLen, cfg->nfft);
+        ne10_corr_fft_neon (cfg, 0);
+        for (j = 0; j < cfg->outLen; j++)
+        {
+            lag = (ne10_int32_t) (cfg->outOffset + j) - (srcBLen - 1);
+            pDst[j] = cfg->pBuffer[ (lag + (ne10_int32_t) cfg->nfft) & (cfg->nfft - 1)];
+        }
+    }
+    else
+    {
+        NE10_CORR_PAD (ne10_float32_t, cfg->pBuffer, pSrcA, cfg->srcALen, srcBLen, srcBLen - 1);
+        ne10_corr_direct_float_neon (pDst, cfg->pBuffer + cfg->outOffset, pSrcB, srcBLen, cfg->outLen);
+    }
+
+    if (cfg->flags & NE10_CORR_NORMALIZE)
+    {
+        energyA = ne10_corr_energy_float_neon (pSrcA, cfg->srcALen);
+        energyB = ne10_corr_energy_float_neon (pSrcB, srcBLen);
+        /* the product of the energies over- or underflows in single precision for large or tiny signals */
+        if ( (energyA > 0.0f) && (energyB > 0.0f))
+        {
+            scale = (ne10_float32_t) (1.0 / sqrt ( (ne10_float64_t) energyA * (ne10_float64_t) energyB));
+        }
+        else
+        {
+            scale = 0.0f;
+        }
+        for (j = 0; j + 4 <= cfg->outLen; j += 4)
+        {
+            vst1q_f32 (pDst + j, vmulq_n_f32 (vld1q_f32 (pDst + j), scale));
+        }
+        for (; j < cfg->outLen; j++)
+        {
+            pDst[j] *= scale;
+        }
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_autocorr_float using NEON SIMD capabilities.
+ */
+void ne10_autocorr_float_neon (ne10_corr_cfg_float32_t cfg,
+                               ne10_float32_t * pDst,
+                               ne10_float32_t * pSrc)
+{
+    ne10_uint32_t k;
+    ne10_float32_t scale;
+
+    if (cfg->nfft)
+    {
+        ne10_corr_load_float (cfg->pBuffer, pSrc, cfg->srcALen, cfg->nfft);
+        ne10_corr_fft_neon (cfg, 1);
+        memcpy (pDst, cfg->pBuffer, cfg->outLen * sizeof (ne10_float32_t));
+    }
+    else
+    {
+        NE10_CORR_PAD (ne10_float32_t, cfg->pBuffer, pSrc, cfg->srcALen, cfg->srcBLen, 0);
+        ne10_corr_direct_float_neon (pDst, cfg->pBuffer, pSrc, cfg->srcALen, cfg->outLen);
+    }
+
+    if (cfg->flags & NE10_CORR_NORMALIZE)
+    {
+        scale = (pDst[0] > 0.0f) ? 1.0f / pDst[0] : 0.0f;
+        for (k = 0; k + 4 <= cfg->outLen; k += 4)
+        {
+            vst1q_f32 (pDst + k, vmulq_n_f32 (vld1q_f32 (pDst + k), scale));
+        }
+        for (; k < cfg->outLen; k++)
+        {
+            pDst[k] *= scale;
+        }
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_correlate_int16 using NEON SIMD capabilities.
+ */
+void ne10_correlate_int16_neon (ne10_corr_cfg_float32_t cfg,
+                                ne10_int16_t * pDst,
+                                ne10_int16_t * pSrcA,
+                                ne10_int16_t * pSrcB)
+{
+    ne10_int32_t srcBLen = cfg->srcBLen;
+    ne10_int32_t lag;
+    ne10_uint32_t j;
+    ne10_int64_t acc[4];
+    ne10_int16_t *pPad;
+    ne10_int64_t energyA, energyB;
+    ne10_float32_t scale = 1.0f;
+
+    if (cfg->flags & NE10_CORR_NORMALIZE)
+    {
+        /* as in ne10_correlate_int16_c */
+        energyA = ne10_corr_energy_int16_neon (pSrcA, cfg->srcALen);
+        energyB = ne10_corr_energy_int16_neon (pSrcB, srcBLen);
+        if ( (energyA > 0) && (energyB > 0))
+        {
+            scale = (ne10_float32_t) (1.0 / sqrt ( (ne10_float64_t) energyA * (ne10_float64_t) energyB));
+        }
+        else
+        {
+            scale = 0.0f;
+        }
+    }
+
+    if (cfg->nfft)
+    {
+        ne10_corr_load_int16 (cfg->pBuffer, pSrcA, cfg->srcALen, cfg->nfft);
+        ne10_corr_load_int16 (cfg->pBuffer + cfg->nfft, pSrcB, srcBLen, cfg->nfft);
+        ne10_corr_fft_neon (cfg, 0);
+        scale *= (cfg->flags & NE10_CORR_NORMALIZE) ? 1073741824.0f : 1.0f;
+        for (j = 0; j < cfg->outLen; j++)
+        {
+            lag = (ne10_int32_t) (cfg->outOffset + j) - (srcBLen - 1);
+            pDst[j] = ne10_corr_float_to_q15 (cfg->pBuffer[ (lag + (ne10_int32_t) cfg->nfft) & (cfg->nfft - 1)] * scale);
+        }
+        return;
+    }
+
+    /* The Q15 padded signal takes half of the float buffer */
+    pPad = (ne10_int16_t *) cfg->pBuffer;
+    NE10_CORR_PAD (ne10_int16_t, pPad, pSrcA, cfg->srcALen, srcBLen, srcBLen - 1);
+    for (j = 0; j < cfg->outLen; j += 4)
+    {
+        ne10_uint32_t count = (cfg->outLen - j < 4) ? cfg->outLen - j : 4;
+        ne10_uint32_t i;
+        ne10_corr_direct_int16_neon (acc, pPad + cfg->outOffset + j, pSrcB, srcBLen, count);
+        for (i = 0; i < count; i++)
+        {
+            if (cfg->flags & NE10_CORR_NORMALIZE)
+            {
+                pDst[j + i] = ne10_corr_float_to_q15 ( (ne10_float32_t) acc[i] * scale);
+            }
+            else
+            {
+                pDst[j + i] = ne10_corr_sat_q15 ( (acc[i] + 0x4000) >> 15);
+            }
+        }
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_autocorr_int16 using NEON SIMD capabilities.
+ */
+void ne10_autocorr_int16_neon (ne10_corr_cfg_float32_t cfg,
+                               ne10_int16_t * pDst,
+                               ne10_int16_t * pSrc)
+{
+    ne10_uint32_t k;
+    ne10_int64_t acc[4];
+    ne10_int64_t energy;
+    ne10_int16_t *pPad;
+    ne10_float32_t scale;
+
+    if (cfg->nfft)
+    {
+        ne10_corr_load_int16 (cfg->pBuffer, pSrc, cfg->srcALen, cfg->nfft);
+        ne10_corr_fft_neon (cfg, 1);
+        scale = 1.0f;
+        if (cfg->flags & NE10_CORR_NORMALIZE)
+        {
+            scale = (cfg->pBuffer[0] > 0.0f) ? 1.0f / cfg->pBuffer[0] : 0.0f;
+        }
+        for (k = 0; k < cfg->outLen; k++)
+        {
+            pDst[k] = ne10_corr_float_to_q15 (cfg->pBuffer[k] * scale);
+        }
+        return;
+    }
+
+    energy = ne10_corr_energy_int16_neon (pSrc, cfg->srcALen);
+    scale = (energy > 0) ? 1.0f / (ne10_float32_t) energy : 0.0f;
+    pPad = (ne10_int16_t *) cfg->pBuffer;
+    NE10_CORR_PAD (ne10_int16_t, pPad, pSrc, cfg->srcALen, cfg->srcBLen, 0);
+    for (k = 0; k < cfg->outLen; k += 4)
+    {
+        ne10_uint32_t count = (cfg->outLen - k < 4) ? cfg->outLen - k : 4;
+        ne10_uint32_t i;
+        ne10_corr_direct_int16_neon (acc, pPad + k, pSrc, cfg->srcALen, count);
+        for (i = 0; i < count; i++)
+        {
+            if (cfg->flags & NE10_CORR_NORMALIZE)
+            {
+                pDst[k + i] = ne10_corr_float_to_q15 ( (ne10_float32_t) acc[i] * scale);
+            }
+            else
+            {
+                pDst[k + i] = ne10_corr_sat_q15 ( (acc[i] + 0x4000) >> 15);
+            }
+        }
+    }
+}
+/** @} */ //end of Correlation group
@@ -0,0 +1,625 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_dct.c
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_fft.h"
+#include "NE10_dct.h"
+#include "NE10_dsp.h"
+
+/**
+ * @ingroup groupDSPs
+ */
+
+/**
+ * @defgroup DCT Discrete Cosine Transforms
+ *
+ * \par
+ * The cosine transforms of length N are computed on the FFT kernels:
+ * <pre>
+ *    DCT-II:  X[k] = sum_n x[n] * cos (pi/N * (n+1/2) * k)
+ *    DCT-III: x[n] = 1/N * (X[0] + 2 * sum_{k>0} X[k] * cos (pi/N * (n+1/2) * k))
+ *    DCT-IV:  X[k] = sum_n x[n] * cos (pi/N * (n+1/2) * (k+1/2))
+ * </pre>
+ * Like the FFTs, the forward transforms are unscaled and the DCT-III is scaled so that it inverts the DCT-II.
+ * The DCT-IV is its own inverse up to a factor of N/2. The DCT-II and DCT-III reorder the signal into even and
+ * reversed odd samples and use an N-point real FFT (Makhoul's algorithm); the DCT-IV packs pairs of samples
+ * into complex values and uses an N/2-point complex FFT with a pre- and post-twiddle. N must be a power of 2
+ * and at least 4. A configuration from @ref ne10_dct_alloc_float32 serves all three transforms.
+ * \par
+ * The MDCT of a block of 2N samples gives N coefficients:
+ * <pre>
+ *    X[k] = sum_{n<2N} w[n] * x[n] * cos (pi/N * (n+1/2+N/2) * (k+1/2))
+ * </pre>
+ * The block is folded into N samples and goes through a DCT-IV, which costs an N/2-point complex FFT, i.e. a
+ * quarter of the block length. @ref ne10_imdct_float32 inverts one block at a time: it windows the inverse
+ * transform, scaled by 2/N, and overlap-adds it to the second half of the previous block, returning N samples.
+ * When consecutive blocks advance by N samples and the window satisfies the Princen-Bradley condition
+ * <code>w[n]^2 + w[n+N]^2 = 1</code>, the time-domain aliasing cancels and the signal is reconstructed exactly
+ * (TDAC), one block late. The default window is the sine window.
+ * \par
+ * The 8x8 and 4x4 block transforms are the orthonormal two-dimensional DCT-II of image coding,
+ * <code>Y = C * X * C^T</code>, and its inverse <code>X = C^T * Y * C</code>, on row-major blocks. They are
+ * computed as two passes of matrix products. The int16 versions use Q14 coefficients, keep
+ * NE10_DCT_INT16_FRAC_BITS fractional bits between the passes and round the results to integers; they are exact
+ * for inputs of up to 10 bits (|x| <= 1023) and saturate otherwise.
+ */
+
+/**
+ * @addtogroup DCT
+ * @{
+ */
+
+const ne10_float32_t ne10_dct_8x8_coeff_float32[64] =
+{
+    0.353553391f, 0.353553391f, 0.353553391f, 0.353553391f, 0.353553391f, 0.353553391f, 0.353553391f, 0.353553391f,
+    0.490392640f, 0.415734806f, 0.277785117f, 0.097545161f, -0.097545161f, -0.277785117f, -0.415734806f, -0.490392640f,
+    0.461939766f, 0.191341716f, -0.191341716f, -0.461939766f, -0.461939766f, -0.191341716f, 0.191341716f, 0.461939766f,
+    0.415734806f, -0.097545161f, -0.490392640f, -0.277785117f, 0.277785117f, 0.490392640f, 0.097545161f, -0.415734806f,
+    0.353553391f, -0.353553391f, -0.353553391f, 0.353553391f, 0.353553391f, -0.353553391f, -0.353553391f, 0.353553391f,
+    0.277785117f, -0.490392640f, 0.097545161f, 0.415734806f, -0.415734806f, -0.097545161f, 0.490392640f, -0.277785117f,
+    0.191341716f, -0.461939766f, 0.461939766f, -0.191341716f, -0.191341716f, 0.461939766f, -0.461939766f, 0.191341716f,
+    0.097545161f, -0.277785117f, 0.415734806f, -0.490392640f, 0.490392640f, -0.415734806f, 0.277785117f, -0.097545161f
+};
+
+const ne10_float32_t ne10_dct_8x8_coeff_t_float32[64] =
+{
+    0.353553391f, 0.490392640f, 0.461939766f, 0.415734806f, 0.353553391f, 0.277785117f, 0.191341716f, 0.097545161f,
+    0.353553391f, 0.415734806f, 0.191341716f, -0.097545161f, -0.353553391f, -0.490392640f, -0.461939766f, -0.277785117f,
+    0.353553391f, 0.277785117f, -0.191341716f, -0.490392640f, -0.353553391f, 0.097545161f, 0.461939766f, 0.415734806f,
+    0.353553391f, 0.097545161f, -0.461939766f, -0.277785117f, 0.353553391f, 0.415734806f, -0.191341716f, -0.490392640f,
+    0.353553391f, -0.097545161f, -0.461939766f, 0.277785117f, 0.353553391f, -0.415734806f, -0.191341716f, 0.490392640f,
+    0.353553391f, -0.277785117f, -0.191341716f, 0.490392640f, -0.353553391f, -0.097545161f, 0.461939766f, -0.415734806f,
+    0.353553391f, -0.415734806f, 0.191341716f, 0.097545161f, -0.353553391f, 0.490392640f, -0.461939766f, 0.277785117f,
+    0.353553391f, -0.490392640f, 0.461939766f, -0.415734806f, 0.353553391f, -0.277785117f, 0.191341716f, -0.097545161f
+};
+
+const ne10_int16_t ne10_dct_8x8_coeff_int16[64] =
+{
+    5793, 5793, 5793, 5793, 5793, 5793, 5793, 5793,
+    8035, 6811, 4551, 1598, -1598, -4551, -6811, -8035,
+    7568, 3135, -3135, -7568, -7568, -3135, 3135, 7568,
+    6811, -1598, -8035, -4551, 4551, 8035, 1598, -6811,
+    5793, -5793, -5793, 5793, 5793, -5793, -5793, 5793,
+    4551, -8035, 1598, 6811, -6811, -1598, 8035, -4551,
+    3135, -7568, 7568, -3135, -3135, 7568, -7568, 3135,
+    1598, -4551, 6811, -8035, 8035, -6811, 4551, -1598
+};
+
+const ne10_int16_t ne10_dct_8x8_coeff_t_int16[64] =
+{
+    5793, 8035, 7568, 6811, 5793, 4551, 3135, 1598,
+    5793, 6811, 3135, -1598, -5793, -8035, -7568, -4551,
+    5793, 4551, -3135, -8035, -5793, 1598, 7568, 6811,
+    5793, 1598, -7568, -4551, 5793, 6811, -3135, -8035,
+    5793, -1598, -7568, 4551, 5793, -6811, -3135, 8035,
+    5793, -4551, -3135, 8035, -5793, -1598, 7568, -6811,
+    5793, -6811, 3135, 1598, -5793, 8035, -7568, 4551,
+    5793, -8035, 7568, -6811, 5793, -4551, 3135, -1598
+};
+
+const ne10_float32_t ne10_dct_4x4_coeff_float32[16] =
+{
+    0.500000000f, 0.500000000f, 0.500000000f, 0.500000000f,
+    0.653281482f, 0.270598050f, -0.270598050f, -0.653281482f,
+    0.500000000f, -0.500000000f, -0.500000000f, 0.500000000f,
+    0.270598050f, -0.653281482f, 0.653281482f, -0.270598050f
+};
+
+const ne10_float32_t ne10_dct_4x4_coeff_t_float32[16] =
+{
+    0.500000000f, 0.653281482f, 0.500000000f, 0.270598050f,
+    0.500000000f, 0.270598050f, -0.500000000f, -0.653281482f,
+    0.500000000f, -0.270598050f, -0.500000000f, 0.653281482f,
+    0.500000000f, -0.653281482f, 0.500000000f, -0.270598050f
+};
+
+const ne10_int16_t ne10_dct_4x4_coeff_int16[16] =
+{
+    8192, 8192, 8192, 8192,
+    10703, 4433, -4433, -10703,
+    8192, -8192, -8192, 8192,
+    4433, -10703, 10703, -4433
+};
+
+const ne10_int16_t ne10_dct_4x4_coeff_t_int16[16] =
+{
+    8192, 10703, 8192, 4433,
+    8192, 4433, -8192, -10703,
+    8192, -4433, -8192, 10703,
+    8192, -10703, 8192, -4433
+};
+
+/**
+ * @brief Allocates a configuration of the DCT-II, DCT-III and DCT-IV.
+ * @param[in]   nfft       length of the transforms, a power of 2 of at least 4.
+ * @return      the configuration, or NULL if nfft is invalid or the memory allocation fails.
+ */
+ne10_dct_cfg_float32_t ne10_dct_alloc_float32 (ne10_uint32_t nfft)
+{
+    ne10_dct_cfg_float32_t st;
+    ne10_uint32_t half = nfft / 2;
+    ne10_uint32_t memneeded, k;
+    uintptr_t address;
+
+    if ( (nfft < 4) || (nfft & (nfft - 1)))
+    {
+        return NULL;
+    }
+
+    memneeded = sizeof (ne10_dct_state_float32_t)
+                + sizeof (ne10_fft_cpx_float32_t) * (half + 1 + nfft + nfft)   /* twiddles, complex buffer */
+                + sizeof (ne10_float32_t) * nfft                                /* buffer */
+                + NE10_FFT_BYTE_ALIGNMENT;
+    st = (ne10_dct_cfg_float32_t) NE10_MALLOC (memneeded);
+    if (st == NULL)
+    {
+        return NULL;
+    }
+
+    address = (uintptr_t) (st + 1);
+    NE10_BYTE_ALIGNMENT (address, NE10_FFT_BYTE_ALIGNMENT);
+    st->pTwiddle4 = (ne10_fft_cpx_float32_t *) address;
+    st->pCpxBuffer = st->pTwiddle4 + nfft;
+    st->pTwiddle2 = st->pCpxBuffer + nfft;
+    st->pBuffer = (ne10_float32_t *) (st->pTwiddle2 + half + 1);
+    st->nfft = nfft;
+
+    for (k = 0; k <= half; k++)
+    {
+        st->pTwiddle2[k].r = (ne10_float32_t) cos (NE10_PI * k / (2.0 * nfft));
+        st->pTwiddle2[k].i = (ne10_float32_t) - sin (NE10_PI * k / (2.0 * nfft));
+    }
+    for (k = 0; k < half; k++)
+    {
+        st->pTwiddle4[k].r = (ne10_float32_t) cos (NE10_PI * (4 * k + 1) / (4.0 * nfft));
+        st->pTwiddle4[k].i = (ne10_float32_t) - sin (NE10_PI * (4 * k + 1) / (4.0 * nfft));
+        st->pTwiddle4[half + k].r = (ne10_float32_t) cos (NE10_PI * k / nfft);
+        st->pTwiddle4[half + k].i = (ne10_float32_t) - sin (NE10_PI * k / nfft);
+    }
+
+    /* The C and NEON complex FFTs lay out their configurations differently */
+    st->r2cCfg = ne10_fft_alloc_r2c_float32 (nfft);
+    st->c2cCfg = ne10_fft_alloc_c2c_float32_c (half);
+    st->c2cCfgNeon = ne10_fft_alloc_c2c_float32_neon (half);
+    if ( (st->r2cCfg == NULL) || (st->c2cCfg == NULL) || (st->c2cCfgNeon == NULL))
+    {
+        ne10_dct_destroy_float32 (st);
+        return NULL;
+    }
+    return st;
+}
+
+/**
+ * @brief Frees a configuration allocated by @ref ne10_dct_alloc_float32.
+ */
+void ne10_dct_destroy_float32 (ne10_dct_cfg_float32_t cfg)
+{
+    if (cfg == NULL)
+    {
+        return;
+    }
+    if (cfg->r2cCfg != NULL)
+    {
+        ne10_fft_destroy_r2c_float32 (cfg->r2cCfg);
+    }
+    if (cfg->c2cCfg != NULL)
+    {
+        ne10_fft_destroy_c2c_float32 (cfg->c2cCfg);
+    }
+    if (cfg->c2cCfgNeon != NULL)
+    {
+        ne10_fft_destroy_c2c_float32 (cfg->c2cCfgNeon);
+    }
+    NE10_FREE (cfg);
+}
+
+/**
+ * @brief DCT-II.
+ * @param[in]   cfg        configuration from @ref ne10_dct_alloc_float32.
+ * @param[out]  *pDst      points to the N coefficients.
+ * @param[in]   *pSrc      points to the N samples. It may be the same buffer as pDst.
+ */
+void ne10_dct2_float32_c (ne10_dct_cfg_float32_t cfg,
+                          ne10_float32_t * pDst,
+                          ne10_float32_t * pSrc)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+    ne10_uint32_t half = nfft / 2;
+    ne10_fft_cpx_float32_t *pSpec = cfg->pCpxBuffer;
+    const ne10_fft_cpx_float32_t *pTw = cfg->pTwiddle2;
+    ne10_float32_t *pV = cfg->pBuffer;
+    ne10_uint32_t n, k;
+
+    for (n = 0; n < half; n++)
+    {
+        pV[n] = pSrc[2 * n];
+        pV[nfft - 1 - n] = pSrc[2 * n + 1];
+    }
+    ne10_fft_r2c_1d_float32_c (pSpec, pV, cfg->r2cCfg);
+
+    /* X[k] = Re (V[k] * w^k), and X[N-k] = -Im (V[k] * w^k) by the symmetry of the real FFT */
+    pDst[0] = pSpec[0].r;
+    pDst[half] = pSpec[half].r * pTw[half].r;
+    for (k = 1; k < half; k++)
+    {
+        pDst[k] = pSpec[k].r * pTw[k].r - pSpec[k].i * pTw[k].i;
+        pDst[nfft - k] = - (pSpec[k].r * pTw[k].i + pSpec[k].i * pTw[k].r);
+    }
+}
+
+/**
+ * @brief DCT-III, the inverse of @ref ne10_dct2_float32.
+ * @param[in]   cfg        configuration from @ref ne10_dct_alloc_float32.
+ * @param[out]  *pDst      points to the N samples.
+ * @param[in]   *pSrc      points to the N coefficients. It may be the same buffer as pDst.
+ */
+void ne10_dct3_float32_c (ne10_dct_cfg_float32_t cfg,
+                          ne10_float32_t * pDst,
+                          ne10_float32_t * pSrc)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+    ne10_uint32_t half = nfft / 2;
+    ne10_fft_cpx_float32_t *pSpec = cfg->pCpxBuffer;
+    const ne10_fft_cpx_float32_t *pTw = cfg->pTwiddle2;
+    ne10_float32_t *pV = cfg->pBuffer;
+    ne10_uint32_t n, k;
+
+    /* V[k] = (X[k] - i * X[N-k]) * conj (w^k) */
+    pSpec[0].r = pSrc[0];
+    pSpec[0].i = 0.0f;
+    pSpec[half].r = pSrc[half] / pTw[half].r;
+    pSpec[half].i = 0.0f;
+    for (k = 1; k < half; k++)
+    {
+        pSpec[k].r = pSrc[k] * pTw[k].r - pSrc[nfft - k] * pTw[k].i;
+        pSpec[k].i = - (pSrc[k] * pTw[k].i + pSrc[nfft - k] * pTw[k].r);
+    }
+    ne10_fft_c2r_1d_float32_c (pV, pSpec, cfg->r2cCfg);
+
+    for (n = 0; n < half; n++)
+    {
+        pDst[2 * n] = pV[n];
+        pDst[2 * n + 1] = pV[nfft - 1 - n];
+    }
+}
+
+/**
+ * @brief DCT-IV.
+ * @param[in]   cfg        configuration from @ref ne10_dct_alloc_float32.
+ * @param[out]  *pDst      points to the N coefficients.
+ * @param[in]   *pSrc      points to the N samples. It may be the same buffer as pDst.
+ */
+void ne10_dct4_float32_c (ne10_dct_cfg_float32_t cfg,
+                          ne10_float32_t * pDst,
+                          ne10_float32_t * pSrc)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+    ne10_uint32_t half = nfft / 2;
+    ne10_fft_cpx_float32_t *pIn = cfg->pCpxBuffer;
+    ne10_fft_cpx_float32_t *pOut = pIn + half;
+    const ne10_fft_cpx_float32_t *pPre = cfg->pTwiddle4;
+    const ne10_fft_cpx_float32_t *pPost = pPre + half;
+    ne10_float32_t re, im;
+    ne10_uint32_t n, k;
+
+    /* v[n] = (x[2n] + i * x[N-1-2n]) * exp (-i*pi*(4n+1)/(4N)) */
+    for (n = 0; n < half; n++)
+    {
+        re = pSrc[2 * n];
+        im = pSrc[nfft - 1 - 2 * n];
+        pIn[n].r = re * pPre[n].r - im * pPre[n].i;
+        pIn[n].i = re * pPre[n].i + im * pPre[n].r;
+    }
+    ne10_fft_c2c_1d_float32_c (pOut, pIn, cfg->c2cCfg, 0);
+
+    /* X[2k] = Re (V[k] * exp (-i*pi*k/N)), X[N-1-2k] = -Im (V[k] * exp (-i*pi*k/N)) */
+    for (k = 0; k < half; k++)
+    {
+        pDst[2 * k] = pOut[k].r * pPost[k].r - pOut[k].i * pPost[k].i;
+        pDst[nfft - 1 - 2 * k] = - (pOut[k].r * pPost[k].i + pOut[k].i * pPost[k].r);
+    }
+}
+
+/**
+ * @brief Allocates a windowed MDCT and IMDCT.
+ * @param[in]   nfft       number N of coefficients, a power of 2 of at least 4. Blocks are 2N samples long.
+ * @param[in]   *pWindow   points to the 2N window coefficients, or NULL for the sine window
+ *                         <code>w[n] = sin (pi*(n+1/2)/(2N))</code>.
+ * @return      the configuration, or NULL if nfft is invalid or the memory allocation fails.
+ */
+ne10_mdct_cfg_float32_t ne10_mdct_alloc_float32 (ne10_uint32_t nfft,
+        const ne10_float32_t * pWindow)
+{
+    ne10_mdct_cfg_float32_t st;
+    ne10_uint32_t memneeded, n;
+    uintptr_t address;
+
+    if ( (nfft < 4) || (nfft & (nfft - 1)))
+    {
+        return NULL;
+    }
+
+    memneeded = sizeof (ne10_mdct_state_float32_t)
+                + sizeof (ne10_float32_t) * (2 * nfft + nfft + 2 * nfft)   /* window, overlap, buffer */
+                + NE10_FFT_BYTE_ALIGNMENT;
+    st = (ne10_mdct_cfg_float32_t) NE10_MALLOC (memneeded);
+    if (st == NULL)
+    {
+        return NULL;
+    }
+
+    address = (uintptr_t) (st + 1);
+    NE10_BYTE_ALIGNMENT (address, NE10_FFT_BYTE_ALIGNMENT);
+    st->pWindow = (ne10_float32_t *) address;
+    st->pOverlap = st->pWindow + 2 * nfft;
+    st->pBuffer = st->pOverlap + nfft;
+    st->nfft = nfft;
+
+    for (n = 0; n < 2 * nfft; n++)
+    {
+        st->pWindow[n] = (pWindow != NULL) ? pWindow[n] : (ne10_float32_t) sin (NE10_PI * (n + 0.5) / (2.0 * nfft));
+    }
+    memset (st->pOverlap, 0, nfft * sizeof (ne10_float32_t));
+
+    st->dctCfg = ne10_dct_alloc_float32 (nfft);
+    if (st->dctCfg == NULL)
+    {
+        NE10_FREE (st);
+        return NULL;
+    }
+    return st;
+}
+
+/**
+ * @brief Frees a configuration allocated by @ref ne10_mdct_alloc_float32.
+ */
+void ne10_mdct_destroy_float32 (ne10_mdct_cfg_float32_t cfg)
+{
+    if (cfg == NULL)
+    {
+        return;
+    }
+    ne10_dct_destroy_float32 (cfg->dctCfg);
+    NE10_FREE (cfg);
+}
+
+/**
+ * @brief Windowed MDCT of one block.
+ * @param[in]   cfg        configuration from @ref ne10_mdct_alloc_float32.
+ * @param[out]  *pDst      points to the N coefficients.
+ * @param[in]   *pSrc      points to the 2N samples of the block. Consecutive blocks overlap by N samples.
+ */
+void ne10_mdct_float32_c (ne10_mdct_cfg_float32_t cfg,
+                          ne10_float32_t * pDst,
+                          ne10_float32_t * pSrc)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+    ne10_uint32_t half = nfft / 2;
+    const ne10_float32_t *pWin = cfg->pWindow;
+    ne10_float32_t *pFold = cfg->pBuffer;
+    ne10_uint32_t n;
+
+    /* With the block split into quarters (a, b, c, d), fold it into (-c_r - d, a - b_r) */
+    for (n = 0; n < half; n++)
+    {
+        pFold[n] = -pSrc[nfft + half - 1 - n] * pWin[nfft + half - 1 - n] - pSrc[nfft + half + n] * pWin[nfft + half + n];
+        pFold[half + n] = pSrc[n] * pWin[n] - pSrc[nfft - 1 - n] * pWin[nfft - 1 - n];
+    }
+    ne10_dct4_float32_c (cfg->dctCfg, pDst, pFold);
+}
+
+/**
+ * @brief Windowed IMDCT of one block with overlap-add.
+ * @param[in]   cfg        configuration from @ref ne10_mdct_alloc_float32.
+ * @param[out]  *pDst      points to the N output samples: the first half of this block added to the second
+ *                         half of the previous one.
+ * @param[in]   *pSrc      points to the N coefficients of the block.
+ */
+void ne10_imdct_float32_c (ne10_mdct_cfg_float32_t cfg,
+                           ne10_float32_t * pDst,
+                           ne10_float32_t * pSrc)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+    ne10_uint32_t half = nfft / 2;
+    const ne10_float32_t *pWin = cfg->pWindow;
+    ne10_float32_t *pOverlap = cfg->pOverlap;
+    ne10_float32_t *pZ = cfg->pBuffer;
+    ne10_float32_t scale = 2.0f / nfft;
+    ne10_uint32_t n;
+
+    /* The 2N outputs unfold from the DCT-IV z = (z1, z2) as (z2, -z2_r, -z1_r, -z1) */
+    ne10_dct4_float32_c (cfg->dctCfg, pZ, pSrc);
+    for (n = 0; n < half; n++)
+    {
+        pDst[n] = pOverlap[n] + scale * pZ[half + n] * pWin[n];
+        pDst[half + n] = pOverlap[half + n] - scale * pZ[nfft - 1 - n] * pWin[half + n];
+    }
+    for (n = 0; n < half; n++)
+    {
+        pOverlap[n] = -scale * pZ[half - 1 - n] * pWin[nfft + n];
+        pOverlap[half + n] = -scale * pZ[n] * pWin[nfft + half + n];
+    }
+}
+
+/* Y = M * X * M^T on row-major size x size blocks */
+static void ne10_dct_block_float32_c (ne10_float32_t * pDst,
+                                      const ne10_float32_t * pSrc,
+                                      const ne10_float32_t * pM,
+                                      ne10_uint32_t size)
+{
+    ne10_float32_t tmp[64];
+    ne10_float32_t acc;
+    ne10_uint32_t i, j, u, v;
+
+    for (i = 0; i < size; i++)
+    {
+        for (v = 0; v < size; v++)
+        {
+            acc = 0.0f;
+            for (j = 0; j < size; j++)
+            {
+                acc += pSrc[i * size + j] * pM[v * size + j];
+            }
+            tmp[i * size + v] = acc;
+        }
+    }
+    for (u = 0; u < size; u++)
+    {
+        for (v = 0; v < size; v++)
+        {
+            acc = 0.0f;
+            for (i = 0; i < size; i++)
+            {
+                acc += pM[u * size + i] * tmp[i * size + v];
+            }
+            pDst[u * size + v] = acc;
+        }
+    }
+}
+
+static inline ne10_int16_t ne10_dct_round_int16 (ne10_int32_t acc, ne10_int32_t shift)
+{
+    ne10_int64_t result = ( (ne10_int64_t) acc + (1 << (shift - 1))) >> shift;
+    return (ne10_int16_t) ( (result > 32767) ? 32767 : ( (result < -32768) ? -32768 : result));
+}
+
+/* Y = M * X * M^T on row-major size x size blocks with a Q14 matrix */
+static void ne10_dct_block_int16_c (ne10_int16_t * pDst,
+                                    const ne10_int16_t * pSrc,
+                                    const ne10_int16_t * pM,
+                                    ne10_uint32_t size)
+{
+    ne10_int16_t tmp[64];
+    ne10_int32_t acc;
+    ne10_uint32_t i, j, u, v;
+
+    for (i = 0; i < size; i++)
+    {
+        for (v = 0; v < size; v++)
+        {
+            acc = 0;
+            for (j = 0; j < size; j++)
+            {
+                acc += pSrc[i * size + j] * pM[v * size + j];
+            }
+            tmp[i * size + v] = ne10_dct_round_int16 (acc, NE10_DCT_INT16_SHIFT1);
+        }
+    }
+    for (u = 0; u < size; u++)
+    {
+        for (v = 0; v < size; v++)
+        {
+            acc = 0;
+            for (i = 0; i < size; i++)
+            {
+                acc += pM[u * size + i] * tmp[i * size + v];
+            }
+            pDst[u * size + v] = ne10_dct_round_int16 (acc, NE10_DCT_INT16_SHIFT2);
+        }
+    }
+}
+
+/**
+ * @brief Orthonormal 2-D DCT-II of an 8x8 block.
+ * @param[out]  *pDst      points to the 64 coefficients, row-major.
+ * @param[in]   *pSrc      points to the 64 samples, row-major. It may be the same buffer as pDst.
+ */
+void ne10_dct_8x8_float32_c (ne10_float32_t * pDst, const ne10_float32_t * pSrc)
+{
+    ne10_dct_block_float32_c (pDst, pSrc, ne10_dct_8x8_coeff_float32, 8);
+}
+
+/**
+ * @brief Inverse of @ref ne10_dct_8x8_float32.
+ */
+void ne10_idct_8x8_float32_c (ne10_float32_t * pDst, const ne10_float32_t * pSrc)
+{
+    ne10_dct_block_float32_c (pDst, pSrc, ne10_dct_8x8_coeff_t_float32, 8);
+}
+
+/**
+ * @brief Orthonormal 2-D DCT-II of a 4x4 block.
+ * @param[out]  *pDst      points to the 16 coefficients, row-major.
+ * @param[in]   *pSrc      points to the 16 samples, row-major. It may be the same buffer as pDst.
+ */
+void ne10_dct_4x4_float32_c (ne10_float32_t * pDst, const ne10_float32_t * pSrc)
+{
+    ne10_dct_block_float32_c (pDst, pSrc, ne10_dct_4x4_coeff_float32, 4);
+}
+
+/**
+ * @brief Inverse of @ref ne10_dct_4x4_float32.
+ */
+void ne10_idct_4x4_float32_c (ne10_float32_t * pDst, const ne10_float32_t * pSrc)
+{
+    ne10_dct_block_float32_c (pDst, pSrc, ne10_dct_4x4_coeff_t_float32, 4);
+}
+
+/**
+ * @brief Orthonormal 2-D DCT-II of an 8x8 block of integers, rounded to integers.
+ * @param[out]  *pDst      points to the 64 coefficients, row-major.
+ * @param[in]   *pSrc      points to the 64 samples, row-major, of at most 10 bits. It may be the same buffer as pDst.
+ */
+void ne10_dct_8x8_int16_c (ne10_int16_t * pDst, const ne10_int16_t * pSrc)
+{
+    ne10_dct_block_int16_c (pDst, pSrc, ne10_dct_8x8_coeff_int16, 8);
+}
+
+/**
+ * @brief Inverse of @ref ne10_dct_8x8_int16.
+ */
+void ne10_idct_8x8_int16_c (ne10_int16_t * pDst, const ne10_int16_t * pSrc)
+{
+    ne10_dct_block_int16_c (pDst, pSrc, ne10_dct_8x8_coeff_t_int16, 8);
+}
+
+/**
+ * @brief Orthonormal 2-D DCT-II of a 4x4 block of integers, rounded to integers.
+ * @param[out]  *pDst      points to the 16 coefficients, row-major.
+ * @param[in]   *pSrc      points to the 16 samples, row-major, of at most 10 bits. It may be the same buffer as pDst.
+ */
+void ne10_dct_4x4_int16_c (ne10_int16_t * pDst, const ne10_int16_t * pSrc)
+{
+    ne10_dct_block_int16_c (pDst, pSrc, ne10_dct_4x4_coeff_int16, 4);
+}
+
+/**
+ * @brief Inverse of @ref ne10_dct_4x4_int16.
+ */
+void ne10_idct_4x4_int16_c (ne10_int16_t * pDst, const ne10_int16_t * pSrc)
+{
+    ne10_dct_block_int16_c (pDst, pSrc, ne10_dct_4x4_coeff_t_int16, 4);
+}
+/** @} */ //end of DCT group
@@ -0,0 +1,66 @@
+/*
+ *  Copyright 2013-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_dct.h
+ */
+
+#include "NE10_types.h"
+
+#ifndef NE10_DCT_H
+#define NE10_DCT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Orthonormal DCT-II matrices of the block transforms, row u holding basis function u, and their
+ * transposes. The int16 matrices are in Q14.
+ */
+extern const ne10_float32_t ne10_dct_8x8_coeff_float32[64];
+extern const ne10_float32_t ne10_dct_8x8_coeff_t_float32[64];
+extern const ne10_int16_t ne10_dct_8x8_coeff_int16[64];
+extern const ne10_int16_t ne10_dct_8x8_coeff_t_int16[64];
+extern const ne10_float32_t ne10_dct_4x4_coeff_float32[16];
+extern const ne10_float32_t ne10_dct_4x4_coeff_t_float32[16];
+extern const ne10_int16_t ne10_dct_4x4_coeff_int16[16];
+extern const ne10_int16_t ne10_dct_4x4_coeff_t_int16[16];
+
+/*
+ * Fixed-point shifts of the int16 block transforms: the first pass keeps NE10_DCT_INT16_FRAC_BITS
+ * fractional bits of the Q14 products, the second pass rounds back to integers.
+ */
+#define NE10_DCT_INT16_FRAC_BITS    2
+#define NE10_DCT_INT16_SHIFT1       (14 - NE10_DCT_INT16_FRAC_BITS)
+#define NE10_DCT_INT16_SHIFT2       (14 + NE10_DCT_INT16_FRAC_BITS)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,477 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_dct.neonintrinsic.c
+ */
+
+#include <arm_neon.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_dct.h"
+#include "NE10_dsp.h"
+
+/**
+ * @addtogroup DCT
+ * @{
+ */
+
+/*
+ * The NEON transforms work on blocks of 4 bins of each half of the spectrum, so they need N >= 16;
+ * shorter transforms use the C versions.
+ */
+#define NE10_DCT_NEON_MIN_LEN 16
+
+static inline float32x4_t ne10_dct_reverse_neon (float32x4_t v)
+{
+    v = vrev64q_f32 (v);
+    return vcombine_f32 (vget_high_f32 (v), vget_low_f32 (v));
+}
+
+/**
+ * Specific implementation of @ref ne10_dct2_float32 using NEON SIMD capabilities.
+ */
+void ne10_dct2_float32_neon (ne10_dct_cfg_float32_t cfg,
+                             ne10_float32_t * pDst,
+                             ne10_float32_t * pSrc)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+    ne10_uint32_t half = nfft / 2;
+    ne10_fft_cpx_float32_t *pSpec = cfg->pCpxBuffer;
+    const ne10_fft_cpx_float32_t *pTw = cfg->pTwiddle2;
+    ne10_float32_t *pV = cfg->pBuffer;
+    float32x4x2_t q_in, q_tw;
+    float32x4_t q_re, q_im;
+    ne10_uint32_t n, k;
+
+    if (nfft < NE10_DCT_NEON_MIN_LEN)
+    {
+        ne10_dct2_float32_c (cfg, pDst, pSrc);
+        return;
+    }
+
+    for (n = 0; n < half; n += 4)
+    {
+        q_in = vld2q_f32 (pSrc + 2 * n);
+        vst1q_f32 (pV + n, q_in.val[0]);
+        vst1q_f32 (pV + nfft - 4 - n, ne10_dct_reverse_neon (q_in.val[1]));
+    }
+    ne10_fft_r2c_1d_float32_neon (pSpec, pV, cfg->r2cCfg);
+
+    pDst[0] = pSpec[0].r;
+    pDst[half] = pSpec[half].r * pTw[half].r;
+    for (k = 1; k < 4; k++)
+    {
+        pDst[k] = pSpec[k].r * pTw[k].r - pSpec[k].i * pTw[k].i;
+        pDst[nfft - k] = - (pSpec[k].r * pTw[k].i + pSpec[k].i * pTw[k].r);
+    }
+    for (k = 4; k < half; k += 4)
+    {
+        q_in = vld2q_f32 ( (ne10_float32_t *) (pSpec + k));
+        q_tw = vld2q_f32 ( (const ne10_float32_t *) (pTw + k));
+        q_re = vmlsq_f32 (vmulq_f32 (q_in.val[0], q_tw.val[0]), q_in.val[1], q_tw.val[1]);
+        q_im = vmlaq_f32 (vmulq_f32 (q_in.val[0], q_tw.val[1]), q_in.val[1], q_tw.val[0]);
+        vst1q_f32 (pDst + k, q_re);
+        vst1q_f32 (pDst + nfft - k - 3, vnegq_f32 (ne10_dct_reverse_neon (q_im)));
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_dct3_float32 using NEON SIMD capabilities.
+ */
+void ne10_dct3_float32_neon (ne10_dct_cfg_float32_t cfg,
+                             ne10_float32_t * pDst,
+                             ne10_float32_t * pSrc)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+    ne10_uint32_t half = nfft / 2;
+    ne10_fft_cpx_float32_t *pSpec = cfg->pCpxBuffer;
+    const ne10_fft_cpx_float32_t *pTw = cfg->pTwiddle2;
+    ne10_float32_t *pV = cfg->pBuffer;
+    float32x4x2_t q_out, q_tw;
+    float32x4_t q_x, q_y;
+    ne10_uint32_t n, k;
+
+    if (nfft < NE10_DCT_NEON_MIN_LEN)
+    {
+        ne10_dct3_float32_c (cfg, pDst, pSrc);
+        return;
+    }
+
+    pSpec[0].r = pSrc[0];
+    pSpec[0].i = 0.0f;
+    pSpec[half].r = pSrc[half] / pTw[half].r;
+    pSpec[half].i = 0.0f;
+    for (k = 1; k < 4; k++)
+    {
+        pSpec[k].r = pSrc[k] * pTw[k].r - pSrc[nfft - k] * pTw[k].i;
+        pSpec[k].i = - (pSrc[k] * pTw[k].i + pSrc[nfft - k] * pTw[k].r);
+    }
+    for (k = 4; k < half; k += 4)
+    {
+        q_x = vld1q_f32 (pSrc + k);
+        q_y = ne10_dct_reverse_neon (vld1q_f32 (pSrc + nfft - k - 3));
+        q_tw = vld2q_f32 ( (const ne10_float32_t *) (pTw + k));
+        q_out.val[0] = vmlsq_f32 (vmulq_f32 (q_x, q_tw.val[0]), q_y, q_tw.val[1]);
+        q_out.val[1] = vnegq_f32 (vmlaq_f32 (vmulq_f32 (q_x, q_tw.val[1]), q_y, q_tw.val[0]));
+        vst2q_f32 ( (ne10_float32_t *) (pSpec + k), q_out);
+    }
+    ne10_fft_c2r_1d_float32_neon (pV, pSpec, cfg->r2cCfg);
+
+    for (n = 0; n < half; n += 4)
+    {
+        q_out.val[0] = vld1q_f32 (pV + n);
+        q_out.val[1] = ne10_dct_reverse_neon (vld1q_f32 (pV + nfft - 4 - n));
+        vst2q_f32 (pDst + 2 * n, q_out);
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_dct4_float32 using NEON SIMD capabilities.
+ */
+void ne10_dct4_float32_neon (ne10_dct_cfg_float32_t cfg,
+                             ne10_float32_t * pDst,
+                             ne10_float32_t * pSrc)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+    ne10_uint32_t half = nfft / 2;
+    ne10_fft_cpx_float32_t *pIn = cfg->pCpxBuffer;
+    ne10_fft_cpx_float32_t *pOut = pIn + half;
+    const ne10_fft_cpx_float32_t *pPre = cfg->pTwiddle4;
+    const ne10_fft_cpx_float32_t *pPost = pPre + half;
+    float32x4x2_t q_a, q_b, q_tw;
+    float32x4_t q_re, q_im;
+    ne10_uint32_t n, k;
+
+    if (nfft < NE10_DCT_NEON_MIN_LEN)
+    {
+        ne10_dct4_float32_c (cfg, pDst, pSrc);
+        return;
+    }
+
+    for (n = 0; n < half; n += 4)
+    {
+        q_re = vld2q_f32 (pSrc + 2 * n).val[0];
+        q_im = ne10_dct_reverse_neon (vld2q_f32 (pSrc + nfft - 8 - 2 * n).val[1]);
+        q_tw = vld2q_f32 ( (const ne10_float32_t *) (pPre + n));
+        q_a.val[0] = vmlsq_f32 (vmulq_f32 (q_re, q_tw.val[0]), q_im, q_tw.val[1]);
+        q_a.val[1] = vmlaq_f32 (vmulq_f32 (q_re, q_tw.val[1]), q_im, q_tw.val[0]);
+        vst2q_f32 ( (ne10_float32_t *) (pIn + n), q_a);
+    }
+    ne10_fft_c2c_1d_float32_neon (pOut, pIn, cfg->c2cCfgNeon, 0);
+
+    for (k = 0; k < half; k += 4)
+    {
+        q_a = vld2q_f32 ( (ne10_float32_t *) (pOut + k));
+        q_tw = vld2q_f32 ( (const ne10_float32_t *) (pPost + k));
+        q_b.val[0] = vmlsq_f32 (vmulq_f32 (q_a.val[0], q_tw.val[0]), q_a.val[1], q_tw.val[1]);
+        q_b.val[1] = vmlaq_f32 (vmulq_f32 (q_a.val[0], q_tw.val[1]), q_a.val[1], q_tw.val[0]);
+        vst2q_f32 ( (ne10_float32_t *) (pOut + k), q_b);
+    }
+
+    /* X[2k] = Re (Y[k]) and X[2k+1] = -Im (Y[N/2-1-k]) */
+    for (k = 0; k < half; k += 4)
+    {
+        q_a = vld2q_f32 ( (ne10_float32_t *) (pOut + k));
+        q_b = vld2q_f32 ( (ne10_float32_t *) (pOut + half - 4 - k));
+        q_a.val[1] = vnegq_f32 (ne10_dct_reverse_neon (q_b.val[1]));
+        vst2q_f32 (pDst + 2 * k, q_a);
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_mdct_float32 using NEON SIMD capabilities.
+ */
+void ne10_mdct_float32_neon (ne10_mdct_cfg_float32_t cfg,
+                             ne10_float32_t * pDst,
+                             ne10_float32_t * pSrc)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+    ne10_uint32_t half = nfft / 2;
+    const ne10_float32_t *pWin = cfg->pWindow;
+    ne10_float32_t *pFold = cfg->pBuffer;
+    float32x4_t q_fwd, q_rev;
+    ne10_uint32_t n;
+
+    if (nfft < NE10_DCT_NEON_MIN_LEN)
+    {
+        ne10_mdct_float32_c (cfg, pDst, pSrc);
+        return;
+    }
+
+    for (n = 0; n < half; n += 4)
+    {
+        q_rev = vmulq_f32 (vld1q_f32 (pSrc + nfft + half - 4 - n), vld1q_f32 (pWin + nfft + half - 4 - n));
+        q_fwd = vmulq_f32 (vld1q_f32 (pSrc + nfft + half + n), vld1q_f32 (pWin + nfft + half + n));
+        vst1q_f32 (pFold + n, vnegq_f32 (vaddq_f32 (ne10_dct_reverse_neon (q_rev), q_fwd)));
+
+        q_fwd = vmulq_f32 (vld1q_f32 (pSrc + n), vld1q_f32 (pWin + n));
+        q_rev = vmulq_f32 (vld1q_f32 (pSrc + nfft - 4 - n), vld1q_f32 (pWin + nfft - 4 - n));
+        vst1q_f32 (pFold + half + n, vsubq_f32 (q_fwd, ne10_dct_reverse_neon (q_rev)));
+    }
+    ne10_dct4_float32_neon (cfg->dctCfg, pDst, pFold);
+}
+
+/**
+ * Specific implementation of @ref ne10_imdct_float32 using NEON SIMD capabilities.
+ */
+void ne10_imdct_float32_neon (ne10_mdct_cfg_float32_t cfg,
+                              ne10_float32_t * pDst,
+                              ne10_float32_t * pSrc)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+    ne10_uint32_t half = nfft / 2;
+    const ne10_float32_t *pWin = cfg->pWindow;
+    ne10_float32_t *pOverlap = cfg->pOverlap;
+    ne10_float32_t *pZ = cfg->pBuffer;
+    ne10_float32_t scale = 2.0f / nfft;
+    float32x4_t q_z;
+    ne10_uint32_t n;
+
+    if (nfft < NE10_DCT_NEON_MIN_LEN)
+    {
+        ne10_imdct_float32_c (cfg, pDst, pSrc);
+        return;
+    }
+
+    ne10_dct4_float32_neon (cfg->dctCfg, pZ, pSrc);
+    for (n = 0; n < half; n += 4)
+    {
+        q_z = vmulq_n_f32 (vld1q_f32 (pZ + half + n), scale);
+        vst1q_f32 (pDst + n, vmlaq_f32 (vld1q_f32 (pOverlap + n), q_z, vld1q_f32 (pWin + n)));
+        q_z = vmulq_n_f32 (ne10_dct_reverse_neon (vld1q_f32 (pZ + nfft - 4 - n)), scale);
+        vst1q_f32 (pDst + half + n, vmlsq_f32 (vld1q_f32 (pOverlap + half + n), q_z, vld1q_f32 (pWin + half + n)));
+
+        q_z = vmulq_n_f32 (ne10_dct_reverse_neon (vld1q_f32 (pZ + half - 4 - n)), -scale);
+        vst1q_f32 (pOverlap + n, vmulq_f32 (q_z, vld1q_f32 (pWin + nfft + n)));
+        q_z = vmulq_n_f32 (vld1q_f32 (pZ + n), -scale);
+        vst1q_f32 (pOverlap + half + n, vmulq_f32 (q_z, vld1q_f32 (pWin + nfft + half + n)));
+    }
+}
+
+/* Y = M * X * M^T on 8x8 blocks: the rows of X times M^T, then M times the result */
+static void ne10_dct_8x8_kernel_float32_neon (ne10_float32_t * pDst,
+        const ne10_float32_t * pSrc,
+        const ne10_float32_t * pM,
+        const ne10_float32_t * pMT)
+{
+    float32x4_t q_tmp[8][2];
+    float32x4_t q_acc0, q_acc1;
+    ne10_int32_t i, j;
+
+    for (i = 0; i < 8; i++)
+    {
+        q_acc0 = vmulq_n_f32 (vld1q_f32 (pMT), pSrc[8 * i]);
+        q_acc1 = vmulq_n_f32 (vld1q_f32 (pMT + 4), pSrc[8 * i]);
+        for (j = 1; j < 8; j++)
+        {
+            q_acc0 = vmlaq_n_f32 (q_acc0, vld1q_f32 (pMT + 8 * j), pSrc[8 * i + j]);
+            q_acc1 = vmlaq_n_f32 (q_acc1, vld1q_f32 (pMT + 8 * j + 4), pSrc[8 * i + j]);
+        }
+        q_tmp[i][0] = q_acc0;
+        q_tmp[i][1] = q_acc1;
+    }
+    for (i = 0; i < 8; i++)
+    {
+        q_acc0 = vmulq_n_f32 (q_tmp[0][0], pM[8 * i]);
+        q_acc1 = vmulq_n_f32 (q_tmp[0][1], pM[8 * i]);
+        for (j = 1; j < 8; j++)
+        {
+            q_acc0 = vmlaq_n_f32 (q_acc0, q_tmp[j][0], pM[8 * i + j]);
+            q_acc1 = vmlaq_n_f32 (q_acc1, q_tmp[j][1], pM[8 * i + j]);
+        }
+        vst1q_f32 (pDst + 8 * i, q_acc0);
+        vst1q_f32 (pDst + 8 * i + 4, q_acc1);
+    }
+}
+
+/* Y = M * X * M^T on 4x4 blocks */
+static void ne10_dct_4x4_kernel_float32_neon (ne10_float32_t * pDst,
+        const ne10_float32_t * pSrc,
+        const ne10_float32_t * pM,
+        const ne10_float32_t * pMT)
+{
+    float32x4_t q_mt0 = vld1q_f32 (pMT);
+    float32x4_t q_mt1 = vld1q_f32 (pMT + 4);
+    float32x4_t q_mt2 = vld1q_f32 (pMT + 8);
+    float32x4_t q_mt3 = vld1q_f32 (pMT + 12);
+    float32x4_t q_tmp[4];
+    float32x4_t q_acc;
+    ne10_int32_t i;
+
+    for (i = 0; i < 4; i++)
+    {
+        q_acc = vmulq_n_f32 (q_mt0, pSrc[4 * i]);
+        q_acc = vmlaq_n_f32 (q_acc, q_mt1, pSrc[4 * i + 1]);
+        q_acc = vmlaq_n_f32 (q_acc, q_mt2, pSrc[4 * i + 2]);
+        q_tmp[i] = vmlaq_n_f32 (q_acc, q_mt3, pSrc[4 * i + 3]);
+    }
+    for (i = 0; i < 4; i++)
+    {
+        q_acc = vmulq_n_f32 (q_tmp[0], pM[4 * i]);
+        q_acc = vmlaq_n_f32 (q_acc, q_tmp[1], pM[4 * i + 1]);
+        q_acc = vmlaq_n_f32 (q_acc, q_tmp[2], pM[4 * i + 2]);
+        vst1q_f32 (pDst + 4 * i, vmlaq_n_f32 (q_acc, q_tmp[3], pM[4 * i + 3]));
+    }
+}
+
+/* Y = M * X * M^T on 8x8 blocks with a Q14 matrix, rounding after each pass */
+static void ne10_dct_8x8_kernel_int16_neon (ne10_int16_t * pDst,
+        const ne10_int16_t * pSrc,
+        const ne10_int16_t * pM,
+        const ne10_int16_t * pMT)
+{
+    int16x8_t q_mt[8];
+    int16x8_t q_tmp[8];
+    int32x4_t q_acc0, q_acc1;
+    ne10_int32_t i, j;
+
+    for (j = 0; j < 8; j++)
+    {
+        q_mt[j] = vld1q_s16 (pMT + 8 * j);
+    }
+    for (i = 0; i < 8; i++)
+    {
+        q_acc0 = vmull_n_s16 (vget_low_s16 (q_mt[0]), pSrc[8 * i]);
+        q_acc1 = vmull_n_s16 (vget_high_s16 (q_mt[0]), pSrc[8 * i]);
+        for (j = 1; j < 8; j++)
+        {
+            q_acc0 = vmlal_n_s16 (q_acc0, vget_low_s16 (q_mt[j]), pSrc[8 * i + j]);
+            q_acc1 = vmlal_n_s16 (q_acc1, vget_high_s16 (q_mt[j]), pSrc[8 * i + j]);
+        }
+        q_tmp[i] = vcombine_s16 (vqrshrn_n_s32 (q_acc0, NE10_DCT_INT16_SHIFT1), vqrshrn_n_s32 (q_acc1, NE10_DCT_INT16_SHIFT1));
+    }
+    for (i = 0; i < 8; i++)
+    {
+        q_acc0 = vmull_n_s16 (vget_low_s16 (q_tmp[0]), pM[8 * i]);
+        q_acc1 = vmull_n_s16 (vget_high_s16 (q_tmp[0]), pM[8 * i]);
+        for (j = 1; j < 8; j++)
+        {
+            q_acc0 = vmlal_n_s16 (q_acc0, vget_low_s16 (q_tmp[j]), pM[8 * i + j]);
+            q_acc1 = vmlal_n_s16 (q_acc1, vget_high_s16 (q_tmp[j]), pM[8 * i + j]);
+        }
+        vst1q_s16 (pDst + 8 * i, vcombine_s16 (vqrshrn_n_s32 (q_acc0, NE10_DCT_INT16_SHIFT2), vqrshrn_n_s32 (q_acc1, NE10_DCT_INT16_SHIFT2)));
+    }
+}
+
+/* Y = M * X * M^T on 4x4 blocks with a Q14 matrix, rounding after each pass */
+static void ne10_dct_4x4_kernel_int16_neon (ne10_int16_t * pDst,
+        const ne10_int16_t * pSrc,
+        const ne10_int16_t * pM,
+        const ne10_int16_t * pMT)
+{
+    int16x4_t d_mt0 = vld1_s16 (pMT);
+    int16x4_t d_mt1 = vld1_s16 (pMT + 4);
+    int16x4_t d_mt2 = vld1_s16 (pMT + 8);
+    int16x4_t d_mt3 = vld1_s16 (pMT + 12);
+    int16x4_t d_tmp[4];
+    int32x4_t q_acc;
+    ne10_int32_t i;
+
+    for (i = 0; i < 4; i++)
+    {
+        q_acc = vmull_n_s16 (d_mt0, pSrc[4 * i]);
+        q_acc = vmlal_n_s16 (q_acc, d_mt1, pSrc[4 * i + 1]);
+        q_acc = vmlal_n_s16 (q_acc, d_mt2, pSrc[4 * i + 2]);
+        q_acc = vmlal_n_s16 (q_acc, d_mt3, pSrc[4 * i + 3]);
+        d_tmp[i] = vqrshrn_n_s32 (q_acc, NE10_DCT_INT16_SHIFT1);
+    }
+    for (i = 0; i < 4; i++)
+    {
+        q_acc = vmull_n_s16 (d_tmp[0], pM[4 * i]);
+        q_acc = vmlal_n_s16 (q_acc, d_tmp[1], pM[4 * i + 1]);
+        q_acc = vmlal_n_s16 (q_acc, d_tmp[2], pM[4 * i + 2]);
+        q_acc = vmlal_n_s16 (q_acc, d_tmp[3], pM[4 * i + 3]);
+        vst1_s16 (pDst + 4 * i, vqrshrn_n_s32 (q_acc, NE10_DCT_INT16_SHIFT2));
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_dct_8x8_float32 using NEON SIMD capabilities.
+ */
+void ne10_dct_8x8_float32_neon (ne10_float32_t * pDst, const ne10_float32_t * pSrc)
+{
+    ne10_dct_8x8_kernel_float32_neon (pDst, pSrc, ne10_dct_8x8_coeff_float32, ne10_dct_8x8_coeff_t_float32);
+}
+
+/**
+ * Specific implementation of @ref ne10_idct_8x8_float32 using NEON SIMD capabilities.
+ */
+void ne10_idct_8x8_float32_neon (ne10_float32_t * pDst, const ne10_float32_t * pSrc)
+{
+    ne10_dct_8x8_kernel_float32_neon (pDst, pSrc, ne10_dct_8x8_coeff_t_float32, ne10_dct_8x8_coeff_float32);
+}
+
+/**
+ * Specific implementation of @ref ne10_dct_4x4_float32 using NEON SIMD capabilities.
+ */
+void ne10_dct_4x4_float32_neon (ne10_float32_t * pDst, const ne10_float32_t * pSrc)
+{
+    ne10_dct_4x4_kernel_float32_neon (pDst, pSrc, ne10_dct_4x4_coeff_float32, ne10_dct_4x4_coeff_t_float32);
+}
+
+/**
+ * Specific implementation of @ref ne10_idct_4x4_float32 using NEON SIMD capabilities.
+ */
+void ne10_idct_4x4_float32_neon (ne10_float32_t * pDst, const ne10_float32_t * pSrc)
+{
+    ne10_dct_4x4_kernel_float32_neon (pDst, pSrc, ne10_dct_4x4_coeff_t_float32, ne10_dct_4x4_coeff_float32);
+}
+
+/**
+ * Specific implementation of @ref ne10_dct_8x8_int16 using NEON SIMD capabilities.
+ */
+void ne10_dct_8x8_int16_neon (ne10_int16_t * pDst, const ne10_int16_t * pSrc)
+{
+    ne10_dct_8x8_kernel_int16_neon (pDst, pSrc, ne10_dct_8x8_coeff_int16, ne10_dct_8x8_coeff_t_int16);
+}
+
+/**
+ * Specific implementation of @ref ne10_idct_8x8_int16 using NEON SIMD capabilities.
+ */
+void ne10_idct_8x8_int16_neon (ne10_int16_t * pDst, const ne10_int16_t * pSrc)
+{
+    ne10_dct_8x8_kernel_int16_neon (pDst, pSrc, ne10_dct_8x8_coeff_t_int16, ne10_dct_8x8_coeff_int16);
+}
+
+/**
+ * Specific implementation of @ref ne10_dct_4x4_int16 using NEON SIMD capabilities.
+ */
+void ne10_dct_4x4_int16_neon (ne10_int16_t * pDst, const ne10_int16_t * pSrc)
+{
+    ne10_dct_4x4_kernel_int16_neon (pDst, pSrc, ne10_dct_4x4_coeff_int16, ne10_dct_4x4_coeff_t_int16);
+}
+
+/**
+ * Specific implementation of @ref ne10_idct_4x4_int16 using NEON SIMD capabilities.
+ */
+void ne10_idct_4x4_int16_neon (ne10_int16_t * pDst, const ne10_int16_t * pSrc)
+{
+    ne10_dct_4x4_kernel_int16_neon (pDst, pSrc, ne10_dct_4x4_coeff_t_int16, ne10_dct_4x4_coeff_int16);
+}
+/** @} */ //end of DCT group
@@ -346,30 +346,29 @@ ne10_fft_cpx_float32_t* ne10_fft_generate_twiddles_transposed_float32 (
  * @{
  */
 
-/** Specific implementation of @ref ne10_fft_alloc_c2c_float32 for @ref ne10_fft_c2c_1d_float32_neon. */
-ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_neon (ne10_int32_t nfft)
+/**
+ * @brief Returns the number of bytes needed by @ref ne10_fft_alloc_c2c_float32_inplace.
+ *
+ * @param[in]   nfft             input length
+ *
+ * The size is the same for the C and NEON configurations.
+ */
+ne10_uint32_t ne10_fft_alloc_c2c_float32_size (ne10_int32_t nfft)
 {
-    // For input shorter than 15, fall back to c version.
-    // We would not get much improvement from NEON for these cases.
-    if (nfft < 15)
-    {
-        return ne10_fft_alloc_c2c_float32_c (nfft);
-    }
-
-    ne10_fft_cfg_float32_t st = NULL;
-    ne10_uint32_t memneeded = sizeof (ne10_fft_state_float32_t)
-                              + sizeof (ne10_int32_t) * (NE10_MAXFACTORS * 2) /* factors */
-                              + sizeof (ne10_fft_cpx_float32_t) * nfft       /* twiddles */
-                              + sizeof (ne10_fft_cpx_float32_t) * nfft         /* buffer */
-                              + NE10_FFT_BYTE_ALIGNMENT;             /* 64-bit alignment */
-
-    st = (ne10_fft_cfg_float32_t) NE10_MALLOC (memneeded);
+    return sizeof (ne10_fft_state_float32_t)
+           + sizeof (ne10_int32_t) * (NE10_MAXFACTORS * 2) /* factors */
+           + sizeof (ne10_fft_cpx_float32_t) * nfft       /* twiddles */
+           + sizeof (ne10_fft_cpx_float32_t) * nfft         /* buffer */
+           + NE10_FFT_BYTE_ALIGNMENT;             /* 64-bit alignment */
+}
 
-    // Bad allocation.
-    if (st == NULL)
-    {
-        return NULL;
-    }
+/*
+ * Sets up a configuration structure for ne10_fft_c2c_1d_float32_neon in mem, which must hold
+ * ne10_fft_alloc_c2c_float32_size (nfft) bytes. Returns NULL if nfft is not supported.
+ */
+static ne10_fft_cfg_float32_t ne10_fft_init_c2c_float32_neon (void *mem, ne10_int32_t nfft)
+{
+    ne10_fft_cfg_float32_t st = (ne10_fft_cfg_float32_t) mem;
 
     // Only backward FFT is scaled by default.
     st->is_forward_scaled = 0;
@@ -398,7 +397,6 @@ ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_neon (ne10_int32_t nfft)
     // Cannot factor
     if (result == NE10_ERR)
     {
-        NE10_FREE (st);
         return NULL;
     }
 
@@ -409,7 +407,6 @@ ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_neon (ne10_int32_t nfft)
     {
         if (nfft % NE10_FFT_PARA_LEVEL)
         {
-            NE10_FREE (st);
             return NULL;
         }
 
@@ -433,7 +430,6 @@ ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_neon (ne10_int32_t nfft)
             // Adjust the factoring for a size "nfft / 4" FFT to work for size "nfft"
             if (stage_count > NE10_MAXFACTORS - 4)
             {
-                NE10_FREE (st);
                 return NULL;
             }
             st->factors[0]++;          // Bump the stage count
@@ -449,6 +445,49 @@ ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_neon (ne10_int32_t nfft)
     return st;
 }
 
+/** Specific implementation of @ref ne10_fft_alloc_c2c_float32 for @ref ne10_fft_c2c_1d_float32_neon. */
+ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_neon (ne10_int32_t nfft)
+{
+    // For input shorter than 15, fall back to c version.
+    // We would not get much improvement from NEON for these cases.
+    if (nfft < 15)
+    {
+        return ne10_fft_alloc_c2c_float32_c (nfft);
+    }
+
+    ne10_fft_cfg_float32_t st = NULL;
+    void *mem = NE10_MALLOC (ne10_fft_alloc_c2c_float32_size (nfft));
+
+    // Bad allocation.
+    if (mem == NULL)
+    {
+        return NULL;
+    }
+
+    st = ne10_fft_init_c2c_float32_neon (mem, nfft);
+    if (st == NULL)
+    {
+        NE10_FREE (mem);
+    }
+    return st;
+}
+
+/** Specific implementation of @ref ne10_fft_alloc_c2c_float32_inplace for @ref ne10_fft_c2c_1d_float32_neon. */
+ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_inplace_neon (void *mem, ne10_uint32_t mem_size, ne10_int32_t nfft)
+{
+    // The same fall back as ne10_fft_alloc_c2c_float32_neon
+    if (nfft < 15)
+    {
+        return ne10_fft_alloc_c2c_float32_inplace_c (mem, mem_size, nfft);
+    }
+
+    if (mem == NULL || mem_size < ne10_fft_alloc_c2c_float32_size (nfft))
+    {
+        return NULL;
+    }
+    return ne10_fft_init_c2c_float32_neon (mem, nfft);
+}
+
 /** Specific implementation of @ref ne10_fft_alloc_c2c_int32 for @ref ne10_fft_c2c_1d_int32_neon. */
 ne10_fft_cfg_int32_t ne10_fft_alloc_c2c_int32_neon (ne10_int32_t nfft)
 {
@@ -557,7 +596,7 @@ ne10_fft_cfg_int32_t ne10_fft_alloc_c2c_int32_neon (ne10_int32_t nfft)
  */
 void ne10_fft_destroy_c2c_float32 (ne10_fft_cfg_float32_t cfg)
 {
-    free(cfg);
+    NE10_FREE (cfg);
 }
 
 /**
@@ -567,7 +606,7 @@ void ne10_fft_destroy_c2c_float32 (ne10_fft_cfg_float32_t cfg)
  */
 void ne10_fft_destroy_c2c_int32 (ne10_fft_cfg_int32_t cfg)
 {
-    free (cfg);
+    NE10_FREE (cfg);
 }
 
 /**
@@ -577,7 +616,7 @@ void ne10_fft_destroy_c2c_int32 (ne10_fft_cfg_int32_t cfg)
  */
 void ne10_fft_destroy_c2c_int16 (ne10_fft_cfg_int16_t cfg)
 {
-    free (cfg);
+    NE10_FREE (cfg);
 }
 
 /** @} */ // C2C_FFT_IFFT
@@ -594,7 +633,7 @@ void ne10_fft_destroy_c2c_int16 (ne10_fft_cfg_int16_t cfg)
  */
 void ne10_fft_destroy_r2c_float32 (ne10_fft_r2c_cfg_float32_t cfg)
 {
-    free(cfg);
+    NE10_FREE (cfg);
 }
 
 /**
@@ -604,7 +643,7 @@ void ne10_fft_destroy_r2c_float32 (ne10_fft_r2c_cfg_float32_t cfg)
  */
 void ne10_fft_destroy_r2c_int32 (ne10_fft_r2c_cfg_int32_t cfg)
 {
-    free (cfg);
+    NE10_FREE (cfg);
 }
 
 /**
@@ -614,7 +653,7 @@ void ne10_fft_destroy_r2c_int32 (ne10_fft_r2c_cfg_int32_t cfg)
  */
 void ne10_fft_destroy_r2c_int16 (ne10_fft_r2c_cfg_int16_t cfg)
 {
-    free (cfg);
+    NE10_FREE (cfg);
 }
 
 /** @} */ // R2C_FFT_IFFT
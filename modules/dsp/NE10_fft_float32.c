@@ -822,25 +822,13 @@ static void ne10_fft_split_c2r_1d_float32 (ne10_fft_cpx_float32_t *dst,
     }
 }
 
-/**
- * @ingroup C2C_FFT_IFFT
- * Specific implementation of @ref ne10_fft_alloc_c2c_float32 for @ref ne10_fft_c2c_1d_float32_c.
+/*
+ * Sets up a configuration structure for ne10_fft_c2c_1d_float32_c in mem, which must hold
+ * ne10_fft_alloc_c2c_float32_size (nfft) bytes. Returns NULL if nfft cannot be factored.
  */
-ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_c (ne10_int32_t nfft)
+static ne10_fft_cfg_float32_t ne10_fft_init_c2c_float32_c (void *mem, ne10_int32_t nfft)
 {
-    ne10_fft_cfg_float32_t st = NULL;
-    ne10_uint32_t memneeded = sizeof (ne10_fft_state_float32_t)
-                              + sizeof (ne10_int32_t) * (NE10_MAXFACTORS * 2) /* factors */
-                              + sizeof (ne10_fft_cpx_float32_t) * nfft       /* twiddles */
-                              + sizeof (ne10_fft_cpx_float32_t) * nfft         /* buffer */
-                              + NE10_FFT_BYTE_ALIGNMENT;             /* 64-bit alignment */
-
-    st = (ne10_fft_cfg_float32_t) NE10_MALLOC (memneeded);
-
-    if (st == NULL)
-    {
-        return st;
-    }
+    ne10_fft_cfg_float32_t st = (ne10_fft_cfg_float32_t) mem;
 
     // Only backward FFT is scaled by default.
     st->is_forward_scaled = 0;
@@ -857,7 +845,6 @@ ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_c (ne10_int32_t nfft)
     result = ne10_factor (nfft, st->factors, NE10_FACTOR_EIGHT_FIRST_STAGE);
     if (result == NE10_ERR)
     {
-        NE10_FREE (st);
         return NULL;
     }
 
@@ -871,7 +858,6 @@ ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_c (ne10_int32_t nfft)
             result = ne10_factor (st->nfft, st->factors, NE10_FACTOR_DEFAULT);
             if (result == NE10_ERR)
             {
-                NE10_FREE (st);
                 return NULL;
             }
         }
@@ -882,6 +868,41 @@ ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_c (ne10_int32_t nfft)
     return st;
 }
 
+/**
+ * @ingroup C2C_FFT_IFFT
+ * Specific implementation of @ref ne10_fft_alloc_c2c_float32 for @ref ne10_fft_c2c_1d_float32_c.
+ */
+ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_c (ne10_int32_t nfft)
+{
+    ne10_fft_cfg_float32_t st = NULL;
+    void *mem = NE10_MALLOC (ne10_fft_alloc_c2c_float32_size (nfft));
+
+    if (mem == NULL)
+    {
+        return NULL;
+    }
+
+    st = ne10_fft_init_c2c_float32_c (mem, nfft);
+    if (st == NULL)
+    {
+        NE10_FREE (mem);
+    }
+    return st;
+}
+
+/**
+ * @ingroup C2C_FFT_IFFT
+ * Specific implementation of @ref ne10_fft_alloc_c2c_float32_inplace for @ref ne10_fft_c2c_1d_float32_c.
+ */
+ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_inplace_c (void *mem, ne10_uint32_t mem_size, ne10_int32_t nfft)
+{
+    if (mem == NULL || mem_size < ne10_fft_alloc_c2c_float32_size (nfft))
+    {
+        return NULL;
+    }
+    return ne10_fft_init_c2c_float32_c (mem, nfft);
+}
+
 /**
  * @ingroup C2C_FFT_IFFT
  * Specific implementation of @ref ne10_fft_c2c_1d_float32 using plain C.
@@ -932,7 +953,7 @@ void ne10_fft_c2c_1d_float32_c (ne10_fft_cpx_float32_t *fout,
  * @brief Creates a configuration structure for variants of @ref ne10_fft_r2c_1d_float32 and @ref ne10_fft_c2r_1d_float32.
  *
  * @param[in]   nfft             input length
- * @retval      st               pointer to an FFT configuration structure (allocated with `malloc`), or `NULL` to indicate an error
+ * @retval      st               pointer to an FFT configuration structure (allocated with `NE10_MALLOC`), or `NULL` to indicate an error
  *
  * Allocates and initialises an @ref ne10_fft_r2c_cfg_float32_t configuration structure for
  * the FP32 real-to-complex and complex-to-real FFT/IFFT. As part of this, it reserves a buffer used
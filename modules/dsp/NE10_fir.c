@@ -1373,6 +1373,21 @@ static void ne10_circular_read_float (ne10_int32_t * circBuffer,
  *ne10_fir_sparse_instance_f32_t S = {numTaps, 0, pState, pCoeffs, maxDelay, pTapDelay};
  * </pre>
  *
+ * \par Linear Delay Line
+ * @ref ne10_fir_sparse_float copies every tap's block out of a circular buffer, which costs a modulo
+ * per sample and a pass over the output per tap. For filters with many taps, such as echo path models,
+ * @ref ne10_fir_sparse_linear_float computes the same output with a different organisation:
+ * - @ref ne10_fir_sparse_linear_init_float sorts the taps by increasing delay, so that consecutive taps
+ *   read neighbouring parts of the delay line.
+ * - The delay line of length <code>maxDelay + blockSize</code> is followed by a copy of its first
+ *   <code>blockSize</code> words. Every tap then reads one contiguous block, and the wraparound is handled
+ *   once per tap instead of once per sample.
+ * - Taps are processed four at a time, which reads and writes the output once for every four taps.
+ * \par
+ * <code>pState</code> is of length <code>maxDelay + 2*blockSize</code>. <code>pSortedCoeffs</code> and
+ * <code>pSortedTapDelay</code> receive the sorted taps and are of length <code>numTaps</code>; they may
+ * be shared between instances with the same taps.
+ *
  */
 
 /**
@@ -1547,4 +1562,231 @@ void ne10_fir_sparse_float_c (ne10_fir_sparse_instance_f32_t * S,
     }
 
 }
+
+/* Start of the block of samples x[n-delay] in the linear delay line */
+static inline ne10_float32_t * ne10_fir_sparse_tap_ptr (ne10_float32_t * pState,
+        ne10_int32_t writeIndex,
+        ne10_int32_t delaySize,
+        ne10_int32_t delay)
+{
+    ne10_int32_t readIndex = writeIndex - delay;
+    return pState + ( (readIndex < 0) ? readIndex + delaySize : readIndex);
+}
+
+/**
+ * Specific implementation of @ref ne10_fir_sparse_linear_float using plain C.
+ */
+void ne10_fir_sparse_linear_float_c (ne10_fir_sparse_linear_instance_f32_t * S,
+                                     ne10_float32_t * pSrc,
+                                     ne10_float32_t * pDst,
+                                     ne10_uint32_t blockSize)
+{
+    ne10_float32_t *pState = S->pState;                 /* State pointer */
+    ne10_float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+    ne10_int32_t *pTapDelay = S->pTapDelay;             /* Tap delays, in increasing order */
+    ne10_float32_t *px0, *px1, *px2, *px3;              /* Read pointers of the current taps */
+    ne10_float32_t c0, c1, c2, c3;                      /* Coefficients of the current taps */
+    ne10_int32_t delaySize = (ne10_int32_t) S->delaySize;
+    ne10_int32_t writeIndex = (ne10_int32_t) S->writeIndex;
+    ne10_int32_t stateIndex;
+    ne10_uint32_t tapCnt, i;
+
+    /* Write the new samples; the first blockSize words are mirrored after the end of the delay line */
+    stateIndex = writeIndex;
+    for (i = 0; i < blockSize; i++)
+    {
+        pState[stateIndex] = pSrc[i];
+        if (stateIndex < (ne10_int32_t) S->blockSize)
+        {
+            pState[stateIndex + delaySize] = pSrc[i];
+        }
+        if (++stateIndex == delaySize)
+        {
+            stateIndex = 0;
+        }
+    }
+
+    for (i = 0; i < blockSize; i++)
+    {
+        pDst[i] = 0.0f;
+    }
+
+    /* Four taps per pass over the output */
+    tapCnt = S->numTaps >> 2;
+    while (tapCnt > 0u)
+    {
+        c0 = pCoeffs[0];
+        c1 = pCoeffs[1];
+        c2 = pCoeffs[2];
+        c3 = pCoeffs[3];
+        px0 = ne10_fir_sparse_tap_ptr (pState, writeIndex, delaySize, pTapDelay[0]);
+        px1 = ne10_fir_sparse_tap_ptr (pState, writeIndex, delaySize, pTapDelay[1]);
+        px2 = ne10_fir_sparse_tap_ptr (pState, writeIndex, delaySize, pTapDelay[2]);
+        px3 = ne10_fir_sparse_tap_ptr (pState, writeIndex, delaySize, pTapDelay[3]);
+
+        for (i = 0; i < blockSize; i++)
+        {
+            pDst[i] += c0 * px0[i] + c1 * px1[i] + c2 * px2[i] + c3 * px3[i];
+        }
+
+        pCoeffs += 4;
+        pTapDelay += 4;
+        tapCnt--;
+    }
+
+    tapCnt = S->numTaps & 0x3u;
+    while (tapCnt > 0u)
+    {
+        c0 = *pCoeffs++;
+        px0 = ne10_fir_sparse_tap_ptr (pState, writeIndex, delaySize, *pTapDelay++);
+
+        for (i = 0; i < blockSize; i++)
+        {
+            pDst[i] += c0 * px0[i];
+        }
+        tapCnt--;
+    }
+
+    writeIndex += (ne10_int32_t) blockSize;
+    if (writeIndex >= delaySize)
+    {
+        writeIndex -= delaySize;
+    }
+    S->writeIndex = (ne10_uint32_t) writeIndex;
+}
 /** @} */ //end of FIR_sparse group
+
+/**
+ * @ingroup groupDSPs
+ * @defgroup FIR_Halfband Finite Impulse Response (FIR) Halfband Decimation and Interpolation
+ *
+ * \par
+ * A halfband filter is a linear phase lowpass FIR filter with its cutoff at a quarter of the
+ * sampling frequency. Its length is <code>numTaps = 4*K-1</code> and, apart from the center tap
+ * <code>b[c]</code> (<code>c = 2*K-1</code>), every tap at an even distance from the center is zero:
+ * <pre>
+ *    b[c-2] = b[c-4] = ... = 0,   b[c-j] = b[c+j]
+ * </pre>
+ * The functions in this group decimate or interpolate by 2 with such a filter. They skip the
+ * zero taps and add the symmetric samples before multiplying, so each output of the decimator costs
+ * <code>K+1</code> multiplications instead of the <code>numTaps</code> of @ref ne10_fir_decimate_float,
+ * and the interpolator computes one of its two phases as a plain delay.
+ *
+ * \par Algorithm:
+ * <pre>
+ *    decimation:     y[m]    = b[c] * x[2m-c] + b[c-1] * (x[2m-c+1] + x[2m-c-1]) + b[c-3] * (x[2m-c+3] + x[2m-c-3]) + ...
+ *    interpolation:  y[2n]   = b[c-1] * (x[n-K+1] + x[n-K]) + b[c-3] * (x[n-K+2] + x[n-K-1]) + ...
+ *                    y[2n+1] = b[c] * x[n-K+1]
+ * </pre>
+ * These are the outputs of @ref ne10_fir_decimate_float with <code>M = 2</code> and of
+ * @ref ne10_fir_interpolate_float with <code>L = 2</code> (for the latter, after appending a zero tap).
+ * As for the other FIR filters the interpolation filter should have a passband gain of 2.
+ * \par
+ * <code>pCoeffs</code> points to the full array of <code>numTaps</code> coefficients; only the center
+ * tap and the taps <code>b[c-1], b[c-3], ..., b[0]</code> are read.
+ * <code>pState</code> points to a state array of size <code>numTaps + blockSize - 1</code> for decimation
+ * and <code>(numTaps - 1)/2 + blockSize</code> for interpolation.
+ *
+ * \par
+ * @ref ne10_fir_decimate_cascade_alloc_float and @ref ne10_fir_interpolate_cascade_alloc_float chain
+ * several halfband stages with one general FIR stage, for rate changes such as 64 to 512 that
+ * do not fit in the 8-bit factor of the general FIR decimator and interpolator.
+ */
+
+/**
+ * @addtogroup FIR_Halfband
+ * @{
+ */
+
+/**
+ * Specific implementation of @ref ne10_fir_halfband_decimate_float using plain C.
+ */
+void ne10_fir_halfband_decimate_float_c (const ne10_fir_halfband_instance_f32_t * S,
+        ne10_float32_t * pSrc,
+        ne10_float32_t * pDst,
+        ne10_uint32_t blockSize)
+{
+    ne10_float32_t *pState = S->pState;                 /* State pointer */
+    ne10_float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+    ne10_float32_t *px;                                 /* Temporary pointer for the state buffer */
+    ne10_float32_t sum0;                                /* Accumulator */
+    ne10_uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+    ne10_uint32_t c = numTaps >> 1;                     /* Index of the center tap */
+    ne10_uint32_t i, j, blkCnt;                         /* Loop counters */
+
+    /* S->pState buffer contains previous frame (numTaps - 1) samples */
+    for (i = 0; i < blockSize; i++)
+    {
+        pState[numTaps - 1u + i] = pSrc[i];
+    }
+
+    blkCnt = blockSize >> 1;
+    px = pState;
+    while (blkCnt > 0u)
+    {
+        /* Center tap, then the pairs of symmetric taps at odd distances */
+        sum0 = pCoeffs[c] * px[c];
+        for (j = 1; j <= c; j += 2)
+        {
+            sum0 += pCoeffs[c - j] * (px[c - j] + px[c + j]);
+        }
+        *pDst++ = sum0;
+
+        /* Advance the state pointer by the decimation factor */
+        px += 2;
+        blkCnt--;
+    }
+
+    /* Copy the last numTaps - 1 samples to the start of the state buffer */
+    for (i = 0; i < numTaps - 1u; i++)
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_fir_halfband_interpolate_float using plain C.
+ */
+void ne10_fir_halfband_interpolate_float_c (const ne10_fir_halfband_instance_f32_t * S,
+        ne10_float32_t * pSrc,
+        ne10_float32_t * pDst,
+        ne10_uint32_t blockSize)
+{
+    ne10_float32_t *pState = S->pState;                 /* State pointer */
+    ne10_float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+    ne10_float32_t *px;                                 /* Temporary pointer for the state buffer */
+    ne10_float32_t sum0;                                /* Accumulator */
+    ne10_uint32_t K = (S->numTaps + 1u) >> 2;           /* Number of non-zero side taps */
+    ne10_uint32_t c = 2u * K - 1u;                      /* Index of the center tap */
+    ne10_uint32_t histLen = 2u * K - 1u;                /* Number of samples kept between calls */
+    ne10_uint32_t i, k, blkCnt;                         /* Loop counters */
+
+    for (i = 0; i < blockSize; i++)
+    {
+        pState[histLen + i] = pSrc[i];
+    }
+
+    /* px[j] = x[n-2K+1+j] */
+    blkCnt = blockSize;
+    px = pState;
+    while (blkCnt > 0u)
+    {
+        sum0 = 0.0f;
+        for (k = 1; k <= K; k++)
+        {
+            sum0 += pCoeffs[c - (2u * k - 1u)] * (px[K - 1u + k] + px[K - k]);
+        }
+        pDst[0] = sum0;
+        pDst[1] = pCoeffs[c] * px[K];
+
+        pDst += 2;
+        px++;
+        blkCnt--;
+    }
+
+    for (i = 0; i < histLen; i++)
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
+/** @} */ //end of FIR_Halfband group
@@ -0,0 +1,299 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_fir.neonintrinsic.c
+ */
+
+#include <arm_neon.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_dsp.h"
+
+/**
+ * @addtogroup FIR_Halfband
+ * @{
+ */
+
+/**
+ * Specific implementation of @ref ne10_fir_halfband_decimate_float using NEON SIMD capabilities.
+ */
+void ne10_fir_halfband_decimate_float_neon (const ne10_fir_halfband_instance_f32_t * S,
+        ne10_float32_t * pSrc,
+        ne10_float32_t * pDst,
+        ne10_uint32_t blockSize)
+{
+    ne10_float32_t *pState = S->pState;
+    ne10_float32_t *pCoeffs = S->pCoeffs;
+    ne10_float32_t *px;
+    ne10_float32_t sum0;
+    ne10_uint32_t numTaps = S->numTaps;
+    ne10_uint32_t c = numTaps >> 1;
+    ne10_uint32_t i, j, blkCnt;
+    float32x4_t q_acc, q_lo, q_hi;
+
+    for (i = 0; i < blockSize; i++)
+    {
+        pState[numTaps - 1u + i] = pSrc[i];
+    }
+
+    /* Four outputs per iteration: the even lanes of a de-interleaving load are the samples
+     * at the same tap position of four consecutive outputs */
+    blkCnt = blockSize >> 3;
+    px = pState;
+    while (blkCnt > 0u)
+    {
+        q_acc = vmulq_n_f32 (vld2q_f32 (px + c).val[0], pCoeffs[c]);
+        for (j = 1; j <= c; j += 2)
+        {
+            q_lo = vld2q_f32 (px + c - j).val[0];
+            q_hi = vld2q_f32 (px + c + j).val[0];
+            q_acc = vmlaq_n_f32 (q_acc, vaddq_f32 (q_lo, q_hi), pCoeffs[c - j]);
+        }
+        vst1q_f32 (pDst, q_acc);
+
+        pDst += 4;
+        px += 8;
+        blkCnt--;
+    }
+
+    blkCnt = (blockSize >> 1) & 0x3u;
+    while (blkCnt > 0u)
+    {
+        sum0 = pCoeffs[c] * px[c];
+        for (j = 1; j <= c; j += 2)
+        {
+            sum0 += pCoeffs[c - j] * (px[c - j] + px[c + j]);
+        }
+        *pDst++ = sum0;
+
+        px += 2;
+        blkCnt--;
+    }
+
+    for (i = 0; i < numTaps - 1u; i++)
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_fir_halfband_interpolate_float using NEON SIMD capabilities.
+ */
+void ne10_fir_halfband_interpolate_float_neon (const ne10_fir_halfband_instance_f32_t * S,
+        ne10_float32_t * pSrc,
+        ne10_float32_t * pDst,
+        ne10_uint32_t blockSize)
+{
+    ne10_float32_t *pState = S->pState;
+    ne10_float32_t *pCoeffs = S->pCoeffs;
+    ne10_float32_t *px;
+    ne10_float32_t sum0;
+    ne10_uint32_t K = (S->numTaps + 1u) >> 2;
+    ne10_uint32_t c = 2u * K - 1u;
+    ne10_uint32_t histLen = 2u * K - 1u;
+    ne10_uint32_t i, k, blkCnt;
+    float32x4x2_t q2_out;
+
+    for (i = 0; i < blockSize; i++)
+    {
+        pState[histLen + i] = pSrc[i];
+    }
+
+    /* Four input samples per iteration, the two output phases are interleaved on store */
+    blkCnt = blockSize >> 2;
+    px = pState;
+    while (blkCnt > 0u)
+    {
+        q2_out.val[0] = vdupq_n_f32 (0.0f);
+        for (k = 1; k <= K; k++)
+        {
+            q2_out.val[0] = vmlaq_n_f32 (q2_out.val[0],
+                                         vaddq_f32 (vld1q_f32 (px + K - 1u + k), vld1q_f32 (px + K - k)),
+                                         pCoeffs[c - (2u * k - 1u)]);
+        }
+        q2_out.val[1] = vmulq_n_f32 (vld1q_f32 (px + K), pCoeffs[c]);
+        vst2q_f32 (pDst, q2_out);
+
+        pDst += 8;
+        px += 4;
+        blkCnt--;
+    }
+
+    blkCnt = blockSize & 0x3u;
+    while (blkCnt > 0u)
+    {
+        sum0 = 0.0f;
+        for (k = 1; k <= K; k++)
+        {
+            sum0 += pCoeffs[c - (2u * k - 1u)] * (px[K - 1u + k] + px[K - k]);
+        }
+        pDst[0] = sum0;
+        pDst[1] = pCoeffs[c] * px[K];
+
+        pDst += 2;
+        px++;
+        blkCnt--;
+    }
+
+    for (i = 0; i < histLen; i++)
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
+/** @} */ //end of FIR_Halfband group
+
+/**
+ * @addtogroup FIR_Sparse
+ * @{
+ */
+
+static inline ne10_float32_t * ne10_fir_sparse_tap_ptr_neon (ne10_float32_t * pState,
+        ne10_int32_t writeIndex,
+        ne10_int32_t delaySize,
+        ne10_int32_t delay)
+{
+    ne10_int32_t readIndex = writeIndex - delay;
+    return pState + ( (readIndex < 0) ? readIndex + delaySize : readIndex);
+}
+
+/**
+ * Specific implementation of @ref ne10_fir_sparse_linear_float using NEON SIMD capabilities.
+ */
+void ne10_fir_sparse_linear_float_neon (ne10_fir_sparse_linear_instance_f32_t * S,
+                                        ne10_float32_t * pSrc,
+                                        ne10_float32_t * pDst,
+                                        ne10_uint32_t blockSize)
+{
+    ne10_float32_t *pState = S->pState;
+    ne10_float32_t *pCoeffs = S->pCoeffs;
+    ne10_int32_t *pTapDelay = S->pTapDelay;
+    ne10_float32_t *px0, *px1, *px2, *px3;
+    ne10_float32_t c0, c1, c2, c3;
+    ne10_int32_t delaySize = (ne10_int32_t) S->delaySize;
+    ne10_int32_t writeIndex = (ne10_int32_t) S->writeIndex;
+    ne10_int32_t stateIndex;
+    ne10_uint32_t tapCnt, i;
+    ne10_uint32_t blkCnt4 = blockSize & ~0x3u;
+    float32x4_t q_acc;
+    float32x4_t q_zero = vdupq_n_f32 (0.0f);
+
+    /* Write the new samples as contiguous runs, mirroring the head of the delay line */
+    stateIndex = writeIndex;
+    i = 0;
+    while (i < blockSize)
+    {
+        ne10_uint32_t run = NE10_MIN (blockSize - i, (ne10_uint32_t) (delaySize - stateIndex));
+        ne10_uint32_t k;
+        for (k = 0; k < run; k++)
+        {
+            pState[stateIndex + k] = pSrc[i + k];
+        }
+        if (stateIndex < (ne10_int32_t) S->blockSize)
+        {
+            ne10_uint32_t mirror = NE10_MIN (run, S->blockSize - (ne10_uint32_t) stateIndex);
+            for (k = 0; k < mirror; k++)
+            {
+                pState[stateIndex + delaySize + k] = pSrc[i + k];
+            }
+        }
+        i += run;
+        stateIndex += run;
+        if (stateIndex == delaySize)
+        {
+            stateIndex = 0;
+        }
+    }
+
+    for (i = 0; i < blkCnt4; i += 4)
+    {
+        vst1q_f32 (pDst + i, q_zero);
+    }
+    for (; i < blockSize; i++)
+    {
+        pDst[i] = 0.0f;
+    }
+
+    /* Four taps per pass: each output vector is loaded and stored once per four taps */
+    tapCnt = S->numTaps >> 2;
+    while (tapCnt > 0u)
+    {
+        c0 = pCoeffs[0];
+        c1 = pCoeffs[1];
+        c2 = pCoeffs[2];
+        c3 = pCoeffs[3];
+        px0 = ne10_fir_sparse_tap_ptr_neon (pState, writeIndex, delaySize, pTapDelay[0]);
+        px1 = ne10_fir_sparse_tap_ptr_neon (pState, writeIndex, delaySize, pTapDelay[1]);
+        px2 = ne10_fir_sparse_tap_ptr_neon (pState, writeIndex, delaySize, pTapDelay[2]);
+        px3 = ne10_fir_sparse_tap_ptr_neon (pState, writeIndex, delaySize, pTapDelay[3]);
+
+        for (i = 0; i < blkCnt4; i += 4)
+        {
+            q_acc = vld1q_f32 (pDst + i);
+            q_acc = vmlaq_n_f32 (q_acc, vld1q_f32 (px0 + i), c0);
+            q_acc = vmlaq_n_f32 (q_acc, vld1q_f32 (px1 + i), c1);
+            q_acc = vmlaq_n_f32 (q_acc, vld1q_f32 (px2 + i), c2);
+            q_acc = vmlaq_n_f32 (q_acc, vld1q_f32 (px3 + i), c3);
+            vst1q_f32 (pDst + i, q_acc);
+        }
+        for (; i < blockSize; i++)
+        {
+            pDst[i] += c0 * px0[i] + c1 * px1[i] + c2 * px2[i] + c3 * px3[i];
+        }
+
+        pCoeffs += 4;
+        pTapDelay += 4;
+        tapCnt--;
+    }
+
+    tapCnt = S->numTaps & 0x3u;
+    while (tapCnt > 0u)
+    {
+        c0 = *pCoeffs++;
+        px0 = ne10_fir_sparse_tap_ptr_neon (pState, writeIndex, delaySize, *pTapDelay++);
+
+        for (i = 0; i < blkCnt4; i += 4)
+        {
+            q_acc = vmlaq_n_f32 (vld1q_f32 (pDst + i), vld1q_f32 (px0 + i), c0);
+            vst1q_f32 (pDst + i, q_acc);
+        }
+        for (; i < blockSize; i++)
+        {
+            pDst[i] += c0 * px0[i];
+        }
+        tapCnt--;
+    }
+
+    writeIndex += (ne10_int32_t) blockSize;
+    if (writeIndex >= delaySize)
+    {
+        writeIndex -= delaySize;
+    }
+    S->writeIndex = (ne10_uint32_t) writeIndex;
+}
+/** @} */ //end of FIR_Sparse group
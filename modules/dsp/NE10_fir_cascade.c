@@ -0,0 +1,341 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_fir_cascade.c
+ */
+
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_dsp.h"
+
+/**
+ * @addtogroup FIR_Halfband
+ * @{
+ */
+
+typedef void (*ne10_fir_halfband_func_t) (const ne10_fir_halfband_instance_f32_t * S,
+        ne10_float32_t * pSrc,
+        ne10_float32_t * pDst,
+        ne10_uint32_t blockSize);
+typedef void (*ne10_fir_decimate_func_t) (const ne10_fir_decimate_instance_f32_t * S,
+        ne10_float32_t * pSrc,
+        ne10_float32_t * pDst,
+        ne10_uint32_t blockSize);
+typedef void (*ne10_fir_interpolate_func_t) (const ne10_fir_interpolate_instance_f32_t * S,
+        ne10_float32_t * pSrc,
+        ne10_float32_t * pDst,
+        ne10_uint32_t blockSize);
+
+/*
+ * Allocates the state, the stage instances and all their buffers with one allocation.
+ * The sizes are computed in 64 bits; NULL is returned if the total does not fit in 32.
+ */
+static ne10_fir_cascade_cfg_f32_t ne10_fir_cascade_alloc (ne10_uint16_t numHalfbands,
+        ne10_uint32_t firFactor,
+        ne10_uint64_t floatsNeeded,
+        ne10_uint64_t bufferSize)
+{
+    ne10_fir_cascade_cfg_f32_t cfg;
+    ne10_uint64_t memNeeded = sizeof (ne10_fir_cascade_state_f32_t)
+                              + numHalfbands * sizeof (ne10_fir_halfband_instance_f32_t)
+                              + sizeof (ne10_fir_decimate_instance_f32_t)
+                              + sizeof (ne10_fir_interpolate_instance_f32_t)
+                              + (floatsNeeded + 2 * bufferSize) * sizeof (ne10_float32_t);
+    ne10_int8_t *address;
+
+    if (memNeeded > UINT32_MAX)
+    {
+        return NULL;
+    }
+    address = (ne10_int8_t *) NE10_MALLOC ( (ne10_uint32_t) memNeeded);
+    if (address == NULL)
+    {
+        return NULL;
+    }
+
+    cfg = (ne10_fir_cascade_cfg_f32_t) address;
+    address += sizeof (ne10_fir_cascade_state_f32_t);
+    cfg->numHalfbands = numHalfbands;
+    cfg->factor = firFactor << numHalfbands;
+    cfg->pHalfband = (ne10_fir_halfband_instance_f32_t *) address;
+    address += numHalfbands * sizeof (ne10_fir_halfband_instance_f32_t);
+    cfg->pDecimate = (ne10_fir_decimate_instance_f32_t *) address;
+    address += sizeof (ne10_fir_decimate_instance_f32_t);
+    cfg->pInterpolate = (ne10_fir_interpolate_instance_f32_t *) address;
+    address += sizeof (ne10_fir_interpolate_instance_f32_t);
+    cfg->pBuffer = (ne10_float32_t *) address;
+    cfg->bufferSize = (ne10_uint32_t) bufferSize;
+
+    return cfg;
+}
+
+/**
+ * @brief Creates a decimator made of halfband stages followed by one FIR decimation stage.
+ *
+ * @param[in] numHalfbands    number of halfband stages, each decimating by 2.
+ * @param[in] halfbandTaps    number of coefficients of the halfband filter, of the form 4*K-1.
+ * @param[in] *pHalfbandCoeffs points to the halfband filter coefficients, shared by all halfband stages.
+ * @param[in] M               decimation factor of the final FIR stage.
+ * @param[in] numTaps         number of coefficients of the final FIR stage.
+ * @param[in] *pCoeffs        points to the coefficients of the final FIR stage, in time reversed order.
+ * @param[in] maxBlockSize    maximum number of input samples per call, a multiple of <code>M * 2^numHalfbands</code>.
+ * @return the cascade configuration, or NULL if the arguments are invalid or the memory cannot be allocated.
+ *
+ * The total decimation factor is <code>M * 2^numHalfbands</code>. The state, the intermediate buffers and
+ * the stage instances are allocated together; the coefficient arrays are referenced, not copied,
+ * and must stay valid until @ref ne10_fir_cascade_destroy_float is called.
+ */
+ne10_fir_cascade_cfg_f32_t ne10_fir_decimate_cascade_alloc_float (ne10_uint16_t numHalfbands,
+        ne10_uint16_t halfbandTaps,
+        ne10_float32_t * pHalfbandCoeffs,
+        ne10_uint8_t M,
+        ne10_uint16_t numTaps,
+        ne10_float32_t * pCoeffs,
+        ne10_uint32_t maxBlockSize)
+{
+    ne10_fir_cascade_cfg_f32_t cfg;
+    ne10_float32_t *pState;
+    ne10_uint64_t floatsNeeded = 0;
+    ne10_uint32_t stage;
+
+    /* The total factor M * 2^numHalfbands must fit in 32 bits */
+    if ( (M == 0) || (numHalfbands >= 31) || (M > (UINT32_MAX >> numHalfbands))
+            || ( (maxBlockSize % ( (ne10_uint32_t) M << numHalfbands)) != 0))
+    {
+        return NULL;
+    }
+    if ( (numHalfbands > 0) && ( (halfbandTaps & 0x3u) != 0x3u))
+    {
+        return NULL;
+    }
+
+    /* Stage i sees blocks of maxBlockSize / 2^i samples */
+    for (stage = 0; stage < numHalfbands; stage++)
+    {
+        floatsNeeded += (ne10_uint64_t) halfbandTaps + (maxBlockSize >> stage) - 1u;
+    }
+    floatsNeeded += (ne10_uint64_t) numTaps + (maxBlockSize >> numHalfbands) - 1u;
+
+    cfg = ne10_fir_cascade_alloc (numHalfbands, M, floatsNeeded, (numHalfbands > 0) ? (maxBlockSize >> 1) : 0);
+    if (cfg == NULL)
+    {
+        return NULL;
+    }
+    cfg->maxBlockSize = maxBlockSize;
+
+    pState = cfg->pBuffer + 2 * cfg->bufferSize;
+    for (stage = 0; stage < numHalfbands; stage++)
+    {
+        if (ne10_fir_halfband_decimate_init_float (&cfg->pHalfband[stage], halfbandTaps, pHalfbandCoeffs,
+                pState, maxBlockSize >> stage) != NE10_OK)
+        {
+            NE10_FREE (cfg);
+            return NULL;
+        }
+        pState += halfbandTaps + (maxBlockSize >> stage) - 1u;
+    }
+    if (ne10_fir_decimate_init_float (cfg->pDecimate, numTaps, M, pCoeffs, pState, maxBlockSize >> numHalfbands) != NE10_OK)
+    {
+        NE10_FREE (cfg);
+        return NULL;
+    }
+    cfg->pInterpolate = NULL;
+
+    return cfg;
+}
+
+/**
+ * @brief Creates an interpolator made of one FIR interpolation stage followed by halfband stages.
+ *
+ * @param[in] numHalfbands    number of halfband stages, each interpolating by 2.
+ * @param[in] halfbandTaps    number of coefficients of the halfband filter, of the form 4*K-1.
+ * @param[in] *pHalfbandCoeffs points to the halfband filter coefficients, shared by all halfband stages.
+ * @param[in] L               interpolation factor of the first FIR stage.
+ * @param[in] numTaps         number of coefficients of the first FIR stage, a multiple of <code>L</code>.
+ * @param[in] *pCoeffs        points to the coefficients of the first FIR stage, in time reversed order.
+ * @param[in] maxBlockSize    maximum number of input samples per call.
+ * @return the cascade configuration, or NULL if the arguments are invalid or the memory cannot be allocated.
+ *
+ * The total interpolation factor is <code>L * 2^numHalfbands</code>. The coefficient arrays are referenced,
+ * not copied, and must stay valid until @ref ne10_fir_cascade_destroy_float is called.
+ */
+ne10_fir_cascade_cfg_f32_t ne10_fir_interpolate_cascade_alloc_float (ne10_uint16_t numHalfbands,
+        ne10_uint16_t halfbandTaps,
+        ne10_float32_t * pHalfbandCoeffs,
+        ne10_uint8_t L,
+        ne10_uint16_t numTaps,
+        ne10_float32_t * pCoeffs,
+        ne10_uint32_t maxBlockSize)
+{
+    ne10_fir_cascade_cfg_f32_t cfg;
+    ne10_float32_t *pState;
+    ne10_uint64_t floatsNeeded;
+    ne10_uint32_t stage, stageBlockSize;
+
+    /* The total factor L * 2^numHalfbands and the output block size must fit in 32 bits */
+    if ( (L == 0) || (numTaps % L != 0) || (numHalfbands >= 31) || (L > (UINT32_MAX >> numHalfbands))
+            || ( (ne10_uint64_t) maxBlockSize * L > (UINT32_MAX >> numHalfbands)))
+    {
+        return NULL;
+    }
+    if ( (numHalfbands > 0) && ( (halfbandTaps & 0x3u) != 0x3u))
+    {
+        return NULL;
+    }
+
+    floatsNeeded = (ne10_uint64_t) numTaps / L + maxBlockSize - 1u;
+    for (stage = 0; stage < numHalfbands; stage++)
+    {
+        floatsNeeded += (halfbandTaps - 1u) / 2u + ( (ne10_uint64_t) (maxBlockSize * L) << stage);
+    }
+
+    /* The largest intermediate signal is the input of the last halfband stage */
+    cfg = ne10_fir_cascade_alloc (numHalfbands, L, floatsNeeded,
+                                  (numHalfbands > 0) ? ( (maxBlockSize * L) << (numHalfbands - 1)) : 0);
+    if (cfg == NULL)
+    {
+        return NULL;
+    }
+    cfg->maxBlockSize = maxBlockSize;
+
+    pState = cfg->pBuffer + 2 * cfg->bufferSize;
+    if (ne10_fir_interpolate_init_float (cfg->pInterpolate, L, numTaps, pCoeffs, pState, maxBlockSize) != NE10_OK)
+    {
+        NE10_FREE (cfg);
+        return NULL;
+    }
+    pState += numTaps / L + maxBlockSize - 1u;
+    for (stage = 0; stage < numHalfbands; stage++)
+    {
+        stageBlockSize = (maxBlockSize * L) << stage;
+        if (ne10_fir_halfband_interpolate_init_float (&cfg->pHalfband[stage], halfbandTaps, pHalfbandCoeffs,
+                pState, stageBlockSize) != NE10_OK)
+        {
+            NE10_FREE (cfg);
+            return NULL;
+        }
+        pState += (halfbandTaps - 1u) / 2u + stageBlockSize;
+    }
+    cfg->pDecimate = NULL;
+
+    return cfg;
+}
+
+/**
+ * @brief Releases a cascade created by @ref ne10_fir_decimate_cascade_alloc_float or
+ * @ref ne10_fir_interpolate_cascade_alloc_float.
+ */
+void ne10_fir_cascade_destroy_float (ne10_fir_cascade_cfg_f32_t cfg)
+{
+    NE10_FREE (cfg);
+}
+
+static ne10_uint32_t ne10_fir_cascade_process (ne10_fir_cascade_cfg_f32_t cfg,
+        ne10_float32_t * pSrc,
+        ne10_float32_t * pDst,
+        ne10_uint32_t blockSize,
+        ne10_fir_halfband_func_t halfband_decimate,
+        ne10_fir_halfband_func_t halfband_interpolate,
+        ne10_fir_decimate_func_t decimate,
+        ne10_fir_interpolate_func_t interpolate)
+{
+    ne10_float32_t *pIn = pSrc, *pOut;
+    ne10_uint32_t len = blockSize;
+    ne10_uint32_t stage;
+
+    if (cfg->pDecimate != NULL)
+    {
+        /* Halfband stages ping-pong between the two intermediate buffers */
+        for (stage = 0; stage < cfg->numHalfbands; stage++)
+        {
+            pOut = cfg->pBuffer + (stage & 0x1u) * cfg->bufferSize;
+            halfband_decimate (&cfg->pHalfband[stage], pIn, pOut, len);
+            len >>= 1;
+            pIn = pOut;
+        }
+        decimate (cfg->pDecimate, pIn, pDst, len);
+        return len / cfg->pDecimate->M;
+    }
+
+    pOut = (cfg->numHalfbands > 0) ? cfg->pBuffer : pDst;
+    interpolate (cfg->pInterpolate, pIn, pOut, len);
+    len *= cfg->pInterpolate->L;
+    pIn = pOut;
+    for (stage = 0; stage < cfg->numHalfbands; stage++)
+    {
+        pOut = (stage + 1u == cfg->numHalfbands) ? pDst : cfg->pBuffer + ( (stage + 1u) & 0x1u) * cfg->bufferSize;
+        halfband_interpolate (&cfg->pHalfband[stage], pIn, pOut, len);
+        len <<= 1;
+        pIn = pOut;
+    }
+    return len;
+}
+
+/**
+ * Specific implementation of @ref ne10_fir_cascade_float using plain C.
+ */
+ne10_uint32_t ne10_fir_cascade_float_c (ne10_fir_cascade_cfg_f32_t cfg,
+                                        ne10_float32_t * pSrc,
+                                        ne10_float32_t * pDst,
+                                        ne10_uint32_t blockSize)
+{
+    return ne10_fir_cascade_process (cfg, pSrc, pDst, blockSize,
+                                     ne10_fir_halfband_decimate_float_c,
+                                     ne10_fir_halfband_interpolate_float_c,
+                                     ne10_fir_decimate_float_c,
+                                     ne10_fir_interpolate_float_c);
+}
+
+/**
+ * Specific implementation of @ref ne10_fir_cascade_float using NEON SIMD capabilities.
+ */
+ne10_uint32_t ne10_fir_cascade_float_neon (ne10_fir_cascade_cfg_f32_t cfg,
+        ne10_float32_t * pSrc,
+        ne10_float32_t * pDst,
+        ne10_uint32_t blockSize)
+{
+    return ne10_fir_cascade_process (cfg, pSrc, pDst, blockSize,
+                                     ne10_fir_halfband_decimate_float_neon,
+                                     ne10_fir_halfband_interpolate_float_neon,
+#ifdef ENABLE_NE10_FIR_DECIMATE_FLOAT_NEON
+                                     ne10_fir_decimate_float_neon,
+#else
+                                     ne10_fir_decimate_float_c,
+#endif
+#ifdef ENABLE_NE10_FIR_INTERPOLATE_FLOAT_NEON
+                                     ne10_fir_interpolate_float_neon);
+#else
+                                     ne10_fir_interpolate_float_c);
+#endif
+}
+
+/**
+ * @} end of FIR_Halfband group
+ */
@@ -289,3 +289,144 @@ ne10_result_t ne10_fir_sparse_init_float (
 
     return NE10_OK;
 }
+
+/**
+ * @ingroup FIR_Sparse
+ * @brief Initialization function for the floating-point sparse FIR filter with a linear delay line.
+ *
+ * @param[in,out] *S               points to an instance of the floating-point sparse FIR structure.
+ * @param[in]     numTaps          number of nonzero coefficients in the filter.
+ * @param[in]     *pCoeffs         points to the array of filter coefficients.
+ * @param[in]     *pTapDelay       points to the array of offset times, in any order.
+ * @param[out]    *pSortedCoeffs   points to an array of length numTaps that receives the sorted coefficients.
+ * @param[out]    *pSortedTapDelay points to an array of length numTaps that receives the sorted offset times.
+ * @param[in]     *pState          points to the state buffer of length <code>maxDelay + 2*blockSize</code>.
+ * @param[in]     maxDelay         maximum offset time supported.
+ * @param[in]     blockSize        maximum number of samples that will be processed per block.
+ * @return        NE10_OK, or NE10_ERR if <code>blockSize</code> is zero or an offset is outside <code>[0, maxDelay]</code>.
+ */
+ne10_result_t ne10_fir_sparse_linear_init_float (
+    ne10_fir_sparse_linear_instance_f32_t * S,
+    ne10_uint16_t numTaps,
+    const ne10_float32_t * pCoeffs,
+    const ne10_int32_t * pTapDelay,
+    ne10_float32_t * pSortedCoeffs,
+    ne10_int32_t * pSortedTapDelay,
+    ne10_float32_t * pState,
+    ne10_uint32_t maxDelay,
+    ne10_uint32_t blockSize)
+{
+    ne10_uint32_t i, j, gap;
+    ne10_int32_t delay;
+    ne10_float32_t coeff;
+
+    if (blockSize == 0)
+    {
+        return NE10_ERR;
+    }
+    for (i = 0; i < numTaps; i++)
+    {
+        if ( (pTapDelay[i] < 0) || ( (ne10_uint32_t) pTapDelay[i] > maxDelay))
+        {
+            return NE10_ERR;
+        }
+        pSortedCoeffs[i] = pCoeffs[i];
+        pSortedTapDelay[i] = pTapDelay[i];
+    }
+
+    /* Shell sort by increasing delay, moving the coefficients along */
+    for (gap = numTaps >> 1; gap > 0; gap >>= 1)
+    {
+        for (i = gap; i < numTaps; i++)
+        {
+            delay = pSortedTapDelay[i];
+            coeff = pSortedCoeffs[i];
+            for (j = i; (j >= gap) && (pSortedTapDelay[j - gap] > delay); j -= gap)
+            {
+                pSortedTapDelay[j] = pSortedTapDelay[j - gap];
+                pSortedCoeffs[j] = pSortedCoeffs[j - gap];
+            }
+            pSortedTapDelay[j] = delay;
+            pSortedCoeffs[j] = coeff;
+        }
+    }
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pSortedCoeffs;
+    S->pTapDelay = pSortedTapDelay;
+    S->writeIndex = 0;
+    S->delaySize = maxDelay + blockSize;
+    S->blockSize = blockSize;
+
+    /* Clear the delay line and its mirrored tail */
+    memset (pState, 0, (maxDelay + 2 * blockSize) * sizeof (ne10_float32_t));
+    S->pState = pState;
+
+    return NE10_OK;
+}
+
+/**
+ * @ingroup FIR_Halfband
+ * @brief Initialization function for the floating-point halfband decimator.
+ *
+ * @param[in,out] *S points to an instance of the floating-point halfband filter structure.
+ * @param[in] numTaps  number of coefficients in the filter, of the form 4*K-1.
+ * @param[in] *pCoeffs points to the filter coefficients.
+ * @param[in] *pState points to the state buffer of length <code>numTaps+blockSize-1</code>.
+ * @param[in] blockSize maximum number of input samples to process per call.
+ * @return    The function returns NE10_OK if initialization was successful or NE10_ERR if
+ * <code>numTaps</code> is not of the form 4*K-1 or <code>blockSize</code> is odd.
+ */
+ne10_result_t ne10_fir_halfband_decimate_init_float (ne10_fir_halfband_instance_f32_t * S,
+        ne10_uint16_t numTaps,
+        ne10_float32_t * pCoeffs,
+        ne10_float32_t * pState,
+        ne10_uint32_t blockSize)
+{
+    if ( ( (numTaps & 0x3u) != 0x3u) || ( (blockSize & 0x1u) != 0u))
+    {
+        return NE10_ERR;
+    }
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+
+    /* Clear state buffer and the size of state buffer is (blockSize + numTaps - 1) */
+    memset (pState, 0, (numTaps + (blockSize - 1u)) * sizeof (ne10_float32_t));
+    S->pState = pState;
+
+    return NE10_OK;
+}
+
+/**
+ * @ingroup FIR_Halfband
+ * @brief Initialization function for the floating-point halfband interpolator.
+ *
+ * @param[in,out] *S points to an instance of the floating-point halfband filter structure.
+ * @param[in] numTaps  number of coefficients in the filter, of the form 4*K-1.
+ * @param[in] *pCoeffs points to the filter coefficients.
+ * @param[in] *pState points to the state buffer of length <code>(numTaps-1)/2+blockSize</code>.
+ * @param[in] blockSize maximum number of input samples to process per call.
+ * @return    The function returns NE10_OK if initialization was successful or NE10_ERR if
+ * <code>numTaps</code> is not of the form 4*K-1.
+ */
+ne10_result_t ne10_fir_halfband_interpolate_init_float (ne10_fir_halfband_instance_f32_t * S,
+        ne10_uint16_t numTaps,
+        ne10_float32_t * pCoeffs,
+        ne10_float32_t * pState,
+        ne10_uint32_t blockSize)
+{
+    if ( (numTaps & 0x3u) != 0x3u)
+    {
+        return NE10_ERR;
+    }
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+
+    /* Clear state buffer and the size of state buffer is (blockSize + (numTaps - 1) / 2) */
+    memset (pState, 0, ( (numTaps - 1u) / 2u + blockSize) * sizeof (ne10_float32_t));
+    S->pState = pState;
+
+    return NE10_OK;
+}
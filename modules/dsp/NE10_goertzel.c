@@ -0,0 +1,329 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_goertzel.c
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_fft.h"
+#include "NE10_dsp.h"
+
+/**
+ * @ingroup groupDSPs
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Bank and Sliding DFT
+ *
+ * \par
+ * When only a few bins of a long spectrum are needed, as in DTMF or pilot-tone detection, evaluating them
+ * directly is much cheaper than a full FFT. Both filter types here keep one state per bin and put 4 bins
+ * into the lanes of a NEON register, so a bank of B bins costs about B/4 vector operations per sample.
+ * \par
+ * The Goertzel bank runs, for every bin of normalised frequency f (cycles per sample, from 0 to 0.5),
+ * <pre>
+ *    s[n] = x[n] + 2*cos(2*pi*f) * s[n-1] - s[n-2]
+ * </pre>
+ * over blocks of <code>blockLen</code> samples and gives at the end of each block the power
+ * <pre>
+ *    |X|^2 = s[N-1]^2 + s[N-2]^2 - 2*cos(2*pi*f) * s[N-1] * s[N-2]
+ * </pre>
+ * which for <code>f = k/blockLen</code> is the squared magnitude of bin k of the block's DFT. The input
+ * arrives in chunks of any length; @ref ne10_goertzel_float32 returns the powers of every block completed.
+ * \par
+ * The sliding DFT updates bins k of the DFT over the last N samples with every new sample:
+ * <pre>
+ *    X_k[n] = r * exp(2*pi*i*k/N) * (X_k[n-1] + x[n] - r^N * x[n-N])
+ * </pre>
+ * The damping factor r = NE10_SDFT_DAMPING keeps the rounding errors of the recursion from growing without
+ * bound at the cost of weighting the oldest sample of the window by r^N instead of 1. The bins, with the
+ * oldest sample of the window at phase 0, are returned after each chunk of input.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Allocates a bank of Goertzel filters.
+ * @param[in]   numBins    number of bins.
+ * @param[in]   *pFreqs    points to the normalised frequencies of the bins, from 0 to 0.5 cycles per sample.
+ * @param[in]   blockLen   number of samples of each evaluation.
+ * @return      the configuration, or NULL if a parameter is invalid or the memory allocation fails.
+ */
+ne10_goertzel_cfg_float32_t ne10_goertzel_alloc_float32 (ne10_uint32_t numBins,
+        const ne10_float32_t * pFreqs,
+        ne10_uint32_t blockLen)
+{
+    ne10_goertzel_cfg_float32_t st;
+    ne10_uint32_t padded = (numBins + 3) & ~3;
+    ne10_uint32_t memneeded, k;
+    uintptr_t address;
+
+    if ( (numBins == 0) || (pFreqs == NULL) || (blockLen == 0))
+    {
+        return NULL;
+    }
+    for (k = 0; k < numBins; k++)
+    {
+        if ( (pFreqs[k] < 0.0f) || (pFreqs[k] > 0.5f))
+        {
+            return NULL;
+        }
+    }
+
+    memneeded = sizeof (ne10_goertzel_state_float32_t)
+                + sizeof (ne10_float32_t) * 3 * padded   /* coefficients, state */
+                + NE10_FFT_BYTE_ALIGNMENT;
+    st = (ne10_goertzel_cfg_float32_t) NE10_MALLOC (memneeded);
+    if (st == NULL)
+    {
+        return NULL;
+    }
+
+    address = (uintptr_t) (st + 1);
+    NE10_BYTE_ALIGNMENT (address, NE10_FFT_BYTE_ALIGNMENT);
+    st->pCoeff = (ne10_float32_t *) address;
+    st->pState = st->pCoeff + padded;
+    st->numBins = numBins;
+    st->blockLen = blockLen;
+    st->count = 0;
+
+    for (k = 0; k < padded; k++)
+    {
+        st->pCoeff[k] = (k < numBins) ? (ne10_float32_t) (2.0 * cos (2.0 * NE10_PI * pFreqs[k])) : 0.0f;
+    }
+    memset (st->pState, 0, 2 * padded * sizeof (ne10_float32_t));
+    return st;
+}
+
+/**
+ * @brief Frees a configuration allocated by @ref ne10_goertzel_alloc_float32.
+ */
+void ne10_goertzel_destroy_float32 (ne10_goertzel_cfg_float32_t cfg)
+{
+    NE10_FREE (cfg);
+}
+
+/**
+ * @brief Bank of Goertzel filters over a streaming input.
+ * @param[in]   cfg        configuration from @ref ne10_goertzel_alloc_float32.
+ * @param[out]  *pPower    points to the output: numBins powers for every block completed during this call,
+ *                         one block after the other. It must hold numBins * (srcLen / blockLen + 1) values.
+ * @param[in]   *pSrc      points to the input chunk.
+ * @param[in]   srcLen     number of samples in the chunk.
+ * @return      number of blocks completed.
+ */
+ne10_uint32_t ne10_goertzel_float32_c (ne10_goertzel_cfg_float32_t cfg,
+                                       ne10_float32_t * pPower,
+                                       ne10_float32_t * pSrc,
+                                       ne10_uint32_t srcLen)
+{
+    ne10_uint32_t padded = (cfg->numBins + 3) & ~3;
+    ne10_float32_t *pS1 = cfg->pState;
+    ne10_float32_t *pS2 = cfg->pState + padded;
+    ne10_float32_t s0, s1, s2, c;
+    ne10_uint32_t blocks = 0;
+    ne10_uint32_t len, n, k;
+
+    while (srcLen > 0)
+    {
+        len = (srcLen < cfg->blockLen - cfg->count) ? srcLen : cfg->blockLen - cfg->count;
+        for (k = 0; k < cfg->numBins; k++)
+        {
+            c = cfg->pCoeff[k];
+            s1 = pS1[k];
+            s2 = pS2[k];
+            for (n = 0; n < len; n++)
+            {
+                s0 = pSrc[n] + c * s1 - s2;
+                s2 = s1;
+                s1 = s0;
+            }
+            pS1[k] = s1;
+            pS2[k] = s2;
+        }
+        pSrc += len;
+        srcLen -= len;
+        cfg->count += len;
+
+        if (cfg->count == cfg->blockLen)
+        {
+            for (k = 0; k < cfg->numBins; k++)
+            {
+                pPower[k] = pS1[k] * pS1[k] + pS2[k] * pS2[k] - cfg->pCoeff[k] * pS1[k] * pS2[k];
+            }
+            memset (cfg->pState, 0, 2 * padded * sizeof (ne10_float32_t));
+            cfg->count = 0;
+            pPower += cfg->numBins;
+            blocks++;
+        }
+    }
+    return blocks;
+}
+
+/**
+ * @brief Allocates a sliding DFT.
+ * @param[in]   numBins    number of bins.
+ * @param[in]   *pBins     points to the indices k of the bins, from 0 to windowLen-1.
+ * @param[in]   windowLen  length N of the sliding window.
+ * @return      the configuration, or NULL if a parameter is invalid or the memory allocation fails.
+ *              The window initially holds zeros.
+ */
+ne10_sdft_cfg_float32_t ne10_sdft_alloc_float32 (ne10_uint32_t numBins,
+        const ne10_uint32_t * pBins,
+        ne10_uint32_t windowLen)
+{
+    ne10_sdft_cfg_float32_t st;
+    ne10_uint32_t padded = (numBins + 3) & ~3;
+    ne10_uint32_t memneeded, k;
+    uintptr_t address;
+
+    if ( (numBins == 0) || (pBins == NULL) || (windowLen == 0))
+    {
+        return NULL;
+    }
+    for (k = 0; k < numBins; k++)
+    {
+        if (pBins[k] >= windowLen)
+        {
+            return NULL;
+        }
+    }
+
+    memneeded = sizeof (ne10_sdft_state_float32_t)
+                + sizeof (ne10_float32_t) * (4 * padded + windowLen + NE10_SDFT_BLOCK_LEN)   /* twiddles, bins, delay, delta */
+                + NE10_FFT_BYTE_ALIGNMENT;
+    st = (ne10_sdft_cfg_float32_t) NE10_MALLOC (memneeded);
+    if (st == NULL)
+    {
+        return NULL;
+    }
+
+    address = (uintptr_t) (st + 1);
+    NE10_BYTE_ALIGNMENT (address, NE10_FFT_BYTE_ALIGNMENT);
+    st->pTwiddle = (ne10_float32_t *) address;
+    st->pBins = st->pTwiddle + 2 * padded;
+    st->pDelta = st->pBins + 2 * padded;
+    st->pDelay = st->pDelta + NE10_SDFT_BLOCK_LEN;
+    st->numBins = numBins;
+    st->windowLen = windowLen;
+    st->delayIndex = 0;
+    st->dampingN = (ne10_float32_t) pow (NE10_SDFT_DAMPING, (ne10_float64_t) windowLen);
+
+    for (k = 0; k < padded; k++)
+    {
+        st->pTwiddle[k] = (k < numBins) ? (ne10_float32_t) (NE10_SDFT_DAMPING * cos (2.0 * NE10_PI * pBins[k] / windowLen)) : 0.0f;
+        st->pTwiddle[padded + k] = (k < numBins) ? (ne10_float32_t) (NE10_SDFT_DAMPING * sin (2.0 * NE10_PI * pBins[k] / windowLen)) : 0.0f;
+    }
+    memset (st->pBins, 0, 2 * padded * sizeof (ne10_float32_t));
+    memset (st->pDelay, 0, windowLen * sizeof (ne10_float32_t));
+    return st;
+}
+
+/**
+ * @brief Frees a configuration allocated by @ref ne10_sdft_alloc_float32.
+ */
+void ne10_sdft_destroy_float32 (ne10_sdft_cfg_float32_t cfg)
+{
+    NE10_FREE (cfg);
+}
+
+/*
+ * Computes the differences x[n] - r^N * x[n-N] of up to NE10_SDFT_BLOCK_LEN samples into cfg->pDelta and
+ * moves the samples into the delay line.
+ */
+static void ne10_sdft_delta_float32_c (ne10_sdft_cfg_float32_t cfg,
+                                       const ne10_float32_t * pSrc,
+                                       ne10_uint32_t len)
+{
+    ne10_uint32_t index = cfg->delayIndex;
+    ne10_uint32_t n;
+
+    for (n = 0; n < len; n++)
+    {
+        cfg->pDelta[n] = pSrc[n] - cfg->dampingN * cfg->pDelay[index];
+        cfg->pDelay[index] = pSrc[n];
+        index = (index + 1 == cfg->windowLen) ? 0 : index + 1;
+    }
+    cfg->delayIndex = index;
+}
+
+/**
+ * @brief Sliding DFT over a streaming input.
+ * @param[in]   cfg        configuration from @ref ne10_sdft_alloc_float32.
+ * @param[out]  *pDst      points to the numBins bins of the window ending with the last sample of the chunk.
+ * @param[in]   *pSrc      points to the input chunk.
+ * @param[in]   srcLen     number of samples in the chunk.
+ */
+void ne10_sdft_float32_c (ne10_sdft_cfg_float32_t cfg,
+                          ne10_fft_cpx_float32_t * pDst,
+                          ne10_float32_t * pSrc,
+                          ne10_uint32_t srcLen)
+{
+    ne10_uint32_t padded = (cfg->numBins + 3) & ~3;
+    ne10_float32_t *pRe = cfg->pBins;
+    ne10_float32_t *pIm = cfg->pBins + padded;
+    ne10_float32_t wr, wi, re, im, a;
+    ne10_uint32_t len, n, k;
+
+    while (srcLen > 0)
+    {
+        len = (srcLen < NE10_SDFT_BLOCK_LEN) ? srcLen : NE10_SDFT_BLOCK_LEN;
+        ne10_sdft_delta_float32_c (cfg, pSrc, len);
+        for (k = 0; k < cfg->numBins; k++)
+        {
+            wr = cfg->pTwiddle[k];
+            wi = cfg->pTwiddle[padded + k];
+            re = pRe[k];
+            im = pIm[k];
+            for (n = 0; n < len; n++)
+            {
+                a = re + cfg->pDelta[n];
+                re = a * wr - im * wi;
+                im = a * wi + im * wr;
+            }
+            pRe[k] = re;
+            pIm[k] = im;
+        }
+        pSrc += len;
+        srcLen -= len;
+    }
+
+    for (k = 0; k < cfg->numBins; k++)
+    {
+        pDst[k].r = pRe[k];
+        pDst[k].i = pIm[k];
+    }
+}
+/** @} */ //end of Goertzel group
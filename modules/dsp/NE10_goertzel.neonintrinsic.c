@@ -0,0 +1,247 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_goertzel.neonintrinsic.c
+ */
+
+#include <arm_neon.h>
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_dsp.h"
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/* Runs len samples through the 4 Goertzel filters of a group of bins */
+static inline void ne10_goertzel_group_neon (ne10_float32_t * pS1,
+        ne10_float32_t * pS2,
+        const ne10_float32_t * pCoeff,
+        const ne10_float32_t * pSrc,
+        ne10_uint32_t len)
+{
+    float32x4_t q_c = vld1q_f32 (pCoeff);
+    float32x4_t q_s1 = vld1q_f32 (pS1);
+    float32x4_t q_s2 = vld1q_f32 (pS2);
+    float32x4_t q_s0;
+    ne10_uint32_t n;
+
+    for (n = 0; n < len; n++)
+    {
+        q_s0 = vmlaq_f32 (vsubq_f32 (vdupq_n_f32 (pSrc[n]), q_s2), q_c, q_s1);
+        q_s2 = q_s1;
+        q_s1 = q_s0;
+    }
+    vst1q_f32 (pS1, q_s1);
+    vst1q_f32 (pS2, q_s2);
+}
+
+/* Two groups at a time so that the two recursions overlap in the pipeline */
+static inline void ne10_goertzel_group2_neon (ne10_float32_t * pS1,
+        ne10_float32_t * pS2,
+        const ne10_float32_t * pCoeff,
+        const ne10_float32_t * pSrc,
+        ne10_uint32_t len)
+{
+    float32x4_t q_c0 = vld1q_f32 (pCoeff);
+    float32x4_t q_c1 = vld1q_f32 (pCoeff + 4);
+    float32x4_t q_s10 = vld1q_f32 (pS1);
+    float32x4_t q_s11 = vld1q_f32 (pS1 + 4);
+    float32x4_t q_s20 = vld1q_f32 (pS2);
+    float32x4_t q_s21 = vld1q_f32 (pS2 + 4);
+    float32x4_t q_x, q_s00, q_s01;
+    ne10_uint32_t n;
+
+    for (n = 0; n < len; n++)
+    {
+        q_x = vdupq_n_f32 (pSrc[n]);
+        q_s00 = vmlaq_f32 (vsubq_f32 (q_x, q_s20), q_c0, q_s10);
+        q_s01 = vmlaq_f32 (vsubq_f32 (q_x, q_s21), q_c1, q_s11);
+        q_s20 = q_s10;
+        q_s21 = q_s11;
+        q_s10 = q_s00;
+        q_s11 = q_s01;
+    }
+    vst1q_f32 (pS1, q_s10);
+    vst1q_f32 (pS1 + 4, q_s11);
+    vst1q_f32 (pS2, q_s20);
+    vst1q_f32 (pS2 + 4, q_s21);
+}
+
+/**
+ * Specific implementation of @ref ne10_goertzel_float32 using NEON SIMD capabilities.
+ */
+ne10_uint32_t ne10_goertzel_float32_neon (ne10_goertzel_cfg_float32_t cfg,
+        ne10_float32_t * pPower,
+        ne10_float32_t * pSrc,
+        ne10_uint32_t srcLen)
+{
+    ne10_uint32_t padded = (cfg->numBins + 3) & ~3;
+    ne10_float32_t *pS1 = cfg->pState;
+    ne10_float32_t *pS2 = cfg->pState + padded;
+    float32x4_t q_s1, q_s2, q_p;
+    ne10_float32_t power[4];
+    ne10_uint32_t blocks = 0;
+    ne10_uint32_t len, k;
+
+    while (srcLen > 0)
+    {
+        len = (srcLen < cfg->blockLen - cfg->count) ? srcLen : cfg->blockLen - cfg->count;
+        for (k = 0; k + 8 <= padded; k += 8)
+        {
+            ne10_goertzel_group2_neon (pS1 + k, pS2 + k, cfg->pCoeff + k, pSrc, len);
+        }
+        if (k < padded)
+        {
+            ne10_goertzel_group_neon (pS1 + k, pS2 + k, cfg->pCoeff + k, pSrc, len);
+        }
+        pSrc += len;
+        srcLen -= len;
+        cfg->count += len;
+
+        if (cfg->count == cfg->blockLen)
+        {
+            for (k = 0; k < padded; k += 4)
+            {
+                q_s1 = vld1q_f32 (pS1 + k);
+                q_s2 = vld1q_f32 (pS2 + k);
+                q_p = vmlaq_f32 (vmulq_f32 (q_s1, q_s1), q_s2, q_s2);
+                q_p = vmlsq_f32 (q_p, vmulq_f32 (vld1q_f32 (cfg->pCoeff + k), q_s1), q_s2);
+                if (k + 4 <= cfg->numBins)
+                {
+                    vst1q_f32 (pPower + k, q_p);
+                }
+                else
+                {
+                    vst1q_f32 (power, q_p);
+                    memcpy (pPower + k, power, (cfg->numBins - k) * sizeof (ne10_float32_t));
+                }
+            }
+            memset (cfg->pState, 0, 2 * padded * sizeof (ne10_float32_t));
+            cfg->count = 0;
+            pPower += cfg->numBins;
+            blocks++;
+        }
+    }
+    return blocks;
+}
+
+/*
+ * Computes the differences x[n] - r^N * x[n-N] of up to NE10_SDFT_BLOCK_LEN samples into cfg->pDelta and
+ * moves the samples into the delay line, in runs that do not wrap around the delay line.
+ */
+static void ne10_sdft_delta_float32_neon (ne10_sdft_cfg_float32_t cfg,
+        const ne10_float32_t * pSrc,
+        ne10_uint32_t len)
+{
+    ne10_float32_t *pDelta = cfg->pDelta;
+    ne10_float32_t *pDelay;
+    float32x4_t q_x;
+    ne10_uint32_t run, n;
+
+    while (len > 0)
+    {
+        pDelay = cfg->pDelay + cfg->delayIndex;
+        run = (len < cfg->windowLen - cfg->delayIndex) ? len : cfg->windowLen - cfg->delayIndex;
+        for (n = 0; n + 4 <= run; n += 4)
+        {
+            q_x = vld1q_f32 (pSrc + n);
+            vst1q_f32 (pDelta + n, vmlsq_f32 (q_x, vld1q_f32 (pDelay + n), vdupq_n_f32 (cfg->dampingN)));
+            vst1q_f32 (pDelay + n, q_x);
+        }
+        for (; n < run; n++)
+        {
+            pDelta[n] = pSrc[n] - cfg->dampingN * pDelay[n];
+            pDelay[n] = pSrc[n];
+        }
+        cfg->delayIndex += run;
+        cfg->delayIndex = (cfg->delayIndex == cfg->windowLen) ? 0 : cfg->delayIndex;
+        pSrc += run;
+        pDelta += run;
+        len -= run;
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_sdft_float32 using NEON SIMD capabilities.
+ */
+void ne10_sdft_float32_neon (ne10_sdft_cfg_float32_t cfg,
+                             ne10_fft_cpx_float32_t * pDst,
+                             ne10_float32_t * pSrc,
+                             ne10_uint32_t srcLen)
+{
+    ne10_uint32_t padded = (cfg->numBins + 3) & ~3;
+    ne10_float32_t *pRe = cfg->pBins;
+    ne10_float32_t *pIm = cfg->pBins + padded;
+    float32x4_t q_wr, q_wi, q_re, q_im, q_a;
+    float32x4x2_t q_out;
+    ne10_fft_cpx_float32_t bins[4];
+    ne10_uint32_t len, n, k;
+
+    while (srcLen > 0)
+    {
+        len = (srcLen < NE10_SDFT_BLOCK_LEN) ? srcLen : NE10_SDFT_BLOCK_LEN;
+        ne10_sdft_delta_float32_neon (cfg, pSrc, len);
+        for (k = 0; k < padded; k += 4)
+        {
+            q_wr = vld1q_f32 (cfg->pTwiddle + k);
+            q_wi = vld1q_f32 (cfg->pTwiddle + padded + k);
+            q_re = vld1q_f32 (pRe + k);
+            q_im = vld1q_f32 (pIm + k);
+            for (n = 0; n < len; n++)
+            {
+                q_a = vaddq_f32 (q_re, vdupq_n_f32 (cfg->pDelta[n]));
+                q_re = vmlsq_f32 (vmulq_f32 (q_a, q_wr), q_im, q_wi);
+                q_im = vmlaq_f32 (vmulq_f32 (q_a, q_wi), q_im, q_wr);
+            }
+            vst1q_f32 (pRe + k, q_re);
+            vst1q_f32 (pIm + k, q_im);
+        }
+        pSrc += len;
+        srcLen -= len;
+    }
+
+    for (k = 0; k < padded; k += 4)
+    {
+        q_out.val[0] = vld1q_f32 (pRe + k);
+        q_out.val[1] = vld1q_f32 (pIm + k);
+        if (k + 4 <= cfg->numBins)
+        {
+            vst2q_f32 ( (ne10_float32_t *) (pDst + k), q_out);
+        }
+        else
+        {
+            vst2q_f32 ( (ne10_float32_t *) bins, q_out);
+            memcpy (pDst + k, bins, (cfg->numBins - k) * sizeof (ne10_fft_cpx_float32_t));
+        }
+    }
+}
+/** @} */ //end of Goertzel group
@@ -302,3 +302,190 @@ void ne10_iir_lattice_float_c (const ne10_iir_lattice_instance_f32_t * S,
 
 }
 /** @} */ //end of IIR_Lattice group
+
+/**
+ * @ingroup groupDSPs
+ */
+
+/**
+ * @defgroup IIR_Block Block (State-Space) Infinite Impulse Response (IIR) Filters
+ *
+ * \par
+ * The direct and lattice IIR structures have a strict sample-to-sample dependency: every
+ * output needs the state produced by the previous sample, so they run at one sample per
+ * recursion no matter how wide the SIMD unit is. The block IIR filter removes this
+ * dependency by converting the filter into state-space form and advancing the state by
+ * <code>stepSize</code> (4 or 8) samples at a time using precomputed matrix powers
+ * (look-ahead computation). All the outputs of one step are independent of each other and
+ * are computed together.
+ *
+ * \par Algorithm:
+ * Each section of the filter is described by the state-space system
+ * <pre>
+ *    x(n+1) = A * x(n) + B * u(n)
+ *    y(n)   = C * x(n) + D * u(n)
+ * </pre>
+ * where <code>x</code> holds <code>order</code> state variables. Stacking <code>L = stepSize</code>
+ * consecutive samples gives
+ * <pre>
+ *    [y(n) ... y(n+L-1)]' = O * x(n) + T * [u(n) ... u(n+L-1)]'
+ *    x(n+L)               = A^L * x(n) + G * [u(n) ... u(n+L-1)]'
+ * </pre>
+ * with the observability matrix <code>O = [C; C*A; ...; C*A^(L-1)]</code>, the lower triangular
+ * Toeplitz matrix <code>T</code> of the first <code>L</code> impulse response samples
+ * <code>{D, C*B, C*A*B, ...}</code> and <code>G = [A^(L-1)*B, ..., A*B, B]</code>.
+ * The matrices are computed once in double precision by the initialization functions, which
+ * convert either a cascade of biquads (<code>order = 2</code> per section) or an IIR lattice
+ * (one section with <code>order = numStages</code>) into this form. A block that is not a multiple
+ * of <code>stepSize</code> finishes with the single-sample recursion.
+ *
+ * \par
+ * Per output sample a step costs <code>(order + (L+1)/2)</code> multiply-accumulates for the
+ * outputs and <code>order * (order + L) / L</code> for the state update, so the method pays off for
+ * biquads and for lattices of up to about <code>2*L</code> stages.
+ *
+ * \par Numerical behavior
+ * For the biquad cascade the states are the transposed direct form II states and for the lattice
+ * they are the lattice <code>g</code> values, which keeps the realization as well conditioned as the
+ * original structure. The single precision matrix entries add a relative error of about
+ * <code>(order + L) * 2^-24</code> per step; the error fed back through <code>A^L</code> is bounded in the
+ * same way as for the sample-by-sample filter, so for stable filters the difference to the
+ * sample-by-sample filters stays within a few units in the last place times the filter's noise
+ * gain. Filters with poles very close to the unit circle amplify the error exactly as the direct
+ * structures do.
+ *
+ * \par Instance Structure
+ * The precomputed matrices and the state variables of a filter are stored in an instance data structure.
+ * The matrix array of a section holds <code>NE10_IIR_BLOCK_COEFFS_LEN(order, stepSize)</code> values;
+ * it may be shared among several instances while state variable arrays cannot be shared.
+ * The state array holds <code>(numSections + 1) * order</code> values, the last <code>order</code> of
+ * which are used as working memory.
+ *
+ * \par Initialization Functions
+ * The initialization functions (@ref ne10_iir_block_biquad_init_float, @ref ne10_iir_block_lattice_init_float)
+ * perform the following operations:
+ * - Compute the state-space matrices and their powers.
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ */
+
+/**
+ * @addtogroup IIR_Block
+ * @{
+ */
+
+/**
+ * Specific implementation of @ref ne10_iir_block_float using plain C.
+ */
+void ne10_iir_block_float_c (const ne10_iir_block_instance_f32_t * S,
+                             ne10_float32_t * pSrc,
+                             ne10_float32_t * pDst,
+                             ne10_uint32_t blockSize)
+{
+    ne10_uint32_t n = S->order;                         /* number of states per section */
+    ne10_uint32_t L = S->stepSize;                      /* samples per look-ahead step */
+    ne10_uint32_t sec, blkCnt, i, j;                    /* loop counters */
+    ne10_float32_t *pO, *pT, *pAL, *pG, *pA, *pB, *pC;  /* matrices of the current section */
+    ne10_float32_t D;                                   /* feedthrough of the current section */
+    ne10_float32_t *px;                                 /* state of the current section */
+    ne10_float32_t *pxNew = S->pState + S->numSections * n; /* working buffer for the next state */
+    ne10_float32_t *pIn, *pOut;                         /* input and output pointers */
+    ne10_float32_t u[8];                                /* inputs of one step */
+    ne10_float32_t acc;                                 /* Accumulator */
+
+    for (sec = 0; sec < S->numSections; sec++)
+    {
+        pO = S->pCoeffs + sec * NE10_IIR_BLOCK_COEFFS_LEN (n, L);
+        pT = pO + n * L;
+        pAL = pT + L * L;
+        pG = pAL + n * n;
+        pA = pG + n * L;
+        pB = pA + n * n;
+        pC = pB + n;
+        D = pC[n];
+        px = S->pState + sec * n;
+
+        /* The first section reads the input, the following ones work in place on the output */
+        pIn = (sec == 0u) ? pSrc : pDst;
+        pOut = pDst;
+
+        blkCnt = blockSize / L;
+        while (blkCnt > 0u)
+        {
+            /* Keep a copy of the inputs, pIn may alias pOut */
+            for (j = 0; j < L; j++)
+            {
+                u[j] = pIn[j];
+            }
+
+            /* x(n+L) = A^L * x(n) + G * u */
+            for (i = 0; i < n; i++)
+            {
+                acc = 0.0f;
+                for (j = 0; j < n; j++)
+                {
+                    acc += pAL[j * n + i] * px[j];
+                }
+                for (j = 0; j < L; j++)
+                {
+                    acc += pG[j * n + i] * u[j];
+                }
+                pxNew[i] = acc;
+            }
+
+            /* y = O * x(n) + T * u */
+            for (i = 0; i < L; i++)
+            {
+                acc = 0.0f;
+                for (j = 0; j < n; j++)
+                {
+                    acc += pO[j * L + i] * px[j];
+                }
+                for (j = 0; j <= i; j++)
+                {
+                    acc += pT[j * L + i] * u[j];
+                }
+                pOut[i] = acc;
+            }
+
+            for (i = 0; i < n; i++)
+            {
+                px[i] = pxNew[i];
+            }
+
+            pIn += L;
+            pOut += L;
+            blkCnt--;
+        }
+
+        /* Finish the block with the single-sample recursion */
+        blkCnt = blockSize % L;
+        while (blkCnt > 0u)
+        {
+            u[0] = *pIn++;
+
+            acc = D * u[0];
+            for (j = 0; j < n; j++)
+            {
+                acc += pC[j] * px[j];
+            }
+
+            for (i = 0; i < n; i++)
+            {
+                pxNew[i] = pB[i] * u[0];
+                for (j = 0; j < n; j++)
+                {
+                    pxNew[i] += pA[j * n + i] * px[j];
+                }
+            }
+            for (i = 0; i < n; i++)
+            {
+                px[i] = pxNew[i];
+            }
+
+            *pOut++ = acc;
+            blkCnt--;
+        }
+    }
+}
+/** @} */ //end of IIR_Block group
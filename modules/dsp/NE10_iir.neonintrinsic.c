@@ -0,0 +1,204 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_iir.neonintrinsic.c
+ */
+
+#include <arm_neon.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_dsp.h"
+
+/**
+ * @addtogroup IIR_Block
+ * @{
+ */
+
+/**
+ * Specific implementation of @ref ne10_iir_block_float using NEON SIMD capabilities.
+ */
+void ne10_iir_block_float_neon (const ne10_iir_block_instance_f32_t * S,
+                                ne10_float32_t * pSrc,
+                                ne10_float32_t * pDst,
+                                ne10_uint32_t blockSize)
+{
+    ne10_uint32_t n = S->order;
+    ne10_uint32_t L = S->stepSize;
+    ne10_uint32_t sec, blkCnt, i, j;
+    ne10_float32_t *pO, *pT, *pAL, *pG, *pA, *pB, *pC;
+    ne10_float32_t D;
+    ne10_float32_t *px;
+    ne10_float32_t *pxNew = S->pState + S->numSections * n;
+    ne10_float32_t *pIn, *pOut;
+    ne10_float32_t u[8];
+    ne10_float32_t acc;
+    float32x4_t q_y0, q_y1, q_x;
+    float32x2_t d_x;
+
+    for (sec = 0; sec < S->numSections; sec++)
+    {
+        pO = S->pCoeffs + sec * NE10_IIR_BLOCK_COEFFS_LEN (n, L);
+        pT = pO + n * L;
+        pAL = pT + L * L;
+        pG = pAL + n * n;
+        pA = pG + n * L;
+        pB = pA + n * n;
+        pC = pB + n;
+        D = pC[n];
+        px = S->pState + sec * n;
+
+        pIn = (sec == 0u) ? pSrc : pDst;
+        pOut = pDst;
+
+        blkCnt = blockSize / L;
+        while (blkCnt > 0u)
+        {
+            for (j = 0; j < L; j++)
+            {
+                u[j] = pIn[j];
+            }
+
+            /* x(n+L) = A^L * x(n) + G * u, four (then two, then one) rows at a time */
+            for (i = 0; i + 4 <= n; i += 4)
+            {
+                q_x = vdupq_n_f32 (0.0f);
+                for (j = 0; j < n; j++)
+                {
+                    q_x = vmlaq_n_f32 (q_x, vld1q_f32 (pAL + j * n + i), px[j]);
+                }
+                for (j = 0; j < L; j++)
+                {
+                    q_x = vmlaq_n_f32 (q_x, vld1q_f32 (pG + j * n + i), u[j]);
+                }
+                vst1q_f32 (pxNew + i, q_x);
+            }
+            if (i + 2 <= n)
+            {
+                d_x = vdup_n_f32 (0.0f);
+                for (j = 0; j < n; j++)
+                {
+                    d_x = vmla_n_f32 (d_x, vld1_f32 (pAL + j * n + i), px[j]);
+                }
+                for (j = 0; j < L; j++)
+                {
+                    d_x = vmla_n_f32 (d_x, vld1_f32 (pG + j * n + i), u[j]);
+                }
+                vst1_f32 (pxNew + i, d_x);
+                i += 2;
+            }
+            if (i < n)
+            {
+                acc = 0.0f;
+                for (j = 0; j < n; j++)
+                {
+                    acc += pAL[j * n + i] * px[j];
+                }
+                for (j = 0; j < L; j++)
+                {
+                    acc += pG[j * n + i] * u[j];
+                }
+                pxNew[i] = acc;
+            }
+
+            /* y = O * x(n) + T * u; the rows above the diagonal of T are zero and skipped */
+            q_y0 = vdupq_n_f32 (0.0f);
+            if (L == 4)
+            {
+                for (j = 0; j < n; j++)
+                {
+                    q_y0 = vmlaq_n_f32 (q_y0, vld1q_f32 (pO + j * 4), px[j]);
+                }
+                for (j = 0; j < 4; j++)
+                {
+                    q_y0 = vmlaq_n_f32 (q_y0, vld1q_f32 (pT + j * 4), u[j]);
+                }
+                vst1q_f32 (pOut, q_y0);
+            }
+            else
+            {
+                q_y1 = vdupq_n_f32 (0.0f);
+                for (j = 0; j < n; j++)
+                {
+                    q_y0 = vmlaq_n_f32 (q_y0, vld1q_f32 (pO + j * 8), px[j]);
+                    q_y1 = vmlaq_n_f32 (q_y1, vld1q_f32 (pO + j * 8 + 4), px[j]);
+                }
+                for (j = 0; j < 4; j++)
+                {
+                    q_y0 = vmlaq_n_f32 (q_y0, vld1q_f32 (pT + j * 8), u[j]);
+                    q_y1 = vmlaq_n_f32 (q_y1, vld1q_f32 (pT + j * 8 + 4), u[j]);
+                }
+                for (j = 4; j < 8; j++)
+                {
+                    q_y1 = vmlaq_n_f32 (q_y1, vld1q_f32 (pT + j * 8 + 4), u[j]);
+                }
+                vst1q_f32 (pOut, q_y0);
+                vst1q_f32 (pOut + 4, q_y1);
+            }
+
+            for (i = 0; i < n; i++)
+            {
+                px[i] = pxNew[i];
+            }
+
+            pIn += L;
+            pOut += L;
+            blkCnt--;
+        }
+
+        /* Finish the block with the single-sample recursion */
+        blkCnt = blockSize % L;
+        while (blkCnt > 0u)
+        {
+            u[0] = *pIn++;
+
+            acc = D * u[0];
+            for (j = 0; j < n; j++)
+            {
+                acc += pC[j] * px[j];
+            }
+
+            for (i = 0; i < n; i++)
+            {
+                pxNew[i] = pB[i] * u[0];
+                for (j = 0; j < n; j++)
+                {
+                    pxNew[i] += pA[j * n + i] * px[j];
+                }
+            }
+            for (i = 0; i < n; i++)
+            {
+                px[i] = pxNew[i];
+            }
+
+            *pOut++ = acc;
+            blkCnt--;
+        }
+    }
+}
+/** @} */ //end of IIR_Block group
@@ -29,6 +29,7 @@
  * NE10 Library : dsp/NE10_iir_init.c
  */
 #include "NE10_types.h"
+#include "NE10_macros.h"
 #include <string.h>
 
 
@@ -70,3 +71,241 @@ ne10_result_t ne10_iir_lattice_init_float (ne10_iir_lattice_instance_f32_t * S,
 /**
  * @} end of IIR_Lattice group
  */
+
+/**
+ * @addtogroup IIR_Block
+ * @{
+ */
+
+/* One sample of a reference filter in double precision: s_out = A * s_in + B * x, *y = C * s_in + D * x */
+typedef void (*ne10_iir_block_step_t) (const void * model,
+                                       const ne10_float64_t * s_in,
+                                       ne10_float64_t x,
+                                       ne10_float64_t * s_out,
+                                       ne10_float64_t * y);
+
+typedef struct
+{
+    const ne10_float32_t *pkCoeffs;
+    const ne10_float32_t *pvCoeffs;
+    ne10_uint32_t numStages;
+} ne10_iir_block_lattice_model_t;
+
+static void ne10_iir_block_biquad_step (const void * model,
+                                        const ne10_float64_t * s_in,
+                                        ne10_float64_t x,
+                                        ne10_float64_t * s_out,
+                                        ne10_float64_t * y)
+{
+    const ne10_float32_t *pCoeffs = (const ne10_float32_t *) model;
+
+    /* Transposed direct form II with coefficients {b0, b1, b2, a1, a2} */
+    *y = pCoeffs[0] * x + s_in[0];
+    s_out[0] = pCoeffs[1] * x + pCoeffs[3] * (*y) + s_in[1];
+    s_out[1] = pCoeffs[2] * x + pCoeffs[4] * (*y);
+}
+
+static void ne10_iir_block_lattice_step (const void * model,
+        const ne10_float64_t * s_in,
+        ne10_float64_t x,
+        ne10_float64_t * s_out,
+        ne10_float64_t * y)
+{
+    const ne10_iir_block_lattice_model_t *lat = (const ne10_iir_block_lattice_model_t *) model;
+    ne10_uint32_t N = lat->numStages;
+    ne10_float64_t f = x, g, acc = 0.0;
+    ne10_uint32_t m;
+
+    /* Same recursion as ne10_iir_lattice_float_c; the state holds gN-1(n-1) ... g0(n-1) */
+    for (m = 0; m < N; m++)
+    {
+        f = f - lat->pkCoeffs[m] * s_in[m];
+        g = f * lat->pkCoeffs[m] + s_in[m];
+        acc += g * lat->pvCoeffs[N - m];
+        if (m > 0)
+        {
+            s_out[m - 1] = g;
+        }
+    }
+    acc += f * lat->pvCoeffs[0];
+    s_out[N - 1] = f;
+    *y = acc;
+}
+
+/* Builds the matrices of one section from its single-sample recursion (see the IIR_Block group for the layout) */
+static void ne10_iir_block_build_section (ne10_float32_t * pCoeffs,
+        ne10_uint32_t n,
+        ne10_uint32_t L,
+        ne10_iir_block_step_t step,
+        const void * model,
+        ne10_float64_t * s,
+        ne10_float64_t * t)
+{
+    ne10_float32_t *pO = pCoeffs;
+    ne10_float32_t *pT = pO + n * L;
+    ne10_float32_t *pAL = pT + L * L;
+    ne10_float32_t *pG = pAL + n * n;
+    ne10_float32_t *pA = pG + n * L;
+    ne10_float32_t *pB = pA + n * n;
+    ne10_float32_t *pC = pB + n;
+    ne10_float64_t h[8];
+    ne10_float64_t y;
+    ne10_uint32_t i, j, k;
+
+    /* Free response from every unit state: columns of O, A and A^L and the entries of C */
+    for (j = 0; j < n; j++)
+    {
+        memset (s, 0, n * sizeof (ne10_float64_t));
+        s[j] = 1.0;
+        for (k = 0; k < L; k++)
+        {
+            step (model, s, 0.0, t, &y);
+            pO[j * L + k] = (ne10_float32_t) y;
+            if (k == 0)
+            {
+                pC[j] = (ne10_float32_t) y;
+                for (i = 0; i < n; i++)
+                {
+                    pA[j * n + i] = (ne10_float32_t) t[i];
+                }
+            }
+            memcpy (s, t, n * sizeof (ne10_float64_t));
+        }
+        for (i = 0; i < n; i++)
+        {
+            pAL[j * n + i] = (ne10_float32_t) s[i];
+        }
+    }
+
+    /* Impulse response from the zero state: D, B, the Markov parameters and the columns of G */
+    memset (s, 0, n * sizeof (ne10_float64_t));
+    for (k = 0; k < L; k++)
+    {
+        step (model, s, (k == 0) ? 1.0 : 0.0, t, &y);
+        h[k] = y;
+        memcpy (s, t, n * sizeof (ne10_float64_t));
+        /* s = A^k * B */
+        for (i = 0; i < n; i++)
+        {
+            pG[ (L - 1 - k) * n + i] = (ne10_float32_t) s[i];
+        }
+        if (k == 0)
+        {
+            for (i = 0; i < n; i++)
+            {
+                pB[i] = (ne10_float32_t) s[i];
+            }
+        }
+    }
+    pC[n] = (ne10_float32_t) h[0];
+
+    for (j = 0; j < L; j++)
+    {
+        for (i = 0; i < L; i++)
+        {
+            pT[j * L + i] = (i >= j) ? (ne10_float32_t) h[i - j] : 0.0f;
+        }
+    }
+}
+
+/**
+ * @brief Initialization function for the floating-point block IIR filter from a biquad cascade.
+ * @param[in]  *S             points to an instance of the floating-point block IIR structure.
+ * @param[in]  numStages      number of 2nd order stages in the filter.
+ * @param[in]  *pBiquadCoeffs points to the biquad coefficients. The array is of length 5*numStages
+ *                            and holds <code>{b0, b1, b2, a1, a2}</code> for each stage, implementing
+ *                            <code>y(n) = b0*x(n) + b1*x(n-1) + b2*x(n-2) + a1*y(n-1) + a2*y(n-2)</code>.
+ * @param[out] *pCoeffs       points to the matrix buffer. The array is of length numStages*NE10_IIR_BLOCK_COEFFS_LEN(2, stepSize).
+ * @param[in]  *pState        points to the state buffer. The array is of length 2*(numStages+1).
+ * @param[in]  stepSize       number of samples per look-ahead step, 4 or 8.
+ * @return NE10_OK on success, NE10_ERR for unsupported arguments.
+ */
+ne10_result_t ne10_iir_block_biquad_init_float (ne10_iir_block_instance_f32_t * S,
+        ne10_uint16_t numStages,
+        const ne10_float32_t * pBiquadCoeffs,
+        ne10_float32_t * pCoeffs,
+        ne10_float32_t * pState,
+        ne10_uint16_t stepSize)
+{
+    ne10_float64_t s[2], t[2];
+    ne10_uint32_t stage;
+
+    if ( (numStages == 0) || ( (stepSize != 4) && (stepSize != 8)))
+    {
+        return NE10_ERR;
+    }
+
+    for (stage = 0; stage < numStages; stage++)
+    {
+        ne10_iir_block_build_section (pCoeffs + stage * NE10_IIR_BLOCK_COEFFS_LEN (2, stepSize),
+                                      2, stepSize, ne10_iir_block_biquad_step,
+                                      pBiquadCoeffs + 5 * stage, s, t);
+    }
+
+    S->numSections = numStages;
+    S->order = 2;
+    S->stepSize = stepSize;
+    S->pCoeffs = pCoeffs;
+
+    /* Clear state buffer and size is always 2 * (numStages + 1) */
+    memset (pState, 0, 2 * (numStages + 1) * sizeof (ne10_float32_t));
+    S->pState = pState;
+
+    return NE10_OK;
+}
+
+/**
+ * @brief Initialization function for the floating-point block IIR filter from an IIR lattice.
+ * @param[in]  *S        points to an instance of the floating-point block IIR structure.
+ * @param[in]  numStages number of stages in the lattice filter.
+ * @param[in]  *pkCoeffs points to the reflection coefficient buffer, laid out as for @ref ne10_iir_lattice_init_float.
+ * @param[in]  *pvCoeffs points to the ladder coefficient buffer, laid out as for @ref ne10_iir_lattice_init_float.
+ * @param[out] *pCoeffs  points to the matrix buffer. The array is of length NE10_IIR_BLOCK_COEFFS_LEN(numStages, stepSize).
+ * @param[in]  *pState   points to the state buffer. The array is of length 2*numStages.
+ * @param[in]  stepSize  number of samples per look-ahead step, 4 or 8.
+ * @return NE10_OK on success, NE10_ERR for unsupported arguments or if the temporary memory cannot be allocated.
+ */
+ne10_result_t ne10_iir_block_lattice_init_float (ne10_iir_block_instance_f32_t * S,
+        ne10_uint16_t numStages,
+        const ne10_float32_t * pkCoeffs,
+        const ne10_float32_t * pvCoeffs,
+        ne10_float32_t * pCoeffs,
+        ne10_float32_t * pState,
+        ne10_uint16_t stepSize)
+{
+    ne10_iir_block_lattice_model_t lat;
+    ne10_float64_t *s;
+
+    if ( (numStages == 0) || ( (stepSize != 4) && (stepSize != 8)))
+    {
+        return NE10_ERR;
+    }
+
+    s = (ne10_float64_t *) NE10_MALLOC (2 * numStages * sizeof (ne10_float64_t));
+    if (s == NULL)
+    {
+        return NE10_ERR;
+    }
+
+    lat.pkCoeffs = pkCoeffs;
+    lat.pvCoeffs = pvCoeffs;
+    lat.numStages = numStages;
+    ne10_iir_block_build_section (pCoeffs, numStages, stepSize, ne10_iir_block_lattice_step,
+                                  &lat, s, s + numStages);
+    NE10_FREE (s);
+
+    S->numSections = 1;
+    S->order = numStages;
+    S->stepSize = stepSize;
+    S->pCoeffs = pCoeffs;
+
+    /* Clear state buffer and size is always 2 * numStages */
+    memset (pState, 0, 2 * numStages * sizeof (ne10_float32_t));
+    S->pState = pState;
+
+    return NE10_OK;
+}
+
+/**
+ * @} end of IIR_Block group
+ */
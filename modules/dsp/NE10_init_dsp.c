@@ -34,6 +34,7 @@ ne10_result_t ne10_init_dsp (ne10_int32_t is_NEON_available)
     if (NE10_OK == is_NEON_available)
     {
         ne10_fft_alloc_c2c_float32 = ne10_fft_alloc_c2c_float32_neon;
+        ne10_fft_alloc_c2c_float32_inplace = ne10_fft_alloc_c2c_float32_inplace_neon;
         ne10_fft_alloc_c2c_int32 = ne10_fft_alloc_c2c_int32_neon;
         ne10_fft_c2c_1d_float32 = ne10_fft_c2c_1d_float32_neon;
         ne10_fft_r2c_1d_float32 = ne10_fft_r2c_1d_float32_neon;
@@ -65,6 +66,11 @@ ne10_result_t ne10_init_dsp (ne10_int32_t is_NEON_available)
         ne10_fir_interpolate_float = ne10_fir_interpolate_float_c;
 #endif // ENABLE_NE10_FIR_INTERPOLATE_FLOAT_NEON
 
+        ne10_fir_halfband_decimate_float = ne10_fir_halfband_decimate_float_neon;
+        ne10_fir_halfband_interpolate_float = ne10_fir_halfband_interpolate_float_neon;
+        ne10_fir_cascade_float = ne10_fir_cascade_float_neon;
+        ne10_resampler_float = ne10_resampler_float_neon;
+
 #ifdef ENABLE_NE10_FIR_LATTICE_FLOAT_NEON
         ne10_fir_lattice_float = ne10_fir_lattice_float_neon;
 #else
@@ -76,16 +82,52 @@ ne10_result_t ne10_init_dsp (ne10_int32_t is_NEON_available)
 #else
         ne10_fir_sparse_float = ne10_fir_sparse_float_c;
 #endif // ENABLE_NE10_FIR_SPARSE_FLOAT_NEON
+        ne10_fir_sparse_linear_float = ne10_fir_sparse_linear_float_neon;
 
 #ifdef ENABLE_NE10_IIR_LATTICE_FLOAT_NEON
         ne10_iir_lattice_float = ne10_iir_lattice_float_neon;
 #else
         ne10_iir_lattice_float = ne10_iir_lattice_float_c;
 #endif // ENABLE_NE10_IIR_LATTICE_FLOAT_NEON
+
+        ne10_iir_block_float = ne10_iir_block_float_neon;
+
+        ne10_lms_norm_float = ne10_lms_norm_float_neon;
+        ne10_lms_norm_int32 = ne10_lms_norm_int32_neon;
+        ne10_lms_fd_float = ne10_lms_fd_float_neon;
+
+        ne10_correlate_float = ne10_correlate_float_neon;
+        ne10_autocorr_float = ne10_autocorr_float_neon;
+        ne10_correlate_int16 = ne10_correlate_int16_neon;
+        ne10_autocorr_int16 = ne10_autocorr_int16_neon;
+
+        ne10_stft_float32 = ne10_stft_float32_neon;
+        ne10_istft_float32 = ne10_istft_float32_neon;
+
+        ne10_mfcc_float32 = ne10_mfcc_float32_neon;
+        ne10_mfcc_int16 = ne10_mfcc_int16_neon;
+
+        ne10_dct2_float32 = ne10_dct2_float32_neon;
+        ne10_dct3_float32 = ne10_dct3_float32_neon;
+        ne10_dct4_float32 = ne10_dct4_float32_neon;
+        ne10_mdct_float32 = ne10_mdct_float32_neon;
+        ne10_imdct_float32 = ne10_imdct_float32_neon;
+        ne10_dct_8x8_float32 = ne10_dct_8x8_float32_neon;
+        ne10_idct_8x8_float32 = ne10_idct_8x8_float32_neon;
+        ne10_dct_4x4_float32 = ne10_dct_4x4_float32_neon;
+        ne10_idct_4x4_float32 = ne10_idct_4x4_float32_neon;
+        ne10_dct_8x8_int16 = ne10_dct_8x8_int16_neon;
+        ne10_idct_8x8_int16 = ne10_idct_8x8_int16_neon;
+        ne10_dct_4x4_int16 = ne10_dct_4x4_int16_neon;
+        ne10_idct_4x4_int16 = ne10_idct_4x4_int16_neon;
+
+        ne10_goertzel_float32 = ne10_goertzel_float32_neon;
+        ne10_sdft_float32 = ne10_sdft_float32_neon;
     }
     else
     {
         ne10_fft_alloc_c2c_float32 = ne10_fft_alloc_c2c_float32_c;
+        ne10_fft_alloc_c2c_float32_inplace = ne10_fft_alloc_c2c_float32_inplace_c;
         ne10_fft_alloc_c2c_int32 = ne10_fft_alloc_c2c_int32_c;
         ne10_fft_c2c_1d_float32 = ne10_fft_c2c_1d_float32_c;
         ne10_fft_r2c_1d_float32 = ne10_fft_r2c_1d_float32_c;
@@ -102,16 +144,55 @@ ne10_result_t ne10_init_dsp (ne10_int32_t is_NEON_available)
         ne10_fir_float = ne10_fir_float_c;
         ne10_fir_decimate_float = ne10_fir_decimate_float_c;
         ne10_fir_interpolate_float = ne10_fir_interpolate_float_c;
+        ne10_fir_halfband_decimate_float = ne10_fir_halfband_decimate_float_c;
+        ne10_fir_halfband_interpolate_float = ne10_fir_halfband_interpolate_float_c;
+        ne10_fir_cascade_float = ne10_fir_cascade_float_c;
+        ne10_resampler_float = ne10_resampler_float_c;
         ne10_fir_lattice_float = ne10_fir_lattice_float_c;
         ne10_fir_sparse_float = ne10_fir_sparse_float_c;
+        ne10_fir_sparse_linear_float = ne10_fir_sparse_linear_float_c;
 
         ne10_iir_lattice_float = ne10_iir_lattice_float_c;
+        ne10_iir_block_float = ne10_iir_block_float_c;
+
+        ne10_lms_norm_float = ne10_lms_norm_float_c;
+        ne10_lms_norm_int32 = ne10_lms_norm_int32_c;
+        ne10_lms_fd_float = ne10_lms_fd_float_c;
+
+        ne10_correlate_float = ne10_correlate_float_c;
+        ne10_autocorr_float = ne10_autocorr_float_c;
+        ne10_correlate_int16 = ne10_correlate_int16_c;
+        ne10_autocorr_int16 = ne10_autocorr_int16_c;
+
+        ne10_stft_float32 = ne10_stft_float32_c;
+        ne10_istft_float32 = ne10_istft_float32_c;
+
+        ne10_mfcc_float32 = ne10_mfcc_float32_c;
+        ne10_mfcc_int16 = ne10_mfcc_int16_c;
+
+        ne10_dct2_float32 = ne10_dct2_float32_c;
+        ne10_dct3_float32 = ne10_dct3_float32_c;
+        ne10_dct4_float32 = ne10_dct4_float32_c;
+        ne10_mdct_float32 = ne10_mdct_float32_c;
+        ne10_imdct_float32 = ne10_imdct_float32_c;
+        ne10_dct_8x8_float32 = ne10_dct_8x8_float32_c;
+        ne10_idct_8x8_float32 = ne10_idct_8x8_float32_c;
+        ne10_dct_4x4_float32 = ne10_dct_4x4_float32_c;
+        ne10_idct_4x4_float32 = ne10_idct_4x4_float32_c;
+        ne10_dct_8x8_int16 = ne10_dct_8x8_int16_c;
+        ne10_idct_8x8_int16 = ne10_idct_8x8_int16_c;
+        ne10_dct_4x4_int16 = ne10_dct_4x4_int16_c;
+        ne10_idct_4x4_int16 = ne10_idct_4x4_int16_c;
+
+        ne10_goertzel_float32 = ne10_goertzel_float32_c;
+        ne10_sdft_float32 = ne10_sdft_float32_c;
     }
     return NE10_OK;
 }
 
 // These are actual definitions of our function pointers that are declared in inc/NE10_dsp.h
 ne10_fft_cfg_float32_t (*ne10_fft_alloc_c2c_float32) (ne10_int32_t nfft);
+ne10_fft_cfg_float32_t (*ne10_fft_alloc_c2c_float32_inplace) (void *mem, ne10_uint32_t mem_size, ne10_int32_t nfft);
 ne10_fft_cfg_int32_t (*ne10_fft_alloc_c2c_int32) (ne10_int32_t nfft);
 
 void (*ne10_fft_c2c_1d_float32) (ne10_fft_cpx_float32_t *fout,
@@ -177,6 +258,28 @@ void (*ne10_fir_interpolate_float) (
     ne10_float32_t * pDst,
     ne10_uint32_t blockSize);
 
+void (*ne10_fir_halfband_decimate_float) (
+    const ne10_fir_halfband_instance_f32_t * S,
+    ne10_float32_t * pSrc,
+    ne10_float32_t * pDst,
+    ne10_uint32_t blockSize);
+
+void (*ne10_fir_halfband_interpolate_float) (
+    const ne10_fir_halfband_instance_f32_t * S,
+    ne10_float32_t * pSrc,
+    ne10_float32_t * pDst,
+    ne10_uint32_t blockSize);
+
+ne10_uint32_t (*ne10_fir_cascade_float) (ne10_fir_cascade_cfg_f32_t cfg,
+        ne10_float32_t * pSrc,
+        ne10_float32_t * pDst,
+        ne10_uint32_t blockSize);
+
+ne10_uint32_t (*ne10_resampler_float) (ne10_resampler_instance_f32_t * S,
+                                       ne10_float32_t * pSrc,
+                                       ne10_float32_t * pDst,
+                                       ne10_uint32_t blockSize);
+
 void (*ne10_fir_lattice_float) (
     const ne10_fir_lattice_instance_f32_t * S,
     ne10_float32_t * pSrc,
@@ -190,7 +293,130 @@ void (*ne10_fir_sparse_float) (
     ne10_float32_t * pScratchIn,
     ne10_uint32_t blockSize);
 
+void (*ne10_fir_sparse_linear_float) (
+    ne10_fir_sparse_linear_instance_f32_t * S,
+    ne10_float32_t * pSrc,
+    ne10_float32_t * pDst,
+    ne10_uint32_t blockSize);
+
 void (*ne10_iir_lattice_float) (const ne10_iir_lattice_instance_f32_t * S,
                                 ne10_float32_t * pSrc,
                                 ne10_float32_t * pDst,
                                 ne10_uint32_t blockSize);
+
+void (*ne10_iir_block_float) (const ne10_iir_block_instance_f32_t * S,
+                              ne10_float32_t * pSrc,
+                              ne10_float32_t * pDst,
+                              ne10_uint32_t blockSize);
+
+void (*ne10_lms_norm_float) (ne10_lms_norm_instance_f32_t * S,
+                             ne10_float32_t * pSrc,
+                             ne10_float32_t * pRef,
+                             ne10_float32_t * pOut,
+                             ne10_float32_t * pErr,
+                             ne10_uint32_t blockSize);
+
+void (*ne10_lms_norm_int32) (ne10_lms_norm_instance_int32_t * S,
+                             ne10_int32_t * pSrc,
+                             ne10_int32_t * pRef,
+                             ne10_int32_t * pOut,
+                             ne10_int32_t * pErr,
+                             ne10_uint32_t blockSize);
+
+void (*ne10_lms_fd_float) (ne10_lms_fd_instance_f32_t * S,
+                           ne10_float32_t * pSrc,
+                           ne10_float32_t * pRef,
+                           ne10_float32_t * pOut,
+                           ne10_float32_t * pErr,
+                           ne10_uint32_t blockSize);
+
+void (*ne10_correlate_float) (ne10_corr_cfg_float32_t cfg,
+                              ne10_float32_t * pDst,
+                              ne10_float32_t * pSrcA,
+                              ne10_float32_t * pSrcB);
+
+void (*ne10_autocorr_float) (ne10_corr_cfg_float32_t cfg,
+                             ne10_float32_t * pDst,
+                             ne10_float32_t * pSrc);
+
+void (*ne10_correlate_int16) (ne10_corr_cfg_float32_t cfg,
+                              ne10_int16_t * pDst,
+                              ne10_int16_t * pSrcA,
+                              ne10_int16_t * pSrcB);
+
+void (*ne10_autocorr_int16) (ne10_corr_cfg_float32_t cfg,
+                             ne10_int16_t * pDst,
+                             ne10_int16_t * pSrc);
+
+ne10_uint32_t (*ne10_stft_float32) (ne10_stft_cfg_float32_t cfg,
+                                    ne10_float32_t * pSrc,
+                                    ne10_uint32_t srcLen);
+
+ne10_uint32_t (*ne10_istft_float32) (ne10_stft_cfg_float32_t cfg,
+                                     ne10_float32_t * pDst,
+                                     ne10_fft_cpx_float32_t * pSrc);
+
+void (*ne10_mfcc_float32) (ne10_mfcc_cfg_float32_t cfg,
+                           ne10_float32_t * pCeps,
+                           ne10_float32_t * pLogMel,
+                           const ne10_fft_cpx_float32_t * pSrc);
+
+void (*ne10_mfcc_int16) (ne10_mfcc_cfg_float32_t cfg,
+                         ne10_float32_t * pCeps,
+                         ne10_float32_t * pLogMel,
+                         const ne10_fft_cpx_int16_t * pSrc,
+                         ne10_int32_t scaled_flag);
+
+void (*ne10_dct2_float32) (ne10_dct_cfg_float32_t cfg,
+                           ne10_float32_t * pDst,
+                           ne10_float32_t * pSrc);
+
+void (*ne10_dct3_float32) (ne10_dct_cfg_float32_t cfg,
+                           ne10_float32_t * pDst,
+                           ne10_float32_t * pSrc);
+
+void (*ne10_dct4_float32) (ne10_dct_cfg_float32_t cfg,
+                           ne10_float32_t * pDst,
+                           ne10_float32_t * pSrc);
+
+void (*ne10_mdct_float32) (ne10_mdct_cfg_float32_t cfg,
+                           ne10_float32_t * pDst,
+                           ne10_float32_t * pSrc);
+
+void (*ne10_imdct_float32) (ne10_mdct_cfg_float32_t cfg,
+                            ne10_float32_t * pDst,
+                            ne10_float32_t * pSrc);
+
+void (*ne10_dct_8x8_float32) (ne10_float32_t * pDst,
+                              const ne10_float32_t * pSrc);
+
+void (*ne10_idct_8x8_float32) (ne10_float32_t * pDst,
+                               const ne10_float32_t * pSrc);
+
+void (*ne10_dct_4x4_float32) (ne10_float32_t * pDst,
+                              const ne10_float32_t * pSrc);
+
+void (*ne10_idct_4x4_float32) (ne10_float32_t * pDst,
+                               const ne10_float32_t * pSrc);
+
+void (*ne10_dct_8x8_int16) (ne10_int16_t * pDst,
+                            const ne10_int16_t * pSrc);
+
+void (*ne10_idct_8x8_int16) (ne10_int16_t * pDst,
+                             const ne10_int16_t * pSrc);
+
+void (*ne10_dct_4x4_int16) (ne10_int16_t * pDst,
+                            const ne10_int16_t * pSrc);
+
+void (*ne10_idct_4x4_int16) (ne10_int16_t * pDst,
+                             const ne10_int16_t * pSrc);
+
+ne10_uint32_t (*ne10_goertzel_float32) (ne10_goertzel_cfg_float32_t cfg,
+                                        ne10_float32_t * pPower,
+                                        ne10_float32_t * pSrc,
+                                        ne10_uint32_t srcLen);
+
+void (*ne10_sdft_float32) (ne10_sdft_cfg_float32_t cfg,
+                           ne10_fft_cpx_float32_t * pDst,
+                           ne10_float32_t * pSrc,
+                           ne10_uint32_t srcLen);
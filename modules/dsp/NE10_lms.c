@@ -0,0 +1,442 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_lms.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_dsp.h"
+
+/**
+ * @ingroup groupDSPs
+ */
+
+/**
+ * @defgroup LMS_Norm Normalized LMS Adaptive Filters
+ *
+ * \par
+ * These functions implement adaptive FIR filters updated with the normalized least mean square (NLMS)
+ * algorithm, as used in echo cancellation and channel equalization. For every input sample the filter
+ * computes its output, compares it with the reference signal and moves the coefficients along the input
+ * vector by an amount proportional to the error and inversely proportional to the energy of the input:
+ * <pre>
+ *    y[n] = b[0] * x[n] + b[1] * x[n-1] + ... + b[numTaps-1] * x[n-numTaps+1]
+ *    e[n] = d[n] - y[n]
+ *    E[n] = x[n]^2 + x[n-1]^2 + ... + x[n-numTaps+1]^2
+ *    b[k] = b[k] + mu * e[n] * x[n-k] / (E[n] + delta)
+ * </pre>
+ * The energy is updated recursively by adding the square of the new sample and removing the square of
+ * the sample that leaves the window, so the cost per sample is <code>2*numTaps</code> multiply-accumulates.
+ * The NEON versions vectorize both the output sum and the coefficient update over the taps.
+ * \par
+ * <code>pCoeffs</code> points to an array of <code>numTaps</code> coefficients stored in time reversed order,
+ * <code>{b[numTaps-1], ..., b[1], b[0]}</code>, which is updated in place. <code>pState</code> points to a state
+ * array of length <code>numTaps+blockSize-1</code>. The step size <code>mu</code> should be in <code>(0, 2)</code>.
+ *
+ * \par Q31
+ * In @ref ne10_lms_norm_int32 the samples are in Q31 and the coefficients are stored scaled by
+ * <code>2^-postShift</code>, so that filters with a gain larger than 1 can be represented. The output sum is
+ * accumulated in 64 bits and the output, the error and the coefficients saturate. The energy is kept in 64 bits,
+ * so long filters with loud inputs do not overflow it. The normalized step <code>mu * e / (E + delta)</code> is
+ * kept as a mantissa and a shift, so it is not limited to 1.0 when the error is large next to the energy.
+ */
+
+/**
+ * @defgroup LMS_FD Frequency Domain Block LMS Adaptive Filters
+ *
+ * \par
+ * The frequency domain block LMS filter, also known as the fast block LMS or FDAF, gives the same kind of
+ * adaptation as @ref LMS_Norm for long filters at a fraction of the cost. The input is processed in blocks of
+ * <code>N = numTaps</code> samples with real FFTs of length <code>2N</code> (overlap-save):
+ * <pre>
+ *    X = FFT([x_previous, x_current])          W = FFT([w, 0])
+ *    y = last N samples of IFFT(X * W)
+ *    e = d - y,                                E = FFT([0, e])
+ *    P = beta * P + (1 - beta) * |X|^2
+ *    g = first N samples of IFFT(conj(X) * E / (P + delta))
+ *    W = W + mu * FFT([g, 0])
+ * </pre>
+ * Each block costs five FFTs of length <code>2N</code> and <code>O(N)</code> work per bin, so the cost per sample
+ * grows with <code>log(N)</code> instead of <code>N</code>. Normalizing every bin by its own power also makes
+ * the convergence less sensitive to the colour of the input than in the sample by sample NLMS. The filter
+ * output is delayed by one block compared with a sample by sample adaptive filter, because the coefficients
+ * are only updated at the end of each block.
+ * \par
+ * The instance references an r2c FFT configuration of length <code>2*numTaps</code> allocated by the caller
+ * with @ref ne10_fft_alloc_r2c_float32, so <code>numTaps</code> must be a power of 2. <code>pCoeffs</code> holds
+ * <code>numTaps+1</code> frequency domain coefficients and <code>pState</code> points to an array of
+ * <code>NE10_LMS_FD_STATE_LEN(numTaps)</code> words. <code>blockSize</code> must be a multiple of <code>numTaps</code>.
+ * The step size <code>mu</code> should be in <code>(0, 1]</code>.
+ */
+
+#define NE10_LMS_DELTA_F32      (1e-10f)
+#define NE10_LMS_DELTA_Q31      (0x100)
+#define NE10_LMS_ENERGY_RECOMPUTE (1e-3f)
+
+static inline ne10_int32_t ne10_lms_sat_q31 (ne10_int64_t x)
+{
+    if (x > 0x7fffffffLL)
+    {
+        return 0x7fffffff;
+    }
+    if (x < -0x80000000LL)
+    {
+        return (ne10_int32_t) 0x80000000;
+    }
+    return (ne10_int32_t) x;
+}
+
+/*
+ * Rounding errors of the recursive energy update are relative to the largest energy since it was
+ * last computed exactly. Once the energy falls far below that, after a loud passage, or below zero,
+ * it is recomputed from the window, so the step never divides by a drifted value.
+ */
+static inline ne10_float32_t ne10_lms_energy_float (ne10_float32_t energy,
+        ne10_float32_t * pPeak,
+        const ne10_float32_t * pWindow,
+        ne10_uint32_t numTaps)
+{
+    ne10_uint32_t k;
+
+    if (energy < NE10_LMS_ENERGY_RECOMPUTE * (*pPeak))
+    {
+        energy = 0.0f;
+        for (k = 0; k < numTaps; k++)
+        {
+            energy += pWindow[k] * pWindow[k];
+        }
+        *pPeak = energy;
+    }
+    else if (energy > *pPeak)
+    {
+        *pPeak = energy;
+    }
+    return energy;
+}
+
+/*
+ * mu * e / (E + delta) as a Q30 mantissa and the right shift that applies it to the
+ * coefficients, (w * x) >> shift. Keeping the exponent apart means that a step above 1.0,
+ * a loud error over a quiet window as at start-up, is not saturated.
+ */
+static inline ne10_int32_t ne10_lms_step_q31 (ne10_int32_t errorXmu,
+        ne10_int64_t energy,
+        ne10_uint32_t updShift,
+        ne10_uint32_t * pShift)
+{
+    ne10_int64_t d = energy + NE10_LMS_DELTA_Q31;
+    ne10_int32_t shift = (ne10_int32_t) updShift - 1;
+
+    /* Normalize the denominator to [2^30, 2^31) */
+    while (d >= (1LL << 31))
+    {
+        d >>= 1;
+        shift++;
+    }
+    while (d < (1LL << 30))
+    {
+        d <<= 1;
+        shift--;
+    }
+    /* The step is below the resolution of the coefficients */
+    if (shift > 62)
+    {
+        *pShift = 62u;
+        return 0;
+    }
+    *pShift = (ne10_uint32_t) shift;
+    return (ne10_int32_t) ( ( (ne10_int64_t) errorXmu * (1LL << 30)) / d);
+}
+
+/**
+ * @addtogroup LMS_Norm
+ * @{
+ */
+
+/**
+ * Specific implementation of @ref ne10_lms_norm_float using plain C.
+ */
+void ne10_lms_norm_float_c (ne10_lms_norm_instance_f32_t * S,
+                            ne10_float32_t * pSrc,
+                            ne10_float32_t * pRef,
+                            ne10_float32_t * pOut,
+                            ne10_float32_t * pErr,
+                            ne10_uint32_t blockSize)
+{
+    ne10_float32_t *pState = S->pState;                 /* State pointer */
+    ne10_float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+    ne10_float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+    ne10_float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+    ne10_float32_t mu = S->mu;                          /* Adaptive factor */
+    ne10_float32_t energy = S->energy;                  /* Energy of the filter window */
+    ne10_float32_t peak = S->energy;                    /* Largest energy since it was last exact */
+    ne10_float32_t x0 = S->x0;                          /* Sample leaving the filter window */
+    ne10_float32_t in, acc, e, w;
+    ne10_uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+    ne10_uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+    /* S->pState points to the previous frame (numTaps - 1) samples */
+    pStateCurnt = &(S->pState[numTaps - 1u]);
+
+    blkCnt = blockSize;
+    while (blkCnt > 0u)
+    {
+        in = *pSrc++;
+        *pStateCurnt++ = in;
+
+        /* Update the energy of the window */
+        energy -= x0 * x0;
+        energy += in * in;
+        energy = ne10_lms_energy_float (energy, &peak, pState, numTaps);
+
+        /* Filter output */
+        px = pState;
+        pb = pCoeffs;
+        acc = 0.0f;
+        tapCnt = numTaps;
+        while (tapCnt > 0u)
+        {
+            acc += (*px++) * (*pb++);
+            tapCnt--;
+        }
+        *pOut++ = acc;
+
+        e = *pRef++ - acc;
+        *pErr++ = e;
+
+        /* Normalized step along the input vector */
+        w = e * mu / (energy + NE10_LMS_DELTA_F32);
+
+        px = pState;
+        pb = pCoeffs;
+        tapCnt = numTaps;
+        while (tapCnt > 0u)
+        {
+            *pb += w * (*px++);
+            pb++;
+            tapCnt--;
+        }
+
+        x0 = *pState;
+        pState++;
+        blkCnt--;
+    }
+
+    S->energy = energy;
+    S->x0 = x0;
+
+    /* Copy the last numTaps - 1 samples to the start of the state buffer */
+    pStateCurnt = S->pState;
+    tapCnt = numTaps - 1u;
+    while (tapCnt > 0u)
+    {
+        *pStateCurnt++ = *pState++;
+        tapCnt--;
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_lms_norm_int32 using plain C.
+ */
+void ne10_lms_norm_int32_c (ne10_lms_norm_instance_int32_t * S,
+                            ne10_int32_t * pSrc,
+                            ne10_int32_t * pRef,
+                            ne10_int32_t * pOut,
+                            ne10_int32_t * pErr,
+                            ne10_uint32_t blockSize)
+{
+    ne10_int32_t *pState = S->pState;
+    ne10_int32_t *pCoeffs = S->pCoeffs;
+    ne10_int32_t *pStateCurnt;
+    ne10_int32_t *px, *pb;
+    ne10_int32_t mu = S->mu;
+    ne10_int64_t energy = S->energy;
+    ne10_int32_t x0 = S->x0;
+    ne10_int32_t in, y, e, errorXmu, w;
+    ne10_int64_t acc;
+    ne10_uint32_t outShift = 31u - S->postShift;        /* Q(31-postShift) products to Q31 output */
+    ne10_uint32_t updShift = 31u + S->postShift;        /* Q31 update to the scaled coefficients */
+    ne10_uint32_t wShift;
+    ne10_uint32_t numTaps = S->numTaps;
+    ne10_uint32_t tapCnt, blkCnt;
+
+    pStateCurnt = &(S->pState[numTaps - 1u]);
+
+    blkCnt = blockSize;
+    while (blkCnt > 0u)
+    {
+        in = *pSrc++;
+        *pStateCurnt++ = in;
+
+        /* Both terms are truncated the same way, so the energy stays exact */
+        energy += ( ( (ne10_int64_t) in * in) >> 31) - ( ( (ne10_int64_t) x0 * x0) >> 31);
+
+        px = pState;
+        pb = pCoeffs;
+        acc = 0;
+        tapCnt = numTaps;
+        while (tapCnt > 0u)
+        {
+            acc += (ne10_int64_t) (*px++) * (*pb++);
+            tapCnt--;
+        }
+        y = ne10_lms_sat_q31 (acc >> outShift);
+        *pOut++ = y;
+
+        e = ne10_lms_sat_q31 ( (ne10_int64_t) (*pRef++) - y);
+        *pErr++ = e;
+
+        errorXmu = (ne10_int32_t) ( ( (ne10_int64_t) e * mu) >> 31);
+        w = ne10_lms_step_q31 (errorXmu, energy, updShift, &wShift);
+
+        /* The update saturates before it is added, as in the NEON version */
+        px = pState;
+        pb = pCoeffs;
+        tapCnt = numTaps;
+        while (tapCnt > 0u)
+        {
+            *pb = ne10_lms_sat_q31 ( (ne10_int64_t) (*pb) + ne10_lms_sat_q31 ( ( (ne10_int64_t) w * (*px++)) >> wShift));
+            pb++;
+            tapCnt--;
+        }
+
+        x0 = *pState;
+        pState++;
+        blkCnt--;
+    }
+
+    S->energy = energy;
+    S->x0 = x0;
+
+    pStateCurnt = S->pState;
+    tapCnt = numTaps - 1u;
+    while (tapCnt > 0u)
+    {
+        *pStateCurnt++ = *pState++;
+        tapCnt--;
+    }
+}
+/** @} */ //end of LMS_Norm group
+
+/**
+ * @addtogroup LMS_FD
+ * @{
+ */
+
+/**
+ * Specific implementation of @ref ne10_lms_fd_float using plain C.
+ */
+void ne10_lms_fd_float_c (ne10_lms_fd_instance_f32_t * S,
+                          ne10_float32_t * pSrc,
+                          ne10_float32_t * pRef,
+                          ne10_float32_t * pOut,
+                          ne10_float32_t * pErr,
+                          ne10_uint32_t blockSize)
+{
+    ne10_uint32_t N = S->numTaps;
+    ne10_uint32_t numBins = N + 1u;
+    ne10_float32_t *pX = S->pState;                     /* 2N input samples, previous block first */
+    ne10_float32_t *pT = pX + 2 * N;                    /* 2N time domain scratch */
+    ne10_fft_cpx_float32_t *pXf = (ne10_fft_cpx_float32_t *) (pT + 2 * N);  /* spectrum of the input */
+    ne10_fft_cpx_float32_t *pGf = pXf + numBins;        /* frequency domain scratch */
+    ne10_float32_t *pP = (ne10_float32_t *) (pGf + numBins);    /* bin power estimate */
+    ne10_fft_cpx_float32_t *pW = S->pCoeffs;
+    ne10_float32_t beta = S->powerValid ? S->beta : 0.0f;
+    ne10_float32_t mu = S->mu;
+    ne10_float32_t xr, xi, er, ei, scale;
+    ne10_uint32_t i, blk;
+
+    for (blk = 0; blk < blockSize; blk += N)
+    {
+        for (i = 0; i < N; i++)
+        {
+            pX[N + i] = pSrc[blk + i];
+        }
+
+        /* Filter: the last N samples of the circular convolution are the linear convolution */
+        for (i = 0; i < 2 * N; i++)
+        {
+            pT[i] = pX[i];
+        }
+        ne10_fft_r2c_1d_float32_c (pXf, pT, S->cfg);
+        for (i = 0; i < numBins; i++)
+        {
+            pGf[i].r = pXf[i].r * pW[i].r - pXf[i].i * pW[i].i;
+            pGf[i].i = pXf[i].r * pW[i].i + pXf[i].i * pW[i].r;
+        }
+        ne10_fft_c2r_1d_float32_c (pT, pGf, S->cfg);
+        for (i = 0; i < N; i++)
+        {
+            pOut[blk + i] = pT[N + i];
+            pErr[blk + i] = pRef[blk + i] - pT[N + i];
+        }
+
+        /* Error spectrum, with the error in the second half */
+        for (i = 0; i < N; i++)
+        {
+            pT[i] = 0.0f;
+            pT[N + i] = pErr[blk + i];
+        }
+        ne10_fft_r2c_1d_float32_c (pGf, pT, S->cfg);
+
+        /* Power normalized correlation of the input and the error */
+        for (i = 0; i < numBins; i++)
+        {
+            xr = pXf[i].r;
+            xi = pXf[i].i;
+            er = pGf[i].r;
+            ei = pGf[i].i;
+            pP[i] = beta * pP[i] + (1.0f - beta) * (xr * xr + xi * xi);
+            scale = 1.0f / (pP[i] + NE10_LMS_DELTA_F32);
+            pGf[i].r = (xr * er + xi * ei) * scale;
+            pGf[i].i = (xr * ei - xi * er) * scale;
+        }
+        S->powerValid = 1;
+        beta = S->beta;
+
+        /* Keep the causal part of the gradient, so that W stays the spectrum of N taps */
+        ne10_fft_c2r_1d_float32_c (pT, pGf, S->cfg);
+        for (i = 0; i < N; i++)
+        {
+            pT[N + i] = 0.0f;
+        }
+        ne10_fft_r2c_1d_float32_c (pGf, pT, S->cfg);
+        for (i = 0; i < numBins; i++)
+        {
+            pW[i].r += mu * pGf[i].r;
+            pW[i].i += mu * pGf[i].i;
+        }
+
+        for (i = 0; i < N; i++)
+        {
+            pX[i] = pX[N + i];
+        }
+    }
+}
+/** @} */ //end of LMS_FD group
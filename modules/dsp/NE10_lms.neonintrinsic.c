@@ -0,0 +1,500 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_lms.neonintrinsic.c
+ */
+
+#include <arm_neon.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_dsp.h"
+
+#define NE10_LMS_DELTA_F32      (1e-10f)
+#define NE10_LMS_DELTA_Q31      (0x100)
+#define NE10_LMS_ENERGY_RECOMPUTE (1e-3f)
+
+static inline ne10_int32_t ne10_lms_sat_q31 (ne10_int64_t x)
+{
+    if (x > 0x7fffffffLL)
+    {
+        return 0x7fffffff;
+    }
+    if (x < -0x80000000LL)
+    {
+        return (ne10_int32_t) 0x80000000;
+    }
+    return (ne10_int32_t) x;
+}
+
+/*
+ * Rounding errors of the recursive energy update are relative to the largest energy since it was
+ * last computed exactly. Once the energy falls far below that, after a loud passage, or below zero,
+ * it is recomputed from the window, so the step never divides by a drifted value.
+ */
+static inline ne10_float32_t ne10_lms_energy_float (ne10_float32_t energy,
+        ne10_float32_t * pPeak,
+        const ne10_float32_t * pWindow,
+        ne10_uint32_t numTaps)
+{
+    ne10_uint32_t k;
+
+    if (energy < NE10_LMS_ENERGY_RECOMPUTE * (*pPeak))
+    {
+        energy = 0.0f;
+        for (k = 0; k < numTaps; k++)
+        {
+            energy += pWindow[k] * pWindow[k];
+        }
+        *pPeak = energy;
+    }
+    else if (energy > *pPeak)
+    {
+        *pPeak = energy;
+    }
+    return energy;
+}
+
+/*
+ * mu * e / (E + delta) as a Q30 mantissa and the right shift that applies it to the
+ * coefficients, (w * x) >> shift. Keeping the exponent apart means that a step above 1.0,
+ * a loud error over a quiet window as at start-up, is not saturated.
+ */
+static inline ne10_int32_t ne10_lms_step_q31 (ne10_int32_t errorXmu,
+        ne10_int64_t energy,
+        ne10_uint32_t updShift,
+        ne10_uint32_t * pShift)
+{
+    ne10_int64_t d = energy + NE10_LMS_DELTA_Q31;
+    ne10_int32_t shift = (ne10_int32_t) updShift - 1;
+
+    /* Normalize the denominator to [2^30, 2^31) */
+    while (d >= (1LL << 31))
+    {
+        d >>= 1;
+        shift++;
+    }
+    while (d < (1LL << 30))
+    {
+        d <<= 1;
+        shift--;
+    }
+    /* The step is below the resolution of the coefficients */
+    if (shift > 62)
+    {
+        *pShift = 62u;
+        return 0;
+    }
+    *pShift = (ne10_uint32_t) shift;
+    return (ne10_int32_t) ( ( (ne10_int64_t) errorXmu * (1LL << 30)) / d);
+}
+
+/**
+ * @addtogroup LMS_Norm
+ * @{
+ */
+
+static inline ne10_float32_t ne10_lms_dot_neon (const ne10_float32_t * px,
+        const ne10_float32_t * pb,
+        ne10_uint32_t numTaps)
+{
+    float32x4_t q_acc = vdupq_n_f32 (0.0f);
+    float32x2_t d_acc;
+    ne10_float32_t acc;
+    ne10_uint32_t k;
+
+    for (k = 0; k + 4 <= numTaps; k += 4)
+    {
+        q_acc = vmlaq_f32 (q_acc, vld1q_f32 (px + k), vld1q_f32 (pb + k));
+    }
+    d_acc = vpadd_f32 (vget_low_f32 (q_acc), vget_high_f32 (q_acc));
+    d_acc = vpadd_f32 (d_acc, d_acc);
+    acc = vget_lane_f32 (d_acc, 0);
+    for (; k < numTaps; k++)
+    {
+        acc += px[k] * pb[k];
+    }
+    return acc;
+}
+
+/*
+ * Updates the coefficients along the window px and, in the same pass, returns their dot product with
+ * the window of the next sample (px + 1), so the coefficients are loaded and stored once per sample.
+ */
+static inline ne10_float32_t ne10_lms_update_dot_neon (const ne10_float32_t * px,
+        ne10_float32_t * pb,
+        ne10_float32_t w,
+        ne10_uint32_t numTaps)
+{
+    float32x4_t q_acc = vdupq_n_f32 (0.0f);
+    float32x4_t q_b;
+    float32x2_t d_acc;
+    ne10_float32_t acc;
+    ne10_uint32_t k;
+
+    for (k = 0; k + 4 <= numTaps; k += 4)
+    {
+        q_b = vmlaq_n_f32 (vld1q_f32 (pb + k), vld1q_f32 (px + k), w);
+        vst1q_f32 (pb + k, q_b);
+        q_acc = vmlaq_f32 (q_acc, q_b, vld1q_f32 (px + k + 1));
+    }
+    d_acc = vpadd_f32 (vget_low_f32 (q_acc), vget_high_f32 (q_acc));
+    d_acc = vpadd_f32 (d_acc, d_acc);
+    acc = vget_lane_f32 (d_acc, 0);
+    for (; k < numTaps; k++)
+    {
+        pb[k] += w * px[k];
+        acc += pb[k] * px[k + 1];
+    }
+    return acc;
+}
+
+/**
+ * Specific implementation of @ref ne10_lms_norm_float using NEON SIMD capabilities.
+ */
+void ne10_lms_norm_float_neon (ne10_lms_norm_instance_f32_t * S,
+                               ne10_float32_t * pSrc,
+                               ne10_float32_t * pRef,
+                               ne10_float32_t * pOut,
+                               ne10_float32_t * pErr,
+                               ne10_uint32_t blockSize)
+{
+    ne10_float32_t *pState = S->pState;
+    ne10_float32_t *pCoeffs = S->pCoeffs;
+    ne10_float32_t *pStateCurnt;
+    ne10_float32_t mu = S->mu;
+    ne10_float32_t energy = S->energy;
+    ne10_float32_t peak = S->energy;
+    ne10_float32_t x0 = S->x0;
+    ne10_float32_t in, acc, e, w;
+    ne10_uint32_t numTaps = S->numTaps;
+    ne10_uint32_t tapCnt, blkCnt;
+
+    if (blockSize == 0)
+    {
+        return;
+    }
+
+    pStateCurnt = &(S->pState[numTaps - 1u]);
+
+    in = *pSrc++;
+    *pStateCurnt++ = in;
+    energy += in * in - x0 * x0;
+    energy = ne10_lms_energy_float (energy, &peak, pState, numTaps);
+    acc = ne10_lms_dot_neon (pState, pCoeffs, numTaps);
+
+    blkCnt = blockSize;
+    while (blkCnt > 0u)
+    {
+        *pOut++ = acc;
+        e = *pRef++ - acc;
+        *pErr++ = e;
+        w = e * mu / (energy + NE10_LMS_DELTA_F32);
+
+        x0 = *pState;
+        if (blkCnt > 1u)
+        {
+            /* The next sample is needed for the fused update */
+            in = *pSrc++;
+            *pStateCurnt++ = in;
+            energy += in * in - x0 * x0;
+            energy = ne10_lms_energy_float (energy, &peak, pState + 1, numTaps);
+            acc = ne10_lms_update_dot_neon (pState, pCoeffs, w, numTaps);
+        }
+        else
+        {
+            float32x4_t q_w = vdupq_n_f32 (w);
+            ne10_uint32_t k;
+            for (k = 0; k + 4 <= numTaps; k += 4)
+            {
+                vst1q_f32 (pCoeffs + k, vmlaq_f32 (vld1q_f32 (pCoeffs + k), vld1q_f32 (pState + k), q_w));
+            }
+            for (; k < numTaps; k++)
+            {
+                pCoeffs[k] += w * pState[k];
+            }
+        }
+
+        pState++;
+        blkCnt--;
+    }
+
+    S->energy = energy;
+    S->x0 = x0;
+
+    pStateCurnt = S->pState;
+    tapCnt = numTaps - 1u;
+    while (tapCnt > 0u)
+    {
+        *pStateCurnt++ = *pState++;
+        tapCnt--;
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_lms_norm_int32 using NEON SIMD capabilities.
+ */
+void ne10_lms_norm_int32_neon (ne10_lms_norm_instance_int32_t * S,
+                               ne10_int32_t * pSrc,
+                               ne10_int32_t * pRef,
+                               ne10_int32_t * pOut,
+                               ne10_int32_t * pErr,
+                               ne10_uint32_t blockSize)
+{
+    ne10_int32_t *pState = S->pState;
+    ne10_int32_t *pCoeffs = S->pCoeffs;
+    ne10_int32_t *pStateCurnt;
+    ne10_int32_t mu = S->mu;
+    ne10_int64_t energy = S->energy;
+    ne10_int32_t x0 = S->x0;
+    ne10_int32_t in, y, e, errorXmu, w;
+    ne10_int64_t acc;
+    ne10_uint32_t outShift = 31u - S->postShift;
+    ne10_uint32_t numTaps = S->numTaps;
+    ne10_uint32_t updShift = 31u + S->postShift;
+    ne10_uint32_t tapCnt, blkCnt, k, wShift;
+    int64x2_t q_acc;
+    int64x2_t q_shift;
+    int32x4_t q_x, q_b;
+    int32x2_t d_w;
+
+    pStateCurnt = &(S->pState[numTaps - 1u]);
+
+    blkCnt = blockSize;
+    while (blkCnt > 0u)
+    {
+        in = *pSrc++;
+        *pStateCurnt++ = in;
+        energy += ( ( (ne10_int64_t) in * in) >> 31) - ( ( (ne10_int64_t) x0 * x0) >> 31);
+
+        /* 64-bit accumulation of the output, two lanes per half register */
+        q_acc = vdupq_n_s64 (0);
+        for (k = 0; k + 4 <= numTaps; k += 4)
+        {
+            q_x = vld1q_s32 (pState + k);
+            q_b = vld1q_s32 (pCoeffs + k);
+            q_acc = vmlal_s32 (q_acc, vget_low_s32 (q_x), vget_low_s32 (q_b));
+            q_acc = vmlal_s32 (q_acc, vget_high_s32 (q_x), vget_high_s32 (q_b));
+        }
+        acc = vgetq_lane_s64 (q_acc, 0) + vgetq_lane_s64 (q_acc, 1);
+        for (; k < numTaps; k++)
+        {
+            acc += (ne10_int64_t) pState[k] * pCoeffs[k];
+        }
+        y = ne10_lms_sat_q31 (acc >> outShift);
+        *pOut++ = y;
+
+        e = ne10_lms_sat_q31 ( (ne10_int64_t) (*pRef++) - y);
+        *pErr++ = e;
+
+        errorXmu = (ne10_int32_t) ( ( (ne10_int64_t) e * mu) >> 31);
+        w = ne10_lms_step_q31 (errorXmu, energy, updShift, &wShift);
+
+        /* b += (w * x) >> wShift, with saturation */
+        d_w = vdup_n_s32 (w);
+        q_shift = vdupq_n_s64 (- (ne10_int64_t) wShift);
+        for (k = 0; k + 4 <= numTaps; k += 4)
+        {
+            q_x = vld1q_s32 (pState + k);
+            q_b = vld1q_s32 (pCoeffs + k);
+            q_x = vcombine_s32 (vqmovn_s64 (vshlq_s64 (vmull_s32 (vget_low_s32 (q_x), d_w), q_shift)),
+                                vqmovn_s64 (vshlq_s64 (vmull_s32 (vget_high_s32 (q_x), d_w), q_shift)));
+            vst1q_s32 (pCoeffs + k, vqaddq_s32 (q_b, q_x));
+        }
+        for (; k < numTaps; k++)
+        {
+            pCoeffs[k] = ne10_lms_sat_q31 ( (ne10_int64_t) pCoeffs[k] + ne10_lms_sat_q31 ( ( (ne10_int64_t) w * pState[k]) >> wShift));
+        }
+
+        x0 = *pState;
+        pState++;
+        blkCnt--;
+    }
+
+    S->energy = energy;
+    S->x0 = x0;
+
+    pStateCurnt = S->pState;
+    tapCnt = numTaps - 1u;
+    while (tapCnt > 0u)
+    {
+        *pStateCurnt++ = *pState++;
+        tapCnt--;
+    }
+}
+/** @} */ //end of LMS_Norm group
+
+/**
+ * @addtogroup LMS_FD
+ * @{
+ */
+
+/**
+ * Specific implementation of @ref ne10_lms_fd_float using NEON SIMD capabilities.
+ */
+void ne10_lms_fd_float_neon (ne10_lms_fd_instance_f32_t * S,
+                             ne10_float32_t * pSrc,
+                             ne10_float32_t * pRef,
+                             ne10_float32_t * pOut,
+                             ne10_float32_t * pErr,
+                             ne10_uint32_t blockSize)
+{
+    ne10_uint32_t N = S->numTaps;
+    ne10_uint32_t numBins = N + 1u;
+    ne10_float32_t *pX = S->pState;
+    ne10_float32_t *pT = pX + 2 * N;
+    ne10_fft_cpx_float32_t *pXf = (ne10_fft_cpx_float32_t *) (pT + 2 * N);
+    ne10_fft_cpx_float32_t *pGf = pXf + numBins;
+    ne10_float32_t *pP = (ne10_float32_t *) (pGf + numBins);
+    ne10_fft_cpx_float32_t *pW = S->pCoeffs;
+    ne10_float32_t beta = S->powerValid ? S->beta : 0.0f;
+    ne10_float32_t mu = S->mu;
+    ne10_float32_t xr, xi, er, ei, scale;
+    ne10_uint32_t i, blk;
+    ne10_uint32_t N4 = N & ~0x3u;                       /* bins and samples handled four at a time */
+    float32x4x2_t q2_x, q2_g, q2_w;
+    float32x4_t q_p, q_r, q_zero = vdupq_n_f32 (0.0f);
+
+    for (blk = 0; blk < blockSize; blk += N)
+    {
+        for (i = 0; i < N4; i += 4)
+        {
+            vst1q_f32 (pX + N + i, vld1q_f32 (pSrc + blk + i));
+        }
+        for (; i < N; i++)
+        {
+            pX[N + i] = pSrc[blk + i];
+        }
+
+        for (i = 0; i < 2 * N; i += 2)
+        {
+            vst1_f32 (pT + i, vld1_f32 (pX + i));
+        }
+        ne10_fft_r2c_1d_float32_neon (pXf, pT, S->cfg);
+        for (i = 0; i < N4; i += 4)
+        {
+            q2_x = vld2q_f32 ( (ne10_float32_t *) (pXf + i));
+            q2_w = vld2q_f32 ( (ne10_float32_t *) (pW + i));
+            q2_g.val[0] = vmlsq_f32 (vmulq_f32 (q2_x.val[0], q2_w.val[0]), q2_x.val[1], q2_w.val[1]);
+            q2_g.val[1] = vmlaq_f32 (vmulq_f32 (q2_x.val[0], q2_w.val[1]), q2_x.val[1], q2_w.val[0]);
+            vst2q_f32 ( (ne10_float32_t *) (pGf + i), q2_g);
+        }
+        for (; i < numBins; i++)
+        {
+            pGf[i].r = pXf[i].r * pW[i].r - pXf[i].i * pW[i].i;
+            pGf[i].i = pXf[i].r * pW[i].i + pXf[i].i * pW[i].r;
+        }
+        ne10_fft_c2r_1d_float32_neon (pT, pGf, S->cfg);
+        for (i = 0; i < N4; i += 4)
+        {
+            q_r = vld1q_f32 (pT + N + i);
+            vst1q_f32 (pOut + blk + i, q_r);
+            q_r = vsubq_f32 (vld1q_f32 (pRef + blk + i), q_r);
+            vst1q_f32 (pErr + blk + i, q_r);
+            vst1q_f32 (pT + i, q_zero);
+            vst1q_f32 (pT + N + i, q_r);
+        }
+        for (; i < N; i++)
+        {
+            pOut[blk + i] = pT[N + i];
+            pErr[blk + i] = pRef[blk + i] - pT[N + i];
+            pT[i] = 0.0f;
+            pT[N + i] = pErr[blk + i];
+        }
+        ne10_fft_r2c_1d_float32_neon (pGf, pT, S->cfg);
+
+        for (i = 0; i < N4; i += 4)
+        {
+            q2_x = vld2q_f32 ( (ne10_float32_t *) (pXf + i));
+            q2_g = vld2q_f32 ( (ne10_float32_t *) (pGf + i));
+            q_p = vmulq_f32 (q2_x.val[0], q2_x.val[0]);
+            q_p = vmlaq_f32 (q_p, q2_x.val[1], q2_x.val[1]);
+            q_p = vmlaq_n_f32 (vmulq_n_f32 (q_p, 1.0f - beta), vld1q_f32 (pP + i), beta);
+            vst1q_f32 (pP + i, q_p);
+
+            /* 1 / (P + delta) with two Newton-Raphson steps */
+            q_p = vaddq_f32 (q_p, vdupq_n_f32 (NE10_LMS_DELTA_F32));
+            q_r = vrecpeq_f32 (q_p);
+            q_r = vmulq_f32 (vrecpsq_f32 (q_p, q_r), q_r);
+            q_r = vmulq_f32 (vrecpsq_f32 (q_p, q_r), q_r);
+
+            q2_w.val[0] = vmlaq_f32 (vmulq_f32 (q2_x.val[0], q2_g.val[0]), q2_x.val[1], q2_g.val[1]);
+            q2_w.val[1] = vmlsq_f32 (vmulq_f32 (q2_x.val[0], q2_g.val[1]), q2_x.val[1], q2_g.val[0]);
+            q2_w.val[0] = vmulq_f32 (q2_w.val[0], q_r);
+            q2_w.val[1] = vmulq_f32 (q2_w.val[1], q_r);
+            vst2q_f32 ( (ne10_float32_t *) (pGf + i), q2_w);
+        }
+        for (; i < numBins; i++)
+        {
+            xr = pXf[i].r;
+            xi = pXf[i].i;
+            er = pGf[i].r;
+            ei = pGf[i].i;
+            pP[i] = beta * pP[i] + (1.0f - beta) * (xr * xr + xi * xi);
+            scale = 1.0f / (pP[i] + NE10_LMS_DELTA_F32);
+            pGf[i].r = (xr * er + xi * ei) * scale;
+            pGf[i].i = (xr * ei - xi * er) * scale;
+        }
+        S->powerValid = 1;
+        beta = S->beta;
+
+        ne10_fft_c2r_1d_float32_neon (pT, pGf, S->cfg);
+        for (i = 0; i < N4; i += 4)
+        {
+            vst1q_f32 (pT + N + i, q_zero);
+        }
+        for (; i < N; i++)
+        {
+            pT[N + i] = 0.0f;
+        }
+        ne10_fft_r2c_1d_float32_neon (pGf, pT, S->cfg);
+        for (i = 0; i < N4; i += 4)
+        {
+            q2_w = vld2q_f32 ( (ne10_float32_t *) (pW + i));
+            q2_g = vld2q_f32 ( (ne10_float32_t *) (pGf + i));
+            q2_w.val[0] = vmlaq_n_f32 (q2_w.val[0], q2_g.val[0], mu);
+            q2_w.val[1] = vmlaq_n_f32 (q2_w.val[1], q2_g.val[1], mu);
+            vst2q_f32 ( (ne10_float32_t *) (pW + i), q2_w);
+        }
+        for (; i < numBins; i++)
+        {
+            pW[i].r += mu * pGf[i].r;
+            pW[i].i += mu * pGf[i].i;
+        }
+
+        for (i = 0; i < N4; i += 4)
+        {
+            vst1q_f32 (pX + i, vld1q_f32 (pX + N + i));
+        }
+        for (; i < N; i++)
+        {
+            pX[i] = pX[N + i];
+        }
+    }
+}
+/** @} */ //end of LMS_FD group
@@ -0,0 +1,155 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_lms_init.c
+ */
+
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_dsp.h"
+
+/**
+ * @ingroup LMS_Norm
+ * @brief Initialization function for the floating-point normalized LMS filter.
+ *
+ * @param[in,out] *S         points to an instance of the floating-point normalized LMS structure.
+ * @param[in]     numTaps    number of filter coefficients.
+ * @param[in]     *pCoeffs   points to the coefficient buffer, in time reversed order, holding the initial coefficients.
+ * @param[in]     *pState    points to the state buffer of length <code>numTaps+blockSize-1</code>.
+ * @param[in]     mu         step size, in <code>(0, 2)</code>.
+ * @param[in]     blockSize  number of samples processed per call.
+ * @return        NE10_OK, or NE10_ERR if <code>numTaps</code> is zero.
+ */
+ne10_result_t ne10_lms_norm_init_float (ne10_lms_norm_instance_f32_t * S,
+                                        ne10_uint16_t numTaps,
+                                        ne10_float32_t * pCoeffs,
+                                        ne10_float32_t * pState,
+                                        ne10_float32_t mu,
+                                        ne10_uint32_t blockSize)
+{
+    if (numTaps == 0)
+    {
+        return NE10_ERR;
+    }
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->mu = mu;
+    S->energy = 0.0f;
+    S->x0 = 0.0f;
+
+    /* Clear state buffer and size is always blockSize + numTaps - 1 */
+    memset (pState, 0, (numTaps + (blockSize - 1u)) * sizeof (ne10_float32_t));
+    S->pState = pState;
+
+    return NE10_OK;
+}
+
+/**
+ * @ingroup LMS_Norm
+ * @brief Initialization function for the Q31 normalized LMS filter.
+ *
+ * @param[in,out] *S         points to an instance of the Q31 normalized LMS structure.
+ * @param[in]     numTaps    number of filter coefficients.
+ * @param[in]     *pCoeffs   points to the coefficient buffer, in time reversed order and scaled by <code>2^-postShift</code>.
+ * @param[in]     *pState    points to the state buffer of length <code>numTaps+blockSize-1</code>.
+ * @param[in]     mu         step size in Q31.
+ * @param[in]     blockSize  number of samples processed per call.
+ * @param[in]     postShift  scaling of the coefficients, at most 30.
+ * @return        NE10_OK, or NE10_ERR if <code>numTaps</code> is zero or <code>postShift</code> is too large.
+ */
+ne10_result_t ne10_lms_norm_init_int32 (ne10_lms_norm_instance_int32_t * S,
+                                        ne10_uint16_t numTaps,
+                                        ne10_int32_t * pCoeffs,
+                                        ne10_int32_t * pState,
+                                        ne10_int32_t mu,
+                                        ne10_uint32_t blockSize,
+                                        ne10_uint8_t postShift)
+{
+    if ( (numTaps == 0) || (postShift > 30))
+    {
+        return NE10_ERR;
+    }
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->mu = mu;
+    S->postShift = postShift;
+    S->energy = 0;
+    S->x0 = 0;
+
+    memset (pState, 0, (numTaps + (blockSize - 1u)) * sizeof (ne10_int32_t));
+    S->pState = pState;
+
+    return NE10_OK;
+}
+
+/**
+ * @ingroup LMS_FD
+ * @brief Initialization function for the floating-point frequency domain block LMS filter.
+ *
+ * @param[in,out] *S         points to an instance of the frequency domain block LMS structure.
+ * @param[in]     numTaps    number of filter coefficients and block length, a power of 2.
+ * @param[in]     cfg        r2c FFT configuration of length <code>2*numTaps</code>, from @ref ne10_fft_alloc_r2c_float32.
+ * @param[in]     *pCoeffs   points to <code>numTaps+1</code> frequency domain coefficients, which are cleared.
+ * @param[in]     *pState    points to the state buffer of length <code>NE10_LMS_FD_STATE_LEN(numTaps)</code>.
+ * @param[in]     mu         step size, in <code>(0, 1]</code>.
+ * @param[in]     beta       forgetting factor of the bin power estimate, in <code>[0, 1)</code>, typically 0.9.
+ * @return        NE10_OK, or NE10_ERR if <code>numTaps</code> is not a power of 2 or <code>cfg</code> is NULL.
+ *
+ * The caller keeps the ownership of <code>cfg</code> and releases it with @ref ne10_fft_destroy_r2c_float32
+ * once the filter is no longer used. A configuration can be shared by filters of the same length.
+ */
+ne10_result_t ne10_lms_fd_init_float (ne10_lms_fd_instance_f32_t * S,
+                                      ne10_uint16_t numTaps,
+                                      ne10_fft_r2c_cfg_float32_t cfg,
+                                      ne10_fft_cpx_float32_t * pCoeffs,
+                                      ne10_float32_t * pState,
+                                      ne10_float32_t mu,
+                                      ne10_float32_t beta)
+{
+    if ( (numTaps == 0) || ( (numTaps & (numTaps - 1u)) != 0) || (cfg == NULL))
+    {
+        return NE10_ERR;
+    }
+
+    S->numTaps = numTaps;
+    S->powerValid = 0;
+    S->mu = mu;
+    S->beta = beta;
+    S->cfg = cfg;
+
+    memset (pCoeffs, 0, (numTaps + 1u) * sizeof (ne10_fft_cpx_float32_t));
+    S->pCoeffs = pCoeffs;
+
+    memset (pState, 0, NE10_LMS_FD_STATE_LEN (numTaps) * sizeof (ne10_float32_t));
+    S->pState = pState;
+
+    return NE10_OK;
+}
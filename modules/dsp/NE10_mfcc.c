@@ -0,0 +1,279 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_mfcc.c
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_fft.h"
+#include "NE10_dsp.h"
+
+/**
+ * @ingroup groupDSPs
+ */
+
+/**
+ * @defgroup MFCC Mel Filterbank and MFCC
+ *
+ * \par
+ * These functions turn the <code>fftLen/2+1</code> bins of a real FFT into log mel energies and mel frequency
+ * cepstral coefficients (MFCC). Each frame goes through four stages:
+ * <pre>
+ *    P[k]    = |X[k]|^2                                  power spectrum
+ *    E[m]    = sum_k W_m[k] * P[k]                       triangular mel filterbank
+ *    L[m]    = ln (max (E[m], NE10_MFCC_LOG_FLOOR))      log mel energy
+ *    C[j]    = s_j * sum_m L[m] * cos (pi*j*(2m+1)/(2M)) orthonormal DCT-II
+ * </pre>
+ * with <code>s_0 = sqrt(1/M)</code> and <code>s_j = sqrt(2/M)</code> otherwise.
+ * \par
+ * The <code>numMels</code> triangles have their corners equally spaced on the HTK mel scale,
+ * <code>mel(f) = 2595*log10(1+f/700)</code>, between <code>fMin</code> and <code>fMax</code>, and a peak of 1.
+ * Each triangle only covers a few bins, so the filterbank is stored as the first bin and the number of bins of
+ * every band, followed by the nonzero weights of all bands packed one after the other. The DCT-II only needs
+ * the first <code>numCeps</code> outputs, so it is a table of <code>numCeps x numMels</code> coefficients
+ * rather than a transform of all <code>numMels</code> points.
+ * \par
+ * @ref ne10_mfcc_float32 takes the output of @ref ne10_fft_r2c_1d_float32. @ref ne10_mfcc_int16 takes the
+ * output of @ref ne10_fft_r2c_1d_int16 and undoes its Q15 and optional 1/fftLen scaling, so the features of
+ * a Q15 signal match those of the same signal in floating point. The configuration is allocated with
+ * @ref ne10_mfcc_alloc_float32 and freed with @ref ne10_mfcc_destroy_float32.
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+static ne10_float64_t ne10_mfcc_hz_to_mel (ne10_float64_t f)
+{
+    return 2595.0 * log10 (1.0 + f / 700.0);
+}
+
+static ne10_float64_t ne10_mfcc_mel_to_hz (ne10_float64_t m)
+{
+    return 700.0 * (pow (10.0, m / 2595.0) - 1.0);
+}
+
+/**
+ * @brief Allocates a mel filterbank and MFCC configuration.
+ * @param[in]   fftLen         length of the real FFT whose output is processed, even and at least 4.
+ * @param[in]   sampleRate     sample rate of the signal in Hz.
+ * @param[in]   numMels        number of mel bands.
+ * @param[in]   numCeps        number of cepstral coefficients, from 1 to numMels.
+ * @param[in]   fMin           lower edge of the first band in Hz.
+ * @param[in]   fMax           upper edge of the last band in Hz, above fMin and at most sampleRate/2.
+ * @return      the configuration, or NULL if a parameter is invalid or the memory allocation fails.
+ */
+ne10_mfcc_cfg_float32_t ne10_mfcc_alloc_float32 (ne10_uint32_t fftLen,
+        ne10_float32_t sampleRate,
+        ne10_uint32_t numMels,
+        ne10_uint32_t numCeps,
+        ne10_float32_t fMin,
+        ne10_float32_t fMax)
+{
+    ne10_mfcc_cfg_float32_t st;
+    ne10_uint32_t numBins = fftLen / 2 + 1;
+    ne10_float64_t melMin, melMax, left, center, right, freq, w;
+    ne10_uint32_t memneeded, numWeights, m, j, k;
+    uintptr_t address;
+
+    if ( (fftLen < 4) || (fftLen & 1) || (fftLen > 65534) || (numMels == 0) || (numCeps == 0)
+            || (numCeps > numMels) || (fMin < 0.0f) || (fMax <= fMin) || (2.0f * fMax > sampleRate))
+    {
+        return NULL;
+    }
+
+    /* Adjacent triangles overlap by at most one triangle, so every bin has at most two weights */
+    memneeded = sizeof (ne10_mfcc_state_float32_t)
+                + sizeof (ne10_float32_t) * (2 * numBins + numCeps * numMels + numBins + numMels) /* weights, dct, power, log mel */
+                + sizeof (ne10_uint16_t) * 2 * numMels                                           /* band start, band length */
+                + NE10_FFT_BYTE_ALIGNMENT;
+    st = (ne10_mfcc_cfg_float32_t) NE10_MALLOC (memneeded);
+    if (st == NULL)
+    {
+        return NULL;
+    }
+
+    address = (uintptr_t) (st + 1);
+    NE10_BYTE_ALIGNMENT (address, NE10_FFT_BYTE_ALIGNMENT);
+    st->pWeights = (ne10_float32_t *) address;
+    st->pDct = st->pWeights + 2 * numBins;
+    st->pPower = st->pDct + numCeps * numMels;
+    st->pLogMel = st->pPower + numBins;
+    st->pBandStart = (ne10_uint16_t *) (st->pLogMel + numMels);
+    st->pBandLen = st->pBandStart + numMels;
+
+    st->fftLen = fftLen;
+    st->numMels = numMels;
+    st->numCeps = numCeps;
+
+    melMin = ne10_mfcc_hz_to_mel (fMin);
+    melMax = ne10_mfcc_hz_to_mel (fMax);
+    numWeights = 0;
+    for (m = 0; m < numMels; m++)
+    {
+        left = ne10_mfcc_mel_to_hz (melMin + (melMax - melMin) * m / (numMels + 1));
+        center = ne10_mfcc_mel_to_hz (melMin + (melMax - melMin) * (m + 1) / (numMels + 1));
+        right = ne10_mfcc_mel_to_hz (melMin + (melMax - melMin) * (m + 2) / (numMels + 1));
+
+        st->pBandStart[m] = 0;
+        st->pBandLen[m] = 0;
+        for (k = 0; k < numBins; k++)
+        {
+            freq = (ne10_float64_t) k * sampleRate / fftLen;
+            if ( (freq <= left) || (freq >= right))
+            {
+                w = 0.0;
+            }
+            else
+            {
+                w = (freq <= center) ? (freq - left) / (center - left) : (right - freq) / (right - center);
+            }
+            if (w > 0.0)
+            {
+                if (st->pBandLen[m] == 0)
+                {
+                    st->pBandStart[m] = (ne10_uint16_t) k;
+                }
+                st->pWeights[numWeights++] = (ne10_float32_t) w;
+                st->pBandLen[m]++;
+            }
+        }
+    }
+
+    for (j = 0; j < numCeps; j++)
+    {
+        w = (j == 0) ? sqrt (1.0 / numMels) : sqrt (2.0 / numMels);
+        for (m = 0; m < numMels; m++)
+        {
+            st->pDct[j * numMels + m] = (ne10_float32_t) (w * cos (NE10_PI * j * (2 * m + 1) / (2.0 * numMels)));
+        }
+    }
+    return st;
+}
+
+/**
+ * @brief Frees a configuration allocated by @ref ne10_mfcc_alloc_float32.
+ */
+void ne10_mfcc_destroy_float32 (ne10_mfcc_cfg_float32_t cfg)
+{
+    NE10_FREE (cfg);
+}
+
+/* Filterbank, log and DCT-II of the power spectrum in cfg->pPower */
+static void ne10_mfcc_power_to_ceps_c (ne10_mfcc_cfg_float32_t cfg,
+                                       ne10_float32_t * pCeps,
+                                       ne10_float32_t * pLogMel)
+{
+    const ne10_float32_t *pWeights = cfg->pWeights;
+    const ne10_float32_t *pDct = cfg->pDct;
+    ne10_float32_t *pLog = (pLogMel != NULL) ? pLogMel : cfg->pLogMel;
+    ne10_float32_t *pPower;
+    ne10_float32_t acc;
+    ne10_uint32_t m, j, k;
+
+    for (m = 0; m < cfg->numMels; m++)
+    {
+        pPower = cfg->pPower + cfg->pBandStart[m];
+        acc = 0.0f;
+        for (k = 0; k < cfg->pBandLen[m]; k++)
+        {
+            acc += pWeights[k] * pPower[k];
+        }
+        pWeights += cfg->pBandLen[m];
+        pLog[m] = logf ( (acc > NE10_MFCC_LOG_FLOOR) ? acc : NE10_MFCC_LOG_FLOOR);
+    }
+
+    if (pCeps == NULL)
+    {
+        return;
+    }
+    for (j = 0; j < cfg->numCeps; j++)
+    {
+        acc = 0.0f;
+        for (m = 0; m < cfg->numMels; m++)
+        {
+            acc += pDct[m] * pLog[m];
+        }
+        pDct += cfg->numMels;
+        pCeps[j] = acc;
+    }
+}
+
+/**
+ * @brief Log mel energies and MFCC of a floating-point spectrum.
+ * @param[in]   cfg        configuration from @ref ne10_mfcc_alloc_float32.
+ * @param[out]  *pCeps     points to the numCeps cepstral coefficients, or NULL to skip the DCT.
+ * @param[out]  *pLogMel   points to the numMels log mel energies, or NULL if they are not needed.
+ * @param[in]   *pSrc      points to the <code>fftLen/2+1</code> bins from @ref ne10_fft_r2c_1d_float32.
+ */
+void ne10_mfcc_float32_c (ne10_mfcc_cfg_float32_t cfg,
+                          ne10_float32_t * pCeps,
+                          ne10_float32_t * pLogMel,
+                          const ne10_fft_cpx_float32_t * pSrc)
+{
+    ne10_uint32_t numBins = cfg->fftLen / 2 + 1;
+    ne10_uint32_t k;
+
+    for (k = 0; k < numBins; k++)
+    {
+        cfg->pPower[k] = pSrc[k].r * pSrc[k].r + pSrc[k].i * pSrc[k].i;
+    }
+    ne10_mfcc_power_to_ceps_c (cfg, pCeps, pLogMel);
+}
+
+/**
+ * @brief Log mel energies and MFCC of a Q15 spectrum.
+ * @param[in]   cfg          configuration from @ref ne10_mfcc_alloc_float32.
+ * @param[out]  *pCeps       points to the numCeps cepstral coefficients, or NULL to skip the DCT.
+ * @param[out]  *pLogMel     points to the numMels log mel energies, or NULL if they are not needed.
+ * @param[in]   *pSrc        points to the <code>fftLen/2+1</code> bins from @ref ne10_fft_r2c_1d_int16.
+ * @param[in]   scaled_flag  the scaled_flag the spectrum was computed with (0: unscaled, 1: scaled by 1/fftLen).
+ */
+void ne10_mfcc_int16_c (ne10_mfcc_cfg_float32_t cfg,
+                        ne10_float32_t * pCeps,
+                        ne10_float32_t * pLogMel,
+                        const ne10_fft_cpx_int16_t * pSrc,
+                        ne10_int32_t scaled_flag)
+{
+    ne10_uint32_t numBins = cfg->fftLen / 2 + 1;
+    ne10_float32_t scale = (scaled_flag ? (ne10_float32_t) cfg->fftLen : 1.0f) / 32768.0f;
+    ne10_uint32_t k;
+
+    scale *= scale;
+    for (k = 0; k < numBins; k++)
+    {
+        cfg->pPower[k] = ( (ne10_float32_t) (pSrc[k].r * pSrc[k].r) + (ne10_float32_t) (pSrc[k].i * pSrc[k].i)) * scale;
+    }
+    ne10_mfcc_power_to_ceps_c (cfg, pCeps, pLogMel);
+}
+/** @} */ //end of MFCC group
@@ -0,0 +1,195 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_mfcc.neonintrinsic.c
+ */
+
+#include <arm_neon.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_dsp.h"
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/*
+ * Natural logarithm of 4 positive normal values: x = 2^e * m with m in [sqrt(0.5), sqrt(2)),
+ * ln(m) = f - f^2/2 + f^3 * P(f) with f = m - 1 (the Cephes logf polynomial), about 1 ulp over the range.
+ */
+static inline float32x4_t ne10_mfcc_log_neon (float32x4_t x)
+{
+    int32x4_t bits = vreinterpretq_s32_f32 (x);
+    int32x4_t e = vsubq_s32 (vshrq_n_s32 (bits, 23), vdupq_n_s32 (127));
+    float32x4_t m = vreinterpretq_f32_s32 (vorrq_s32 (vandq_s32 (bits, vdupq_n_s32 (0x007fffff)), vdupq_n_s32 (0x3f800000)));
+    uint32x4_t big = vcgtq_f32 (m, vdupq_n_f32 (1.41421356f));
+    float32x4_t f, z, y;
+
+    m = vbslq_f32 (big, vmulq_n_f32 (m, 0.5f), m);
+    e = vsubq_s32 (e, vreinterpretq_s32_u32 (big));
+    f = vsubq_f32 (m, vdupq_n_f32 (1.0f));
+    z = vmulq_f32 (f, f);
+
+    y = vmlaq_f32 (vdupq_n_f32 (-1.1514610310e-1f), vdupq_n_f32 (7.0376836292e-2f), f);
+    y = vmlaq_f32 (vdupq_n_f32 (1.1676998740e-1f), y, f);
+    y = vmlaq_f32 (vdupq_n_f32 (-1.2420140846e-1f), y, f);
+    y = vmlaq_f32 (vdupq_n_f32 (1.4249322787e-1f), y, f);
+    y = vmlaq_f32 (vdupq_n_f32 (-1.6668057665e-1f), y, f);
+    y = vmlaq_f32 (vdupq_n_f32 (2.0000714765e-1f), y, f);
+    y = vmlaq_f32 (vdupq_n_f32 (-2.4999993993e-1f), y, f);
+    y = vmlaq_f32 (vdupq_n_f32 (3.3333331174e-1f), y, f);
+    y = vmulq_f32 (vmulq_f32 (y, f), z);
+    y = vmlsq_f32 (y, z, vdupq_n_f32 (0.5f));
+
+    return vmlaq_f32 (vaddq_f32 (f, y), vcvtq_f32_s32 (e), vdupq_n_f32 (0.693147181f));
+}
+
+static inline ne10_float32_t ne10_mfcc_dot_neon (const ne10_float32_t * pA,
+        const ne10_float32_t * pB,
+        ne10_uint32_t len)
+{
+    float32x4_t acc = vdupq_n_f32 (0.0f);
+    float32x2_t sum;
+    ne10_float32_t result;
+    ne10_uint32_t k;
+
+    for (k = 0; k + 4 <= len; k += 4)
+    {
+        acc = vmlaq_f32 (acc, vld1q_f32 (pA + k), vld1q_f32 (pB + k));
+    }
+    sum = vpadd_f32 (vget_low_f32 (acc), vget_high_f32 (acc));
+    result = vget_lane_f32 (vpadd_f32 (sum, sum), 0);
+    for (; k < len; k++)
+    {
+        result += pA[k] * pB[k];
+    }
+    return result;
+}
+
+/* Filterbank, log and DCT-II of the power spectrum in cfg->pPower */
+static void ne10_mfcc_power_to_ceps_neon (ne10_mfcc_cfg_float32_t cfg,
+        ne10_float32_t * pCeps,
+        ne10_float32_t * pLogMel)
+{
+    const ne10_float32_t *pWeights = cfg->pWeights;
+    ne10_float32_t *pLog = (pLogMel != NULL) ? pLogMel : cfg->pLogMel;
+    ne10_uint32_t numMels = cfg->numMels;
+    const float32x4_t floor = vdupq_n_f32 (NE10_MFCC_LOG_FLOOR);
+    ne10_float32_t tail[4];
+    ne10_uint32_t m, j;
+
+    for (m = 0; m < numMels; m++)
+    {
+        pLog[m] = ne10_mfcc_dot_neon (pWeights, cfg->pPower + cfg->pBandStart[m], cfg->pBandLen[m]);
+        pWeights += cfg->pBandLen[m];
+    }
+
+    for (m = 0; m + 4 <= numMels; m += 4)
+    {
+        vst1q_f32 (pLog + m, ne10_mfcc_log_neon (vmaxq_f32 (vld1q_f32 (pLog + m), floor)));
+    }
+    if (m < numMels)
+    {
+        for (j = 0; j < 4; j++)
+        {
+            tail[j] = (m + j < numMels) ? pLog[m + j] : 1.0f;
+        }
+        vst1q_f32 (tail, ne10_mfcc_log_neon (vmaxq_f32 (vld1q_f32 (tail), floor)));
+        for (j = 0; m + j < numMels; j++)
+        {
+            pLog[m + j] = tail[j];
+        }
+    }
+
+    if (pCeps == NULL)
+    {
+        return;
+    }
+    for (j = 0; j < cfg->numCeps; j++)
+    {
+        pCeps[j] = ne10_mfcc_dot_neon (cfg->pDct + j * numMels, pLog, numMels);
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_mfcc_float32 using NEON SIMD capabilities.
+ */
+void ne10_mfcc_float32_neon (ne10_mfcc_cfg_float32_t cfg,
+                             ne10_float32_t * pCeps,
+                             ne10_float32_t * pLogMel,
+                             const ne10_fft_cpx_float32_t * pSrc)
+{
+    ne10_uint32_t numBins = cfg->fftLen / 2 + 1;
+    float32x4x2_t q_in;
+    ne10_uint32_t k;
+
+    for (k = 0; k + 4 <= numBins; k += 4)
+    {
+        q_in = vld2q_f32 ( (const ne10_float32_t *) (pSrc + k));
+        vst1q_f32 (cfg->pPower + k, vmlaq_f32 (vmulq_f32 (q_in.val[0], q_in.val[0]), q_in.val[1], q_in.val[1]));
+    }
+    for (; k < numBins; k++)
+    {
+        cfg->pPower[k] = pSrc[k].r * pSrc[k].r + pSrc[k].i * pSrc[k].i;
+    }
+    ne10_mfcc_power_to_ceps_neon (cfg, pCeps, pLogMel);
+}
+
+/**
+ * Specific implementation of @ref ne10_mfcc_int16 using NEON SIMD capabilities.
+ */
+void ne10_mfcc_int16_neon (ne10_mfcc_cfg_float32_t cfg,
+                           ne10_float32_t * pCeps,
+                           ne10_float32_t * pLogMel,
+                           const ne10_fft_cpx_int16_t * pSrc,
+                           ne10_int32_t scaled_flag)
+{
+    ne10_uint32_t numBins = cfg->fftLen / 2 + 1;
+    ne10_float32_t scale = (scaled_flag ? (ne10_float32_t) cfg->fftLen : 1.0f) / 32768.0f;
+    float32x4_t q_re2, q_im2;
+    int16x4x2_t d_in;
+    ne10_uint32_t k;
+
+    scale *= scale;
+    for (k = 0; k + 4 <= numBins; k += 4)
+    {
+        /* Each square fits in 32 bits, their sum does not for -32768 */
+        d_in = vld2_s16 ( (const ne10_int16_t *) (pSrc + k));
+        q_re2 = vcvtq_f32_s32 (vmull_s16 (d_in.val[0], d_in.val[0]));
+        q_im2 = vcvtq_f32_s32 (vmull_s16 (d_in.val[1], d_in.val[1]));
+        vst1q_f32 (cfg->pPower + k, vmulq_n_f32 (vaddq_f32 (q_re2, q_im2), scale));
+    }
+    for (; k < numBins; k++)
+    {
+        cfg->pPower[k] = ( (ne10_float32_t) (pSrc[k].r * pSrc[k].r) + (ne10_float32_t) (pSrc[k].i * pSrc[k].i)) * scale;
+    }
+    ne10_mfcc_power_to_ceps_neon (cfg, pCeps, pLogMel);
+}
+/** @} */ //end of MFCC group
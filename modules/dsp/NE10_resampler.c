@@ -0,0 +1,317 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_resampler.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include <string.h>
+
+/**
+ * @ingroup groupDSPs
+ * @defgroup Resampler Polyphase Sample Rate Converter
+ *
+ * \par
+ * These functions change the sample rate of a signal by an arbitrary rational factor <code>L/M</code>,
+ * or by a real valued, possibly time-varying, ratio. Conceptually the input is upsampled by
+ * <code>L</code>, filtered by a lowpass prototype filter and downsampled by <code>M</code>; only the
+ * outputs that are kept are computed, and each of them needs a single polyphase branch of
+ * <code>phaseLength = numTaps/L</code> taps. A 44.1 kHz to 48 kHz conversion (<code>L = 160, M = 147</code>)
+ * therefore costs <code>phaseLength</code> multiply-accumulates per output sample instead of running
+ * a filter at 7.056 MHz.
+ *
+ * \par
+ * The prototype filter is designed at the rate <code>L * fs_in</code> with a cutoff frequency of
+ * <code>min(1/L, 1/M)</code> (normalized to that rate's Nyquist frequency) and a passband gain of <code>L</code>.
+ * As for @ref FIR_Interpolate the coefficients are passed in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], ..., b[1], b[0]}
+ * </pre>
+ * <code>numTaps</code> must be a multiple of <code>L</code>.
+ *
+ * \par Algorithm:
+ * With the output position <code>t</code> counted in units of <code>1/L</code> input samples,
+ * <code>n = floor(t/L)</code> and <code>p = t mod L</code>:
+ * <pre>
+ *    y = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+L*(phaseLength-1)] * x[n-phaseLength+1]
+ *    t = t + M
+ * </pre>
+ * \par
+ * In fractional mode the prototype is a bank of <code>L</code> phases (typically 32 to 256) and the
+ * position advances by a real valued <code>step = fs_in/fs_out</code>. The output is linearly
+ * interpolated between the two neighbouring phases, so the ratio can be changed between two calls
+ * of @ref ne10_resampler_float with @ref ne10_resampler_set_ratio_float, for instance to follow a
+ * drifting clock. When <code>step > 1</code> the prototype cutoff has to be lowered to <code>1/(L*step)</code>.
+ *
+ * \par
+ * The functions are streaming: each call consumes <code>blockSize</code> input samples, where
+ * <code>blockSize</code> may differ from call to call but must not exceed the <code>maxBlockSize</code>
+ * given at initialization, and returns the number of output samples written. <code>pDst</code> must hold
+ * at least <code>blockSize*L/M + 1</code> values in rational mode and <code>blockSize/step + 1</code>
+ * values in fractional mode. In fractional mode an output that falls between the last input sample
+ * of a block and the first one of the next block is returned by the next call.
+ *
+ * \par Instance Structure
+ * The initialization functions rearrange the prototype into <code>L</code> contiguous branches of
+ * <code>phaseLength</code> taps in <code>pPhaseCoeffs</code>, an array of <code>numTaps</code> values which may be
+ * shared among instances. <code>pState</code> holds <code>phaseLength+maxBlockSize</code> values and cannot
+ * be shared.
+ */
+
+/**
+ * @addtogroup Resampler
+ * @{
+ */
+
+/* Splits the time reversed prototype into L branches, each stored oldest sample first */
+static void ne10_resampler_polyphase_float (ne10_float32_t * pPhaseCoeffs,
+        const ne10_float32_t * pCoeffs,
+        ne10_uint16_t L,
+        ne10_uint16_t phaseLength)
+{
+    ne10_uint32_t p, k;
+
+    for (p = 0; p < L; p++)
+    {
+        for (k = 0; k < phaseLength; k++)
+        {
+            pPhaseCoeffs[p * phaseLength + k] = pCoeffs[ (L - 1 - p) + k * L];
+        }
+    }
+}
+
+/**
+ * @brief Initialization function for the floating-point rational resampler.
+ * @param[in,out] *S            points to an instance of the floating-point resampler structure.
+ * @param[in]     L             interpolation factor.
+ * @param[in]     M             decimation factor.
+ * @param[in]     numTaps       number of coefficients of the prototype filter.
+ * @param[in]     *pCoeffs      points to the prototype filter coefficients, in time reversed order.
+ * @param[out]    *pPhaseCoeffs points to the polyphase coefficient buffer of length <code>numTaps</code>.
+ * @param[in]     *pState       points to the state buffer of length <code>numTaps/L+maxBlockSize</code>.
+ * @param[in]     maxBlockSize  maximum number of input samples processed per call.
+ * @return NE10_OK if initialization was successful or NE10_ERR if <code>L</code> or <code>M</code> is zero or
+ * <code>numTaps</code> is not a multiple of <code>L</code>.
+ */
+ne10_result_t ne10_resampler_init_float (ne10_resampler_instance_f32_t * S,
+        ne10_uint16_t L,
+        ne10_uint16_t M,
+        ne10_uint16_t numTaps,
+        const ne10_float32_t * pCoeffs,
+        ne10_float32_t * pPhaseCoeffs,
+        ne10_float32_t * pState,
+        ne10_uint32_t maxBlockSize)
+{
+    if ( (L == 0) || (M == 0) || (numTaps == 0) || ( (numTaps % L) != 0u))
+    {
+        return NE10_ERR;
+    }
+
+    S->L = L;
+    S->M = M;
+    S->phaseLength = numTaps / L;
+    S->phase = 0;
+    S->position = 0.0;
+    S->step = (ne10_float64_t) M / L;
+
+    ne10_resampler_polyphase_float (pPhaseCoeffs, pCoeffs, L, S->phaseLength);
+    S->pCoeffs = pPhaseCoeffs;
+
+    /* Clear state buffer and size of state array is always phaseLength + maxBlockSize */
+    memset (pState, 0, (S->phaseLength + maxBlockSize) * sizeof (ne10_float32_t));
+    S->pState = pState;
+
+    return NE10_OK;
+}
+
+/**
+ * @brief Initialization function for the floating-point fractional resampler.
+ * @param[in,out] *S            points to an instance of the floating-point resampler structure.
+ * @param[in]     numPhases     number of phases of the prototype filter.
+ * @param[in]     numTaps       number of coefficients of the prototype filter.
+ * @param[in]     *pCoeffs      points to the prototype filter coefficients, in time reversed order.
+ * @param[out]    *pPhaseCoeffs points to the polyphase coefficient buffer of length <code>numTaps</code>.
+ * @param[in]     *pState       points to the state buffer of length <code>numTaps/numPhases+maxBlockSize</code>.
+ * @param[in]     maxBlockSize  maximum number of input samples processed per call.
+ * @param[in]     ratio         input sample rate divided by output sample rate.
+ * @return NE10_OK if initialization was successful or NE10_ERR if <code>ratio</code> is not positive or
+ * <code>numTaps</code> is not a multiple of <code>numPhases</code>.
+ */
+ne10_result_t ne10_resampler_fractional_init_float (ne10_resampler_instance_f32_t * S,
+        ne10_uint16_t numPhases,
+        ne10_uint16_t numTaps,
+        const ne10_float32_t * pCoeffs,
+        ne10_float32_t * pPhaseCoeffs,
+        ne10_float32_t * pState,
+        ne10_uint32_t maxBlockSize,
+        ne10_float64_t ratio)
+{
+    if ( (numPhases == 0) || (numTaps == 0) || ( (numTaps % numPhases) != 0u) || ! (ratio > 0.0))
+    {
+        return NE10_ERR;
+    }
+
+    S->L = numPhases;
+    S->M = 0;
+    S->phaseLength = numTaps / numPhases;
+    S->phase = 0;
+    S->position = 0.0;
+    S->step = ratio;
+
+    ne10_resampler_polyphase_float (pPhaseCoeffs, pCoeffs, numPhases, S->phaseLength);
+    S->pCoeffs = pPhaseCoeffs;
+
+    memset (pState, 0, (S->phaseLength + maxBlockSize) * sizeof (ne10_float32_t));
+    S->pState = pState;
+
+    return NE10_OK;
+}
+
+/**
+ * @brief Changes the conversion ratio of a fractional resampler.
+ * @param[in,out] *S    points to an instance of the floating-point resampler structure.
+ * @param[in]     ratio new input sample rate divided by output sample rate.
+ * @return NE10_OK on success or NE10_ERR if the instance is in rational mode or <code>ratio</code> is not positive.
+ *
+ * The new ratio applies from the next output sample on; the filter state and phase are kept.
+ */
+ne10_result_t ne10_resampler_set_ratio_float (ne10_resampler_instance_f32_t * S,
+        ne10_float64_t ratio)
+{
+    if ( (S->M != 0) || ! (ratio > 0.0))
+    {
+        return NE10_ERR;
+    }
+
+    S->step = ratio;
+    return NE10_OK;
+}
+
+/**
+ * Specific implementation of @ref ne10_resampler_float using plain C.
+ */
+ne10_uint32_t ne10_resampler_float_c (ne10_resampler_instance_f32_t * S,
+                                      ne10_float32_t * pSrc,
+                                      ne10_float32_t * pDst,
+                                      ne10_uint32_t blockSize)
+{
+    ne10_float32_t *pState = S->pState;                 /* State pointer */
+    ne10_uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase branch */
+    ne10_uint32_t L = S->L;
+    ne10_uint32_t outCnt = 0;                           /* Number of output samples */
+    ne10_uint32_t n, p, k;
+    ne10_float32_t *px, *px1, *pc0, *pc1;
+    ne10_float32_t sum0, sum1, mu;
+    ne10_float64_t pos, tp;
+
+    /* Append the new samples to the previous phaseLen samples; x[n] is pState[phaseLen + n] */
+    memcpy (pState + phaseLen, pSrc, blockSize * sizeof (ne10_float32_t));
+
+    if (S->M != 0)
+    {
+        ne10_uint32_t stepInt = S->M / L, stepFrac = S->M % L;
+
+        n = S->phase / L;
+        p = S->phase % L;
+        while (n < blockSize)
+        {
+            /* x[n-phaseLen+1] ... x[n] */
+            px = pState + n + 1u;
+            pc0 = S->pCoeffs + p * phaseLen;
+            sum0 = 0.0f;
+            for (k = 0; k < phaseLen; k++)
+            {
+                sum0 += pc0[k] * px[k];
+            }
+            pDst[outCnt++] = sum0;
+
+            /* t = t + M */
+            n += stepInt;
+            p += stepFrac;
+            if (p >= L)
+            {
+                p -= L;
+                n++;
+            }
+        }
+        S->phase = (n - blockSize) * L + p;
+    }
+    else
+    {
+        /* pos is in [-1, blockSize - 1) so that x[n+1] is available for the upper phase */
+        pos = S->position;
+        while (pos < (ne10_float64_t) blockSize - 1.0)
+        {
+            n = (ne10_uint32_t) (pos + 1.0);
+            tp = (pos + 1.0 - n) * L;
+            p = (ne10_uint32_t) tp;
+            if (p >= L)
+            {
+                /* (pos + 1 - n) * L rounded up to L */
+                p = L - 1u;
+            }
+            mu = (ne10_float32_t) (tp - p);
+
+            /* n = floor(pos) + 1, the window ending at x[n-1] starts at pState + n */
+            px = pState + n;
+            pc0 = S->pCoeffs + p * phaseLen;
+            if (p + 1u < L)
+            {
+                pc1 = pc0 + phaseLen;
+                px1 = px;
+            }
+            else
+            {
+                /* Phase L is phase 0 one input sample later */
+                pc1 = S->pCoeffs;
+                px1 = px + 1;
+            }
+            sum0 = 0.0f;
+            sum1 = 0.0f;
+            for (k = 0; k < phaseLen; k++)
+            {
+                sum0 += pc0[k] * px[k];
+                sum1 += pc1[k] * px1[k];
+            }
+            pDst[outCnt++] = sum0 + mu * (sum1 - sum0);
+
+            pos += S->step;
+        }
+        S->position = pos - blockSize;
+    }
+
+    /* Keep the last phaseLen samples for the next call */
+    memmove (pState, pState + blockSize, phaseLen * sizeof (ne10_float32_t));
+
+    return outCnt;
+}
+
+/**
+ * @} end of Resampler group
+ */
@@ -0,0 +1,185 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_resampler.neonintrinsic.c
+ */
+
+#include <arm_neon.h>
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_dsp.h"
+
+/**
+ * @addtogroup Resampler
+ * @{
+ */
+
+static inline ne10_float32_t ne10_resampler_dot_neon (const ne10_float32_t * pc,
+        const ne10_float32_t * px,
+        ne10_uint32_t len)
+{
+    float32x4_t q_acc0 = vdupq_n_f32 (0.0f);
+    float32x4_t q_acc1 = vdupq_n_f32 (0.0f);
+    float32x2_t d_acc;
+    ne10_float32_t sum;
+    ne10_uint32_t k;
+
+    /* Two accumulators hide the latency of the multiply-accumulate */
+    for (k = 0; k + 8 <= len; k += 8)
+    {
+        q_acc0 = vmlaq_f32 (q_acc0, vld1q_f32 (pc + k), vld1q_f32 (px + k));
+        q_acc1 = vmlaq_f32 (q_acc1, vld1q_f32 (pc + k + 4), vld1q_f32 (px + k + 4));
+    }
+    if (k + 4 <= len)
+    {
+        q_acc0 = vmlaq_f32 (q_acc0, vld1q_f32 (pc + k), vld1q_f32 (px + k));
+        k += 4;
+    }
+    q_acc0 = vaddq_f32 (q_acc0, q_acc1);
+    d_acc = vadd_f32 (vget_low_f32 (q_acc0), vget_high_f32 (q_acc0));
+    d_acc = vpadd_f32 (d_acc, d_acc);
+    sum = vget_lane_f32 (d_acc, 0);
+
+    for (; k < len; k++)
+    {
+        sum += pc[k] * px[k];
+    }
+    return sum;
+}
+
+static inline void ne10_resampler_dot2_neon (const ne10_float32_t * pc0,
+        const ne10_float32_t * pc1,
+        const ne10_float32_t * px0,
+        const ne10_float32_t * px1,
+        ne10_uint32_t len,
+        ne10_float32_t * sum0,
+        ne10_float32_t * sum1)
+{
+    float32x4_t q_acc0 = vdupq_n_f32 (0.0f);
+    float32x4_t q_acc1 = vdupq_n_f32 (0.0f);
+    float32x2_t d_acc;
+    ne10_uint32_t k;
+
+    /* Both neighbouring phases are accumulated in the same pass */
+    for (k = 0; k + 4 <= len; k += 4)
+    {
+        q_acc0 = vmlaq_f32 (q_acc0, vld1q_f32 (pc0 + k), vld1q_f32 (px0 + k));
+        q_acc1 = vmlaq_f32 (q_acc1, vld1q_f32 (pc1 + k), vld1q_f32 (px1 + k));
+    }
+    d_acc = vpadd_f32 (vadd_f32 (vget_low_f32 (q_acc0), vget_high_f32 (q_acc0)),
+                       vadd_f32 (vget_low_f32 (q_acc1), vget_high_f32 (q_acc1)));
+    *sum0 = vget_lane_f32 (d_acc, 0);
+    *sum1 = vget_lane_f32 (d_acc, 1);
+
+    for (; k < len; k++)
+    {
+        *sum0 += pc0[k] * px0[k];
+        *sum1 += pc1[k] * px1[k];
+    }
+}
+
+/**
+ * Specific implementation of @ref ne10_resampler_float using NEON SIMD capabilities.
+ */
+ne10_uint32_t ne10_resampler_float_neon (ne10_resampler_instance_f32_t * S,
+        ne10_float32_t * pSrc,
+        ne10_float32_t * pDst,
+        ne10_uint32_t blockSize)
+{
+    ne10_float32_t *pState = S->pState;
+    ne10_uint32_t phaseLen = S->phaseLength;
+    ne10_uint32_t L = S->L;
+    ne10_uint32_t outCnt = 0;
+    ne10_uint32_t n, p;
+    ne10_float32_t *px, *pc0;
+    ne10_float32_t sum0, sum1, mu;
+    ne10_float64_t pos, tp;
+
+    memcpy (pState + phaseLen, pSrc, blockSize * sizeof (ne10_float32_t));
+
+    if (S->M != 0)
+    {
+        ne10_uint32_t stepInt = S->M / L, stepFrac = S->M % L;
+
+        n = S->phase / L;
+        p = S->phase % L;
+        while (n < blockSize)
+        {
+            pDst[outCnt++] = ne10_resampler_dot_neon (S->pCoeffs + p * phaseLen, pState + n + 1u, phaseLen);
+
+            n += stepInt;
+            p += stepFrac;
+            if (p >= L)
+            {
+                p -= L;
+                n++;
+            }
+        }
+        S->phase = (n - blockSize) * L + p;
+    }
+    else
+    {
+        pos = S->position;
+        while (pos < (ne10_float64_t) blockSize - 1.0)
+        {
+            n = (ne10_uint32_t) (pos + 1.0);
+            tp = (pos + 1.0 - n) * L;
+            p = (ne10_uint32_t) tp;
+            if (p >= L)
+            {
+                p = L - 1u;
+            }
+            mu = (ne10_float32_t) (tp - p);
+
+            px = pState + n;
+            pc0 = S->pCoeffs + p * phaseLen;
+            if (p + 1u < L)
+            {
+                ne10_resampler_dot2_neon (pc0, pc0 + phaseLen, px, px, phaseLen, &sum0, &sum1);
+            }
+            else
+            {
+                ne10_resampler_dot2_neon (pc0, S->pCoeffs, px, px + 1, phaseLen, &sum0, &sum1);
+            }
+            pDst[outCnt++] = sum0 + mu * (sum1 - sum0);
+
+            pos += S->step;
+        }
+        S->position = pos - blockSize;
+    }
+
+    memmove (pState, pState + blockSize, phaseLen * sizeof (ne10_float32_t));
+
+    return outCnt;
+}
+
+/**
+ * @} end of Resampler group
+ */
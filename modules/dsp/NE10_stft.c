@@ -0,0 +1,393 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_stft.c
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_fft.h"
+#include "NE10_dsp.h"
+
+/**
+ * @ingroup groupDSPs
+ */
+
+/**
+ * @defgroup STFT Short-Time Fourier Transform
+ *
+ * \par
+ * The streaming short-time Fourier transform cuts its input into frames of <code>frameLen</code> samples
+ * that start every <code>hopSize</code> samples, multiplies each frame by a window and transforms it with
+ * the real FFT:
+ * <pre>
+ *    X_k = FFT(w * x[k*hopSize ... k*hopSize+frameLen-1])
+ * </pre>
+ * @ref ne10_stft_float32 takes input chunks of any size, buffers the samples that do not make a whole frame
+ * yet, and stores the <code>frameLen/2+1</code> bins of every new frame in a ring of spectra, from which the
+ * caller takes them with @ref ne10_stft_read_float32. The window is applied while the frame is gathered from
+ * the input history into the FFT input, so it costs no extra pass over the frame.
+ * \par
+ * The inverse transform, @ref ne10_istft_float32, takes one spectrum at a time, multiplies the inverse FFT by
+ * the synthesis window and adds it into an overlap-add accumulator (weighted overlap-add). It then returns the
+ * <code>hopSize</code> samples that no later frame overlaps, divided by the sum of the squared window over the
+ * overlapping frames. Spectra of an analysis with the same window and hop are thus reconstructed exactly,
+ * without delay, except for the first <code>frameLen-hopSize</code> samples that miss the frames before the
+ * start of the signal.
+ * \par
+ * The windows are periodic (DFT-even): Hann, Hamming, Blackman, Kaiser with the parameter <code>beta</code>,
+ * or a custom window of <code>frameLen</code> coefficients. <code>frameLen</code> must be a power of 2 and
+ * <code>hopSize</code> at most <code>frameLen</code>. The configurations are allocated with
+ * @ref ne10_stft_alloc_float32 or @ref ne10_istft_alloc_float32 and freed with @ref ne10_stft_destroy_float32.
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/* Zeroth order modified Bessel function of the first kind */
+static ne10_float64_t ne10_stft_bessel_i0 (ne10_float64_t x)
+{
+    ne10_float64_t sum = 1.0, term = 1.0;
+    ne10_int32_t k;
+
+    for (k = 1; k < 64; k++)
+    {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < sum * 1e-12)
+        {
+            break;
+        }
+    }
+    return sum;
+}
+
+static ne10_result_t ne10_stft_window (ne10_float32_t * pWindow,
+                                       ne10_uint32_t frameLen,
+                                       ne10_uint32_t windowType,
+                                       ne10_float32_t beta,
+                                       const ne10_float32_t * pCustomWindow)
+{
+    const ne10_float64_t step = 2.0 * NE10_PI / frameLen;
+    ne10_float64_t t;
+    ne10_uint32_t n;
+
+    for (n = 0; n < frameLen; n++)
+    {
+        switch (windowType)
+        {
+        case NE10_WINDOW_HANN:
+            pWindow[n] = (ne10_float32_t) (0.5 - 0.5 * cos (step * n));
+            break;
+        case NE10_WINDOW_HAMMING:
+            pWindow[n] = (ne10_float32_t) (0.54 - 0.46 * cos (step * n));
+            break;
+        case NE10_WINDOW_BLACKMAN:
+            pWindow[n] = (ne10_float32_t) (0.42 - 0.5 * cos (step * n) + 0.08 * cos (2.0 * step * n));
+            break;
+        case NE10_WINDOW_KAISER:
+            t = 2.0 * n / frameLen - 1.0;
+            pWindow[n] = (ne10_float32_t) (ne10_stft_bessel_i0 (beta * sqrt (1.0 - t * t)) / ne10_stft_bessel_i0 (beta));
+            break;
+        case NE10_WINDOW_CUSTOM:
+            if (pCustomWindow == NULL)
+            {
+                return NE10_ERR;
+            }
+            pWindow[n] = pCustomWindow[n];
+            break;
+        default:
+            return NE10_ERR;
+        }
+    }
+    return NE10_OK;
+}
+
+static ne10_stft_cfg_float32_t ne10_stft_alloc (ne10_uint32_t frameLen,
+        ne10_uint32_t hopSize,
+        ne10_uint32_t numFrames,
+        ne10_uint32_t windowType,
+        ne10_float32_t beta,
+        const ne10_float32_t * pCustomWindow)
+{
+    ne10_stft_cfg_float32_t st;
+    ne10_uint32_t numBins = frameLen / 2 + 1;
+    ne10_uint32_t bufferLen = numFrames ? 2 * frameLen : frameLen;
+    ne10_uint32_t memneeded;
+    uintptr_t address;
+
+    if ( (frameLen < 4) || (frameLen & (frameLen - 1)) || (hopSize == 0) || (hopSize > frameLen))
+    {
+        return NULL;
+    }
+
+    memneeded = sizeof (ne10_stft_state_float32_t)
+                + sizeof (ne10_fft_cpx_float32_t) * numBins * (numFrames ? numFrames : 1)  /* spectra */
+                + sizeof (ne10_float32_t) * (frameLen + bufferLen + frameLen + hopSize)    /* window, buffer, frame, norm */
+                + NE10_FFT_BYTE_ALIGNMENT;
+    st = (ne10_stft_cfg_float32_t) NE10_MALLOC (memneeded);
+    if (st == NULL)
+    {
+        return NULL;
+    }
+
+    address = (uintptr_t) (st + 1);
+    NE10_BYTE_ALIGNMENT (address, NE10_FFT_BYTE_ALIGNMENT);
+    st->pSpectra = (ne10_fft_cpx_float32_t *) address;
+    st->pWindow = (ne10_float32_t *) (st->pSpectra + numBins * (numFrames ? numFrames : 1));
+    st->pBuffer = st->pWindow + frameLen;
+    st->pFrame = st->pBuffer + bufferLen;
+    st->pNorm = st->pFrame + frameLen;
+
+    st->frameLen = frameLen;
+    st->hopSize = hopSize;
+    st->numFrames = numFrames;
+    st->readIndex = 0;
+    st->count = 0;
+    st->histStart = 0;
+    st->histEnd = 0;
+    memset (st->pBuffer, 0, bufferLen * sizeof (ne10_float32_t));
+
+    st->fftCfg = NULL;
+    if (ne10_stft_window (st->pWindow, frameLen, windowType, beta, pCustomWindow) != NE10_OK)
+    {
+        NE10_FREE (st);
+        return NULL;
+    }
+    st->fftCfg = ne10_fft_alloc_r2c_float32 (frameLen);
+    if (st->fftCfg == NULL)
+    {
+        NE10_FREE (st);
+        return NULL;
+    }
+    return st;
+}
+
+/**
+ * @brief Allocates a streaming short-time Fourier transform.
+ * @param[in]   frameLen       length of the frames and of the FFT, a power of 2.
+ * @param[in]   hopSize        distance between the starts of consecutive frames, from 1 to frameLen.
+ * @param[in]   numFrames      number of spectra the ring holds.
+ * @param[in]   windowType     NE10_WINDOW_HANN, NE10_WINDOW_HAMMING, NE10_WINDOW_BLACKMAN, NE10_WINDOW_KAISER or NE10_WINDOW_CUSTOM.
+ * @param[in]   beta           parameter of the Kaiser window, ignored by the other windows.
+ * @param[in]   *pCustomWindow points to the frameLen coefficients of a custom window, or NULL.
+ * @return      the configuration, or NULL if a parameter is invalid or the memory allocation fails.
+ */
+ne10_stft_cfg_float32_t ne10_stft_alloc_float32 (ne10_uint32_t frameLen,
+        ne10_uint32_t hopSize,
+        ne10_uint32_t numFrames,
+        ne10_uint32_t windowType,
+        ne10_float32_t beta,
+        const ne10_float32_t * pCustomWindow)
+{
+    if (numFrames == 0)
+    {
+        return NULL;
+    }
+    return ne10_stft_alloc (frameLen, hopSize, numFrames, windowType, beta, pCustomWindow);
+}
+
+/**
+ * @brief Allocates a streaming inverse short-time Fourier transform.
+ * @param[in]   frameLen       length of the frames and of the FFT, a power of 2.
+ * @param[in]   hopSize        distance between the starts of consecutive frames, from 1 to frameLen.
+ * @param[in]   windowType     synthesis window, as for @ref ne10_stft_alloc_float32.
+ * @param[in]   beta           parameter of the Kaiser window, ignored by the other windows.
+ * @param[in]   *pCustomWindow points to the frameLen coefficients of a custom window, or NULL.
+ * @return      the configuration, or NULL if a parameter is invalid, the squared window does not overlap-add to a
+ *              nonzero gain at every position, or the memory allocation fails.
+ */
+ne10_stft_cfg_float32_t ne10_istft_alloc_float32 (ne10_uint32_t frameLen,
+        ne10_uint32_t hopSize,
+        ne10_uint32_t windowType,
+        ne10_float32_t beta,
+        const ne10_float32_t * pCustomWindow)
+{
+    ne10_stft_cfg_float32_t st = ne10_stft_alloc (frameLen, hopSize, 0, windowType, beta, pCustomWindow);
+    ne10_float32_t gain;
+    ne10_uint32_t i, n;
+
+    if (st == NULL)
+    {
+        return NULL;
+    }
+
+    /* Reciprocal of the sum of the squared window over the frames overlapping each output position */
+    for (i = 0; i < hopSize; i++)
+    {
+        gain = 0.0f;
+        for (n = i; n < frameLen; n += hopSize)
+        {
+            gain += st->pWindow[n] * st->pWindow[n];
+        }
+        if (gain < 1e-6f)
+        {
+            ne10_stft_destroy_float32 (st);
+            return NULL;
+        }
+        st->pNorm[i] = 1.0f / gain;
+    }
+    return st;
+}
+
+/**
+ * @brief Frees a configuration allocated by @ref ne10_stft_alloc_float32 or @ref ne10_istft_alloc_float32.
+ */
+void ne10_stft_destroy_float32 (ne10_stft_cfg_float32_t cfg)
+{
+    if (cfg == NULL)
+    {
+        return;
+    }
+    ne10_fft_destroy_r2c_float32 (cfg->fftCfg);
+    NE10_FREE (cfg);
+}
+
+/**
+ * @brief Takes the oldest spectrum out of the ring of a short-time Fourier transform.
+ * @param[in]   cfg        configuration from @ref ne10_stft_alloc_float32.
+ * @return      a pointer to the <code>frameLen/2+1</code> bins of the spectrum, or NULL if the ring is empty.
+ *              The spectrum stays valid until the next call of @ref ne10_stft_float32.
+ */
+ne10_fft_cpx_float32_t* ne10_stft_read_float32 (ne10_stft_cfg_float32_t cfg)
+{
+    ne10_fft_cpx_float32_t *pSpectrum;
+
+    if (cfg->count == 0)
+    {
+        return NULL;
+    }
+    pSpectrum = cfg->pSpectra + cfg->readIndex * (cfg->frameLen / 2 + 1);
+    cfg->readIndex = (cfg->readIndex + 1 == cfg->numFrames) ? 0 : cfg->readIndex + 1;
+    cfg->count--;
+    return pSpectrum;
+}
+
+/* Windows the next frame of the history straight into the FFT input and transforms it into a free ring slot */
+static void ne10_stft_emit_c (ne10_stft_cfg_float32_t cfg)
+{
+    ne10_float32_t *pSrc = cfg->pBuffer + cfg->histStart;
+    ne10_uint32_t slot = cfg->readIndex + cfg->count;
+    ne10_uint32_t n;
+
+    for (n = 0; n < cfg->frameLen; n++)
+    {
+        cfg->pFrame[n] = pSrc[n] * cfg->pWindow[n];
+    }
+    slot -= (slot >= cfg->numFrames) ? cfg->numFrames : 0;
+    ne10_fft_r2c_1d_float32_c (cfg->pSpectra + slot * (cfg->frameLen / 2 + 1), cfg->pFrame, cfg->fftCfg);
+    cfg->count++;
+    cfg->histStart += cfg->hopSize;
+}
+
+/**
+ * @brief Streaming short-time Fourier transform.
+ * @param[in]   cfg        configuration from @ref ne10_stft_alloc_float32.
+ * @param[in]   *pSrc      points to the input chunk.
+ * @param[in]   srcLen     number of samples in the chunk.
+ * @return      number of samples consumed. It is smaller than srcLen only when the ring of spectra is full;
+ *              the caller then reads spectra and passes the rest of the chunk again.
+ */
+ne10_uint32_t ne10_stft_float32_c (ne10_stft_cfg_float32_t cfg,
+                                   ne10_float32_t * pSrc,
+                                   ne10_uint32_t srcLen)
+{
+    ne10_uint32_t frameLen = cfg->frameLen;
+    ne10_uint32_t consumed = 0;
+    ne10_uint32_t n;
+
+    for (;;)
+    {
+        if (cfg->histEnd - cfg->histStart == frameLen)
+        {
+            if (cfg->count == cfg->numFrames)
+            {
+                break;
+            }
+            ne10_stft_emit_c (cfg);
+            continue;
+        }
+        /* A frame is only completed when there is a free slot for it */
+        if ( (consumed == srcLen) || (cfg->count == cfg->numFrames))
+        {
+            break;
+        }
+
+        /* Move the partial frame to the start of the history when the end is reached */
+        if (cfg->histEnd == 2 * frameLen)
+        {
+            memmove (cfg->pBuffer, cfg->pBuffer + cfg->histStart, (cfg->histEnd - cfg->histStart) * sizeof (ne10_float32_t));
+            cfg->histEnd -= cfg->histStart;
+            cfg->histStart = 0;
+        }
+        n = frameLen - (cfg->histEnd - cfg->histStart);
+        n = (n < 2 * frameLen - cfg->histEnd) ? n : 2 * frameLen - cfg->histEnd;
+        n = (n < srcLen - consumed) ? n : srcLen - consumed;
+        memcpy (cfg->pBuffer + cfg->histEnd, pSrc + consumed, n * sizeof (ne10_float32_t));
+        cfg->histEnd += n;
+        consumed += n;
+    }
+    return consumed;
+}
+
+/**
+ * @brief Streaming inverse short-time Fourier transform.
+ * @param[in]   cfg        configuration from @ref ne10_istft_alloc_float32.
+ * @param[out]  *pDst      points to the hopSize output samples.
+ * @param[in]   *pSrc      points to the <code>frameLen/2+1</code> bins of the next spectrum. It is used as
+ *                         scratch by the inverse FFT.
+ * @return      number of output samples, hopSize.
+ */
+ne10_uint32_t ne10_istft_float32_c (ne10_stft_cfg_float32_t cfg,
+                                    ne10_float32_t * pDst,
+                                    ne10_fft_cpx_float32_t * pSrc)
+{
+    ne10_uint32_t frameLen = cfg->frameLen;
+    ne10_uint32_t hopSize = cfg->hopSize;
+    ne10_float32_t *pAcc = cfg->pBuffer;
+    ne10_uint32_t n;
+
+    ne10_fft_c2r_1d_float32_c (cfg->pFrame, pSrc, cfg->fftCfg);
+    for (n = 0; n < frameLen; n++)
+    {
+        pAcc[n] += cfg->pFrame[n] * cfg->pWindow[n];
+    }
+    for (n = 0; n < hopSize; n++)
+    {
+        pDst[n] = pAcc[n] * cfg->pNorm[n];
+    }
+    memmove (pAcc, pAcc + hopSize, (frameLen - hopSize) * sizeof (ne10_float32_t));
+    memset (pAcc + frameLen - hopSize, 0, hopSize * sizeof (ne10_float32_t));
+    return hopSize;
+}
+/** @} */ //end of STFT group
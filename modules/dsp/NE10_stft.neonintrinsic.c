@@ -0,0 +1,140 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_stft.neonintrinsic.c
+ */
+
+#include <arm_neon.h>
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_dsp.h"
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/* frameLen is a power of 2 of at least 4, so the frame loops have no remainder */
+static void ne10_stft_emit_neon (ne10_stft_cfg_float32_t cfg)
+{
+    ne10_float32_t *pSrc = cfg->pBuffer + cfg->histStart;
+    ne10_uint32_t slot = cfg->readIndex + cfg->count;
+    ne10_uint32_t n;
+
+    for (n = 0; n < cfg->frameLen; n += 4)
+    {
+        vst1q_f32 (cfg->pFrame + n, vmulq_f32 (vld1q_f32 (pSrc + n), vld1q_f32 (cfg->pWindow + n)));
+    }
+    slot -= (slot >= cfg->numFrames) ? cfg->numFrames : 0;
+    ne10_fft_r2c_1d_float32_neon (cfg->pSpectra + slot * (cfg->frameLen / 2 + 1), cfg->pFrame, cfg->fftCfg);
+    cfg->count++;
+    cfg->histStart += cfg->hopSize;
+}
+
+/**
+ * Specific implementation of @ref ne10_stft_float32 using NEON SIMD capabilities.
+ */
+ne10_uint32_t ne10_stft_float32_neon (ne10_stft_cfg_float32_t cfg,
+                                      ne10_float32_t * pSrc,
+                                      ne10_uint32_t srcLen)
+{
+    ne10_uint32_t frameLen = cfg->frameLen;
+    ne10_uint32_t consumed = 0;
+    ne10_uint32_t n;
+
+    for (;;)
+    {
+        if (cfg->histEnd - cfg->histStart == frameLen)
+        {
+            if (cfg->count == cfg->numFrames)
+            {
+                break;
+            }
+            ne10_stft_emit_neon (cfg);
+            continue;
+        }
+        /* A frame is only completed when there is a free slot for it */
+        if ( (consumed == srcLen) || (cfg->count == cfg->numFrames))
+        {
+            break;
+        }
+
+        if (cfg->histEnd == 2 * frameLen)
+        {
+            memmove (cfg->pBuffer, cfg->pBuffer + cfg->histStart, (cfg->histEnd - cfg->histStart) * sizeof (ne10_float32_t));
+            cfg->histEnd -= cfg->histStart;
+            cfg->histStart = 0;
+        }
+        n = frameLen - (cfg->histEnd - cfg->histStart);
+        n = (n < 2 * frameLen - cfg->histEnd) ? n : 2 * frameLen - cfg->histEnd;
+        n = (n < srcLen - consumed) ? n : srcLen - consumed;
+        memcpy (cfg->pBuffer + cfg->histEnd, pSrc + consumed, n * sizeof (ne10_float32_t));
+        cfg->histEnd += n;
+        consumed += n;
+    }
+    return consumed;
+}
+
+/**
+ * Specific implementation of @ref ne10_istft_float32 using NEON SIMD capabilities.
+ */
+ne10_uint32_t ne10_istft_float32_neon (ne10_stft_cfg_float32_t cfg,
+                                       ne10_float32_t * pDst,
+                                       ne10_fft_cpx_float32_t * pSrc)
+{
+    ne10_uint32_t frameLen = cfg->frameLen;
+    ne10_uint32_t hopSize = cfg->hopSize;
+    ne10_float32_t *pAcc = cfg->pBuffer;
+    ne10_uint32_t n;
+
+    ne10_fft_c2r_1d_float32_neon (cfg->pFrame, pSrc, cfg->fftCfg);
+
+    /* The output part of the accumulator is finished here, and the rest is shifted down in the same pass */
+    for (n = 0; n + 4 <= hopSize; n += 4)
+    {
+        float32x4_t q_acc = vmlaq_f32 (vld1q_f32 (pAcc + n), vld1q_f32 (cfg->pFrame + n), vld1q_f32 (cfg->pWindow + n));
+        vst1q_f32 (pDst + n, vmulq_f32 (q_acc, vld1q_f32 (cfg->pNorm + n)));
+    }
+    for (; n < hopSize; n++)
+    {
+        pDst[n] = (pAcc[n] + cfg->pFrame[n] * cfg->pWindow[n]) * cfg->pNorm[n];
+    }
+    for (n = hopSize; n + 4 <= frameLen; n += 4)
+    {
+        vst1q_f32 (pAcc + n - hopSize, vmlaq_f32 (vld1q_f32 (pAcc + n), vld1q_f32 (cfg->pFrame + n), vld1q_f32 (cfg->pWindow + n)));
+    }
+    for (; n < frameLen; n++)
+    {
+        pAcc[n - hopSize] = pAcc[n] + cfg->pFrame[n] * cfg->pWindow[n];
+    }
+    memset (pAcc + frameLen - hopSize, 0, hopSize * sizeof (ne10_float32_t));
+    return hopSize;
+}
+/** @} */ //end of STFT group
@@ -41,9 +41,18 @@ void test_fixture_fft_r2c_1d_int16 (void);
 void test_fixture_fir (void);
 void test_fixture_fir_decimate (void);
 void test_fixture_fir_interpolate (void);
+void test_fixture_fir_halfband (void);
+void test_fixture_resampler (void);
 void test_fixture_fir_lattice (void);
 void test_fixture_fir_sparse (void);
 void test_fixture_iir_lattice (void);
+void test_fixture_iir_block (void);
+void test_fixture_lms (void);
+void test_fixture_correlate (void);
+void test_fixture_stft (void);
+void test_fixture_mfcc (void);
+void test_fixture_dct (void);
+void test_fixture_goertzel (void);
 
 void all_tests (void)
 {
@@ -56,9 +65,18 @@ void all_tests (void)
     test_fixture_fir();
     test_fixture_fir_decimate();
     test_fixture_fir_interpolate();
+    test_fixture_fir_halfband();
+    test_fixture_resampler();
     test_fixture_fir_lattice();
     test_fixture_fir_sparse();
     test_fixture_iir_lattice();
+    test_fixture_iir_block();
+    test_fixture_lms();
+    test_fixture_correlate();
+    test_fixture_stft();
+    test_fixture_mfcc();
+    test_fixture_dct();
+    test_fixture_goertzel();
 }
 
 
@@ -0,0 +1,564 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_correlate.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "NE10_dsp.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#define TEST_LENGTH_SAMPLES 2048
+#define MAX_OUTPUT_LEN (2 * TEST_LENGTH_SAMPLES)
+/* Q15 outputs of the FFT method may differ from the exact rounding by this many LSBs */
+#define Q15_TOLERANCE 2
+/* The normalized direct method scales the exact sums in single precision */
+#define Q15_NORM_TOLERANCE 1
+
+#define TEST_COUNT 500
+
+/* ----------------------------------------------------------------------
+** Defines each of the tests performed
+** ------------------------------------------------------------------- */
+typedef struct
+{
+    ne10_uint32_t srcALen;
+    ne10_uint32_t srcBLen;      /* maxLag for auto-correlation */
+    ne10_uint32_t mode;
+    ne10_uint32_t flags;
+} test_config;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static test_config CONFIG[] =
+{
+    {1, 1, NE10_CORR_FULL, 0},
+    {100, 7, NE10_CORR_FULL, 0},
+    {7, 100, NE10_CORR_FULL, NE10_CORR_NORMALIZE},
+    {256, 33, NE10_CORR_SAME, 0},
+    {33, 256, NE10_CORR_SAME, NE10_CORR_NORMALIZE},
+    {1000, 64, NE10_CORR_VALID, 0},
+    {64, 1000, NE10_CORR_VALID, NE10_CORR_NORMALIZE},
+    {2048, 2048, NE10_CORR_FULL, 0},
+    {1500, 700, NE10_CORR_SAME, NE10_CORR_NORMALIZE}
+};
+#define NUM_TESTS (sizeof(CONFIG) / sizeof(CONFIG[0]) )
+
+static test_config CONFIG_AUTO[] =
+{
+    {1, 0, 0, 0},
+    {64, 10, 0, 0},
+    {300, 299, 0, NE10_CORR_NORMALIZE},
+    {2048, 256, 0, 0},
+    {1024, 17, 0, NE10_CORR_NORMALIZE}
+};
+#define NUM_AUTO_TESTS (sizeof(CONFIG_AUTO) / sizeof(CONFIG_AUTO[0]) )
+#endif
+#ifdef PERFORMANCE_TEST
+/* Sizes around the crossover of the direct and the FFT methods */
+static test_config CONFIG_PERF[] =
+{
+    {256, 16, NE10_CORR_FULL, 0},
+    {256, 64, NE10_CORR_FULL, 0},
+    {512, 128, NE10_CORR_FULL, 0},
+    {1024, 64, NE10_CORR_FULL, 0},
+    {1024, 256, NE10_CORR_FULL, 0},
+    {2048, 512, NE10_CORR_FULL, 0}
+};
+#define NUM_PERF_TESTS (sizeof(CONFIG_PERF) / sizeof(CONFIG_PERF[0]) )
+#endif
+
+static const ne10_uint32_t methods[] = {NE10_CORR_FORCE_DIRECT, NE10_CORR_FORCE_FFT, 0};
+#define NUM_METHODS (sizeof(methods) / sizeof(methods[0]) )
+
+//input and output
+static ne10_float32_t testInputA_f32[TEST_LENGTH_SAMPLES];
+static ne10_float32_t testInputB_f32[TEST_LENGTH_SAMPLES];
+static ne10_int16_t testInputA_i16[TEST_LENGTH_SAMPLES];
+static ne10_int16_t testInputB_i16[TEST_LENGTH_SAMPLES];
+static ne10_float32_t * guarded_out_c = NULL;
+static ne10_float32_t * guarded_out_neon = NULL;
+static ne10_float32_t * out_c = NULL;
+static ne10_float32_t * out_neon = NULL;
+static ne10_float32_t * out_ref = NULL;
+static ne10_int16_t * iout_c = NULL;
+static ne10_int16_t * iout_neon = NULL;
+static ne10_int16_t * iout_ref = NULL;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static ne10_float32_t snr = 0.0f;
+#endif
+#ifdef PERFORMANCE_TEST
+static ne10_int64_t time_c = 0;
+static ne10_int64_t time_neon = 0;
+static ne10_float32_t time_speedup = 0.0f;
+static ne10_float32_t time_savings = 0.0f;
+#endif
+
+/* Double precision reference of the selected outputs, with the same definitions as the library */
+static void test_correlate_reference (ne10_float32_t * pDst, const ne10_float32_t * pA, ne10_uint32_t srcALen,
+                                      const ne10_float32_t * pB, ne10_uint32_t srcBLen,
+                                      ne10_uint32_t outOffset, ne10_uint32_t outLen, ne10_uint32_t flags)
+{
+    ne10_int32_t lag, n;
+    ne10_uint32_t j;
+    ne10_float64_t acc, energyA = 0.0, energyB = 0.0;
+
+    for (n = 0; n < (ne10_int32_t) srcALen; n++)
+    {
+        energyA += (ne10_float64_t) pA[n] * pA[n];
+    }
+    for (n = 0; n < (ne10_int32_t) srcBLen; n++)
+    {
+        energyB += (ne10_float64_t) pB[n] * pB[n];
+    }
+    for (j = 0; j < outLen; j++)
+    {
+        lag = (ne10_int32_t) (outOffset + j) - (ne10_int32_t) (srcBLen - 1);
+        acc = 0.0;
+        for (n = 0; n < (ne10_int32_t) srcBLen; n++)
+        {
+            if ( (n + lag >= 0) && (n + lag < (ne10_int32_t) srcALen))
+            {
+                acc += (ne10_float64_t) pA[n + lag] * pB[n];
+            }
+        }
+        pDst[j] = (ne10_float32_t) ( (flags & NE10_CORR_NORMALIZE) ? acc / sqrt (energyA * energyB) : acc);
+    }
+}
+
+static void test_correlate_range (test_config * config, ne10_uint32_t * outOffset, ne10_uint32_t * outLen)
+{
+    ne10_uint32_t minLen = (config->srcALen < config->srcBLen) ? config->srcALen : config->srcBLen;
+    ne10_uint32_t maxLen = (config->srcALen < config->srcBLen) ? config->srcBLen : config->srcALen;
+
+    switch (config->mode)
+    {
+    case NE10_CORR_SAME:
+        *outOffset = (minLen - 1) / 2;
+        *outLen = maxLen;
+        break;
+    case NE10_CORR_VALID:
+        *outOffset = minLen - 1;
+        *outLen = maxLen - minLen + 1;
+        break;
+    default:
+        *outOffset = 0;
+        *outLen = config->srcALen + config->srcBLen - 1;
+        break;
+    }
+}
+
+/* Q15 reference from the exact integer sums, rounded to nearest as the library does */
+static void test_correlate_reference_q15 (ne10_int16_t * pDst, const ne10_int16_t * pA, ne10_uint32_t srcALen,
+        const ne10_int16_t * pB, ne10_uint32_t srcBLen,
+        ne10_uint32_t outOffset, ne10_uint32_t outLen, ne10_uint32_t flags)
+{
+    ne10_int32_t lag, n;
+    ne10_uint32_t j;
+    ne10_int64_t acc, energyA = 0, energyB = 0;
+    ne10_float64_t norm = 0.0, expected;
+
+    for (n = 0; n < (ne10_int32_t) srcALen; n++)
+    {
+        energyA += (ne10_int32_t) pA[n] * pA[n];
+    }
+    for (n = 0; n < (ne10_int32_t) srcBLen; n++)
+    {
+        energyB += (ne10_int32_t) pB[n] * pB[n];
+    }
+    if ( (energyA > 0) && (energyB > 0))
+    {
+        norm = 1.0 / sqrt ( (ne10_float64_t) energyA * (ne10_float64_t) energyB);
+    }
+    for (j = 0; j < outLen; j++)
+    {
+        lag = (ne10_int32_t) (outOffset + j) - (ne10_int32_t) (srcBLen - 1);
+        acc = 0;
+        for (n = 0; n < (ne10_int32_t) srcBLen; n++)
+        {
+            if ( (n + lag >= 0) && (n + lag < (ne10_int32_t) srcALen))
+            {
+                acc += (ne10_int32_t) pA[n + lag] * pB[n];
+            }
+        }
+        /* the sums are in Q30 and fit the double mantissa */
+        if (flags & NE10_CORR_NORMALIZE)
+        {
+            expected = floor ( (ne10_float64_t) acc * norm * 32768.0 + 0.5);
+        }
+        else
+        {
+            expected = floor ( (ne10_float64_t) acc / 32768.0 + 0.5);
+        }
+        expected = (expected > 32767.0) ? 32767.0 : ( (expected < -32768.0) ? -32768.0 : expected);
+        pDst[j] = (ne10_int16_t) expected;
+    }
+}
+
+/* Compares Q15 outputs with the reference computed from the same samples */
+static ne10_int32_t test_correlate_check_q15 (const ne10_int16_t * pOut, const ne10_int16_t * pRef, ne10_uint32_t length, ne10_int32_t tolerance)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        if (abs ( (ne10_int32_t) pOut[i] - (ne10_int32_t) pRef[i]) > tolerance)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* The direct method is exact unless the outputs are normalized */
+static ne10_int32_t test_correlate_tolerance_q15 (ne10_corr_cfg_float32_t cfg, ne10_uint32_t flags)
+{
+    if (cfg->nfft)
+    {
+        return Q15_TOLERANCE;
+    }
+    return (flags & NE10_CORR_NORMALIZE) ? Q15_NORM_TOLERANCE : 0;
+}
+
+void test_correlate_case0()
+{
+    ne10_corr_cfg_float32_t cfg;
+
+    ne10_uint16_t loop = 0;
+    ne10_uint16_t method = 0;
+    ne10_uint32_t i = 0;
+    ne10_uint32_t outOffset, outLen;
+
+    test_config *config;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        testInputA_i16[i] = (ne10_int16_t) (drand48() * 4096.0 - 2048.0);
+        testInputB_i16[i] = (ne10_int16_t) (drand48() * 4096.0 - 2048.0);
+        testInputA_f32[i] = (ne10_float32_t) testInputA_i16[i] / 32768.0f;
+        testInputB_f32[i] = (ne10_float32_t) testInputB_i16[i] / 32768.0f;
+    }
+
+    /* init dst memory */
+    NE10_DST_ALLOC (out_c, guarded_out_c, MAX_OUTPUT_LEN);
+    NE10_DST_ALLOC (out_neon, guarded_out_neon, MAX_OUTPUT_LEN);
+    out_ref = (ne10_float32_t*) malloc (MAX_OUTPUT_LEN * sizeof (ne10_float32_t));
+    iout_c = (ne10_int16_t*) malloc (MAX_OUTPUT_LEN * sizeof (ne10_int16_t));
+    iout_neon = (ne10_int16_t*) malloc (MAX_OUTPUT_LEN * sizeof (ne10_int16_t));
+    iout_ref = (ne10_int16_t*) malloc (MAX_OUTPUT_LEN * sizeof (ne10_int16_t));
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_TESTS; loop++)
+    {
+        config = &CONFIG[loop];
+        test_correlate_range (config, &outOffset, &outLen);
+        test_correlate_reference (out_ref, testInputA_f32, config->srcALen, testInputB_f32, config->srcBLen,
+                                  outOffset, outLen, config->flags);
+        test_correlate_reference_q15 (iout_ref, testInputA_i16, config->srcALen, testInputB_i16, config->srcBLen,
+                                      outOffset, outLen, config->flags);
+
+        for (method = 0; method < NUM_METHODS; method++)
+        {
+            cfg = ne10_corr_alloc_float32 (config->srcALen, config->srcBLen, config->mode, config->flags | methods[method]);
+            assert_true (cfg != NULL);
+            assert_int_equal (outLen, cfg->outLen);
+
+            GUARD_ARRAY (out_c, MAX_OUTPUT_LEN);
+            GUARD_ARRAY (out_neon, MAX_OUTPUT_LEN);
+
+            ne10_correlate_float_c (cfg, out_c, testInputA_f32, testInputB_f32);
+            ne10_correlate_float_neon (cfg, out_neon, testInputA_f32, testInputB_f32);
+
+            assert_true (CHECK_ARRAY_GUARD (out_c, MAX_OUTPUT_LEN));
+            assert_true (CHECK_ARRAY_GUARD (out_neon, MAX_OUTPUT_LEN));
+
+            //conformance test 1: compare with the double precision reference
+            snr = CAL_SNR_FLOAT32 (out_ref, out_c, outLen);
+#if defined (DEBUG_TRACE)
+            printf ("--------------------config %d method %d nfft %d\n", loop, method, cfg->nfft);
+            printf ("snr ref/c %f\n", snr);
+#endif
+            assert_false ( (snr < SNR_THRESHOLD));
+            snr = CAL_SNR_FLOAT32 (out_ref, out_neon, outLen);
+#if defined (DEBUG_TRACE)
+            printf ("snr ref/neon %f\n", snr);
+#endif
+            assert_false ( (snr < SNR_THRESHOLD));
+
+            //conformance test 2: Q15 versions
+            ne10_correlate_int16_c (cfg, iout_c, testInputA_i16, testInputB_i16);
+            ne10_correlate_int16_neon (cfg, iout_neon, testInputA_i16, testInputB_i16);
+            assert_true (test_correlate_check_q15 (iout_c, iout_ref, outLen, test_correlate_tolerance_q15 (cfg, config->flags)));
+            assert_true (test_correlate_check_q15 (iout_neon, iout_ref, outLen, test_correlate_tolerance_q15 (cfg, config->flags)));
+
+            ne10_corr_destroy_float32 (cfg);
+        }
+    }
+
+    /* full scale signals, whose energies multiply to more than 64 bits */
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        iout_ref[i] = -32768;
+    }
+    for (method = 0; method < NUM_METHODS; method++)
+    {
+        cfg = ne10_corr_alloc_float32 (TEST_LENGTH_SAMPLES, TEST_LENGTH_SAMPLES, NE10_CORR_VALID, NE10_CORR_NORMALIZE | methods[method]);
+        assert_true (cfg != NULL);
+        ne10_correlate_int16_c (cfg, iout_c, iout_ref, iout_ref);
+        ne10_correlate_int16_neon (cfg, iout_neon, iout_ref, iout_ref);
+        assert_int_equal (32767, iout_c[0]);
+        assert_int_equal (32767, iout_neon[0]);
+        ne10_corr_destroy_float32 (cfg);
+    }
+
+    /* float signals whose energies multiply past the single precision range, both ways */
+    for (loop = 0; loop < 2; loop++)
+    {
+        for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+        {
+            out_ref[i] = (loop == 0) ? 2147483648.0f : 1.0f / 1152921504606846976.0f;
+        }
+        for (method = 0; method < NUM_METHODS; method++)
+        {
+            cfg = ne10_corr_alloc_float32 (TEST_LENGTH_SAMPLES, TEST_LENGTH_SAMPLES, NE10_CORR_VALID, NE10_CORR_NORMALIZE | methods[method]);
+            assert_true (cfg != NULL);
+            ne10_correlate_float_c (cfg, out_c, out_ref, out_ref);
+            ne10_correlate_float_neon (cfg, out_neon, out_ref, out_ref);
+            assert_true (fabsf (out_c[0] - 1.0f) < 1.0e-3f);
+            assert_true (fabsf (out_neon[0] - 1.0f) < 1.0e-3f);
+            ne10_corr_destroy_float32 (cfg);
+        }
+    }
+
+    assert_true (ne10_corr_alloc_float32 (0, 16, NE10_CORR_FULL, 0) == NULL);
+    assert_true (ne10_corr_alloc_float32 (16, 16, 3, 0) == NULL);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint16_t k;
+    ne10_corr_cfg_float32_t cfg_direct, cfg_fft;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Correlation Lengths", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_PERF_TESTS; loop++)
+    {
+        config = &CONFIG_PERF[loop];
+        cfg = ne10_corr_alloc_float32 (config->srcALen, config->srcBLen, config->mode, config->flags);
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                ne10_correlate_float_c (cfg, out_c, testInputA_f32, testInputB_f32);
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                ne10_correlate_float_neon (cfg, out_neon, testInputA_f32, testInputB_f32);
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", config->srcBLen, time_c, time_neon, time_savings, time_speedup);
+        ne10_corr_destroy_float32 (cfg);
+    }
+
+    /* Direct against FFT with NEON, to tune NE10_CORR_FFT_COST_FACTOR */
+    fprintf (stdout, "%25s%20s%20s%20s\n", "Correlation Lengths", "Direct (micro-s)", "FFT (micro-s)", "Auto Uses FFT");
+    for (loop = 0; loop < NUM_PERF_TESTS; loop++)
+    {
+        config = &CONFIG_PERF[loop];
+        cfg = ne10_corr_alloc_float32 (config->srcALen, config->srcBLen, config->mode, config->flags);
+        cfg_direct = ne10_corr_alloc_float32 (config->srcALen, config->srcBLen, config->mode, config->flags | NE10_CORR_FORCE_DIRECT);
+        cfg_fft = ne10_corr_alloc_float32 (config->srcALen, config->srcBLen, config->mode, config->flags | NE10_CORR_FORCE_FFT);
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                ne10_correlate_float_neon (cfg_direct, out_neon, testInputA_f32, testInputB_f32);
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                ne10_correlate_float_neon (cfg_fft, out_neon, testInputA_f32, testInputB_f32);
+            }
+        }
+        );
+
+        fprintf (stdout, "%15d x%4d%20lld%20lld%20s\n", config->srcALen, config->srcBLen, time_c, time_neon, cfg->nfft ? "yes" : "no");
+        ne10_corr_destroy_float32 (cfg);
+        ne10_corr_destroy_float32 (cfg_direct);
+        ne10_corr_destroy_float32 (cfg_fft);
+    }
+#endif
+
+    free (guarded_out_c);
+    free (guarded_out_neon);
+    free (out_ref);
+    free (iout_c);
+    free (iout_neon);
+    free (iout_ref);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_autocorr_case0()
+{
+    ne10_corr_cfg_float32_t cfg;
+
+    ne10_uint16_t loop = 0;
+    ne10_uint16_t method = 0;
+    ne10_uint32_t k = 0;
+    ne10_uint32_t outLen;
+    ne10_float32_t scale;
+
+    test_config *config;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    NE10_DST_ALLOC (out_c, guarded_out_c, MAX_OUTPUT_LEN);
+    NE10_DST_ALLOC (out_neon, guarded_out_neon, MAX_OUTPUT_LEN);
+    out_ref = (ne10_float32_t*) malloc (MAX_OUTPUT_LEN * sizeof (ne10_float32_t));
+    iout_c = (ne10_int16_t*) malloc (MAX_OUTPUT_LEN * sizeof (ne10_int16_t));
+    iout_neon = (ne10_int16_t*) malloc (MAX_OUTPUT_LEN * sizeof (ne10_int16_t));
+    iout_ref = (ne10_int16_t*) malloc (MAX_OUTPUT_LEN * sizeof (ne10_int16_t));
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_AUTO_TESTS; loop++)
+    {
+        config = &CONFIG_AUTO[loop];
+        outLen = config->srcBLen + 1;
+
+        /* r[k] is the full cross-correlation of the signal with itself at lag k */
+        test_correlate_reference (out_ref, testInputA_f32, config->srcALen, testInputA_f32, config->srcALen,
+                                  config->srcALen - 1, outLen, 0);
+        test_correlate_reference_q15 (iout_ref, testInputA_i16, config->srcALen, testInputA_i16, config->srcALen,
+                                      config->srcALen - 1, outLen, config->flags);
+        if (config->flags & NE10_CORR_NORMALIZE)
+        {
+            scale = 1.0f / out_ref[0];
+            for (k = 0; k < outLen; k++)
+            {
+                out_ref[k] *= scale;
+            }
+        }
+
+        for (method = 0; method < NUM_METHODS; method++)
+        {
+            cfg = ne10_autocorr_alloc_float32 (config->srcALen, config->srcBLen, config->flags | methods[method]);
+            assert_true (cfg != NULL);
+
+            GUARD_ARRAY (out_c, MAX_OUTPUT_LEN);
+            GUARD_ARRAY (out_neon, MAX_OUTPUT_LEN);
+
+            ne10_autocorr_float_c (cfg, out_c, testInputA_f32);
+            ne10_autocorr_float_neon (cfg, out_neon, testInputA_f32);
+
+            assert_true (CHECK_ARRAY_GUARD (out_c, MAX_OUTPUT_LEN));
+            assert_true (CHECK_ARRAY_GUARD (out_neon, MAX_OUTPUT_LEN));
+
+            snr = CAL_SNR_FLOAT32 (out_ref, out_c, outLen);
+#if defined (DEBUG_TRACE)
+            printf ("--------------------config %d method %d nfft %d\n", loop, method, cfg->nfft);
+            printf ("snr ref/c %f\n", snr);
+#endif
+            assert_false ( (snr < SNR_THRESHOLD));
+            snr = CAL_SNR_FLOAT32 (out_ref, out_neon, outLen);
+#if defined (DEBUG_TRACE)
+            printf ("snr ref/neon %f\n", snr);
+#endif
+            assert_false ( (snr < SNR_THRESHOLD));
+
+            ne10_autocorr_int16_c (cfg, iout_c, testInputA_i16);
+            ne10_autocorr_int16_neon (cfg, iout_neon, testInputA_i16);
+            assert_true (test_correlate_check_q15 (iout_c, iout_ref, outLen, test_correlate_tolerance_q15 (cfg, config->flags)));
+            assert_true (test_correlate_check_q15 (iout_neon, iout_ref, outLen, test_correlate_tolerance_q15 (cfg, config->flags)));
+
+            ne10_corr_destroy_float32 (cfg);
+        }
+    }
+
+    assert_true (ne10_autocorr_alloc_float32 (16, 16, 0) == NULL);
+#endif
+
+    free (guarded_out_c);
+    free (guarded_out_neon);
+    free (out_ref);
+    free (iout_c);
+    free (iout_neon);
+    free (iout_ref);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_correlate()
+{
+    test_correlate_case0();
+    test_autocorr_case0();
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_correlate (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_correlate);          // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
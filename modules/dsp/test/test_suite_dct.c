@@ -0,0 +1,463 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_dct.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "NE10_dsp.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#define MAX_NFFT 1024
+#define TEST_BLOCKS 6
+#define TEST_LENGTH_SAMPLES (MAX_NFFT * (TEST_BLOCKS + 1))
+
+#define TEST_COUNT 1000
+#define TEST_BLOCK_COUNT 100000
+
+/* ----------------------------------------------------------------------
+** Defines each of the tests performed
+** ------------------------------------------------------------------- */
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static ne10_uint32_t CONFIG[] = {4, 8, 16, 32, 64, 256, 1024};
+#define NUM_TESTS (sizeof(CONFIG) / sizeof(CONFIG[0]) )
+#endif
+#ifdef PERFORMANCE_TEST
+static ne10_uint32_t CONFIG_PERF[] = {64, 256, 1024};
+#define NUM_PERF_TESTS (sizeof(CONFIG_PERF) / sizeof(CONFIG_PERF[0]) )
+#endif
+
+//input and output
+static ne10_float32_t testInput_f32[TEST_LENGTH_SAMPLES];
+static ne10_float32_t * guarded_out_c = NULL;
+static ne10_float32_t * guarded_out_neon = NULL;
+static ne10_float32_t * out_c = NULL;
+static ne10_float32_t * out_neon = NULL;
+static ne10_float32_t * out_ref = NULL;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static ne10_float32_t snr = 0.0f;
+#endif
+#ifdef PERFORMANCE_TEST
+static ne10_int64_t time_c = 0;
+static ne10_int64_t time_neon = 0;
+static ne10_float32_t time_speedup = 0.0f;
+static ne10_float32_t time_savings = 0.0f;
+#endif
+
+typedef void (*test_dct_func_t) (ne10_dct_cfg_float32_t, ne10_float32_t *, ne10_float32_t *);
+typedef void (*test_mdct_func_t) (ne10_mdct_cfg_float32_t, ne10_float32_t *, ne10_float32_t *);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+/* Direct double precision transforms: kind 2, 3 and 4 for the DCTs, 5 for the MDCT with the sine window */
+static void test_dct_ref (ne10_float32_t * pDst, const ne10_float32_t * pSrc, ne10_uint32_t nfft, ne10_int32_t kind)
+{
+    ne10_float64_t acc, arg;
+    ne10_uint32_t n, k, len = (kind == 5) ? 2 * nfft : nfft;
+
+    for (k = 0; k < nfft; k++)
+    {
+        acc = 0.0;
+        for (n = 0; n < len; n++)
+        {
+            switch (kind)
+            {
+            case 2:
+                arg = NE10_PI / nfft * (n + 0.5) * k;
+                acc += pSrc[n] * cos (arg);
+                break;
+            case 3:
+                /* k is the output sample, n the coefficient */
+                arg = NE10_PI / nfft * (k + 0.5) * n;
+                acc += ( (n == 0) ? 1.0 : 2.0) * pSrc[n] * cos (arg) / nfft;
+                break;
+            case 4:
+                arg = NE10_PI / nfft * (n + 0.5) * (k + 0.5);
+                acc += pSrc[n] * cos (arg);
+                break;
+            default:
+                arg = NE10_PI / nfft * (n + 0.5 + nfft / 2.0) * (k + 0.5);
+                acc += pSrc[n] * sin (NE10_PI * (n + 0.5) / (2.0 * nfft)) * cos (arg);
+                break;
+            }
+        }
+        pDst[k] = (ne10_float32_t) acc;
+    }
+}
+
+/* Direct double precision 2-D DCT-II of a size x size block */
+static void test_dct_block_ref (ne10_float64_t * pDst, const ne10_float64_t * pSrc, ne10_uint32_t size)
+{
+    ne10_float64_t acc, cu, cv;
+    ne10_uint32_t u, v, i, j;
+
+    for (u = 0; u < size; u++)
+    {
+        for (v = 0; v < size; v++)
+        {
+            cu = (u == 0) ? sqrt (1.0 / size) : sqrt (2.0 / size);
+            cv = (v == 0) ? sqrt (1.0 / size) : sqrt (2.0 / size);
+            acc = 0.0;
+            for (i = 0; i < size; i++)
+            {
+                for (j = 0; j < size; j++)
+                {
+                    acc += pSrc[i * size + j] * cos (NE10_PI * u * (2 * i + 1) / (2.0 * size)) * cos (NE10_PI * v * (2 * j + 1) / (2.0 * size));
+                }
+            }
+            pDst[u * size + v] = cu * cv * acc;
+        }
+    }
+}
+
+static void test_dct_check (test_dct_func_t func, ne10_dct_cfg_float32_t cfg, ne10_float32_t * pOut, ne10_int32_t kind)
+{
+    ne10_uint32_t nfft = cfg->nfft;
+
+    GUARD_ARRAY (pOut, nfft);
+    func (cfg, pOut, testInput_f32);
+    assert_true (CHECK_ARRAY_GUARD (pOut, nfft));
+    test_dct_ref (out_ref, testInput_f32, nfft, kind);
+    snr = CAL_SNR_FLOAT32 (out_ref, pOut, nfft);
+#if defined (DEBUG_TRACE)
+    printf ("dct%d nfft %d snr %f\n", kind, nfft, snr);
+#endif
+    assert_false ( (snr < SNR_THRESHOLD));
+}
+#endif
+
+/* Streams the input through the MDCT and the IMDCT, block by block */
+static void test_mdct_run (ne10_uint32_t nfft, test_mdct_func_t mdct, test_mdct_func_t imdct, ne10_float32_t * pOut)
+{
+    ne10_mdct_cfg_float32_t cfg = ne10_mdct_alloc_float32 (nfft, NULL);
+    ne10_mdct_cfg_float32_t icfg = ne10_mdct_alloc_float32 (nfft, NULL);
+    ne10_float32_t coeffs[MAX_NFFT];
+    ne10_uint32_t b;
+
+    for (b = 0; b < TEST_BLOCKS; b++)
+    {
+        mdct (cfg, coeffs, testInput_f32 + b * nfft);
+        imdct (icfg, pOut + b * nfft, coeffs);
+    }
+    ne10_mdct_destroy_float32 (cfg);
+    ne10_mdct_destroy_float32 (icfg);
+}
+
+void test_dct_case0()
+{
+    ne10_dct_cfg_float32_t cfg;
+    ne10_mdct_cfg_float32_t mcfg;
+
+    ne10_uint16_t loop = 0;
+    ne10_uint32_t i = 0;
+    ne10_uint32_t nfft;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        testInput_f32[i] = (ne10_float32_t) (drand48() * 2.0f - 1.0f);
+    }
+
+    /* init dst memory */
+    NE10_DST_ALLOC (out_c, guarded_out_c, TEST_LENGTH_SAMPLES);
+    NE10_DST_ALLOC (out_neon, guarded_out_neon, TEST_LENGTH_SAMPLES);
+    out_ref = (ne10_float32_t*) malloc (TEST_LENGTH_SAMPLES * sizeof (ne10_float32_t));
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_TESTS; loop++)
+    {
+        nfft = CONFIG[loop];
+        cfg = ne10_dct_alloc_float32 (nfft);
+        assert_true (cfg != NULL);
+
+        //conformance test 1: DCT-II, DCT-III and DCT-IV against the direct transforms
+        test_dct_check (ne10_dct2_float32_c, cfg, out_c, 2);
+        test_dct_check (ne10_dct2_float32_neon, cfg, out_neon, 2);
+        test_dct_check (ne10_dct3_float32_c, cfg, out_c, 3);
+        test_dct_check (ne10_dct3_float32_neon, cfg, out_neon, 3);
+        test_dct_check (ne10_dct4_float32_c, cfg, out_c, 4);
+        test_dct_check (ne10_dct4_float32_neon, cfg, out_neon, 4);
+
+        //conformance test 2: the DCT-III inverts the DCT-II in place
+        memcpy (out_c, testInput_f32, nfft * sizeof (ne10_float32_t));
+        memcpy (out_neon, testInput_f32, nfft * sizeof (ne10_float32_t));
+        ne10_dct2_float32_c (cfg, out_c, out_c);
+        ne10_dct3_float32_c (cfg, out_c, out_c);
+        ne10_dct2_float32_neon (cfg, out_neon, out_neon);
+        ne10_dct3_float32_neon (cfg, out_neon, out_neon);
+        snr = CAL_SNR_FLOAT32 (testInput_f32, out_c, nfft);
+        assert_false ( (snr < SNR_THRESHOLD));
+        snr = CAL_SNR_FLOAT32 (testInput_f32, out_neon, nfft);
+        assert_false ( (snr < SNR_THRESHOLD));
+        ne10_dct_destroy_float32 (cfg);
+
+        //conformance test 3: MDCT against the direct transform
+        mcfg = ne10_mdct_alloc_float32 (nfft, NULL);
+        assert_true (mcfg != NULL);
+        test_dct_ref (out_ref, testInput_f32, nfft, 5);
+        GUARD_ARRAY (out_c, nfft);
+        GUARD_ARRAY (out_neon, nfft);
+        ne10_mdct_float32_c (mcfg, out_c, testInput_f32);
+        ne10_mdct_float32_neon (mcfg, out_neon, testInput_f32);
+        assert_true (CHECK_ARRAY_GUARD (out_c, nfft));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, nfft));
+        snr = CAL_SNR_FLOAT32 (out_ref, out_c, nfft);
+        assert_false ( (snr < SNR_THRESHOLD));
+        snr = CAL_SNR_FLOAT32 (out_ref, out_neon, nfft);
+        assert_false ( (snr < SNR_THRESHOLD));
+        ne10_mdct_destroy_float32 (mcfg);
+
+        //conformance test 4: TDAC reconstruction, one block late
+        GUARD_ARRAY (out_c, TEST_BLOCKS * nfft);
+        GUARD_ARRAY (out_neon, TEST_BLOCKS * nfft);
+        test_mdct_run (nfft, ne10_mdct_float32_c, ne10_imdct_float32_c, out_c);
+        test_mdct_run (nfft, ne10_mdct_float32_neon, ne10_imdct_float32_neon, out_neon);
+        assert_true (CHECK_ARRAY_GUARD (out_c, TEST_BLOCKS * nfft));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, TEST_BLOCKS * nfft));
+        snr = CAL_SNR_FLOAT32 (testInput_f32 + nfft, out_c + nfft, (TEST_BLOCKS - 1) * nfft);
+#if defined (DEBUG_TRACE)
+        printf ("mdct nfft %d tdac snr c %f\n", nfft, snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+        snr = CAL_SNR_FLOAT32 (testInput_f32 + nfft, out_neon + nfft, (TEST_BLOCKS - 1) * nfft);
+        assert_false ( (snr < SNR_THRESHOLD));
+    }
+
+    /* invalid sizes are rejected */
+    assert_true (ne10_dct_alloc_float32 (2) == NULL);
+    assert_true (ne10_dct_alloc_float32 (48) == NULL);
+    assert_true (ne10_mdct_alloc_float32 (100, NULL) == NULL);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint16_t k;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "DCT Length", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_PERF_TESTS; loop++)
+    {
+        nfft = CONFIG_PERF[loop];
+        cfg = ne10_dct_alloc_float32 (nfft);
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                ne10_dct2_float32_c (cfg, out_c, testInput_f32);
+                ne10_dct4_float32_c (cfg, out_c, testInput_f32);
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                ne10_dct2_float32_neon (cfg, out_neon, testInput_f32);
+                ne10_dct4_float32_neon (cfg, out_neon, testInput_f32);
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", nfft, time_c, time_neon, time_savings, time_speedup);
+        ne10_dct_destroy_float32 (cfg);
+    }
+#endif
+
+    free (guarded_out_c);
+    free (guarded_out_neon);
+    free (out_ref);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+typedef void (*test_block_float32_func_t) (ne10_float32_t *, const ne10_float32_t *);
+typedef void (*test_block_int16_func_t) (ne10_int16_t *, const ne10_int16_t *);
+
+void test_dct_case1()
+{
+    static test_block_float32_func_t float32_funcs[2][4] =
+    {
+        {ne10_dct_8x8_float32_c, ne10_idct_8x8_float32_c, ne10_dct_4x4_float32_c, ne10_idct_4x4_float32_c},
+        {ne10_dct_8x8_float32_neon, ne10_idct_8x8_float32_neon, ne10_dct_4x4_float32_neon, ne10_idct_4x4_float32_neon}
+    };
+    static test_block_int16_func_t int16_funcs[2][4] =
+    {
+        {ne10_dct_8x8_int16_c, ne10_idct_8x8_int16_c, ne10_dct_4x4_int16_c, ne10_idct_4x4_int16_c},
+        {ne10_dct_8x8_int16_neon, ne10_idct_8x8_int16_neon, ne10_dct_4x4_int16_neon, ne10_idct_4x4_int16_neon}
+    };
+    ne10_float32_t block_f32[64], coeff_f32[2][64], back_f32[2][64];
+    ne10_int16_t block_i16[64], coeff_i16[2][64], back_i16[2][64];
+    ne10_float64_t block_f64[64], ref_f64[64];
+    ne10_float32_t ref_f32[64];
+    ne10_uint32_t size, len, s, i, v, loop;
+    ne10_int32_t maxerr;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < 100; loop++)
+    {
+        for (s = 0; s < 2; s++)
+        {
+            size = (s == 0) ? 8 : 4;
+            len = size * size;
+            for (i = 0; i < len; i++)
+            {
+                /* 10-bit samples, the largest the int16 transforms keep exact */
+                block_i16[i] = (ne10_int16_t) ( (ne10_int32_t) (drand48() * 2047.0) - 1023);
+                if (loop == 0)
+                {
+                    block_i16[i] = (i & 1) ? -1023 : 1023;
+                }
+                block_f32[i] = block_i16[i];
+                block_f64[i] = block_i16[i];
+            }
+            test_dct_block_ref (ref_f64, block_f64, size);
+            for (i = 0; i < len; i++)
+            {
+                ref_f32[i] = (ne10_float32_t) ref_f64[i];
+            }
+
+            for (v = 0; v < 2; v++)
+            {
+                //conformance test 1: float32 blocks against the direct transform, and the round trip
+                float32_funcs[v][2 * s] (coeff_f32[v], block_f32);
+                float32_funcs[v][2 * s + 1] (back_f32[v], coeff_f32[v]);
+                snr = CAL_SNR_FLOAT32 (ref_f32, coeff_f32[v], len);
+                assert_false ( (snr < SNR_THRESHOLD));
+                snr = CAL_SNR_FLOAT32 (block_f32, back_f32[v], len);
+                assert_false ( (snr < SNR_THRESHOLD));
+
+                //conformance test 2: int16 blocks within one of the rounded transform and of the input
+                int16_funcs[v][2 * s] (coeff_i16[v], block_i16);
+                int16_funcs[v][2 * s + 1] (back_i16[v], coeff_i16[v]);
+                maxerr = 0;
+                for (i = 0; i < len; i++)
+                {
+                    maxerr = NE10_MAX (maxerr, abs (coeff_i16[v][i] - (ne10_int32_t) floor (ref_f64[i] + 0.5)));
+                    maxerr = NE10_MAX (maxerr, abs (back_i16[v][i] - block_i16[i]));
+                }
+#if defined (DEBUG_TRACE)
+                if (loop == 0)
+                {
+                    printf ("block %dx%d %s int16 max error %d\n", size, size, v ? "neon" : "c", maxerr);
+                }
+#endif
+                assert_true (maxerr <= 1);
+            }
+            /* the NEON int16 transforms are bit exact with the C ones */
+            assert_true (memcmp (coeff_i16[0], coeff_i16[1], len * sizeof (ne10_int16_t)) == 0);
+            assert_true (memcmp (back_i16[0], back_i16[1], len * sizeof (ne10_int16_t)) == 0);
+
+            /* in place */
+            memcpy (back_f32[0], block_f32, len * sizeof (ne10_float32_t));
+            float32_funcs[1][2 * s] (back_f32[0], back_f32[0]);
+            assert_true (memcmp (back_f32[0], coeff_f32[1], len * sizeof (ne10_float32_t)) == 0);
+        }
+    }
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "DCT Block Size", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (s = 0; s < 2; s++)
+    {
+        size = (s == 0) ? 8 : 4;
+        for (i = 0; i < 64; i++)
+        {
+            block_f32[i] = (ne10_float32_t) (drand48() * 255.0);
+            block_i16[i] = (ne10_int16_t) block_f32[i];
+        }
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (loop = 0; loop < TEST_BLOCK_COUNT; loop++)
+            {
+                float32_funcs[0][2 * s] (coeff_f32[0], block_f32);
+                int16_funcs[0][2 * s] (coeff_i16[0], block_i16);
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (loop = 0; loop < TEST_BLOCK_COUNT; loop++)
+            {
+                float32_funcs[1][2 * s] (coeff_f32[1], block_f32);
+                int16_funcs[1][2 * s] (coeff_i16[1], block_i16);
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", size, time_c, time_neon, time_savings, time_speedup);
+    }
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_dct()
+{
+    test_dct_case0();
+    test_dct_case1();
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_dct (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_dct);                // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
@@ -175,6 +175,87 @@ void test_fft_c2c_1d_float32_conformance()
     }
 }
 
+/* counts the live blocks handed out by the allocator installed in the test below */
+static void * test_counting_malloc (ne10_uint32_t size, void * ctx)
+{
+    (* (ne10_int32_t*) ctx)++;
+    return malloc (size);
+}
+
+static void test_counting_free (void * ptr, void * ctx)
+{
+    (* (ne10_int32_t*) ctx)--;
+    free (ptr);
+}
+
+void test_fft_c2c_1d_float32_inplace()
+{
+    ne10_int32_t fftSize = 0;
+    ne10_int32_t flag_result = NE10_OK;
+    ne10_int32_t live = 0;
+    ne10_uint32_t mem_size;
+    void *mem_c, *mem_neon;
+    ne10_fft_cfg_float32_t inplace_c, inplace_neon;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    for (fftSize = MIN_LENGTH_SAMPLES_CPX; fftSize <= 4096; fftSize *= 4)
+    {
+        fprintf (stdout, "FFT size %d\n", fftSize);
+        flag_result = test_c2c_alloc (fftSize);
+        if (flag_result == NE10_ERR)
+        {
+            return;
+        }
+
+        mem_size = ne10_fft_alloc_c2c_float32_size (fftSize);
+        mem_c = NE10_MALLOC (mem_size);
+        mem_neon = NE10_MALLOC (mem_size);
+
+        // a buffer smaller than the queried size is rejected
+        assert_true (ne10_fft_alloc_c2c_float32_inplace_c (NULL, mem_size, fftSize) == NULL);
+        assert_true (ne10_fft_alloc_c2c_float32_inplace_c (mem_c, mem_size - 1, fftSize) == NULL);
+        assert_true (ne10_fft_alloc_c2c_float32_inplace_neon (mem_neon, mem_size - 1, fftSize) == NULL);
+
+        inplace_c = ne10_fft_alloc_c2c_float32_inplace_c (mem_c, mem_size, fftSize);
+        inplace_neon = ne10_fft_alloc_c2c_float32_inplace_neon (mem_neon, mem_size, fftSize);
+        assert_true ( (void*) inplace_c == mem_c);
+        assert_true ( (void*) inplace_neon == mem_neon);
+
+        // a configuration built in place gives the same result as an allocated one
+        memcpy (in_c, testInput_f32, 2 * fftSize * sizeof (ne10_float32_t));
+        ne10_fft_c2c_1d_float32_c ( (ne10_fft_cpx_float32_t*) out_c, (ne10_fft_cpx_float32_t*) in_c, cfg_c, 0);
+        memcpy (in_neon, testInput_f32, 2 * fftSize * sizeof (ne10_float32_t));
+        ne10_fft_c2c_1d_float32_c ( (ne10_fft_cpx_float32_t*) out_neon, (ne10_fft_cpx_float32_t*) in_neon, inplace_c, 0);
+        assert_true (memcmp (out_c, out_neon, 2 * fftSize * sizeof (ne10_float32_t)) == 0);
+
+        memcpy (in_c, testInput_f32, 2 * fftSize * sizeof (ne10_float32_t));
+        ne10_fft_c2c_1d_float32_neon ( (ne10_fft_cpx_float32_t*) out_c, (ne10_fft_cpx_float32_t*) in_c, cfg_neon, 0);
+        memcpy (in_neon, testInput_f32, 2 * fftSize * sizeof (ne10_float32_t));
+        ne10_fft_c2c_1d_float32_neon ( (ne10_fft_cpx_float32_t*) out_neon, (ne10_fft_cpx_float32_t*) in_neon, inplace_neon, 0);
+        assert_true (memcmp (out_c, out_neon, 2 * fftSize * sizeof (ne10_float32_t)) == 0);
+
+        NE10_FREE (mem_c);
+        NE10_FREE (mem_neon);
+        NE10_FREE (cfg_c);
+        NE10_FREE (cfg_neon);
+    }
+
+    // both hooks must be given together
+    assert_int_equal (NE10_ERR, ne10_set_allocator (test_counting_malloc, NULL, &live));
+    assert_int_equal (NE10_ERR, ne10_set_allocator (NULL, test_counting_free, &live));
+
+    // allocation and destruction both go through the installed hooks
+    assert_int_equal (NE10_OK, ne10_set_allocator (test_counting_malloc, test_counting_free, &live));
+    inplace_c = ne10_fft_alloc_c2c_float32_c (1024);
+    inplace_neon = ne10_fft_alloc_c2c_float32_neon (1024);
+    assert_int_equal (2, live);
+    ne10_fft_destroy_c2c_float32 (inplace_c);
+    ne10_fft_destroy_c2c_float32 (inplace_neon);
+    assert_int_equal (0, live);
+    assert_int_equal (NE10_OK, ne10_set_allocator (NULL, NULL, NULL));
+}
+
 void test_fft_c2c_1d_float32_performance()
 {
     ne10_int32_t i = 0;
@@ -439,6 +520,7 @@ void test_fft_c2c_1d_float32()
 {
 #if defined (SMOKE_TEST)||(REGRESSION_TEST)
     test_fft_c2c_1d_float32_conformance();
+    test_fft_c2c_1d_float32_inplace();
 #endif
 
 #if defined (PERFORMANCE_TEST)
@@ -0,0 +1,418 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_fir_halfband.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "NE10_dsp.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#define TEST_LENGTH_SAMPLES 1536
+#define MAX_OUTPUT_SAMPLES (16 * TEST_LENGTH_SAMPLES)
+#define MAX_HALFBAND_TAPS 63
+#define MAX_NUMTAPS 96
+#define SNR_THRESHOLD_HALFBAND 100.0f
+
+#define TEST_COUNT 200
+
+/* ----------------------------------------------------------------------
+** Defines each of the tests performed
+** ------------------------------------------------------------------- */
+typedef struct
+{
+    ne10_uint16_t numHalfbands;
+    ne10_uint16_t halfbandTaps;
+    ne10_uint8_t factor;
+    ne10_uint16_t numTaps;
+    ne10_uint32_t blockSize;
+} test_config;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static test_config CONFIG[] =
+{
+    {1, 3, 1, 1, 2},
+    {1, 7, 2, 8, 16},
+    {2, 11, 3, 24, 48},
+    {3, 23, 2, 32, 64},
+    {3, 63, 1, 9, 256},
+    {0, 3, 4, 32, 32}
+};
+#define NUM_TESTS (sizeof(CONFIG) / sizeof(CONFIG[0]) )
+#endif
+#ifdef PERFORMANCE_TEST
+static test_config CONFIG_PERF[] =
+{
+    {1, 23, 1, 1, 256},
+    {1, 63, 1, 1, 256},
+    {3, 31, 1, 1, 256}
+};
+#define NUM_PERF_TESTS (sizeof(CONFIG_PERF) / sizeof(CONFIG_PERF[0]) )
+#endif
+
+static ne10_float32_t testInput_f32[TEST_LENGTH_SAMPLES];
+static ne10_float32_t testHalfband_f32[MAX_HALFBAND_TAPS];
+static ne10_float32_t testHalfbandPadded_f32[MAX_HALFBAND_TAPS + 1];
+static ne10_float32_t testCoeffs_f32[MAX_NUMTAPS];
+static ne10_float32_t * guarded_out_c = NULL;
+static ne10_float32_t * guarded_out_neon = NULL;
+static ne10_float32_t * out_c = NULL;
+static ne10_float32_t * out_neon = NULL;
+static ne10_float32_t * out_ref = NULL;
+static ne10_float32_t * buf_ref = NULL;
+static ne10_float32_t * state_c = NULL;
+static ne10_float32_t * state_neon = NULL;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static ne10_float32_t snr = 0.0f;
+#endif
+#ifdef PERFORMANCE_TEST
+static ne10_int64_t time_c = 0;
+static ne10_int64_t time_neon = 0;
+static ne10_float32_t time_speedup = 0.0f;
+static ne10_float32_t time_savings = 0.0f;
+#endif
+
+/* Windowed sinc halfband design, with exact zeros at even distances from the center */
+static void test_halfband_design (ne10_uint16_t numTaps)
+{
+    ne10_int32_t c = numTaps >> 1;
+    ne10_int32_t i, d;
+    ne10_float64_t w;
+
+    for (i = 0; i < numTaps; i++)
+    {
+        d = i - c;
+        w = 0.54 - 0.46 * cos (2.0 * NE10_PI * (i + 1) / (numTaps + 1));
+        if (d == 0)
+        {
+            testHalfband_f32[i] = 0.5f;
+        }
+        else if ( (d & 1) == 0)
+        {
+            testHalfband_f32[i] = 0.0f;
+        }
+        else
+        {
+            testHalfband_f32[i] = (ne10_float32_t) (w * sin (NE10_PI * d / 2.0) / (NE10_PI * d));
+        }
+        testHalfbandPadded_f32[i + 1] = testHalfband_f32[i];
+    }
+    /* zero tap b[numTaps], first in time reversed order, so that ne10_fir_interpolate_float_c accepts L = 2 */
+    testHalfbandPadded_f32[0] = 0.0f;
+}
+
+/* Chains one general FIR decimator (M = 2) per halfband stage, then the final FIR stage */
+static ne10_uint32_t test_cascade_decimate_reference (test_config * config, ne10_float32_t * pDst)
+{
+    ne10_fir_decimate_instance_f32_t S;
+    ne10_float32_t *pIn = testInput_f32;
+    ne10_float32_t *pOut;
+    ne10_uint32_t len = TEST_LENGTH_SAMPLES;
+    ne10_uint32_t stage;
+
+    for (stage = 0; stage < config->numHalfbands; stage++)
+    {
+        pOut = buf_ref + (stage & 0x1u) * TEST_LENGTH_SAMPLES;
+        ne10_fir_decimate_init_float (&S, config->halfbandTaps, 2, testHalfband_f32, state_c, len);
+        ne10_fir_decimate_float_c (&S, pIn, pOut, len);
+        len >>= 1;
+        pIn = pOut;
+    }
+    ne10_fir_decimate_init_float (&S, config->numTaps, config->factor, testCoeffs_f32, state_c, len);
+    ne10_fir_decimate_float_c (&S, pIn, pDst, len);
+    return len / config->factor;
+}
+
+/* The final FIR interpolator, then one general FIR interpolator (L = 2) per halfband stage */
+static ne10_uint32_t test_cascade_interpolate_reference (test_config * config, ne10_float32_t * pDst)
+{
+    ne10_fir_interpolate_instance_f32_t S;
+    ne10_float32_t *pIn = testInput_f32;
+    ne10_float32_t *pOut;
+    ne10_uint32_t len = TEST_LENGTH_SAMPLES;
+    ne10_uint32_t stage;
+
+    pOut = (config->numHalfbands > 0) ? buf_ref : pDst;
+    ne10_fir_interpolate_init_float (&S, config->factor, config->numTaps, testCoeffs_f32, state_c, len);
+    ne10_fir_interpolate_float_c (&S, pIn, pOut, len);
+    len *= config->factor;
+    pIn = pOut;
+    for (stage = 0; stage < config->numHalfbands; stage++)
+    {
+        pOut = (stage + 1u == config->numHalfbands) ? pDst : buf_ref + ( (stage + 1u) & 0x1u) * (MAX_OUTPUT_SAMPLES / 2);
+        ne10_fir_interpolate_init_float (&S, 2, config->halfbandTaps + 1, testHalfbandPadded_f32, state_c, len);
+        ne10_fir_interpolate_float_c (&S, pIn, pOut, len);
+        len <<= 1;
+        pIn = pOut;
+    }
+    return len;
+}
+
+static ne10_uint32_t test_cascade_run (ne10_uint32_t (*func) (ne10_fir_cascade_cfg_f32_t, ne10_float32_t *, ne10_float32_t *, ne10_uint32_t),
+                                       ne10_fir_cascade_cfg_f32_t cfg,
+                                       ne10_uint32_t blockSize,
+                                       ne10_float32_t * pDst)
+{
+    ne10_uint32_t pos, outCnt = 0;
+
+    for (pos = 0; pos < TEST_LENGTH_SAMPLES; pos += blockSize)
+    {
+        outCnt += func (cfg, testInput_f32 + pos, pDst + outCnt, blockSize);
+    }
+    return outCnt;
+}
+
+void test_fir_halfband_case0()
+{
+    ne10_fir_halfband_instance_f32_t SC, SN;
+    ne10_fir_decimate_instance_f32_t SD;
+    ne10_fir_interpolate_instance_f32_t SI;
+    ne10_fir_cascade_cfg_f32_t cfg_c, cfg_neon;
+    ne10_uint16_t loop = 0;
+    ne10_uint32_t i = 0, pos = 0;
+    ne10_uint32_t cnt_c, cnt_neon, cnt_ref;
+    test_config *config;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        testInput_f32[i] = (ne10_float32_t) (drand48() * 2.0f - 1.0f);
+    }
+    for (i = 0; i < MAX_NUMTAPS; i++)
+    {
+        testCoeffs_f32[i] = (ne10_float32_t) (drand48() * 2.0f - 1.0f);
+    }
+
+    NE10_DST_ALLOC (out_c, guarded_out_c, MAX_OUTPUT_SAMPLES);
+    NE10_DST_ALLOC (out_neon, guarded_out_neon, MAX_OUTPUT_SAMPLES);
+    out_ref = (ne10_float32_t*) malloc (MAX_OUTPUT_SAMPLES * sizeof (ne10_float32_t));
+    buf_ref = (ne10_float32_t*) malloc (MAX_OUTPUT_SAMPLES * sizeof (ne10_float32_t));
+    state_c = (ne10_float32_t*) malloc ( (MAX_NUMTAPS + MAX_OUTPUT_SAMPLES) * sizeof (ne10_float32_t));
+    state_neon = (ne10_float32_t*) malloc ( (MAX_NUMTAPS + MAX_OUTPUT_SAMPLES) * sizeof (ne10_float32_t));
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_TESTS; loop++)
+    {
+        config = &CONFIG[loop];
+        test_halfband_design (config->halfbandTaps);
+
+        //conformance test 1: halfband decimator against the general decimator with M = 2
+        assert_int_equal (NE10_OK, ne10_fir_halfband_decimate_init_float (&SC, config->halfbandTaps, testHalfband_f32, state_c, config->blockSize));
+        assert_int_equal (NE10_OK, ne10_fir_halfband_decimate_init_float (&SN, config->halfbandTaps, testHalfband_f32, state_neon, config->blockSize));
+        ne10_fir_decimate_init_float (&SD, config->halfbandTaps, 2, testHalfband_f32, buf_ref, config->blockSize);
+
+        GUARD_ARRAY (out_c, MAX_OUTPUT_SAMPLES);
+        GUARD_ARRAY (out_neon, MAX_OUTPUT_SAMPLES);
+        for (pos = 0; pos < TEST_LENGTH_SAMPLES; pos += config->blockSize)
+        {
+            ne10_fir_halfband_decimate_float_c (&SC, testInput_f32 + pos, out_c + pos / 2, config->blockSize);
+            ne10_fir_halfband_decimate_float_neon (&SN, testInput_f32 + pos, out_neon + pos / 2, config->blockSize);
+            ne10_fir_decimate_float_c (&SD, testInput_f32 + pos, out_ref + pos / 2, config->blockSize);
+        }
+        assert_true (CHECK_ARRAY_GUARD (out_c, MAX_OUTPUT_SAMPLES));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, MAX_OUTPUT_SAMPLES));
+
+        snr = CAL_SNR_FLOAT32 (out_ref, out_c, TEST_LENGTH_SAMPLES / 2);
+#if defined (DEBUG_TRACE)
+        printf ("--------------------config %d\n", loop);
+        printf ("decimate snr ref/c %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD_HALFBAND));
+        snr = CAL_SNR_FLOAT32 (out_ref, out_neon, TEST_LENGTH_SAMPLES / 2);
+        assert_false ( (snr < SNR_THRESHOLD_HALFBAND));
+
+        //conformance test 2: halfband interpolator against the general interpolator with L = 2
+        assert_int_equal (NE10_OK, ne10_fir_halfband_interpolate_init_float (&SC, config->halfbandTaps, testHalfband_f32, state_c, config->blockSize));
+        assert_int_equal (NE10_OK, ne10_fir_halfband_interpolate_init_float (&SN, config->halfbandTaps, testHalfband_f32, state_neon, config->blockSize));
+        ne10_fir_interpolate_init_float (&SI, 2, config->halfbandTaps + 1, testHalfbandPadded_f32, buf_ref, config->blockSize);
+
+        for (pos = 0; pos < TEST_LENGTH_SAMPLES; pos += config->blockSize)
+        {
+            ne10_fir_halfband_interpolate_float_c (&SC, testInput_f32 + pos, out_c + 2 * pos, config->blockSize);
+            ne10_fir_halfband_interpolate_float_neon (&SN, testInput_f32 + pos, out_neon + 2 * pos, config->blockSize);
+            ne10_fir_interpolate_float_c (&SI, testInput_f32 + pos, out_ref + 2 * pos, config->blockSize);
+        }
+        assert_true (CHECK_ARRAY_GUARD (out_c, MAX_OUTPUT_SAMPLES));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, MAX_OUTPUT_SAMPLES));
+
+        snr = CAL_SNR_FLOAT32 (out_ref, out_c, 2 * TEST_LENGTH_SAMPLES);
+#if defined (DEBUG_TRACE)
+        printf ("interpolate snr ref/c %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD_HALFBAND));
+        snr = CAL_SNR_FLOAT32 (out_ref, out_neon, 2 * TEST_LENGTH_SAMPLES);
+        assert_false ( (snr < SNR_THRESHOLD_HALFBAND));
+
+        //conformance test 3: multi-stage decimator against the chained general decimators
+        cfg_c = ne10_fir_decimate_cascade_alloc_float (config->numHalfbands, config->halfbandTaps, testHalfband_f32,
+                config->factor, config->numTaps, testCoeffs_f32, TEST_LENGTH_SAMPLES);
+        cfg_neon = ne10_fir_decimate_cascade_alloc_float (config->numHalfbands, config->halfbandTaps, testHalfband_f32,
+                   config->factor, config->numTaps, testCoeffs_f32, TEST_LENGTH_SAMPLES);
+        assert_true ( (cfg_c != NULL) && (cfg_neon != NULL));
+
+        cnt_ref = test_cascade_decimate_reference (config, out_ref);
+        cnt_c = test_cascade_run (ne10_fir_cascade_float_c, cfg_c, cfg_c->factor * 4, out_c);
+        cnt_neon = test_cascade_run (ne10_fir_cascade_float_neon, cfg_neon, cfg_neon->factor * 4, out_neon);
+        assert_true (CHECK_ARRAY_GUARD (out_c, MAX_OUTPUT_SAMPLES));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, MAX_OUTPUT_SAMPLES));
+        assert_int_equal (cnt_ref, cnt_c);
+        assert_int_equal (cnt_ref, cnt_neon);
+
+        snr = CAL_SNR_FLOAT32 (out_ref, out_c, cnt_ref);
+#if defined (DEBUG_TRACE)
+        printf ("decimate cascade snr ref/c %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD_HALFBAND));
+        snr = CAL_SNR_FLOAT32 (out_ref, out_neon, cnt_ref);
+        assert_false ( (snr < SNR_THRESHOLD_HALFBAND));
+        ne10_fir_cascade_destroy_float (cfg_c);
+        ne10_fir_cascade_destroy_float (cfg_neon);
+
+        //conformance test 4: multi-stage interpolator against the chained general interpolators
+        if ( (config->numTaps % config->factor) == 0)
+        {
+            cfg_c = ne10_fir_interpolate_cascade_alloc_float (config->numHalfbands, config->halfbandTaps, testHalfband_f32,
+                    config->factor, config->numTaps, testCoeffs_f32, config->blockSize);
+            cfg_neon = ne10_fir_interpolate_cascade_alloc_float (config->numHalfbands, config->halfbandTaps, testHalfband_f32,
+                       config->factor, config->numTaps, testCoeffs_f32, config->blockSize);
+            assert_true ( (cfg_c != NULL) && (cfg_neon != NULL));
+
+            cnt_ref = test_cascade_interpolate_reference (config, out_ref);
+            cnt_c = test_cascade_run (ne10_fir_cascade_float_c, cfg_c, config->blockSize, out_c);
+            cnt_neon = test_cascade_run (ne10_fir_cascade_float_neon, cfg_neon, config->blockSize, out_neon);
+            assert_true (CHECK_ARRAY_GUARD (out_c, MAX_OUTPUT_SAMPLES));
+            assert_true (CHECK_ARRAY_GUARD (out_neon, MAX_OUTPUT_SAMPLES));
+            assert_int_equal (cnt_ref, cnt_c);
+            assert_int_equal (cnt_ref, cnt_neon);
+
+            snr = CAL_SNR_FLOAT32 (out_ref, out_c, cnt_ref);
+#if defined (DEBUG_TRACE)
+            printf ("interpolate cascade snr ref/c %f\n", snr);
+#endif
+            assert_false ( (snr < SNR_THRESHOLD_HALFBAND));
+            snr = CAL_SNR_FLOAT32 (out_ref, out_neon, cnt_ref);
+            assert_false ( (snr < SNR_THRESHOLD_HALFBAND));
+            ne10_fir_cascade_destroy_float (cfg_c);
+            ne10_fir_cascade_destroy_float (cfg_neon);
+        }
+    }
+
+    /* the halfband length must be 4*K-1 and the decimator block size even */
+    assert_int_equal (NE10_ERR, ne10_fir_halfband_decimate_init_float (&SC, 9, testHalfband_f32, state_c, 16));
+    assert_int_equal (NE10_ERR, ne10_fir_halfband_decimate_init_float (&SC, 7, testHalfband_f32, state_c, 15));
+    assert_int_equal (NE10_ERR, ne10_fir_halfband_interpolate_init_float (&SC, 5, testHalfband_f32, state_c, 16));
+    assert_true (ne10_fir_decimate_cascade_alloc_float (2, 7, testHalfband_f32, 3, 9, testCoeffs_f32, 30) == NULL);
+    /* the total factor and the interpolated block size must fit in 32 bits */
+    assert_true (ne10_fir_decimate_cascade_alloc_float (30, 7, testHalfband_f32, 4, 9, testCoeffs_f32, 64) == NULL);
+    assert_true (ne10_fir_interpolate_cascade_alloc_float (30, 7, testHalfband_f32, 4, 8, testCoeffs_f32, 1) == NULL);
+    assert_true (ne10_fir_interpolate_cascade_alloc_float (20, 7, testHalfband_f32, 4, 8, testCoeffs_f32, 1024) == NULL);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint16_t k;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Halfband Taps", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_PERF_TESTS; loop++)
+    {
+        config = &CONFIG_PERF[loop];
+        test_halfband_design (config->halfbandTaps);
+
+        cfg_c = ne10_fir_decimate_cascade_alloc_float (config->numHalfbands, config->halfbandTaps, testHalfband_f32,
+                config->factor, config->numTaps, testCoeffs_f32, config->blockSize);
+        cfg_neon = ne10_fir_decimate_cascade_alloc_float (config->numHalfbands, config->halfbandTaps, testHalfband_f32,
+                   config->factor, config->numTaps, testCoeffs_f32, config->blockSize);
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                test_cascade_run (ne10_fir_cascade_float_c, cfg_c, config->blockSize, out_c);
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                test_cascade_run (ne10_fir_cascade_float_neon, cfg_neon, config->blockSize, out_neon);
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", config->halfbandTaps, time_c, time_neon, time_savings, time_speedup);
+
+        ne10_fir_cascade_destroy_float (cfg_c);
+        ne10_fir_cascade_destroy_float (cfg_neon);
+    }
+#endif
+
+    free (guarded_out_c);
+    free (guarded_out_neon);
+    free (out_ref);
+    free (buf_ref);
+    free (state_c);
+    free (state_neon);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_fir_halfband()
+{
+    test_fir_halfband_case0();
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_fir_halfband (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_fir_halfband);       // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
@@ -359,9 +359,215 @@ void test_fir_sparse_case0()
     fprintf (stdout, "----------%30s end\n", __FUNCTION__);
 }
 
+/* ----------------------------------------------------------------------
+** Sparse filter with a linear delay line, checked against ne10_fir_sparse_float_c
+** ------------------------------------------------------------------- */
+#define LINEAR_TEST_LENGTH 4096
+#define LINEAR_MAX_TAPS 1024
+#define LINEAR_MAX_DELAY 3000
+#define LINEAR_MAX_BLOCKSIZE 256
+
+typedef struct
+{
+    ne10_uint32_t blockSize;
+    ne10_uint16_t numTaps;
+    ne10_uint32_t maxDelay;
+} test_linear_config;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static test_linear_config CONFIG_LINEAR[] =
+{
+    {1, 5, 100},
+    {7, 3, 20},
+    {64, 37, 64},
+    {256, 1000, 3000},
+    {100, 1024, 2500}
+};
+#define NUM_LINEAR_TESTS (sizeof(CONFIG_LINEAR) / sizeof(CONFIG_LINEAR[0]) )
+#endif
+#ifdef PERFORMANCE_TEST
+static test_linear_config CONFIG_LINEAR_PERF[] =
+{
+    {64, 64, 1000},
+    {256, 1000, 3000}
+};
+#define NUM_LINEAR_PERF_TESTS (sizeof(CONFIG_LINEAR_PERF) / sizeof(CONFIG_LINEAR_PERF[0]) )
+#endif
+
+void test_fir_sparse_linear_case0()
+{
+    ne10_fir_sparse_instance_f32_t SR;
+    ne10_fir_sparse_linear_instance_f32_t SC, SN;
+    test_linear_config *config;
+    ne10_float32_t *input, *out_ref, *state_ref, *scratch_ref;
+    ne10_float32_t *coeffs, *sorted_coeffs;
+    ne10_int32_t *delays, *sorted_delays;
+    ne10_uint32_t i, pos, loop, length;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    input = (ne10_float32_t*) malloc (LINEAR_TEST_LENGTH * sizeof (ne10_float32_t));
+    out_ref = (ne10_float32_t*) malloc (LINEAR_TEST_LENGTH * sizeof (ne10_float32_t));
+    state_ref = (ne10_float32_t*) malloc ( (LINEAR_MAX_DELAY + LINEAR_MAX_BLOCKSIZE) * sizeof (ne10_float32_t));
+    scratch_ref = (ne10_float32_t*) malloc (LINEAR_MAX_BLOCKSIZE * sizeof (ne10_float32_t));
+    /* ne10_fir_sparse_float_c reads one coefficient and one delay past the last tap */
+    coeffs = (ne10_float32_t*) calloc (LINEAR_MAX_TAPS + 1, sizeof (ne10_float32_t));
+    sorted_coeffs = (ne10_float32_t*) malloc (LINEAR_MAX_TAPS * sizeof (ne10_float32_t));
+    delays = (ne10_int32_t*) calloc (LINEAR_MAX_TAPS + 1, sizeof (ne10_int32_t));
+    sorted_delays = (ne10_int32_t*) malloc (LINEAR_MAX_TAPS * sizeof (ne10_int32_t));
+
+    NE10_DST_ALLOC (out_c, guarded_out_c, LINEAR_TEST_LENGTH);
+    NE10_DST_ALLOC (out_neon, guarded_out_neon, LINEAR_TEST_LENGTH);
+    NE10_DST_ALLOC (fir_state_c, guarded_fir_state_c, LINEAR_MAX_DELAY + 2 * LINEAR_MAX_BLOCKSIZE);
+    NE10_DST_ALLOC (fir_state_neon, guarded_fir_state_neon, LINEAR_MAX_DELAY + 2 * LINEAR_MAX_BLOCKSIZE);
+
+    for (i = 0; i < LINEAR_TEST_LENGTH; i++)
+    {
+        input[i] = (ne10_float32_t) (drand48() * 2.0f - 1.0f);
+    }
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_LINEAR_TESTS; loop++)
+    {
+        config = &CONFIG_LINEAR[loop];
+
+        /* unsorted taps, including the largest delay and repeated delays */
+        for (i = 0; i < config->numTaps; i++)
+        {
+            coeffs[i] = (ne10_float32_t) (drand48() * 2.0f - 1.0f) / config->numTaps;
+            delays[i] = (ne10_int32_t) (drand48() * (config->maxDelay + 1));
+            if (delays[i] > (ne10_int32_t) config->maxDelay)
+            {
+                delays[i] = config->maxDelay;
+            }
+        }
+        delays[0] = config->maxDelay;
+        if (config->numTaps > 2)
+        {
+            delays[2] = delays[1];
+        }
+
+        ne10_fir_sparse_init_float (&SR, config->numTaps, coeffs, state_ref, delays, config->maxDelay, config->blockSize);
+        assert_int_equal (NE10_OK, ne10_fir_sparse_linear_init_float (&SC, config->numTaps, coeffs, delays,
+                          sorted_coeffs, sorted_delays, fir_state_c, config->maxDelay, config->blockSize));
+        assert_int_equal (NE10_OK, ne10_fir_sparse_linear_init_float (&SN, config->numTaps, coeffs, delays,
+                          sorted_coeffs, sorted_delays, fir_state_neon, config->maxDelay, config->blockSize));
+        for (i = 1; i < config->numTaps; i++)
+        {
+            assert_true (sorted_delays[i - 1] <= sorted_delays[i]);
+        }
+
+        GUARD_ARRAY (out_c, LINEAR_TEST_LENGTH);
+        GUARD_ARRAY (out_neon, LINEAR_TEST_LENGTH);
+        GUARD_ARRAY (fir_state_c, LINEAR_MAX_DELAY + 2 * LINEAR_MAX_BLOCKSIZE);
+
+        /* the circular buffer of the reference depends on the block size, so it only sees full blocks */
+        length = LINEAR_TEST_LENGTH - LINEAR_TEST_LENGTH % config->blockSize;
+        for (pos = 0; pos < length; pos += config->blockSize)
+        {
+            ne10_fir_sparse_float_c (&SR, input + pos, out_ref + pos, scratch_ref, config->blockSize);
+        }
+
+        /* the last block is shorter than the initialized blockSize */
+        for (pos = 0; pos < LINEAR_TEST_LENGTH; pos += config->blockSize)
+        {
+            ne10_uint32_t len = NE10_MIN (config->blockSize, LINEAR_TEST_LENGTH - pos);
+            ne10_fir_sparse_linear_float_c (&SC, input + pos, out_c + pos, len);
+            ne10_fir_sparse_linear_float_neon (&SN, input + pos, out_neon + pos, len);
+        }
+
+        assert_true (CHECK_ARRAY_GUARD (out_c, LINEAR_TEST_LENGTH));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, LINEAR_TEST_LENGTH));
+        assert_true (CHECK_ARRAY_GUARD (fir_state_c, LINEAR_MAX_DELAY + 2 * LINEAR_MAX_BLOCKSIZE));
+
+        snr = CAL_SNR_FLOAT32 (out_ref, out_c, length);
+#if defined (DEBUG_TRACE)
+        printf ("--------------------config %d\n", loop);
+        printf ("snr ref/c %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+        snr = CAL_SNR_FLOAT32 (out_c, out_neon, LINEAR_TEST_LENGTH);
+#if defined (DEBUG_TRACE)
+        printf ("snr c/neon %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+    }
+
+    delays[0] = 101;
+    assert_int_equal (NE10_ERR, ne10_fir_sparse_linear_init_float (&SC, 1, coeffs, delays,
+                      sorted_coeffs, sorted_delays, fir_state_c, 100, 16));
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint16_t k;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "FIR Length&Taps", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_LINEAR_PERF_TESTS; loop++)
+    {
+        config = &CONFIG_LINEAR_PERF[loop];
+        for (i = 0; i < config->numTaps; i++)
+        {
+            coeffs[i] = (ne10_float32_t) (drand48() * 2.0f - 1.0f) / config->numTaps;
+            delays[i] = (ne10_int32_t) (drand48() * config->maxDelay);
+        }
+
+        ne10_fir_sparse_init_float (&SR, config->numTaps, coeffs, state_ref, delays, config->maxDelay, config->blockSize);
+        ne10_fir_sparse_linear_init_float (&SN, config->numTaps, coeffs, delays,
+                                           sorted_coeffs, sorted_delays, fir_state_neon, config->maxDelay, config->blockSize);
+
+        /* the circular buffer implementation against the linear delay line */
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < 10; k++)
+            {
+                for (pos = 0; pos + config->blockSize <= LINEAR_TEST_LENGTH; pos += config->blockSize)
+                {
+                    ne10_fir_sparse_float_c (&SR, input + pos, out_c + pos, scratch_ref, config->blockSize);
+                }
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < 10; k++)
+            {
+                for (pos = 0; pos + config->blockSize <= LINEAR_TEST_LENGTH; pos += config->blockSize)
+                {
+                    ne10_fir_sparse_linear_float_neon (&SN, input + pos, out_neon + pos, config->blockSize);
+                }
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", config->numTaps, time_c, time_neon, time_savings, time_speedup);
+    }
+#endif
+
+    free (input);
+    free (out_ref);
+    free (state_ref);
+    free (scratch_ref);
+    free (coeffs);
+    free (sorted_coeffs);
+    free (delays);
+    free (sorted_delays);
+    free (guarded_out_c);
+    free (guarded_out_neon);
+    free (guarded_fir_state_c);
+    free (guarded_fir_state_neon);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
 void test_fir_sparse()
 {
     test_fir_sparse_case0();
+    test_fir_sparse_linear_case0();
 }
 
 static void my_test_setup (void)
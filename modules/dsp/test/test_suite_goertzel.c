@@ -0,0 +1,313 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_goertzel.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "NE10_dsp.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#define TEST_LENGTH_SAMPLES 8192
+#define MAX_BINS 40
+
+#define TEST_COUNT 100
+
+/* ----------------------------------------------------------------------
+** Defines each of the tests performed
+** ------------------------------------------------------------------- */
+typedef struct
+{
+    ne10_uint32_t numBins;
+    ne10_uint32_t blockLen;
+    ne10_uint32_t chunkSize;
+} test_config;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static test_config CONFIG[] =
+{
+    {8, 205, 80},
+    {1, 64, 1},
+    {3, 256, 1000},
+    {16, 2048, 333},
+    {40, 512, 512},
+    {13, 100, 7}
+};
+#define NUM_TESTS (sizeof(CONFIG) / sizeof(CONFIG[0]) )
+#endif
+#ifdef PERFORMANCE_TEST
+static test_config CONFIG_PERF[] =
+{
+    {4, 2048, 256},
+    {16, 2048, 256},
+    {32, 2048, 256}
+};
+#define NUM_PERF_TESTS (sizeof(CONFIG_PERF) / sizeof(CONFIG_PERF[0]) )
+#endif
+
+//input and output
+static ne10_float32_t testInput_f32[TEST_LENGTH_SAMPLES];
+static ne10_float32_t freqs[MAX_BINS];
+static ne10_uint32_t bins[MAX_BINS];
+static ne10_float32_t * guarded_out_c = NULL;
+static ne10_float32_t * guarded_out_neon = NULL;
+static ne10_float32_t * out_c = NULL;
+static ne10_float32_t * out_neon = NULL;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static ne10_float32_t out_ref[TEST_LENGTH_SAMPLES];
+static ne10_float32_t snr = 0.0f;
+#endif
+#ifdef PERFORMANCE_TEST
+static ne10_int64_t time_c = 0;
+static ne10_int64_t time_neon = 0;
+static ne10_float32_t time_speedup = 0.0f;
+static ne10_float32_t time_savings = 0.0f;
+#endif
+
+typedef ne10_uint32_t (*test_goertzel_func_t) (ne10_goertzel_cfg_float32_t, ne10_float32_t *, ne10_float32_t *, ne10_uint32_t);
+typedef void (*test_sdft_func_t) (ne10_sdft_cfg_float32_t, ne10_fft_cpx_float32_t *, ne10_float32_t *, ne10_uint32_t);
+
+/* Streams the input through a Goertzel bank in chunks; returns the number of blocks */
+static ne10_uint32_t test_goertzel_run (test_config * config, test_goertzel_func_t func, ne10_float32_t * pPower)
+{
+    ne10_goertzel_cfg_float32_t cfg = ne10_goertzel_alloc_float32 (config->numBins, freqs, config->blockLen);
+    ne10_uint32_t pos, n, blocks = 0;
+
+    for (pos = 0; pos < TEST_LENGTH_SAMPLES; pos += n)
+    {
+        n = (TEST_LENGTH_SAMPLES - pos < config->chunkSize) ? TEST_LENGTH_SAMPLES - pos : config->chunkSize;
+        blocks += func (cfg, pPower + blocks * config->numBins, testInput_f32 + pos, n);
+    }
+    ne10_goertzel_destroy_float32 (cfg);
+    return blocks;
+}
+
+/* Streams the input through a sliding DFT in chunks, keeping the bins after every chunk */
+static ne10_uint32_t test_sdft_run (test_config * config, test_sdft_func_t func, ne10_float32_t * pOut)
+{
+    ne10_sdft_cfg_float32_t cfg = ne10_sdft_alloc_float32 (config->numBins, bins, config->blockLen);
+    ne10_uint32_t pos, n, chunks = 0;
+
+    for (pos = 0; pos < TEST_LENGTH_SAMPLES; pos += n)
+    {
+        n = (TEST_LENGTH_SAMPLES - pos < config->chunkSize) ? TEST_LENGTH_SAMPLES - pos : config->chunkSize;
+        func (cfg, (ne10_fft_cpx_float32_t *) pOut, testInput_f32 + pos, n);
+        chunks++;
+    }
+    ne10_sdft_destroy_float32 (cfg);
+    return chunks;
+}
+
+void test_goertzel_case0()
+{
+    ne10_uint16_t loop = 0;
+    ne10_uint32_t i = 0;
+    ne10_uint32_t blocks, b, k, n;
+
+    test_config *config;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    /* noise with two tones */
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        testInput_f32[i] = (ne10_float32_t) (drand48() * 0.2 - 0.1 + sin (0.3 * i) + 0.5 * cos (1.1 * i));
+    }
+
+    /* init dst memory */
+    NE10_DST_ALLOC (out_c, guarded_out_c, TEST_LENGTH_SAMPLES);
+    NE10_DST_ALLOC (out_neon, guarded_out_neon, TEST_LENGTH_SAMPLES);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_float64_t re, im, w, damping;
+
+    for (loop = 0; loop < NUM_TESTS; loop++)
+    {
+        config = &CONFIG[loop];
+        for (k = 0; k < config->numBins; k++)
+        {
+            bins[k] = (ne10_uint32_t) (drand48() * config->blockLen / 2);
+            freqs[k] = (ne10_float32_t) bins[k] / config->blockLen;
+        }
+
+        GUARD_ARRAY (out_c, TEST_LENGTH_SAMPLES);
+        GUARD_ARRAY (out_neon, TEST_LENGTH_SAMPLES);
+
+        //conformance test 1: Goertzel powers against the DFT of every block
+        blocks = test_goertzel_run (config, ne10_goertzel_float32_c, out_c);
+        assert_int_equal (TEST_LENGTH_SAMPLES / config->blockLen, blocks);
+        blocks = test_goertzel_run (config, ne10_goertzel_float32_neon, out_neon);
+        assert_int_equal (TEST_LENGTH_SAMPLES / config->blockLen, blocks);
+        assert_true (CHECK_ARRAY_GUARD (out_c, TEST_LENGTH_SAMPLES));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, TEST_LENGTH_SAMPLES));
+
+        for (b = 0; b < blocks; b++)
+        {
+            for (k = 0; k < config->numBins; k++)
+            {
+                re = im = 0.0;
+                for (n = 0; n < config->blockLen; n++)
+                {
+                    w = 2.0 * NE10_PI * bins[k] * n / config->blockLen;
+                    re += testInput_f32[b * config->blockLen + n] * cos (w);
+                    im -= testInput_f32[b * config->blockLen + n] * sin (w);
+                }
+                out_ref[b * config->numBins + k] = (ne10_float32_t) (re * re + im * im);
+            }
+        }
+        snr = CAL_SNR_FLOAT32 (out_ref, out_c, blocks * config->numBins);
+#if defined (DEBUG_TRACE)
+        printf ("--------------------config %d\n", loop);
+        printf ("goertzel snr c %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+        snr = CAL_SNR_FLOAT32 (out_ref, out_neon, blocks * config->numBins);
+#if defined (DEBUG_TRACE)
+        printf ("goertzel snr neon %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+
+        //conformance test 2: sliding DFT against the damped DFT of the last window
+        GUARD_ARRAY (out_c, 2 * config->numBins);
+        GUARD_ARRAY (out_neon, 2 * config->numBins);
+        test_sdft_run (config, ne10_sdft_float32_c, out_c);
+        test_sdft_run (config, ne10_sdft_float32_neon, out_neon);
+        assert_true (CHECK_ARRAY_GUARD (out_c, 2 * config->numBins));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, 2 * config->numBins));
+
+        for (k = 0; k < config->numBins; k++)
+        {
+            re = im = 0.0;
+            damping = 1.0;
+            for (n = 0; n < config->blockLen; n++)
+            {
+                /* sample of age n, oldest of the window at phase 0 */
+                damping *= NE10_SDFT_DAMPING;
+                w = 2.0 * NE10_PI * bins[k] * (n + 1) / config->blockLen;
+                re += damping * testInput_f32[TEST_LENGTH_SAMPLES - 1 - n] * cos (w);
+                im += damping * testInput_f32[TEST_LENGTH_SAMPLES - 1 - n] * sin (w);
+            }
+            out_ref[2 * k] = (ne10_float32_t) re;
+            out_ref[2 * k + 1] = (ne10_float32_t) im;
+        }
+        snr = CAL_SNR_FLOAT32 (out_ref, out_c, 2 * config->numBins);
+#if defined (DEBUG_TRACE)
+        printf ("sdft snr c %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+        snr = CAL_SNR_FLOAT32 (out_ref, out_neon, 2 * config->numBins);
+#if defined (DEBUG_TRACE)
+        printf ("sdft snr neon %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+    }
+
+    /* invalid frequencies and bins are rejected */
+    freqs[0] = 0.6f;
+    bins[0] = 64;
+    assert_true (ne10_goertzel_alloc_float32 (1, freqs, 64) == NULL);
+    assert_true (ne10_sdft_alloc_float32 (1, bins, 64) == NULL);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint16_t t;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Goertzel Bins", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_PERF_TESTS; loop++)
+    {
+        config = &CONFIG_PERF[loop];
+        for (k = 0; k < config->numBins; k++)
+        {
+            bins[k] = k * 7 + 1;
+            freqs[k] = (ne10_float32_t) bins[k] / config->blockLen;
+        }
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (t = 0; t < TEST_COUNT; t++)
+            {
+                test_goertzel_run (config, ne10_goertzel_float32_c, out_c);
+                test_sdft_run (config, ne10_sdft_float32_c, out_c);
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (t = 0; t < TEST_COUNT; t++)
+            {
+                test_goertzel_run (config, ne10_goertzel_float32_neon, out_neon);
+                test_sdft_run (config, ne10_sdft_float32_neon, out_neon);
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", config->numBins, time_c, time_neon, time_savings, time_speedup);
+    }
+#endif
+
+    free (guarded_out_c);
+    free (guarded_out_neon);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_goertzel()
+{
+    test_goertzel_case0();
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_goertzel (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_goertzel);           // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
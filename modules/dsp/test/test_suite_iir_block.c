@@ -0,0 +1,365 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_iir_block.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "NE10_dsp.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#define TEST_LENGTH_SAMPLES 1024
+#define MAX_SECTIONS 16
+#define MAX_STEPSIZE 8
+#define SNR_THRESHOLD_IIR_BLOCK 80.0f
+
+#define TEST_COUNT 5000
+
+/* ----------------------------------------------------------------------
+** Biquad cascades {b0, b1, b2, a1, a2}, y(n) = b0*x(n) + ... + a1*y(n-1) + a2*y(n-2)
+** ------------------------------------------------------------------- */
+
+/* 4th order Butterworth lowpass, fc = 0.1 fs */
+static ne10_float32_t testBiquad2[2 * 5] =
+{
+    0.0618852f,  0.1237704f,  0.0618852f,  1.0485996f, -0.2961404f,
+    0.0779563f,  0.1559127f,  0.0779563f,  1.3209134f, -0.6327388f
+};
+
+/* Resonator with poles at radius 0.995 */
+static ne10_float32_t testBiquad1[1 * 5] =
+{
+    0.01f,       0.0f,       -0.01f,       1.8625651f, -0.9900250f
+};
+
+/* ----------------------------------------------------------------------
+** Lattice coefficients, laid out as for ne10_iir_lattice_init_float
+** ------------------------------------------------------------------- */
+
+static ne10_float32_t testkCoeffs9[9] =
+{
+    -0.003320,    0.035949,    -0.164096,    0.406018,    -0.633594,    0.764885,    -0.817318,    0.893064,
+    -0.748373
+};
+static ne10_float32_t testvCoeffs9[10] =
+{
+    -0.013805,    -0.001180,    0.075167,    0.156646,    0.156373,    0.093161,    0.036815,    0.009947,
+    0.001679,    0.000133
+};
+
+static ne10_float32_t testkCoeffs2[2] = { 0.2722, -0.5878 };
+static ne10_float32_t testvCoeffs2[3] =
+{
+    0.3072,     0.3603,     0.1311
+};
+
+/* ----------------------------------------------------------------------
+** Defines each of the tests performed
+** ------------------------------------------------------------------- */
+typedef struct
+{
+    ne10_uint32_t blockSize;
+    ne10_uint32_t numFrames;
+    ne10_uint16_t stepSize;
+    ne10_uint16_t numStages;
+    ne10_float32_t *biquadCoeffs;   /* NULL for lattice configurations */
+    ne10_float32_t *kCoeffs;
+    ne10_float32_t *vCoeffs;
+} test_config;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static test_config CONFIG[] =
+{
+    {64, 16, 4, 2, &testBiquad2[0], NULL, NULL},
+    {37, 27, 8, 2, &testBiquad2[0], NULL, NULL},
+    {5, 200, 4, 1, &testBiquad1[0], NULL, NULL},
+    {1024, 1, 8, 1, &testBiquad1[0], NULL, NULL},
+    {32, 32, 4, 9, NULL, &testkCoeffs9[0], &testvCoeffs9[0]},
+    {13, 78, 8, 9, NULL, &testkCoeffs9[0], &testvCoeffs9[0]},
+    {3, 341, 4, 2, NULL, &testkCoeffs2[0], &testvCoeffs2[0]},
+    {0, 10, 4, 2, NULL, &testkCoeffs2[0], &testvCoeffs2[0]}
+};
+#define NUM_TESTS (sizeof(CONFIG) / sizeof(CONFIG[0]) )
+#endif
+#ifdef PERFORMANCE_TEST
+static test_config CONFIG_PERF[] =
+{
+    {256, 4, 4, 2, &testBiquad2[0], NULL, NULL},
+    {256, 4, 8, 2, &testBiquad2[0], NULL, NULL},
+    {256, 4, 8, 9, NULL, &testkCoeffs9[0], &testvCoeffs9[0]}
+};
+#define NUM_PERF_TESTS (sizeof(CONFIG_PERF) / sizeof(CONFIG_PERF[0]) )
+#endif
+
+//input and output
+static ne10_float32_t testInput_f32[TEST_LENGTH_SAMPLES];
+static ne10_float32_t * guarded_out_c = NULL;
+static ne10_float32_t * guarded_out_neon = NULL;
+static ne10_float32_t * out_c = NULL;
+static ne10_float32_t * out_neon = NULL;
+static ne10_float32_t * out_ref = NULL;
+
+static ne10_float32_t * coeffs_c = NULL;
+static ne10_float32_t * coeffs_neon = NULL;
+static ne10_float32_t * state_c = NULL;
+static ne10_float32_t * state_neon = NULL;
+static ne10_float32_t * state_ref = NULL;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static ne10_float32_t snr = 0.0f;
+#endif
+#ifdef PERFORMANCE_TEST
+static ne10_int64_t time_c = 0;
+static ne10_int64_t time_neon = 0;
+static ne10_float32_t time_speedup = 0.0f;
+static ne10_float32_t time_savings = 0.0f;
+#endif
+
+static ne10_result_t test_iir_block_init (ne10_iir_block_instance_f32_t * S,
+        test_config * config,
+        ne10_float32_t * pCoeffs,
+        ne10_float32_t * pState)
+{
+    if (config->biquadCoeffs != NULL)
+    {
+        return ne10_iir_block_biquad_init_float (S, config->numStages, config->biquadCoeffs,
+                pCoeffs, pState, config->stepSize);
+    }
+    return ne10_iir_block_lattice_init_float (S, config->numStages, config->kCoeffs, config->vCoeffs,
+            pCoeffs, pState, config->stepSize);
+}
+
+/* Sample-by-sample reference: direct form I in double precision for biquads, the lattice filter otherwise */
+static void test_iir_block_reference (test_config * config, ne10_float32_t * pSrc, ne10_float32_t * pDst, ne10_uint32_t length)
+{
+    ne10_uint32_t stage, i;
+
+    if (config->biquadCoeffs != NULL)
+    {
+        for (i = 0; i < length; i++)
+        {
+            pDst[i] = pSrc[i];
+        }
+        for (stage = 0; stage < config->numStages; stage++)
+        {
+            ne10_float32_t *c = config->biquadCoeffs + 5 * stage;
+            ne10_float64_t x1 = 0, x2 = 0, y1 = 0, y2 = 0, x, y;
+            for (i = 0; i < length; i++)
+            {
+                x = pDst[i];
+                y = c[0] * x + c[1] * x1 + c[2] * x2 + c[3] * y1 + c[4] * y2;
+                x2 = x1;
+                x1 = x;
+                y2 = y1;
+                y1 = y;
+                pDst[i] = (ne10_float32_t) y;
+            }
+        }
+    }
+    else
+    {
+        ne10_iir_lattice_instance_f32_t SL;
+        ne10_iir_lattice_init_float (&SL, config->numStages, config->kCoeffs, config->vCoeffs, state_ref, length);
+        ne10_iir_lattice_float_c (&SL, pSrc, pDst, length);
+    }
+}
+
+void test_iir_block_case0()
+{
+    ne10_iir_block_instance_f32_t SC, SN;
+
+    ne10_uint16_t loop = 0;
+    ne10_uint16_t block = 0;
+    ne10_uint32_t i = 0;
+    ne10_uint32_t length;
+
+    test_config *config;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        testInput_f32[i] = (ne10_float32_t) (drand48() * 2.0f - 1.0f);
+    }
+
+    /* init dst memory */
+    NE10_DST_ALLOC (out_c, guarded_out_c, TEST_LENGTH_SAMPLES);
+    NE10_DST_ALLOC (out_neon, guarded_out_neon, TEST_LENGTH_SAMPLES);
+    out_ref = (ne10_float32_t*) malloc (TEST_LENGTH_SAMPLES * sizeof (ne10_float32_t));
+
+    /* init matrix and state memory */
+    coeffs_c = (ne10_float32_t*) malloc (MAX_SECTIONS * NE10_IIR_BLOCK_COEFFS_LEN (MAX_SECTIONS, MAX_STEPSIZE) * sizeof (ne10_float32_t));
+    coeffs_neon = (ne10_float32_t*) malloc (MAX_SECTIONS * NE10_IIR_BLOCK_COEFFS_LEN (MAX_SECTIONS, MAX_STEPSIZE) * sizeof (ne10_float32_t));
+    state_c = (ne10_float32_t*) malloc (2 * MAX_SECTIONS * MAX_SECTIONS * sizeof (ne10_float32_t));
+    state_neon = (ne10_float32_t*) malloc (2 * MAX_SECTIONS * MAX_SECTIONS * sizeof (ne10_float32_t));
+    state_ref = (ne10_float32_t*) malloc ( (MAX_SECTIONS + TEST_LENGTH_SAMPLES) * sizeof (ne10_float32_t));
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_TESTS; loop++)
+    {
+        config = &CONFIG[loop];
+        length = config->blockSize * config->numFrames;
+
+        assert_int_equal (NE10_OK, test_iir_block_init (&SC, config, coeffs_c, state_c));
+        assert_int_equal (NE10_OK, test_iir_block_init (&SN, config, coeffs_neon, state_neon));
+
+        for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+        {
+            out_c[i] = 0;
+            out_neon[i] = 0;
+        }
+
+        GUARD_ARRAY (out_c, TEST_LENGTH_SAMPLES);
+        GUARD_ARRAY (out_neon, TEST_LENGTH_SAMPLES);
+
+        for (block = 0; block < config->numFrames; block++)
+        {
+            ne10_iir_block_float_c (&SC, testInput_f32 + (block * config->blockSize), out_c + (block * config->blockSize), config->blockSize);
+        }
+        /* the NEON version runs in place */
+        for (i = 0; i < length; i++)
+        {
+            out_neon[i] = testInput_f32[i];
+        }
+        for (block = 0; block < config->numFrames; block++)
+        {
+            ne10_iir_block_float_neon (&SN, out_neon + (block * config->blockSize), out_neon + (block * config->blockSize), config->blockSize);
+        }
+
+        assert_true (CHECK_ARRAY_GUARD (out_c, TEST_LENGTH_SAMPLES));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, TEST_LENGTH_SAMPLES));
+
+        if (length == 0)
+        {
+            continue;
+        }
+
+        //conformance test 1: compare C and NEON
+        snr = CAL_SNR_FLOAT32 (out_c, out_neon, length);
+#if defined (DEBUG_TRACE)
+        printf ("--------------------config %d\n", loop);
+        printf ("snr c/neon %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD_IIR_BLOCK));
+
+        //conformance test 2: compare with the sample-by-sample filter
+        test_iir_block_reference (config, testInput_f32, out_ref, length);
+        snr = CAL_SNR_FLOAT32 (out_ref, out_c, length);
+#if defined (DEBUG_TRACE)
+        printf ("snr ref/c %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD_IIR_BLOCK));
+    }
+
+    /* unsupported step sizes are rejected */
+    assert_int_equal (NE10_ERR, ne10_iir_block_biquad_init_float (&SC, 1, testBiquad1, coeffs_c, state_c, 6));
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint16_t k;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "IIR Stages", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_PERF_TESTS; loop++)
+    {
+        config = &CONFIG_PERF[loop];
+
+        test_iir_block_init (&SC, config, coeffs_c, state_c);
+        test_iir_block_init (&SN, config, coeffs_neon, state_neon);
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                for (block = 0; block < config->numFrames; block++)
+                {
+                    ne10_iir_block_float_c (&SC, testInput_f32 + (block * config->blockSize), out_c + (block * config->blockSize), config->blockSize);
+                }
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                for (block = 0; block < config->numFrames; block++)
+                {
+                    ne10_iir_block_float_neon (&SN, testInput_f32 + (block * config->blockSize), out_neon + (block * config->blockSize), config->blockSize);
+                }
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", config->numStages, time_c, time_neon, time_savings, time_speedup);
+    }
+#endif
+
+    free (guarded_out_c);
+    free (guarded_out_neon);
+    free (out_ref);
+    free (coeffs_c);
+    free (coeffs_neon);
+    free (state_c);
+    free (state_neon);
+    free (state_ref);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_iir_block()
+{
+    test_iir_block_case0();
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_iir_block (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_iir_block);         // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
@@ -0,0 +1,672 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_lms.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "NE10_dsp.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#define TEST_LENGTH_SAMPLES 4096
+#define MAX_NUMTAPS 128
+#define UNKNOWN_NUMTAPS 16
+#define CONVERGE_WINDOW 256
+/* the error energy of the last window must be this far (dB) below the reference energy */
+#define CONVERGE_THRESHOLD 40.0f
+#define CONVERGE_THRESHOLD_INT32 30.0f
+
+#define TEST_COUNT 200
+
+/* ----------------------------------------------------------------------
+** Defines each of the tests performed
+** ------------------------------------------------------------------- */
+typedef struct
+{
+    ne10_uint16_t numTaps;
+    ne10_uint32_t blockSize;
+    ne10_uint32_t numFrames;
+    ne10_float32_t mu;
+} test_config;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static test_config CONFIG_NORM[] =
+{
+    {32, 64, 64, 0.5f},
+    {19, 37, 110, 0.5f},
+    {16, 1, 4096, 0.25f},
+    {1, 16, 4, 0.5f},
+    {128, 512, 8, 0.8f}
+};
+#define NUM_NORM_TESTS (sizeof(CONFIG_NORM) / sizeof(CONFIG_NORM[0]) )
+
+static test_config CONFIG_FD[] =
+{
+    {16, 64, 64, 0.3f},
+    {32, 32, 128, 0.3f},
+    {64, 512, 8, 0.5f},
+    {128, 128, 32, 0.5f}
+};
+#define NUM_FD_TESTS (sizeof(CONFIG_FD) / sizeof(CONFIG_FD[0]) )
+#endif
+#ifdef PERFORMANCE_TEST
+static test_config CONFIG_PERF[] =
+{
+    {16, 256, 16, 0.5f},
+    {64, 256, 16, 0.5f},
+    {128, 256, 16, 0.5f}
+};
+#define NUM_PERF_TESTS (sizeof(CONFIG_PERF) / sizeof(CONFIG_PERF[0]) )
+#endif
+
+//input and output
+static ne10_float32_t testInput_f32[TEST_LENGTH_SAMPLES];
+static ne10_float32_t testRef_f32[TEST_LENGTH_SAMPLES];
+static ne10_int32_t testInput_i32[TEST_LENGTH_SAMPLES];
+static ne10_int32_t testRef_i32[TEST_LENGTH_SAMPLES];
+static ne10_float32_t testUnknown_f32[UNKNOWN_NUMTAPS];
+
+static ne10_float32_t * guarded_out_c = NULL;
+static ne10_float32_t * guarded_out_neon = NULL;
+static ne10_float32_t * out_c = NULL;
+static ne10_float32_t * out_neon = NULL;
+static ne10_float32_t * err_c = NULL;
+static ne10_float32_t * err_neon = NULL;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static ne10_float32_t snr = 0.0f;
+#endif
+#ifdef PERFORMANCE_TEST
+static ne10_int64_t time_c = 0;
+static ne10_int64_t time_neon = 0;
+static ne10_float32_t time_speedup = 0.0f;
+static ne10_float32_t time_savings = 0.0f;
+#endif
+
+/* Input noise and the output of an unknown FIR system the filters have to identify */
+static void test_lms_gen_data (void)
+{
+    ne10_uint32_t i, k;
+    ne10_float64_t acc;
+
+    for (k = 0; k < UNKNOWN_NUMTAPS; k++)
+    {
+        testUnknown_f32[k] = (ne10_float32_t) (drand48() * 0.2f - 0.1f);
+    }
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        testInput_f32[i] = (ne10_float32_t) (drand48() - 0.5f);
+    }
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        acc = 0.0;
+        for (k = 0; (k < UNKNOWN_NUMTAPS) && (k <= i); k++)
+        {
+            acc += testUnknown_f32[k] * testInput_f32[i - k];
+        }
+        testRef_f32[i] = (ne10_float32_t) acc;
+        testInput_i32[i] = (ne10_int32_t) (testInput_f32[i] * 2147483648.0f);
+        testRef_i32[i] = (ne10_int32_t) (testRef_f32[i] * 2147483648.0f);
+    }
+}
+
+/* Energy of the reference over the error in the last window, in dB */
+static ne10_float32_t test_lms_convergence (ne10_float32_t * pErr, ne10_float32_t * pRef, ne10_uint32_t length)
+{
+    ne10_float64_t errEnergy = 1e-30, refEnergy = 0.0;
+    ne10_uint32_t i;
+
+    for (i = length - CONVERGE_WINDOW; i < length; i++)
+    {
+        errEnergy += (ne10_float64_t) pErr[i] * pErr[i];
+        refEnergy += (ne10_float64_t) pRef[i] * pRef[i];
+    }
+    return (ne10_float32_t) (10.0 * log10 (refEnergy / errEnergy));
+}
+
+void test_lms_norm_case0()
+{
+    ne10_lms_norm_instance_f32_t SC, SN;
+    ne10_float32_t *coeffs_c, *coeffs_neon, *state_c, *state_neon;
+    ne10_float64_t energy;
+
+    ne10_uint16_t loop = 0;
+    ne10_uint16_t block = 0;
+    ne10_uint32_t i = 0;
+    ne10_uint32_t length;
+    ne10_uint32_t offset;
+
+    test_config *config;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    test_lms_gen_data();
+
+    /* init dst memory */
+    NE10_DST_ALLOC (out_c, guarded_out_c, TEST_LENGTH_SAMPLES);
+    NE10_DST_ALLOC (out_neon, guarded_out_neon, TEST_LENGTH_SAMPLES);
+    err_c = (ne10_float32_t*) malloc (TEST_LENGTH_SAMPLES * sizeof (ne10_float32_t));
+    err_neon = (ne10_float32_t*) malloc (TEST_LENGTH_SAMPLES * sizeof (ne10_float32_t));
+
+    coeffs_c = (ne10_float32_t*) malloc (MAX_NUMTAPS * sizeof (ne10_float32_t));
+    coeffs_neon = (ne10_float32_t*) malloc (MAX_NUMTAPS * sizeof (ne10_float32_t));
+    state_c = (ne10_float32_t*) malloc ( (MAX_NUMTAPS + TEST_LENGTH_SAMPLES) * sizeof (ne10_float32_t));
+    state_neon = (ne10_float32_t*) malloc ( (MAX_NUMTAPS + TEST_LENGTH_SAMPLES) * sizeof (ne10_float32_t));
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_NORM_TESTS; loop++)
+    {
+        config = &CONFIG_NORM[loop];
+        length = config->blockSize * config->numFrames;
+
+        for (i = 0; i < config->numTaps; i++)
+        {
+            coeffs_c[i] = 0.0f;
+            coeffs_neon[i] = 0.0f;
+        }
+        assert_int_equal (NE10_OK, ne10_lms_norm_init_float (&SC, config->numTaps, coeffs_c, state_c, config->mu, config->blockSize));
+        assert_int_equal (NE10_OK, ne10_lms_norm_init_float (&SN, config->numTaps, coeffs_neon, state_neon, config->mu, config->blockSize));
+
+        GUARD_ARRAY (out_c, TEST_LENGTH_SAMPLES);
+        GUARD_ARRAY (out_neon, TEST_LENGTH_SAMPLES);
+
+        for (block = 0; block < config->numFrames; block++)
+        {
+            offset = block * config->blockSize;
+            ne10_lms_norm_float_c (&SC, testInput_f32 + offset, testRef_f32 + offset, out_c + offset, err_c + offset, config->blockSize);
+            ne10_lms_norm_float_neon (&SN, testInput_f32 + offset, testRef_f32 + offset, out_neon + offset, err_neon + offset, config->blockSize);
+        }
+
+        assert_true (CHECK_ARRAY_GUARD (out_c, TEST_LENGTH_SAMPLES));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, TEST_LENGTH_SAMPLES));
+
+        //conformance test 1: compare C and NEON
+        snr = CAL_SNR_FLOAT32 (out_c, out_neon, length);
+#if defined (DEBUG_TRACE)
+        printf ("--------------------config %d\n", loop);
+        printf ("snr c/neon %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+        snr = CAL_SNR_FLOAT32 (coeffs_c, coeffs_neon, config->numTaps);
+        assert_false ( (snr < SNR_THRESHOLD));
+
+        //conformance test 2: the unknown system is identified
+        if ( (config->numTaps >= UNKNOWN_NUMTAPS) && (length >= 8 * CONVERGE_WINDOW))
+        {
+            snr = test_lms_convergence (err_c, testRef_f32, length);
+#if defined (DEBUG_TRACE)
+            printf ("convergence %f dB\n", snr);
+#endif
+            assert_false ( (snr < CONVERGE_THRESHOLD));
+        }
+    }
+
+    /*
+     * a loud passage followed by a quiet one: the energy must follow the window down instead of
+     * keeping the rounding errors of the loud samples
+     */
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        testInput_f32[i] *= (i < TEST_LENGTH_SAMPLES / 2) ? 1e4f : 1e-3f;
+        testRef_f32[i] *= (i < TEST_LENGTH_SAMPLES / 2) ? 1e4f : 1e-3f;
+    }
+    for (i = 0; i < MAX_NUMTAPS; i++)
+    {
+        coeffs_c[i] = 0.0f;
+        coeffs_neon[i] = 0.0f;
+    }
+    ne10_lms_norm_init_float (&SC, MAX_NUMTAPS, coeffs_c, state_c, 0.5f, TEST_LENGTH_SAMPLES / 8);
+    ne10_lms_norm_init_float (&SN, MAX_NUMTAPS, coeffs_neon, state_neon, 0.5f, TEST_LENGTH_SAMPLES / 8);
+    for (block = 0; block < 8; block++)
+    {
+        offset = block * (TEST_LENGTH_SAMPLES / 8);
+        ne10_lms_norm_float_c (&SC, testInput_f32 + offset, testRef_f32 + offset, out_c + offset, err_c + offset, TEST_LENGTH_SAMPLES / 8);
+        ne10_lms_norm_float_neon (&SN, testInput_f32 + offset, testRef_f32 + offset, out_neon + offset, err_neon + offset, TEST_LENGTH_SAMPLES / 8);
+    }
+    energy = 0.0;
+    for (i = TEST_LENGTH_SAMPLES - MAX_NUMTAPS; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        energy += (ne10_float64_t) testInput_f32[i] * testInput_f32[i];
+    }
+    assert_true (fabs (SC.energy - energy) < 1e-2 * energy);
+    assert_true (fabs (SN.energy - energy) < 1e-2 * energy);
+    assert_false ( (test_lms_convergence (err_c, testRef_f32, TEST_LENGTH_SAMPLES) < CONVERGE_THRESHOLD));
+    assert_false ( (test_lms_convergence (err_neon, testRef_f32, TEST_LENGTH_SAMPLES) < CONVERGE_THRESHOLD));
+    test_lms_gen_data();
+
+    assert_int_equal (NE10_ERR, ne10_lms_norm_init_float (&SC, 0, coeffs_c, state_c, 0.5f, 16));
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint16_t k;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "LMS Taps", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_PERF_TESTS; loop++)
+    {
+        config = &CONFIG_PERF[loop];
+
+        for (i = 0; i < config->numTaps; i++)
+        {
+            coeffs_c[i] = 0.0f;
+            coeffs_neon[i] = 0.0f;
+        }
+        ne10_lms_norm_init_float (&SC, config->numTaps, coeffs_c, state_c, config->mu, config->blockSize);
+        ne10_lms_norm_init_float (&SN, config->numTaps, coeffs_neon, state_neon, config->mu, config->blockSize);
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                for (block = 0; block < config->numFrames; block++)
+                {
+                    offset = block * config->blockSize;
+                    ne10_lms_norm_float_c (&SC, testInput_f32 + offset, testRef_f32 + offset, out_c + offset, err_c + offset, config->blockSize);
+                }
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                for (block = 0; block < config->numFrames; block++)
+                {
+                    offset = block * config->blockSize;
+                    ne10_lms_norm_float_neon (&SN, testInput_f32 + offset, testRef_f32 + offset, out_neon + offset, err_neon + offset, config->blockSize);
+                }
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", config->numTaps, time_c, time_neon, time_savings, time_speedup);
+    }
+#endif
+
+    free (guarded_out_c);
+    free (guarded_out_neon);
+    free (err_c);
+    free (err_neon);
+    free (coeffs_c);
+    free (coeffs_neon);
+    free (state_c);
+    free (state_neon);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_lms_norm_int32_case0()
+{
+    ne10_lms_norm_instance_int32_t SC, SN;
+    ne10_int32_t *coeffs_c, *coeffs_neon, *state_c, *state_neon;
+    ne10_int32_t *iout_c, *iout_neon, *ierr_c, *ierr_neon;
+
+    ne10_uint16_t loop = 0;
+    ne10_uint16_t block = 0;
+    ne10_uint32_t i = 0;
+    ne10_uint32_t length;
+    ne10_uint32_t offset;
+
+    test_config *config;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    iout_c = (ne10_int32_t*) malloc (TEST_LENGTH_SAMPLES * sizeof (ne10_int32_t));
+    iout_neon = (ne10_int32_t*) malloc (TEST_LENGTH_SAMPLES * sizeof (ne10_int32_t));
+    ierr_c = (ne10_int32_t*) malloc (TEST_LENGTH_SAMPLES * sizeof (ne10_int32_t));
+    ierr_neon = (ne10_int32_t*) malloc (TEST_LENGTH_SAMPLES * sizeof (ne10_int32_t));
+    err_c = (ne10_float32_t*) malloc (TEST_LENGTH_SAMPLES * sizeof (ne10_float32_t));
+
+    coeffs_c = (ne10_int32_t*) malloc (MAX_NUMTAPS * sizeof (ne10_int32_t));
+    coeffs_neon = (ne10_int32_t*) malloc (MAX_NUMTAPS * sizeof (ne10_int32_t));
+    state_c = (ne10_int32_t*) malloc ( (MAX_NUMTAPS + TEST_LENGTH_SAMPLES) * sizeof (ne10_int32_t));
+    state_neon = (ne10_int32_t*) malloc ( (MAX_NUMTAPS + TEST_LENGTH_SAMPLES) * sizeof (ne10_int32_t));
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_NORM_TESTS; loop++)
+    {
+        config = &CONFIG_NORM[loop];
+        length = config->blockSize * config->numFrames;
+
+        for (i = 0; i < config->numTaps; i++)
+        {
+            coeffs_c[i] = 0;
+            coeffs_neon[i] = 0;
+        }
+        assert_int_equal (NE10_OK, ne10_lms_norm_init_int32 (&SC, config->numTaps, coeffs_c, state_c,
+                          (ne10_int32_t) (config->mu * 2147483648.0f), config->blockSize, loop % 2));
+        assert_int_equal (NE10_OK, ne10_lms_norm_init_int32 (&SN, config->numTaps, coeffs_neon, state_neon,
+                          (ne10_int32_t) (config->mu * 2147483648.0f), config->blockSize, loop % 2));
+
+        for (block = 0; block < config->numFrames; block++)
+        {
+            offset = block * config->blockSize;
+            ne10_lms_norm_int32_c (&SC, testInput_i32 + offset, testRef_i32 + offset, iout_c + offset, ierr_c + offset, config->blockSize);
+            ne10_lms_norm_int32_neon (&SN, testInput_i32 + offset, testRef_i32 + offset, iout_neon + offset, ierr_neon + offset, config->blockSize);
+        }
+
+        //conformance test 1: C and NEON are bit exact
+        for (i = 0; i < length; i++)
+        {
+            if ( (iout_c[i] != iout_neon[i]) || (ierr_c[i] != ierr_neon[i]))
+            {
+                break;
+            }
+        }
+        assert_int_equal (length, i);
+        for (i = 0; i < config->numTaps; i++)
+        {
+            assert_int_equal (coeffs_c[i], coeffs_neon[i]);
+        }
+
+        //conformance test 2: the fixed-point filter identifies the unknown system like the floating-point one
+        if ( (config->numTaps >= UNKNOWN_NUMTAPS) && (length >= 8 * CONVERGE_WINDOW))
+        {
+            for (i = 0; i < length; i++)
+            {
+                err_c[i] = (ne10_float32_t) ierr_c[i] / 2147483648.0f;
+            }
+            snr = test_lms_convergence (err_c, testRef_f32, length);
+#if defined (DEBUG_TRACE)
+            printf ("--------------------config %d\n", loop);
+            printf ("convergence %f dB\n", snr);
+#endif
+            assert_false ( (snr < CONVERGE_THRESHOLD_INT32));
+        }
+    }
+
+    /*
+     * a quiet input, where mu * e is larger than the window energy at start-up: the step must stay
+     * normalized instead of saturating at 1.0
+     */
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        testInput_i32[i] >>= 12;
+        testRef_i32[i] >>= 12;
+    }
+    for (i = 0; i < UNKNOWN_NUMTAPS; i++)
+    {
+        coeffs_c[i] = 0;
+        coeffs_neon[i] = 0;
+    }
+    ne10_lms_norm_init_int32 (&SC, UNKNOWN_NUMTAPS, coeffs_c, state_c, 0x40000000, TEST_LENGTH_SAMPLES / 8, 0);
+    ne10_lms_norm_init_int32 (&SN, UNKNOWN_NUMTAPS, coeffs_neon, state_neon, 0x40000000, TEST_LENGTH_SAMPLES / 8, 0);
+    for (block = 0; block < 8; block++)
+    {
+        offset = block * (TEST_LENGTH_SAMPLES / 8);
+        ne10_lms_norm_int32_c (&SC, testInput_i32 + offset, testRef_i32 + offset, iout_c + offset, ierr_c + offset, TEST_LENGTH_SAMPLES / 8);
+        ne10_lms_norm_int32_neon (&SN, testInput_i32 + offset, testRef_i32 + offset, iout_neon + offset, ierr_neon + offset, TEST_LENGTH_SAMPLES / 8);
+    }
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        assert_int_equal (ierr_c[i], ierr_neon[i]);
+        err_c[i] = (ne10_float32_t) ierr_c[i] * (4096.0f / 2147483648.0f);
+    }
+    snr = test_lms_convergence (err_c, testRef_f32, TEST_LENGTH_SAMPLES);
+#if defined (DEBUG_TRACE)
+    printf ("quiet input convergence %f dB\n", snr);
+#endif
+    assert_false ( (snr < CONVERGE_THRESHOLD_INT32));
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        testInput_i32[i] = (ne10_int32_t) (testInput_f32[i] * 2147483648.0f);
+        testRef_i32[i] = (ne10_int32_t) (testRef_f32[i] * 2147483648.0f);
+    }
+
+    assert_int_equal (NE10_ERR, ne10_lms_norm_init_int32 (&SC, 16, coeffs_c, state_c, 0x40000000, 16, 31));
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint16_t k;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "LMS Taps", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_PERF_TESTS; loop++)
+    {
+        config = &CONFIG_PERF[loop];
+
+        for (i = 0; i < config->numTaps; i++)
+        {
+            coeffs_c[i] = 0;
+            coeffs_neon[i] = 0;
+        }
+        ne10_lms_norm_init_int32 (&SC, config->numTaps, coeffs_c, state_c, 0x40000000, config->blockSize, 0);
+        ne10_lms_norm_init_int32 (&SN, config->numTaps, coeffs_neon, state_neon, 0x40000000, config->blockSize, 0);
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                for (block = 0; block < config->numFrames; block++)
+                {
+                    offset = block * config->blockSize;
+                    ne10_lms_norm_int32_c (&SC, testInput_i32 + offset, testRef_i32 + offset, iout_c + offset, ierr_c + offset, config->blockSize);
+                }
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                for (block = 0; block < config->numFrames; block++)
+                {
+                    offset = block * config->blockSize;
+                    ne10_lms_norm_int32_neon (&SN, testInput_i32 + offset, testRef_i32 + offset, iout_neon + offset, ierr_neon + offset, config->blockSize);
+                }
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", config->numTaps, time_c, time_neon, time_savings, time_speedup);
+    }
+#endif
+
+    free (iout_c);
+    free (iout_neon);
+    free (ierr_c);
+    free (ierr_neon);
+    free (err_c);
+    free (coeffs_c);
+    free (coeffs_neon);
+    free (state_c);
+    free (state_neon);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_lms_fd_case0()
+{
+    ne10_lms_fd_instance_f32_t SC, SN;
+    ne10_fft_r2c_cfg_float32_t cfg;
+    ne10_fft_cpx_float32_t *coeffs_c, *coeffs_neon;
+    ne10_float32_t *state_c, *state_neon;
+
+    ne10_uint16_t loop = 0;
+    ne10_uint16_t block = 0;
+    ne10_uint32_t length;
+    ne10_uint32_t offset;
+
+    test_config *config;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    NE10_DST_ALLOC (out_c, guarded_out_c, TEST_LENGTH_SAMPLES);
+    NE10_DST_ALLOC (out_neon, guarded_out_neon, TEST_LENGTH_SAMPLES);
+    err_c = (ne10_float32_t*) malloc (TEST_LENGTH_SAMPLES * sizeof (ne10_float32_t));
+    err_neon = (ne10_float32_t*) malloc (TEST_LENGTH_SAMPLES * sizeof (ne10_float32_t));
+
+    coeffs_c = (ne10_fft_cpx_float32_t*) malloc ( (MAX_NUMTAPS + 1) * sizeof (ne10_fft_cpx_float32_t));
+    coeffs_neon = (ne10_fft_cpx_float32_t*) malloc ( (MAX_NUMTAPS + 1) * sizeof (ne10_fft_cpx_float32_t));
+    state_c = (ne10_float32_t*) malloc (NE10_LMS_FD_STATE_LEN (MAX_NUMTAPS) * sizeof (ne10_float32_t));
+    state_neon = (ne10_float32_t*) malloc (NE10_LMS_FD_STATE_LEN (MAX_NUMTAPS) * sizeof (ne10_float32_t));
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_FD_TESTS; loop++)
+    {
+        config = &CONFIG_FD[loop];
+        length = config->blockSize * config->numFrames;
+
+        cfg = ne10_fft_alloc_r2c_float32 (2 * config->numTaps);
+        assert_int_equal (NE10_OK, ne10_lms_fd_init_float (&SC, config->numTaps, cfg, coeffs_c, state_c, config->mu, 0.9f));
+        assert_int_equal (NE10_OK, ne10_lms_fd_init_float (&SN, config->numTaps, cfg, coeffs_neon, state_neon, config->mu, 0.9f));
+
+        GUARD_ARRAY (out_c, TEST_LENGTH_SAMPLES);
+        GUARD_ARRAY (out_neon, TEST_LENGTH_SAMPLES);
+
+        for (block = 0; block < config->numFrames; block++)
+        {
+            offset = block * config->blockSize;
+            ne10_lms_fd_float_c (&SC, testInput_f32 + offset, testRef_f32 + offset, out_c + offset, err_c + offset, config->blockSize);
+            ne10_lms_fd_float_neon (&SN, testInput_f32 + offset, testRef_f32 + offset, out_neon + offset, err_neon + offset, config->blockSize);
+        }
+
+        assert_true (CHECK_ARRAY_GUARD (out_c, TEST_LENGTH_SAMPLES));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, TEST_LENGTH_SAMPLES));
+
+        //conformance test 1: compare C and NEON
+        snr = CAL_SNR_FLOAT32 (out_c, out_neon, length);
+#if defined (DEBUG_TRACE)
+        printf ("--------------------config %d\n", loop);
+        printf ("snr c/neon %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+
+        //conformance test 2: the unknown system is identified
+        snr = test_lms_convergence (err_c, testRef_f32, length);
+#if defined (DEBUG_TRACE)
+        printf ("convergence %f dB\n", snr);
+#endif
+        assert_false ( (snr < CONVERGE_THRESHOLD));
+
+        NE10_FREE (cfg);
+    }
+
+    cfg = ne10_fft_alloc_r2c_float32 (48);
+    assert_int_equal (NE10_ERR, ne10_lms_fd_init_float (&SC, 24, cfg, coeffs_c, state_c, 0.3f, 0.9f));
+    NE10_FREE (cfg);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint16_t k;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "LMS Taps", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_PERF_TESTS; loop++)
+    {
+        config = &CONFIG_PERF[loop];
+
+        cfg = ne10_fft_alloc_r2c_float32 (2 * config->numTaps);
+        ne10_lms_fd_init_float (&SC, config->numTaps, cfg, coeffs_c, state_c, 0.3f, 0.9f);
+        ne10_lms_fd_init_float (&SN, config->numTaps, cfg, coeffs_neon, state_neon, 0.3f, 0.9f);
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                for (block = 0; block < config->numFrames; block++)
+                {
+                    offset = block * config->blockSize;
+                    ne10_lms_fd_float_c (&SC, testInput_f32 + offset, testRef_f32 + offset, out_c + offset, err_c + offset, config->blockSize);
+                }
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                for (block = 0; block < config->numFrames; block++)
+                {
+                    offset = block * config->blockSize;
+                    ne10_lms_fd_float_neon (&SN, testInput_f32 + offset, testRef_f32 + offset, out_neon + offset, err_neon + offset, config->blockSize);
+                }
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", config->numTaps, time_c, time_neon, time_savings, time_speedup);
+
+        NE10_FREE (cfg);
+    }
+#endif
+
+    free (guarded_out_c);
+    free (guarded_out_neon);
+    free (err_c);
+    free (err_neon);
+    free (coeffs_c);
+    free (coeffs_neon);
+    free (state_c);
+    free (state_neon);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_lms()
+{
+    test_lms_norm_case0();
+    test_lms_norm_int32_case0();
+    test_lms_fd_case0();
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_lms (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_lms);                // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
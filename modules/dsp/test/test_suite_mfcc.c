@@ -0,0 +1,338 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_mfcc.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "NE10_dsp.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#define MAX_FFTLEN 1024
+#define MAX_MELS 64
+#define TEST_FRAMES 8
+
+#define TEST_COUNT 5000
+
+/* ----------------------------------------------------------------------
+** Defines each of the tests performed
+** ------------------------------------------------------------------- */
+typedef struct
+{
+    ne10_uint32_t fftLen;
+    ne10_float32_t sampleRate;
+    ne10_uint32_t numMels;
+    ne10_uint32_t numCeps;
+    ne10_float32_t fMin;
+    ne10_float32_t fMax;
+} test_config;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static test_config CONFIG[] =
+{
+    {512, 16000.0f, 40, 13, 20.0f, 8000.0f},
+    {256, 8000.0f, 23, 23, 0.0f, 4000.0f},
+    {1024, 44100.0f, 64, 20, 50.0f, 16000.0f},
+    {64, 16000.0f, 10, 1, 300.0f, 7000.0f},
+    {16, 16000.0f, 3, 2, 0.0f, 8000.0f}
+};
+#define NUM_TESTS (sizeof(CONFIG) / sizeof(CONFIG[0]) )
+#endif
+#ifdef PERFORMANCE_TEST
+static test_config CONFIG_PERF[] =
+{
+    {256, 8000.0f, 23, 13, 20.0f, 4000.0f},
+    {512, 16000.0f, 40, 13, 20.0f, 8000.0f},
+    {1024, 16000.0f, 64, 20, 20.0f, 8000.0f}
+};
+#define NUM_PERF_TESTS (sizeof(CONFIG_PERF) / sizeof(CONFIG_PERF[0]) )
+#endif
+
+//input and output
+static ne10_float32_t testInput_f32[MAX_FFTLEN];
+static ne10_int16_t testInput_i16[MAX_FFTLEN];
+static ne10_fft_cpx_float32_t spectrum_f32[MAX_FFTLEN / 2 + 1];
+static ne10_fft_cpx_int16_t spectrum_i16[MAX_FFTLEN / 2 + 1];
+static ne10_float32_t * guarded_ceps_c = NULL;
+static ne10_float32_t * guarded_ceps_neon = NULL;
+static ne10_float32_t * guarded_mel_c = NULL;
+static ne10_float32_t * guarded_mel_neon = NULL;
+static ne10_float32_t * ceps_c = NULL;
+static ne10_float32_t * ceps_neon = NULL;
+static ne10_float32_t * mel_c = NULL;
+static ne10_float32_t * mel_neon = NULL;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static ne10_float32_t ceps_ref[MAX_MELS];
+static ne10_float32_t mel_ref[MAX_MELS];
+static ne10_float32_t snr = 0.0f;
+#endif
+#ifdef PERFORMANCE_TEST
+static ne10_int64_t time_c = 0;
+static ne10_int64_t time_neon = 0;
+static ne10_float32_t time_speedup = 0.0f;
+static ne10_float32_t time_savings = 0.0f;
+#endif
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+/* Double precision reference with dense triangles over all bins and a direct DCT-II */
+static void test_mfcc_ref (test_config * config,
+                           const ne10_fft_cpx_float32_t * pSrc,
+                           ne10_float32_t * pCeps,
+                           ne10_float32_t * pLogMel)
+{
+    ne10_float64_t melMin = 2595.0 * log10 (1.0 + config->fMin / 700.0);
+    ne10_float64_t melMax = 2595.0 * log10 (1.0 + config->fMax / 700.0);
+    ne10_float64_t edge[MAX_MELS + 2];
+    ne10_float64_t logMel[MAX_MELS];
+    ne10_float64_t freq, w, acc;
+    ne10_uint32_t m, j, k;
+
+    for (m = 0; m < config->numMels + 2; m++)
+    {
+        edge[m] = 700.0 * (pow (10.0, (melMin + (melMax - melMin) * m / (config->numMels + 1)) / 2595.0) - 1.0);
+    }
+    for (m = 0; m < config->numMels; m++)
+    {
+        acc = 0.0;
+        for (k = 0; k <= config->fftLen / 2; k++)
+        {
+            freq = (ne10_float64_t) k * config->sampleRate / config->fftLen;
+            w = (freq - edge[m]) / (edge[m + 1] - edge[m]);
+            if (freq > edge[m + 1])
+            {
+                w = (edge[m + 2] - freq) / (edge[m + 2] - edge[m + 1]);
+            }
+            if (w > 0.0)
+            {
+                acc += w * ( (ne10_float64_t) pSrc[k].r * pSrc[k].r + (ne10_float64_t) pSrc[k].i * pSrc[k].i);
+            }
+        }
+        logMel[m] = log ( (acc > NE10_MFCC_LOG_FLOOR) ? acc : NE10_MFCC_LOG_FLOOR);
+        pLogMel[m] = (ne10_float32_t) logMel[m];
+    }
+    for (j = 0; j < config->numCeps; j++)
+    {
+        acc = 0.0;
+        for (m = 0; m < config->numMels; m++)
+        {
+            acc += logMel[m] * cos (NE10_PI * j * (2 * m + 1) / (2.0 * config->numMels));
+        }
+        pCeps[j] = (ne10_float32_t) (acc * ( (j == 0) ? sqrt (1.0 / config->numMels) : sqrt (2.0 / config->numMels)));
+    }
+}
+#endif
+
+void test_mfcc_case0()
+{
+    ne10_fft_r2c_cfg_float32_t fftCfg;
+    ne10_fft_r2c_cfg_int16_t fftCfg_i16;
+    ne10_mfcc_cfg_float32_t cfg;
+
+    ne10_uint16_t loop = 0;
+    ne10_uint32_t i = 0;
+    ne10_uint32_t frame;
+
+    test_config *config;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (ceps_c, guarded_ceps_c, MAX_MELS);
+    NE10_DST_ALLOC (ceps_neon, guarded_ceps_neon, MAX_MELS);
+    NE10_DST_ALLOC (mel_c, guarded_mel_c, MAX_MELS);
+    NE10_DST_ALLOC (mel_neon, guarded_mel_neon, MAX_MELS);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_TESTS; loop++)
+    {
+        config = &CONFIG[loop];
+        cfg = ne10_mfcc_alloc_float32 (config->fftLen, config->sampleRate, config->numMels, config->numCeps,
+                                       config->fMin, config->fMax);
+        assert_true (cfg != NULL);
+        fftCfg = ne10_fft_alloc_r2c_float32 (config->fftLen);
+        fftCfg_i16 = ne10_fft_alloc_r2c_int16 (config->fftLen);
+
+        for (frame = 0; frame < TEST_FRAMES; frame++)
+        {
+            /* Q15 input at half scale, and the same samples in floating point */
+            for (i = 0; i < config->fftLen; i++)
+            {
+                testInput_i16[i] = (ne10_int16_t) ( (drand48() * 2.0 - 1.0) * 16384.0);
+                testInput_f32[i] = testInput_i16[i] / 32768.0f;
+            }
+            ne10_fft_r2c_1d_float32_c (spectrum_f32, testInput_f32, fftCfg);
+            ne10_fft_r2c_1d_int16_c (spectrum_i16, testInput_i16, fftCfg_i16, 1);
+#if defined (DEBUG_TRACE)
+            printf ("--------------------config %d frame %d\n", loop, frame);
+#endif
+
+            for (i = 0; i < MAX_MELS; i++)
+            {
+                ceps_c[i] = ceps_neon[i] = 0.0f;
+                mel_c[i] = mel_neon[i] = 0.0f;
+            }
+            GUARD_ARRAY (ceps_c, MAX_MELS);
+            GUARD_ARRAY (ceps_neon, MAX_MELS);
+            GUARD_ARRAY (mel_c, MAX_MELS);
+            GUARD_ARRAY (mel_neon, MAX_MELS);
+
+            //conformance test 1: floating-point spectrum against the double precision reference
+            test_mfcc_ref (config, spectrum_f32, ceps_ref, mel_ref);
+            ne10_mfcc_float32_c (cfg, ceps_c, mel_c, spectrum_f32);
+            ne10_mfcc_float32_neon (cfg, ceps_neon, mel_neon, spectrum_f32);
+            assert_true (CHECK_ARRAY_GUARD (ceps_c, MAX_MELS));
+            assert_true (CHECK_ARRAY_GUARD (ceps_neon, MAX_MELS));
+            assert_true (CHECK_ARRAY_GUARD (mel_c, MAX_MELS));
+            assert_true (CHECK_ARRAY_GUARD (mel_neon, MAX_MELS));
+
+            snr = CAL_SNR_FLOAT32 (mel_ref, mel_c, config->numMels);
+            assert_false ( (snr < SNR_THRESHOLD));
+            snr = CAL_SNR_FLOAT32 (mel_ref, mel_neon, config->numMels);
+            assert_false ( (snr < SNR_THRESHOLD));
+            snr = CAL_SNR_FLOAT32 (ceps_ref, ceps_c, config->numCeps);
+#if defined (DEBUG_TRACE)
+            printf ("snr ref/c %f\n", snr);
+#endif
+            assert_false ( (snr < SNR_THRESHOLD));
+            snr = CAL_SNR_FLOAT32 (ceps_ref, ceps_neon, config->numCeps);
+#if defined (DEBUG_TRACE)
+            printf ("snr ref/neon %f\n", snr);
+#endif
+            assert_false ( (snr < SNR_THRESHOLD));
+
+            //conformance test 2: the DCT is skipped without ceps output
+            ne10_mfcc_float32_neon (cfg, NULL, mel_neon, spectrum_f32);
+            snr = CAL_SNR_FLOAT32 (mel_ref, mel_neon, config->numMels);
+            assert_false ( (snr < SNR_THRESHOLD));
+
+            //conformance test 3: the Q15 spectrum matches the floating-point one
+            ne10_mfcc_int16_c (cfg, ceps_c, mel_c, spectrum_i16, 1);
+            ne10_mfcc_int16_neon (cfg, ceps_neon, mel_neon, spectrum_i16, 1);
+            snr = CAL_SNR_FLOAT32 (ceps_c, ceps_neon, config->numCeps);
+            assert_false ( (snr < SNR_THRESHOLD));
+            snr = CAL_SNR_FLOAT32 (mel_ref, mel_c, config->numMels);
+#if defined (DEBUG_TRACE)
+            printf ("snr log mel float/int16 %f\n", snr);
+#endif
+            assert_false ( (snr < 40.0f));
+            assert_true (CHECK_ARRAY_GUARD (ceps_c, MAX_MELS));
+            assert_true (CHECK_ARRAY_GUARD (ceps_neon, MAX_MELS));
+        }
+
+        ne10_fft_destroy_r2c_float32 (fftCfg);
+        ne10_fft_destroy_r2c_int16 (fftCfg_i16);
+        ne10_mfcc_destroy_float32 (cfg);
+    }
+
+    /* invalid sizes and bands are rejected */
+    assert_true (ne10_mfcc_alloc_float32 (511, 16000.0f, 40, 13, 20.0f, 8000.0f) == NULL);
+    assert_true (ne10_mfcc_alloc_float32 (512, 16000.0f, 40, 41, 20.0f, 8000.0f) == NULL);
+    assert_true (ne10_mfcc_alloc_float32 (512, 16000.0f, 40, 13, 20.0f, 8001.0f) == NULL);
+    assert_true (ne10_mfcc_alloc_float32 (512, 16000.0f, 40, 13, 4000.0f, 4000.0f) == NULL);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint16_t k;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "MFCC Length", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_PERF_TESTS; loop++)
+    {
+        config = &CONFIG_PERF[loop];
+        cfg = ne10_mfcc_alloc_float32 (config->fftLen, config->sampleRate, config->numMels, config->numCeps,
+                                       config->fMin, config->fMax);
+        for (i = 0; i <= config->fftLen / 2; i++)
+        {
+            spectrum_f32[i].r = (ne10_float32_t) (drand48() * 2.0f - 1.0f);
+            spectrum_f32[i].i = (ne10_float32_t) (drand48() * 2.0f - 1.0f);
+        }
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                ne10_mfcc_float32_c (cfg, ceps_c, mel_c, spectrum_f32);
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                ne10_mfcc_float32_neon (cfg, ceps_neon, mel_neon, spectrum_f32);
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", config->fftLen, time_c, time_neon, time_savings, time_speedup);
+        ne10_mfcc_destroy_float32 (cfg);
+    }
+#endif
+
+    free (guarded_ceps_c);
+    free (guarded_ceps_neon);
+    free (guarded_mel_c);
+    free (guarded_mel_neon);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_mfcc()
+{
+    test_mfcc_case0();
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_mfcc (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_mfcc);               // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
@@ -0,0 +1,315 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_resampler.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "NE10_dsp.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#define TEST_LENGTH_SAMPLES 1200
+#define MAX_OUTPUT_SAMPLES (4 * TEST_LENGTH_SAMPLES)
+#define MAX_NUMTAPS 480
+#define MAX_BLOCKSIZE 128
+#define SNR_THRESHOLD_RESAMPLER 90.0f
+
+#define TEST_COUNT 200
+
+/* ----------------------------------------------------------------------
+** Defines each of the tests performed
+** ------------------------------------------------------------------- */
+typedef struct
+{
+    ne10_uint16_t L;
+    ne10_uint16_t M;
+    ne10_uint16_t numTaps;
+    ne10_uint32_t blockSize;
+} test_config;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static test_config CONFIG[] =
+{
+    {3, 2, 36, 64},
+    {2, 3, 30, 17},
+    {160, 147, 480, 128},
+    {147, 160, 294, 100},
+    {1, 1, 9, 7},
+    {4, 1, 32, 1},
+    {5, 7, 65, 33}
+};
+#define NUM_TESTS (sizeof(CONFIG) / sizeof(CONFIG[0]) )
+#endif
+#ifdef PERFORMANCE_TEST
+static test_config CONFIG_PERF[] =
+{
+    {160, 147, 480, 128},
+    {147, 160, 294, 128},
+    {2, 1, 64, 128}
+};
+#define NUM_PERF_TESTS (sizeof(CONFIG_PERF) / sizeof(CONFIG_PERF[0]) )
+#endif
+
+static ne10_float32_t testInput_f32[TEST_LENGTH_SAMPLES];
+static ne10_float32_t testCoeffs_f32[MAX_NUMTAPS];
+static ne10_float32_t * guarded_out_c = NULL;
+static ne10_float32_t * guarded_out_neon = NULL;
+static ne10_float32_t * out_c = NULL;
+static ne10_float32_t * out_neon = NULL;
+static ne10_float32_t * out_ref = NULL;
+static ne10_float32_t * phase_coeffs_c = NULL;
+static ne10_float32_t * phase_coeffs_neon = NULL;
+static ne10_float32_t * state_c = NULL;
+static ne10_float32_t * state_neon = NULL;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static ne10_float32_t snr = 0.0f;
+#endif
+#ifdef PERFORMANCE_TEST
+static ne10_int64_t time_c = 0;
+static ne10_int64_t time_neon = 0;
+static ne10_float32_t time_speedup = 0.0f;
+static ne10_float32_t time_savings = 0.0f;
+#endif
+
+/* Upsample by L, filter with the (time reversed) prototype and keep every M-th sample */
+static ne10_uint32_t test_resampler_reference (test_config * config, ne10_float32_t * pDst)
+{
+    ne10_uint32_t outCnt = 0, t, i;
+    ne10_uint32_t end = TEST_LENGTH_SAMPLES * config->L;
+    ne10_float64_t acc;
+
+    for (t = 0; t < end; t += config->M)
+    {
+        acc = 0.0;
+        for (i = 0; i < config->numTaps && i <= t; i++)
+        {
+            if ( ( (t - i) % config->L) == 0)
+            {
+                acc += (ne10_float64_t) testCoeffs_f32[config->numTaps - 1 - i] * testInput_f32[ (t - i) / config->L];
+            }
+        }
+        pDst[outCnt++] = (ne10_float32_t) acc;
+    }
+    return outCnt;
+}
+
+static ne10_uint32_t test_resampler_run (ne10_uint32_t (*func) (ne10_resampler_instance_f32_t *, ne10_float32_t *, ne10_float32_t *, ne10_uint32_t),
+        ne10_resampler_instance_f32_t * S,
+        ne10_uint32_t blockSize,
+        ne10_float32_t * pDst)
+{
+    ne10_uint32_t pos = 0, outCnt = 0, len;
+
+    while (pos < TEST_LENGTH_SAMPLES)
+    {
+        len = NE10_MIN (blockSize, TEST_LENGTH_SAMPLES - pos);
+        outCnt += func (S, testInput_f32 + pos, pDst + outCnt, len);
+        pos += len;
+    }
+    return outCnt;
+}
+
+void test_resampler_case0()
+{
+    ne10_resampler_instance_f32_t SC, SN;
+    ne10_uint16_t loop = 0;
+    ne10_uint32_t i = 0;
+    ne10_uint32_t cnt_c, cnt_neon, cnt_ref;
+    test_config *config;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        testInput_f32[i] = (ne10_float32_t) (drand48() * 2.0f - 1.0f);
+    }
+    for (i = 0; i < MAX_NUMTAPS; i++)
+    {
+        testCoeffs_f32[i] = (ne10_float32_t) (drand48() * 2.0f - 1.0f);
+    }
+
+    NE10_DST_ALLOC (out_c, guarded_out_c, MAX_OUTPUT_SAMPLES);
+    NE10_DST_ALLOC (out_neon, guarded_out_neon, MAX_OUTPUT_SAMPLES);
+    out_ref = (ne10_float32_t*) malloc (MAX_OUTPUT_SAMPLES * sizeof (ne10_float32_t));
+    phase_coeffs_c = (ne10_float32_t*) malloc (MAX_NUMTAPS * sizeof (ne10_float32_t));
+    phase_coeffs_neon = (ne10_float32_t*) malloc (MAX_NUMTAPS * sizeof (ne10_float32_t));
+    state_c = (ne10_float32_t*) malloc ( (MAX_NUMTAPS + MAX_BLOCKSIZE) * sizeof (ne10_float32_t));
+    state_neon = (ne10_float32_t*) malloc ( (MAX_NUMTAPS + MAX_BLOCKSIZE) * sizeof (ne10_float32_t));
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_TESTS; loop++)
+    {
+        config = &CONFIG[loop];
+
+        /* rational mode */
+        assert_int_equal (NE10_OK, ne10_resampler_init_float (&SC, config->L, config->M, config->numTaps,
+                          testCoeffs_f32, phase_coeffs_c, state_c, config->blockSize));
+        assert_int_equal (NE10_OK, ne10_resampler_init_float (&SN, config->L, config->M, config->numTaps,
+                          testCoeffs_f32, phase_coeffs_neon, state_neon, config->blockSize));
+
+        GUARD_ARRAY (out_c, MAX_OUTPUT_SAMPLES);
+        GUARD_ARRAY (out_neon, MAX_OUTPUT_SAMPLES);
+
+        cnt_c = test_resampler_run (ne10_resampler_float_c, &SC, config->blockSize, out_c);
+        cnt_neon = test_resampler_run (ne10_resampler_float_neon, &SN, config->blockSize, out_neon);
+        cnt_ref = test_resampler_reference (config, out_ref);
+
+        assert_true (CHECK_ARRAY_GUARD (out_c, MAX_OUTPUT_SAMPLES));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, MAX_OUTPUT_SAMPLES));
+        assert_int_equal (cnt_ref, cnt_c);
+        assert_int_equal (cnt_ref, cnt_neon);
+
+        //conformance test 1: compare with the upsample-filter-downsample reference
+        snr = CAL_SNR_FLOAT32 (out_ref, out_c, cnt_ref);
+#if defined (DEBUG_TRACE)
+        printf ("--------------------config %d\n", loop);
+        printf ("rational snr ref/c %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD_RESAMPLER));
+        snr = CAL_SNR_FLOAT32 (out_ref, out_neon, cnt_ref);
+        assert_false ( (snr < SNR_THRESHOLD_RESAMPLER));
+
+        //conformance test 2: fractional mode with ratio M/L hits the same phases
+        assert_int_equal (NE10_OK, ne10_resampler_fractional_init_float (&SC, config->L, config->numTaps,
+                          testCoeffs_f32, phase_coeffs_c, state_c, config->blockSize, (ne10_float64_t) config->M / config->L));
+        assert_int_equal (NE10_OK, ne10_resampler_fractional_init_float (&SN, config->L, config->numTaps,
+                          testCoeffs_f32, phase_coeffs_neon, state_neon, config->blockSize, (ne10_float64_t) config->M / config->L));
+
+        cnt_c = test_resampler_run (ne10_resampler_float_c, &SC, config->blockSize, out_c);
+        cnt_neon = test_resampler_run (ne10_resampler_float_neon, &SN, config->blockSize, out_neon);
+
+        assert_true (CHECK_ARRAY_GUARD (out_c, MAX_OUTPUT_SAMPLES));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, MAX_OUTPUT_SAMPLES));
+        /* the outputs after the last input sample are still pending */
+        assert_true ( (cnt_c <= cnt_ref) && (cnt_c + config->L / config->M + 1 >= cnt_ref));
+        assert_int_equal (cnt_c, cnt_neon);
+
+        snr = CAL_SNR_FLOAT32 (out_ref, out_c, cnt_c);
+#if defined (DEBUG_TRACE)
+        printf ("fractional snr ref/c %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD_RESAMPLER));
+        snr = CAL_SNR_FLOAT32 (out_c, out_neon, cnt_c);
+        assert_false ( (snr < SNR_THRESHOLD_RESAMPLER));
+
+        //conformance test 3: a ratio changed between blocks gives the same result in C and NEON
+        ne10_resampler_fractional_init_float (&SC, config->L, config->numTaps, testCoeffs_f32, phase_coeffs_c, state_c, config->blockSize, 0.9);
+        ne10_resampler_fractional_init_float (&SN, config->L, config->numTaps, testCoeffs_f32, phase_coeffs_neon, state_neon, config->blockSize, 0.9);
+        cnt_c = ne10_resampler_float_c (&SC, testInput_f32, out_c, config->blockSize);
+        cnt_neon = ne10_resampler_float_neon (&SN, testInput_f32, out_neon, config->blockSize);
+        assert_int_equal (NE10_OK, ne10_resampler_set_ratio_float (&SC, 1.0001));
+        assert_int_equal (NE10_OK, ne10_resampler_set_ratio_float (&SN, 1.0001));
+        cnt_c += ne10_resampler_float_c (&SC, testInput_f32 + config->blockSize, out_c + cnt_c, config->blockSize);
+        cnt_neon += ne10_resampler_float_neon (&SN, testInput_f32 + config->blockSize, out_neon + cnt_neon, config->blockSize);
+        assert_int_equal (cnt_c, cnt_neon);
+        snr = CAL_SNR_FLOAT32 (out_c, out_neon, cnt_c);
+        assert_false ( (snr < SNR_THRESHOLD_RESAMPLER));
+    }
+
+    /* the prototype length must be a multiple of L */
+    assert_int_equal (NE10_ERR, ne10_resampler_init_float (&SC, 3, 2, 10, testCoeffs_f32, phase_coeffs_c, state_c, 16));
+    assert_int_equal (NE10_ERR, ne10_resampler_set_ratio_float (&SC, 0.0));
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint16_t k;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Resampler Taps", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_PERF_TESTS; loop++)
+    {
+        config = &CONFIG_PERF[loop];
+
+        ne10_resampler_init_float (&SC, config->L, config->M, config->numTaps, testCoeffs_f32, phase_coeffs_c, state_c, config->blockSize);
+        ne10_resampler_init_float (&SN, config->L, config->M, config->numTaps, testCoeffs_f32, phase_coeffs_neon, state_neon, config->blockSize);
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                test_resampler_run (ne10_resampler_float_c, &SC, config->blockSize, out_c);
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                test_resampler_run (ne10_resampler_float_neon, &SN, config->blockSize, out_neon);
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", config->numTaps, time_c, time_neon, time_savings, time_speedup);
+    }
+#endif
+
+    free (guarded_out_c);
+    free (guarded_out_neon);
+    free (out_ref);
+    free (phase_coeffs_c);
+    free (phase_coeffs_neon);
+    free (state_c);
+    free (state_neon);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_resampler()
+{
+    test_resampler_case0();
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_resampler (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_resampler);         // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
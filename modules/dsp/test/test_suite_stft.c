@@ -0,0 +1,321 @@
+/*
+ *  Copyright 2012-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_stft.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "NE10_dsp.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#define TEST_LENGTH_SAMPLES 4096
+#define MAX_FRAMELEN 512
+#define MAX_SPECTRA_LEN (TEST_LENGTH_SAMPLES * 2 + MAX_FRAMELEN)
+
+#define TEST_COUNT 200
+
+/* ----------------------------------------------------------------------
+** Defines each of the tests performed
+** ------------------------------------------------------------------- */
+typedef struct
+{
+    ne10_uint32_t frameLen;
+    ne10_uint32_t hopSize;
+    ne10_uint32_t windowType;
+    ne10_float32_t beta;
+    ne10_uint32_t chunkSize;
+    ne10_uint32_t numFrames;
+} test_config;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static test_config CONFIG[] =
+{
+    {256, 64, NE10_WINDOW_HANN, 0.0f, 100, 4},
+    {512, 128, NE10_WINDOW_HAMMING, 0.0f, 4096, 2},
+    {64, 16, NE10_WINDOW_BLACKMAN, 0.0f, 1, 1},
+    {128, 32, NE10_WINDOW_KAISER, 8.0f, 333, 8},
+    {32, 16, NE10_WINDOW_CUSTOM, 0.0f, 7, 3},
+    {16, 5, NE10_WINDOW_HANN, 0.0f, 64, 16}
+};
+#define NUM_TESTS (sizeof(CONFIG) / sizeof(CONFIG[0]) )
+#endif
+#ifdef PERFORMANCE_TEST
+static test_config CONFIG_PERF[] =
+{
+    {256, 64, NE10_WINDOW_HANN, 0.0f, 256, 16},
+    {512, 256, NE10_WINDOW_HANN, 0.0f, 512, 16},
+    {1024, 256, NE10_WINDOW_HANN, 0.0f, 1024, 16}
+};
+#define NUM_PERF_TESTS (sizeof(CONFIG_PERF) / sizeof(CONFIG_PERF[0]) )
+#endif
+
+//input and output
+static ne10_float32_t testInput_f32[TEST_LENGTH_SAMPLES];
+static ne10_float32_t testWindow_f32[MAX_FRAMELEN];
+static ne10_float32_t * guarded_out_c = NULL;
+static ne10_float32_t * guarded_out_neon = NULL;
+static ne10_float32_t * out_c = NULL;
+static ne10_float32_t * out_neon = NULL;
+static ne10_float32_t * spec_c = NULL;
+static ne10_float32_t * spec_neon = NULL;
+static ne10_float32_t * spec_ref = NULL;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static ne10_float32_t snr = 0.0f;
+#endif
+#ifdef PERFORMANCE_TEST
+static ne10_int64_t time_c = 0;
+static ne10_int64_t time_neon = 0;
+static ne10_float32_t time_speedup = 0.0f;
+static ne10_float32_t time_savings = 0.0f;
+#endif
+
+typedef ne10_uint32_t (*test_stft_func_t) (ne10_stft_cfg_float32_t, ne10_float32_t *, ne10_uint32_t);
+typedef ne10_uint32_t (*test_istft_func_t) (ne10_stft_cfg_float32_t, ne10_float32_t *, ne10_fft_cpx_float32_t *);
+
+/*
+ * Streams the input through the STFT in chunks, copies the spectra to pSpectra and, when an ISTFT is given,
+ * resynthesizes them into pOut. Returns the number of frames.
+ */
+static ne10_uint32_t test_stft_run (test_config * config,
+                                    test_stft_func_t stft,
+                                    test_istft_func_t istft,
+                                    ne10_float32_t * pSpectra,
+                                    ne10_float32_t * pOut)
+{
+    ne10_stft_cfg_float32_t cfg, icfg = NULL;
+    ne10_fft_cpx_float32_t *pSpectrum;
+    ne10_uint32_t numBins = config->frameLen / 2 + 1;
+    ne10_uint32_t pos, n, done, frames = 0;
+
+    cfg = ne10_stft_alloc_float32 (config->frameLen, config->hopSize, config->numFrames,
+                                   config->windowType, config->beta, testWindow_f32);
+    if (istft != NULL)
+    {
+        icfg = ne10_istft_alloc_float32 (config->frameLen, config->hopSize, config->windowType, config->beta, testWindow_f32);
+    }
+
+    for (pos = 0; pos < TEST_LENGTH_SAMPLES; pos += n)
+    {
+        n = (TEST_LENGTH_SAMPLES - pos < config->chunkSize) ? TEST_LENGTH_SAMPLES - pos : config->chunkSize;
+        done = 0;
+        while (done < n)
+        {
+            done += stft (cfg, testInput_f32 + pos + done, n - done);
+            while ( (pSpectrum = ne10_stft_read_float32 (cfg)) != NULL)
+            {
+                memcpy (pSpectra + frames * 2 * numBins, pSpectrum, numBins * sizeof (ne10_fft_cpx_float32_t));
+                if (istft != NULL)
+                {
+                    istft (icfg, pOut + frames * config->hopSize, pSpectrum);
+                }
+                frames++;
+            }
+        }
+    }
+
+    ne10_stft_destroy_float32 (cfg);
+    ne10_stft_destroy_float32 (icfg);
+    return frames;
+}
+
+void test_stft_case0()
+{
+    ne10_fft_r2c_cfg_float32_t fftCfg;
+    ne10_stft_cfg_float32_t cfg;
+    ne10_float32_t frame[MAX_FRAMELEN];
+
+    ne10_uint16_t loop = 0;
+    ne10_uint32_t i = 0;
+    ne10_uint32_t frames, framesRef, numBins, start, length;
+
+    test_config *config;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+    {
+        testInput_f32[i] = (ne10_float32_t) (drand48() * 2.0f - 1.0f);
+    }
+    /* custom window: square root of a Hann window of length 32 */
+    for (i = 0; i < 32; i++)
+    {
+        testWindow_f32[i] = sqrtf (0.5f - 0.5f * cosf (2.0f * NE10_PI * i / 32));
+    }
+
+    /* init dst memory */
+    NE10_DST_ALLOC (out_c, guarded_out_c, TEST_LENGTH_SAMPLES);
+    NE10_DST_ALLOC (out_neon, guarded_out_neon, TEST_LENGTH_SAMPLES);
+    spec_c = (ne10_float32_t*) malloc (MAX_SPECTRA_LEN * 2 * sizeof (ne10_float32_t));
+    spec_neon = (ne10_float32_t*) malloc (MAX_SPECTRA_LEN * 2 * sizeof (ne10_float32_t));
+    spec_ref = (ne10_float32_t*) malloc (MAX_SPECTRA_LEN * 2 * sizeof (ne10_float32_t));
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_TESTS; loop++)
+    {
+        config = &CONFIG[loop];
+        numBins = config->frameLen / 2 + 1;
+
+        /* reference: window and transform every whole frame separately */
+        cfg = ne10_stft_alloc_float32 (config->frameLen, config->hopSize, 1, config->windowType, config->beta, testWindow_f32);
+        assert_true (cfg != NULL);
+        fftCfg = ne10_fft_alloc_r2c_float32 (config->frameLen);
+        for (framesRef = 0; framesRef * config->hopSize + config->frameLen <= TEST_LENGTH_SAMPLES; framesRef++)
+        {
+            for (i = 0; i < config->frameLen; i++)
+            {
+                frame[i] = testInput_f32[framesRef * config->hopSize + i] * cfg->pWindow[i];
+            }
+            ne10_fft_r2c_1d_float32_c ( (ne10_fft_cpx_float32_t *) (spec_ref + framesRef * 2 * numBins), frame, fftCfg);
+        }
+        ne10_fft_destroy_r2c_float32 (fftCfg);
+        ne10_stft_destroy_float32 (cfg);
+
+        for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+        {
+            out_c[i] = 0;
+            out_neon[i] = 0;
+        }
+        GUARD_ARRAY (out_c, TEST_LENGTH_SAMPLES);
+        GUARD_ARRAY (out_neon, TEST_LENGTH_SAMPLES);
+
+        frames = test_stft_run (config, ne10_stft_float32_c, ne10_istft_float32_c, spec_c, out_c);
+        assert_int_equal (framesRef, frames);
+        frames = test_stft_run (config, ne10_stft_float32_neon, ne10_istft_float32_neon, spec_neon, out_neon);
+        assert_int_equal (framesRef, frames);
+
+        assert_true (CHECK_ARRAY_GUARD (out_c, TEST_LENGTH_SAMPLES));
+        assert_true (CHECK_ARRAY_GUARD (out_neon, TEST_LENGTH_SAMPLES));
+
+        //conformance test 1: spectra of the streaming transform against frame by frame transforms
+        snr = CAL_SNR_FLOAT32 (spec_ref, spec_c, frames * 2 * numBins);
+#if defined (DEBUG_TRACE)
+        printf ("--------------------config %d frames %d\n", loop, frames);
+        printf ("snr ref/c %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+        snr = CAL_SNR_FLOAT32 (spec_ref, spec_neon, frames * 2 * numBins);
+#if defined (DEBUG_TRACE)
+        printf ("snr ref/neon %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+
+        //conformance test 2: resynthesis without delay after the first frameLen-hopSize samples
+        start = config->frameLen - config->hopSize;
+        length = (frames - 1) * config->hopSize + config->hopSize - start;
+        snr = CAL_SNR_FLOAT32 (testInput_f32 + start, out_c + start, length);
+#if defined (DEBUG_TRACE)
+        printf ("snr resynthesis c %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+        snr = CAL_SNR_FLOAT32 (testInput_f32 + start, out_neon + start, length);
+#if defined (DEBUG_TRACE)
+        printf ("snr resynthesis neon %f\n", snr);
+#endif
+        assert_false ( (snr < SNR_THRESHOLD));
+    }
+
+    /* invalid sizes and windows are rejected */
+    assert_true (ne10_stft_alloc_float32 (96, 32, 4, NE10_WINDOW_HANN, 0.0f, NULL) == NULL);
+    assert_true (ne10_stft_alloc_float32 (64, 65, 4, NE10_WINDOW_HANN, 0.0f, NULL) == NULL);
+    assert_true (ne10_stft_alloc_float32 (64, 16, 4, NE10_WINDOW_CUSTOM, 0.0f, NULL) == NULL);
+    assert_true (ne10_istft_alloc_float32 (64, 64, NE10_WINDOW_HANN, 0.0f, NULL) == NULL);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint16_t k;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "STFT Length", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_PERF_TESTS; loop++)
+    {
+        config = &CONFIG_PERF[loop];
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                test_stft_run (config, ne10_stft_float32_c, ne10_istft_float32_c, spec_c, out_c);
+            }
+        }
+        );
+
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                test_stft_run (config, ne10_stft_float32_neon, ne10_istft_float32_neon, spec_neon, out_neon);
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", config->frameLen, time_c, time_neon, time_savings, time_speedup);
+    }
+#endif
+
+    free (guarded_out_c);
+    free (guarded_out_neon);
+    free (spec_c);
+    free (spec_neon);
+    free (spec_ref);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_stft()
+{
+    test_stft_case0();
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_stft (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_stft);               // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
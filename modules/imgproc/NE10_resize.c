@@ -210,7 +210,8 @@ static void ne10_img_resize_generic_linear_c (ne10_uint8_t* src,
         ne10_int32_t srcstep,
         ne10_int32_t dstw,
         ne10_int32_t dsth,
-        ne10_int32_t channels)
+        ne10_int32_t channels,
+        ne10_int32_t* buffer_)
 {
 
     const ne10_int16_t* alpha = _alpha;
@@ -222,9 +223,6 @@ static void ne10_img_resize_generic_linear_c (ne10_uint8_t* src,
     ne10_int32_t bufstep = (ne10_int32_t) ne10_align_size (dstw, 16);
     ne10_int32_t dststep = (ne10_int32_t) ne10_align_size (dstw, 4);
 
-
-    ne10_int32_t *buffer_ = (ne10_int32_t*) NE10_MALLOC (bufstep * ksize * sizeof (ne10_int32_t));
-
     const ne10_uint8_t* srows[NE10_MAX_ESIZE];
     ne10_int32_t* rows[NE10_MAX_ESIZE];
     ne10_int32_t prev_sy[NE10_MAX_ESIZE];
@@ -267,8 +265,6 @@ static void ne10_img_resize_generic_linear_c (ne10_uint8_t* src,
 
         ne10_img_vresize_linear_c ( (const ne10_int32_t**) rows, (ne10_uint8_t*) (dst + dststep * dy), beta, dstw);
     }
-
-    NE10_FREE (buffer_);
 }
 
 static void ne10_img_resize_cal_offset_linear (ne10_int32_t* xofs,
@@ -374,7 +370,8 @@ static void ne10_img_resize_generic_linear_neon (ne10_uint8_t* src,
         ne10_int32_t srcstep,
         ne10_int32_t dstw,
         ne10_int32_t dsth,
-        ne10_int32_t channels)
+        ne10_int32_t channels,
+        ne10_int32_t* buffer_)
 {
 
     const ne10_int16_t* alpha = _alpha;
@@ -386,9 +383,6 @@ static void ne10_img_resize_generic_linear_neon (ne10_uint8_t* src,
     ne10_int32_t bufstep = (ne10_int32_t) ne10_align_size (dstw, 16);
     ne10_int32_t dststep = (ne10_int32_t) ne10_align_size (dstw, 4);
 
-
-    ne10_int32_t *buffer_ = (ne10_int32_t*) NE10_MALLOC (bufstep * ksize * sizeof (ne10_int32_t));
-
     const ne10_uint8_t* srows[NE10_MAX_ESIZE];
     ne10_int32_t* rows[NE10_MAX_ESIZE];
     ne10_int32_t prev_sy[NE10_MAX_ESIZE];
@@ -436,8 +430,6 @@ static void ne10_img_resize_generic_linear_neon (ne10_uint8_t* src,
         }
         ne10_img_vresize_linear_neon ( (const ne10_int32_t**) rows, (ne10_uint8_t*) (dst + dststep * dy), beta, dstw);
     }
-
-    NE10_FREE (buffer_);
 }
 
 /**
@@ -468,7 +460,15 @@ void ne10_img_resize_bilinear_rgba_c (ne10_uint8_t* dst,
     ksize = 2;
     ksize2 = ksize / 2;
 
-    ne10_uint8_t *buffer_ = (ne10_uint8_t*) NE10_MALLOC ( (width + dsth) * (sizeof (ne10_int32_t) + sizeof (ne10_float32_t) * ksize));
+    // the offset tables and the row buffer share a single allocation
+    ne10_int32_t tabsize = (ne10_int32_t) ne10_align_size ( (width + dsth) * (sizeof (ne10_int32_t) + sizeof (ne10_float32_t) * ksize), 16);
+    ne10_int32_t bufsize = (ne10_int32_t) ne10_align_size (width, 16) * ksize * sizeof (ne10_int32_t);
+    ne10_uint8_t *buffer_ = (ne10_uint8_t*) NE10_MALLOC (tabsize + bufsize);
+
+    if (!buffer_)
+    {
+        return;
+    }
 
     ne10_int32_t* xofs = (ne10_int32_t*) buffer_;
     ne10_int32_t* yofs = xofs + width;
@@ -477,7 +477,7 @@ void ne10_img_resize_bilinear_rgba_c (ne10_uint8_t* dst,
 
     ne10_img_resize_cal_offset_linear (xofs, ialpha, yofs, ibeta, &xmin, &xmax, ksize, ksize2, srcw, srch, dstw, dsth, cn);
 
-    ne10_img_resize_generic_linear_c (src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, srcw, srch, src_stride, dstw, dsth, cn);
+    ne10_img_resize_generic_linear_c (src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, srcw, srch, src_stride, dstw, dsth, cn, (ne10_int32_t*) (buffer_ + tabsize));
     NE10_FREE (buffer_);
 }
 
@@ -509,7 +509,15 @@ void ne10_img_resize_bilinear_rgba_neon (ne10_uint8_t* dst,
     ksize = 2;
     ksize2 = ksize / 2;
 
-    ne10_uint8_t *buffer_ = (ne10_uint8_t*) NE10_MALLOC ( (width + dsth) * (sizeof (ne10_int32_t) + sizeof (ne10_float32_t) * ksize));
+    // the offset tables and the row buffer share a single allocation
+    ne10_int32_t tabsize = (ne10_int32_t) ne10_align_size ( (width + dsth) * (sizeof (ne10_int32_t) + sizeof (ne10_float32_t) * ksize), 16);
+    ne10_int32_t bufsize = (ne10_int32_t) ne10_align_size (width, 16) * ksize * sizeof (ne10_int32_t);
+    ne10_uint8_t *buffer_ = (ne10_uint8_t*) NE10_MALLOC (tabsize + bufsize);
+
+    if (!buffer_)
+    {
+        return;
+    }
 
     ne10_int32_t* xofs = (ne10_int32_t*) buffer_;
     ne10_int32_t* yofs = xofs + width;
@@ -518,7 +526,7 @@ void ne10_img_resize_bilinear_rgba_neon (ne10_uint8_t* dst,
 
     ne10_img_resize_cal_offset_linear (xofs, ialpha, yofs, ibeta, &xmin, &xmax, ksize, ksize2, srcw, srch, dstw, dsth, cn);
 
-    ne10_img_resize_generic_linear_neon (src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, srcw, srch, src_stride, dstw, dsth, cn);
+    ne10_img_resize_generic_linear_neon (src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, srcw, srch, src_stride, dstw, dsth, cn, (ne10_int32_t*) (buffer_ + tabsize));
     NE10_FREE (buffer_);
 }
 
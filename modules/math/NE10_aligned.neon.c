@@ -0,0 +1,164 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * NE10 Library : math/NE10_aligned.neon.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_math.h"
+#include "macros.h"
+
+#include <arm_neon.h>
+
+/*
+ * Runs loopCode on the four quadwords of every block, with k the index of the
+ * quadword. As the pointers are aligned and the blocks whole, there is no
+ * scalar tail, and the loads and stores carry the alignment hint.
+ */
+#define NE10_ALIGNED_DO_BLOCKS_FLOAT_NEON(loopCode) { \
+    ne10_uint32_t itr; \
+    for (itr = 0; itr < count; itr += NE10_ALIGNED_BLOCK) \
+    { \
+        { const ne10_uint32_t k = itr; loopCode } \
+        { const ne10_uint32_t k = itr + 4; loopCode } \
+        { const ne10_uint32_t k = itr + 8; loopCode } \
+        { const ne10_uint32_t k = itr + 12; loopCode } \
+    } \
+    return NE10_OK; \
+}
+
+ne10_result_t ne10_addc_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count)
+{
+    ne10_float32_t * d = NE10_ASSUME_ALIGNED (dst);
+    ne10_float32_t * s = NE10_ASSUME_ALIGNED (src);
+    float32x4_t n_cst = vdupq_n_f32 (cst);
+
+    NE10_ALIGNED_DO_BLOCKS_FLOAT_NEON
+    (
+        vst1q_f32 (d + k, vaddq_f32 (vld1q_f32 (s + k), n_cst));
+    );
+}
+
+ne10_result_t ne10_subc_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count)
+{
+    ne10_float32_t * d = NE10_ASSUME_ALIGNED (dst);
+    ne10_float32_t * s = NE10_ASSUME_ALIGNED (src);
+    float32x4_t n_cst = vdupq_n_f32 (cst);
+
+    NE10_ALIGNED_DO_BLOCKS_FLOAT_NEON
+    (
+        vst1q_f32 (d + k, vsubq_f32 (vld1q_f32 (s + k), n_cst));
+    );
+}
+
+ne10_result_t ne10_mulc_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count)
+{
+    ne10_float32_t * d = NE10_ASSUME_ALIGNED (dst);
+    ne10_float32_t * s = NE10_ASSUME_ALIGNED (src);
+    float32x4_t n_cst = vdupq_n_f32 (cst);
+
+    NE10_ALIGNED_DO_BLOCKS_FLOAT_NEON
+    (
+        vst1q_f32 (d + k, vmulq_f32 (vld1q_f32 (s + k), n_cst));
+    );
+}
+
+ne10_result_t ne10_mlac_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count)
+{
+    ne10_float32_t * d = NE10_ASSUME_ALIGNED (dst);
+    ne10_float32_t * a = NE10_ASSUME_ALIGNED (acc);
+    ne10_float32_t * s = NE10_ASSUME_ALIGNED (src);
+    float32x4_t n_cst = vdupq_n_f32 (cst);
+
+    NE10_ALIGNED_DO_BLOCKS_FLOAT_NEON
+    (
+        vst1q_f32 (d + k, vmlaq_f32 (vld1q_f32 (a + k), vld1q_f32 (s + k), n_cst));
+    );
+}
+
+ne10_result_t ne10_setc_float_aligned_neon (ne10_float32_t * dst, const ne10_float32_t cst, ne10_uint32_t count)
+{
+    ne10_float32_t * d = NE10_ASSUME_ALIGNED (dst);
+    float32x4_t n_cst = vdupq_n_f32 (cst);
+
+    NE10_ALIGNED_DO_BLOCKS_FLOAT_NEON
+    (
+        vst1q_f32 (d + k, n_cst);
+    );
+}
+
+ne10_result_t ne10_add_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_float32_t * d = NE10_ASSUME_ALIGNED (dst);
+    ne10_float32_t * s1 = NE10_ASSUME_ALIGNED (src1);
+    ne10_float32_t * s2 = NE10_ASSUME_ALIGNED (src2);
+
+    NE10_ALIGNED_DO_BLOCKS_FLOAT_NEON
+    (
+        vst1q_f32 (d + k, vaddq_f32 (vld1q_f32 (s1 + k), vld1q_f32 (s2 + k)));
+    );
+}
+
+ne10_result_t ne10_sub_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_float32_t * d = NE10_ASSUME_ALIGNED (dst);
+    ne10_float32_t * s1 = NE10_ASSUME_ALIGNED (src1);
+    ne10_float32_t * s2 = NE10_ASSUME_ALIGNED (src2);
+
+    NE10_ALIGNED_DO_BLOCKS_FLOAT_NEON
+    (
+        vst1q_f32 (d + k, vsubq_f32 (vld1q_f32 (s1 + k), vld1q_f32 (s2 + k)));
+    );
+}
+
+ne10_result_t ne10_mul_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_float32_t * d = NE10_ASSUME_ALIGNED (dst);
+    ne10_float32_t * s1 = NE10_ASSUME_ALIGNED (src1);
+    ne10_float32_t * s2 = NE10_ASSUME_ALIGNED (src2);
+
+    NE10_ALIGNED_DO_BLOCKS_FLOAT_NEON
+    (
+        vst1q_f32 (d + k, vmulq_f32 (vld1q_f32 (s1 + k), vld1q_f32 (s2 + k)));
+    );
+}
+
+ne10_result_t ne10_mla_float_aligned_neon (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_float32_t * d = NE10_ASSUME_ALIGNED (dst);
+    ne10_float32_t * a = NE10_ASSUME_ALIGNED (acc);
+    ne10_float32_t * s1 = NE10_ASSUME_ALIGNED (src1);
+    ne10_float32_t * s2 = NE10_ASSUME_ALIGNED (src2);
+
+    NE10_ALIGNED_DO_BLOCKS_FLOAT_NEON
+    (
+        vst1q_f32 (d + k, vmlaq_f32 (vld1q_f32 (a + k), vld1q_f32 (s1 + k), vld1q_f32 (s2 + k)));
+    );
+}
@@ -0,0 +1,269 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * NE10 Library : math/NE10_convert.c
+ */
+
+#include "NE10_types.h"
+#include "macros.h"
+
+#include <assert.h>
+#include <float.h>
+#include <string.h>
+
+/*
+ * Rounds x to an integer in the given mode, saturating to the int32 range
+ * and mapping NaN to 0 as the NEON VCVT instruction does. The remainder
+ * x - trunc(x) is exact, so the ties are detected without the double
+ * rounding of adding 0.5 before truncating. A subnormal remainder counts
+ * as zero, as under the flush to zero of ARMv7 NEON.
+ */
+static inline ne10_int32_t ne10_convert_round_c (ne10_float32_t x, ne10_round_mode_t mode)
+{
+    ne10_int64_t i;
+    ne10_float32_t r;
+
+    if (x != x)
+        return 0;
+    if (x >= 2147483648.0f)
+        i = 2147483647;
+    else if (x <= -2147483648.0f)
+        i = -2147483647 - 1;
+    else
+        i = (ne10_int32_t) x;
+    r = x - (ne10_float32_t) i;
+
+    if (mode == NE10_ROUND_NEAREST)
+    {
+        if (r >= 0.5f)
+            i++;
+        else if (r <= -0.5f)
+            i--;
+    }
+    else if (mode == NE10_ROUND_FLOOR)
+    {
+        if (r <= -FLT_MIN)
+            i--;
+    }
+
+    if (i > 2147483647)
+        i = 2147483647;
+    if (i < -2147483647 - 1)
+        i = -2147483647 - 1;
+    return (ne10_int32_t) i;
+}
+
+ne10_result_t ne10_convert_float_q15_c (ne10_int16_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count)
+{
+    if ( (ne10_uint32_t) mode > NE10_ROUND_FLOOR)
+        return NE10_ERR;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_int32_t i = ne10_convert_round_c (src[ itr ] * scale, mode);
+
+        if (i > 32767)
+            i = 32767;
+        if (i < -32768)
+            i = -32768;
+        dst[ itr ] = (ne10_int16_t) i;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_convert_q15_float_c (ne10_float32_t * dst, ne10_int16_t * src, ne10_float32_t scale, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = (ne10_float32_t) src[ itr ] * scale;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_convert_float_q31_c (ne10_int32_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count)
+{
+    if ( (ne10_uint32_t) mode > NE10_ROUND_FLOOR)
+        return NE10_ERR;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = ne10_convert_round_c (src[ itr ] * scale, mode);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_convert_q31_float_c (ne10_float32_t * dst, ne10_int32_t * src, ne10_float32_t scale, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = (ne10_float32_t) src[ itr ] * scale;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_convert_float_u8_c (ne10_uint8_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count)
+{
+    if ( (ne10_uint32_t) mode > NE10_ROUND_FLOOR)
+        return NE10_ERR;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_int32_t i = ne10_convert_round_c (src[ itr ] * scale, mode);
+
+        if (i > 255)
+            i = 255;
+        if (i < 0)
+            i = 0;
+        dst[ itr ] = (ne10_uint8_t) i;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_convert_u8_float_c (ne10_float32_t * dst, ne10_uint8_t * src, ne10_float32_t scale, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = (ne10_float32_t) src[ itr ] * scale;
+    }
+    return NE10_OK;
+}
+
+/*
+ * Single to half precision with round to nearest even. Overflow gives
+ * infinity and every NaN becomes the quiet NaN 0x7e00.
+ */
+static inline ne10_float16_t ne10_convert_f32_f16_c (ne10_float32_t f)
+{
+    ne10_uint32_t x, sign, h;
+
+    memcpy (&x, &f, sizeof (x));
+    sign = x & 0x80000000;
+    x ^= sign;
+
+    if (x >= 0x47800000)
+    {
+        /* |f| >= 65536, infinity or NaN */
+        h = (x > 0x7f800000) ? 0x7e00 : 0x7c00;
+    }
+    else if (x < 0x38800000)
+    {
+        /* |f| < 2^-14: adding 0.5 aligns the half precision subnormal to the
+         * last mantissa bits and rounds it */
+        memcpy (&f, &x, sizeof (f));
+        f += 0.5f;
+        memcpy (&h, &f, sizeof (h));
+        h -= 0x3f000000;
+    }
+    else
+    {
+        /* rebias the exponent and round the 13 dropped bits to nearest even;
+         * a carry out of the mantissa gives the next exponent or infinity */
+        x += 0xc8000fff + ( (x >> 13) & 1);
+        h = x >> 13;
+    }
+    return (ne10_float16_t) (h | (sign >> 16));
+}
+
+/* half to single precision is exact; subnormals are normalised through a subtraction */
+static inline ne10_float32_t ne10_convert_f16_f32_c (ne10_float16_t h)
+{
+    ne10_uint32_t x = (ne10_uint32_t) (h & 0x7fff) << 13;
+    ne10_uint32_t exp = x & 0x0f800000;
+    ne10_float32_t f, magic;
+
+    x += 0x38000000;
+    if (exp == 0x0f800000)
+    {
+        /* infinity or NaN */
+        x += 0x38000000;
+    }
+    else if (exp == 0)
+    {
+        x += 0x00800000;
+        memcpy (&f, &x, sizeof (f));
+        exp = 0x38800000;
+        memcpy (&magic, &exp, sizeof (magic));
+        f -= magic;
+        memcpy (&x, &f, sizeof (x));
+    }
+    x |= (ne10_uint32_t) (h & 0x8000) << 16;
+    memcpy (&f, &x, sizeof (f));
+    return f;
+}
+
+ne10_result_t ne10_convert_float_f16_c (ne10_float16_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = ne10_convert_f32_f16_c (src[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_convert_f16_float_c (ne10_float32_t * dst, ne10_float16_t * src, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = ne10_convert_f16_f32_c (src[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_convert_int16_int32_c (ne10_int32_t * dst, ne10_int16_t * src, ne10_uint32_t shift, ne10_uint32_t count)
+{
+    if (shift > 16)
+        return NE10_ERR;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = (ne10_int32_t) ( (ne10_uint32_t) (ne10_int32_t) src[ itr ] << shift);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_convert_int32_int16_c (ne10_int16_t * dst, ne10_int32_t * src, ne10_uint32_t shift, ne10_uint32_t count)
+{
+    if (shift > 31)
+        return NE10_ERR;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_int64_t x = src[ itr ];
+
+        /* rounding shift, with ties toward plus infinity as VRSHL */
+        if (shift > 0)
+            x = (x + ( (ne10_int64_t) 1 << (shift - 1))) >> shift;
+        if (x > 32767)
+            x = 32767;
+        if (x < -32768)
+            x = -32768;
+        dst[ itr ] = (ne10_int16_t) x;
+    }
+    return NE10_OK;
+}
@@ -0,0 +1,269 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * NE10 Library : math/NE10_convert.neon.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+
+#include <assert.h>
+#include <float.h>
+#include <arm_neon.h>
+
+/*
+ * Rounds four values to integers in the given mode. VCVT truncates and
+ * saturates, and the remainder x - trunc(x) is exact, so the rounding is
+ * applied with saturating increments of the truncated value. A subnormal
+ * remainder is compared against -FLT_MIN, so AArch64 rounds it like the
+ * flush to zero of ARMv7. The result matches ne10_convert_round_c in
+ * NE10_convert.c bit for bit.
+ */
+static inline int32x4_t ne10_convert_round_neon (float32x4_t x, ne10_round_mode_t mode)
+{
+    int32x4_t i = vcvtq_s32_f32 (x);
+    float32x4_t r = vsubq_f32 (x, vcvtq_f32_s32 (i));
+
+    if (mode == NE10_ROUND_NEAREST)
+    {
+        /* the comparison masks are -1 where true */
+        i = vqsubq_s32 (i, vreinterpretq_s32_u32 (vcgeq_f32 (r, vdupq_n_f32 (0.5f))));
+        i = vqaddq_s32 (i, vreinterpretq_s32_u32 (vcleq_f32 (r, vdupq_n_f32 (-0.5f))));
+    }
+    else if (mode == NE10_ROUND_FLOOR)
+    {
+        i = vqaddq_s32 (i, vreinterpretq_s32_u32 (vcleq_f32 (r, vdupq_n_f32 (-FLT_MIN))));
+    }
+    return i;
+}
+
+ne10_result_t ne10_convert_float_q15_neon (ne10_int16_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count)
+{
+    float32x4_t n_scale = vdupq_n_f32 (scale);
+    int32x4_t i0, i1;
+
+    if ( (ne10_uint32_t) mode > NE10_ROUND_FLOOR)
+        return NE10_ERR;
+
+    for (; count >= 8; count -= 8)
+    {
+        i0 = ne10_convert_round_neon (vmulq_f32 (vld1q_f32 (src), n_scale), mode);
+        i1 = ne10_convert_round_neon (vmulq_f32 (vld1q_f32 (src + 4), n_scale), mode);
+        vst1q_s16 (dst, vcombine_s16 (vqmovn_s32 (i0), vqmovn_s32 (i1)));
+        src += 8;
+        dst += 8;
+    }
+    return ne10_convert_float_q15_c (dst, src, scale, mode, count);
+}
+
+ne10_result_t ne10_convert_q15_float_neon (ne10_float32_t * dst, ne10_int16_t * src, ne10_float32_t scale, ne10_uint32_t count)
+{
+    float32x4_t n_scale = vdupq_n_f32 (scale);
+    int16x8_t x;
+
+    for (; count >= 8; count -= 8)
+    {
+        x = vld1q_s16 (src);
+        vst1q_f32 (dst, vmulq_f32 (vcvtq_f32_s32 (vmovl_s16 (vget_low_s16 (x))), n_scale));
+        vst1q_f32 (dst + 4, vmulq_f32 (vcvtq_f32_s32 (vmovl_s16 (vget_high_s16 (x))), n_scale));
+        src += 8;
+        dst += 8;
+    }
+    return ne10_convert_q15_float_c (dst, src, scale, count);
+}
+
+ne10_result_t ne10_convert_float_q31_neon (ne10_int32_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count)
+{
+    float32x4_t n_scale = vdupq_n_f32 (scale);
+
+    if ( (ne10_uint32_t) mode > NE10_ROUND_FLOOR)
+        return NE10_ERR;
+
+    for (; count >= 4; count -= 4)
+    {
+        vst1q_s32 (dst, ne10_convert_round_neon (vmulq_f32 (vld1q_f32 (src), n_scale), mode));
+        src += 4;
+        dst += 4;
+    }
+    return ne10_convert_float_q31_c (dst, src, scale, mode, count);
+}
+
+ne10_result_t ne10_convert_q31_float_neon (ne10_float32_t * dst, ne10_int32_t * src, ne10_float32_t scale, ne10_uint32_t count)
+{
+    float32x4_t n_scale = vdupq_n_f32 (scale);
+
+    for (; count >= 4; count -= 4)
+    {
+        vst1q_f32 (dst, vmulq_f32 (vcvtq_f32_s32 (vld1q_s32 (src)), n_scale));
+        src += 4;
+        dst += 4;
+    }
+    return ne10_convert_q31_float_c (dst, src, scale, count);
+}
+
+ne10_result_t ne10_convert_float_u8_neon (ne10_uint8_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count)
+{
+    float32x4_t n_scale = vdupq_n_f32 (scale);
+    int32x4_t i0, i1;
+
+    if ( (ne10_uint32_t) mode > NE10_ROUND_FLOOR)
+        return NE10_ERR;
+
+    for (; count >= 8; count -= 8)
+    {
+        i0 = ne10_convert_round_neon (vmulq_f32 (vld1q_f32 (src), n_scale), mode);
+        i1 = ne10_convert_round_neon (vmulq_f32 (vld1q_f32 (src + 4), n_scale), mode);
+        /* VQMOVUN clamps negative values to 0 */
+        vst1_u8 (dst, vqmovn_u16 (vcombine_u16 (vqmovun_s32 (i0), vqmovun_s32 (i1))));
+        src += 8;
+        dst += 8;
+    }
+    return ne10_convert_float_u8_c (dst, src, scale, mode, count);
+}
+
+ne10_result_t ne10_convert_u8_float_neon (ne10_float32_t * dst, ne10_uint8_t * src, ne10_float32_t scale, ne10_uint32_t count)
+{
+    float32x4_t n_scale = vdupq_n_f32 (scale);
+    uint16x8_t x;
+
+    for (; count >= 8; count -= 8)
+    {
+        x = vmovl_u8 (vld1_u8 (src));
+        vst1q_f32 (dst, vmulq_f32 (vcvtq_f32_u32 (vmovl_u16 (vget_low_u16 (x))), n_scale));
+        vst1q_f32 (dst + 4, vmulq_f32 (vcvtq_f32_u32 (vmovl_u16 (vget_high_u16 (x))), n_scale));
+        src += 8;
+        dst += 8;
+    }
+    return ne10_convert_u8_float_c (dst, src, scale, count);
+}
+
+/*
+ * The half precision conversions use integer and single precision arithmetic
+ * only, so they do not depend on the optional half precision extension of
+ * ARMv7 and flush-to-zero does not change their results. Each branch of the
+ * scalar versions in NE10_convert.c is evaluated and the lanes are selected.
+ */
+static inline uint16x4_t ne10_convert_f32_f16_neon (float32x4_t f)
+{
+    uint32x4_t x = vreinterpretq_u32_f32 (f);
+    uint32x4_t sign = vandq_u32 (x, vdupq_n_u32 (0x80000000));
+    uint32x4_t big, sub, nrm, h;
+
+    x = veorq_u32 (x, sign);
+    big = vbslq_u32 (vcgtq_u32 (x, vdupq_n_u32 (0x7f800000)), vdupq_n_u32 (0x7e00), vdupq_n_u32 (0x7c00));
+    sub = vreinterpretq_u32_f32 (vaddq_f32 (vreinterpretq_f32_u32 (x), vdupq_n_f32 (0.5f)));
+    sub = vsubq_u32 (sub, vdupq_n_u32 (0x3f000000));
+    nrm = vaddq_u32 (x, vandq_u32 (vshrq_n_u32 (x, 13), vdupq_n_u32 (1)));
+    nrm = vshrq_n_u32 (vaddq_u32 (nrm, vdupq_n_u32 (0xc8000fff)), 13);
+
+    h = vbslq_u32 (vcltq_u32 (x, vdupq_n_u32 (0x38800000)), sub, nrm);
+    h = vbslq_u32 (vcgeq_u32 (x, vdupq_n_u32 (0x47800000)), big, h);
+    return vmovn_u32 (vorrq_u32 (h, vshrq_n_u32 (sign, 16)));
+}
+
+static inline float32x4_t ne10_convert_f16_f32_neon (uint16x4_t h)
+{
+    uint32x4_t x = vmovl_u16 (h);
+    uint32x4_t sign = vshlq_n_u32 (vandq_u32 (x, vdupq_n_u32 (0x8000)), 16);
+    uint32x4_t exp, sub;
+
+    x = vshlq_n_u32 (vandq_u32 (x, vdupq_n_u32 (0x7fff)), 13);
+    exp = vandq_u32 (x, vdupq_n_u32 (0x0f800000));
+    x = vaddq_u32 (x, vdupq_n_u32 (0x38000000));
+
+    sub = vaddq_u32 (x, vdupq_n_u32 (0x00800000));
+    sub = vreinterpretq_u32_f32 (vsubq_f32 (vreinterpretq_f32_u32 (sub), vreinterpretq_f32_u32 (vdupq_n_u32 (0x38800000))));
+    x = vbslq_u32 (vceqq_u32 (exp, vdupq_n_u32 (0x0f800000)), vaddq_u32 (x, vdupq_n_u32 (0x38000000)), x);
+    x = vbslq_u32 (vceqq_u32 (exp, vdupq_n_u32 (0)), sub, x);
+    return vreinterpretq_f32_u32 (vorrq_u32 (x, sign));
+}
+
+ne10_result_t ne10_convert_float_f16_neon (ne10_float16_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    for (; count >= 8; count -= 8)
+    {
+        vst1q_u16 (dst, vcombine_u16 (ne10_convert_f32_f16_neon (vld1q_f32 (src)), ne10_convert_f32_f16_neon (vld1q_f32 (src + 4))));
+        src += 8;
+        dst += 8;
+    }
+    return ne10_convert_float_f16_c (dst, src, count);
+}
+
+ne10_result_t ne10_convert_f16_float_neon (ne10_float32_t * dst, ne10_float16_t * src, ne10_uint32_t count)
+{
+    uint16x8_t h;
+
+    for (; count >= 8; count -= 8)
+    {
+        h = vld1q_u16 (src);
+        vst1q_f32 (dst, ne10_convert_f16_f32_neon (vget_low_u16 (h)));
+        vst1q_f32 (dst + 4, ne10_convert_f16_f32_neon (vget_high_u16 (h)));
+        src += 8;
+        dst += 8;
+    }
+    return ne10_convert_f16_float_c (dst, src, count);
+}
+
+ne10_result_t ne10_convert_int16_int32_neon (ne10_int32_t * dst, ne10_int16_t * src, ne10_uint32_t shift, ne10_uint32_t count)
+{
+    int32x4_t n_shift = vdupq_n_s32 ( (ne10_int32_t) shift);
+    int16x8_t x;
+
+    if (shift > 16)
+        return NE10_ERR;
+
+    for (; count >= 8; count -= 8)
+    {
+        x = vld1q_s16 (src);
+        vst1q_s32 (dst, vshlq_s32 (vmovl_s16 (vget_low_s16 (x)), n_shift));
+        vst1q_s32 (dst + 4, vshlq_s32 (vmovl_s16 (vget_high_s16 (x)), n_shift));
+        src += 8;
+        dst += 8;
+    }
+    return ne10_convert_int16_int32_c (dst, src, shift, count);
+}
+
+ne10_result_t ne10_convert_int32_int16_neon (ne10_int16_t * dst, ne10_int32_t * src, ne10_uint32_t shift, ne10_uint32_t count)
+{
+    /* a negative VRSHL count is a rounding right shift */
+    int32x4_t n_shift = vdupq_n_s32 (- (ne10_int32_t) shift);
+
+    if (shift > 31)
+        return NE10_ERR;
+
+    for (; count >= 8; count -= 8)
+    {
+        vst1q_s16 (dst, vcombine_s16 (vqmovn_s32 (vrshlq_s32 (vld1q_s32 (src), n_shift)),
+                                      vqmovn_s32 (vrshlq_s32 (vld1q_s32 (src + 4), n_shift))));
+        src += 8;
+        dst += 8;
+    }
+    return ne10_convert_int32_int16_c (dst, src, shift, count);
+}
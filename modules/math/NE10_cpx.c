@@ -0,0 +1,322 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_cpx.c
+ */
+
+#include "NE10_types.h"
+#include "macros.h"
+
+#include <assert.h>
+
+#include <math.h>
+
+/*
+ * Fixed-point helpers. They follow the VQDMULL, VQDMLAL/VQDMLSL and VQRSHRN
+ * sequences in NE10_cpx.neon.c step by step, saturation included, so the C
+ * and NEON versions give identical results even for -1 * -1.
+ */
+static inline ne10_int32_t ne10_cpx_sat_q31 (ne10_int64_t x)
+{
+    if (x > 0x7FFFFFFFLL)
+        return 0x7FFFFFFF;
+    if (x < -0x80000000LL)
+        return (ne10_int32_t) 0x80000000;
+    return (ne10_int32_t) x;
+}
+
+static inline ne10_int16_t ne10_cpx_sat_q15 (ne10_int64_t x)
+{
+    if (x > 0x7FFF)
+        return 0x7FFF;
+    if (x < -0x8000)
+        return (ne10_int16_t) 0x8000;
+    return (ne10_int16_t) x;
+}
+
+/* saturating doubled product, 2 * a * b in Q63 */
+static inline ne10_int64_t ne10_cpx_qdmull_q31 (ne10_int32_t a, ne10_int32_t b)
+{
+    if (a == (ne10_int32_t) 0x80000000 && b == (ne10_int32_t) 0x80000000)
+        return 0x7FFFFFFFFFFFFFFFLL;
+    return 2 * (ne10_int64_t) a * b;
+}
+
+/* a * b +/- c * d in Q63 with saturation, then rounded to Q31 */
+static inline ne10_int32_t ne10_cpx_mla_q31 (ne10_int32_t a, ne10_int32_t b, ne10_int32_t c, ne10_int32_t d, ne10_int32_t sub)
+{
+    ne10_int64_t x = ne10_cpx_qdmull_q31 (a, b);
+    ne10_int64_t y = ne10_cpx_qdmull_q31 (c, d);
+
+    if (sub)
+        y = -y;
+    if (y > 0 && x > 0x7FFFFFFFFFFFFFFFLL - y)
+        x = 0x7FFFFFFFFFFFFFFFLL;
+    else if (y < 0 && x < (-0x7FFFFFFFFFFFFFFFLL - 1) - y)
+        x = -0x7FFFFFFFFFFFFFFFLL - 1;
+    else
+        x += y;
+    /* (x + 2^31) >> 32 without forming x + 2^31 */
+    return ne10_cpx_sat_q31 ( (x >> 32) + ( (x >> 31) & 1));
+}
+
+/* the same in Q31 for Q15 operands; the sum of two products fits in 64 bits */
+static inline ne10_int16_t ne10_cpx_mla_q15 (ne10_int32_t a, ne10_int32_t b, ne10_int32_t c, ne10_int32_t d, ne10_int32_t sub)
+{
+    ne10_int64_t x = ne10_cpx_sat_q31 (2 * (ne10_int64_t) a * b);
+    ne10_int64_t y = ne10_cpx_sat_q31 (2 * (ne10_int64_t) c * d);
+
+    x = ne10_cpx_sat_q31 (sub ? x - y : x + y);
+    return ne10_cpx_sat_q15 ( (x + (1 << 15)) >> 16);
+}
+
+ne10_result_t ne10_cpx_mul_float_c (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_float32_t r = src1[ itr ].r * src2[ itr ].r - src1[ itr ].i * src2[ itr ].i;
+        ne10_float32_t i = src1[ itr ].r * src2[ itr ].i + src1[ itr ].i * src2[ itr ].r;
+        dst[ itr ].r = r;
+        dst[ itr ].i = i;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_conj_mul_float_c (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_float32_t r = src1[ itr ].r * src2[ itr ].r + src1[ itr ].i * src2[ itr ].i;
+        ne10_float32_t i = src1[ itr ].i * src2[ itr ].r - src1[ itr ].r * src2[ itr ].i;
+        dst[ itr ].r = r;
+        dst[ itr ].i = i;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_mul_acc_float_c (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_float32_t r = acc[ itr ].r + (src1[ itr ].r * src2[ itr ].r - src1[ itr ].i * src2[ itr ].i);
+        ne10_float32_t i = acc[ itr ].i + (src1[ itr ].r * src2[ itr ].i + src1[ itr ].i * src2[ itr ].r);
+        dst[ itr ].r = r;
+        dst[ itr ].i = i;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_mag_float_c (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = sqrt (src[ itr ].r * src[ itr ].r + src[ itr ].i * src[ itr ].i);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_mag_sqr_float_c (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = src[ itr ].r * src[ itr ].r + src[ itr ].i * src[ itr ].i;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_phase_float_c (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = atan2f (src[ itr ].i, src[ itr ].r);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_to_polar_float_c (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_3POINTER (mag, phase, src);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_float32_t r = src[ itr ].r;
+        ne10_float32_t i = src[ itr ].i;
+        mag[ itr ] = sqrt (r * r + i * i);
+        phase[ itr ] = atan2f (i, r);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_from_polar_float_c (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_3POINTER (dst, mag, phase);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_float32_t m = mag[ itr ];
+        ne10_float32_t p = phase[ itr ];
+        dst[ itr ].r = m * cosf (p);
+        dst[ itr ].i = m * sinf (p);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_mul_int32_c (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_int32_t ar = src1[ itr ].r, ai = src1[ itr ].i;
+        ne10_int32_t br = src2[ itr ].r, bi = src2[ itr ].i;
+        dst[ itr ].r = ne10_cpx_mla_q31 (ar, br, ai, bi, 1);
+        dst[ itr ].i = ne10_cpx_mla_q31 (ar, bi, ai, br, 0);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_conj_mul_int32_c (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_int32_t ar = src1[ itr ].r, ai = src1[ itr ].i;
+        ne10_int32_t br = src2[ itr ].r, bi = src2[ itr ].i;
+        dst[ itr ].r = ne10_cpx_mla_q31 (ar, br, ai, bi, 0);
+        dst[ itr ].i = ne10_cpx_mla_q31 (ai, br, ar, bi, 1);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_mul_acc_int32_c (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * acc, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_int32_t ar = src1[ itr ].r, ai = src1[ itr ].i;
+        ne10_int32_t br = src2[ itr ].r, bi = src2[ itr ].i;
+        ne10_int64_t r = (ne10_int64_t) acc[ itr ].r + ne10_cpx_mla_q31 (ar, br, ai, bi, 1);
+        ne10_int64_t i = (ne10_int64_t) acc[ itr ].i + ne10_cpx_mla_q31 (ar, bi, ai, br, 0);
+        dst[ itr ].r = ne10_cpx_sat_q31 (r);
+        dst[ itr ].i = ne10_cpx_sat_q31 (i);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_mag_int32_c (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_float64_t r = src[ itr ].r;
+        ne10_float64_t i = src[ itr ].i;
+        ne10_float64_t m = sqrt (r * r + i * i) + 0.5;
+        dst[ itr ] = (m >= 2147483647.0) ? 0x7FFFFFFF : (ne10_int32_t) m;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_mag_sqr_int32_c (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_int32_t r = src[ itr ].r;
+        ne10_int32_t i = src[ itr ].i;
+        dst[ itr ] = ne10_cpx_mla_q31 (r, r, i, i, 0);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_mul_int16_c (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_int32_t ar = src1[ itr ].r, ai = src1[ itr ].i;
+        ne10_int32_t br = src2[ itr ].r, bi = src2[ itr ].i;
+        dst[ itr ].r = ne10_cpx_mla_q15 (ar, br, ai, bi, 1);
+        dst[ itr ].i = ne10_cpx_mla_q15 (ar, bi, ai, br, 0);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_conj_mul_int16_c (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_int32_t ar = src1[ itr ].r, ai = src1[ itr ].i;
+        ne10_int32_t br = src2[ itr ].r, bi = src2[ itr ].i;
+        dst[ itr ].r = ne10_cpx_mla_q15 (ar, br, ai, bi, 0);
+        dst[ itr ].i = ne10_cpx_mla_q15 (ai, br, ar, bi, 1);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_mul_acc_int16_c (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * acc, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_int32_t ar = src1[ itr ].r, ai = src1[ itr ].i;
+        ne10_int32_t br = src2[ itr ].r, bi = src2[ itr ].i;
+        ne10_int32_t r = acc[ itr ].r + ne10_cpx_mla_q15 (ar, br, ai, bi, 1);
+        ne10_int32_t i = acc[ itr ].i + ne10_cpx_mla_q15 (ar, bi, ai, br, 0);
+        dst[ itr ].r = ne10_cpx_sat_q15 (r);
+        dst[ itr ].i = ne10_cpx_sat_q15 (i);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_mag_int16_c (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_float32_t r = src[ itr ].r;
+        ne10_float32_t i = src[ itr ].i;
+        dst[ itr ] = ne10_cpx_sat_q15 ( (ne10_int32_t) (sqrt (r * r + i * i) + 0.5));
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_mag_sqr_int16_c (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_int32_t r = src[ itr ].r;
+        ne10_int32_t i = src[ itr ].i;
+        dst[ itr ] = ne10_cpx_mla_q15 (r, r, i, i, 0);
+    }
+    return NE10_OK;
+}
@@ -0,0 +1,501 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_cpx.neon.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_transcendental.neon.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+/* Coefficients of the A&S 4.4.49 arctangent approximation on [0, 1], |error| <= 1e-5 rad */
+#define NE10_CPX_ATAN_C1  0.9998660f
+#define NE10_CPX_ATAN_C3 -0.3302995f
+#define NE10_CPX_ATAN_C5  0.1801410f
+#define NE10_CPX_ATAN_C7 -0.0851330f
+#define NE10_CPX_ATAN_C9  0.0208351f
+
+#define NE10_CPX_PI       3.14159265358979f
+#define NE10_CPX_PI_2     1.57079632679490f
+
+/* atan2(y, x): octant reduction to [0, 1], odd polynomial, then quadrant fix-up. */
+static inline float32x4_t ne10_cpx_atan2_neon (float32x4_t y, float32x4_t x)
+{
+    float32x4_t ax = vabsq_f32 (x);
+    float32x4_t ay = vabsq_f32 (y);
+    float32x4_t num = vminq_f32 (ax, ay);
+    float32x4_t den = vmaxq_f32 (vmaxq_f32 (ax, ay), vdupq_n_f32 (1.0e-37f));
+    float32x4_t a, s, r;
+    uint32x4_t sign;
+
+    a = vmulq_f32 (num, ne10_recip_kernel_neon (den));
+    s = vmulq_f32 (a, a);
+
+    r = vmlaq_f32 (vdupq_n_f32 (NE10_CPX_ATAN_C7), s, vdupq_n_f32 (NE10_CPX_ATAN_C9));
+    r = vmlaq_f32 (vdupq_n_f32 (NE10_CPX_ATAN_C5), s, r);
+    r = vmlaq_f32 (vdupq_n_f32 (NE10_CPX_ATAN_C3), s, r);
+    r = vmlaq_f32 (vdupq_n_f32 (NE10_CPX_ATAN_C1), s, r);
+    r = vmulq_f32 (r, a);
+
+    r = vbslq_f32 (vcgtq_f32 (ay, ax), vsubq_f32 (vdupq_n_f32 (NE10_CPX_PI_2), r), r);
+    r = vbslq_f32 (vcltq_f32 (x, vdupq_n_f32 (0.0f)), vsubq_f32 (vdupq_n_f32 (NE10_CPX_PI), r), r);
+
+    /* the result takes the sign of y */
+    sign = vandq_u32 (vreinterpretq_u32_f32 (y), vdupq_n_u32 (0x80000000));
+    return vreinterpretq_f32_u32 (vorrq_u32 (vreinterpretq_u32_f32 (r), sign));
+}
+
+ne10_result_t ne10_cpx_mul_float_neon (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count)
+{
+    float32x4x2_t a, b, d;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count >= 4; count -= 4)
+    {
+        a = vld2q_f32 ( (ne10_float32_t*) src1);
+        b = vld2q_f32 ( (ne10_float32_t*) src2);
+        d.val[0] = vmlsq_f32 (vmulq_f32 (a.val[0], b.val[0]), a.val[1], b.val[1]);
+        d.val[1] = vmlaq_f32 (vmulq_f32 (a.val[0], b.val[1]), a.val[1], b.val[0]);
+        vst2q_f32 ( (ne10_float32_t*) dst, d);
+        src1 += 4;
+        src2 += 4;
+        dst += 4;
+    }
+    return ne10_cpx_mul_float_c (dst, src1, src2, count);
+}
+
+ne10_result_t ne10_cpx_conj_mul_float_neon (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count)
+{
+    float32x4x2_t a, b, d;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count >= 4; count -= 4)
+    {
+        a = vld2q_f32 ( (ne10_float32_t*) src1);
+        b = vld2q_f32 ( (ne10_float32_t*) src2);
+        d.val[0] = vmlaq_f32 (vmulq_f32 (a.val[0], b.val[0]), a.val[1], b.val[1]);
+        d.val[1] = vmlsq_f32 (vmulq_f32 (a.val[1], b.val[0]), a.val[0], b.val[1]);
+        vst2q_f32 ( (ne10_float32_t*) dst, d);
+        src1 += 4;
+        src2 += 4;
+        dst += 4;
+    }
+    return ne10_cpx_conj_mul_float_c (dst, src1, src2, count);
+}
+
+ne10_result_t ne10_cpx_mul_acc_float_neon (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count)
+{
+    float32x4x2_t a, b, d;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count >= 4; count -= 4)
+    {
+        a = vld2q_f32 ( (ne10_float32_t*) src1);
+        b = vld2q_f32 ( (ne10_float32_t*) src2);
+        d = vld2q_f32 ( (ne10_float32_t*) acc);
+        d.val[0] = vaddq_f32 (d.val[0], vmlsq_f32 (vmulq_f32 (a.val[0], b.val[0]), a.val[1], b.val[1]));
+        d.val[1] = vaddq_f32 (d.val[1], vmlaq_f32 (vmulq_f32 (a.val[0], b.val[1]), a.val[1], b.val[0]));
+        vst2q_f32 ( (ne10_float32_t*) dst, d);
+        acc += 4;
+        src1 += 4;
+        src2 += 4;
+        dst += 4;
+    }
+    return ne10_cpx_mul_acc_float_c (dst, acc, src1, src2, count);
+}
+
+ne10_result_t ne10_cpx_mag_float_neon (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    float32x4x2_t a;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4)
+    {
+        a = vld2q_f32 ( (ne10_float32_t*) src);
+        vst1q_f32 (dst, ne10_sqrt_kernel_neon (vmlaq_f32 (vmulq_f32 (a.val[0], a.val[0]), a.val[1], a.val[1])));
+        src += 4;
+        dst += 4;
+    }
+    return ne10_cpx_mag_float_c (dst, src, count);
+}
+
+ne10_result_t ne10_cpx_mag_sqr_float_neon (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    float32x4x2_t a;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4)
+    {
+        a = vld2q_f32 ( (ne10_float32_t*) src);
+        vst1q_f32 (dst, vmlaq_f32 (vmulq_f32 (a.val[0], a.val[0]), a.val[1], a.val[1]));
+        src += 4;
+        dst += 4;
+    }
+    return ne10_cpx_mag_sqr_float_c (dst, src, count);
+}
+
+/*
+ * The phase kernels run the leftover elements through the vector path as
+ * well, so a given input always gets the same approximation.
+ */
+ne10_result_t ne10_cpx_phase_float_neon (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    ne10_fft_cpx_float32_t rest[4] = { { 0.0f, 0.0f } };
+    ne10_float32_t rest_dst[4];
+    float32x4x2_t a;
+    ne10_uint32_t k;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4)
+    {
+        a = vld2q_f32 ( (ne10_float32_t*) src);
+        vst1q_f32 (dst, ne10_cpx_atan2_neon (a.val[1], a.val[0]));
+        src += 4;
+        dst += 4;
+    }
+    if (count > 0)
+    {
+        for (k = 0; k < count; k++)
+            rest[k] = src[k];
+        a = vld2q_f32 ( (ne10_float32_t*) rest);
+        vst1q_f32 (rest_dst, ne10_cpx_atan2_neon (a.val[1], a.val[0]));
+        for (k = 0; k < count; k++)
+            dst[k] = rest_dst[k];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_to_polar_float_neon (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    ne10_fft_cpx_float32_t rest[4] = { { 0.0f, 0.0f } };
+    ne10_float32_t rest_mag[4], rest_phase[4];
+    float32x4x2_t a;
+    ne10_uint32_t k;
+
+    NE10_CHECKPOINTER_3POINTER (mag, phase, src);
+    for (; count >= 4; count -= 4)
+    {
+        a = vld2q_f32 ( (ne10_float32_t*) src);
+        vst1q_f32 (mag, ne10_sqrt_kernel_neon (vmlaq_f32 (vmulq_f32 (a.val[0], a.val[0]), a.val[1], a.val[1])));
+        vst1q_f32 (phase, ne10_cpx_atan2_neon (a.val[1], a.val[0]));
+        src += 4;
+        mag += 4;
+        phase += 4;
+    }
+    if (count > 0)
+    {
+        for (k = 0; k < count; k++)
+            rest[k] = src[k];
+        a = vld2q_f32 ( (ne10_float32_t*) rest);
+        vst1q_f32 (rest_mag, ne10_sqrt_kernel_neon (vmlaq_f32 (vmulq_f32 (a.val[0], a.val[0]), a.val[1], a.val[1])));
+        vst1q_f32 (rest_phase, ne10_cpx_atan2_neon (a.val[1], a.val[0]));
+        for (k = 0; k < count; k++)
+        {
+            mag[k] = rest_mag[k];
+            phase[k] = rest_phase[k];
+        }
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpx_from_polar_float_neon (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count)
+{
+    ne10_fft_cpx_float32_t rest_dst[4];
+    ne10_float32_t rest_mag[4] = { 0.0f }, rest_phase[4] = { 0.0f };
+    float32x4_t m, s, c;
+    float32x4x2_t d;
+    ne10_uint32_t k;
+
+    NE10_CHECKPOINTER_3POINTER (dst, mag, phase);
+    for (; count >= 4; count -= 4)
+    {
+        m = vld1q_f32 (mag);
+        ne10_sincos_kernel_neon (vld1q_f32 (phase), &s, &c);
+        d.val[0] = vmulq_f32 (m, c);
+        d.val[1] = vmulq_f32 (m, s);
+        vst2q_f32 ( (ne10_float32_t*) dst, d);
+        mag += 4;
+        phase += 4;
+        dst += 4;
+    }
+    if (count > 0)
+    {
+        for (k = 0; k < count; k++)
+        {
+            rest_mag[k] = mag[k];
+            rest_phase[k] = phase[k];
+        }
+        m = vld1q_f32 (rest_mag);
+        ne10_sincos_kernel_neon (vld1q_f32 (rest_phase), &s, &c);
+        d.val[0] = vmulq_f32 (m, c);
+        d.val[1] = vmulq_f32 (m, s);
+        vst2q_f32 ( (ne10_float32_t*) rest_dst, d);
+        for (k = 0; k < count; k++)
+            dst[k] = rest_dst[k];
+    }
+    return NE10_OK;
+}
+
+/*
+ * Q31: VQDMULL/VQDMLAL form 2*a*b in 64 bits, VQRSHRN #32 rounds back to Q31.
+ */
+static inline int32x4_t ne10_cpx_q31_mla_mls (int32x4_t a, int32x4_t b, int32x4_t c, int32x4_t d, ne10_int32_t sub)
+{
+    int64x2_t lo = vqdmull_s32 (vget_low_s32 (a), vget_low_s32 (b));
+    int64x2_t hi = vqdmull_s32 (vget_high_s32 (a), vget_high_s32 (b));
+
+    if (sub)
+    {
+        lo = vqdmlsl_s32 (lo, vget_low_s32 (c), vget_low_s32 (d));
+        hi = vqdmlsl_s32 (hi, vget_high_s32 (c), vget_high_s32 (d));
+    }
+    else
+    {
+        lo = vqdmlal_s32 (lo, vget_low_s32 (c), vget_low_s32 (d));
+        hi = vqdmlal_s32 (hi, vget_high_s32 (c), vget_high_s32 (d));
+    }
+    return vcombine_s32 (vqrshrn_n_s64 (lo, 32), vqrshrn_n_s64 (hi, 32));
+}
+
+ne10_result_t ne10_cpx_mul_int32_neon (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count)
+{
+    int32x4x2_t a, b, d;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count >= 4; count -= 4)
+    {
+        a = vld2q_s32 ( (ne10_int32_t*) src1);
+        b = vld2q_s32 ( (ne10_int32_t*) src2);
+        d.val[0] = ne10_cpx_q31_mla_mls (a.val[0], b.val[0], a.val[1], b.val[1], 1);
+        d.val[1] = ne10_cpx_q31_mla_mls (a.val[0], b.val[1], a.val[1], b.val[0], 0);
+        vst2q_s32 ( (ne10_int32_t*) dst, d);
+        src1 += 4;
+        src2 += 4;
+        dst += 4;
+    }
+    return ne10_cpx_mul_int32_c (dst, src1, src2, count);
+}
+
+ne10_result_t ne10_cpx_conj_mul_int32_neon (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count)
+{
+    int32x4x2_t a, b, d;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count >= 4; count -= 4)
+    {
+        a = vld2q_s32 ( (ne10_int32_t*) src1);
+        b = vld2q_s32 ( (ne10_int32_t*) src2);
+        d.val[0] = ne10_cpx_q31_mla_mls (a.val[0], b.val[0], a.val[1], b.val[1], 0);
+        d.val[1] = ne10_cpx_q31_mla_mls (a.val[1], b.val[0], a.val[0], b.val[1], 1);
+        vst2q_s32 ( (ne10_int32_t*) dst, d);
+        src1 += 4;
+        src2 += 4;
+        dst += 4;
+    }
+    return ne10_cpx_conj_mul_int32_c (dst, src1, src2, count);
+}
+
+ne10_result_t ne10_cpx_mul_acc_int32_neon (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * acc, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count)
+{
+    int32x4x2_t a, b, d;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count >= 4; count -= 4)
+    {
+        a = vld2q_s32 ( (ne10_int32_t*) src1);
+        b = vld2q_s32 ( (ne10_int32_t*) src2);
+        d = vld2q_s32 ( (ne10_int32_t*) acc);
+        d.val[0] = vqaddq_s32 (d.val[0], ne10_cpx_q31_mla_mls (a.val[0], b.val[0], a.val[1], b.val[1], 1));
+        d.val[1] = vqaddq_s32 (d.val[1], ne10_cpx_q31_mla_mls (a.val[0], b.val[1], a.val[1], b.val[0], 0));
+        vst2q_s32 ( (ne10_int32_t*) dst, d);
+        acc += 4;
+        src1 += 4;
+        src2 += 4;
+        dst += 4;
+    }
+    return ne10_cpx_mul_acc_int32_c (dst, acc, src1, src2, count);
+}
+
+/* The Q31 magnitude is computed in single precision, so it is accurate to about 22 bits. */
+ne10_result_t ne10_cpx_mag_int32_neon (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count)
+{
+    int32x4x2_t a;
+    float32x4_t r, i, m;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4)
+    {
+        a = vld2q_s32 ( (ne10_int32_t*) src);
+        r = vcvtq_f32_s32 (a.val[0]);
+        i = vcvtq_f32_s32 (a.val[1]);
+        m = ne10_sqrt_kernel_neon (vmlaq_f32 (vmulq_f32 (r, r), i, i));
+        vst1q_s32 (dst, vcvtq_s32_f32 (vaddq_f32 (m, vdupq_n_f32 (0.5f))));
+        src += 4;
+        dst += 4;
+    }
+    return ne10_cpx_mag_int32_c (dst, src, count);
+}
+
+ne10_result_t ne10_cpx_mag_sqr_int32_neon (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count)
+{
+    int32x4x2_t a;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4)
+    {
+        a = vld2q_s32 ( (ne10_int32_t*) src);
+        vst1q_s32 (dst, ne10_cpx_q31_mla_mls (a.val[0], a.val[0], a.val[1], a.val[1], 0));
+        src += 4;
+        dst += 4;
+    }
+    return ne10_cpx_mag_sqr_int32_c (dst, src, count);
+}
+
+/*
+ * Q15: the same scheme with 16-bit lanes, 8 complex values per iteration.
+ */
+static inline int16x8_t ne10_cpx_q15_mla_mls (int16x8_t a, int16x8_t b, int16x8_t c, int16x8_t d, ne10_int32_t sub)
+{
+    int32x4_t lo = vqdmull_s16 (vget_low_s16 (a), vget_low_s16 (b));
+    int32x4_t hi = vqdmull_s16 (vget_high_s16 (a), vget_high_s16 (b));
+
+    if (sub)
+    {
+        lo = vqdmlsl_s16 (lo, vget_low_s16 (c), vget_low_s16 (d));
+        hi = vqdmlsl_s16 (hi, vget_high_s16 (c), vget_high_s16 (d));
+    }
+    else
+    {
+        lo = vqdmlal_s16 (lo, vget_low_s16 (c), vget_low_s16 (d));
+        hi = vqdmlal_s16 (hi, vget_high_s16 (c), vget_high_s16 (d));
+    }
+    return vcombine_s16 (vqrshrn_n_s32 (lo, 16), vqrshrn_n_s32 (hi, 16));
+}
+
+ne10_result_t ne10_cpx_mul_int16_neon (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count)
+{
+    int16x8x2_t a, b, d;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count >= 8; count -= 8)
+    {
+        a = vld2q_s16 ( (ne10_int16_t*) src1);
+        b = vld2q_s16 ( (ne10_int16_t*) src2);
+        d.val[0] = ne10_cpx_q15_mla_mls (a.val[0], b.val[0], a.val[1], b.val[1], 1);
+        d.val[1] = ne10_cpx_q15_mla_mls (a.val[0], b.val[1], a.val[1], b.val[0], 0);
+        vst2q_s16 ( (ne10_int16_t*) dst, d);
+        src1 += 8;
+        src2 += 8;
+        dst += 8;
+    }
+    return ne10_cpx_mul_int16_c (dst, src1, src2, count);
+}
+
+ne10_result_t ne10_cpx_conj_mul_int16_neon (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count)
+{
+    int16x8x2_t a, b, d;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count >= 8; count -= 8)
+    {
+        a = vld2q_s16 ( (ne10_int16_t*) src1);
+        b = vld2q_s16 ( (ne10_int16_t*) src2);
+        d.val[0] = ne10_cpx_q15_mla_mls (a.val[0], b.val[0], a.val[1], b.val[1], 0);
+        d.val[1] = ne10_cpx_q15_mla_mls (a.val[1], b.val[0], a.val[0], b.val[1], 1);
+        vst2q_s16 ( (ne10_int16_t*) dst, d);
+        src1 += 8;
+        src2 += 8;
+        dst += 8;
+    }
+    return ne10_cpx_conj_mul_int16_c (dst, src1, src2, count);
+}
+
+ne10_result_t ne10_cpx_mul_acc_int16_neon (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * acc, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count)
+{
+    int16x8x2_t a, b, d;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count >= 8; count -= 8)
+    {
+        a = vld2q_s16 ( (ne10_int16_t*) src1);
+        b = vld2q_s16 ( (ne10_int16_t*) src2);
+        d = vld2q_s16 ( (ne10_int16_t*) acc);
+        d.val[0] = vqaddq_s16 (d.val[0], ne10_cpx_q15_mla_mls (a.val[0], b.val[0], a.val[1], b.val[1], 1));
+        d.val[1] = vqaddq_s16 (d.val[1], ne10_cpx_q15_mla_mls (a.val[0], b.val[1], a.val[1], b.val[0], 0));
+        vst2q_s16 ( (ne10_int16_t*) dst, d);
+        acc += 8;
+        src1 += 8;
+        src2 += 8;
+        dst += 8;
+    }
+    return ne10_cpx_mul_acc_int16_c (dst, acc, src1, src2, count);
+}
+
+ne10_result_t ne10_cpx_mag_int16_neon (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count)
+{
+    int16x8x2_t a;
+    float32x4_t r, i, m_lo, m_hi;
+    int32x4_t lo, hi;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 8; count -= 8)
+    {
+        a = vld2q_s16 ( (ne10_int16_t*) src);
+        r = vcvtq_f32_s32 (vmovl_s16 (vget_low_s16 (a.val[0])));
+        i = vcvtq_f32_s32 (vmovl_s16 (vget_low_s16 (a.val[1])));
+        m_lo = ne10_sqrt_kernel_neon (vmlaq_f32 (vmulq_f32 (r, r), i, i));
+        r = vcvtq_f32_s32 (vmovl_s16 (vget_high_s16 (a.val[0])));
+        i = vcvtq_f32_s32 (vmovl_s16 (vget_high_s16 (a.val[1])));
+        m_hi = ne10_sqrt_kernel_neon (vmlaq_f32 (vmulq_f32 (r, r), i, i));
+        lo = vcvtq_s32_f32 (vaddq_f32 (m_lo, vdupq_n_f32 (0.5f)));
+        hi = vcvtq_s32_f32 (vaddq_f32 (m_hi, vdupq_n_f32 (0.5f)));
+        vst1q_s16 (dst, vcombine_s16 (vqmovn_s32 (lo), vqmovn_s32 (hi)));
+        src += 8;
+        dst += 8;
+    }
+    return ne10_cpx_mag_int16_c (dst, src, count);
+}
+
+ne10_result_t ne10_cpx_mag_sqr_int16_neon (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count)
+{
+    int16x8x2_t a;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 8; count -= 8)
+    {
+        a = vld2q_s16 ( (ne10_int16_t*) src);
+        vst1q_s16 (dst, ne10_cpx_q15_mla_mls (a.val[0], a.val[0], a.val[1], a.val[1], 0));
+        src += 8;
+        dst += 8;
+    }
+    return ne10_cpx_mag_sqr_int16_c (dst, src, count);
+}
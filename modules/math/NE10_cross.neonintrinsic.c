@@ -0,0 +1,54 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_cross.neonintrinsic.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+ne10_result_t ne10_cross_vec3f_neon (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count)
+{
+    float32x4x3_t n_src1, n_src2, n_dst;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count >= 4; count -= 4, src1 += 4, src2 += 4, dst += 4)
+    {
+        n_src1 = vld3q_f32 ( (ne10_float32_t*) src1);
+        n_src2 = vld3q_f32 ( (ne10_float32_t*) src2);
+        n_dst.val[0] = vmlsq_f32 (vmulq_f32 (n_src1.val[1], n_src2.val[2]), n_src1.val[2], n_src2.val[1]);
+        n_dst.val[1] = vmlsq_f32 (vmulq_f32 (n_src1.val[2], n_src2.val[0]), n_src1.val[0], n_src2.val[2]);
+        n_dst.val[2] = vmlsq_f32 (vmulq_f32 (n_src1.val[0], n_src2.val[1]), n_src1.val[1], n_src2.val[0]);
+        vst3q_f32 ( (ne10_float32_t*) dst, n_dst);
+    }
+    return ne10_cross_vec3f_c (dst, src1, src2, count);
+}
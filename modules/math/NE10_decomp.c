@@ -0,0 +1,420 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_decomp.c
+ */
+
+#include "NE10_types.h"
+#include "macros.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include <math.h>
+
+/*
+ * Batched factorizations of small column-major n x n matrices, stored one
+ * after the other. A failing matrix does not stop the batch: its status
+ * records the first bad pivot and the call returns NE10_ERR. The NEON
+ * versions follow the same steps, so the C code is written without early
+ * exits from the arithmetic.
+ */
+
+/* element (i, j) of a column-major n x n matrix */
+#define NE10_DECOMP_AT(a, n, i, j) (a)[ (j) * (n) + (i)]
+
+static ne10_int32_t ne10_cholesky_one (ne10_float32_t * l, ne10_uint32_t n)
+{
+    ne10_int32_t status = 0;
+    ne10_float32_t s, d;
+
+    for ( unsigned int j = 0; j < n; j++ )
+    {
+        s = NE10_DECOMP_AT (l, n, j, j);
+        for ( unsigned int k = 0; k < j; k++ )
+            s -= NE10_DECOMP_AT (l, n, j, k) * NE10_DECOMP_AT (l, n, j, k);
+        if (! (s > 0.0f) && status == 0)
+            status = j + 1;
+        d = sqrtf (s);
+        NE10_DECOMP_AT (l, n, j, j) = d;
+
+        for ( unsigned int i = j + 1; i < n; i++ )
+        {
+            s = NE10_DECOMP_AT (l, n, i, j);
+            for ( unsigned int k = 0; k < j; k++ )
+                s -= NE10_DECOMP_AT (l, n, i, k) * NE10_DECOMP_AT (l, n, j, k);
+            NE10_DECOMP_AT (l, n, i, j) = s / d;
+        }
+        for ( unsigned int i = 0; i < j; i++ )
+            NE10_DECOMP_AT (l, n, i, j) = 0.0f;
+    }
+    return status;
+}
+
+static ne10_int32_t ne10_lu_one (ne10_float32_t * a, ne10_uint8_t * piv, ne10_uint32_t n)
+{
+    ne10_int32_t status = 0;
+    ne10_float32_t m, t, pivot, tol;
+    ne10_uint32_t p;
+
+    /* pivots relative to the scale of the matrix */
+    tol = 0.0f;
+    for ( unsigned int i = 0; i < n * n; i++ )
+    {
+        if (fabsf (a[i]) > tol)
+            tol = fabsf (a[i]);
+    }
+    tol *= NE10_LU_PIVOT_EPS;
+
+    for ( unsigned int k = 0; k < n; k++ )
+    {
+        /* partial pivoting: the first row with the largest magnitude */
+        p = k;
+        m = fabsf (NE10_DECOMP_AT (a, n, k, k));
+        for ( unsigned int i = k + 1; i < n; i++ )
+        {
+            if (fabsf (NE10_DECOMP_AT (a, n, i, k)) > m)
+            {
+                m = fabsf (NE10_DECOMP_AT (a, n, i, k));
+                p = i;
+            }
+        }
+        piv[k] = (ne10_uint8_t) p;
+        for ( unsigned int j = 0; j < n; j++ )
+        {
+            t = NE10_DECOMP_AT (a, n, k, j);
+            NE10_DECOMP_AT (a, n, k, j) = NE10_DECOMP_AT (a, n, p, j);
+            NE10_DECOMP_AT (a, n, p, j) = t;
+        }
+
+        /*
+         * a pivot within rounding of zero makes the matrix singular; a zero
+         * column below the diagonal needs no elimination
+         */
+        pivot = NE10_DECOMP_AT (a, n, k, k);
+        if (fabsf (pivot) <= tol && status == 0)
+            status = k + 1;
+        if (pivot == 0.0f)
+            continue;
+        for ( unsigned int i = k + 1; i < n; i++ )
+            NE10_DECOMP_AT (a, n, i, k) = NE10_DECOMP_AT (a, n, i, k) / pivot;
+        for ( unsigned int j = k + 1; j < n; j++ )
+        {
+            for ( unsigned int i = k + 1; i < n; i++ )
+                NE10_DECOMP_AT (a, n, i, j) -= NE10_DECOMP_AT (a, n, i, k) * NE10_DECOMP_AT (a, n, k, j);
+        }
+    }
+    return status;
+}
+
+ne10_result_t ne10_cholesky_f32_c (ne10_float32_t * dst, ne10_int32_t * status, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count)
+{
+    ne10_result_t result = NE10_OK;
+
+    assert (dst && status && src);
+    if (n < 2 || n > NE10_DECOMP_MAX_N)
+        return NE10_ERR;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        if (dst != src)
+            memcpy (dst + itr * n * n, src + itr * n * n, n * n * sizeof (ne10_float32_t));
+        status[ itr ] = ne10_cholesky_one (dst + itr * n * n, n);
+        if (status[ itr ] != 0)
+            result = NE10_ERR;
+    }
+    return result;
+}
+
+/* L y = b, then L^T x = y */
+ne10_result_t ne10_cholesky_solve_f32_c (ne10_float32_t * dst, ne10_float32_t * chol, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count)
+{
+    ne10_float32_t * l;
+    ne10_float32_t * x;
+    ne10_float32_t s;
+
+    assert (dst && chol && src);
+    if (n < 2 || n > NE10_DECOMP_MAX_N)
+        return NE10_ERR;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        l = chol + itr * n * n;
+        x = dst + itr * n;
+        if (dst != src)
+            memcpy (x, src + itr * n, n * sizeof (ne10_float32_t));
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+            s = x[i];
+            for ( unsigned int k = 0; k < i; k++ )
+                s -= NE10_DECOMP_AT (l, n, i, k) * x[k];
+            x[i] = s / NE10_DECOMP_AT (l, n, i, i);
+        }
+        for ( unsigned int i = n; i-- > 0; )
+        {
+            s = x[i];
+            for ( unsigned int k = i + 1; k < n; k++ )
+                s -= NE10_DECOMP_AT (l, n, k, i) * x[k];
+            x[i] = s / NE10_DECOMP_AT (l, n, i, i);
+        }
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_lu_f32_c (ne10_float32_t * dst, ne10_uint8_t * piv, ne10_int32_t * status, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count)
+{
+    ne10_result_t result = NE10_OK;
+
+    assert (dst && piv && status && src);
+    if (n < 2 || n > NE10_DECOMP_MAX_N)
+        return NE10_ERR;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        if (dst != src)
+            memcpy (dst + itr * n * n, src + itr * n * n, n * n * sizeof (ne10_float32_t));
+        status[ itr ] = ne10_lu_one (dst + itr * n * n, piv + itr * n, n);
+        if (status[ itr ] != 0)
+            result = NE10_ERR;
+    }
+    return result;
+}
+
+/* P b, then L y = P b with the unit diagonal of L, then U x = y */
+ne10_result_t ne10_lu_solve_f32_c (ne10_float32_t * dst, ne10_float32_t * lu, ne10_uint8_t * piv, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count)
+{
+    ne10_float32_t * a;
+    ne10_float32_t * x;
+    ne10_float32_t t;
+
+    assert (dst && lu && piv && src);
+    if (n < 2 || n > NE10_DECOMP_MAX_N)
+        return NE10_ERR;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        a = lu + itr * n * n;
+        x = dst + itr * n;
+        if (dst != src)
+            memcpy (x, src + itr * n, n * sizeof (ne10_float32_t));
+
+        for ( unsigned int k = 0; k < n; k++ )
+        {
+            t = x[k];
+            x[k] = x[piv[itr * n + k]];
+            x[piv[itr * n + k]] = t;
+        }
+        for ( unsigned int i = 1; i < n; i++ )
+        {
+            for ( unsigned int k = 0; k < i; k++ )
+                x[i] -= NE10_DECOMP_AT (a, n, i, k) * x[k];
+        }
+        for ( unsigned int i = n; i-- > 0; )
+        {
+            for ( unsigned int k = i + 1; k < n; k++ )
+                x[i] -= NE10_DECOMP_AT (a, n, i, k) * x[k];
+            x[i] = x[i] / NE10_DECOMP_AT (a, n, i, i);
+        }
+    }
+    return NE10_OK;
+}
+
+/*
+ * Householder QR: column k of R is reflected onto -sign(r_kk) ||r_k|| e_k by
+ * H = I - 2 v v^T / (v^T v), applied to the remaining columns of R and
+ * accumulated into Q from the right.
+ */
+ne10_result_t ne10_qr_f32_c (ne10_float32_t * q, ne10_float32_t * r, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count)
+{
+    ne10_float32_t v[NE10_DECOMP_MAX_N];
+    ne10_float32_t * qm;
+    ne10_float32_t * rm;
+    ne10_float32_t norm, alpha, vv, d, f;
+
+    assert (q && r && src);
+    if (n < 2 || n > NE10_DECOMP_MAX_N)
+        return NE10_ERR;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        qm = q + itr * n * n;
+        rm = r + itr * n * n;
+        if (r != src)
+            memcpy (rm, src + itr * n * n, n * n * sizeof (ne10_float32_t));
+        for ( unsigned int j = 0; j < n; j++ )
+        {
+            for ( unsigned int i = 0; i < n; i++ )
+                NE10_DECOMP_AT (qm, n, i, j) = (i == j) ? 1.0f : 0.0f;
+        }
+
+        for ( unsigned int k = 0; k + 1 < n; k++ )
+        {
+            norm = NE10_DECOMP_AT (rm, n, k, k) * NE10_DECOMP_AT (rm, n, k, k);
+            for ( unsigned int i = k + 1; i < n; i++ )
+                norm += NE10_DECOMP_AT (rm, n, i, k) * NE10_DECOMP_AT (rm, n, i, k);
+            norm = sqrtf (norm);
+            alpha = (NE10_DECOMP_AT (rm, n, k, k) >= 0.0f) ? -norm : norm;
+
+            v[k] = NE10_DECOMP_AT (rm, n, k, k) - alpha;
+            for ( unsigned int i = k + 1; i < n; i++ )
+                v[i] = NE10_DECOMP_AT (rm, n, i, k);
+            vv = v[k] * v[k];
+            for ( unsigned int i = k + 1; i < n; i++ )
+                vv += v[i] * v[i];
+            /* the column is already zero */
+            if (vv == 0.0f)
+                continue;
+
+            for ( unsigned int j = k; j < n; j++ )
+            {
+                d = v[k] * NE10_DECOMP_AT (rm, n, k, j);
+                for ( unsigned int i = k + 1; i < n; i++ )
+                    d += v[i] * NE10_DECOMP_AT (rm, n, i, j);
+                f = (2.0f * d) / vv;
+                for ( unsigned int i = k; i < n; i++ )
+                    NE10_DECOMP_AT (rm, n, i, j) -= f * v[i];
+            }
+            for ( unsigned int i = 0; i < n; i++ )
+            {
+                d = NE10_DECOMP_AT (qm, n, i, k) * v[k];
+                for ( unsigned int j = k + 1; j < n; j++ )
+                    d += NE10_DECOMP_AT (qm, n, i, j) * v[j];
+                f = (2.0f * d) / vv;
+                for ( unsigned int j = k; j < n; j++ )
+                    NE10_DECOMP_AT (qm, n, i, j) -= f * v[j];
+            }
+        }
+
+        /* what is left below the diagonal is rounding error */
+        for ( unsigned int j = 0; j < n; j++ )
+        {
+            for ( unsigned int i = j + 1; i < n; i++ )
+                NE10_DECOMP_AT (rm, n, i, j) = 0.0f;
+        }
+    }
+    return NE10_OK;
+}
+
+/* one-sided Jacobi: rotate column pairs of A (and of V) until they are orthogonal */
+static inline void ne10_svd_rotate (ne10_float32_t * ap, ne10_float32_t * aq, ne10_float32_t c, ne10_float32_t s)
+{
+    ne10_float32_t t;
+
+    for ( unsigned int r = 0; r < 3; r++ )
+    {
+        t = ap[r];
+        ap[r] = c * t - s * aq[r];
+        aq[r] = s * t + c * aq[r];
+    }
+}
+
+static inline ne10_float32_t ne10_svd_dot (const ne10_float32_t * a, const ne10_float32_t * b)
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static inline void ne10_svd_swap (ne10_float32_t * a, ne10_float32_t * b, ne10_uint32_t len)
+{
+    ne10_float32_t t;
+
+    for ( unsigned int r = 0; r < len; r++ )
+    {
+        t = a[r];
+        a[r] = b[r];
+        b[r] = t;
+    }
+}
+
+ne10_result_t ne10_svd_3x3f_c (ne10_mat3x3f_t * u, ne10_vec3f_t * s, ne10_mat3x3f_t * v, ne10_mat3x3f_t * src, ne10_uint32_t count)
+{
+    static const ne10_uint32_t pairs[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+    static const ne10_uint32_t order[3][2] = { { 0, 1 }, { 1, 2 }, { 0, 1 } };
+    ne10_float32_t a[3][3], w[3][3], sigma[3];
+    ne10_float32_t alpha, beta, gamma, zeta, t, c, sn;
+    ne10_uint32_t p, q;
+
+    assert (u && s && v && src);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        memcpy (a, &src[ itr ], sizeof (a));
+        memset (w, 0, sizeof (w));
+        w[0][0] = w[1][1] = w[2][2] = 1.0f;
+
+        for ( unsigned int sweep = 0; sweep < NE10_SVD_SWEEPS; sweep++ )
+        {
+            for ( unsigned int k = 0; k < 3; k++ )
+            {
+                p = pairs[k][0];
+                q = pairs[k][1];
+                alpha = ne10_svd_dot (a[p], a[p]);
+                beta = ne10_svd_dot (a[q], a[q]);
+                gamma = ne10_svd_dot (a[p], a[q]);
+                if (gamma == 0.0f)
+                    continue;
+                zeta = (beta - alpha) / (2.0f * gamma);
+                t = 1.0f / (fabsf (zeta) + sqrtf (1.0f + zeta * zeta));
+                t = (zeta < 0.0f) ? -t : t;
+                c = 1.0f / sqrtf (1.0f + t * t);
+                sn = c * t;
+                ne10_svd_rotate (a[p], a[q], c, sn);
+                ne10_svd_rotate (w[p], w[q], c, sn);
+            }
+        }
+
+        /* the column norms are the singular values; sort them in decreasing order */
+        for ( unsigned int k = 0; k < 3; k++ )
+            sigma[k] = sqrtf (ne10_svd_dot (a[k], a[k]));
+        for ( unsigned int k = 0; k < 3; k++ )
+        {
+            p = order[k][0];
+            q = order[k][1];
+            if (sigma[p] < sigma[q])
+            {
+                ne10_svd_swap (&sigma[p], &sigma[q], 1);
+                ne10_svd_swap (a[p], a[q], 3);
+                ne10_svd_swap (w[p], w[q], 3);
+            }
+        }
+
+        for ( unsigned int k = 0; k < 3; k++ )
+        {
+            for ( unsigned int r = 0; r < 3; r++ )
+                a[k][r] = (sigma[k] > 0.0f) ? a[k][r] / sigma[k] : 0.0f;
+        }
+        /* a (nearly) rank-2 input still gets an orthonormal U */
+        if (sigma[2] <= NE10_SVD_RANK_EPS * sigma[0])
+        {
+            a[2][0] = a[0][1] * a[1][2] - a[0][2] * a[1][1];
+            a[2][1] = a[0][2] * a[1][0] - a[0][0] * a[1][2];
+            a[2][2] = a[0][0] * a[1][1] - a[0][1] * a[1][0];
+        }
+
+        memcpy (&u[ itr ], a, sizeof (a));
+        memcpy (&v[ itr ], w, sizeof (w));
+        s[ itr ].x = sigma[0];
+        s[ itr ].y = sigma[1];
+        s[ itr ].z = sigma[2];
+    }
+    return NE10_OK;
+}
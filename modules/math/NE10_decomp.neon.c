@@ -0,0 +1,475 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_decomp.neon.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_transcendental.neon.h"
+#include "NE10_mat.neonintrinsic.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+/*
+ * Four independent systems are solved at a time, one per lane: entry e of
+ * the four matrices (or vectors) is gathered into register a[e], and the
+ * steps of NE10_decomp.c run lane-wise in the same order. Row swaps and
+ * skipped steps become selects, so every lane does the same work. Leftover
+ * systems are handed to the C versions.
+ */
+
+/* entry e of the four consecutive items of len floats at src goes to a[e] */
+static inline void ne10_decomp_load_x4_neon (float32x4_t * a, const ne10_float32_t * src, ne10_uint32_t len)
+{
+    ne10_uint32_t e = 0;
+
+    for (; e + 4 <= len; e += 4)
+    {
+        a[e] = vld1q_f32 (src + e);
+        a[e + 1] = vld1q_f32 (src + len + e);
+        a[e + 2] = vld1q_f32 (src + 2 * len + e);
+        a[e + 3] = vld1q_f32 (src + 3 * len + e);
+        ne10_transpose4x4_neon (&a[e]);
+    }
+    for (; e < len; e++)
+    {
+        a[e] = vld1q_dup_f32 (src + e);
+        a[e] = vld1q_lane_f32 (src + len + e, a[e], 1);
+        a[e] = vld1q_lane_f32 (src + 2 * len + e, a[e], 2);
+        a[e] = vld1q_lane_f32 (src + 3 * len + e, a[e], 3);
+    }
+}
+
+static inline void ne10_decomp_store_x4_neon (ne10_float32_t * dst, const float32x4_t * a, ne10_uint32_t len)
+{
+    float32x4_t t[4];
+    ne10_uint32_t e = 0;
+
+    for (; e + 4 <= len; e += 4)
+    {
+        t[0] = a[e];
+        t[1] = a[e + 1];
+        t[2] = a[e + 2];
+        t[3] = a[e + 3];
+        ne10_transpose4x4_neon (t);
+        vst1q_f32 (dst + e, t[0]);
+        vst1q_f32 (dst + len + e, t[1]);
+        vst1q_f32 (dst + 2 * len + e, t[2]);
+        vst1q_f32 (dst + 3 * len + e, t[3]);
+    }
+    for (; e < len; e++)
+    {
+        vst1q_lane_f32 (dst + e, a[e], 0);
+        vst1q_lane_f32 (dst + len + e, a[e], 1);
+        vst1q_lane_f32 (dst + 2 * len + e, a[e], 2);
+        vst1q_lane_f32 (dst + 3 * len + e, a[e], 3);
+    }
+}
+
+/* records k + 1 in the lanes that fail at step k and had not failed before */
+static inline uint32x4_t ne10_decomp_status_neon (uint32x4_t status, uint32x4_t fail, ne10_uint32_t k)
+{
+    fail = vandq_u32 (fail, vceqq_u32 (status, vdupq_n_u32 (0)));
+    return vbslq_u32 (fail, vdupq_n_u32 (k + 1), status);
+}
+
+static inline ne10_int32_t ne10_decomp_any_neon (uint32x4_t status)
+{
+    uint32x2_t r = vorr_u32 (vget_low_u32 (status), vget_high_u32 (status));
+    return (vget_lane_u32 (r, 0) | vget_lane_u32 (r, 1)) != 0;
+}
+
+ne10_result_t ne10_cholesky_f32_neon (ne10_float32_t * dst, ne10_int32_t * status, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count)
+{
+    float32x4_t a[NE10_DECOMP_MAX_N * NE10_DECOMP_MAX_N];
+    float32x4_t s, d;
+    uint32x4_t st;
+    ne10_int32_t failed = 0;
+    ne10_uint32_t itr = 0;
+
+    assert (dst && status && src);
+    if (n < 2 || n > NE10_DECOMP_MAX_N)
+        return NE10_ERR;
+    for (; itr + 4 <= count; itr += 4)
+    {
+        ne10_decomp_load_x4_neon (a, src + itr * n * n, n * n);
+        st = vdupq_n_u32 (0);
+        for (ne10_uint32_t j = 0; j < n; j++)
+        {
+            s = a[j * n + j];
+            for (ne10_uint32_t k = 0; k < j; k++)
+                s = vmlsq_f32 (s, a[k * n + j], a[k * n + j]);
+            st = ne10_decomp_status_neon (st, vmvnq_u32 (vcgtq_f32 (s, vdupq_n_f32 (0.0f))), j);
+            d = ne10_sqrt_kernel_neon (s);
+            a[j * n + j] = d;
+
+            for (ne10_uint32_t i = j + 1; i < n; i++)
+            {
+                s = a[j * n + i];
+                for (ne10_uint32_t k = 0; k < j; k++)
+                    s = vmlsq_f32 (s, a[k * n + i], a[k * n + j]);
+                a[j * n + i] = ne10_div_kernel_neon (s, d);
+            }
+            for (ne10_uint32_t i = 0; i < j; i++)
+                a[j * n + i] = vdupq_n_f32 (0.0f);
+        }
+        ne10_decomp_store_x4_neon (dst + itr * n * n, a, n * n);
+        vst1q_s32 (status + itr, vreinterpretq_s32_u32 (st));
+        failed |= ne10_decomp_any_neon (st);
+    }
+    if (ne10_cholesky_f32_c (dst + itr * n * n, status + itr, src + itr * n * n, n, count - itr) != NE10_OK)
+        failed = 1;
+    return failed ? NE10_ERR : NE10_OK;
+}
+
+ne10_result_t ne10_cholesky_solve_f32_neon (ne10_float32_t * dst, ne10_float32_t * chol, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count)
+{
+    float32x4_t l[NE10_DECOMP_MAX_N * NE10_DECOMP_MAX_N];
+    float32x4_t x[NE10_DECOMP_MAX_N];
+    ne10_uint32_t itr = 0;
+
+    assert (dst && chol && src);
+    if (n < 2 || n > NE10_DECOMP_MAX_N)
+        return NE10_ERR;
+    for (; itr + 4 <= count; itr += 4)
+    {
+        ne10_decomp_load_x4_neon (l, chol + itr * n * n, n * n);
+        ne10_decomp_load_x4_neon (x, src + itr * n, n);
+        for (ne10_uint32_t i = 0; i < n; i++)
+        {
+            for (ne10_uint32_t k = 0; k < i; k++)
+                x[i] = vmlsq_f32 (x[i], l[k * n + i], x[k]);
+            x[i] = ne10_div_kernel_neon (x[i], l[i * n + i]);
+        }
+        for (ne10_uint32_t i = n; i-- > 0;)
+        {
+            for (ne10_uint32_t k = i + 1; k < n; k++)
+                x[i] = vmlsq_f32 (x[i], l[i * n + k], x[k]);
+            x[i] = ne10_div_kernel_neon (x[i], l[i * n + i]);
+        }
+        ne10_decomp_store_x4_neon (dst + itr * n, x, n);
+    }
+    return ne10_cholesky_solve_f32_c (dst + itr * n, chol + itr * n * n, src + itr * n, n, count - itr);
+}
+
+ne10_result_t ne10_lu_f32_neon (ne10_float32_t * dst, ne10_uint8_t * piv, ne10_int32_t * status, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count)
+{
+    float32x4_t a[NE10_DECOMP_MAX_N * NE10_DECOMP_MAX_N];
+    float32x4_t m, t, top, pivot, l, tol;
+    uint32x4_t p, sel, nonzero, st;
+    ne10_uint32_t lanes[4];
+    ne10_int32_t failed = 0;
+    ne10_uint32_t itr = 0;
+
+    assert (dst && piv && status && src);
+    if (n < 2 || n > NE10_DECOMP_MAX_N)
+        return NE10_ERR;
+    for (; itr + 4 <= count; itr += 4)
+    {
+        ne10_decomp_load_x4_neon (a, src + itr * n * n, n * n);
+        st = vdupq_n_u32 (0);
+        tol = vdupq_n_f32 (0.0f);
+        for (ne10_uint32_t i = 0; i < n * n; i++)
+            tol = vmaxq_f32 (tol, vabsq_f32 (a[i]));
+        tol = vmulq_n_f32 (tol, NE10_LU_PIVOT_EPS);
+        for (ne10_uint32_t k = 0; k < n; k++)
+        {
+            /* partial pivoting: the first row with the largest magnitude */
+            p = vdupq_n_u32 (k);
+            m = vabsq_f32 (a[k * n + k]);
+            for (ne10_uint32_t i = k + 1; i < n; i++)
+            {
+                t = vabsq_f32 (a[k * n + i]);
+                sel = vcgtq_f32 (t, m);
+                m = vbslq_f32 (sel, t, m);
+                p = vbslq_u32 (sel, vdupq_n_u32 (i), p);
+            }
+            vst1q_u32 (lanes, p);
+            for (ne10_uint32_t lane = 0; lane < 4; lane++)
+                piv[ (itr + lane) * n + k] = (ne10_uint8_t) lanes[lane];
+
+            /* swap rows k and p of each lane */
+            for (ne10_uint32_t j = 0; j < n; j++)
+            {
+                top = a[j * n + k];
+                for (ne10_uint32_t i = k + 1; i < n; i++)
+                {
+                    sel = vceqq_u32 (p, vdupq_n_u32 (i));
+                    a[j * n + k] = vbslq_f32 (sel, a[j * n + i], a[j * n + k]);
+                    a[j * n + i] = vbslq_f32 (sel, top, a[j * n + i]);
+                }
+            }
+
+            /* a zero pivot leaves the (zero) column and the rest of the matrix as they are */
+            pivot = a[k * n + k];
+            nonzero = vmvnq_u32 (vceqq_f32 (pivot, vdupq_n_f32 (0.0f)));
+            st = ne10_decomp_status_neon (st, vcleq_f32 (vabsq_f32 (pivot), tol), k);
+            for (ne10_uint32_t i = k + 1; i < n; i++)
+            {
+                l = ne10_div_kernel_neon (a[k * n + i], pivot);
+                a[k * n + i] = vbslq_f32 (nonzero, l, a[k * n + i]);
+            }
+            for (ne10_uint32_t j = k + 1; j < n; j++)
+            {
+                for (ne10_uint32_t i = k + 1; i < n; i++)
+                    a[j * n + i] = vmlsq_f32 (a[j * n + i], a[k * n + i], a[j * n + k]);
+            }
+        }
+        ne10_decomp_store_x4_neon (dst + itr * n * n, a, n * n);
+        vst1q_s32 (status + itr, vreinterpretq_s32_u32 (st));
+        failed |= ne10_decomp_any_neon (st);
+    }
+    if (ne10_lu_f32_c (dst + itr * n * n, piv + itr * n, status + itr, src + itr * n * n, n, count - itr) != NE10_OK)
+        failed = 1;
+    return failed ? NE10_ERR : NE10_OK;
+}
+
+ne10_result_t ne10_lu_solve_f32_neon (ne10_float32_t * dst, ne10_float32_t * lu, ne10_uint8_t * piv, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count)
+{
+    float32x4_t a[NE10_DECOMP_MAX_N * NE10_DECOMP_MAX_N];
+    float32x4_t x[NE10_DECOMP_MAX_N];
+    float32x4_t top;
+    uint32x4_t p, sel;
+    ne10_uint32_t lanes[4];
+    ne10_uint32_t itr = 0;
+
+    assert (dst && lu && piv && src);
+    if (n < 2 || n > NE10_DECOMP_MAX_N)
+        return NE10_ERR;
+    for (; itr + 4 <= count; itr += 4)
+    {
+        ne10_decomp_load_x4_neon (a, lu + itr * n * n, n * n);
+        ne10_decomp_load_x4_neon (x, src + itr * n, n);
+        for (ne10_uint32_t k = 0; k < n; k++)
+        {
+            for (ne10_uint32_t lane = 0; lane < 4; lane++)
+                lanes[lane] = piv[ (itr + lane) * n + k];
+            p = vld1q_u32 (lanes);
+            top = x[k];
+            for (ne10_uint32_t i = k + 1; i < n; i++)
+            {
+                sel = vceqq_u32 (p, vdupq_n_u32 (i));
+                x[k] = vbslq_f32 (sel, x[i], x[k]);
+                x[i] = vbslq_f32 (sel, top, x[i]);
+            }
+        }
+        for (ne10_uint32_t i = 1; i < n; i++)
+        {
+            for (ne10_uint32_t k = 0; k < i; k++)
+                x[i] = vmlsq_f32 (x[i], a[k * n + i], x[k]);
+        }
+        for (ne10_uint32_t i = n; i-- > 0;)
+        {
+            for (ne10_uint32_t k = i + 1; k < n; k++)
+                x[i] = vmlsq_f32 (x[i], a[k * n + i], x[k]);
+            x[i] = ne10_div_kernel_neon (x[i], a[i * n + i]);
+        }
+        ne10_decomp_store_x4_neon (dst + itr * n, x, n);
+    }
+    return ne10_lu_solve_f32_c (dst + itr * n, lu + itr * n * n, piv + itr * n, src + itr * n, n, count - itr);
+}
+
+ne10_result_t ne10_qr_f32_neon (ne10_float32_t * q, ne10_float32_t * r, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count)
+{
+    float32x4_t qm[NE10_DECOMP_MAX_N * NE10_DECOMP_MAX_N];
+    float32x4_t rm[NE10_DECOMP_MAX_N * NE10_DECOMP_MAX_N];
+    float32x4_t v[NE10_DECOMP_MAX_N];
+    float32x4_t norm, alpha, vv, d, f;
+    uint32x4_t zero_col;
+    ne10_uint32_t itr = 0;
+
+    assert (q && r && src);
+    if (n < 2 || n > NE10_DECOMP_MAX_N)
+        return NE10_ERR;
+    for (; itr + 4 <= count; itr += 4)
+    {
+        ne10_decomp_load_x4_neon (rm, src + itr * n * n, n * n);
+        for (ne10_uint32_t j = 0; j < n; j++)
+        {
+            for (ne10_uint32_t i = 0; i < n; i++)
+                qm[j * n + i] = vdupq_n_f32 ( (i == j) ? 1.0f : 0.0f);
+        }
+
+        for (ne10_uint32_t k = 0; k + 1 < n; k++)
+        {
+            norm = vmulq_f32 (rm[k * n + k], rm[k * n + k]);
+            for (ne10_uint32_t i = k + 1; i < n; i++)
+                norm = vmlaq_f32 (norm, rm[k * n + i], rm[k * n + i]);
+            norm = ne10_sqrt_kernel_neon (norm);
+            alpha = vbslq_f32 (vcgeq_f32 (rm[k * n + k], vdupq_n_f32 (0.0f)), vnegq_f32 (norm), norm);
+
+            v[k] = vsubq_f32 (rm[k * n + k], alpha);
+            for (ne10_uint32_t i = k + 1; i < n; i++)
+                v[i] = rm[k * n + i];
+            vv = vmulq_f32 (v[k], v[k]);
+            for (ne10_uint32_t i = k + 1; i < n; i++)
+                vv = vmlaq_f32 (vv, v[i], v[i]);
+            /* a zero column gets no reflection */
+            zero_col = vceqq_f32 (vv, vdupq_n_f32 (0.0f));
+
+            for (ne10_uint32_t j = k; j < n; j++)
+            {
+                d = vmulq_f32 (v[k], rm[j * n + k]);
+                for (ne10_uint32_t i = k + 1; i < n; i++)
+                    d = vmlaq_f32 (d, v[i], rm[j * n + i]);
+                f = vbslq_f32 (zero_col, vdupq_n_f32 (0.0f), ne10_div_kernel_neon (vmulq_n_f32 (d, 2.0f), vv));
+                for (ne10_uint32_t i = k; i < n; i++)
+                    rm[j * n + i] = vmlsq_f32 (rm[j * n + i], f, v[i]);
+            }
+            for (ne10_uint32_t i = 0; i < n; i++)
+            {
+                d = vmulq_f32 (qm[k * n + i], v[k]);
+                for (ne10_uint32_t j = k + 1; j < n; j++)
+                    d = vmlaq_f32 (d, qm[j * n + i], v[j]);
+                f = vbslq_f32 (zero_col, vdupq_n_f32 (0.0f), ne10_div_kernel_neon (vmulq_n_f32 (d, 2.0f), vv));
+                for (ne10_uint32_t j = k; j < n; j++)
+                    qm[j * n + i] = vmlsq_f32 (qm[j * n + i], f, v[j]);
+            }
+        }
+
+        for (ne10_uint32_t j = 0; j < n; j++)
+        {
+            for (ne10_uint32_t i = j + 1; i < n; i++)
+                rm[j * n + i] = vdupq_n_f32 (0.0f);
+        }
+        ne10_decomp_store_x4_neon (q + itr * n * n, qm, n * n);
+        ne10_decomp_store_x4_neon (r + itr * n * n, rm, n * n);
+    }
+    return ne10_qr_f32_c (q + itr * n * n, r + itr * n * n, src + itr * n * n, n, count - itr);
+}
+
+static inline float32x4_t ne10_svd_dot_neon (const float32x4_t * a, const float32x4_t * b)
+{
+    float32x4_t d = vmulq_f32 (a[0], b[0]);
+
+    d = vmlaq_f32 (d, a[1], b[1]);
+    return vmlaq_f32 (d, a[2], b[2]);
+}
+
+static inline void ne10_svd_rotate_neon (float32x4_t * ap, float32x4_t * aq, float32x4_t c, float32x4_t s)
+{
+    float32x4_t t;
+
+    for (ne10_uint32_t r = 0; r < 3; r++)
+    {
+        t = ap[r];
+        ap[r] = vmlsq_f32 (vmulq_f32 (c, t), s, aq[r]);
+        aq[r] = vmlaq_f32 (vmulq_f32 (s, t), c, aq[r]);
+    }
+}
+
+static inline void ne10_svd_swap_neon (uint32x4_t sel, float32x4_t * a, float32x4_t * b, ne10_uint32_t len)
+{
+    float32x4_t t;
+
+    for (ne10_uint32_t r = 0; r < len; r++)
+    {
+        t = a[r];
+        a[r] = vbslq_f32 (sel, b[r], a[r]);
+        b[r] = vbslq_f32 (sel, t, b[r]);
+    }
+}
+
+ne10_result_t ne10_svd_3x3f_neon (ne10_mat3x3f_t * u, ne10_vec3f_t * s, ne10_mat3x3f_t * v, ne10_mat3x3f_t * src, ne10_uint32_t count)
+{
+    static const ne10_uint32_t pairs[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+    static const ne10_uint32_t order[3][2] = { { 0, 1 }, { 1, 2 }, { 0, 1 } };
+    float32x4_t a[3][3], w[3][3], sigma[3];
+    float32x4_t one = vdupq_n_f32 (1.0f);
+    float32x4_t zero = vdupq_n_f32 (0.0f);
+    float32x4_t alpha, beta, gamma, zeta, t, c, sn;
+    float32x4x3_t sv;
+    uint32x4_t sel;
+    ne10_uint32_t p, q, itr = 0;
+
+    assert (u && s && v && src);
+    for (; itr + 4 <= count; itr += 4)
+    {
+        ne10_mat3x3f_load_x4_neon (&a[0][0], (const ne10_float32_t *) &src[itr]);
+        for (ne10_uint32_t k = 0; k < 3; k++)
+        {
+            for (ne10_uint32_t r = 0; r < 3; r++)
+                w[k][r] = (k == r) ? one : zero;
+        }
+
+        for (ne10_uint32_t sweep = 0; sweep < NE10_SVD_SWEEPS; sweep++)
+        {
+            for (ne10_uint32_t k = 0; k < 3; k++)
+            {
+                p = pairs[k][0];
+                q = pairs[k][1];
+                alpha = ne10_svd_dot_neon (a[p], a[p]);
+                beta = ne10_svd_dot_neon (a[q], a[q]);
+                gamma = ne10_svd_dot_neon (a[p], a[q]);
+                zeta = ne10_div_kernel_neon (vsubq_f32 (beta, alpha), vmulq_n_f32 (gamma, 2.0f));
+                t = ne10_div_kernel_neon (one, vaddq_f32 (vabsq_f32 (zeta), ne10_sqrt_kernel_neon (vmlaq_f32 (one, zeta, zeta))));
+                t = vbslq_f32 (vcltq_f32 (zeta, zero), vnegq_f32 (t), t);
+                /* orthogonal columns get the identity rotation, c = 1 and s = 0 */
+                t = vbslq_f32 (vceqq_f32 (gamma, zero), zero, t);
+                c = ne10_div_kernel_neon (one, ne10_sqrt_kernel_neon (vmlaq_f32 (one, t, t)));
+                sn = vmulq_f32 (c, t);
+                ne10_svd_rotate_neon (a[p], a[q], c, sn);
+                ne10_svd_rotate_neon (w[p], w[q], c, sn);
+            }
+        }
+
+        for (ne10_uint32_t k = 0; k < 3; k++)
+            sigma[k] = ne10_sqrt_kernel_neon (ne10_svd_dot_neon (a[k], a[k]));
+        for (ne10_uint32_t k = 0; k < 3; k++)
+        {
+            p = order[k][0];
+            q = order[k][1];
+            sel = vcltq_f32 (sigma[p], sigma[q]);
+            ne10_svd_swap_neon (sel, &sigma[p], &sigma[q], 1);
+            ne10_svd_swap_neon (sel, a[p], a[q], 3);
+            ne10_svd_swap_neon (sel, w[p], w[q], 3);
+        }
+
+        for (ne10_uint32_t k = 0; k < 3; k++)
+        {
+            sel = vcgtq_f32 (sigma[k], zero);
+            for (ne10_uint32_t r = 0; r < 3; r++)
+                a[k][r] = vbslq_f32 (sel, ne10_div_kernel_neon (a[k][r], sigma[k]), zero);
+        }
+        sel = vcleq_f32 (sigma[2], vmulq_n_f32 (sigma[0], NE10_SVD_RANK_EPS));
+        a[2][0] = vbslq_f32 (sel, vmlsq_f32 (vmulq_f32 (a[0][1], a[1][2]), a[0][2], a[1][1]), a[2][0]);
+        a[2][1] = vbslq_f32 (sel, vmlsq_f32 (vmulq_f32 (a[0][2], a[1][0]), a[0][0], a[1][2]), a[2][1]);
+        a[2][2] = vbslq_f32 (sel, vmlsq_f32 (vmulq_f32 (a[0][0], a[1][1]), a[0][1], a[1][0]), a[2][2]);
+
+        ne10_mat3x3f_store_x4_neon ( (ne10_float32_t *) &u[itr], &a[0][0]);
+        ne10_mat3x3f_store_x4_neon ( (ne10_float32_t *) &v[itr], &w[0][0]);
+        sv.val[0] = sigma[0];
+        sv.val[1] = sigma[1];
+        sv.val[2] = sigma[2];
+        vst3q_f32 (&s[itr].x, sv);
+    }
+    return ne10_svd_3x3f_c (u + itr, s + itr, v + itr, src + itr, count - itr);
+}
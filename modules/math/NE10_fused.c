@@ -0,0 +1,124 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * NE10 Library : math/NE10_fused.c
+ */
+
+#include "NE10_types.h"
+#include "macros.h"
+
+#include <assert.h>
+
+ne10_result_t ne10_axpby_float_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, const ne10_float32_t a, const ne10_float32_t b, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = src1[ itr ] * a + src2[ itr ] * b;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mulcaddc_float_c (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t scale, const ne10_float32_t offset, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = src[ itr ] * scale + offset;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_clamp_float_c (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t lo, const ne10_float32_t hi, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_float32_t x = src[ itr ];
+
+        if (x < lo)
+            x = lo;
+        if (x > hi)
+            x = hi;
+        dst[ itr ] = x;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_lerp_float_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, const ne10_float32_t t, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = src1[ itr ] + (src2[ itr ] - src1[ itr ]) * t;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sqdiff_acc_float_c (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstAccSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_float32_t d = src1[ itr ] - src2[ itr ];
+        dst[ itr ] = acc[ itr ] + d * d;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_scale_float_s16_c (ne10_int16_t * dst, ne10_float32_t * src, const ne10_float32_t scale, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_float32_t x = src[ itr ] * scale;
+        ne10_int32_t i;
+
+        /* NaN gives 0, as on NEON; then saturate, so that the conversion below cannot overflow */
+        if (x != x)
+            x = 0.0f;
+        if (x < -32768.0f)
+            x = -32768.0f;
+        if (x > 32767.0f)
+            x = 32767.0f;
+        /*
+         * round to nearest, ties away from zero. The remainder x - trunc(x)
+         * is exact, whereas adding 0.5 before truncating rounds twice and
+         * turns 0.49999997 into 1.
+         */
+        i = (ne10_int32_t) x;
+        x -= (ne10_float32_t) i;
+        if (x >= 0.5f)
+            i++;
+        else if (x <= -0.5f)
+            i--;
+        dst[ itr ] = (ne10_int16_t) i;
+    }
+    return NE10_OK;
+}
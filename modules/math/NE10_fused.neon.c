@@ -0,0 +1,144 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * NE10 Library : math/NE10_fused.neon.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+/*
+ * Each kernel makes a single pass over its operands: the intermediate values
+ * of the expression stay in registers instead of being written back between
+ * separate Ne10 calls.
+ */
+
+ne10_result_t ne10_axpby_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, const ne10_float32_t a, const ne10_float32_t b, ne10_uint32_t count)
+{
+    float32x4_t n_a = vdupq_n_f32 (a);
+    float32x4_t n_b = vdupq_n_f32 (b);
+
+    NE10_DstSrc1Src2_DO_COUNT_TIMES_FLOAT_NEON
+    (
+        n_dst = vmlaq_f32 (vmulq_f32 (n_src, n_a), n_src2, n_b);
+        ,
+        n_rest = vmla_f32 (vmul_f32 (n_rest, vget_low_f32 (n_a)), n_rest2, vget_low_f32 (n_b));
+    );
+}
+
+ne10_result_t ne10_mulcaddc_float_neon (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t scale, const ne10_float32_t offset, ne10_uint32_t count)
+{
+    float32x4_t n_scale = vdupq_n_f32 (scale);
+    float32x4_t n_offset = vdupq_n_f32 (offset);
+
+    NE10_DstSrc_DO_COUNT_TIMES_FLOAT_NEON
+    (
+        n_dst = vmlaq_f32 (n_offset, n_src, n_scale);
+        ,
+        n_rest = vmla_f32 (vget_low_f32 (n_offset), n_rest, vget_low_f32 (n_scale));
+    );
+}
+
+ne10_result_t ne10_clamp_float_neon (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t lo, const ne10_float32_t hi, ne10_uint32_t count)
+{
+    float32x4_t n_lo = vdupq_n_f32 (lo);
+    float32x4_t n_hi = vdupq_n_f32 (hi);
+
+    NE10_DstSrc_DO_COUNT_TIMES_FLOAT_NEON
+    (
+        n_dst = vminq_f32 (vmaxq_f32 (n_src, n_lo), n_hi);
+        ,
+        n_rest = vmin_f32 (vmax_f32 (n_rest, vget_low_f32 (n_lo)), vget_low_f32 (n_hi));
+    );
+}
+
+ne10_result_t ne10_lerp_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, const ne10_float32_t t, ne10_uint32_t count)
+{
+    float32x4_t n_t = vdupq_n_f32 (t);
+
+    NE10_DstSrc1Src2_DO_COUNT_TIMES_FLOAT_NEON
+    (
+        n_dst = vmlaq_f32 (n_src, vsubq_f32 (n_src2, n_src), n_t);
+        ,
+        n_rest = vmla_f32 (n_rest, vsub_f32 (n_rest2, n_rest), vget_low_f32 (n_t));
+    );
+}
+
+ne10_result_t ne10_sqdiff_acc_float_neon (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    NE10_DstAccSrc1Src2_DO_COUNT_TIMES_FLOAT_NEON
+    (
+        n_src = vsubq_f32 (n_src, n_src2);
+        n_dst = vmlaq_f32 (n_acc, n_src, n_src);
+        ,
+        n_rest = vsub_f32 (n_rest, n_rest2);
+        n_rest = vmla_f32 (n_rest_acc, n_rest, n_rest);
+    );
+}
+
+ne10_result_t ne10_scale_float_s16_neon (ne10_int16_t * dst, ne10_float32_t * src, const ne10_float32_t scale, ne10_uint32_t count)
+{
+    float32x4_t n_scale = vdupq_n_f32 (scale);
+    float32x4_t n_min = vdupq_n_f32 (-32768.0f);
+    float32x4_t n_max = vdupq_n_f32 (32767.0f);
+    float32x4_t n_half = vdupq_n_f32 (0.5f);
+    float32x4_t n_mhalf = vdupq_n_f32 (-0.5f);
+    float32x4_t x0, x1;
+    int32x4_t i0, i1;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 8; count -= 8)
+    {
+        x0 = vmulq_f32 (vld1q_f32 (src), n_scale);
+        x1 = vmulq_f32 (vld1q_f32 (src + 4), n_scale);
+        x0 = vminq_f32 (vmaxq_f32 (x0, n_min), n_max);
+        x1 = vminq_f32 (vmaxq_f32 (x1, n_min), n_max);
+        /*
+         * round to nearest with ties away from zero: truncate, then step by
+         * one where the exact remainder reaches a half (the comparison masks
+         * are -1 where true)
+         */
+        i0 = vcvtq_s32_f32 (x0);
+        i1 = vcvtq_s32_f32 (x1);
+        x0 = vsubq_f32 (x0, vcvtq_f32_s32 (i0));
+        x1 = vsubq_f32 (x1, vcvtq_f32_s32 (i1));
+        i0 = vsubq_s32 (i0, vreinterpretq_s32_u32 (vcgeq_f32 (x0, n_half)));
+        i1 = vsubq_s32 (i1, vreinterpretq_s32_u32 (vcgeq_f32 (x1, n_half)));
+        i0 = vaddq_s32 (i0, vreinterpretq_s32_u32 (vcleq_f32 (x0, n_mhalf)));
+        i1 = vaddq_s32 (i1, vreinterpretq_s32_u32 (vcleq_f32 (x1, n_mhalf)));
+        vst1q_s16 (dst, vcombine_s16 (vmovn_s32 (i0), vmovn_s32 (i1)));
+        src += 8;
+        dst += 8;
+    }
+    return ne10_scale_float_s16_c (dst, src, scale, count);
+}
@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_gemm.c
+ */
+
+#include "NE10_types.h"
+#include "macros.h"
+
+#include <assert.h>
+
+/* element (i, j) of op(X), for a row-major X */
+#define NE10_GEMM_AT(x, ld, trans, i, j) \
+    ( (trans) == NE10_NO_TRANS ? (x)[ (i) * (ld) + (j)] : (x)[ (j) * (ld) + (i)])
+
+/*
+ * The naive triple loop: it is the reference for the packed NEON version and
+ * the baseline of its benchmark.
+ */
+ne10_result_t ne10_gemm_f32_c (ne10_matrix_layout_t layout,
+                               ne10_matrix_trans_t trans_a,
+                               ne10_matrix_trans_t trans_b,
+                               ne10_uint32_t m,
+                               ne10_uint32_t n,
+                               ne10_uint32_t k,
+                               ne10_float32_t alpha,
+                               ne10_float32_t * a,
+                               ne10_uint32_t lda,
+                               ne10_float32_t * b,
+                               ne10_uint32_t ldb,
+                               ne10_float32_t beta,
+                               ne10_float32_t * c,
+                               ne10_uint32_t ldc)
+{
+    /* a column-major product is the row-major product of the transposes, C^T = op(B)^T * op(A)^T */
+    if (layout == NE10_COL_MAJOR)
+        return ne10_gemm_f32_c (NE10_ROW_MAJOR, trans_b, trans_a, n, m, k, alpha, b, ldb, a, lda, beta, c, ldc);
+
+    if (lda < ( (trans_a == NE10_NO_TRANS) ? k : m) || ldb < ( (trans_b == NE10_NO_TRANS) ? n : k) || ldc < n)
+        return NE10_ERR;
+
+    for ( unsigned int i = 0; i < m; i++ )
+    {
+        for ( unsigned int j = 0; j < n; j++ )
+        {
+            ne10_float32_t sum = 0.0f;
+
+            for ( unsigned int p = 0; p < k; p++ )
+            {
+                sum += NE10_GEMM_AT (a, lda, trans_a, i, p) * NE10_GEMM_AT (b, ldb, trans_b, p, j);
+            }
+            /* C is not read when beta is 0, so it may hold NaNs */
+            c[i * ldc + j] = alpha * sum + ( (beta == 0.0f) ? 0.0f : beta * c[i * ldc + j]);
+        }
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_gemv_f32_c (ne10_matrix_layout_t layout,
+                               ne10_matrix_trans_t trans,
+                               ne10_uint32_t m,
+                               ne10_uint32_t n,
+                               ne10_float32_t alpha,
+                               ne10_float32_t * a,
+                               ne10_uint32_t lda,
+                               ne10_float32_t * x,
+                               ne10_float32_t beta,
+                               ne10_float32_t * y)
+{
+    ne10_uint32_t rows, len;
+
+    /* a column-major m x n matrix is the transpose of a row-major n x m one */
+    if (layout == NE10_COL_MAJOR)
+        return ne10_gemv_f32_c (NE10_ROW_MAJOR, (trans == NE10_NO_TRANS) ? NE10_TRANS : NE10_NO_TRANS, n, m, alpha, a, lda, x, beta, y);
+
+    if (lda < n)
+        return NE10_ERR;
+
+    rows = (trans == NE10_NO_TRANS) ? m : n;
+    len = (trans == NE10_NO_TRANS) ? n : m;
+    for ( unsigned int i = 0; i < rows; i++ )
+    {
+        ne10_float32_t sum = 0.0f;
+
+        for ( unsigned int p = 0; p < len; p++ )
+        {
+            sum += NE10_GEMM_AT (a, lda, trans, i, p) * x[p];
+        }
+        y[i] = alpha * sum + ( (beta == 0.0f) ? 0.0f : beta * y[i]);
+    }
+    return NE10_OK;
+}
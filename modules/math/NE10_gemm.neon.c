@@ -0,0 +1,386 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_gemm.neon.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "macros.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <arm_neon.h>
+
+/*
+ * Register block (MR x NR) of the micro-kernel and cache blocks of the packed
+ * panels: a KC x NR panel of B stays in L1 while the MC x KC block of A and the
+ * KC x NC block of B stay in L2.
+ */
+#define NE10_GEMM_MR 4
+#define NE10_GEMM_NR 8
+#define NE10_GEMM_MC 64
+#define NE10_GEMM_KC 256
+#define NE10_GEMM_NC 256
+
+#ifdef __aarch64__
+#define NE10_GEMM_MLA_LANE(acc, b, a, lane) vfmaq_lane_f32 (acc, b, a, lane)
+#else
+#define NE10_GEMM_MLA_LANE(acc, b, a, lane) vmlaq_lane_f32 (acc, b, a, lane)
+#endif
+
+/* element (i, j) of op(X), for a row-major X */
+#define NE10_GEMM_AT(x, ld, trans, i, j) \
+    ( (trans) == NE10_NO_TRANS ? (x)[ (i) * (ld) + (j)] : (x)[ (j) * (ld) + (i)])
+
+/*
+ * Packs rows [i0, i0 + mc) and columns [p0, p0 + kc) of op(A) into panels of
+ * MR rows, each stored column by column; the last panel is zero-padded.
+ */
+static void ne10_gemm_pack_a (ne10_float32_t * dst, ne10_float32_t * a, ne10_uint32_t lda, ne10_matrix_trans_t trans,
+                              ne10_uint32_t i0, ne10_uint32_t p0, ne10_uint32_t mc, ne10_uint32_t kc)
+{
+    ne10_uint32_t ir, p, r;
+
+    for (ir = 0; ir < mc; ir += NE10_GEMM_MR)
+    {
+        for (p = 0; p < kc; p++, dst += NE10_GEMM_MR)
+        {
+            if (trans == NE10_TRANS && ir + NE10_GEMM_MR <= mc)
+            {
+                vst1q_f32 (dst, vld1q_f32 (a + (p0 + p) * lda + i0 + ir));
+                continue;
+            }
+            for (r = 0; r < NE10_GEMM_MR; r++)
+                dst[r] = (ir + r < mc) ? NE10_GEMM_AT (a, lda, trans, i0 + ir + r, p0 + p) : 0.0f;
+        }
+    }
+}
+
+/*
+ * Packs rows [p0, p0 + kc) and columns [j0, j0 + nc) of op(B) into panels of
+ * NR columns, each stored row by row; the last panel is zero-padded.
+ */
+static void ne10_gemm_pack_b (ne10_float32_t * dst, ne10_float32_t * b, ne10_uint32_t ldb, ne10_matrix_trans_t trans,
+                              ne10_uint32_t p0, ne10_uint32_t j0, ne10_uint32_t kc, ne10_uint32_t nc)
+{
+    ne10_uint32_t jr, p, j;
+
+    for (jr = 0; jr < nc; jr += NE10_GEMM_NR)
+    {
+        for (p = 0; p < kc; p++, dst += NE10_GEMM_NR)
+        {
+            if (trans == NE10_NO_TRANS && jr + NE10_GEMM_NR <= nc)
+            {
+                ne10_float32_t * row = b + (p0 + p) * ldb + j0 + jr;
+                vst1q_f32 (dst, vld1q_f32 (row));
+                vst1q_f32 (dst + 4, vld1q_f32 (row + 4));
+                continue;
+            }
+            for (j = 0; j < NE10_GEMM_NR; j++)
+                dst[j] = (jr + j < nc) ? NE10_GEMM_AT (b, ldb, trans, p0 + p, j0 + jr + j) : 0.0f;
+        }
+    }
+}
+
+/* c = alpha * acc + beta * c; c is not read when beta is 0 */
+static inline void ne10_gemm_update_neon (ne10_float32_t * c, float32x4_t acc, ne10_float32_t alpha, ne10_float32_t beta)
+{
+    float32x4_t r = vmulq_n_f32 (acc, alpha);
+
+    if (beta != 0.0f)
+        r = vmlaq_n_f32 (r, vld1q_f32 (c), beta);
+    vst1q_f32 (c, r);
+}
+
+/* C (MR x NR) = alpha * Ap * Bp + beta * C over kc packed columns/rows */
+static void ne10_gemm_kernel_neon (ne10_uint32_t kc, ne10_float32_t * ap, ne10_float32_t * bp,
+                                   ne10_float32_t alpha, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc)
+{
+    float32x4_t c00 = vdupq_n_f32 (0.0f), c01 = vdupq_n_f32 (0.0f);
+    float32x4_t c10 = vdupq_n_f32 (0.0f), c11 = vdupq_n_f32 (0.0f);
+    float32x4_t c20 = vdupq_n_f32 (0.0f), c21 = vdupq_n_f32 (0.0f);
+    float32x4_t c30 = vdupq_n_f32 (0.0f), c31 = vdupq_n_f32 (0.0f);
+    ne10_uint32_t p;
+
+    for (p = 0; p < kc; p++, ap += NE10_GEMM_MR, bp += NE10_GEMM_NR)
+    {
+        float32x4_t a = vld1q_f32 (ap);
+        float32x4_t b0 = vld1q_f32 (bp);
+        float32x4_t b1 = vld1q_f32 (bp + 4);
+        float32x2_t a01 = vget_low_f32 (a);
+        float32x2_t a23 = vget_high_f32 (a);
+
+        c00 = NE10_GEMM_MLA_LANE (c00, b0, a01, 0);
+        c01 = NE10_GEMM_MLA_LANE (c01, b1, a01, 0);
+        c10 = NE10_GEMM_MLA_LANE (c10, b0, a01, 1);
+        c11 = NE10_GEMM_MLA_LANE (c11, b1, a01, 1);
+        c20 = NE10_GEMM_MLA_LANE (c20, b0, a23, 0);
+        c21 = NE10_GEMM_MLA_LANE (c21, b1, a23, 0);
+        c30 = NE10_GEMM_MLA_LANE (c30, b0, a23, 1);
+        c31 = NE10_GEMM_MLA_LANE (c31, b1, a23, 1);
+    }
+
+    ne10_gemm_update_neon (c, c00, alpha, beta);
+    ne10_gemm_update_neon (c + 4, c01, alpha, beta);
+    ne10_gemm_update_neon (c + ldc, c10, alpha, beta);
+    ne10_gemm_update_neon (c + ldc + 4, c11, alpha, beta);
+    ne10_gemm_update_neon (c + 2 * ldc, c20, alpha, beta);
+    ne10_gemm_update_neon (c + 2 * ldc + 4, c21, alpha, beta);
+    ne10_gemm_update_neon (c + 3 * ldc, c30, alpha, beta);
+    ne10_gemm_update_neon (c + 3 * ldc + 4, c31, alpha, beta);
+}
+
+/* the packed blocks of one (jc, pc, ic) iteration, with partial tiles going through a buffer */
+static void ne10_gemm_macro_kernel_neon (ne10_uint32_t mc, ne10_uint32_t nc, ne10_uint32_t kc,
+                                         ne10_float32_t * pack_a, ne10_float32_t * pack_b,
+                                         ne10_float32_t alpha, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc)
+{
+    ne10_float32_t tile[NE10_GEMM_MR * NE10_GEMM_NR];
+    ne10_uint32_t ir, jr, r, j, mr, nr;
+
+    for (jr = 0; jr < nc; jr += NE10_GEMM_NR)
+    {
+        nr = NE10_MIN (NE10_GEMM_NR, nc - jr);
+        for (ir = 0; ir < mc; ir += NE10_GEMM_MR)
+        {
+            ne10_float32_t * cp = c + ir * ldc + jr;
+
+            mr = NE10_MIN (NE10_GEMM_MR, mc - ir);
+            if (mr == NE10_GEMM_MR && nr == NE10_GEMM_NR)
+            {
+                ne10_gemm_kernel_neon (kc, pack_a + ir * kc, pack_b + jr * kc, alpha, beta, cp, ldc);
+                continue;
+            }
+
+            ne10_gemm_kernel_neon (kc, pack_a + ir * kc, pack_b + jr * kc, 1.0f, 0.0f, tile, NE10_GEMM_NR);
+            for (r = 0; r < mr; r++)
+            {
+                for (j = 0; j < nr; j++)
+                {
+                    ne10_float32_t v = alpha * tile[r * NE10_GEMM_NR + j];
+                    cp[r * ldc + j] = (beta == 0.0f) ? v : v + beta * cp[r * ldc + j];
+                }
+            }
+        }
+    }
+}
+
+ne10_result_t ne10_gemm_f32_neon (ne10_matrix_layout_t layout,
+                                  ne10_matrix_trans_t trans_a,
+                                  ne10_matrix_trans_t trans_b,
+                                  ne10_uint32_t m,
+                                  ne10_uint32_t n,
+                                  ne10_uint32_t k,
+                                  ne10_float32_t alpha,
+                                  ne10_float32_t * a,
+                                  ne10_uint32_t lda,
+                                  ne10_float32_t * b,
+                                  ne10_uint32_t ldb,
+                                  ne10_float32_t beta,
+                                  ne10_float32_t * c,
+                                  ne10_uint32_t ldc)
+{
+    ne10_float32_t * pack_a;
+    ne10_float32_t * pack_b;
+    ne10_uint32_t ic, jc, pc, mc, nc, kc;
+
+    /* a column-major product is the row-major product of the transposes, C^T = op(B)^T * op(A)^T */
+    if (layout == NE10_COL_MAJOR)
+        return ne10_gemm_f32_neon (NE10_ROW_MAJOR, trans_b, trans_a, n, m, k, alpha, b, ldb, a, lda, beta, c, ldc);
+
+    if (lda < ( (trans_a == NE10_NO_TRANS) ? k : m) || ldb < ( (trans_b == NE10_NO_TRANS) ? n : k) || ldc < n)
+        return NE10_ERR;
+
+    /* nothing to accumulate: C = beta * C */
+    if (k == 0 || alpha == 0.0f)
+    {
+        for (ic = 0; ic < m; ic++)
+        {
+            for (jc = 0; jc < n; jc++)
+                c[ic * ldc + jc] = (beta == 0.0f) ? 0.0f : beta * c[ic * ldc + jc];
+        }
+        return NE10_OK;
+    }
+
+    pack_a = (ne10_float32_t*) NE10_MALLOC (NE10_GEMM_MC * NE10_GEMM_KC * sizeof (ne10_float32_t));
+    pack_b = (ne10_float32_t*) NE10_MALLOC (NE10_GEMM_KC * NE10_GEMM_NC * sizeof (ne10_float32_t));
+    if (pack_a == NULL || pack_b == NULL)
+    {
+        NE10_FREE (pack_a);
+        NE10_FREE (pack_b);
+        return NE10_ERR;
+    }
+
+    for (jc = 0; jc < n; jc += NE10_GEMM_NC)
+    {
+        nc = NE10_MIN (NE10_GEMM_NC, n - jc);
+        for (pc = 0; pc < k; pc += NE10_GEMM_KC)
+        {
+            kc = NE10_MIN (NE10_GEMM_KC, k - pc);
+            ne10_gemm_pack_b (pack_b, b, ldb, trans_b, pc, jc, kc, nc);
+            for (ic = 0; ic < m; ic += NE10_GEMM_MC)
+            {
+                mc = NE10_MIN (NE10_GEMM_MC, m - ic);
+                ne10_gemm_pack_a (pack_a, a, lda, trans_a, ic, pc, mc, kc);
+                /* beta only applies to the first block of k; the later ones accumulate */
+                ne10_gemm_macro_kernel_neon (mc, nc, kc, pack_a, pack_b, alpha, (pc == 0) ? beta : 1.0f,
+                                             c + ic * ldc + jc, ldc);
+            }
+        }
+    }
+
+    NE10_FREE (pack_a);
+    NE10_FREE (pack_b);
+    return NE10_OK;
+}
+
+/* dot products of up to four rows of A with x; the row pointers may repeat */
+static inline float32x4_t ne10_gemv_dot4_neon (ne10_float32_t * a0, ne10_float32_t * a1, ne10_float32_t * a2, ne10_float32_t * a3,
+                                               ne10_float32_t * x, ne10_uint32_t len)
+{
+    float32x4_t acc0 = vdupq_n_f32 (0.0f);
+    float32x4_t acc1 = vdupq_n_f32 (0.0f);
+    float32x4_t acc2 = vdupq_n_f32 (0.0f);
+    float32x4_t acc3 = vdupq_n_f32 (0.0f);
+    float32x2_t lo, hi;
+    ne10_float32_t tail[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    ne10_uint32_t p;
+
+    for (p = 0; p + 4 <= len; p += 4)
+    {
+        float32x4_t xv = vld1q_f32 (x + p);
+        acc0 = vmlaq_f32 (acc0, vld1q_f32 (a0 + p), xv);
+        acc1 = vmlaq_f32 (acc1, vld1q_f32 (a1 + p), xv);
+        acc2 = vmlaq_f32 (acc2, vld1q_f32 (a2 + p), xv);
+        acc3 = vmlaq_f32 (acc3, vld1q_f32 (a3 + p), xv);
+    }
+    for (; p < len; p++)
+    {
+        tail[0] += a0[p] * x[p];
+        tail[1] += a1[p] * x[p];
+        tail[2] += a2[p] * x[p];
+        tail[3] += a3[p] * x[p];
+    }
+
+    lo = vpadd_f32 (vadd_f32 (vget_low_f32 (acc0), vget_high_f32 (acc0)),
+                    vadd_f32 (vget_low_f32 (acc1), vget_high_f32 (acc1)));
+    hi = vpadd_f32 (vadd_f32 (vget_low_f32 (acc2), vget_high_f32 (acc2)),
+                    vadd_f32 (vget_low_f32 (acc3), vget_high_f32 (acc3)));
+    return vaddq_f32 (vcombine_f32 (lo, hi), vld1q_f32 (tail));
+}
+
+/* y = alpha * A * x + beta * y for a row-major rows x len matrix, four rows at a time */
+static void ne10_gemv_rows_neon (ne10_uint32_t rows, ne10_uint32_t len, ne10_float32_t alpha, ne10_float32_t * a, ne10_uint32_t lda,
+                                 ne10_float32_t * x, ne10_float32_t beta, ne10_float32_t * y)
+{
+    ne10_float32_t sum[4];
+    ne10_uint32_t i, r;
+
+    for (i = 0; i < rows; i += 4)
+    {
+        ne10_uint32_t nrows = NE10_MIN (4, rows - i);
+        ne10_float32_t * a0 = a + i * lda;
+
+        /* rows past the end repeat the first one and are not stored */
+        vst1q_f32 (sum, ne10_gemv_dot4_neon (a0, (nrows > 1) ? a0 + lda : a0, (nrows > 2) ? a0 + 2 * lda : a0,
+                                              (nrows > 3) ? a0 + 3 * lda : a0, x, len));
+        for (r = 0; r < nrows; r++)
+            y[i + r] = alpha * sum[r] + ( (beta == 0.0f) ? 0.0f : beta * y[i + r]);
+    }
+}
+
+/* y = alpha * A^T * x + beta * y for a row-major rows x len matrix, as four scaled rows at a time */
+static void ne10_gemv_cols_neon (ne10_uint32_t rows, ne10_uint32_t len, ne10_float32_t alpha, ne10_float32_t * a, ne10_uint32_t lda,
+                                 ne10_float32_t * x, ne10_float32_t beta, ne10_float32_t * y)
+{
+    ne10_uint32_t i, j, r;
+
+    for (j = 0; j < len; j++)
+        y[j] = (beta == 0.0f) ? 0.0f : beta * y[j];
+
+    for (i = 0; i < rows; i += 4)
+    {
+        ne10_uint32_t nrows = NE10_MIN (4, rows - i);
+        ne10_float32_t xs[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        ne10_float32_t * a0 = a + i * lda;
+
+        for (r = 0; r < nrows; r++)
+            xs[r] = alpha * x[i + r];
+
+        if (nrows == 4)
+        {
+            for (j = 0; j + 4 <= len; j += 4)
+            {
+                float32x4_t yv = vld1q_f32 (y + j);
+                yv = vmlaq_n_f32 (yv, vld1q_f32 (a0 + j), xs[0]);
+                yv = vmlaq_n_f32 (yv, vld1q_f32 (a0 + lda + j), xs[1]);
+                yv = vmlaq_n_f32 (yv, vld1q_f32 (a0 + 2 * lda + j), xs[2]);
+                yv = vmlaq_n_f32 (yv, vld1q_f32 (a0 + 3 * lda + j), xs[3]);
+                vst1q_f32 (y + j, yv);
+            }
+        }
+        else
+        {
+            j = 0;
+        }
+
+        for (r = 0; r < nrows; r++)
+        {
+            ne10_uint32_t q;
+
+            for (q = j; q < len; q++)
+                y[q] += a0[r * lda + q] * xs[r];
+        }
+    }
+}
+
+ne10_result_t ne10_gemv_f32_neon (ne10_matrix_layout_t layout,
+                                  ne10_matrix_trans_t trans,
+                                  ne10_uint32_t m,
+                                  ne10_uint32_t n,
+                                  ne10_float32_t alpha,
+                                  ne10_float32_t * a,
+                                  ne10_uint32_t lda,
+                                  ne10_float32_t * x,
+                                  ne10_float32_t beta,
+                                  ne10_float32_t * y)
+{
+    /* a column-major m x n matrix is the transpose of a row-major n x m one */
+    if (layout == NE10_COL_MAJOR)
+        return ne10_gemv_f32_neon (NE10_ROW_MAJOR, (trans == NE10_NO_TRANS) ? NE10_TRANS : NE10_NO_TRANS, n, m, alpha, a, lda, x, beta, y);
+
+    if (lda < n)
+        return NE10_ERR;
+
+    if (trans == NE10_NO_TRANS)
+        ne10_gemv_rows_neon (m, n, alpha, a, lda, x, beta, y);
+    else
+        ne10_gemv_cols_neon (m, n, alpha, a, lda, x, beta, y);
+    return NE10_OK;
+}
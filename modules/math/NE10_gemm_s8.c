@@ -0,0 +1,144 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_gemm_s8.c
+ */
+
+#include "NE10_types.h"
+#include "macros.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+/* element (i, j) of op(X), for a row-major X */
+#define NE10_GEMM_AT(x, ld, trans, i, j) \
+    ( (trans) == NE10_NO_TRANS ? (x)[ (i) * (ld) + (j)] : (x)[ (j) * (ld) + (i)])
+
+ne10_result_t ne10_dot_s8_c (ne10_int32_t * dst, ne10_int8_t * src1, ne10_int8_t * src2, ne10_uint32_t count)
+{
+    ne10_int32_t sum = 0;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        sum += (ne10_int32_t) src1[itr] * src2[itr];
+    }
+    *dst = sum;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_gemm_s8s8s32_c (ne10_matrix_layout_t layout,
+                                   ne10_matrix_trans_t trans_a,
+                                   ne10_matrix_trans_t trans_b,
+                                   ne10_uint32_t m,
+                                   ne10_uint32_t n,
+                                   ne10_uint32_t k,
+                                   ne10_int8_t * a,
+                                   ne10_uint32_t lda,
+                                   ne10_int8_t * b,
+                                   ne10_uint32_t ldb,
+                                   ne10_int32_t * c,
+                                   ne10_uint32_t ldc)
+{
+    /* a column-major product is the row-major product of the transposes, C^T = op(B)^T * op(A)^T */
+    if (layout == NE10_COL_MAJOR)
+        return ne10_gemm_s8s8s32_c (NE10_ROW_MAJOR, trans_b, trans_a, n, m, k, b, ldb, a, lda, c, ldc);
+
+    if (lda < ( (trans_a == NE10_NO_TRANS) ? k : m) || ldb < ( (trans_b == NE10_NO_TRANS) ? n : k) || ldc < n)
+        return NE10_ERR;
+
+    for ( unsigned int i = 0; i < m; i++ )
+    {
+        for ( unsigned int j = 0; j < n; j++ )
+        {
+            ne10_int32_t sum = 0;
+
+            for ( unsigned int p = 0; p < k; p++ )
+            {
+                sum += (ne10_int32_t) NE10_GEMM_AT (a, lda, trans_a, i, p) * NE10_GEMM_AT (b, ldb, trans_b, p, j);
+            }
+            c[i * ldc + j] = sum;
+        }
+    }
+    return NE10_OK;
+}
+
+/* saturates to the int32 range */
+static inline ne10_int32_t ne10_requantize_sat_s32 (ne10_int64_t x)
+{
+    return (ne10_int32_t) ( (x > 0x7fffffffLL) ? 0x7fffffffLL : ( (x < -0x80000000LL) ? -0x80000000LL : x));
+}
+
+/*
+ * One element of ne10_requantize_s32s8, step by step as the NEON version does
+ * it: saturating bias add, rounding doubling high multiply (VQRDMULH),
+ * rounding right shift (VRSHL) and saturating zero point add and narrowing.
+ */
+static inline ne10_int8_t ne10_requantize_one (ne10_int32_t acc, ne10_int32_t bias, ne10_int32_t multiplier,
+                                               ne10_int32_t shift, ne10_int8_t zero_point)
+{
+    ne10_int64_t x = ne10_requantize_sat_s32 ( (ne10_int64_t) acc + bias);
+
+    if (x == -0x80000000LL && multiplier == (ne10_int32_t) 0x80000000u)
+        x = 0x7fffffffLL;
+    else
+        x = (x * multiplier + (1LL << 30)) >> 31;
+    if (shift > 0)
+        x = (x + (1LL << (shift - 1))) >> shift;
+    x = ne10_requantize_sat_s32 (x + zero_point);
+    return (ne10_int8_t) ( (x > 127) ? 127 : ( (x < -128) ? -128 : x));
+}
+
+ne10_result_t ne10_requantize_s32s8_c (ne10_int8_t * dst,
+                                       ne10_uint32_t ldd,
+                                       ne10_int32_t * src,
+                                       ne10_uint32_t lds,
+                                       ne10_uint32_t m,
+                                       ne10_uint32_t n,
+                                       ne10_int32_t * bias,
+                                       ne10_int32_t * multiplier,
+                                       ne10_int32_t * shift,
+                                       ne10_int8_t zero_point)
+{
+    if (ldd < n || lds < n)
+        return NE10_ERR;
+    for ( unsigned int j = 0; j < n; j++ )
+    {
+        if (shift[j] < 0 || shift[j] > 31)
+            return NE10_ERR;
+    }
+
+    for ( unsigned int i = 0; i < m; i++ )
+    {
+        for ( unsigned int j = 0; j < n; j++ )
+        {
+            dst[i * ldd + j] = ne10_requantize_one (src[i * lds + j], (bias != NULL) ? bias[j] : 0,
+                                                    multiplier[j], shift[j], zero_point);
+        }
+    }
+    return NE10_OK;
+}
@@ -0,0 +1,500 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_gemm_s8.neon.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "macros.h"
+
+#include <assert.h>
+#include <string.h>
+#include <arm_neon.h>
+
+/*
+ * The blocking follows NE10_gemm.neon.c: a 4x8 register block and cache
+ * blocks of packed panels. The panels are packed in steps of four consecutive
+ * k, which is both what one SDOT lane consumes and what VMULL/VPADAL reduce
+ * pairwise, so the two micro-kernels share the packing.
+ */
+#define NE10_GEMM_S8_MR 4
+#define NE10_GEMM_S8_NR 8
+#define NE10_GEMM_S8_KU 4
+#define NE10_GEMM_S8_MC 64
+#define NE10_GEMM_S8_KC 512
+#define NE10_GEMM_S8_NC 256
+
+/* the SDOT kernels are built for any AArch64 target and only selected at run time when the CPU has them */
+#ifdef __aarch64__
+#ifdef __clang__
+#define NE10_TARGET_DOTPROD __attribute__ ((target ("dotprod")))
+#else
+#define NE10_TARGET_DOTPROD __attribute__ ((target ("arch=armv8.2-a+dotprod")))
+#endif
+#endif
+
+/* element (i, j) of op(X), for a row-major X */
+#define NE10_GEMM_AT(x, ld, trans, i, j) \
+    ( (trans) == NE10_NO_TRANS ? (x)[ (i) * (ld) + (j)] : (x)[ (j) * (ld) + (i)])
+
+/* C (MR x NR) = Ap * Bp over ks packed steps, added to C when accumulate is set */
+typedef void (*ne10_gemm_s8_kernel_t) (ne10_uint32_t ks, ne10_int8_t * ap, ne10_int8_t * bp,
+                                       ne10_int32_t * c, ne10_uint32_t ldc, ne10_int32_t accumulate);
+
+ne10_result_t ne10_dot_s8_neon (ne10_int32_t * dst, ne10_int8_t * src1, ne10_int8_t * src2, ne10_uint32_t count)
+{
+    int32x4_t acc0 = vdupq_n_s32 (0);
+    int32x4_t acc1 = vdupq_n_s32 (0);
+    int32x2_t sum;
+    ne10_int32_t tail = 0;
+    ne10_uint32_t i;
+
+    /* the int16 products are widened by the pairwise accumulate, so they never overflow */
+    for (i = 0; i + 16 <= count; i += 16)
+    {
+        int8x16_t x = vld1q_s8 (src1 + i);
+        int8x16_t y = vld1q_s8 (src2 + i);
+
+        acc0 = vpadalq_s16 (acc0, vmull_s8 (vget_low_s8 (x), vget_low_s8 (y)));
+        acc1 = vpadalq_s16 (acc1, vmull_s8 (vget_high_s8 (x), vget_high_s8 (y)));
+    }
+    for (; i < count; i++)
+        tail += (ne10_int32_t) src1[i] * src2[i];
+
+    acc0 = vaddq_s32 (acc0, acc1);
+    sum = vadd_s32 (vget_low_s32 (acc0), vget_high_s32 (acc0));
+    *dst = vget_lane_s32 (vpadd_s32 (sum, sum), 0) + tail;
+    return NE10_OK;
+}
+
+#ifdef __aarch64__
+NE10_TARGET_DOTPROD
+ne10_result_t ne10_dot_s8_dotprod (ne10_int32_t * dst, ne10_int8_t * src1, ne10_int8_t * src2, ne10_uint32_t count)
+{
+    int32x4_t acc0 = vdupq_n_s32 (0);
+    int32x4_t acc1 = vdupq_n_s32 (0);
+    ne10_int32_t tail = 0;
+    ne10_uint32_t i;
+
+    for (i = 0; i + 32 <= count; i += 32)
+    {
+        acc0 = vdotq_s32 (acc0, vld1q_s8 (src1 + i), vld1q_s8 (src2 + i));
+        acc1 = vdotq_s32 (acc1, vld1q_s8 (src1 + i + 16), vld1q_s8 (src2 + i + 16));
+    }
+    if (i + 16 <= count)
+    {
+        acc0 = vdotq_s32 (acc0, vld1q_s8 (src1 + i), vld1q_s8 (src2 + i));
+        i += 16;
+    }
+    for (; i < count; i++)
+        tail += (ne10_int32_t) src1[i] * src2[i];
+
+    *dst = vaddvq_s32 (vaddq_s32 (acc0, acc1)) + tail;
+    return NE10_OK;
+}
+#endif
+
+/*
+ * Packs rows [i0, i0 + mc) and columns [p0, p0 + kc) of op(A) into panels of
+ * MR rows; each step of a panel holds KU consecutive columns of every row, and
+ * the last panel and the last step are zero-padded.
+ */
+static void ne10_gemm_s8_pack_a (ne10_int8_t * dst, ne10_int8_t * a, ne10_uint32_t lda, ne10_matrix_trans_t trans,
+                                 ne10_uint32_t i0, ne10_uint32_t p0, ne10_uint32_t mc, ne10_uint32_t kc)
+{
+    ne10_uint32_t ir, p, r, t;
+
+    for (ir = 0; ir < mc; ir += NE10_GEMM_S8_MR)
+    {
+        for (p = 0; p < kc; p += NE10_GEMM_S8_KU, dst += NE10_GEMM_S8_MR * NE10_GEMM_S8_KU)
+        {
+            if (trans == NE10_NO_TRANS && ir + NE10_GEMM_S8_MR <= mc && p + NE10_GEMM_S8_KU <= kc)
+            {
+                for (r = 0; r < NE10_GEMM_S8_MR; r++)
+                    memcpy (dst + r * NE10_GEMM_S8_KU, a + (i0 + ir + r) * lda + p0 + p, NE10_GEMM_S8_KU);
+                continue;
+            }
+            for (r = 0; r < NE10_GEMM_S8_MR; r++)
+            {
+                for (t = 0; t < NE10_GEMM_S8_KU; t++)
+                    dst[r * NE10_GEMM_S8_KU + t] = (ir + r < mc && p + t < kc) ?
+                                                   NE10_GEMM_AT (a, lda, trans, i0 + ir + r, p0 + p + t) : 0;
+            }
+        }
+    }
+}
+
+/*
+ * Packs rows [p0, p0 + kc) and columns [j0, j0 + nc) of op(B) into panels of
+ * NR columns; each step of a panel holds KU consecutive rows of every column,
+ * and the last panel and the last step are zero-padded.
+ */
+static void ne10_gemm_s8_pack_b (ne10_int8_t * dst, ne10_int8_t * b, ne10_uint32_t ldb, ne10_matrix_trans_t trans,
+                                 ne10_uint32_t p0, ne10_uint32_t j0, ne10_uint32_t kc, ne10_uint32_t nc)
+{
+    ne10_uint32_t jr, p, j, t;
+
+    for (jr = 0; jr < nc; jr += NE10_GEMM_S8_NR)
+    {
+        for (p = 0; p < kc; p += NE10_GEMM_S8_KU, dst += NE10_GEMM_S8_NR * NE10_GEMM_S8_KU)
+        {
+            if (trans == NE10_NO_TRANS && jr + NE10_GEMM_S8_NR <= nc && p + NE10_GEMM_S8_KU <= kc)
+            {
+                /* transpose the 4 x 8 block: interleave bytes of row pairs, then halfwords of the pairs */
+                ne10_int8_t * row = b + (p0 + p) * ldb + j0 + jr;
+                int8x8x2_t r01 = vzip_s8 (vld1_s8 (row), vld1_s8 (row + ldb));
+                int8x8x2_t r23 = vzip_s8 (vld1_s8 (row + 2 * ldb), vld1_s8 (row + 3 * ldb));
+                int16x4x2_t lo = vzip_s16 (vreinterpret_s16_s8 (r01.val[0]), vreinterpret_s16_s8 (r23.val[0]));
+                int16x4x2_t hi = vzip_s16 (vreinterpret_s16_s8 (r01.val[1]), vreinterpret_s16_s8 (r23.val[1]));
+
+                vst1_s8 (dst, vreinterpret_s8_s16 (lo.val[0]));
+                vst1_s8 (dst + 8, vreinterpret_s8_s16 (lo.val[1]));
+                vst1_s8 (dst + 16, vreinterpret_s8_s16 (hi.val[0]));
+                vst1_s8 (dst + 24, vreinterpret_s8_s16 (hi.val[1]));
+                continue;
+            }
+            for (j = 0; j < NE10_GEMM_S8_NR; j++)
+            {
+                if (trans == NE10_TRANS && jr + j < nc && p + NE10_GEMM_S8_KU <= kc)
+                {
+                    memcpy (dst + j * NE10_GEMM_S8_KU, b + (j0 + jr + j) * ldb + p0 + p, NE10_GEMM_S8_KU);
+                    continue;
+                }
+                for (t = 0; t < NE10_GEMM_S8_KU; t++)
+                    dst[j * NE10_GEMM_S8_KU + t] = (jr + j < nc && p + t < kc) ?
+                                                   NE10_GEMM_AT (b, ldb, trans, p0 + p + t, j0 + jr + j) : 0;
+            }
+        }
+    }
+}
+
+/* stores (or adds) one row of four results */
+static inline void ne10_gemm_s8_update_neon (ne10_int32_t * c, int32x4_t acc, ne10_int32_t accumulate)
+{
+    if (accumulate)
+        acc = vaddq_s32 (acc, vld1q_s32 (c));
+    vst1q_s32 (c, acc);
+}
+
+/* one row of four results from the pairwise sums of columns 0-1 and 2-3 */
+static inline int32x4_t ne10_gemm_s8_reduce_neon (int32x4_t c01, int32x4_t c23)
+{
+    return vcombine_s32 (vpadd_s32 (vget_low_s32 (c01), vget_high_s32 (c01)),
+                         vpadd_s32 (vget_low_s32 (c23), vget_high_s32 (c23)));
+}
+
+/*
+ * MR x 4 half of the micro-kernel. VMULL multiplies a row (four k, repeated)
+ * by two columns (four k each) and VPADAL folds the int16 products into int32
+ * pairs, so every accumulator holds two partial sums per column.
+ */
+static void ne10_gemm_s8_kernel4_neon (ne10_uint32_t ks, ne10_int8_t * ap, ne10_int8_t * bp,
+                                       ne10_int32_t * c, ne10_uint32_t ldc, ne10_int32_t accumulate)
+{
+    int32x4_t c001 = vdupq_n_s32 (0), c023 = vdupq_n_s32 (0);
+    int32x4_t c101 = vdupq_n_s32 (0), c123 = vdupq_n_s32 (0);
+    int32x4_t c201 = vdupq_n_s32 (0), c223 = vdupq_n_s32 (0);
+    int32x4_t c301 = vdupq_n_s32 (0), c323 = vdupq_n_s32 (0);
+    ne10_uint32_t s;
+
+    for (s = 0; s < ks; s++, ap += NE10_GEMM_S8_MR * NE10_GEMM_S8_KU, bp += NE10_GEMM_S8_NR * NE10_GEMM_S8_KU)
+    {
+        int8x16_t a = vld1q_s8 (ap);
+        int8x16_t b = vld1q_s8 (bp);
+        int32x2_t a01 = vreinterpret_s32_s8 (vget_low_s8 (a));
+        int32x2_t a23 = vreinterpret_s32_s8 (vget_high_s8 (a));
+        int8x8_t b01 = vget_low_s8 (b);
+        int8x8_t b23 = vget_high_s8 (b);
+        int8x8_t a0 = vreinterpret_s8_s32 (vdup_lane_s32 (a01, 0));
+        int8x8_t a1 = vreinterpret_s8_s32 (vdup_lane_s32 (a01, 1));
+        int8x8_t a2 = vreinterpret_s8_s32 (vdup_lane_s32 (a23, 0));
+        int8x8_t a3 = vreinterpret_s8_s32 (vdup_lane_s32 (a23, 1));
+
+        c001 = vpadalq_s16 (c001, vmull_s8 (a0, b01));
+        c023 = vpadalq_s16 (c023, vmull_s8 (a0, b23));
+        c101 = vpadalq_s16 (c101, vmull_s8 (a1, b01));
+        c123 = vpadalq_s16 (c123, vmull_s8 (a1, b23));
+        c201 = vpadalq_s16 (c201, vmull_s8 (a2, b01));
+        c223 = vpadalq_s16 (c223, vmull_s8 (a2, b23));
+        c301 = vpadalq_s16 (c301, vmull_s8 (a3, b01));
+        c323 = vpadalq_s16 (c323, vmull_s8 (a3, b23));
+    }
+
+    ne10_gemm_s8_update_neon (c, ne10_gemm_s8_reduce_neon (c001, c023), accumulate);
+    ne10_gemm_s8_update_neon (c + ldc, ne10_gemm_s8_reduce_neon (c101, c123), accumulate);
+    ne10_gemm_s8_update_neon (c + 2 * ldc, ne10_gemm_s8_reduce_neon (c201, c223), accumulate);
+    ne10_gemm_s8_update_neon (c + 3 * ldc, ne10_gemm_s8_reduce_neon (c301, c323), accumulate);
+}
+
+/* the two MR x 4 halves keep the sixteen accumulators of a 4 x 8 tile out of the register file */
+static void ne10_gemm_s8_kernel_neon (ne10_uint32_t ks, ne10_int8_t * ap, ne10_int8_t * bp,
+                                      ne10_int32_t * c, ne10_uint32_t ldc, ne10_int32_t accumulate)
+{
+    ne10_gemm_s8_kernel4_neon (ks, ap, bp, c, ldc, accumulate);
+    ne10_gemm_s8_kernel4_neon (ks, ap, bp + 4 * NE10_GEMM_S8_KU, c + 4, ldc, accumulate);
+}
+
+#ifdef __aarch64__
+/* SDOT takes a whole packed step per lane: the dot product of four k of a row of Ap with four columns of Bp */
+NE10_TARGET_DOTPROD
+static void ne10_gemm_s8_kernel_dotprod (ne10_uint32_t ks, ne10_int8_t * ap, ne10_int8_t * bp,
+                                         ne10_int32_t * c, ne10_uint32_t ldc, ne10_int32_t accumulate)
+{
+    int32x4_t c00 = vdupq_n_s32 (0), c01 = vdupq_n_s32 (0);
+    int32x4_t c10 = vdupq_n_s32 (0), c11 = vdupq_n_s32 (0);
+    int32x4_t c20 = vdupq_n_s32 (0), c21 = vdupq_n_s32 (0);
+    int32x4_t c30 = vdupq_n_s32 (0), c31 = vdupq_n_s32 (0);
+    ne10_uint32_t s;
+
+    for (s = 0; s < ks; s++, ap += NE10_GEMM_S8_MR * NE10_GEMM_S8_KU, bp += NE10_GEMM_S8_NR * NE10_GEMM_S8_KU)
+    {
+        int8x16_t a = vld1q_s8 (ap);
+        int8x16_t b0 = vld1q_s8 (bp);
+        int8x16_t b1 = vld1q_s8 (bp + 16);
+
+        c00 = vdotq_laneq_s32 (c00, b0, a, 0);
+        c01 = vdotq_laneq_s32 (c01, b1, a, 0);
+        c10 = vdotq_laneq_s32 (c10, b0, a, 1);
+        c11 = vdotq_laneq_s32 (c11, b1, a, 1);
+        c20 = vdotq_laneq_s32 (c20, b0, a, 2);
+        c21 = vdotq_laneq_s32 (c21, b1, a, 2);
+        c30 = vdotq_laneq_s32 (c30, b0, a, 3);
+        c31 = vdotq_laneq_s32 (c31, b1, a, 3);
+    }
+
+    ne10_gemm_s8_update_neon (c, c00, accumulate);
+    ne10_gemm_s8_update_neon (c + 4, c01, accumulate);
+    ne10_gemm_s8_update_neon (c + ldc, c10, accumulate);
+    ne10_gemm_s8_update_neon (c + ldc + 4, c11, accumulate);
+    ne10_gemm_s8_update_neon (c + 2 * ldc, c20, accumulate);
+    ne10_gemm_s8_update_neon (c + 2 * ldc + 4, c21, accumulate);
+    ne10_gemm_s8_update_neon (c + 3 * ldc, c30, accumulate);
+    ne10_gemm_s8_update_neon (c + 3 * ldc + 4, c31, accumulate);
+}
+#endif
+
+/* the packed blocks of one (jc, pc, ic) iteration, with partial tiles going through a buffer */
+static void ne10_gemm_s8_macro_kernel (ne10_gemm_s8_kernel_t kernel, ne10_uint32_t mc, ne10_uint32_t nc, ne10_uint32_t ks,
+                                       ne10_int8_t * pack_a, ne10_int8_t * pack_b, ne10_int32_t accumulate,
+                                       ne10_int32_t * c, ne10_uint32_t ldc)
+{
+    ne10_int32_t tile[NE10_GEMM_S8_MR * NE10_GEMM_S8_NR];
+    ne10_uint32_t ir, jr, r, j, mr, nr;
+
+    for (jr = 0; jr < nc; jr += NE10_GEMM_S8_NR)
+    {
+        nr = NE10_MIN (NE10_GEMM_S8_NR, nc - jr);
+        for (ir = 0; ir < mc; ir += NE10_GEMM_S8_MR)
+        {
+            ne10_int32_t * cp = c + ir * ldc + jr;
+
+            mr = NE10_MIN (NE10_GEMM_S8_MR, mc - ir);
+            if (mr == NE10_GEMM_S8_MR && nr == NE10_GEMM_S8_NR)
+            {
+                kernel (ks, pack_a + ir * ks * NE10_GEMM_S8_KU, pack_b + jr * ks * NE10_GEMM_S8_KU, cp, ldc, accumulate);
+                continue;
+            }
+
+            kernel (ks, pack_a + ir * ks * NE10_GEMM_S8_KU, pack_b + jr * ks * NE10_GEMM_S8_KU, tile, NE10_GEMM_S8_NR, 0);
+            for (r = 0; r < mr; r++)
+            {
+                for (j = 0; j < nr; j++)
+                    cp[r * ldc + j] = accumulate ? cp[r * ldc + j] + tile[r * NE10_GEMM_S8_NR + j] : tile[r * NE10_GEMM_S8_NR + j];
+            }
+        }
+    }
+}
+
+/* the blocked product shared by the VMULL and SDOT versions, which only differ in the micro-kernel */
+static ne10_result_t ne10_gemm_s8s8s32_blocked (ne10_gemm_s8_kernel_t kernel,
+                                                ne10_matrix_layout_t layout,
+                                                ne10_matrix_trans_t trans_a,
+                                                ne10_matrix_trans_t trans_b,
+                                                ne10_uint32_t m,
+                                                ne10_uint32_t n,
+                                                ne10_uint32_t k,
+                                                ne10_int8_t * a,
+                                                ne10_uint32_t lda,
+                                                ne10_int8_t * b,
+                                                ne10_uint32_t ldb,
+                                                ne10_int32_t * c,
+                                                ne10_uint32_t ldc)
+{
+    ne10_int8_t * pack_a;
+    ne10_int8_t * pack_b;
+    ne10_uint32_t ic, jc, pc, mc, nc, kc;
+
+    /* a column-major product is the row-major product of the transposes, C^T = op(B)^T * op(A)^T */
+    if (layout == NE10_COL_MAJOR)
+        return ne10_gemm_s8s8s32_blocked (kernel, NE10_ROW_MAJOR, trans_b, trans_a, n, m, k, b, ldb, a, lda, c, ldc);
+
+    if (lda < ( (trans_a == NE10_NO_TRANS) ? k : m) || ldb < ( (trans_b == NE10_NO_TRANS) ? n : k) || ldc < n)
+        return NE10_ERR;
+
+    if (k == 0)
+    {
+        for (ic = 0; ic < m; ic++)
+            memset (c + ic * ldc, 0, n * sizeof (ne10_int32_t));
+        return NE10_OK;
+    }
+
+    pack_a = (ne10_int8_t*) NE10_MALLOC (NE10_GEMM_S8_MC * NE10_GEMM_S8_KC);
+    pack_b = (ne10_int8_t*) NE10_MALLOC (NE10_GEMM_S8_KC * NE10_GEMM_S8_NC);
+    if (pack_a == NULL || pack_b == NULL)
+    {
+        NE10_FREE (pack_a);
+        NE10_FREE (pack_b);
+        return NE10_ERR;
+    }
+
+    for (jc = 0; jc < n; jc += NE10_GEMM_S8_NC)
+    {
+        nc = NE10_MIN (NE10_GEMM_S8_NC, n - jc);
+        for (pc = 0; pc < k; pc += NE10_GEMM_S8_KC)
+        {
+            kc = NE10_MIN (NE10_GEMM_S8_KC, k - pc);
+            ne10_gemm_s8_pack_b (pack_b, b, ldb, trans_b, pc, jc, kc, nc);
+            for (ic = 0; ic < m; ic += NE10_GEMM_S8_MC)
+            {
+                mc = NE10_MIN (NE10_GEMM_S8_MC, m - ic);
+                ne10_gemm_s8_pack_a (pack_a, a, lda, trans_a, ic, pc, mc, kc);
+                /* the first block of k stores, the later ones accumulate */
+                ne10_gemm_s8_macro_kernel (kernel, mc, nc, (kc + NE10_GEMM_S8_KU - 1) / NE10_GEMM_S8_KU,
+                                           pack_a, pack_b, pc != 0, c + ic * ldc + jc, ldc);
+            }
+        }
+    }
+
+    NE10_FREE (pack_a);
+    NE10_FREE (pack_b);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_gemm_s8s8s32_neon (ne10_matrix_layout_t layout,
+                                      ne10_matrix_trans_t trans_a,
+                                      ne10_matrix_trans_t trans_b,
+                                      ne10_uint32_t m,
+                                      ne10_uint32_t n,
+                                      ne10_uint32_t k,
+                                      ne10_int8_t * a,
+                                      ne10_uint32_t lda,
+                                      ne10_int8_t * b,
+                                      ne10_uint32_t ldb,
+                                      ne10_int32_t * c,
+                                      ne10_uint32_t ldc)
+{
+    return ne10_gemm_s8s8s32_blocked (ne10_gemm_s8_kernel_neon, layout, trans_a, trans_b, m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+#ifdef __aarch64__
+ne10_result_t ne10_gemm_s8s8s32_dotprod (ne10_matrix_layout_t layout,
+                                         ne10_matrix_trans_t trans_a,
+                                         ne10_matrix_trans_t trans_b,
+                                         ne10_uint32_t m,
+                                         ne10_uint32_t n,
+                                         ne10_uint32_t k,
+                                         ne10_int8_t * a,
+                                         ne10_uint32_t lda,
+                                         ne10_int8_t * b,
+                                         ne10_uint32_t ldb,
+                                         ne10_int32_t * c,
+                                         ne10_uint32_t ldc)
+{
+    return ne10_gemm_s8s8s32_blocked (ne10_gemm_s8_kernel_dotprod, layout, trans_a, trans_b, m, n, k, a, lda, b, ldb, c, ldc);
+}
+#endif
+
+/* eight channels of ne10_requantize_s32s8; the C version spells out the same steps */
+static inline int8x8_t ne10_requantize8_neon (int32x4_t x0, int32x4_t x1, int32x4_t bias0, int32x4_t bias1,
+                                              ne10_int32_t * multiplier, ne10_int32_t * shift, int32x4_t zero_point)
+{
+    x0 = vqrdmulhq_s32 (vqaddq_s32 (x0, bias0), vld1q_s32 (multiplier));
+    x1 = vqrdmulhq_s32 (vqaddq_s32 (x1, bias1), vld1q_s32 (multiplier + 4));
+    /* a negative VRSHL count is a rounding right shift */
+    x0 = vqaddq_s32 (vrshlq_s32 (x0, vnegq_s32 (vld1q_s32 (shift))), zero_point);
+    x1 = vqaddq_s32 (vrshlq_s32 (x1, vnegq_s32 (vld1q_s32 (shift + 4))), zero_point);
+    return vqmovn_s16 (vcombine_s16 (vqmovn_s32 (x0), vqmovn_s32 (x1)));
+}
+
+ne10_result_t ne10_requantize_s32s8_neon (ne10_int8_t * dst,
+                                          ne10_uint32_t ldd,
+                                          ne10_int32_t * src,
+                                          ne10_uint32_t lds,
+                                          ne10_uint32_t m,
+                                          ne10_uint32_t n,
+                                          ne10_int32_t * bias,
+                                          ne10_int32_t * multiplier,
+                                          ne10_int32_t * shift,
+                                          ne10_int8_t zero_point)
+{
+    int32x4_t zp = vdupq_n_s32 (zero_point);
+    ne10_uint32_t i, j, n8 = n & ~7u;
+    /* channel parameters of the last partial group of eight, padded */
+    ne10_int32_t bias_t[8] = { 0 }, mult_t[8] = { 0 }, shift_t[8] = { 0 };
+
+    if (ldd < n || lds < n)
+        return NE10_ERR;
+    for (j = 0; j < n; j++)
+    {
+        if (shift[j] < 0 || shift[j] > 31)
+            return NE10_ERR;
+    }
+    for (j = n8; j < n; j++)
+    {
+        bias_t[j - n8] = (bias != NULL) ? bias[j] : 0;
+        mult_t[j - n8] = multiplier[j];
+        shift_t[j - n8] = shift[j];
+    }
+
+    for (i = 0; i < m; i++)
+    {
+        ne10_int32_t * s = src + i * lds;
+        ne10_int8_t * d = dst + i * ldd;
+
+        for (j = 0; j < n8; j += 8)
+        {
+            int32x4_t b0 = (bias != NULL) ? vld1q_s32 (bias + j) : vdupq_n_s32 (0);
+            int32x4_t b1 = (bias != NULL) ? vld1q_s32 (bias + j + 4) : vdupq_n_s32 (0);
+
+            vst1_s8 (d + j, ne10_requantize8_neon (vld1q_s32 (s + j), vld1q_s32 (s + j + 4), b0, b1,
+                                                   multiplier + j, shift + j, zp));
+        }
+        if (j < n)
+        {
+            ne10_int32_t src_t[8] = { 0 };
+            ne10_int8_t dst_t[8];
+
+            memcpy (src_t, s + j, (n - j) * sizeof (ne10_int32_t));
+            vst1_s8 (dst_t, ne10_requantize8_neon (vld1q_s32 (src_t), vld1q_s32 (src_t + 4), vld1q_s32 (bias_t),
+                                                   vld1q_s32 (bias_t + 4), mult_t, shift_t, zp));
+            memcpy (d + j, dst_t, n - j);
+        }
+    }
+    return NE10_OK;
+}
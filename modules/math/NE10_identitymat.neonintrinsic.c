@@ -0,0 +1,77 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_identitymat.neonintrinsic.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_mat.neonintrinsic.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+ne10_result_t ne10_identitymat_2x2f_neon (ne10_mat2x2f_t * dst, ne10_uint32_t count)
+{
+    float32x4_t one = { 1.0f, 0.0f, 0.0f, 1.0f };
+
+    for (; count > 0; count--, dst++)
+    {
+        vst1q_f32 (ne10_mat_float (dst), one);
+    }
+    return NE10_OK;
+}
+
+/* a 3x3 identity is 1 0 0 0 | 1 0 0 0 | 1 in memory */
+ne10_result_t ne10_identitymat_3x3f_neon (ne10_mat3x3f_t * dst, ne10_uint32_t count)
+{
+    float32x4_t one = { 1.0f, 0.0f, 0.0f, 0.0f };
+
+    for (; count > 0; count--, dst++)
+    {
+        vst1q_f32 (ne10_mat_float (dst), one);
+        vst1q_f32 (ne10_mat_float (dst) + 4, one);
+        vst1q_lane_f32 (ne10_mat_float (dst) + 8, one, 0);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_identitymat_4x4f_neon (ne10_mat4x4f_t * dst, ne10_uint32_t count)
+{
+    float32x4_t zero = vdupq_n_f32 (0.0f);
+
+    for (; count > 0; count--, dst++)
+    {
+        vst1q_f32 (ne10_mat_float (dst), vsetq_lane_f32 (1.0f, zero, 0));
+        vst1q_f32 (ne10_mat_float (dst) + 4, vsetq_lane_f32 (1.0f, zero, 1));
+        vst1q_f32 (ne10_mat_float (dst) + 8, vsetq_lane_f32 (1.0f, zero, 2));
+        vst1q_f32 (ne10_mat_float (dst) + 12, vsetq_lane_f32 (1.0f, zero, 3));
+    }
+    return NE10_OK;
+}
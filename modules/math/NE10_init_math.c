@@ -28,6 +28,7 @@
 #include <stdio.h>
 
 #include "NE10_math.h"
+#include "NE10_init.h"
 
 ne10_result_t ne10_init_math (int is_NEON_available)
 {
@@ -121,6 +122,183 @@ ne10_result_t ne10_init_math (int is_NEON_available)
         ne10_identitymat_3x3f = ne10_identitymat_3x3f_neon;
         ne10_transmat_2x2f = ne10_transmat_2x2f_neon;
         ne10_identitymat_2x2f = ne10_identitymat_2x2f_neon;
+
+        ne10_cpx_mul_float = ne10_cpx_mul_float_neon;
+        ne10_cpx_conj_mul_float = ne10_cpx_conj_mul_float_neon;
+        ne10_cpx_mul_acc_float = ne10_cpx_mul_acc_float_neon;
+        ne10_cpx_mag_float = ne10_cpx_mag_float_neon;
+        ne10_cpx_mag_sqr_float = ne10_cpx_mag_sqr_float_neon;
+        ne10_cpx_phase_float = ne10_cpx_phase_float_neon;
+        ne10_cpx_to_polar_float = ne10_cpx_to_polar_float_neon;
+        ne10_cpx_from_polar_float = ne10_cpx_from_polar_float_neon;
+        ne10_cpx_mul_int32 = ne10_cpx_mul_int32_neon;
+        ne10_cpx_conj_mul_int32 = ne10_cpx_conj_mul_int32_neon;
+        ne10_cpx_mul_acc_int32 = ne10_cpx_mul_acc_int32_neon;
+        ne10_cpx_mag_int32 = ne10_cpx_mag_int32_neon;
+        ne10_cpx_mag_sqr_int32 = ne10_cpx_mag_sqr_int32_neon;
+        ne10_cpx_mul_int16 = ne10_cpx_mul_int16_neon;
+        ne10_cpx_conj_mul_int16 = ne10_cpx_conj_mul_int16_neon;
+        ne10_cpx_mul_acc_int16 = ne10_cpx_mul_acc_int16_neon;
+        ne10_cpx_mag_int16 = ne10_cpx_mag_int16_neon;
+        ne10_cpx_mag_sqr_int16 = ne10_cpx_mag_sqr_int16_neon;
+
+        ne10_exp_float = ne10_exp_float_neon;
+        ne10_exp_fast_float = ne10_exp_fast_float_neon;
+        ne10_log_float = ne10_log_float_neon;
+        ne10_log_fast_float = ne10_log_fast_float_neon;
+        ne10_pow_float = ne10_pow_float_neon;
+        ne10_sin_float = ne10_sin_float_neon;
+        ne10_cos_float = ne10_cos_float_neon;
+        ne10_sincos_float = ne10_sincos_float_neon;
+        ne10_tanh_float = ne10_tanh_float_neon;
+        ne10_sqrt_float = ne10_sqrt_float_neon;
+        ne10_rsqrt_float = ne10_rsqrt_float_neon;
+        ne10_rsqrt_fast_float = ne10_rsqrt_fast_float_neon;
+
+        ne10_sum_float = ne10_sum_float_neon;
+        ne10_minmax_float = ne10_minmax_float_neon;
+        ne10_argmin_float = ne10_argmin_float_neon;
+        ne10_argmax_float = ne10_argmax_float_neon;
+        ne10_mean_var_float = ne10_mean_var_float_neon;
+        ne10_rms_float = ne10_rms_float_neon;
+        ne10_norm_l1_float = ne10_norm_l1_float_neon;
+        ne10_norm_l2_float = ne10_norm_l2_float_neon;
+        ne10_norm_linf_float = ne10_norm_linf_float_neon;
+        ne10_sum_int32 = ne10_sum_int32_neon;
+        ne10_minmax_int32 = ne10_minmax_int32_neon;
+        ne10_argmin_int32 = ne10_argmin_int32_neon;
+        ne10_argmax_int32 = ne10_argmax_int32_neon;
+        ne10_norm_l1_int32 = ne10_norm_l1_int32_neon;
+        ne10_norm_linf_int32 = ne10_norm_linf_int32_neon;
+        ne10_sum_int16 = ne10_sum_int16_neon;
+        ne10_minmax_int16 = ne10_minmax_int16_neon;
+        ne10_argmin_int16 = ne10_argmin_int16_neon;
+        ne10_argmax_int16 = ne10_argmax_int16_neon;
+        ne10_norm_l1_int16 = ne10_norm_l1_int16_neon;
+        ne10_norm_linf_int16 = ne10_norm_linf_int16_neon;
+
+        ne10_gemm_f32 = ne10_gemm_f32_neon;
+        ne10_gemv_f32 = ne10_gemv_f32_neon;
+
+        ne10_dot_s8 = ne10_dot_s8_neon;
+        ne10_gemm_s8s8s32 = ne10_gemm_s8s8s32_neon;
+        ne10_requantize_s32s8 = ne10_requantize_s32s8_neon;
+#if defined (__aarch64__)
+        /* the ARMv8.2 dot product extension is optional, so its kernels are picked at run time */
+        if (ne10_HasDotProd() == NE10_OK)
+        {
+            ne10_dot_s8 = ne10_dot_s8_dotprod;
+            ne10_gemm_s8s8s32 = ne10_gemm_s8s8s32_dotprod;
+        }
+#endif
+
+        ne10_add_vec2f_soa = ne10_add_vec2f_soa_neon;
+        ne10_add_vec3f_soa = ne10_add_vec3f_soa_neon;
+        ne10_add_vec4f_soa = ne10_add_vec4f_soa_neon;
+        ne10_sub_vec2f_soa = ne10_sub_vec2f_soa_neon;
+        ne10_sub_vec3f_soa = ne10_sub_vec3f_soa_neon;
+        ne10_sub_vec4f_soa = ne10_sub_vec4f_soa_neon;
+        ne10_vmul_vec2f_soa = ne10_vmul_vec2f_soa_neon;
+        ne10_vmul_vec3f_soa = ne10_vmul_vec3f_soa_neon;
+        ne10_vmul_vec4f_soa = ne10_vmul_vec4f_soa_neon;
+        ne10_dot_vec2f_soa = ne10_dot_vec2f_soa_neon;
+        ne10_dot_vec3f_soa = ne10_dot_vec3f_soa_neon;
+        ne10_dot_vec4f_soa = ne10_dot_vec4f_soa_neon;
+        ne10_cross_vec3f_soa = ne10_cross_vec3f_soa_neon;
+        ne10_len_vec2f_soa = ne10_len_vec2f_soa_neon;
+        ne10_len_vec3f_soa = ne10_len_vec3f_soa_neon;
+        ne10_len_vec4f_soa = ne10_len_vec4f_soa_neon;
+        ne10_normalize_vec2f_soa = ne10_normalize_vec2f_soa_neon;
+        ne10_normalize_vec3f_soa = ne10_normalize_vec3f_soa_neon;
+        ne10_normalize_vec4f_soa = ne10_normalize_vec4f_soa_neon;
+        ne10_vec2f_aos_to_soa = ne10_vec2f_aos_to_soa_neon;
+        ne10_vec2f_soa_to_aos = ne10_vec2f_soa_to_aos_neon;
+        ne10_vec3f_aos_to_soa = ne10_vec3f_aos_to_soa_neon;
+        ne10_vec3f_soa_to_aos = ne10_vec3f_soa_to_aos_neon;
+        ne10_vec4f_aos_to_soa = ne10_vec4f_aos_to_soa_neon;
+        ne10_vec4f_soa_to_aos = ne10_vec4f_soa_to_aos_neon;
+
+        ne10_mat4x4f_aos_to_x4 = ne10_mat4x4f_aos_to_x4_neon;
+        ne10_mat4x4f_x4_to_aos = ne10_mat4x4f_x4_to_aos_neon;
+        ne10_mulmat_4x4f_x4 = ne10_mulmat_4x4f_x4_neon;
+        ne10_invmat_4x4f_x4 = ne10_invmat_4x4f_x4_neon;
+        ne10_detmat_4x4f_x4 = ne10_detmat_4x4f_x4_neon;
+        ne10_transmat_4x4f_x4 = ne10_transmat_4x4f_x4_neon;
+        ne10_mulmatvec_4x4f_v4f_x4 = ne10_mulmatvec_4x4f_v4f_x4_neon;
+        ne10_mat3x3f_aos_to_x4 = ne10_mat3x3f_aos_to_x4_neon;
+        ne10_mat3x3f_x4_to_aos = ne10_mat3x3f_x4_to_aos_neon;
+        ne10_mulmat_3x3f_x4 = ne10_mulmat_3x3f_x4_neon;
+        ne10_invmat_3x3f_x4 = ne10_invmat_3x3f_x4_neon;
+        ne10_detmat_3x3f_x4 = ne10_detmat_3x3f_x4_neon;
+        ne10_transmat_3x3f_x4 = ne10_transmat_3x3f_x4_neon;
+        ne10_mulmatvec_3x3f_v3f_x4 = ne10_mulmatvec_3x3f_v3f_x4_neon;
+        ne10_mat2x2f_aos_to_x4 = ne10_mat2x2f_aos_to_x4_neon;
+        ne10_mat2x2f_x4_to_aos = ne10_mat2x2f_x4_to_aos_neon;
+        ne10_mulmat_2x2f_x4 = ne10_mulmat_2x2f_x4_neon;
+        ne10_invmat_2x2f_x4 = ne10_invmat_2x2f_x4_neon;
+        ne10_detmat_2x2f_x4 = ne10_detmat_2x2f_x4_neon;
+        ne10_transmat_2x2f_x4 = ne10_transmat_2x2f_x4_neon;
+        ne10_mulmatvec_2x2f_v2f_x4 = ne10_mulmatvec_2x2f_v2f_x4_neon;
+
+        ne10_mul_quatf = ne10_mul_quatf_neon;
+        ne10_conj_quatf = ne10_conj_quatf_neon;
+        ne10_normalize_quatf = ne10_normalize_quatf_neon;
+        ne10_rotate_quatf_vec3f = ne10_rotate_quatf_vec3f_neon;
+        ne10_nlerp_quatf = ne10_nlerp_quatf_neon;
+        ne10_slerp_quatf = ne10_slerp_quatf_neon;
+        ne10_quatf_to_mat3x3f = ne10_quatf_to_mat3x3f_neon;
+        ne10_mat3x3f_to_quatf = ne10_mat3x3f_to_quatf_neon;
+        ne10_mul_dualquatf = ne10_mul_dualquatf_neon;
+        ne10_transform_dualquatf_vec3f = ne10_transform_dualquatf_vec3f_neon;
+        ne10_mul_quatf_soa = ne10_mul_quatf_soa_neon;
+        ne10_conj_quatf_soa = ne10_conj_quatf_soa_neon;
+        ne10_normalize_quatf_soa = ne10_normalize_quatf_soa_neon;
+        ne10_rotate_quatf_vec3f_soa = ne10_rotate_quatf_vec3f_soa_neon;
+        ne10_nlerp_quatf_soa = ne10_nlerp_quatf_soa_neon;
+        ne10_slerp_quatf_soa = ne10_slerp_quatf_soa_neon;
+
+        ne10_cholesky_f32 = ne10_cholesky_f32_neon;
+        ne10_cholesky_solve_f32 = ne10_cholesky_solve_f32_neon;
+        ne10_lu_f32 = ne10_lu_f32_neon;
+        ne10_lu_solve_f32 = ne10_lu_solve_f32_neon;
+        ne10_qr_f32 = ne10_qr_f32_neon;
+        ne10_svd_3x3f = ne10_svd_3x3f_neon;
+
+        ne10_mat_add_f32 = ne10_mat_add_f32_neon;
+        ne10_mat_sub_f32 = ne10_mat_sub_f32_neon;
+        ne10_mat_mul_elem_f32 = ne10_mat_mul_elem_f32_neon;
+        ne10_mat_scale_f32 = ne10_mat_scale_f32_neon;
+        ne10_mat_transpose_f32 = ne10_mat_transpose_f32_neon;
+        ne10_mat_mul_f32 = ne10_mat_mul_f32_neon;
+        ne10_mat_mulvec_f32 = ne10_mat_mulvec_f32_neon;
+
+        ne10_axpby_float = ne10_axpby_float_neon;
+        ne10_mulcaddc_float = ne10_mulcaddc_float_neon;
+        ne10_clamp_float = ne10_clamp_float_neon;
+        ne10_lerp_float = ne10_lerp_float_neon;
+        ne10_sqdiff_acc_float = ne10_sqdiff_acc_float_neon;
+        ne10_scale_float_s16 = ne10_scale_float_s16_neon;
+
+        ne10_convert_float_q15 = ne10_convert_float_q15_neon;
+        ne10_convert_q15_float = ne10_convert_q15_float_neon;
+        ne10_convert_float_q31 = ne10_convert_float_q31_neon;
+        ne10_convert_q31_float = ne10_convert_q31_float_neon;
+        ne10_convert_float_u8 = ne10_convert_float_u8_neon;
+        ne10_convert_u8_float = ne10_convert_u8_float_neon;
+        ne10_convert_float_f16 = ne10_convert_float_f16_neon;
+        ne10_convert_f16_float = ne10_convert_f16_float_neon;
+        ne10_convert_int16_int32 = ne10_convert_int16_int32_neon;
+        ne10_convert_int32_int16 = ne10_convert_int32_int16_neon;
+
+        ne10_addc_float_aligned = ne10_addc_float_aligned_neon;
+        ne10_subc_float_aligned = ne10_subc_float_aligned_neon;
+        ne10_mulc_float_aligned = ne10_mulc_float_aligned_neon;
+        ne10_mlac_float_aligned = ne10_mlac_float_aligned_neon;
+        ne10_setc_float_aligned = ne10_setc_float_aligned_neon;
+        ne10_add_float_aligned = ne10_add_float_aligned_neon;
+        ne10_sub_float_aligned = ne10_sub_float_aligned_neon;
+        ne10_mul_float_aligned = ne10_mul_float_aligned_neon;
+        ne10_mla_float_aligned = ne10_mla_float_aligned_neon;
     }
     else
     {
@@ -212,6 +390,175 @@ ne10_result_t ne10_init_math (int is_NEON_available)
         ne10_identitymat_3x3f = ne10_identitymat_3x3f_c;
         ne10_transmat_2x2f = ne10_transmat_2x2f_c;
         ne10_identitymat_2x2f = ne10_identitymat_2x2f_c;
+
+        ne10_cpx_mul_float = ne10_cpx_mul_float_c;
+        ne10_cpx_conj_mul_float = ne10_cpx_conj_mul_float_c;
+        ne10_cpx_mul_acc_float = ne10_cpx_mul_acc_float_c;
+        ne10_cpx_mag_float = ne10_cpx_mag_float_c;
+        ne10_cpx_mag_sqr_float = ne10_cpx_mag_sqr_float_c;
+        ne10_cpx_phase_float = ne10_cpx_phase_float_c;
+        ne10_cpx_to_polar_float = ne10_cpx_to_polar_float_c;
+        ne10_cpx_from_polar_float = ne10_cpx_from_polar_float_c;
+        ne10_cpx_mul_int32 = ne10_cpx_mul_int32_c;
+        ne10_cpx_conj_mul_int32 = ne10_cpx_conj_mul_int32_c;
+        ne10_cpx_mul_acc_int32 = ne10_cpx_mul_acc_int32_c;
+        ne10_cpx_mag_int32 = ne10_cpx_mag_int32_c;
+        ne10_cpx_mag_sqr_int32 = ne10_cpx_mag_sqr_int32_c;
+        ne10_cpx_mul_int16 = ne10_cpx_mul_int16_c;
+        ne10_cpx_conj_mul_int16 = ne10_cpx_conj_mul_int16_c;
+        ne10_cpx_mul_acc_int16 = ne10_cpx_mul_acc_int16_c;
+        ne10_cpx_mag_int16 = ne10_cpx_mag_int16_c;
+        ne10_cpx_mag_sqr_int16 = ne10_cpx_mag_sqr_int16_c;
+
+        ne10_exp_float = ne10_exp_float_c;
+        ne10_exp_fast_float = ne10_exp_fast_float_c;
+        ne10_log_float = ne10_log_float_c;
+        ne10_log_fast_float = ne10_log_fast_float_c;
+        ne10_pow_float = ne10_pow_float_c;
+        ne10_sin_float = ne10_sin_float_c;
+        ne10_cos_float = ne10_cos_float_c;
+        ne10_sincos_float = ne10_sincos_float_c;
+        ne10_tanh_float = ne10_tanh_float_c;
+        ne10_sqrt_float = ne10_sqrt_float_c;
+        ne10_rsqrt_float = ne10_rsqrt_float_c;
+        ne10_rsqrt_fast_float = ne10_rsqrt_fast_float_c;
+
+        ne10_sum_float = ne10_sum_float_c;
+        ne10_minmax_float = ne10_minmax_float_c;
+        ne10_argmin_float = ne10_argmin_float_c;
+        ne10_argmax_float = ne10_argmax_float_c;
+        ne10_mean_var_float = ne10_mean_var_float_c;
+        ne10_rms_float = ne10_rms_float_c;
+        ne10_norm_l1_float = ne10_norm_l1_float_c;
+        ne10_norm_l2_float = ne10_norm_l2_float_c;
+        ne10_norm_linf_float = ne10_norm_linf_float_c;
+        ne10_sum_int32 = ne10_sum_int32_c;
+        ne10_minmax_int32 = ne10_minmax_int32_c;
+        ne10_argmin_int32 = ne10_argmin_int32_c;
+        ne10_argmax_int32 = ne10_argmax_int32_c;
+        ne10_norm_l1_int32 = ne10_norm_l1_int32_c;
+        ne10_norm_linf_int32 = ne10_norm_linf_int32_c;
+        ne10_sum_int16 = ne10_sum_int16_c;
+        ne10_minmax_int16 = ne10_minmax_int16_c;
+        ne10_argmin_int16 = ne10_argmin_int16_c;
+        ne10_argmax_int16 = ne10_argmax_int16_c;
+        ne10_norm_l1_int16 = ne10_norm_l1_int16_c;
+        ne10_norm_linf_int16 = ne10_norm_linf_int16_c;
+
+        ne10_gemm_f32 = ne10_gemm_f32_c;
+        ne10_gemv_f32 = ne10_gemv_f32_c;
+
+        ne10_dot_s8 = ne10_dot_s8_c;
+        ne10_gemm_s8s8s32 = ne10_gemm_s8s8s32_c;
+        ne10_requantize_s32s8 = ne10_requantize_s32s8_c;
+
+        ne10_add_vec2f_soa = ne10_add_vec2f_soa_c;
+        ne10_add_vec3f_soa = ne10_add_vec3f_soa_c;
+        ne10_add_vec4f_soa = ne10_add_vec4f_soa_c;
+        ne10_sub_vec2f_soa = ne10_sub_vec2f_soa_c;
+        ne10_sub_vec3f_soa = ne10_sub_vec3f_soa_c;
+        ne10_sub_vec4f_soa = ne10_sub_vec4f_soa_c;
+        ne10_vmul_vec2f_soa = ne10_vmul_vec2f_soa_c;
+        ne10_vmul_vec3f_soa = ne10_vmul_vec3f_soa_c;
+        ne10_vmul_vec4f_soa = ne10_vmul_vec4f_soa_c;
+        ne10_dot_vec2f_soa = ne10_dot_vec2f_soa_c;
+        ne10_dot_vec3f_soa = ne10_dot_vec3f_soa_c;
+        ne10_dot_vec4f_soa = ne10_dot_vec4f_soa_c;
+        ne10_cross_vec3f_soa = ne10_cross_vec3f_soa_c;
+        ne10_len_vec2f_soa = ne10_len_vec2f_soa_c;
+        ne10_len_vec3f_soa = ne10_len_vec3f_soa_c;
+        ne10_len_vec4f_soa = ne10_len_vec4f_soa_c;
+        ne10_normalize_vec2f_soa = ne10_normalize_vec2f_soa_c;
+        ne10_normalize_vec3f_soa = ne10_normalize_vec3f_soa_c;
+        ne10_normalize_vec4f_soa = ne10_normalize_vec4f_soa_c;
+        ne10_vec2f_aos_to_soa = ne10_vec2f_aos_to_soa_c;
+        ne10_vec2f_soa_to_aos = ne10_vec2f_soa_to_aos_c;
+        ne10_vec3f_aos_to_soa = ne10_vec3f_aos_to_soa_c;
+        ne10_vec3f_soa_to_aos = ne10_vec3f_soa_to_aos_c;
+        ne10_vec4f_aos_to_soa = ne10_vec4f_aos_to_soa_c;
+        ne10_vec4f_soa_to_aos = ne10_vec4f_soa_to_aos_c;
+
+        ne10_mat4x4f_aos_to_x4 = ne10_mat4x4f_aos_to_x4_c;
+        ne10_mat4x4f_x4_to_aos = ne10_mat4x4f_x4_to_aos_c;
+        ne10_mulmat_4x4f_x4 = ne10_mulmat_4x4f_x4_c;
+        ne10_invmat_4x4f_x4 = ne10_invmat_4x4f_x4_c;
+        ne10_detmat_4x4f_x4 = ne10_detmat_4x4f_x4_c;
+        ne10_transmat_4x4f_x4 = ne10_transmat_4x4f_x4_c;
+        ne10_mulmatvec_4x4f_v4f_x4 = ne10_mulmatvec_4x4f_v4f_x4_c;
+        ne10_mat3x3f_aos_to_x4 = ne10_mat3x3f_aos_to_x4_c;
+        ne10_mat3x3f_x4_to_aos = ne10_mat3x3f_x4_to_aos_c;
+        ne10_mulmat_3x3f_x4 = ne10_mulmat_3x3f_x4_c;
+        ne10_invmat_3x3f_x4 = ne10_invmat_3x3f_x4_c;
+        ne10_detmat_3x3f_x4 = ne10_detmat_3x3f_x4_c;
+        ne10_transmat_3x3f_x4 = ne10_transmat_3x3f_x4_c;
+        ne10_mulmatvec_3x3f_v3f_x4 = ne10_mulmatvec_3x3f_v3f_x4_c;
+        ne10_mat2x2f_aos_to_x4 = ne10_mat2x2f_aos_to_x4_c;
+        ne10_mat2x2f_x4_to_aos = ne10_mat2x2f_x4_to_aos_c;
+        ne10_mulmat_2x2f_x4 = ne10_mulmat_2x2f_x4_c;
+        ne10_invmat_2x2f_x4 = ne10_invmat_2x2f_x4_c;
+        ne10_detmat_2x2f_x4 = ne10_detmat_2x2f_x4_c;
+        ne10_transmat_2x2f_x4 = ne10_transmat_2x2f_x4_c;
+        ne10_mulmatvec_2x2f_v2f_x4 = ne10_mulmatvec_2x2f_v2f_x4_c;
+
+        ne10_mul_quatf = ne10_mul_quatf_c;
+        ne10_conj_quatf = ne10_conj_quatf_c;
+        ne10_normalize_quatf = ne10_normalize_quatf_c;
+        ne10_rotate_quatf_vec3f = ne10_rotate_quatf_vec3f_c;
+        ne10_nlerp_quatf = ne10_nlerp_quatf_c;
+        ne10_slerp_quatf = ne10_slerp_quatf_c;
+        ne10_quatf_to_mat3x3f = ne10_quatf_to_mat3x3f_c;
+        ne10_mat3x3f_to_quatf = ne10_mat3x3f_to_quatf_c;
+        ne10_mul_dualquatf = ne10_mul_dualquatf_c;
+        ne10_transform_dualquatf_vec3f = ne10_transform_dualquatf_vec3f_c;
+        ne10_mul_quatf_soa = ne10_mul_quatf_soa_c;
+        ne10_conj_quatf_soa = ne10_conj_quatf_soa_c;
+        ne10_normalize_quatf_soa = ne10_normalize_quatf_soa_c;
+        ne10_rotate_quatf_vec3f_soa = ne10_rotate_quatf_vec3f_soa_c;
+        ne10_nlerp_quatf_soa = ne10_nlerp_quatf_soa_c;
+        ne10_slerp_quatf_soa = ne10_slerp_quatf_soa_c;
+
+        ne10_cholesky_f32 = ne10_cholesky_f32_c;
+        ne10_cholesky_solve_f32 = ne10_cholesky_solve_f32_c;
+        ne10_lu_f32 = ne10_lu_f32_c;
+        ne10_lu_solve_f32 = ne10_lu_solve_f32_c;
+        ne10_qr_f32 = ne10_qr_f32_c;
+        ne10_svd_3x3f = ne10_svd_3x3f_c;
+
+        ne10_mat_add_f32 = ne10_mat_add_f32_c;
+        ne10_mat_sub_f32 = ne10_mat_sub_f32_c;
+        ne10_mat_mul_elem_f32 = ne10_mat_mul_elem_f32_c;
+        ne10_mat_scale_f32 = ne10_mat_scale_f32_c;
+        ne10_mat_transpose_f32 = ne10_mat_transpose_f32_c;
+        ne10_mat_mul_f32 = ne10_mat_mul_f32_c;
+        ne10_mat_mulvec_f32 = ne10_mat_mulvec_f32_c;
+
+        ne10_axpby_float = ne10_axpby_float_c;
+        ne10_mulcaddc_float = ne10_mulcaddc_float_c;
+        ne10_clamp_float = ne10_clamp_float_c;
+        ne10_lerp_float = ne10_lerp_float_c;
+        ne10_sqdiff_acc_float = ne10_sqdiff_acc_float_c;
+        ne10_scale_float_s16 = ne10_scale_float_s16_c;
+
+        ne10_convert_float_q15 = ne10_convert_float_q15_c;
+        ne10_convert_q15_float = ne10_convert_q15_float_c;
+        ne10_convert_float_q31 = ne10_convert_float_q31_c;
+        ne10_convert_q31_float = ne10_convert_q31_float_c;
+        ne10_convert_float_u8 = ne10_convert_float_u8_c;
+        ne10_convert_u8_float = ne10_convert_u8_float_c;
+        ne10_convert_float_f16 = ne10_convert_float_f16_c;
+        ne10_convert_f16_float = ne10_convert_f16_float_c;
+        ne10_convert_int16_int32 = ne10_convert_int16_int32_c;
+        ne10_convert_int32_int16 = ne10_convert_int32_int16_c;
+
+        ne10_addc_float_aligned = ne10_addc_float_aligned_c;
+        ne10_subc_float_aligned = ne10_subc_float_aligned_c;
+        ne10_mulc_float_aligned = ne10_mulc_float_aligned_c;
+        ne10_mlac_float_aligned = ne10_mlac_float_aligned_c;
+        ne10_setc_float_aligned = ne10_setc_float_aligned_c;
+        ne10_add_float_aligned = ne10_add_float_aligned_c;
+        ne10_sub_float_aligned = ne10_sub_float_aligned_c;
+        ne10_mul_float_aligned = ne10_mul_float_aligned_c;
+        ne10_mla_float_aligned = ne10_mla_float_aligned_c;
     }
     return NE10_OK;
 }
@@ -305,3 +652,172 @@ ne10_result_t (*ne10_transmat_3x3f) (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src,
 ne10_result_t (*ne10_identitymat_3x3f) (ne10_mat3x3f_t * dst, ne10_uint32_t count);
 ne10_result_t (*ne10_transmat_2x2f) (ne10_mat2x2f_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count);
 ne10_result_t (*ne10_identitymat_2x2f) (ne10_mat2x2f_t * dst, ne10_uint32_t count);
+
+ne10_result_t (*ne10_cpx_mul_float) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_conj_mul_float) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_mul_acc_float) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_mag_float) (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_mag_sqr_float) (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_phase_float) (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_to_polar_float) (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_from_polar_float) (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_mul_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_conj_mul_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_mul_acc_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * acc, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_mag_int32) (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_mag_sqr_int32) (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_mul_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_conj_mul_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_mul_acc_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * acc, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_mag_int16) (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cpx_mag_sqr_int16) (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count);
+
+ne10_result_t (*ne10_exp_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_exp_fast_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_log_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_log_fast_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_pow_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_sin_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cos_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_sincos_float) (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_tanh_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_sqrt_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_rsqrt_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_rsqrt_fast_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+
+ne10_result_t (*ne10_sum_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_minmax_float) (ne10_float32_t * min, ne10_float32_t * max, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_argmin_float) (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_argmax_float) (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mean_var_float) (ne10_float32_t * mean, ne10_float32_t * var, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_rms_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_norm_l1_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_norm_l2_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_norm_linf_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_sum_int32) (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_minmax_int32) (ne10_int32_t * min, ne10_int32_t * max, ne10_int32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_argmin_int32) (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_argmax_int32) (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_norm_l1_int32) (ne10_uint64_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_norm_linf_int32) (ne10_uint32_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_sum_int16) (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_minmax_int16) (ne10_int16_t * min, ne10_int16_t * max, ne10_int16_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_argmin_int16) (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_argmax_int16) (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_norm_l1_int16) (ne10_uint64_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_norm_linf_int16) (ne10_uint32_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+
+ne10_result_t (*ne10_gemm_f32) (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans_a, ne10_matrix_trans_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_float32_t alpha, ne10_float32_t * a, ne10_uint32_t lda, ne10_float32_t * b, ne10_uint32_t ldb, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc);
+ne10_result_t (*ne10_gemv_f32) (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans, ne10_uint32_t m, ne10_uint32_t n, ne10_float32_t alpha, ne10_float32_t * a, ne10_uint32_t lda, ne10_float32_t * x, ne10_float32_t beta, ne10_float32_t * y);
+
+ne10_result_t (*ne10_dot_s8) (ne10_int32_t * dst, ne10_int8_t * src1, ne10_int8_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_gemm_s8s8s32) (ne10_matrix_layout_t layout, ne10_matrix_trans_t trans_a, ne10_matrix_trans_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_int8_t * a, ne10_uint32_t lda, ne10_int8_t * b, ne10_uint32_t ldb, ne10_int32_t * c, ne10_uint32_t ldc);
+ne10_result_t (*ne10_requantize_s32s8) (ne10_int8_t * dst, ne10_uint32_t ldd, ne10_int32_t * src, ne10_uint32_t lds, ne10_uint32_t m, ne10_uint32_t n, ne10_int32_t * bias, ne10_int32_t * multiplier, ne10_int32_t * shift, ne10_int8_t zero_point);
+
+ne10_result_t (*ne10_add_vec2f_soa) (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_add_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_add_vec4f_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_sub_vec2f_soa) (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_sub_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_sub_vec4f_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_vmul_vec2f_soa) (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_vmul_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_vmul_vec4f_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_dot_vec2f_soa) (ne10_float32_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_dot_vec3f_soa) (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_dot_vec4f_soa) (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cross_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_len_vec2f_soa) (ne10_float32_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_len_vec3f_soa) (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_len_vec4f_soa) (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_normalize_vec2f_soa) (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_normalize_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_normalize_vec4f_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_vec2f_aos_to_soa) (ne10_vec2f_soa_t * dst, ne10_vec2f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_vec2f_soa_to_aos) (ne10_vec2f_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_vec3f_aos_to_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_vec3f_soa_to_aos) (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_vec4f_aos_to_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_vec4f_soa_to_aos) (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+
+ne10_result_t (*ne10_mat4x4f_aos_to_x4) (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mat4x4f_x4_to_aos) (ne10_mat4x4f_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mulmat_4x4f_x4) (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src1, ne10_mat4x4f_x4_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_invmat_4x4f_x4) (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_detmat_4x4f_x4) (ne10_float32_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_transmat_4x4f_x4) (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mulmatvec_4x4f_v4f_x4) (ne10_vec4f_t * dst, ne10_mat4x4f_x4_t * mat, ne10_vec4f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mat3x3f_aos_to_x4) (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mat3x3f_x4_to_aos) (ne10_mat3x3f_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mulmat_3x3f_x4) (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src1, ne10_mat3x3f_x4_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_invmat_3x3f_x4) (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_detmat_3x3f_x4) (ne10_float32_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_transmat_3x3f_x4) (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mulmatvec_3x3f_v3f_x4) (ne10_vec3f_t * dst, ne10_mat3x3f_x4_t * mat, ne10_vec3f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mat2x2f_aos_to_x4) (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mat2x2f_x4_to_aos) (ne10_mat2x2f_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mulmat_2x2f_x4) (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src1, ne10_mat2x2f_x4_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_invmat_2x2f_x4) (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_detmat_2x2f_x4) (ne10_float32_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_transmat_2x2f_x4) (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mulmatvec_2x2f_v2f_x4) (ne10_vec2f_t * dst, ne10_mat2x2f_x4_t * mat, ne10_vec2f_t * src, ne10_uint32_t count);
+
+ne10_result_t (*ne10_mul_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_conj_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_normalize_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_rotate_quatf_vec3f) (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_nlerp_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t t, ne10_uint32_t count);
+ne10_result_t (*ne10_slerp_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t t, ne10_uint32_t count);
+ne10_result_t (*ne10_quatf_to_mat3x3f) (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mat3x3f_to_quatf) (ne10_quatf_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mul_dualquatf) (ne10_dualquatf_t * dst, ne10_dualquatf_t * src1, ne10_dualquatf_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_transform_dualquatf_vec3f) (ne10_vec3f_t * dst, ne10_dualquatf_t * dq, ne10_vec3f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mul_quatf_soa) (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_conj_quatf_soa) (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_normalize_quatf_soa) (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_rotate_quatf_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_quatf_soa_t * quat, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_nlerp_quatf_soa) (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_float32_t t, ne10_uint32_t count);
+ne10_result_t (*ne10_slerp_quatf_soa) (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_float32_t t, ne10_uint32_t count);
+
+ne10_result_t (*ne10_cholesky_f32) (ne10_float32_t * dst, ne10_int32_t * status, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+ne10_result_t (*ne10_cholesky_solve_f32) (ne10_float32_t * dst, ne10_float32_t * chol, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+ne10_result_t (*ne10_lu_f32) (ne10_float32_t * dst, ne10_uint8_t * piv, ne10_int32_t * status, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+ne10_result_t (*ne10_lu_solve_f32) (ne10_float32_t * dst, ne10_float32_t * lu, ne10_uint8_t * piv, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+ne10_result_t (*ne10_qr_f32) (ne10_float32_t * q, ne10_float32_t * r, ne10_float32_t * src, ne10_uint32_t n, ne10_uint32_t count);
+ne10_result_t (*ne10_svd_3x3f) (ne10_mat3x3f_t * u, ne10_vec3f_t * s, ne10_mat3x3f_t * v, ne10_mat3x3f_t * src, ne10_uint32_t count);
+
+ne10_result_t (*ne10_mat_add_f32) (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2);
+ne10_result_t (*ne10_mat_sub_f32) (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2);
+ne10_result_t (*ne10_mat_mul_elem_f32) (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2);
+ne10_result_t (*ne10_mat_scale_f32) (ne10_mat_f32_t * dst, ne10_mat_f32_t * src, ne10_float32_t scale);
+ne10_result_t (*ne10_mat_transpose_f32) (ne10_mat_f32_t * dst, ne10_mat_f32_t * src);
+ne10_result_t (*ne10_mat_mul_f32) (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2);
+ne10_result_t (*ne10_mat_mulvec_f32) (ne10_float32_t * dst, ne10_mat_f32_t * mat, ne10_float32_t * src);
+
+ne10_result_t (*ne10_axpby_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, const ne10_float32_t a, const ne10_float32_t b, ne10_uint32_t count);
+ne10_result_t (*ne10_mulcaddc_float) (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t scale, const ne10_float32_t offset, ne10_uint32_t count);
+ne10_result_t (*ne10_clamp_float) (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t lo, const ne10_float32_t hi, ne10_uint32_t count);
+ne10_result_t (*ne10_lerp_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, const ne10_float32_t t, ne10_uint32_t count);
+ne10_result_t (*ne10_sqdiff_acc_float) (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_scale_float_s16) (ne10_int16_t * dst, ne10_float32_t * src, const ne10_float32_t scale, ne10_uint32_t count);
+
+ne10_result_t (*ne10_convert_float_q15) (ne10_int16_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count);
+ne10_result_t (*ne10_convert_q15_float) (ne10_float32_t * dst, ne10_int16_t * src, ne10_float32_t scale, ne10_uint32_t count);
+ne10_result_t (*ne10_convert_float_q31) (ne10_int32_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count);
+ne10_result_t (*ne10_convert_q31_float) (ne10_float32_t * dst, ne10_int32_t * src, ne10_float32_t scale, ne10_uint32_t count);
+ne10_result_t (*ne10_convert_float_u8) (ne10_uint8_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_round_mode_t mode, ne10_uint32_t count);
+ne10_result_t (*ne10_convert_u8_float) (ne10_float32_t * dst, ne10_uint8_t * src, ne10_float32_t scale, ne10_uint32_t count);
+ne10_result_t (*ne10_convert_float_f16) (ne10_float16_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_convert_f16_float) (ne10_float32_t * dst, ne10_float16_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_convert_int16_int32) (ne10_int32_t * dst, ne10_int16_t * src, ne10_uint32_t shift, ne10_uint32_t count);
+ne10_result_t (*ne10_convert_int32_int16) (ne10_int16_t * dst, ne10_int32_t * src, ne10_uint32_t shift, ne10_uint32_t count);
+
+ne10_result_t (*ne10_addc_float_aligned) (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count);
+ne10_result_t (*ne10_subc_float_aligned) (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count);
+ne10_result_t (*ne10_mulc_float_aligned) (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count);
+ne10_result_t (*ne10_mlac_float_aligned) (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count);
+ne10_result_t (*ne10_setc_float_aligned) (ne10_float32_t * dst, const ne10_float32_t cst, ne10_uint32_t count);
+ne10_result_t (*ne10_add_float_aligned) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_sub_float_aligned) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_mul_float_aligned) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_mla_float_aligned) (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
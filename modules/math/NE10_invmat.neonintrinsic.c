@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_invmat.neonintrinsic.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_mat.neonintrinsic.h"
+#include "NE10_transcendental.neon.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+/* The cofactor formulas are shared with the batched versions in NE10_mat.neonintrinsic.h. */
+ne10_result_t ne10_invmat_2x2f_neon (ne10_mat2x2f_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count)
+{
+    float32x4x4_t m, r;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4, src += 4, dst += 4)
+    {
+        m = vld4q_f32 (ne10_mat_float (src));
+        ne10_invmat2x2_x4_neon (r.val, m.val);
+        vst4q_f32 (ne10_mat_float (dst), r);
+    }
+    return ne10_invmat_2x2f_c (dst, src, count);
+}
+
+ne10_result_t ne10_invmat_3x3f_neon (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[9], r[9];
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4, src += 4, dst += 4)
+    {
+        ne10_mat3x3f_load_x4_neon (m, ne10_mat_float (src));
+        ne10_invmat3x3_x4_neon (r, m);
+        ne10_mat3x3f_store_x4_neon (ne10_mat_float (dst), r);
+    }
+    return ne10_invmat_3x3f_c (dst, src, count);
+}
+
+ne10_result_t ne10_invmat_4x4f_neon (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[16], r[16];
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4, src += 4, dst += 4)
+    {
+        ne10_mat4x4f_load_x4_neon (m, ne10_mat_float (src));
+        ne10_invmat4x4_x4_neon (r, m);
+        ne10_mat4x4f_store_x4_neon (ne10_mat_float (dst), r);
+    }
+    return ne10_invmat_4x4f_c (dst, src, count);
+}
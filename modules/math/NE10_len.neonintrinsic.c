@@ -0,0 +1,95 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_len.neonintrinsic.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_transcendental.neon.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+/*
+ * Four vectors per iteration, de-interleaved into one register per component.
+ * The squares are summed in the same order as the C version and the square
+ * root is exact on AArch64, so both versions give the same results there.
+ * Leftover vectors go through the C version.
+ */
+ne10_result_t ne10_len_vec2f_neon (ne10_float32_t * dst, ne10_vec2f_t * src, ne10_uint32_t count)
+{
+    float32x4x2_t n_src;
+    float32x4_t n_sq;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4, src += 4, dst += 4)
+    {
+        n_src = vld2q_f32 ( (ne10_float32_t*) src);
+        n_sq = vmulq_f32 (n_src.val[0], n_src.val[0]);
+        n_sq = vmlaq_f32 (n_sq, n_src.val[1], n_src.val[1]);
+        vst1q_f32 (dst, ne10_sqrt_kernel_neon (n_sq));
+    }
+    return ne10_len_vec2f_c (dst, src, count);
+}
+
+ne10_result_t ne10_len_vec3f_neon (ne10_float32_t * dst, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    float32x4x3_t n_src;
+    float32x4_t n_sq;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4, src += 4, dst += 4)
+    {
+        n_src = vld3q_f32 ( (ne10_float32_t*) src);
+        n_sq = vmulq_f32 (n_src.val[0], n_src.val[0]);
+        n_sq = vmlaq_f32 (n_sq, n_src.val[1], n_src.val[1]);
+        n_sq = vmlaq_f32 (n_sq, n_src.val[2], n_src.val[2]);
+        vst1q_f32 (dst, ne10_sqrt_kernel_neon (n_sq));
+    }
+    return ne10_len_vec3f_c (dst, src, count);
+}
+
+ne10_result_t ne10_len_vec4f_neon (ne10_float32_t * dst, ne10_vec4f_t * src, ne10_uint32_t count)
+{
+    float32x4x4_t n_src;
+    float32x4_t n_sq;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4, src += 4, dst += 4)
+    {
+        n_src = vld4q_f32 ( (ne10_float32_t*) src);
+        n_sq = vmulq_f32 (n_src.val[0], n_src.val[0]);
+        n_sq = vmlaq_f32 (n_sq, n_src.val[1], n_src.val[1]);
+        n_sq = vmlaq_f32 (n_sq, n_src.val[2], n_src.val[2]);
+        n_sq = vmlaq_f32 (n_sq, n_src.val[3], n_src.val[3]);
+        vst1q_f32 (dst, ne10_sqrt_kernel_neon (n_sq));
+    }
+    return ne10_len_vec4f_c (dst, src, count);
+}
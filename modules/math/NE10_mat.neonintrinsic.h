@@ -0,0 +1,266 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_mat.neonintrinsic.h
+ */
+
+/*
+ * Helpers shared by the NEON intrinsic versions of the matrix functions.
+ * Four matrices are handled at a time in a "one register per entry" layout:
+ * m[e] holds entry e (in the column-major order of the matrix structs) of
+ * each of the four matrices, so the C formulas apply lane-wise unchanged.
+ */
+
+#ifndef __NE10_MAT_NEONINTRINSIC_H__
+#define __NE10_MAT_NEONINTRINSIC_H__
+
+#include "NE10_types.h"
+#include "NE10_transcendental.neon.h"
+
+#include <arm_neon.h>
+
+/*
+ * The matrix structs are packed, so their entries are reached through void *
+ * rather than by casting the matrix pointer, which -Waddress-of-packed-member
+ * reports. The matrices are float arrays in memory either way.
+ */
+static inline ne10_float32_t * ne10_mat_float (void * mat)
+{
+    return (ne10_float32_t *) mat;
+}
+
+static inline void ne10_transpose4x4_neon (float32x4_t * r)
+{
+    float32x4x2_t t01 = vtrnq_f32 (r[0], r[1]);
+    float32x4x2_t t23 = vtrnq_f32 (r[2], r[3]);
+
+    r[0] = vcombine_f32 (vget_low_f32 (t01.val[0]), vget_low_f32 (t23.val[0]));
+    r[1] = vcombine_f32 (vget_low_f32 (t01.val[1]), vget_low_f32 (t23.val[1]));
+    r[2] = vcombine_f32 (vget_high_f32 (t01.val[0]), vget_high_f32 (t23.val[0]));
+    r[3] = vcombine_f32 (vget_high_f32 (t01.val[1]), vget_high_f32 (t23.val[1]));
+}
+
+/* src and dst point to four consecutive 3x3 matrices (36 floats) */
+static inline void ne10_mat3x3f_load_x4_neon (float32x4_t * m, const ne10_float32_t * src)
+{
+    float32x4_t last = vdupq_n_f32 (0.0f);
+
+    m[0] = vld1q_f32 (src);
+    m[1] = vld1q_f32 (src + 9);
+    m[2] = vld1q_f32 (src + 18);
+    m[3] = vld1q_f32 (src + 27);
+    m[4] = vld1q_f32 (src + 4);
+    m[5] = vld1q_f32 (src + 13);
+    m[6] = vld1q_f32 (src + 22);
+    m[7] = vld1q_f32 (src + 31);
+    last = vld1q_lane_f32 (src + 8, last, 0);
+    last = vld1q_lane_f32 (src + 17, last, 1);
+    last = vld1q_lane_f32 (src + 26, last, 2);
+    last = vld1q_lane_f32 (src + 35, last, 3);
+    ne10_transpose4x4_neon (m);
+    ne10_transpose4x4_neon (m + 4);
+    m[8] = last;
+}
+
+static inline void ne10_mat3x3f_store_x4_neon (ne10_float32_t * dst, const float32x4_t * m)
+{
+    float32x4_t r[8];
+    ne10_int32_t i;
+
+    for (i = 0; i < 8; i++)
+        r[i] = m[i];
+    ne10_transpose4x4_neon (r);
+    ne10_transpose4x4_neon (r + 4);
+    vst1q_f32 (dst, r[0]);
+    vst1q_f32 (dst + 4, r[4]);
+    vst1q_lane_f32 (dst + 8, m[8], 0);
+    vst1q_f32 (dst + 9, r[1]);
+    vst1q_f32 (dst + 13, r[5]);
+    vst1q_lane_f32 (dst + 17, m[8], 1);
+    vst1q_f32 (dst + 18, r[2]);
+    vst1q_f32 (dst + 22, r[6]);
+    vst1q_lane_f32 (dst + 26, m[8], 2);
+    vst1q_f32 (dst + 27, r[3]);
+    vst1q_f32 (dst + 31, r[7]);
+    vst1q_lane_f32 (dst + 35, m[8], 3);
+}
+
+/* src and dst point to four consecutive 4x4 matrices (64 floats) */
+static inline void ne10_mat4x4f_load_x4_neon (float32x4_t * m, const ne10_float32_t * src)
+{
+    ne10_int32_t c;
+
+    for (c = 0; c < 4; c++)
+    {
+        m[4 * c] = vld1q_f32 (src + 4 * c);
+        m[4 * c + 1] = vld1q_f32 (src + 16 + 4 * c);
+        m[4 * c + 2] = vld1q_f32 (src + 32 + 4 * c);
+        m[4 * c + 3] = vld1q_f32 (src + 48 + 4 * c);
+        ne10_transpose4x4_neon (m + 4 * c);
+    }
+}
+
+static inline void ne10_mat4x4f_store_x4_neon (ne10_float32_t * dst, const float32x4_t * m)
+{
+    float32x4_t r[4];
+    ne10_int32_t c;
+
+    for (c = 0; c < 4; c++)
+    {
+        r[0] = m[4 * c];
+        r[1] = m[4 * c + 1];
+        r[2] = m[4 * c + 2];
+        r[3] = m[4 * c + 3];
+        ne10_transpose4x4_neon (r);
+        vst1q_f32 (dst + 4 * c, r[0]);
+        vst1q_f32 (dst + 16 + 4 * c, r[1]);
+        vst1q_f32 (dst + 32 + 4 * c, r[2]);
+        vst1q_f32 (dst + 48 + 4 * c, r[3]);
+    }
+}
+
+/*
+ * Determinants with the entries in column-major order, evaluated in the same
+ * order as DET2x2/DET3x3/DET4x4 in NE10_detmat.c.h.
+ */
+static inline float32x4_t ne10_det2x2_neon (float32x4_t a, float32x4_t b, float32x4_t c, float32x4_t d)
+{
+    return vmlsq_f32 (vmulq_f32 (a, d), c, b);
+}
+
+static inline float32x4_t ne10_det3x3_neon (float32x4_t a, float32x4_t b, float32x4_t c,
+        float32x4_t d, float32x4_t e, float32x4_t f,
+        float32x4_t g, float32x4_t h, float32x4_t i)
+{
+    float32x4_t det = vmulq_f32 (a, ne10_det2x2_neon (e, f, h, i));
+    det = vmlsq_f32 (det, d, ne10_det2x2_neon (b, c, h, i));
+    return vmlaq_f32 (det, g, ne10_det2x2_neon (b, c, e, f));
+}
+
+static inline float32x4_t ne10_det4x4_neon (const float32x4_t * m)
+{
+    float32x4_t det = vmulq_f32 (m[0], ne10_det3x3_neon (m[5], m[6], m[7], m[9], m[10], m[11], m[13], m[14], m[15]));
+    det = vmlsq_f32 (det, m[4], ne10_det3x3_neon (m[1], m[2], m[3], m[9], m[10], m[11], m[13], m[14], m[15]));
+    det = vmlaq_f32 (det, m[8], ne10_det3x3_neon (m[1], m[2], m[3], m[5], m[6], m[7], m[13], m[14], m[15]));
+    return vmlsq_f32 (det, m[12], ne10_det3x3_neon (m[1], m[2], m[3], m[5], m[6], m[7], m[9], m[10], m[11]));
+}
+
+/*
+ * r = a * b for n x n matrices: column j of r is the sum over k of column k
+ * of a scaled by b[j][k], added in increasing k as in the C version. r must
+ * not overlap a or b.
+ */
+static inline void ne10_mulmat_x4_neon (float32x4_t * r, const float32x4_t * a, const float32x4_t * b, ne10_int32_t n)
+{
+    ne10_int32_t i, j, k;
+
+    for (j = 0; j < n; j++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            r[j * n + i] = vmulq_f32 (a[i], b[j * n]);
+            for (k = 1; k < n; k++)
+                r[j * n + i] = vmlaq_f32 (r[j * n + i], a[k * n + i], b[j * n + k]);
+        }
+    }
+}
+
+/* r = m * v for an n x n matrix, in the same order as ne10_mulcmatvec */
+static inline void ne10_mulmatvec_x4_neon (float32x4_t * r, const float32x4_t * m, const float32x4_t * v, ne10_int32_t n)
+{
+    ne10_int32_t i, k;
+
+    for (i = 0; i < n; i++)
+    {
+        r[i] = vmulq_f32 (m[i], v[0]);
+        for (k = 1; k < n; k++)
+            r[i] = vmlaq_f32 (r[i], m[k * n + i], v[k]);
+    }
+}
+
+/*
+ * 1 / det, with the same near-zero fallback as the C version. The inverse is
+ * the adjugate (the transposed matrix of cofactors) scaled by 1 / det.
+ */
+static inline float32x4_t ne10_invdet_neon (float32x4_t det)
+{
+    uint32x4_t near_zero = vcltq_f32 (vabsq_f32 (det), vdupq_n_f32 (1e-12f));
+    return ne10_recip_kernel_neon (vbslq_f32 (near_zero, vdupq_n_f32 (1.0f), det));
+}
+
+static inline void ne10_invmat2x2_x4_neon (float32x4_t * r, const float32x4_t * m)
+{
+    float32x4_t det = ne10_invdet_neon (ne10_det2x2_neon (m[0], m[1], m[2], m[3]));
+    float32x4_t neg = vnegq_f32 (det);
+
+    r[0] = vmulq_f32 (det, m[3]);
+    r[1] = vmulq_f32 (neg, m[1]);
+    r[2] = vmulq_f32 (neg, m[2]);
+    r[3] = vmulq_f32 (det, m[0]);
+}
+
+static inline void ne10_invmat3x3_x4_neon (float32x4_t * r, const float32x4_t * m)
+{
+    float32x4_t det = ne10_invdet_neon (ne10_det3x3_neon (m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8]));
+    float32x4_t neg = vnegq_f32 (det);
+
+    r[0] = vmulq_f32 (det, ne10_det2x2_neon (m[4], m[5], m[7], m[8]));
+    r[1] = vmulq_f32 (neg, ne10_det2x2_neon (m[1], m[2], m[7], m[8]));
+    r[2] = vmulq_f32 (det, ne10_det2x2_neon (m[1], m[2], m[4], m[5]));
+    r[3] = vmulq_f32 (neg, ne10_det2x2_neon (m[3], m[5], m[6], m[8]));
+    r[4] = vmulq_f32 (det, ne10_det2x2_neon (m[0], m[2], m[6], m[8]));
+    r[5] = vmulq_f32 (neg, ne10_det2x2_neon (m[0], m[2], m[3], m[5]));
+    r[6] = vmulq_f32 (det, ne10_det2x2_neon (m[3], m[4], m[6], m[7]));
+    r[7] = vmulq_f32 (neg, ne10_det2x2_neon (m[0], m[1], m[6], m[7]));
+    r[8] = vmulq_f32 (det, ne10_det2x2_neon (m[0], m[1], m[3], m[4]));
+}
+
+static inline void ne10_invmat4x4_x4_neon (float32x4_t * r, const float32x4_t * m)
+{
+    float32x4_t det = ne10_invdet_neon (ne10_det4x4_neon (m));
+    float32x4_t neg = vnegq_f32 (det);
+
+    r[0] = vmulq_f32 (det, ne10_det3x3_neon (m[5], m[6], m[7], m[9], m[10], m[11], m[13], m[14], m[15]));
+    r[1] = vmulq_f32 (neg, ne10_det3x3_neon (m[1], m[2], m[3], m[9], m[10], m[11], m[13], m[14], m[15]));
+    r[2] = vmulq_f32 (det, ne10_det3x3_neon (m[1], m[2], m[3], m[5], m[6], m[7], m[13], m[14], m[15]));
+    r[3] = vmulq_f32 (neg, ne10_det3x3_neon (m[1], m[2], m[3], m[5], m[6], m[7], m[9], m[10], m[11]));
+    r[4] = vmulq_f32 (neg, ne10_det3x3_neon (m[4], m[6], m[7], m[8], m[10], m[11], m[12], m[14], m[15]));
+    r[5] = vmulq_f32 (det, ne10_det3x3_neon (m[0], m[2], m[3], m[8], m[10], m[11], m[12], m[14], m[15]));
+    r[6] = vmulq_f32 (neg, ne10_det3x3_neon (m[0], m[2], m[3], m[4], m[6], m[7], m[12], m[14], m[15]));
+    r[7] = vmulq_f32 (det, ne10_det3x3_neon (m[0], m[2], m[3], m[4], m[6], m[7], m[8], m[10], m[11]));
+    r[8] = vmulq_f32 (det, ne10_det3x3_neon (m[4], m[5], m[7], m[8], m[9], m[11], m[12], m[13], m[15]));
+    r[9] = vmulq_f32 (neg, ne10_det3x3_neon (m[0], m[1], m[3], m[8], m[9], m[11], m[12], m[13], m[15]));
+    r[10] = vmulq_f32 (det, ne10_det3x3_neon (m[0], m[1], m[3], m[4], m[5], m[7], m[12], m[13], m[15]));
+    r[11] = vmulq_f32 (neg, ne10_det3x3_neon (m[0], m[1], m[3], m[4], m[5], m[7], m[8], m[9], m[11]));
+    r[12] = vmulq_f32 (neg, ne10_det3x3_neon (m[4], m[5], m[6], m[8], m[9], m[10], m[12], m[13], m[14]));
+    r[13] = vmulq_f32 (det, ne10_det3x3_neon (m[0], m[1], m[2], m[8], m[9], m[10], m[12], m[13], m[14]));
+    r[14] = vmulq_f32 (neg, ne10_det3x3_neon (m[0], m[1], m[2], m[4], m[5], m[6], m[12], m[13], m[14]));
+    r[15] = vmulq_f32 (det, ne10_det3x3_neon (m[0], m[1], m[2], m[4], m[5], m[6], m[8], m[9], m[10]));
+}
+
+#endif // __NE10_MAT_NEONINTRINSIC_H__
@@ -0,0 +1,133 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_mat_f32.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+
+#include <assert.h>
+
+/* element (i, j) of a general matrix */
+#define NE10_MAT_F32_AT(m, i, j) (m)->data[ (i) * (m)->stride + (j)]
+
+static inline ne10_int32_t ne10_mat_f32_fits (const ne10_mat_f32_t * m, ne10_uint32_t rows, ne10_uint32_t cols)
+{
+    return m->rows == rows && m->cols == cols && m->stride >= cols;
+}
+
+ne10_result_t ne10_mat_add_f32_c (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2)
+{
+    assert (dst && src1 && src2);
+    if (!ne10_mat_f32_fits (dst, dst->rows, dst->cols) || !ne10_mat_f32_fits (src1, dst->rows, dst->cols)
+            || !ne10_mat_f32_fits (src2, dst->rows, dst->cols))
+        return NE10_ERR;
+
+    for ( unsigned int i = 0; i < dst->rows; i++ )
+    {
+        for ( unsigned int j = 0; j < dst->cols; j++ )
+            NE10_MAT_F32_AT (dst, i, j) = NE10_MAT_F32_AT (src1, i, j) + NE10_MAT_F32_AT (src2, i, j);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mat_sub_f32_c (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2)
+{
+    assert (dst && src1 && src2);
+    if (!ne10_mat_f32_fits (dst, dst->rows, dst->cols) || !ne10_mat_f32_fits (src1, dst->rows, dst->cols)
+            || !ne10_mat_f32_fits (src2, dst->rows, dst->cols))
+        return NE10_ERR;
+
+    for ( unsigned int i = 0; i < dst->rows; i++ )
+    {
+        for ( unsigned int j = 0; j < dst->cols; j++ )
+            NE10_MAT_F32_AT (dst, i, j) = NE10_MAT_F32_AT (src1, i, j) - NE10_MAT_F32_AT (src2, i, j);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mat_mul_elem_f32_c (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2)
+{
+    assert (dst && src1 && src2);
+    if (!ne10_mat_f32_fits (dst, dst->rows, dst->cols) || !ne10_mat_f32_fits (src1, dst->rows, dst->cols)
+            || !ne10_mat_f32_fits (src2, dst->rows, dst->cols))
+        return NE10_ERR;
+
+    for ( unsigned int i = 0; i < dst->rows; i++ )
+    {
+        for ( unsigned int j = 0; j < dst->cols; j++ )
+            NE10_MAT_F32_AT (dst, i, j) = NE10_MAT_F32_AT (src1, i, j) * NE10_MAT_F32_AT (src2, i, j);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mat_scale_f32_c (ne10_mat_f32_t * dst, ne10_mat_f32_t * src, ne10_float32_t scale)
+{
+    assert (dst && src);
+    if (!ne10_mat_f32_fits (dst, dst->rows, dst->cols) || !ne10_mat_f32_fits (src, dst->rows, dst->cols))
+        return NE10_ERR;
+
+    for ( unsigned int i = 0; i < dst->rows; i++ )
+    {
+        for ( unsigned int j = 0; j < dst->cols; j++ )
+            NE10_MAT_F32_AT (dst, i, j) = NE10_MAT_F32_AT (src, i, j) * scale;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mat_transpose_f32_c (ne10_mat_f32_t * dst, ne10_mat_f32_t * src)
+{
+    assert (dst && src);
+    if (!ne10_mat_f32_fits (dst, dst->rows, dst->cols) || !ne10_mat_f32_fits (src, dst->cols, dst->rows))
+        return NE10_ERR;
+
+    for ( unsigned int i = 0; i < src->rows; i++ )
+    {
+        for ( unsigned int j = 0; j < src->cols; j++ )
+            NE10_MAT_F32_AT (dst, j, i) = NE10_MAT_F32_AT (src, i, j);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mat_mul_f32_c (ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2)
+{
+    assert (dst && src1 && src2);
+    if (src1->cols != src2->rows || dst->rows != src1->rows || dst->cols != src2->cols)
+        return NE10_ERR;
+
+    return ne10_gemm_f32_c (NE10_ROW_MAJOR, NE10_NO_TRANS, NE10_NO_TRANS, dst->rows, dst->cols, src1->cols,
+                            1.0f, src1->data, src1->stride, src2->data, src2->stride, 0.0f, dst->data, dst->stride);
+}
+
+ne10_result_t ne10_mat_mulvec_f32_c (ne10_float32_t * dst, ne10_mat_f32_t * mat, ne10_float32_t * src)
+{
+    assert (dst && mat && src);
+    return ne10_gemv_f32_c (NE10_ROW_MAJOR, NE10_NO_TRANS, mat->rows, mat->cols, 1.0f, mat->data, mat->stride, src, 0.0f, dst);
+}
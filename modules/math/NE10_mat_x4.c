@@ -0,0 +1,384 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_mat_x4.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+
+#include <assert.h>
+
+#define NE10_MAT_X4_BLOCKS(count) ( ( (count) + NE10_MAT_X4_LANES - 1) / NE10_MAT_X4_LANES)
+
+/*
+ * The kernels unpack each block into packed matrices and call the functions
+ * of the same name on those, so both layouts give the same results.
+ */
+
+/*
+ * packed[l] = lane l of the block, for the first lanes lanes. The packed
+ * matrices are passed as void * as the matrix structs are packed.
+ */
+static void ne10_mat_x4_unpack (void * mats, const ne10_float32_t * block, ne10_uint32_t n, ne10_uint32_t lanes)
+{
+    ne10_float32_t * packed = (ne10_float32_t *) mats;
+    ne10_uint32_t e, l;
+
+    for (l = 0; l < lanes; l++)
+        for (e = 0; e < n * n; e++)
+            packed[l * n * n + e] = block[e * NE10_MAT_X4_LANES + l];
+}
+
+/* lane l of the block = packed[l], and the identity matrix for the other lanes */
+static void ne10_mat_x4_pack (ne10_float32_t * block, const void * mats, ne10_uint32_t n, ne10_uint32_t lanes)
+{
+    const ne10_float32_t * packed = (const ne10_float32_t *) mats;
+    ne10_uint32_t e, l;
+
+    for (l = 0; l < NE10_MAT_X4_LANES; l++)
+    {
+        for (e = 0; e < n * n; e++)
+        {
+            if (l < lanes)
+                block[e * NE10_MAT_X4_LANES + l] = packed[l * n * n + e];
+            else
+                block[e * NE10_MAT_X4_LANES + l] = (e / n == e % n) ? 1.0f : 0.0f;
+        }
+    }
+}
+
+ne10_result_t ne10_mat4x4f_aos_to_x4_c (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t lanes;
+
+    assert (dst && src);
+    for (; count > 0; count -= lanes, src += lanes, dst++)
+    {
+        lanes = (count < NE10_MAT_X4_LANES) ? count : NE10_MAT_X4_LANES;
+        ne10_mat_x4_pack (&dst->m[0][0], src, 4, lanes);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mat4x4f_x4_to_aos_c (ne10_mat4x4f_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t lanes;
+
+    assert (dst && src);
+    for (; count > 0; count -= lanes, src++, dst += lanes)
+    {
+        lanes = (count < NE10_MAT_X4_LANES) ? count : NE10_MAT_X4_LANES;
+        ne10_mat_x4_unpack (dst, &src->m[0][0], 4, lanes);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mulmat_4x4f_x4_c (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src1, ne10_mat4x4f_x4_t * src2, ne10_uint32_t count)
+{
+    ne10_mat4x4f_t a[NE10_MAT_X4_LANES], b[NE10_MAT_X4_LANES], r[NE10_MAT_X4_LANES];
+    ne10_uint32_t blk;
+
+    assert (dst && src1 && src2);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_unpack (a, &src1[blk].m[0][0], 4, NE10_MAT_X4_LANES);
+        ne10_mat_x4_unpack (b, &src2[blk].m[0][0], 4, NE10_MAT_X4_LANES);
+        ne10_mulmat_4x4f_c (r, a, b, NE10_MAT_X4_LANES);
+        ne10_mat_x4_pack (&dst[blk].m[0][0], r, 4, NE10_MAT_X4_LANES);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_invmat_4x4f_x4_c (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count)
+{
+    ne10_mat4x4f_t m[NE10_MAT_X4_LANES], r[NE10_MAT_X4_LANES];
+    ne10_uint32_t blk;
+
+    assert (dst && src);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_unpack (m, &src[blk].m[0][0], 4, NE10_MAT_X4_LANES);
+        ne10_invmat_4x4f_c (r, m, NE10_MAT_X4_LANES);
+        ne10_mat_x4_pack (&dst[blk].m[0][0], r, 4, NE10_MAT_X4_LANES);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_detmat_4x4f_x4_c (ne10_float32_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count)
+{
+    ne10_mat4x4f_t m[NE10_MAT_X4_LANES];
+    ne10_uint32_t lanes;
+
+    assert (dst && src);
+    for (; count > 0; count -= lanes, src++, dst += lanes)
+    {
+        lanes = (count < NE10_MAT_X4_LANES) ? count : NE10_MAT_X4_LANES;
+        ne10_mat_x4_unpack (m, &src->m[0][0], 4, lanes);
+        ne10_detmat_4x4f_c (dst, m, lanes);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_transmat_4x4f_x4_c (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count)
+{
+    ne10_mat4x4f_t m[NE10_MAT_X4_LANES], r[NE10_MAT_X4_LANES];
+    ne10_uint32_t blk;
+
+    assert (dst && src);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_unpack (m, &src[blk].m[0][0], 4, NE10_MAT_X4_LANES);
+        ne10_transmat_4x4f_c (r, m, NE10_MAT_X4_LANES);
+        ne10_mat_x4_pack (&dst[blk].m[0][0], r, 4, NE10_MAT_X4_LANES);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mulmatvec_4x4f_v4f_x4_c (ne10_vec4f_t * dst, ne10_mat4x4f_x4_t * mat, ne10_vec4f_t * src, ne10_uint32_t count)
+{
+    ne10_mat4x4f_t m[NE10_MAT_X4_LANES];
+    ne10_uint32_t lanes, l;
+
+    assert (dst && mat && src);
+    for (; count > 0; count -= lanes, mat++, src += lanes, dst += lanes)
+    {
+        lanes = (count < NE10_MAT_X4_LANES) ? count : NE10_MAT_X4_LANES;
+        ne10_mat_x4_unpack (m, &mat->m[0][0], 4, lanes);
+        for (l = 0; l < lanes; l++)
+            ne10_mulcmatvec_cm4x4f_v4f_c (&dst[l], &m[l], &src[l], 1);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mat3x3f_aos_to_x4_c (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t lanes;
+
+    assert (dst && src);
+    for (; count > 0; count -= lanes, src += lanes, dst++)
+    {
+        lanes = (count < NE10_MAT_X4_LANES) ? count : NE10_MAT_X4_LANES;
+        ne10_mat_x4_pack (&dst->m[0][0], src, 3, lanes);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mat3x3f_x4_to_aos_c (ne10_mat3x3f_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t lanes;
+
+    assert (dst && src);
+    for (; count > 0; count -= lanes, src++, dst += lanes)
+    {
+        lanes = (count < NE10_MAT_X4_LANES) ? count : NE10_MAT_X4_LANES;
+        ne10_mat_x4_unpack (dst, &src->m[0][0], 3, lanes);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mulmat_3x3f_x4_c (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src1, ne10_mat3x3f_x4_t * src2, ne10_uint32_t count)
+{
+    ne10_mat3x3f_t a[NE10_MAT_X4_LANES], b[NE10_MAT_X4_LANES], r[NE10_MAT_X4_LANES];
+    ne10_uint32_t blk;
+
+    assert (dst && src1 && src2);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_unpack (a, &src1[blk].m[0][0], 3, NE10_MAT_X4_LANES);
+        ne10_mat_x4_unpack (b, &src2[blk].m[0][0], 3, NE10_MAT_X4_LANES);
+        ne10_mulmat_3x3f_c (r, a, b, NE10_MAT_X4_LANES);
+        ne10_mat_x4_pack (&dst[blk].m[0][0], r, 3, NE10_MAT_X4_LANES);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_invmat_3x3f_x4_c (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count)
+{
+    ne10_mat3x3f_t m[NE10_MAT_X4_LANES], r[NE10_MAT_X4_LANES];
+    ne10_uint32_t blk;
+
+    assert (dst && src);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_unpack (m, &src[blk].m[0][0], 3, NE10_MAT_X4_LANES);
+        ne10_invmat_3x3f_c (r, m, NE10_MAT_X4_LANES);
+        ne10_mat_x4_pack (&dst[blk].m[0][0], r, 3, NE10_MAT_X4_LANES);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_detmat_3x3f_x4_c (ne10_float32_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count)
+{
+    ne10_mat3x3f_t m[NE10_MAT_X4_LANES];
+    ne10_uint32_t lanes;
+
+    assert (dst && src);
+    for (; count > 0; count -= lanes, src++, dst += lanes)
+    {
+        lanes = (count < NE10_MAT_X4_LANES) ? count : NE10_MAT_X4_LANES;
+        ne10_mat_x4_unpack (m, &src->m[0][0], 3, lanes);
+        ne10_detmat_3x3f_c (dst, m, lanes);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_transmat_3x3f_x4_c (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count)
+{
+    ne10_mat3x3f_t m[NE10_MAT_X4_LANES], r[NE10_MAT_X4_LANES];
+    ne10_uint32_t blk;
+
+    assert (dst && src);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_unpack (m, &src[blk].m[0][0], 3, NE10_MAT_X4_LANES);
+        ne10_transmat_3x3f_c (r, m, NE10_MAT_X4_LANES);
+        ne10_mat_x4_pack (&dst[blk].m[0][0], r, 3, NE10_MAT_X4_LANES);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mulmatvec_3x3f_v3f_x4_c (ne10_vec3f_t * dst, ne10_mat3x3f_x4_t * mat, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    ne10_mat3x3f_t m[NE10_MAT_X4_LANES];
+    ne10_uint32_t lanes, l;
+
+    assert (dst && mat && src);
+    for (; count > 0; count -= lanes, mat++, src += lanes, dst += lanes)
+    {
+        lanes = (count < NE10_MAT_X4_LANES) ? count : NE10_MAT_X4_LANES;
+        ne10_mat_x4_unpack (m, &mat->m[0][0], 3, lanes);
+        for (l = 0; l < lanes; l++)
+            ne10_mulcmatvec_cm3x3f_v3f_c (&dst[l], &m[l], &src[l], 1);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mat2x2f_aos_to_x4_c (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t lanes;
+
+    assert (dst && src);
+    for (; count > 0; count -= lanes, src += lanes, dst++)
+    {
+        lanes = (count < NE10_MAT_X4_LANES) ? count : NE10_MAT_X4_LANES;
+        ne10_mat_x4_pack (&dst->m[0][0], src, 2, lanes);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mat2x2f_x4_to_aos_c (ne10_mat2x2f_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t lanes;
+
+    assert (dst && src);
+    for (; count > 0; count -= lanes, src++, dst += lanes)
+    {
+        lanes = (count < NE10_MAT_X4_LANES) ? count : NE10_MAT_X4_LANES;
+        ne10_mat_x4_unpack (dst, &src->m[0][0], 2, lanes);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mulmat_2x2f_x4_c (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src1, ne10_mat2x2f_x4_t * src2, ne10_uint32_t count)
+{
+    ne10_mat2x2f_t a[NE10_MAT_X4_LANES], b[NE10_MAT_X4_LANES], r[NE10_MAT_X4_LANES];
+    ne10_uint32_t blk;
+
+    assert (dst && src1 && src2);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_unpack (a, &src1[blk].m[0][0], 2, NE10_MAT_X4_LANES);
+        ne10_mat_x4_unpack (b, &src2[blk].m[0][0], 2, NE10_MAT_X4_LANES);
+        ne10_mulmat_2x2f_c (r, a, b, NE10_MAT_X4_LANES);
+        ne10_mat_x4_pack (&dst[blk].m[0][0], r, 2, NE10_MAT_X4_LANES);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_invmat_2x2f_x4_c (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count)
+{
+    ne10_mat2x2f_t m[NE10_MAT_X4_LANES], r[NE10_MAT_X4_LANES];
+    ne10_uint32_t blk;
+
+    assert (dst && src);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_unpack (m, &src[blk].m[0][0], 2, NE10_MAT_X4_LANES);
+        ne10_invmat_2x2f_c (r, m, NE10_MAT_X4_LANES);
+        ne10_mat_x4_pack (&dst[blk].m[0][0], r, 2, NE10_MAT_X4_LANES);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_detmat_2x2f_x4_c (ne10_float32_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count)
+{
+    ne10_mat2x2f_t m[NE10_MAT_X4_LANES];
+    ne10_uint32_t lanes;
+
+    assert (dst && src);
+    for (; count > 0; count -= lanes, src++, dst += lanes)
+    {
+        lanes = (count < NE10_MAT_X4_LANES) ? count : NE10_MAT_X4_LANES;
+        ne10_mat_x4_unpack (m, &src->m[0][0], 2, lanes);
+        ne10_detmat_2x2f_c (dst, m, lanes);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_transmat_2x2f_x4_c (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count)
+{
+    ne10_mat2x2f_t m[NE10_MAT_X4_LANES], r[NE10_MAT_X4_LANES];
+    ne10_uint32_t blk;
+
+    assert (dst && src);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_unpack (m, &src[blk].m[0][0], 2, NE10_MAT_X4_LANES);
+        ne10_transmat_2x2f_c (r, m, NE10_MAT_X4_LANES);
+        ne10_mat_x4_pack (&dst[blk].m[0][0], r, 2, NE10_MAT_X4_LANES);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mulmatvec_2x2f_v2f_x4_c (ne10_vec2f_t * dst, ne10_mat2x2f_x4_t * mat, ne10_vec2f_t * src, ne10_uint32_t count)
+{
+    ne10_mat2x2f_t m[NE10_MAT_X4_LANES];
+    ne10_uint32_t lanes, l;
+
+    assert (dst && mat && src);
+    for (; count > 0; count -= lanes, mat++, src += lanes, dst += lanes)
+    {
+        lanes = (count < NE10_MAT_X4_LANES) ? count : NE10_MAT_X4_LANES;
+        ne10_mat_x4_unpack (m, &mat->m[0][0], 2, lanes);
+        for (l = 0; l < lanes; l++)
+            ne10_mulcmatvec_cm2x2f_v2f_c (&dst[l], &m[l], &src[l], 1);
+    }
+    return NE10_OK;
+}
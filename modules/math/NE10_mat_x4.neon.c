@@ -0,0 +1,377 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_mat_x4.neon.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_mat.neonintrinsic.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+#define NE10_MAT_X4_BLOCKS(count) ( ( (count) + NE10_MAT_X4_LANES - 1) / NE10_MAT_X4_LANES)
+
+/*
+ * A block already holds one register per entry, so the kernels are the
+ * lane-wise formulas of NE10_mat.neonintrinsic.h between plain loads and
+ * stores. Whole blocks are processed; a partial last block of determinants
+ * or vectors goes through the C version.
+ */
+static inline void ne10_mat_x4_load_neon (float32x4_t * m, const ne10_float32_t (*block)[NE10_MAT_X4_LANES], ne10_int32_t entries)
+{
+    ne10_int32_t e;
+
+    for (e = 0; e < entries; e++)
+        m[e] = vld1q_f32 (block[e]);
+}
+
+static inline void ne10_mat_x4_store_neon (ne10_float32_t (*block)[NE10_MAT_X4_LANES], const float32x4_t * m, ne10_int32_t entries)
+{
+    ne10_int32_t e;
+
+    for (e = 0; e < entries; e++)
+        vst1q_f32 (block[e], m[e]);
+}
+
+ne10_result_t ne10_mat4x4f_aos_to_x4_neon (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[16];
+
+    assert (dst && src);
+    for (; count >= NE10_MAT_X4_LANES; count -= NE10_MAT_X4_LANES, src += NE10_MAT_X4_LANES, dst++)
+    {
+        ne10_mat4x4f_load_x4_neon (m, ne10_mat_float (src));
+        ne10_mat_x4_store_neon (dst->m, m, 16);
+    }
+    return ne10_mat4x4f_aos_to_x4_c (dst, src, count);
+}
+
+ne10_result_t ne10_mat4x4f_x4_to_aos_neon (ne10_mat4x4f_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[16];
+
+    assert (dst && src);
+    for (; count >= NE10_MAT_X4_LANES; count -= NE10_MAT_X4_LANES, src++, dst += NE10_MAT_X4_LANES)
+    {
+        ne10_mat_x4_load_neon (m, src->m, 16);
+        ne10_mat4x4f_store_x4_neon (ne10_mat_float (dst), m);
+    }
+    return ne10_mat4x4f_x4_to_aos_c (dst, src, count);
+}
+
+ne10_result_t ne10_mulmat_4x4f_x4_neon (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src1, ne10_mat4x4f_x4_t * src2, ne10_uint32_t count)
+{
+    float32x4_t a[16], b[16], r[16];
+    ne10_uint32_t blk;
+
+    assert (dst && src1 && src2);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_load_neon (a, src1[blk].m, 16);
+        ne10_mat_x4_load_neon (b, src2[blk].m, 16);
+        ne10_mulmat_x4_neon (r, a, b, 4);
+        ne10_mat_x4_store_neon (dst[blk].m, r, 16);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_invmat_4x4f_x4_neon (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[16], r[16];
+    ne10_uint32_t blk;
+
+    assert (dst && src);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_load_neon (m, src[blk].m, 16);
+        ne10_invmat4x4_x4_neon (r, m);
+        ne10_mat_x4_store_neon (dst[blk].m, r, 16);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_detmat_4x4f_x4_neon (ne10_float32_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[16];
+
+    assert (dst && src);
+    for (; count >= NE10_MAT_X4_LANES; count -= NE10_MAT_X4_LANES, src++, dst += NE10_MAT_X4_LANES)
+    {
+        ne10_mat_x4_load_neon (m, src->m, 16);
+        vst1q_f32 (dst, ne10_det4x4_neon (m));
+    }
+    return ne10_detmat_4x4f_x4_c (dst, src, count);
+}
+
+ne10_result_t ne10_transmat_4x4f_x4_neon (ne10_mat4x4f_x4_t * dst, ne10_mat4x4f_x4_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[16], r[16];
+    ne10_uint32_t blk;
+    ne10_int32_t i, j;
+
+    assert (dst && src);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_load_neon (m, src[blk].m, 16);
+        for (j = 0; j < 4; j++)
+            for (i = 0; i < 4; i++)
+                r[j * 4 + i] = m[i * 4 + j];
+        ne10_mat_x4_store_neon (dst[blk].m, r, 16);
+    }
+    return NE10_OK;
+}
+
+/* vld4/vst4 turn four interleaved vectors into one register per component and back */
+ne10_result_t ne10_mulmatvec_4x4f_v4f_x4_neon (ne10_vec4f_t * dst, ne10_mat4x4f_x4_t * mat, ne10_vec4f_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[16];
+    float32x4x4_t v, r;
+
+    assert (dst && mat && src);
+    for (; count >= NE10_MAT_X4_LANES; count -= NE10_MAT_X4_LANES, mat++, src += NE10_MAT_X4_LANES, dst += NE10_MAT_X4_LANES)
+    {
+        ne10_mat_x4_load_neon (m, mat->m, 16);
+        v = vld4q_f32 (ne10_mat_float (src));
+        ne10_mulmatvec_x4_neon (r.val, m, v.val, 4);
+        vst4q_f32 (ne10_mat_float (dst), r);
+    }
+    return ne10_mulmatvec_4x4f_v4f_x4_c (dst, mat, src, count);
+}
+
+ne10_result_t ne10_mat3x3f_aos_to_x4_neon (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[9];
+
+    assert (dst && src);
+    for (; count >= NE10_MAT_X4_LANES; count -= NE10_MAT_X4_LANES, src += NE10_MAT_X4_LANES, dst++)
+    {
+        ne10_mat3x3f_load_x4_neon (m, ne10_mat_float (src));
+        ne10_mat_x4_store_neon (dst->m, m, 9);
+    }
+    return ne10_mat3x3f_aos_to_x4_c (dst, src, count);
+}
+
+ne10_result_t ne10_mat3x3f_x4_to_aos_neon (ne10_mat3x3f_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[9];
+
+    assert (dst && src);
+    for (; count >= NE10_MAT_X4_LANES; count -= NE10_MAT_X4_LANES, src++, dst += NE10_MAT_X4_LANES)
+    {
+        ne10_mat_x4_load_neon (m, src->m, 9);
+        ne10_mat3x3f_store_x4_neon (ne10_mat_float (dst), m);
+    }
+    return ne10_mat3x3f_x4_to_aos_c (dst, src, count);
+}
+
+ne10_result_t ne10_mulmat_3x3f_x4_neon (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src1, ne10_mat3x3f_x4_t * src2, ne10_uint32_t count)
+{
+    float32x4_t a[9], b[9], r[9];
+    ne10_uint32_t blk;
+
+    assert (dst && src1 && src2);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_load_neon (a, src1[blk].m, 9);
+        ne10_mat_x4_load_neon (b, src2[blk].m, 9);
+        ne10_mulmat_x4_neon (r, a, b, 3);
+        ne10_mat_x4_store_neon (dst[blk].m, r, 9);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_invmat_3x3f_x4_neon (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[9], r[9];
+    ne10_uint32_t blk;
+
+    assert (dst && src);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_load_neon (m, src[blk].m, 9);
+        ne10_invmat3x3_x4_neon (r, m);
+        ne10_mat_x4_store_neon (dst[blk].m, r, 9);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_detmat_3x3f_x4_neon (ne10_float32_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[9];
+
+    assert (dst && src);
+    for (; count >= NE10_MAT_X4_LANES; count -= NE10_MAT_X4_LANES, src++, dst += NE10_MAT_X4_LANES)
+    {
+        ne10_mat_x4_load_neon (m, src->m, 9);
+        vst1q_f32 (dst, ne10_det3x3_neon (m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8]));
+    }
+    return ne10_detmat_3x3f_x4_c (dst, src, count);
+}
+
+ne10_result_t ne10_transmat_3x3f_x4_neon (ne10_mat3x3f_x4_t * dst, ne10_mat3x3f_x4_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[9], r[9];
+    ne10_uint32_t blk;
+    ne10_int32_t i, j;
+
+    assert (dst && src);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_load_neon (m, src[blk].m, 9);
+        for (j = 0; j < 3; j++)
+            for (i = 0; i < 3; i++)
+                r[j * 3 + i] = m[i * 3 + j];
+        ne10_mat_x4_store_neon (dst[blk].m, r, 9);
+    }
+    return NE10_OK;
+}
+
+/* vld3/vst3 turn four interleaved vectors into one register per component and back */
+ne10_result_t ne10_mulmatvec_3x3f_v3f_x4_neon (ne10_vec3f_t * dst, ne10_mat3x3f_x4_t * mat, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[9];
+    float32x4x3_t v, r;
+
+    assert (dst && mat && src);
+    for (; count >= NE10_MAT_X4_LANES; count -= NE10_MAT_X4_LANES, mat++, src += NE10_MAT_X4_LANES, dst += NE10_MAT_X4_LANES)
+    {
+        ne10_mat_x4_load_neon (m, mat->m, 9);
+        v = vld3q_f32 (ne10_mat_float (src));
+        ne10_mulmatvec_x4_neon (r.val, m, v.val, 3);
+        vst3q_f32 (ne10_mat_float (dst), r);
+    }
+    return ne10_mulmatvec_3x3f_v3f_x4_c (dst, mat, src, count);
+}
+
+ne10_result_t ne10_mat2x2f_aos_to_x4_neon (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count)
+{
+    float32x4x4_t v;
+
+    assert (dst && src);
+    for (; count >= NE10_MAT_X4_LANES; count -= NE10_MAT_X4_LANES, src += NE10_MAT_X4_LANES, dst++)
+    {
+        v = vld4q_f32 (ne10_mat_float (src));
+        ne10_mat_x4_store_neon (dst->m, v.val, 4);
+    }
+    return ne10_mat2x2f_aos_to_x4_c (dst, src, count);
+}
+
+ne10_result_t ne10_mat2x2f_x4_to_aos_neon (ne10_mat2x2f_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count)
+{
+    float32x4x4_t v;
+
+    assert (dst && src);
+    for (; count >= NE10_MAT_X4_LANES; count -= NE10_MAT_X4_LANES, src++, dst += NE10_MAT_X4_LANES)
+    {
+        ne10_mat_x4_load_neon (v.val, src->m, 4);
+        vst4q_f32 (ne10_mat_float (dst), v);
+    }
+    return ne10_mat2x2f_x4_to_aos_c (dst, src, count);
+}
+
+ne10_result_t ne10_mulmat_2x2f_x4_neon (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src1, ne10_mat2x2f_x4_t * src2, ne10_uint32_t count)
+{
+    float32x4_t a[4], b[4], r[4];
+    ne10_uint32_t blk;
+
+    assert (dst && src1 && src2);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_load_neon (a, src1[blk].m, 4);
+        ne10_mat_x4_load_neon (b, src2[blk].m, 4);
+        ne10_mulmat_x4_neon (r, a, b, 2);
+        ne10_mat_x4_store_neon (dst[blk].m, r, 4);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_invmat_2x2f_x4_neon (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[4], r[4];
+    ne10_uint32_t blk;
+
+    assert (dst && src);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_load_neon (m, src[blk].m, 4);
+        ne10_invmat2x2_x4_neon (r, m);
+        ne10_mat_x4_store_neon (dst[blk].m, r, 4);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_detmat_2x2f_x4_neon (ne10_float32_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[4];
+
+    assert (dst && src);
+    for (; count >= NE10_MAT_X4_LANES; count -= NE10_MAT_X4_LANES, src++, dst += NE10_MAT_X4_LANES)
+    {
+        ne10_mat_x4_load_neon (m, src->m, 4);
+        vst1q_f32 (dst, ne10_det2x2_neon (m[0], m[1], m[2], m[3]));
+    }
+    return ne10_detmat_2x2f_x4_c (dst, src, count);
+}
+
+ne10_result_t ne10_transmat_2x2f_x4_neon (ne10_mat2x2f_x4_t * dst, ne10_mat2x2f_x4_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[4], r[4];
+    ne10_uint32_t blk;
+    ne10_int32_t i, j;
+
+    assert (dst && src);
+    for (blk = 0; blk < NE10_MAT_X4_BLOCKS (count); blk++)
+    {
+        ne10_mat_x4_load_neon (m, src[blk].m, 4);
+        for (j = 0; j < 2; j++)
+            for (i = 0; i < 2; i++)
+                r[j * 2 + i] = m[i * 2 + j];
+        ne10_mat_x4_store_neon (dst[blk].m, r, 4);
+    }
+    return NE10_OK;
+}
+
+/* vld2/vst2 turn four interleaved vectors into one register per component and back */
+ne10_result_t ne10_mulmatvec_2x2f_v2f_x4_neon (ne10_vec2f_t * dst, ne10_mat2x2f_x4_t * mat, ne10_vec2f_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[4];
+    float32x4x2_t v, r;
+
+    assert (dst && mat && src);
+    for (; count >= NE10_MAT_X4_LANES; count -= NE10_MAT_X4_LANES, mat++, src += NE10_MAT_X4_LANES, dst += NE10_MAT_X4_LANES)
+    {
+        ne10_mat_x4_load_neon (m, mat->m, 4);
+        v = vld2q_f32 (ne10_mat_float (src));
+        ne10_mulmatvec_x4_neon (r.val, m, v.val, 2);
+        vst2q_f32 (ne10_mat_float (dst), r);
+    }
+    return ne10_mulmatvec_2x2f_v2f_x4_c (dst, mat, src, count);
+}
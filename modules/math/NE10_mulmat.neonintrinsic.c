@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_mulmat.neonintrinsic.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_mat.neonintrinsic.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+/*
+ * dst column j is the sum over k of src1 column k scaled by src2[j][k], added
+ * in increasing k as in the C version. The 2x2 and 3x3 versions work on four
+ * matrices at a time, one register per entry; the 4x4 version works on whole
+ * columns of one matrix. Leftover matrices go through the C version.
+ */
+ne10_result_t ne10_mulmat_2x2f_neon (ne10_mat2x2f_t * dst, ne10_mat2x2f_t * src1, ne10_mat2x2f_t * src2, ne10_uint32_t count)
+{
+    float32x4x4_t a, b, r;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count >= 4; count -= 4, src1 += 4, src2 += 4, dst += 4)
+    {
+        a = vld4q_f32 (ne10_mat_float (src1));
+        b = vld4q_f32 (ne10_mat_float (src2));
+        ne10_mulmat_x4_neon (r.val, a.val, b.val, 2);
+        vst4q_f32 (ne10_mat_float (dst), r);
+    }
+    return ne10_mulmat_2x2f_c (dst, src1, src2, count);
+}
+
+ne10_result_t ne10_mulmat_3x3f_neon (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src1, ne10_mat3x3f_t * src2, ne10_uint32_t count)
+{
+    float32x4_t a[9], b[9], r[9];
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count >= 4; count -= 4, src1 += 4, src2 += 4, dst += 4)
+    {
+        ne10_mat3x3f_load_x4_neon (a, ne10_mat_float (src1));
+        ne10_mat3x3f_load_x4_neon (b, ne10_mat_float (src2));
+        ne10_mulmat_x4_neon (r, a, b, 3);
+        ne10_mat3x3f_store_x4_neon (ne10_mat_float (dst), r);
+    }
+    return ne10_mulmat_3x3f_c (dst, src1, src2, count);
+}
+
+ne10_result_t ne10_mulmat_4x4f_neon (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src1, ne10_mat4x4f_t * src2, ne10_uint32_t count)
+{
+    ne10_float32_t * a;
+    ne10_float32_t * b;
+    ne10_float32_t * d;
+    float32x4_t a0, a1, a2, a3, r;
+    float32x2_t lo, hi;
+    ne10_int32_t j;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (; count > 0; count--, src1++, src2++, dst++)
+    {
+        a = ne10_mat_float (src1);
+        b = ne10_mat_float (src2);
+        d = ne10_mat_float (dst);
+        a0 = vld1q_f32 (a);
+        a1 = vld1q_f32 (a + 4);
+        a2 = vld1q_f32 (a + 8);
+        a3 = vld1q_f32 (a + 12);
+        for (j = 0; j < 4; j++)
+        {
+            lo = vld1_f32 (b + 4 * j);
+            hi = vld1_f32 (b + 4 * j + 2);
+            r = vmulq_lane_f32 (a0, lo, 0);
+            r = vmlaq_lane_f32 (r, a1, lo, 1);
+            r = vmlaq_lane_f32 (r, a2, hi, 0);
+            r = vmlaq_lane_f32 (r, a3, hi, 1);
+            vst1q_f32 (d + 4 * j, r);
+        }
+    }
+    return NE10_OK;
+}
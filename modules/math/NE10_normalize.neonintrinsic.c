@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_normalize.neonintrinsic.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_transcendental.neon.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+/* Each component is divided by the length, as in the C version. */
+ne10_result_t ne10_normalize_vec2f_neon (ne10_vec2f_t * dst, ne10_vec2f_t * src, ne10_uint32_t count)
+{
+    float32x4x2_t n_src;
+    float32x4_t n_len;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4, src += 4, dst += 4)
+    {
+        n_src = vld2q_f32 ( (ne10_float32_t*) src);
+        n_len = vmulq_f32 (n_src.val[0], n_src.val[0]);
+        n_len = vmlaq_f32 (n_len, n_src.val[1], n_src.val[1]);
+        n_len = ne10_sqrt_kernel_neon (n_len);
+        n_src.val[0] = ne10_div_kernel_neon (n_src.val[0], n_len);
+        n_src.val[1] = ne10_div_kernel_neon (n_src.val[1], n_len);
+        vst2q_f32 ( (ne10_float32_t*) dst, n_src);
+    }
+    return ne10_normalize_vec2f_c (dst, src, count);
+}
+
+ne10_result_t ne10_normalize_vec3f_neon (ne10_vec3f_t * dst, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    float32x4x3_t n_src;
+    float32x4_t n_len;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4, src += 4, dst += 4)
+    {
+        n_src = vld3q_f32 ( (ne10_float32_t*) src);
+        n_len = vmulq_f32 (n_src.val[0], n_src.val[0]);
+        n_len = vmlaq_f32 (n_len, n_src.val[1], n_src.val[1]);
+        n_len = vmlaq_f32 (n_len, n_src.val[2], n_src.val[2]);
+        n_len = ne10_sqrt_kernel_neon (n_len);
+        n_src.val[0] = ne10_div_kernel_neon (n_src.val[0], n_len);
+        n_src.val[1] = ne10_div_kernel_neon (n_src.val[1], n_len);
+        n_src.val[2] = ne10_div_kernel_neon (n_src.val[2], n_len);
+        vst3q_f32 ( (ne10_float32_t*) dst, n_src);
+    }
+    return ne10_normalize_vec3f_c (dst, src, count);
+}
+
+ne10_result_t ne10_normalize_vec4f_neon (ne10_vec4f_t * dst, ne10_vec4f_t * src, ne10_uint32_t count)
+{
+    float32x4x4_t n_src;
+    float32x4_t n_len;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (; count >= 4; count -= 4, src += 4, dst += 4)
+    {
+        n_src = vld4q_f32 ( (ne10_float32_t*) src);
+        n_len = vmulq_f32 (n_src.val[0], n_src.val[0]);
+        n_len = vmlaq_f32 (n_len, n_src.val[1], n_src.val[1]);
+        n_len = vmlaq_f32 (n_len, n_src.val[2], n_src.val[2]);
+        n_len = vmlaq_f32 (n_len, n_src.val[3], n_src.val[3]);
+        n_len = ne10_sqrt_kernel_neon (n_len);
+        n_src.val[0] = ne10_div_kernel_neon (n_src.val[0], n_len);
+        n_src.val[1] = ne10_div_kernel_neon (n_src.val[1], n_len);
+        n_src.val[2] = ne10_div_kernel_neon (n_src.val[2], n_len);
+        n_src.val[3] = ne10_div_kernel_neon (n_src.val[3], n_len);
+        vst4q_f32 ( (ne10_float32_t*) dst, n_src);
+    }
+    return ne10_normalize_vec4f_c (dst, src, count);
+}
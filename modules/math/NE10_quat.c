@@ -0,0 +1,439 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_quat.c
+ */
+
+#include "NE10_types.h"
+#include "macros.h"
+
+#include <assert.h>
+
+#include <math.h>
+
+/*
+ * Quaternions are stored as x, y, z, w with w the scalar part. The NEON
+ * versions evaluate every expression below lane-wise in the same order, so
+ * only ne10_slerp_quatf differs, by the error of its acos and sin kernels.
+ */
+
+/* above this cosine of the angle between the inputs, slerp falls back to nlerp */
+#define NE10_QUAT_SLERP_LINEAR 0.9995f
+
+/* r = a * b (Hamilton product); r may alias a or b */
+static inline void ne10_quat_mul (ne10_quatf_t * r, const ne10_quatf_t * a, const ne10_quatf_t * b)
+{
+    ne10_quatf_t t;
+
+    t.x = a->w * b->x + a->x * b->w + a->y * b->z - a->z * b->y;
+    t.y = a->w * b->y - a->x * b->z + a->y * b->w + a->z * b->x;
+    t.z = a->w * b->z + a->x * b->y - a->y * b->x + a->z * b->w;
+    t.w = a->w * b->w - a->x * b->x - a->y * b->y - a->z * b->z;
+    *r = t;
+}
+
+static inline void ne10_quat_normalize (ne10_quatf_t * r, const ne10_quatf_t * q)
+{
+    ne10_float32_t len = sqrt (q->x * q->x + q->y * q->y + q->z * q->z + q->w * q->w);
+
+    r->x = q->x / len;
+    r->y = q->y / len;
+    r->z = q->z / len;
+    r->w = q->w / len;
+}
+
+/* v' = v + w t + q.xyz x t with t = 2 (q.xyz x v), which is q v q* for a unit q */
+static inline void ne10_quat_rotate (ne10_vec3f_t * r, const ne10_quatf_t * q, const ne10_vec3f_t * v)
+{
+    ne10_float32_t tx = 2.0f * (q->y * v->z - q->z * v->y);
+    ne10_float32_t ty = 2.0f * (q->z * v->x - q->x * v->z);
+    ne10_float32_t tz = 2.0f * (q->x * v->y - q->y * v->x);
+    ne10_vec3f_t t;
+
+    t.x = v->x + q->w * tx + (q->y * tz - q->z * ty);
+    t.y = v->y + q->w * ty + (q->z * tx - q->x * tz);
+    t.z = v->z + q->w * tz + (q->x * ty - q->y * tx);
+    *r = t;
+}
+
+/* b or -b, whichever is on the same side as a, and the cosine of the angle between them */
+static inline ne10_float32_t ne10_quat_align (ne10_quatf_t * c, const ne10_quatf_t * a, const ne10_quatf_t * b)
+{
+    ne10_float32_t d = a->x * b->x + a->y * b->y + a->z * b->z + a->w * b->w;
+
+    *c = *b;
+    if (d < 0.0f)
+    {
+        c->x = -c->x;
+        c->y = -c->y;
+        c->z = -c->z;
+        c->w = -c->w;
+        d = -d;
+    }
+    return d;
+}
+
+static inline void ne10_quat_nlerp (ne10_quatf_t * r, const ne10_quatf_t * a, const ne10_quatf_t * c, ne10_float32_t t)
+{
+    ne10_quatf_t l;
+
+    l.x = a->x + t * (c->x - a->x);
+    l.y = a->y + t * (c->y - a->y);
+    l.z = a->z + t * (c->z - a->z);
+    l.w = a->w + t * (c->w - a->w);
+    ne10_quat_normalize (r, &l);
+}
+
+static inline void ne10_quat_slerp (ne10_quatf_t * r, const ne10_quatf_t * a, const ne10_quatf_t * b, ne10_float32_t t)
+{
+    ne10_quatf_t c;
+    ne10_float32_t d = ne10_quat_align (&c, a, b);
+    ne10_float32_t theta, s, ka, kc;
+
+    if (d > NE10_QUAT_SLERP_LINEAR)
+    {
+        ne10_quat_nlerp (r, a, &c, t);
+        return;
+    }
+    theta = acosf (d);
+    s = sinf (theta);
+    ka = sinf ( (1.0f - t) * theta) / s;
+    kc = sinf (t * theta) / s;
+    r->x = ka * a->x + kc * c.x;
+    r->y = ka * a->y + kc * c.y;
+    r->z = ka * a->z + kc * c.z;
+    r->w = ka * a->w + kc * c.w;
+}
+
+/* r = conj(q); r may alias q */
+static inline void ne10_quat_conj (ne10_quatf_t * r, const ne10_quatf_t * q)
+{
+    r->x = -q->x;
+    r->y = -q->y;
+    r->z = -q->z;
+    r->w = q->w;
+}
+
+ne10_result_t ne10_mul_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count)
+{
+    assert (dst && src1 && src2);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quat_mul (&dst[ itr ], &src1[ itr ], &src2[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_conj_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count)
+{
+    assert (dst && src);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quat_conj (&dst[ itr ], &src[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_normalize_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count)
+{
+    assert (dst && src);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quat_normalize (&dst[ itr ], &src[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_rotate_quatf_vec3f_c (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    assert (dst && quat && src);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quat_rotate (&dst[ itr ], &quat[ itr ], &src[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_nlerp_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t t, ne10_uint32_t count)
+{
+    ne10_quatf_t c;
+
+    assert (dst && src1 && src2);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quat_align (&c, &src1[ itr ], &src2[ itr ]);
+        ne10_quat_nlerp (&dst[ itr ], &src1[ itr ], &c, t);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_slerp_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t t, ne10_uint32_t count)
+{
+    assert (dst && src1 && src2);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quat_slerp (&dst[ itr ], &src1[ itr ], &src2[ itr ], t);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_quatf_to_mat3x3f_c (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count)
+{
+    ne10_float32_t x, y, z, w;
+
+    assert (dst && src);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        x = src[ itr ].x;
+        y = src[ itr ].y;
+        z = src[ itr ].z;
+        w = src[ itr ].w;
+
+        dst[ itr ].c1.r1 = 1.0f - 2.0f * (y * y + z * z);
+        dst[ itr ].c1.r2 = 2.0f * (x * y + w * z);
+        dst[ itr ].c1.r3 = 2.0f * (x * z - w * y);
+        dst[ itr ].c2.r1 = 2.0f * (x * y - w * z);
+        dst[ itr ].c2.r2 = 1.0f - 2.0f * (x * x + z * z);
+        dst[ itr ].c2.r3 = 2.0f * (y * z + w * x);
+        dst[ itr ].c3.r1 = 2.0f * (x * z + w * y);
+        dst[ itr ].c3.r2 = 2.0f * (y * z - w * x);
+        dst[ itr ].c3.r3 = 1.0f - 2.0f * (x * x + y * y);
+    }
+    return NE10_OK;
+}
+
+/*
+ * Shepperd's method: the largest of w, x, y and z is found from the diagonal
+ * and taken from a square root, the others from off-diagonal sums and
+ * differences divided by it.
+ */
+ne10_result_t ne10_mat3x3f_to_quatf_c (ne10_quatf_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count)
+{
+    ne10_float32_t m11, m21, m31, m12, m22, m32, m13, m23, m33;
+    ne10_float32_t s;
+
+    assert (dst && src);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        m11 = src[ itr ].c1.r1;
+        m21 = src[ itr ].c1.r2;
+        m31 = src[ itr ].c1.r3;
+        m12 = src[ itr ].c2.r1;
+        m22 = src[ itr ].c2.r2;
+        m32 = src[ itr ].c2.r3;
+        m13 = src[ itr ].c3.r1;
+        m23 = src[ itr ].c3.r2;
+        m33 = src[ itr ].c3.r3;
+
+        if (m11 + m22 + m33 > 0.0f)
+        {
+            s = 2.0f * sqrt (m11 + m22 + m33 + 1.0f);
+            dst[ itr ].x = (m32 - m23) / s;
+            dst[ itr ].y = (m13 - m31) / s;
+            dst[ itr ].z = (m21 - m12) / s;
+            dst[ itr ].w = 0.25f * s;
+        }
+        else if (m11 > m22 && m11 > m33)
+        {
+            s = 2.0f * sqrt (1.0f + m11 - m22 - m33);
+            dst[ itr ].x = 0.25f * s;
+            dst[ itr ].y = (m12 + m21) / s;
+            dst[ itr ].z = (m13 + m31) / s;
+            dst[ itr ].w = (m32 - m23) / s;
+        }
+        else if (m22 > m33)
+        {
+            s = 2.0f * sqrt (1.0f + m22 - m11 - m33);
+            dst[ itr ].x = (m12 + m21) / s;
+            dst[ itr ].y = 0.25f * s;
+            dst[ itr ].z = (m23 + m32) / s;
+            dst[ itr ].w = (m13 - m31) / s;
+        }
+        else
+        {
+            s = 2.0f * sqrt (1.0f + m33 - m11 - m22);
+            dst[ itr ].x = (m13 + m31) / s;
+            dst[ itr ].y = (m23 + m32) / s;
+            dst[ itr ].z = 0.25f * s;
+            dst[ itr ].w = (m21 - m12) / s;
+        }
+    }
+    return NE10_OK;
+}
+
+/* (r1 + e d1)(r2 + e d2) = r1 r2 + e (r1 d2 + d1 r2) */
+ne10_result_t ne10_mul_dualquatf_c (ne10_dualquatf_t * dst, ne10_dualquatf_t * src1, ne10_dualquatf_t * src2, ne10_uint32_t count)
+{
+    ne10_quatf_t r, d1, d2;
+
+    assert (dst && src1 && src2);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quat_mul (&r, &src1[ itr ].real, &src2[ itr ].real);
+        ne10_quat_mul (&d1, &src1[ itr ].real, &src2[ itr ].dual);
+        ne10_quat_mul (&d2, &src1[ itr ].dual, &src2[ itr ].real);
+        dst[ itr ].real = r;
+        dst[ itr ].dual.x = d1.x + d2.x;
+        dst[ itr ].dual.y = d1.y + d2.y;
+        dst[ itr ].dual.z = d1.z + d2.z;
+        dst[ itr ].dual.w = d1.w + d2.w;
+    }
+    return NE10_OK;
+}
+
+/* rotate by the real part, then add the translation 2 (dual * conj(real)).xyz */
+ne10_result_t ne10_transform_dualquatf_vec3f_c (ne10_vec3f_t * dst, ne10_dualquatf_t * dq, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    ne10_quatf_t c, t;
+    ne10_vec3f_t v;
+
+    assert (dst && dq && src);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quat_conj (&c, &dq[ itr ].real);
+        ne10_quat_mul (&t, &dq[ itr ].dual, &c);
+        ne10_quat_rotate (&v, &dq[ itr ].real, &src[ itr ]);
+        dst[ itr ].x = v.x + 2.0f * t.x;
+        dst[ itr ].y = v.y + 2.0f * t.y;
+        dst[ itr ].z = v.z + 2.0f * t.z;
+    }
+    return NE10_OK;
+}
+
+/*
+ * The structure-of-arrays versions gather one quaternion at a time and share
+ * the formulas above.
+ */
+static inline void ne10_quatf_soa_get (ne10_quatf_t * q, const ne10_quatf_soa_t * s, ne10_uint32_t i)
+{
+    q->x = s->x[i];
+    q->y = s->y[i];
+    q->z = s->z[i];
+    q->w = s->w[i];
+}
+
+static inline void ne10_quatf_soa_set (ne10_quatf_soa_t * s, ne10_uint32_t i, const ne10_quatf_t * q)
+{
+    s->x[i] = q->x;
+    s->y[i] = q->y;
+    s->z[i] = q->z;
+    s->w[i] = q->w;
+}
+
+ne10_result_t ne10_mul_quatf_soa_c (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_uint32_t count)
+{
+    ne10_quatf_t a, b;
+
+    assert (dst && src1 && src2);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quatf_soa_get (&a, src1, itr);
+        ne10_quatf_soa_get (&b, src2, itr);
+        ne10_quat_mul (&a, &a, &b);
+        ne10_quatf_soa_set (dst, itr, &a);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_conj_quatf_soa_c (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src, ne10_uint32_t count)
+{
+    assert (dst && src);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst->x[ itr ] = -src->x[ itr ];
+        dst->y[ itr ] = -src->y[ itr ];
+        dst->z[ itr ] = -src->z[ itr ];
+        dst->w[ itr ] = src->w[ itr ];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_normalize_quatf_soa_c (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src, ne10_uint32_t count)
+{
+    ne10_quatf_t q;
+
+    assert (dst && src);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quatf_soa_get (&q, src, itr);
+        ne10_quat_normalize (&q, &q);
+        ne10_quatf_soa_set (dst, itr, &q);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_rotate_quatf_vec3f_soa_c (ne10_vec3f_soa_t * dst, ne10_quatf_soa_t * quat, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_quatf_t q;
+    ne10_vec3f_t v;
+
+    assert (dst && quat && src);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quatf_soa_get (&q, quat, itr);
+        v.x = src->x[ itr ];
+        v.y = src->y[ itr ];
+        v.z = src->z[ itr ];
+        ne10_quat_rotate (&v, &q, &v);
+        dst->x[ itr ] = v.x;
+        dst->y[ itr ] = v.y;
+        dst->z[ itr ] = v.z;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_nlerp_quatf_soa_c (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_float32_t t, ne10_uint32_t count)
+{
+    ne10_quatf_t a, b, c;
+
+    assert (dst && src1 && src2);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quatf_soa_get (&a, src1, itr);
+        ne10_quatf_soa_get (&b, src2, itr);
+        ne10_quat_align (&c, &a, &b);
+        ne10_quat_nlerp (&a, &a, &c, t);
+        ne10_quatf_soa_set (dst, itr, &a);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_slerp_quatf_soa_c (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_float32_t t, ne10_uint32_t count)
+{
+    ne10_quatf_t a, b, r;
+
+    assert (dst && src1 && src2);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_quatf_soa_get (&a, src1, itr);
+        ne10_quatf_soa_get (&b, src2, itr);
+        ne10_quat_slerp (&r, &a, &b, t);
+        ne10_quatf_soa_set (dst, itr, &r);
+    }
+    return NE10_OK;
+}
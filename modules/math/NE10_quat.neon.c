@@ -0,0 +1,546 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_quat.neon.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_transcendental.neon.h"
+#include "NE10_mat.neonintrinsic.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+/*
+ * Four quaternions are handled at a time with one register per component
+ * (val[0..3] = x, y, z, w), which is what vld4q gives for the interleaved
+ * arrays and vld1q per component gives for the structure-of-arrays ones. The
+ * kernels evaluate the expressions of NE10_quat.c lane-wise in the same
+ * order; leftovers are handed to the C versions.
+ */
+
+#define NE10_QUAT_SLERP_LINEAR 0.9995f
+
+static inline float32x4x4_t ne10_quat_mul_neon (float32x4x4_t a, float32x4x4_t b)
+{
+    float32x4x4_t r;
+
+    r.val[0] = vmulq_f32 (a.val[3], b.val[0]);
+    r.val[0] = vmlaq_f32 (r.val[0], a.val[0], b.val[3]);
+    r.val[0] = vmlaq_f32 (r.val[0], a.val[1], b.val[2]);
+    r.val[0] = vmlsq_f32 (r.val[0], a.val[2], b.val[1]);
+
+    r.val[1] = vmulq_f32 (a.val[3], b.val[1]);
+    r.val[1] = vmlsq_f32 (r.val[1], a.val[0], b.val[2]);
+    r.val[1] = vmlaq_f32 (r.val[1], a.val[1], b.val[3]);
+    r.val[1] = vmlaq_f32 (r.val[1], a.val[2], b.val[0]);
+
+    r.val[2] = vmulq_f32 (a.val[3], b.val[2]);
+    r.val[2] = vmlaq_f32 (r.val[2], a.val[0], b.val[1]);
+    r.val[2] = vmlsq_f32 (r.val[2], a.val[1], b.val[0]);
+    r.val[2] = vmlaq_f32 (r.val[2], a.val[2], b.val[3]);
+
+    r.val[3] = vmulq_f32 (a.val[3], b.val[3]);
+    r.val[3] = vmlsq_f32 (r.val[3], a.val[0], b.val[0]);
+    r.val[3] = vmlsq_f32 (r.val[3], a.val[1], b.val[1]);
+    r.val[3] = vmlsq_f32 (r.val[3], a.val[2], b.val[2]);
+    return r;
+}
+
+static inline float32x4x4_t ne10_quat_conj_neon (float32x4x4_t q)
+{
+    q.val[0] = vnegq_f32 (q.val[0]);
+    q.val[1] = vnegq_f32 (q.val[1]);
+    q.val[2] = vnegq_f32 (q.val[2]);
+    return q;
+}
+
+static inline float32x4_t ne10_quat_dot_neon (float32x4x4_t a, float32x4x4_t b)
+{
+    float32x4_t d = vmulq_f32 (a.val[0], b.val[0]);
+
+    d = vmlaq_f32 (d, a.val[1], b.val[1]);
+    d = vmlaq_f32 (d, a.val[2], b.val[2]);
+    return vmlaq_f32 (d, a.val[3], b.val[3]);
+}
+
+static inline float32x4x4_t ne10_quat_normalize_neon (float32x4x4_t q)
+{
+    float32x4_t len = ne10_sqrt_kernel_neon (ne10_quat_dot_neon (q, q));
+
+    q.val[0] = ne10_div_kernel_neon (q.val[0], len);
+    q.val[1] = ne10_div_kernel_neon (q.val[1], len);
+    q.val[2] = ne10_div_kernel_neon (q.val[2], len);
+    q.val[3] = ne10_div_kernel_neon (q.val[3], len);
+    return q;
+}
+
+static inline float32x4x3_t ne10_quat_rotate_neon (float32x4x4_t q, float32x4x3_t v)
+{
+    float32x4_t tx, ty, tz;
+    float32x4x3_t r;
+
+    tx = vmulq_n_f32 (vmlsq_f32 (vmulq_f32 (q.val[1], v.val[2]), q.val[2], v.val[1]), 2.0f);
+    ty = vmulq_n_f32 (vmlsq_f32 (vmulq_f32 (q.val[2], v.val[0]), q.val[0], v.val[2]), 2.0f);
+    tz = vmulq_n_f32 (vmlsq_f32 (vmulq_f32 (q.val[0], v.val[1]), q.val[1], v.val[0]), 2.0f);
+
+    r.val[0] = vaddq_f32 (vmlaq_f32 (v.val[0], q.val[3], tx), vmlsq_f32 (vmulq_f32 (q.val[1], tz), q.val[2], ty));
+    r.val[1] = vaddq_f32 (vmlaq_f32 (v.val[1], q.val[3], ty), vmlsq_f32 (vmulq_f32 (q.val[2], tx), q.val[0], tz));
+    r.val[2] = vaddq_f32 (vmlaq_f32 (v.val[2], q.val[3], tz), vmlsq_f32 (vmulq_f32 (q.val[0], ty), q.val[1], tx));
+    return r;
+}
+
+/* b or -b, whichever is on the same side as a, and the cosine of the angle between them */
+static inline float32x4x4_t ne10_quat_align_neon (float32x4x4_t a, float32x4x4_t b, float32x4_t * d)
+{
+    float32x4_t dot = ne10_quat_dot_neon (a, b);
+    uint32x4_t neg = vcltq_f32 (dot, vdupq_n_f32 (0.0f));
+
+    b.val[0] = vbslq_f32 (neg, vnegq_f32 (b.val[0]), b.val[0]);
+    b.val[1] = vbslq_f32 (neg, vnegq_f32 (b.val[1]), b.val[1]);
+    b.val[2] = vbslq_f32 (neg, vnegq_f32 (b.val[2]), b.val[2]);
+    b.val[3] = vbslq_f32 (neg, vnegq_f32 (b.val[3]), b.val[3]);
+    *d = vbslq_f32 (neg, vnegq_f32 (dot), dot);
+    return b;
+}
+
+static inline float32x4x4_t ne10_quat_nlerp_neon (float32x4x4_t a, float32x4x4_t c, ne10_float32_t t)
+{
+    float32x4x4_t l;
+
+    l.val[0] = vmlaq_n_f32 (a.val[0], vsubq_f32 (c.val[0], a.val[0]), t);
+    l.val[1] = vmlaq_n_f32 (a.val[1], vsubq_f32 (c.val[1], a.val[1]), t);
+    l.val[2] = vmlaq_n_f32 (a.val[2], vsubq_f32 (c.val[2], a.val[2]), t);
+    l.val[3] = vmlaq_n_f32 (a.val[3], vsubq_f32 (c.val[3], a.val[3]), t);
+    return ne10_quat_normalize_neon (l);
+}
+
+/* both branches of the C version are evaluated and the lanes picked by the cosine */
+static inline float32x4x4_t ne10_quat_slerp_neon (float32x4x4_t a, float32x4x4_t b, ne10_float32_t t)
+{
+    float32x4_t d, theta, s, sa, sc, unused, ka, kc;
+    float32x4x4_t c = ne10_quat_align_neon (a, b, &d);
+    float32x4x4_t lin = ne10_quat_nlerp_neon (a, c, t);
+    uint32x4_t linear = vcgtq_f32 (d, vdupq_n_f32 (NE10_QUAT_SLERP_LINEAR));
+    float32x4x4_t r;
+    ne10_int32_t k;
+
+    theta = ne10_acos_kernel_neon (d);
+    ne10_sincos_kernel_neon (theta, &s, &unused);
+    ne10_sincos_kernel_neon (vmulq_n_f32 (theta, 1.0f - t), &sa, &unused);
+    ne10_sincos_kernel_neon (vmulq_n_f32 (theta, t), &sc, &unused);
+    ka = ne10_div_kernel_neon (sa, s);
+    kc = ne10_div_kernel_neon (sc, s);
+
+    for (k = 0; k < 4; k++)
+    {
+        r.val[k] = vmlaq_f32 (vmulq_f32 (ka, a.val[k]), kc, c.val[k]);
+        r.val[k] = vbslq_f32 (linear, lin.val[k], r.val[k]);
+    }
+    return r;
+}
+
+/* two interleaved pairs of dual quaternions per vld4q, split into real and dual parts */
+static inline void ne10_dualquatf_load_x4_neon (float32x4x4_t * real, float32x4x4_t * dual, const ne10_dualquatf_t * src)
+{
+    float32x4x4_t lo = vld4q_f32 (&src[0].real.x);
+    float32x4x4_t hi = vld4q_f32 (&src[2].real.x);
+    float32x4x2_t u;
+    ne10_int32_t k;
+
+    for (k = 0; k < 4; k++)
+    {
+        u = vuzpq_f32 (lo.val[k], hi.val[k]);
+        real->val[k] = u.val[0];
+        dual->val[k] = u.val[1];
+    }
+}
+
+static inline void ne10_dualquatf_store_x4_neon (ne10_dualquatf_t * dst, float32x4x4_t real, float32x4x4_t dual)
+{
+    float32x4x4_t lo, hi;
+    float32x4x2_t z;
+    ne10_int32_t k;
+
+    for (k = 0; k < 4; k++)
+    {
+        z = vzipq_f32 (real.val[k], dual.val[k]);
+        lo.val[k] = z.val[0];
+        hi.val[k] = z.val[1];
+    }
+    vst4q_f32 (&dst[0].real.x, lo);
+    vst4q_f32 (&dst[2].real.x, hi);
+}
+
+ne10_result_t ne10_mul_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i = 0;
+
+    assert (dst && src1 && src2);
+    for (; i + 4 <= count; i += 4)
+    {
+        vst4q_f32 (&dst[i].x, ne10_quat_mul_neon (vld4q_f32 (&src1[i].x), vld4q_f32 (&src2[i].x)));
+    }
+    return ne10_mul_quatf_c (dst + i, src1 + i, src2 + i, count - i);
+}
+
+/* one quaternion per register: flip the signs of x, y and z */
+ne10_result_t ne10_conj_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count)
+{
+    static const ne10_uint32_t sign[4] = { 0x80000000, 0x80000000, 0x80000000, 0 };
+    uint32x4_t mask = vld1q_u32 (sign);
+    ne10_uint32_t i;
+
+    assert (dst && src);
+    for (i = 0; i < count; i++)
+    {
+        vst1q_f32 (&dst[i].x, vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (vld1q_f32 (&src[i].x)), mask)));
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_normalize_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i = 0;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        vst4q_f32 (&dst[i].x, ne10_quat_normalize_neon (vld4q_f32 (&src[i].x)));
+    }
+    return ne10_normalize_quatf_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t ne10_rotate_quatf_vec3f_neon (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i = 0;
+
+    assert (dst && quat && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        vst3q_f32 (&dst[i].x, ne10_quat_rotate_neon (vld4q_f32 (&quat[i].x), vld3q_f32 (&src[i].x)));
+    }
+    return ne10_rotate_quatf_vec3f_c (dst + i, quat + i, src + i, count - i);
+}
+
+ne10_result_t ne10_nlerp_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t t, ne10_uint32_t count)
+{
+    float32x4x4_t a, c;
+    float32x4_t d;
+    ne10_uint32_t i = 0;
+
+    assert (dst && src1 && src2);
+    for (; i + 4 <= count; i += 4)
+    {
+        a = vld4q_f32 (&src1[i].x);
+        c = ne10_quat_align_neon (a, vld4q_f32 (&src2[i].x), &d);
+        vst4q_f32 (&dst[i].x, ne10_quat_nlerp_neon (a, c, t));
+    }
+    return ne10_nlerp_quatf_c (dst + i, src1 + i, src2 + i, t, count - i);
+}
+
+ne10_result_t ne10_slerp_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t t, ne10_uint32_t count)
+{
+    ne10_uint32_t i = 0;
+
+    assert (dst && src1 && src2);
+    for (; i + 4 <= count; i += 4)
+    {
+        vst4q_f32 (&dst[i].x, ne10_quat_slerp_neon (vld4q_f32 (&src1[i].x), vld4q_f32 (&src2[i].x), t));
+    }
+    return ne10_slerp_quatf_c (dst + i, src1 + i, src2 + i, t, count - i);
+}
+
+ne10_result_t ne10_quatf_to_mat3x3f_neon (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count)
+{
+    float32x4x4_t q;
+    float32x4_t x, y, z, w;
+    float32x4_t m[9];
+    ne10_uint32_t i = 0;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        q = vld4q_f32 (&src[i].x);
+        x = q.val[0];
+        y = q.val[1];
+        z = q.val[2];
+        w = q.val[3];
+
+        m[0] = vmlsq_n_f32 (vdupq_n_f32 (1.0f), vmlaq_f32 (vmulq_f32 (y, y), z, z), 2.0f);
+        m[1] = vmulq_n_f32 (vmlaq_f32 (vmulq_f32 (x, y), w, z), 2.0f);
+        m[2] = vmulq_n_f32 (vmlsq_f32 (vmulq_f32 (x, z), w, y), 2.0f);
+        m[3] = vmulq_n_f32 (vmlsq_f32 (vmulq_f32 (x, y), w, z), 2.0f);
+        m[4] = vmlsq_n_f32 (vdupq_n_f32 (1.0f), vmlaq_f32 (vmulq_f32 (x, x), z, z), 2.0f);
+        m[5] = vmulq_n_f32 (vmlaq_f32 (vmulq_f32 (y, z), w, x), 2.0f);
+        m[6] = vmulq_n_f32 (vmlaq_f32 (vmulq_f32 (x, z), w, y), 2.0f);
+        m[7] = vmulq_n_f32 (vmlsq_f32 (vmulq_f32 (y, z), w, x), 2.0f);
+        m[8] = vmlsq_n_f32 (vdupq_n_f32 (1.0f), vmlaq_f32 (vmulq_f32 (x, x), y, y), 2.0f);
+        ne10_mat3x3f_store_x4_neon ( (ne10_float32_t *) &dst[i], m);
+    }
+    return ne10_quatf_to_mat3x3f_c (dst + i, src + i, count - i);
+}
+
+/*
+ * Shepperd's method without branches: the case of each lane picks the square
+ * root argument and the numerators, then every component is a numerator over
+ * s except the largest one, which is s / 4.
+ */
+ne10_result_t ne10_mat3x3f_to_quatf_neon (ne10_quatf_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[9];
+    float32x4_t one = vdupq_n_f32 (1.0f);
+    float32x4_t zero = vdupq_n_f32 (0.0f);
+    float32x4_t trace, arg, s, quarter;
+    float32x4_t d32, d13, d21, p12, p13, p23;
+    float32x4_t nx, ny, nz, nw;
+    uint32x4_t c0, c1, c2, k1, k2, k3;
+    float32x4x4_t q;
+    ne10_uint32_t i = 0;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        /* m[e]: m11, m21, m31, m12, m22, m32, m13, m23, m33 */
+        ne10_mat3x3f_load_x4_neon (m, (const ne10_float32_t *) &src[i]);
+
+        trace = vaddq_f32 (vaddq_f32 (m[0], m[4]), m[8]);
+        c0 = vcgtq_f32 (trace, zero);
+        c1 = vandq_u32 (vcgtq_f32 (m[0], m[4]), vcgtq_f32 (m[0], m[8]));
+        c2 = vcgtq_f32 (m[4], m[8]);
+        k1 = vbicq_u32 (c1, c0);
+        k2 = vbicq_u32 (vbicq_u32 (c2, c1), c0);
+        k3 = vmvnq_u32 (vorrq_u32 (vorrq_u32 (c0, c1), c2));
+
+        arg = vsubq_f32 (vsubq_f32 (vaddq_f32 (one, m[8]), m[0]), m[4]);
+        arg = vbslq_f32 (c2, vsubq_f32 (vsubq_f32 (vaddq_f32 (one, m[4]), m[0]), m[8]), arg);
+        arg = vbslq_f32 (c1, vsubq_f32 (vsubq_f32 (vaddq_f32 (one, m[0]), m[4]), m[8]), arg);
+        arg = vbslq_f32 (c0, vaddq_f32 (trace, one), arg);
+        s = vmulq_n_f32 (ne10_sqrt_kernel_neon (arg), 2.0f);
+        quarter = vmulq_n_f32 (s, 0.25f);
+
+        d32 = vsubq_f32 (m[5], m[7]);
+        d13 = vsubq_f32 (m[6], m[2]);
+        d21 = vsubq_f32 (m[1], m[3]);
+        p12 = vaddq_f32 (m[3], m[1]);
+        p13 = vaddq_f32 (m[6], m[2]);
+        p23 = vaddq_f32 (m[7], m[5]);
+
+        nx = vbslq_f32 (c0, d32, vbslq_f32 (c1, zero, vbslq_f32 (c2, p12, p13)));
+        ny = vbslq_f32 (c0, d13, vbslq_f32 (c1, p12, vbslq_f32 (c2, zero, p23)));
+        nz = vbslq_f32 (c0, d21, vbslq_f32 (c1, p13, vbslq_f32 (c2, p23, zero)));
+        nw = vbslq_f32 (c0, zero, vbslq_f32 (c1, d32, vbslq_f32 (c2, d13, d21)));
+
+        q.val[0] = vbslq_f32 (k1, quarter, ne10_div_kernel_neon (nx, s));
+        q.val[1] = vbslq_f32 (k2, quarter, ne10_div_kernel_neon (ny, s));
+        q.val[2] = vbslq_f32 (k3, quarter, ne10_div_kernel_neon (nz, s));
+        q.val[3] = vbslq_f32 (c0, quarter, ne10_div_kernel_neon (nw, s));
+        vst4q_f32 (&dst[i].x, q);
+    }
+    return ne10_mat3x3f_to_quatf_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t ne10_mul_dualquatf_neon (ne10_dualquatf_t * dst, ne10_dualquatf_t * src1, ne10_dualquatf_t * src2, ne10_uint32_t count)
+{
+    float32x4x4_t r1, d1, r2, d2, a, b;
+    ne10_uint32_t i = 0;
+    ne10_int32_t k;
+
+    assert (dst && src1 && src2);
+    for (; i + 4 <= count; i += 4)
+    {
+        ne10_dualquatf_load_x4_neon (&r1, &d1, &src1[i]);
+        ne10_dualquatf_load_x4_neon (&r2, &d2, &src2[i]);
+        a = ne10_quat_mul_neon (r1, d2);
+        b = ne10_quat_mul_neon (d1, r2);
+        for (k = 0; k < 4; k++)
+            a.val[k] = vaddq_f32 (a.val[k], b.val[k]);
+        ne10_dualquatf_store_x4_neon (&dst[i], ne10_quat_mul_neon (r1, r2), a);
+    }
+    return ne10_mul_dualquatf_c (dst + i, src1 + i, src2 + i, count - i);
+}
+
+ne10_result_t ne10_transform_dualquatf_vec3f_neon (ne10_vec3f_t * dst, ne10_dualquatf_t * dq, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    float32x4x4_t r, d, t;
+    float32x4x3_t v;
+    ne10_uint32_t i = 0;
+
+    assert (dst && dq && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        ne10_dualquatf_load_x4_neon (&r, &d, &dq[i]);
+        t = ne10_quat_mul_neon (d, ne10_quat_conj_neon (r));
+        v = ne10_quat_rotate_neon (r, vld3q_f32 (&src[i].x));
+        v.val[0] = vmlaq_n_f32 (v.val[0], t.val[0], 2.0f);
+        v.val[1] = vmlaq_n_f32 (v.val[1], t.val[1], 2.0f);
+        v.val[2] = vmlaq_n_f32 (v.val[2], t.val[2], 2.0f);
+        vst3q_f32 (&dst[i].x, v);
+    }
+    return ne10_transform_dualquatf_vec3f_c (dst + i, dq + i, src + i, count - i);
+}
+
+/* The quaternions and vectors of a set from index offset onwards, for handing leftovers to the C version. */
+static inline ne10_quatf_soa_t ne10_quatf_soa_from (const ne10_quatf_soa_t * s, ne10_uint32_t offset)
+{
+    ne10_quatf_soa_t r = { s->x + offset, s->y + offset, s->z + offset, s->w + offset };
+    return r;
+}
+
+static inline ne10_vec3f_soa_t ne10_vec3f_soa_from (const ne10_vec3f_soa_t * s, ne10_uint32_t offset)
+{
+    ne10_vec3f_soa_t r = { s->x + offset, s->y + offset, s->z + offset };
+    return r;
+}
+
+static inline float32x4x4_t ne10_quatf_soa_load_neon (const ne10_quatf_soa_t * s, ne10_uint32_t i)
+{
+    float32x4x4_t q;
+
+    q.val[0] = vld1q_f32 (s->x + i);
+    q.val[1] = vld1q_f32 (s->y + i);
+    q.val[2] = vld1q_f32 (s->z + i);
+    q.val[3] = vld1q_f32 (s->w + i);
+    return q;
+}
+
+static inline void ne10_quatf_soa_store_neon (ne10_quatf_soa_t * s, ne10_uint32_t i, float32x4x4_t q)
+{
+    vst1q_f32 (s->x + i, q.val[0]);
+    vst1q_f32 (s->y + i, q.val[1]);
+    vst1q_f32 (s->z + i, q.val[2]);
+    vst1q_f32 (s->w + i, q.val[3]);
+}
+
+ne10_result_t ne10_mul_quatf_soa_neon (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_uint32_t count)
+{
+    ne10_quatf_soa_t d, s1, s2;
+    ne10_uint32_t i = 0;
+
+    assert (dst && src1 && src2);
+    for (; i + 4 <= count; i += 4)
+    {
+        ne10_quatf_soa_store_neon (dst, i, ne10_quat_mul_neon (ne10_quatf_soa_load_neon (src1, i), ne10_quatf_soa_load_neon (src2, i)));
+    }
+    d = ne10_quatf_soa_from (dst, i);
+    s1 = ne10_quatf_soa_from (src1, i);
+    s2 = ne10_quatf_soa_from (src2, i);
+    return ne10_mul_quatf_soa_c (&d, &s1, &s2, count - i);
+}
+
+ne10_result_t ne10_conj_quatf_soa_neon (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src, ne10_uint32_t count)
+{
+    ne10_quatf_soa_t d, s;
+    ne10_uint32_t i = 0;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        ne10_quatf_soa_store_neon (dst, i, ne10_quat_conj_neon (ne10_quatf_soa_load_neon (src, i)));
+    }
+    d = ne10_quatf_soa_from (dst, i);
+    s = ne10_quatf_soa_from (src, i);
+    return ne10_conj_quatf_soa_c (&d, &s, count - i);
+}
+
+ne10_result_t ne10_normalize_quatf_soa_neon (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src, ne10_uint32_t count)
+{
+    ne10_quatf_soa_t d, s;
+    ne10_uint32_t i = 0;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        ne10_quatf_soa_store_neon (dst, i, ne10_quat_normalize_neon (ne10_quatf_soa_load_neon (src, i)));
+    }
+    d = ne10_quatf_soa_from (dst, i);
+    s = ne10_quatf_soa_from (src, i);
+    return ne10_normalize_quatf_soa_c (&d, &s, count - i);
+}
+
+ne10_result_t ne10_rotate_quatf_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_quatf_soa_t * quat, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    float32x4x3_t v;
+    ne10_vec3f_soa_t d, s;
+    ne10_quatf_soa_t q;
+    ne10_uint32_t i = 0;
+
+    assert (dst && quat && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        v.val[0] = vld1q_f32 (src->x + i);
+        v.val[1] = vld1q_f32 (src->y + i);
+        v.val[2] = vld1q_f32 (src->z + i);
+        v = ne10_quat_rotate_neon (ne10_quatf_soa_load_neon (quat, i), v);
+        vst1q_f32 (dst->x + i, v.val[0]);
+        vst1q_f32 (dst->y + i, v.val[1]);
+        vst1q_f32 (dst->z + i, v.val[2]);
+    }
+    d = ne10_vec3f_soa_from (dst, i);
+    q = ne10_quatf_soa_from (quat, i);
+    s = ne10_vec3f_soa_from (src, i);
+    return ne10_rotate_quatf_vec3f_soa_c (&d, &q, &s, count - i);
+}
+
+ne10_result_t ne10_nlerp_quatf_soa_neon (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_float32_t t, ne10_uint32_t count)
+{
+    float32x4x4_t a, c;
+    float32x4_t dot;
+    ne10_quatf_soa_t d, s1, s2;
+    ne10_uint32_t i = 0;
+
+    assert (dst && src1 && src2);
+    for (; i + 4 <= count; i += 4)
+    {
+        a = ne10_quatf_soa_load_neon (src1, i);
+        c = ne10_quat_align_neon (a, ne10_quatf_soa_load_neon (src2, i), &dot);
+        ne10_quatf_soa_store_neon (dst, i, ne10_quat_nlerp_neon (a, c, t));
+    }
+    d = ne10_quatf_soa_from (dst, i);
+    s1 = ne10_quatf_soa_from (src1, i);
+    s2 = ne10_quatf_soa_from (src2, i);
+    return ne10_nlerp_quatf_soa_c (&d, &s1, &s2, t, count - i);
+}
+
+ne10_result_t ne10_slerp_quatf_soa_neon (ne10_quatf_soa_t * dst, ne10_quatf_soa_t * src1, ne10_quatf_soa_t * src2, ne10_float32_t t, ne10_uint32_t count)
+{
+    ne10_quatf_soa_t d, s1, s2;
+    ne10_uint32_t i = 0;
+
+    assert (dst && src1 && src2);
+    for (; i + 4 <= count; i += 4)
+    {
+        ne10_quatf_soa_store_neon (dst, i, ne10_quat_slerp_neon (ne10_quatf_soa_load_neon (src1, i), ne10_quatf_soa_load_neon (src2, i), t));
+    }
+    d = ne10_quatf_soa_from (dst, i);
+    s1 = ne10_quatf_soa_from (src1, i);
+    s2 = ne10_quatf_soa_from (src2, i);
+    return ne10_slerp_quatf_soa_c (&d, &s1, &s2, t, count - i);
+}
@@ -0,0 +1,376 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_reduce.c
+ */
+
+#include "NE10_types.h"
+#include "macros.h"
+
+#include <assert.h>
+
+#include <math.h>
+
+/* terms accumulated by the compensated sums */
+typedef enum
+{
+    NE10_REDUCE_VALUE = 0,
+    NE10_REDUCE_ABS,
+    NE10_REDUCE_SQR
+} ne10_reduce_op_t;
+
+/*
+ * Kahan summation of op(src[i] - offset). The running compensation keeps
+ * the error independent of count.
+ */
+static ne10_float32_t ne10_reduce_kahan_c (ne10_float32_t * src, ne10_uint32_t count, ne10_reduce_op_t op, ne10_float32_t offset)
+{
+    ne10_float32_t sum = 0.0f;
+    ne10_float32_t comp = 0.0f;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_float32_t x = src[ itr ] - offset;
+        ne10_float32_t y, t;
+
+        if (op == NE10_REDUCE_ABS)
+            x = fabsf (x);
+        else if (op == NE10_REDUCE_SQR)
+            x = x * x;
+
+        y = x - comp;
+        t = sum + y;
+        comp = (t - sum) - y;
+        sum = t;
+    }
+    return sum;
+}
+
+ne10_result_t ne10_sum_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    *dst = ne10_reduce_kahan_c (src, count, NE10_REDUCE_VALUE, 0.0f);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_minmax_float_c (ne10_float32_t * min, ne10_float32_t * max, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_float32_t lo, hi;
+
+    if (count == 0)
+        return NE10_ERR;
+
+    lo = hi = src[0];
+    for ( unsigned int itr = 1; itr < count; itr++ )
+    {
+        if (src[ itr ] < lo)
+            lo = src[ itr ];
+        if (src[ itr ] > hi)
+            hi = src[ itr ];
+    }
+    *min = lo;
+    *max = hi;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_argmin_float_c (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t best = 0;
+
+    if (count == 0)
+        return NE10_ERR;
+
+    for ( unsigned int itr = 1; itr < count; itr++ )
+    {
+        if (src[ itr ] < src[ best ])
+            best = itr;
+    }
+    *value = src[ best ];
+    *index = best;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_argmax_float_c (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t best = 0;
+
+    if (count == 0)
+        return NE10_ERR;
+
+    for ( unsigned int itr = 1; itr < count; itr++ )
+    {
+        if (src[ itr ] > src[ best ])
+            best = itr;
+    }
+    *value = src[ best ];
+    *index = best;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mean_var_float_c (ne10_float32_t * mean, ne10_float32_t * var, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_float32_t m;
+
+    if (count == 0)
+        return NE10_ERR;
+
+    /* two passes: the deviations from the mean avoid the cancellation of E[x^2] - E[x]^2 */
+    m = ne10_reduce_kahan_c (src, count, NE10_REDUCE_VALUE, 0.0f) / count;
+    *var = ne10_reduce_kahan_c (src, count, NE10_REDUCE_SQR, m) / count;
+    *mean = m;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_rms_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    if (count == 0)
+        return NE10_ERR;
+
+    *dst = sqrtf (ne10_reduce_kahan_c (src, count, NE10_REDUCE_SQR, 0.0f) / count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_l1_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    *dst = ne10_reduce_kahan_c (src, count, NE10_REDUCE_ABS, 0.0f);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_l2_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    *dst = sqrtf (ne10_reduce_kahan_c (src, count, NE10_REDUCE_SQR, 0.0f));
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_linf_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_float32_t hi = 0.0f;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        if (fabsf (src[ itr ]) > hi)
+            hi = fabsf (src[ itr ]);
+    }
+    *dst = hi;
+    return NE10_OK;
+}
+
+/*
+ * The fixed-point reductions are exact: sums are kept in 64 bits and
+ * magnitudes are unsigned, so that |-2^31| and |-2^15| are representable.
+ */
+static inline ne10_uint32_t ne10_reduce_abs_int32 (ne10_int32_t x)
+{
+    return (x < 0) ? 0u - (ne10_uint32_t) x : (ne10_uint32_t) x;
+}
+
+static inline ne10_uint32_t ne10_reduce_abs_int16 (ne10_int16_t x)
+{
+    return (x < 0) ? (ne10_uint32_t) (- (ne10_int32_t) x) : (ne10_uint32_t) x;
+}
+
+ne10_result_t ne10_sum_int32_c (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count)
+{
+    ne10_int64_t sum = 0;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        sum += src[ itr ];
+    }
+    *dst = sum;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_minmax_int32_c (ne10_int32_t * min, ne10_int32_t * max, ne10_int32_t * src, ne10_uint32_t count)
+{
+    ne10_int32_t lo, hi;
+
+    if (count == 0)
+        return NE10_ERR;
+
+    lo = hi = src[0];
+    for ( unsigned int itr = 1; itr < count; itr++ )
+    {
+        if (src[ itr ] < lo)
+            lo = src[ itr ];
+        if (src[ itr ] > hi)
+            hi = src[ itr ];
+    }
+    *min = lo;
+    *max = hi;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_argmin_int32_c (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t best = 0;
+
+    if (count == 0)
+        return NE10_ERR;
+
+    for ( unsigned int itr = 1; itr < count; itr++ )
+    {
+        if (src[ itr ] < src[ best ])
+            best = itr;
+    }
+    *value = src[ best ];
+    *index = best;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_argmax_int32_c (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t best = 0;
+
+    if (count == 0)
+        return NE10_ERR;
+
+    for ( unsigned int itr = 1; itr < count; itr++ )
+    {
+        if (src[ itr ] > src[ best ])
+            best = itr;
+    }
+    *value = src[ best ];
+    *index = best;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_l1_int32_c (ne10_uint64_t * dst, ne10_int32_t * src, ne10_uint32_t count)
+{
+    ne10_uint64_t sum = 0;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        sum += ne10_reduce_abs_int32 (src[ itr ]);
+    }
+    *dst = sum;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_linf_int32_c (ne10_uint32_t * dst, ne10_int32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t hi = 0;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        if (ne10_reduce_abs_int32 (src[ itr ]) > hi)
+            hi = ne10_reduce_abs_int32 (src[ itr ]);
+    }
+    *dst = hi;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sum_int16_c (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count)
+{
+    ne10_int64_t sum = 0;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        sum += src[ itr ];
+    }
+    *dst = sum;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_minmax_int16_c (ne10_int16_t * min, ne10_int16_t * max, ne10_int16_t * src, ne10_uint32_t count)
+{
+    ne10_int16_t lo, hi;
+
+    if (count == 0)
+        return NE10_ERR;
+
+    lo = hi = src[0];
+    for ( unsigned int itr = 1; itr < count; itr++ )
+    {
+        if (src[ itr ] < lo)
+            lo = src[ itr ];
+        if (src[ itr ] > hi)
+            hi = src[ itr ];
+    }
+    *min = lo;
+    *max = hi;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_argmin_int16_c (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t best = 0;
+
+    if (count == 0)
+        return NE10_ERR;
+
+    for ( unsigned int itr = 1; itr < count; itr++ )
+    {
+        if (src[ itr ] < src[ best ])
+            best = itr;
+    }
+    *value = src[ best ];
+    *index = best;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_argmax_int16_c (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t best = 0;
+
+    if (count == 0)
+        return NE10_ERR;
+
+    for ( unsigned int itr = 1; itr < count; itr++ )
+    {
+        if (src[ itr ] > src[ best ])
+            best = itr;
+    }
+    *value = src[ best ];
+    *index = best;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_l1_int16_c (ne10_uint64_t * dst, ne10_int16_t * src, ne10_uint32_t count)
+{
+    ne10_uint64_t sum = 0;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        sum += ne10_reduce_abs_int16 (src[ itr ]);
+    }
+    *dst = sum;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_linf_int16_c (ne10_uint32_t * dst, ne10_int16_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t hi = 0;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        if (ne10_reduce_abs_int16 (src[ itr ]) > hi)
+            hi = ne10_reduce_abs_int16 (src[ itr ]);
+    }
+    *dst = hi;
+    return NE10_OK;
+}
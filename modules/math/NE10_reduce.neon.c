@@ -0,0 +1,604 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_reduce.neon.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+
+#include <assert.h>
+#include <math.h>
+#include <arm_neon.h>
+
+/* terms accumulated by the compensated sums */
+typedef enum
+{
+    NE10_REDUCE_VALUE = 0,
+    NE10_REDUCE_ABS,
+    NE10_REDUCE_SQR
+} ne10_reduce_op_t;
+
+/* blocks of Q15 input that can be widened into 32-bit lanes without overflow */
+#define NE10_REDUCE_INT16_BLOCK 16384
+
+static inline void ne10_reduce_kahan_add (ne10_float32_t * sum, ne10_float32_t * comp, ne10_float32_t x)
+{
+    ne10_float32_t y = x - *comp;
+    ne10_float32_t t = *sum + y;
+    *comp = (t - *sum) - y;
+    *sum = t;
+}
+
+static inline void ne10_reduce_kahan_add_neon (float32x4_t * sum, float32x4_t * comp, float32x4_t x)
+{
+    float32x4_t y = vsubq_f32 (x, *comp);
+    float32x4_t t = vaddq_f32 (*sum, y);
+    *comp = vsubq_f32 (vsubq_f32 (t, *sum), y);
+    *sum = t;
+}
+
+static inline float32x4_t ne10_reduce_term_neon (float32x4_t x, ne10_reduce_op_t op)
+{
+    if (op == NE10_REDUCE_ABS)
+        return vabsq_f32 (x);
+    if (op == NE10_REDUCE_SQR)
+        return vmulq_f32 (x, x);
+    return x;
+}
+
+/*
+ * Kahan summation of op(src[i] - offset) in eight lanes. The lane sums and
+ * their compensations are folded together with the tail in scalar code.
+ */
+static inline ne10_float32_t ne10_reduce_kahan_neon (ne10_float32_t * src, ne10_uint32_t count, ne10_reduce_op_t op, ne10_float32_t offset)
+{
+    float32x4_t off = vdupq_n_f32 (offset);
+    float32x4_t sum0 = vdupq_n_f32 (0.0f);
+    float32x4_t sum1 = vdupq_n_f32 (0.0f);
+    float32x4_t comp0 = vdupq_n_f32 (0.0f);
+    float32x4_t comp1 = vdupq_n_f32 (0.0f);
+    ne10_float32_t lanes[16];
+    ne10_float32_t sum = 0.0f;
+    ne10_float32_t comp = 0.0f;
+    ne10_uint32_t itr;
+
+    for (; count >= 8; count -= 8, src += 8)
+    {
+        ne10_reduce_kahan_add_neon (&sum0, &comp0, ne10_reduce_term_neon (vsubq_f32 (vld1q_f32 (src), off), op));
+        ne10_reduce_kahan_add_neon (&sum1, &comp1, ne10_reduce_term_neon (vsubq_f32 (vld1q_f32 (src + 4), off), op));
+    }
+
+    vst1q_f32 (lanes, sum0);
+    vst1q_f32 (lanes + 4, sum1);
+    vst1q_f32 (lanes + 8, vnegq_f32 (comp0));
+    vst1q_f32 (lanes + 12, vnegq_f32 (comp1));
+    for (itr = 0; itr < 16; itr++)
+        ne10_reduce_kahan_add (&sum, &comp, lanes[itr]);
+
+    for (itr = 0; itr < count; itr++)
+    {
+        ne10_float32_t x = src[itr] - offset;
+        if (op == NE10_REDUCE_ABS)
+            x = fabsf (x);
+        else if (op == NE10_REDUCE_SQR)
+            x = x * x;
+        ne10_reduce_kahan_add (&sum, &comp, x);
+    }
+    return sum;
+}
+
+/*
+ * Per-lane running best with the index of its first occurrence, then a scalar
+ * pass over the lanes (lowest index wins ties) and the tail.
+ */
+static inline void ne10_reduce_arg_float_neon (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count, ne10_int32_t is_max)
+{
+    const ne10_uint32_t init_idx[4] = { 0, 1, 2, 3 };
+    float32x4_t best = vld1q_f32 (src);
+    uint32x4_t idx = vld1q_u32 (init_idx);
+    uint32x4_t cur = idx;
+    uint32x4_t step = vdupq_n_u32 (4);
+    ne10_float32_t lane_val[4];
+    ne10_uint32_t lane_idx[4];
+    ne10_float32_t v;
+    ne10_uint32_t i, itr;
+
+    for (i = 4; i + 4 <= count; i += 4)
+    {
+        float32x4_t x = vld1q_f32 (src + i);
+        uint32x4_t better = is_max ? vcgtq_f32 (x, best) : vcltq_f32 (x, best);
+
+        cur = vaddq_u32 (cur, step);
+        best = vbslq_f32 (better, x, best);
+        idx = vbslq_u32 (better, cur, idx);
+    }
+
+    vst1q_f32 (lane_val, best);
+    vst1q_u32 (lane_idx, idx);
+    v = lane_val[0];
+    *index = lane_idx[0];
+    for (itr = 1; itr < 4; itr++)
+    {
+        ne10_float32_t x = lane_val[itr];
+        if ( (is_max ? x > v : x < v) || (x == v && lane_idx[itr] < *index))
+        {
+            v = x;
+            *index = lane_idx[itr];
+        }
+    }
+    for (; i < count; i++)
+    {
+        if (is_max ? src[i] > v : src[i] < v)
+        {
+            v = src[i];
+            *index = i;
+        }
+    }
+    *value = v;
+}
+
+ne10_result_t ne10_sum_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    *dst = ne10_reduce_kahan_neon (src, count, NE10_REDUCE_VALUE, 0.0f);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_minmax_float_neon (ne10_float32_t * min, ne10_float32_t * max, ne10_float32_t * src, ne10_uint32_t count)
+{
+    float32x4_t lo, hi;
+    float32x2_t lo2, hi2;
+    ne10_uint32_t i;
+
+    if (count < 4)
+        return ne10_minmax_float_c (min, max, src, count);
+
+    lo = hi = vld1q_f32 (src);
+    for (i = 4; i + 4 <= count; i += 4)
+    {
+        float32x4_t x = vld1q_f32 (src + i);
+        lo = vminq_f32 (lo, x);
+        hi = vmaxq_f32 (hi, x);
+    }
+    lo2 = vpmin_f32 (vget_low_f32 (lo), vget_high_f32 (lo));
+    hi2 = vpmax_f32 (vget_low_f32 (hi), vget_high_f32 (hi));
+    lo2 = vpmin_f32 (lo2, lo2);
+    hi2 = vpmax_f32 (hi2, hi2);
+    *min = vget_lane_f32 (lo2, 0);
+    *max = vget_lane_f32 (hi2, 0);
+
+    for (; i < count; i++)
+    {
+        if (src[i] < *min)
+            *min = src[i];
+        if (src[i] > *max)
+            *max = src[i];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_argmin_float_neon (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    if (count < 4)
+        return ne10_argmin_float_c (value, index, src, count);
+
+    ne10_reduce_arg_float_neon (value, index, src, count, 0);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_argmax_float_neon (ne10_float32_t * value, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    if (count < 4)
+        return ne10_argmax_float_c (value, index, src, count);
+
+    ne10_reduce_arg_float_neon (value, index, src, count, 1);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mean_var_float_neon (ne10_float32_t * mean, ne10_float32_t * var, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_float32_t m;
+
+    if (count == 0)
+        return NE10_ERR;
+
+    m = ne10_reduce_kahan_neon (src, count, NE10_REDUCE_VALUE, 0.0f) / count;
+    *var = ne10_reduce_kahan_neon (src, count, NE10_REDUCE_SQR, m) / count;
+    *mean = m;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_rms_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    if (count == 0)
+        return NE10_ERR;
+
+    *dst = sqrtf (ne10_reduce_kahan_neon (src, count, NE10_REDUCE_SQR, 0.0f) / count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_l1_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    *dst = ne10_reduce_kahan_neon (src, count, NE10_REDUCE_ABS, 0.0f);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_l2_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    *dst = sqrtf (ne10_reduce_kahan_neon (src, count, NE10_REDUCE_SQR, 0.0f));
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_linf_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    float32x4_t hi = vdupq_n_f32 (0.0f);
+    float32x2_t hi2;
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+        hi = vmaxq_f32 (hi, vabsq_f32 (vld1q_f32 (src + i)));
+    hi2 = vpmax_f32 (vget_low_f32 (hi), vget_high_f32 (hi));
+    hi2 = vpmax_f32 (hi2, hi2);
+    *dst = vget_lane_f32 (hi2, 0);
+
+    for (; i < count; i++)
+    {
+        if (fabsf (src[i]) > *dst)
+            *dst = fabsf (src[i]);
+    }
+    return NE10_OK;
+}
+
+/* running best of four int32 lanes and the index of its first occurrence */
+static inline void ne10_reduce_arg_int32_step_neon (int32x4_t x, uint32x4_t cur, int32x4_t * best, uint32x4_t * idx, ne10_int32_t is_max)
+{
+    uint32x4_t better = is_max ? vcgtq_s32 (x, *best) : vcltq_s32 (x, *best);
+
+    *best = vbslq_s32 (better, x, *best);
+    *idx = vbslq_u32 (better, cur, *idx);
+}
+
+/* best of the lane candidates; the lowest index wins ties */
+static inline ne10_int32_t ne10_reduce_arg_int32_pick (ne10_int32_t * lane_val, ne10_uint32_t * lane_idx, ne10_uint32_t lanes, ne10_uint32_t * index, ne10_int32_t is_max)
+{
+    ne10_int32_t v = lane_val[0];
+    ne10_uint32_t itr;
+
+    *index = lane_idx[0];
+    for (itr = 1; itr < lanes; itr++)
+    {
+        ne10_int32_t x = lane_val[itr];
+        if ( (is_max ? x > v : x < v) || (x == v && lane_idx[itr] < *index))
+        {
+            v = x;
+            *index = lane_idx[itr];
+        }
+    }
+    return v;
+}
+
+static inline void ne10_reduce_arg_int32_neon (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count, ne10_int32_t is_max)
+{
+    const ne10_uint32_t init_idx[4] = { 0, 1, 2, 3 };
+    int32x4_t best = vld1q_s32 (src);
+    uint32x4_t idx = vld1q_u32 (init_idx);
+    uint32x4_t cur = idx;
+    uint32x4_t step = vdupq_n_u32 (4);
+    ne10_int32_t lane_val[4];
+    ne10_uint32_t lane_idx[4];
+    ne10_int32_t v;
+    ne10_uint32_t i;
+
+    for (i = 4; i + 4 <= count; i += 4)
+    {
+        cur = vaddq_u32 (cur, step);
+        ne10_reduce_arg_int32_step_neon (vld1q_s32 (src + i), cur, &best, &idx, is_max);
+    }
+
+    vst1q_s32 (lane_val, best);
+    vst1q_u32 (lane_idx, idx);
+    v = ne10_reduce_arg_int32_pick (lane_val, lane_idx, 4, index, is_max);
+    for (; i < count; i++)
+    {
+        if (is_max ? src[i] > v : src[i] < v)
+        {
+            v = src[i];
+            *index = i;
+        }
+    }
+    *value = v;
+}
+
+/* Q15 lanes are widened so that the indices fit in 32-bit lanes */
+static inline void ne10_reduce_arg_int16_neon (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count, ne10_int32_t is_max)
+{
+    const ne10_uint32_t init_idx[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    int16x8_t x = vld1q_s16 (src);
+    int32x4_t best_lo = vmovl_s16 (vget_low_s16 (x));
+    int32x4_t best_hi = vmovl_s16 (vget_high_s16 (x));
+    uint32x4_t idx_lo = vld1q_u32 (init_idx);
+    uint32x4_t idx_hi = vld1q_u32 (init_idx + 4);
+    uint32x4_t cur_lo = idx_lo;
+    uint32x4_t cur_hi = idx_hi;
+    uint32x4_t step = vdupq_n_u32 (8);
+    ne10_int32_t lane_val[8];
+    ne10_uint32_t lane_idx[8];
+    ne10_int32_t v;
+    ne10_uint32_t i;
+
+    for (i = 8; i + 8 <= count; i += 8)
+    {
+        x = vld1q_s16 (src + i);
+        cur_lo = vaddq_u32 (cur_lo, step);
+        cur_hi = vaddq_u32 (cur_hi, step);
+        ne10_reduce_arg_int32_step_neon (vmovl_s16 (vget_low_s16 (x)), cur_lo, &best_lo, &idx_lo, is_max);
+        ne10_reduce_arg_int32_step_neon (vmovl_s16 (vget_high_s16 (x)), cur_hi, &best_hi, &idx_hi, is_max);
+    }
+
+    vst1q_s32 (lane_val, best_lo);
+    vst1q_s32 (lane_val + 4, best_hi);
+    vst1q_u32 (lane_idx, idx_lo);
+    vst1q_u32 (lane_idx + 4, idx_hi);
+    v = ne10_reduce_arg_int32_pick (lane_val, lane_idx, 8, index, is_max);
+    for (; i < count; i++)
+    {
+        if (is_max ? src[i] > v : src[i] < v)
+        {
+            v = src[i];
+            *index = i;
+        }
+    }
+    *value = (ne10_int16_t) v;
+}
+
+ne10_result_t ne10_sum_int32_neon (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count)
+{
+    int64x2_t acc = vdupq_n_s64 (0);
+    ne10_int64_t sum;
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+        acc = vpadalq_s32 (acc, vld1q_s32 (src + i));
+    sum = vgetq_lane_s64 (acc, 0) + vgetq_lane_s64 (acc, 1);
+
+    for (; i < count; i++)
+        sum += src[i];
+    *dst = sum;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sum_int16_neon (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count)
+{
+    int64x2_t acc = vdupq_n_s64 (0);
+    ne10_int64_t sum;
+    ne10_uint32_t i = 0;
+    ne10_uint32_t block;
+
+    while (i + 8 <= count)
+    {
+        int32x4_t acc32 = vdupq_n_s32 (0);
+
+        for (block = 0; block < NE10_REDUCE_INT16_BLOCK && i + 8 <= count; block++, i += 8)
+            acc32 = vpadalq_s16 (acc32, vld1q_s16 (src + i));
+        acc = vpadalq_s32 (acc, acc32);
+    }
+    sum = vgetq_lane_s64 (acc, 0) + vgetq_lane_s64 (acc, 1);
+
+    for (; i < count; i++)
+        sum += src[i];
+    *dst = sum;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_minmax_int32_neon (ne10_int32_t * min, ne10_int32_t * max, ne10_int32_t * src, ne10_uint32_t count)
+{
+    int32x4_t lo, hi;
+    int32x2_t lo2, hi2;
+    ne10_uint32_t i;
+
+    if (count < 4)
+        return ne10_minmax_int32_c (min, max, src, count);
+
+    lo = hi = vld1q_s32 (src);
+    for (i = 4; i + 4 <= count; i += 4)
+    {
+        int32x4_t x = vld1q_s32 (src + i);
+        lo = vminq_s32 (lo, x);
+        hi = vmaxq_s32 (hi, x);
+    }
+    lo2 = vpmin_s32 (vget_low_s32 (lo), vget_high_s32 (lo));
+    hi2 = vpmax_s32 (vget_low_s32 (hi), vget_high_s32 (hi));
+    lo2 = vpmin_s32 (lo2, lo2);
+    hi2 = vpmax_s32 (hi2, hi2);
+    *min = vget_lane_s32 (lo2, 0);
+    *max = vget_lane_s32 (hi2, 0);
+
+    for (; i < count; i++)
+    {
+        if (src[i] < *min)
+            *min = src[i];
+        if (src[i] > *max)
+            *max = src[i];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_minmax_int16_neon (ne10_int16_t * min, ne10_int16_t * max, ne10_int16_t * src, ne10_uint32_t count)
+{
+    int16x8_t lo, hi;
+    int16x4_t lo4, hi4;
+    ne10_uint32_t i;
+
+    if (count < 8)
+        return ne10_minmax_int16_c (min, max, src, count);
+
+    lo = hi = vld1q_s16 (src);
+    for (i = 8; i + 8 <= count; i += 8)
+    {
+        int16x8_t x = vld1q_s16 (src + i);
+        lo = vminq_s16 (lo, x);
+        hi = vmaxq_s16 (hi, x);
+    }
+    lo4 = vpmin_s16 (vget_low_s16 (lo), vget_high_s16 (lo));
+    hi4 = vpmax_s16 (vget_low_s16 (hi), vget_high_s16 (hi));
+    lo4 = vpmin_s16 (lo4, lo4);
+    hi4 = vpmax_s16 (hi4, hi4);
+    lo4 = vpmin_s16 (lo4, lo4);
+    hi4 = vpmax_s16 (hi4, hi4);
+    *min = vget_lane_s16 (lo4, 0);
+    *max = vget_lane_s16 (hi4, 0);
+
+    for (; i < count; i++)
+    {
+        if (src[i] < *min)
+            *min = src[i];
+        if (src[i] > *max)
+            *max = src[i];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_argmin_int32_neon (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count)
+{
+    if (count < 4)
+        return ne10_argmin_int32_c (value, index, src, count);
+
+    ne10_reduce_arg_int32_neon (value, index, src, count, 0);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_argmax_int32_neon (ne10_int32_t * value, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count)
+{
+    if (count < 4)
+        return ne10_argmax_int32_c (value, index, src, count);
+
+    ne10_reduce_arg_int32_neon (value, index, src, count, 1);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_argmin_int16_neon (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count)
+{
+    if (count < 8)
+        return ne10_argmin_int16_c (value, index, src, count);
+
+    ne10_reduce_arg_int16_neon (value, index, src, count, 0);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_argmax_int16_neon (ne10_int16_t * value, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count)
+{
+    if (count < 8)
+        return ne10_argmax_int16_c (value, index, src, count);
+
+    ne10_reduce_arg_int16_neon (value, index, src, count, 1);
+    return NE10_OK;
+}
+
+/* VABS leaves -2^31 unchanged, which is its magnitude when read as unsigned */
+ne10_result_t ne10_norm_l1_int32_neon (ne10_uint64_t * dst, ne10_int32_t * src, ne10_uint32_t count)
+{
+    uint64x2_t acc = vdupq_n_u64 (0);
+    ne10_uint64_t sum;
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+        acc = vpadalq_u32 (acc, vreinterpretq_u32_s32 (vabsq_s32 (vld1q_s32 (src + i))));
+    sum = vgetq_lane_u64 (acc, 0) + vgetq_lane_u64 (acc, 1);
+
+    for (; i < count; i++)
+        sum += (src[i] < 0) ? 0u - (ne10_uint32_t) src[i] : (ne10_uint32_t) src[i];
+    *dst = sum;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_l1_int16_neon (ne10_uint64_t * dst, ne10_int16_t * src, ne10_uint32_t count)
+{
+    uint64x2_t acc = vdupq_n_u64 (0);
+    ne10_uint64_t sum;
+    ne10_uint32_t i = 0;
+    ne10_uint32_t block;
+
+    while (i + 8 <= count)
+    {
+        uint32x4_t acc32 = vdupq_n_u32 (0);
+
+        for (block = 0; block < NE10_REDUCE_INT16_BLOCK && i + 8 <= count; block++, i += 8)
+            acc32 = vpadalq_u16 (acc32, vreinterpretq_u16_s16 (vabsq_s16 (vld1q_s16 (src + i))));
+        acc = vpadalq_u32 (acc, acc32);
+    }
+    sum = vgetq_lane_u64 (acc, 0) + vgetq_lane_u64 (acc, 1);
+
+    for (; i < count; i++)
+        sum += (src[i] < 0) ? (ne10_uint32_t) (- (ne10_int32_t) src[i]) : (ne10_uint32_t) src[i];
+    *dst = sum;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_linf_int32_neon (ne10_uint32_t * dst, ne10_int32_t * src, ne10_uint32_t count)
+{
+    uint32x4_t hi = vdupq_n_u32 (0);
+    uint32x2_t hi2;
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+        hi = vmaxq_u32 (hi, vreinterpretq_u32_s32 (vabsq_s32 (vld1q_s32 (src + i))));
+    hi2 = vpmax_u32 (vget_low_u32 (hi), vget_high_u32 (hi));
+    hi2 = vpmax_u32 (hi2, hi2);
+    *dst = vget_lane_u32 (hi2, 0);
+
+    for (; i < count; i++)
+    {
+        ne10_uint32_t a = (src[i] < 0) ? 0u - (ne10_uint32_t) src[i] : (ne10_uint32_t) src[i];
+        if (a > *dst)
+            *dst = a;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm_linf_int16_neon (ne10_uint32_t * dst, ne10_int16_t * src, ne10_uint32_t count)
+{
+    uint16x8_t hi = vdupq_n_u16 (0);
+    uint16x4_t hi4;
+    ne10_uint32_t i;
+
+    for (i = 0; i + 8 <= count; i += 8)
+        hi = vmaxq_u16 (hi, vreinterpretq_u16_s16 (vabsq_s16 (vld1q_s16 (src + i))));
+    hi4 = vpmax_u16 (vget_low_u16 (hi), vget_high_u16 (hi));
+    hi4 = vpmax_u16 (hi4, hi4);
+    hi4 = vpmax_u16 (hi4, hi4);
+    *dst = vget_lane_u16 (hi4, 0);
+
+    for (; i < count; i++)
+    {
+        ne10_uint32_t a = (src[i] < 0) ? (ne10_uint32_t) (- (ne10_int32_t) src[i]) : (ne10_uint32_t) src[i];
+        if (a > *dst)
+            *dst = a;
+    }
+    return NE10_OK;
+}
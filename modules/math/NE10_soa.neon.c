@@ -0,0 +1,510 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_soa.neon.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_transcendental.neon.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+/* The vectors of a set from index offset onwards, for handing leftovers to the C version. */
+static inline ne10_vec2f_soa_t ne10_vec2f_soa_from (const ne10_vec2f_soa_t * s, ne10_uint32_t offset)
+{
+    ne10_vec2f_soa_t r = { s->x + offset, s->y + offset };
+    return r;
+}
+
+static inline ne10_vec3f_soa_t ne10_vec3f_soa_from (const ne10_vec3f_soa_t * s, ne10_uint32_t offset)
+{
+    ne10_vec3f_soa_t r = { s->x + offset, s->y + offset, s->z + offset };
+    return r;
+}
+
+static inline ne10_vec4f_soa_t ne10_vec4f_soa_from (const ne10_vec4f_soa_t * s, ne10_uint32_t offset)
+{
+    ne10_vec4f_soa_t r = { s->x + offset, s->y + offset, s->z + offset, s->w + offset };
+    return r;
+}
+
+/*
+ * Each component array is already contiguous, so the element-wise operations
+ * are the float versions applied to one component at a time.
+ */
+ne10_result_t ne10_add_vec2f_soa_neon (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count)
+{
+    assert (dst && src1 && src2);
+    ne10_add_float_neon (dst->x, src1->x, src2->x, count);
+    ne10_add_float_neon (dst->y, src1->y, src2->y, count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_add_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count)
+{
+    assert (dst && src1 && src2);
+    ne10_add_float_neon (dst->x, src1->x, src2->x, count);
+    ne10_add_float_neon (dst->y, src1->y, src2->y, count);
+    ne10_add_float_neon (dst->z, src1->z, src2->z, count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_add_vec4f_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count)
+{
+    assert (dst && src1 && src2);
+    ne10_add_float_neon (dst->x, src1->x, src2->x, count);
+    ne10_add_float_neon (dst->y, src1->y, src2->y, count);
+    ne10_add_float_neon (dst->z, src1->z, src2->z, count);
+    ne10_add_float_neon (dst->w, src1->w, src2->w, count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sub_vec2f_soa_neon (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count)
+{
+    assert (dst && src1 && src2);
+    ne10_sub_float_neon (dst->x, src1->x, src2->x, count);
+    ne10_sub_float_neon (dst->y, src1->y, src2->y, count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sub_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count)
+{
+    assert (dst && src1 && src2);
+    ne10_sub_float_neon (dst->x, src1->x, src2->x, count);
+    ne10_sub_float_neon (dst->y, src1->y, src2->y, count);
+    ne10_sub_float_neon (dst->z, src1->z, src2->z, count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sub_vec4f_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count)
+{
+    assert (dst && src1 && src2);
+    ne10_sub_float_neon (dst->x, src1->x, src2->x, count);
+    ne10_sub_float_neon (dst->y, src1->y, src2->y, count);
+    ne10_sub_float_neon (dst->z, src1->z, src2->z, count);
+    ne10_sub_float_neon (dst->w, src1->w, src2->w, count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_vmul_vec2f_soa_neon (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count)
+{
+    assert (dst && src1 && src2);
+    ne10_mul_float_neon (dst->x, src1->x, src2->x, count);
+    ne10_mul_float_neon (dst->y, src1->y, src2->y, count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_vmul_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count)
+{
+    assert (dst && src1 && src2);
+    ne10_mul_float_neon (dst->x, src1->x, src2->x, count);
+    ne10_mul_float_neon (dst->y, src1->y, src2->y, count);
+    ne10_mul_float_neon (dst->z, src1->z, src2->z, count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_vmul_vec4f_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count)
+{
+    assert (dst && src1 && src2);
+    ne10_mul_float_neon (dst->x, src1->x, src2->x, count);
+    ne10_mul_float_neon (dst->y, src1->y, src2->y, count);
+    ne10_mul_float_neon (dst->z, src1->z, src2->z, count);
+    ne10_mul_float_neon (dst->w, src1->w, src2->w, count);
+    return NE10_OK;
+}
+
+/*
+ * Four vectors per iteration with one plain load per component, evaluated in
+ * the same order as the C version. Leftover vectors go through the C version.
+ */
+ne10_result_t ne10_dot_vec2f_soa_neon (ne10_float32_t * dst, ne10_vec2f_soa_t * src1, ne10_vec2f_soa_t * src2, ne10_uint32_t count)
+{
+    float32x4_t n_ax, n_ay;
+    float32x4_t n_bx, n_by;
+    float32x4_t n_dot;
+    ne10_uint32_t i = 0;
+    ne10_vec2f_soa_t s1, s2;
+
+    assert (dst && src1 && src2);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_ax = vld1q_f32 (src1->x + i);
+        n_ay = vld1q_f32 (src1->y + i);
+        n_bx = vld1q_f32 (src2->x + i);
+        n_by = vld1q_f32 (src2->y + i);
+        n_dot = vmulq_f32 (n_ax, n_bx);
+        n_dot = vmlaq_f32 (n_dot, n_ay, n_by);
+        vst1q_f32 (dst + i, n_dot);
+    }
+    s1 = ne10_vec2f_soa_from (src1, i);
+    s2 = ne10_vec2f_soa_from (src2, i);
+    return ne10_dot_vec2f_soa_c (dst + i, &s1, &s2, count - i);
+}
+
+ne10_result_t ne10_dot_vec3f_soa_neon (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count)
+{
+    float32x4_t n_ax, n_ay, n_az;
+    float32x4_t n_bx, n_by, n_bz;
+    float32x4_t n_dot;
+    ne10_uint32_t i = 0;
+    ne10_vec3f_soa_t s1, s2;
+
+    assert (dst && src1 && src2);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_ax = vld1q_f32 (src1->x + i);
+        n_ay = vld1q_f32 (src1->y + i);
+        n_az = vld1q_f32 (src1->z + i);
+        n_bx = vld1q_f32 (src2->x + i);
+        n_by = vld1q_f32 (src2->y + i);
+        n_bz = vld1q_f32 (src2->z + i);
+        n_dot = vmulq_f32 (n_ax, n_bx);
+        n_dot = vmlaq_f32 (n_dot, n_ay, n_by);
+        n_dot = vmlaq_f32 (n_dot, n_az, n_bz);
+        vst1q_f32 (dst + i, n_dot);
+    }
+    s1 = ne10_vec3f_soa_from (src1, i);
+    s2 = ne10_vec3f_soa_from (src2, i);
+    return ne10_dot_vec3f_soa_c (dst + i, &s1, &s2, count - i);
+}
+
+ne10_result_t ne10_dot_vec4f_soa_neon (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count)
+{
+    float32x4_t n_ax, n_ay, n_az, n_aw;
+    float32x4_t n_bx, n_by, n_bz, n_bw;
+    float32x4_t n_dot;
+    ne10_uint32_t i = 0;
+    ne10_vec4f_soa_t s1, s2;
+
+    assert (dst && src1 && src2);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_ax = vld1q_f32 (src1->x + i);
+        n_ay = vld1q_f32 (src1->y + i);
+        n_az = vld1q_f32 (src1->z + i);
+        n_aw = vld1q_f32 (src1->w + i);
+        n_bx = vld1q_f32 (src2->x + i);
+        n_by = vld1q_f32 (src2->y + i);
+        n_bz = vld1q_f32 (src2->z + i);
+        n_bw = vld1q_f32 (src2->w + i);
+        n_dot = vmulq_f32 (n_ax, n_bx);
+        n_dot = vmlaq_f32 (n_dot, n_ay, n_by);
+        n_dot = vmlaq_f32 (n_dot, n_az, n_bz);
+        n_dot = vmlaq_f32 (n_dot, n_aw, n_bw);
+        vst1q_f32 (dst + i, n_dot);
+    }
+    s1 = ne10_vec4f_soa_from (src1, i);
+    s2 = ne10_vec4f_soa_from (src2, i);
+    return ne10_dot_vec4f_soa_c (dst + i, &s1, &s2, count - i);
+}
+
+ne10_result_t ne10_cross_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count)
+{
+    float32x4_t n_ax, n_ay, n_az;
+    float32x4_t n_bx, n_by, n_bz;
+    ne10_uint32_t i = 0;
+    ne10_vec3f_soa_t d, s1, s2;
+
+    assert (dst && src1 && src2);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_ax = vld1q_f32 (src1->x + i);
+        n_ay = vld1q_f32 (src1->y + i);
+        n_az = vld1q_f32 (src1->z + i);
+        n_bx = vld1q_f32 (src2->x + i);
+        n_by = vld1q_f32 (src2->y + i);
+        n_bz = vld1q_f32 (src2->z + i);
+        vst1q_f32 (dst->x + i, vmlsq_f32 (vmulq_f32 (n_ay, n_bz), n_az, n_by));
+        vst1q_f32 (dst->y + i, vmlsq_f32 (vmulq_f32 (n_az, n_bx), n_ax, n_bz));
+        vst1q_f32 (dst->z + i, vmlsq_f32 (vmulq_f32 (n_ax, n_by), n_ay, n_bx));
+    }
+    d = ne10_vec3f_soa_from (dst, i);
+    s1 = ne10_vec3f_soa_from (src1, i);
+    s2 = ne10_vec3f_soa_from (src2, i);
+    return ne10_cross_vec3f_soa_c (&d, &s1, &s2, count - i);
+}
+
+ne10_result_t ne10_len_vec2f_soa_neon (ne10_float32_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count)
+{
+    float32x4_t n_x, n_y;
+    float32x4_t n_sq;
+    ne10_uint32_t i = 0;
+    ne10_vec2f_soa_t s;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_x = vld1q_f32 (src->x + i);
+        n_y = vld1q_f32 (src->y + i);
+        n_sq = vmulq_f32 (n_x, n_x);
+        n_sq = vmlaq_f32 (n_sq, n_y, n_y);
+        vst1q_f32 (dst + i, ne10_sqrt_kernel_neon (n_sq));
+    }
+    s = ne10_vec2f_soa_from (src, i);
+    return ne10_len_vec2f_soa_c (dst + i, &s, count - i);
+}
+
+ne10_result_t ne10_len_vec3f_soa_neon (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    float32x4_t n_x, n_y, n_z;
+    float32x4_t n_sq;
+    ne10_uint32_t i = 0;
+    ne10_vec3f_soa_t s;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_x = vld1q_f32 (src->x + i);
+        n_y = vld1q_f32 (src->y + i);
+        n_z = vld1q_f32 (src->z + i);
+        n_sq = vmulq_f32 (n_x, n_x);
+        n_sq = vmlaq_f32 (n_sq, n_y, n_y);
+        n_sq = vmlaq_f32 (n_sq, n_z, n_z);
+        vst1q_f32 (dst + i, ne10_sqrt_kernel_neon (n_sq));
+    }
+    s = ne10_vec3f_soa_from (src, i);
+    return ne10_len_vec3f_soa_c (dst + i, &s, count - i);
+}
+
+ne10_result_t ne10_len_vec4f_soa_neon (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count)
+{
+    float32x4_t n_x, n_y, n_z, n_w;
+    float32x4_t n_sq;
+    ne10_uint32_t i = 0;
+    ne10_vec4f_soa_t s;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_x = vld1q_f32 (src->x + i);
+        n_y = vld1q_f32 (src->y + i);
+        n_z = vld1q_f32 (src->z + i);
+        n_w = vld1q_f32 (src->w + i);
+        n_sq = vmulq_f32 (n_x, n_x);
+        n_sq = vmlaq_f32 (n_sq, n_y, n_y);
+        n_sq = vmlaq_f32 (n_sq, n_z, n_z);
+        n_sq = vmlaq_f32 (n_sq, n_w, n_w);
+        vst1q_f32 (dst + i, ne10_sqrt_kernel_neon (n_sq));
+    }
+    s = ne10_vec4f_soa_from (src, i);
+    return ne10_len_vec4f_soa_c (dst + i, &s, count - i);
+}
+
+/* Each component is divided by the length, as in the C version. */
+ne10_result_t ne10_normalize_vec2f_soa_neon (ne10_vec2f_soa_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count)
+{
+    float32x4_t n_x, n_y;
+    float32x4_t n_len;
+    ne10_uint32_t i = 0;
+    ne10_vec2f_soa_t d, s;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_x = vld1q_f32 (src->x + i);
+        n_y = vld1q_f32 (src->y + i);
+        n_len = vmulq_f32 (n_x, n_x);
+        n_len = vmlaq_f32 (n_len, n_y, n_y);
+        n_len = ne10_sqrt_kernel_neon (n_len);
+        vst1q_f32 (dst->x + i, ne10_div_kernel_neon (n_x, n_len));
+        vst1q_f32 (dst->y + i, ne10_div_kernel_neon (n_y, n_len));
+    }
+    d = ne10_vec2f_soa_from (dst, i);
+    s = ne10_vec2f_soa_from (src, i);
+    return ne10_normalize_vec2f_soa_c (&d, &s, count - i);
+}
+
+ne10_result_t ne10_normalize_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    float32x4_t n_x, n_y, n_z;
+    float32x4_t n_len;
+    ne10_uint32_t i = 0;
+    ne10_vec3f_soa_t d, s;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_x = vld1q_f32 (src->x + i);
+        n_y = vld1q_f32 (src->y + i);
+        n_z = vld1q_f32 (src->z + i);
+        n_len = vmulq_f32 (n_x, n_x);
+        n_len = vmlaq_f32 (n_len, n_y, n_y);
+        n_len = vmlaq_f32 (n_len, n_z, n_z);
+        n_len = ne10_sqrt_kernel_neon (n_len);
+        vst1q_f32 (dst->x + i, ne10_div_kernel_neon (n_x, n_len));
+        vst1q_f32 (dst->y + i, ne10_div_kernel_neon (n_y, n_len));
+        vst1q_f32 (dst->z + i, ne10_div_kernel_neon (n_z, n_len));
+    }
+    d = ne10_vec3f_soa_from (dst, i);
+    s = ne10_vec3f_soa_from (src, i);
+    return ne10_normalize_vec3f_soa_c (&d, &s, count - i);
+}
+
+ne10_result_t ne10_normalize_vec4f_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count)
+{
+    float32x4_t n_x, n_y, n_z, n_w;
+    float32x4_t n_len;
+    ne10_uint32_t i = 0;
+    ne10_vec4f_soa_t d, s;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_x = vld1q_f32 (src->x + i);
+        n_y = vld1q_f32 (src->y + i);
+        n_z = vld1q_f32 (src->z + i);
+        n_w = vld1q_f32 (src->w + i);
+        n_len = vmulq_f32 (n_x, n_x);
+        n_len = vmlaq_f32 (n_len, n_y, n_y);
+        n_len = vmlaq_f32 (n_len, n_z, n_z);
+        n_len = vmlaq_f32 (n_len, n_w, n_w);
+        n_len = ne10_sqrt_kernel_neon (n_len);
+        vst1q_f32 (dst->x + i, ne10_div_kernel_neon (n_x, n_len));
+        vst1q_f32 (dst->y + i, ne10_div_kernel_neon (n_y, n_len));
+        vst1q_f32 (dst->z + i, ne10_div_kernel_neon (n_z, n_len));
+        vst1q_f32 (dst->w + i, ne10_div_kernel_neon (n_w, n_len));
+    }
+    d = ne10_vec4f_soa_from (dst, i);
+    s = ne10_vec4f_soa_from (src, i);
+    return ne10_normalize_vec4f_soa_c (&d, &s, count - i);
+}
+
+/*
+ * The conversions de-interleave (or interleave) four vectors per structured
+ * load (or store), so each component lands in its own register.
+ */
+ne10_result_t ne10_vec2f_aos_to_soa_neon (ne10_vec2f_soa_t * dst, ne10_vec2f_t * src, ne10_uint32_t count)
+{
+    float32x4x2_t n_v;
+    ne10_uint32_t i = 0;
+    ne10_vec2f_soa_t d;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_v = vld2q_f32 ( (ne10_float32_t*) (src + i));
+        vst1q_f32 (dst->x + i, n_v.val[0]);
+        vst1q_f32 (dst->y + i, n_v.val[1]);
+    }
+    d = ne10_vec2f_soa_from (dst, i);
+    return ne10_vec2f_aos_to_soa_c (&d, src + i, count - i);
+}
+
+ne10_result_t ne10_vec2f_soa_to_aos_neon (ne10_vec2f_t * dst, ne10_vec2f_soa_t * src, ne10_uint32_t count)
+{
+    float32x4x2_t n_v;
+    ne10_uint32_t i = 0;
+    ne10_vec2f_soa_t s;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_v.val[0] = vld1q_f32 (src->x + i);
+        n_v.val[1] = vld1q_f32 (src->y + i);
+        vst2q_f32 ( (ne10_float32_t*) (dst + i), n_v);
+    }
+    s = ne10_vec2f_soa_from (src, i);
+    return ne10_vec2f_soa_to_aos_c (dst + i, &s, count - i);
+}
+
+ne10_result_t ne10_vec3f_aos_to_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    float32x4x3_t n_v;
+    ne10_uint32_t i = 0;
+    ne10_vec3f_soa_t d;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_v = vld3q_f32 ( (ne10_float32_t*) (src + i));
+        vst1q_f32 (dst->x + i, n_v.val[0]);
+        vst1q_f32 (dst->y + i, n_v.val[1]);
+        vst1q_f32 (dst->z + i, n_v.val[2]);
+    }
+    d = ne10_vec3f_soa_from (dst, i);
+    return ne10_vec3f_aos_to_soa_c (&d, src + i, count - i);
+}
+
+ne10_result_t ne10_vec3f_soa_to_aos_neon (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    float32x4x3_t n_v;
+    ne10_uint32_t i = 0;
+    ne10_vec3f_soa_t s;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_v.val[0] = vld1q_f32 (src->x + i);
+        n_v.val[1] = vld1q_f32 (src->y + i);
+        n_v.val[2] = vld1q_f32 (src->z + i);
+        vst3q_f32 ( (ne10_float32_t*) (dst + i), n_v);
+    }
+    s = ne10_vec3f_soa_from (src, i);
+    return ne10_vec3f_soa_to_aos_c (dst + i, &s, count - i);
+}
+
+ne10_result_t ne10_vec4f_aos_to_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count)
+{
+    float32x4x4_t n_v;
+    ne10_uint32_t i = 0;
+    ne10_vec4f_soa_t d;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_v = vld4q_f32 ( (ne10_float32_t*) (src + i));
+        vst1q_f32 (dst->x + i, n_v.val[0]);
+        vst1q_f32 (dst->y + i, n_v.val[1]);
+        vst1q_f32 (dst->z + i, n_v.val[2]);
+        vst1q_f32 (dst->w + i, n_v.val[3]);
+    }
+    d = ne10_vec4f_soa_from (dst, i);
+    return ne10_vec4f_aos_to_soa_c (&d, src + i, count - i);
+}
+
+ne10_result_t ne10_vec4f_soa_to_aos_neon (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count)
+{
+    float32x4x4_t n_v;
+    ne10_uint32_t i = 0;
+    ne10_vec4f_soa_t s;
+
+    assert (dst && src);
+    for (; i + 4 <= count; i += 4)
+    {
+        n_v.val[0] = vld1q_f32 (src->x + i);
+        n_v.val[1] = vld1q_f32 (src->y + i);
+        n_v.val[2] = vld1q_f32 (src->z + i);
+        n_v.val[3] = vld1q_f32 (src->w + i);
+        vst4q_f32 ( (ne10_float32_t*) (dst + i), n_v);
+    }
+    s = ne10_vec4f_soa_from (src, i);
+    return ne10_vec4f_soa_to_aos_c (dst + i, &s, count - i);
+}
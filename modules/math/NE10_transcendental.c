@@ -0,0 +1,149 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_transcendental.c
+ */
+
+#include "NE10_types.h"
+#include "macros.h"
+
+#include <assert.h>
+
+#include <math.h>
+
+/*
+ * The C versions call the C library, so they also serve as the reference for
+ * the NEON approximations. The fast variants have no cheaper C counterpart.
+ */
+
+ne10_result_t ne10_exp_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = expf (src[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_exp_fast_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    return ne10_exp_float_c (dst, src, count);
+}
+
+ne10_result_t ne10_log_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = logf (src[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_log_fast_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    return ne10_log_float_c (dst, src, count);
+}
+
+ne10_result_t ne10_pow_float_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = powf (src1[ itr ], src2[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sin_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = sinf (src[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cos_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = cosf (src[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sincos_float_c (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_3POINTER (dst_sin, dst_cos, src);
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        ne10_float32_t x = src[ itr ];
+        dst_sin[ itr ] = sinf (x);
+        dst_cos[ itr ] = cosf (x);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_tanh_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = tanhf (src[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sqrt_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = sqrtf (src[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_rsqrt_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = 1.0f / sqrtf (src[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_rsqrt_fast_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    return ne10_rsqrt_float_c (dst, src, count);
+}
@@ -0,0 +1,184 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_transcendental.neon.c
+ */
+
+#include "NE10_types.h"
+#include "macros.h"
+#include "NE10_transcendental.neon.h"
+
+#include <assert.h>
+#include <arm_neon.h>
+
+/*
+ * Four lanes per iteration; the tail goes through a padded four-lane buffer
+ * so that every element sees the same approximation.
+ */
+#define NE10_TRANSCENDENTAL_DST_SRC_NEON(KERNEL) \
+    { \
+        ne10_float32_t rest[4] = { 1.0f, 1.0f, 1.0f, 1.0f }; \
+        ne10_uint32_t itr; \
+        NE10_CHECKPOINTER_DstSrc; \
+        for (; count >= 4; count -= 4, src += 4, dst += 4) \
+        { \
+            vst1q_f32 (dst, KERNEL (vld1q_f32 (src))); \
+        } \
+        if (count > 0) \
+        { \
+            for (itr = 0; itr < count; itr++) \
+                rest[itr] = src[itr]; \
+            vst1q_f32 (rest, KERNEL (vld1q_f32 (rest))); \
+            for (itr = 0; itr < count; itr++) \
+                dst[itr] = rest[itr]; \
+        } \
+        return NE10_OK; \
+    }
+
+static inline float32x4_t ne10_sin_kernel_neon (float32x4_t x)
+{
+    float32x4_t s, c;
+    ne10_sincos_kernel_neon (x, &s, &c);
+    return s;
+}
+
+static inline float32x4_t ne10_cos_kernel_neon (float32x4_t x)
+{
+    float32x4_t s, c;
+    ne10_sincos_kernel_neon (x, &s, &c);
+    return c;
+}
+
+/*
+ * x^y as exp(y * log|x|). A negative base gives a negative result for odd
+ * integer y and NaN for non-integer y; y == 0 gives 1 for every x. Floats of
+ * magnitude 2^24 and above are all even integers.
+ */
+static inline float32x4_t ne10_pow_kernel_neon (float32x4_t x, float32x4_t y)
+{
+    float32x4_t r = ne10_exp_kernel_neon (vmulq_f32 (y, ne10_log_kernel_neon (vabsq_f32 (x))));
+    int32x4_t yi = vcvtq_s32_f32 (y);
+    uint32x4_t is_int = vceqq_f32 (vcvtq_f32_s32 (yi), y);
+    uint32x4_t odd = vtstq_u32 (vreinterpretq_u32_s32 (yi), vdupq_n_u32 (1));
+    uint32x4_t neg = vcltq_f32 (x, vdupq_n_f32 (0.0f));
+
+    odd = vandq_u32 (vandq_u32 (odd, is_int), vcltq_f32 (vabsq_f32 (y), vdupq_n_f32 (16777216.0f)));
+    r = vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (r),
+                                          vandq_u32 (vandq_u32 (neg, odd), vdupq_n_u32 (0x80000000))));
+    r = vbslq_f32 (vbicq_u32 (neg, is_int), vdupq_n_f32 (NAN), r);
+    return vbslq_f32 (vceqq_f32 (y, vdupq_n_f32 (0.0f)), vdupq_n_f32 (1.0f), r);
+}
+
+ne10_result_t ne10_exp_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+NE10_TRANSCENDENTAL_DST_SRC_NEON (ne10_exp_kernel_neon)
+
+ne10_result_t ne10_exp_fast_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+NE10_TRANSCENDENTAL_DST_SRC_NEON (ne10_exp_fast_kernel_neon)
+
+ne10_result_t ne10_log_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+NE10_TRANSCENDENTAL_DST_SRC_NEON (ne10_log_kernel_neon)
+
+ne10_result_t ne10_log_fast_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+NE10_TRANSCENDENTAL_DST_SRC_NEON (ne10_log_fast_kernel_neon)
+
+ne10_result_t ne10_sin_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+NE10_TRANSCENDENTAL_DST_SRC_NEON (ne10_sin_kernel_neon)
+
+ne10_result_t ne10_cos_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+NE10_TRANSCENDENTAL_DST_SRC_NEON (ne10_cos_kernel_neon)
+
+ne10_result_t ne10_tanh_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+NE10_TRANSCENDENTAL_DST_SRC_NEON (ne10_tanh_kernel_neon)
+
+ne10_result_t ne10_sqrt_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+NE10_TRANSCENDENTAL_DST_SRC_NEON (ne10_sqrt_kernel_neon)
+
+ne10_result_t ne10_rsqrt_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+NE10_TRANSCENDENTAL_DST_SRC_NEON (ne10_rsqrt_kernel_neon)
+
+ne10_result_t ne10_rsqrt_fast_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+NE10_TRANSCENDENTAL_DST_SRC_NEON (ne10_rsqrt_fast_kernel_neon)
+
+ne10_result_t ne10_sincos_float_neon (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_float32_t rest[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    ne10_float32_t rest_cos[4];
+    float32x4_t s, c;
+    ne10_uint32_t itr;
+
+    NE10_CHECKPOINTER_3POINTER (dst_sin, dst_cos, src);
+
+    for (; count >= 4; count -= 4, src += 4, dst_sin += 4, dst_cos += 4)
+    {
+        ne10_sincos_kernel_neon (vld1q_f32 (src), &s, &c);
+        vst1q_f32 (dst_sin, s);
+        vst1q_f32 (dst_cos, c);
+    }
+
+    if (count > 0)
+    {
+        for (itr = 0; itr < count; itr++)
+            rest[itr] = src[itr];
+        ne10_sincos_kernel_neon (vld1q_f32 (rest), &s, &c);
+        vst1q_f32 (rest, s);
+        vst1q_f32 (rest_cos, c);
+        for (itr = 0; itr < count; itr++)
+        {
+            dst_sin[itr] = rest[itr];
+            dst_cos[itr] = rest_cos[itr];
+        }
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_pow_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_float32_t rest1[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    ne10_float32_t rest2[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    ne10_uint32_t itr;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+
+    for (; count >= 4; count -= 4, src1 += 4, src2 += 4, dst += 4)
+    {
+        vst1q_f32 (dst, ne10_pow_kernel_neon (vld1q_f32 (src1), vld1q_f32 (src2)));
+    }
+
+    if (count > 0)
+    {
+        for (itr = 0; itr < count; itr++)
+        {
+            rest1[itr] = src1[itr];
+            rest2[itr] = src2[itr];
+        }
+        vst1q_f32 (rest1, ne10_pow_kernel_neon (vld1q_f32 (rest1), vld1q_f32 (rest2)));
+        for (itr = 0; itr < count; itr++)
+            dst[itr] = rest1[itr];
+    }
+    return NE10_OK;
+}
@@ -0,0 +1,382 @@
+/*
+ *  Copyright 2011-16 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_transcendental.neon.h
+ */
+
+/*
+ * Four-lane single precision kernels shared by the NEON versions of the
+ * transcendental and complex vector functions. The polynomials follow the
+ * Cephes single precision library unless noted otherwise.
+ */
+
+#ifndef __NE10_TRANSCENDENTAL_NEON_H__
+#define __NE10_TRANSCENDENTAL_NEON_H__
+
+#include "NE10_types.h"
+
+#include <math.h>
+#include <arm_neon.h>
+
+#define NE10_LOG2E           1.44269504088896341f
+#define NE10_LN2_HI          0.693359375f
+#define NE10_LN2_LO         -2.12194440e-4f
+#define NE10_SQRTHF          0.707106781186547524f
+
+/* exp: the input range that still reaches a finite, non-zero result is handled by the 2^n scaling */
+#define NE10_EXP_MAX         89.0f
+#define NE10_EXP_MIN        -104.0f
+#define NE10_EXP_P0          1.9875691500e-4f
+#define NE10_EXP_P1          1.3981999507e-3f
+#define NE10_EXP_P2          8.3334519073e-3f
+#define NE10_EXP_P3          4.1665795894e-2f
+#define NE10_EXP_P4          1.6666665459e-1f
+#define NE10_EXP_P5          5.0000001201e-1f
+/* near-minimax fit of (e^r - 1 - r) / r^2 on [-ln2/2, ln2/2] */
+#define NE10_EXP_FAST_P0     4.12776985e-2f
+#define NE10_EXP_FAST_P1     1.67535157e-1f
+#define NE10_EXP_FAST_P2     5.00051166e-1f
+
+#define NE10_LOG_P0          7.0376836292e-2f
+#define NE10_LOG_P1         -1.1514610310e-1f
+#define NE10_LOG_P2          1.1676998740e-1f
+#define NE10_LOG_P3         -1.2420140846e-1f
+#define NE10_LOG_P4          1.4249322787e-1f
+#define NE10_LOG_P5         -1.6668057665e-1f
+#define NE10_LOG_P6          2.0000714765e-1f
+#define NE10_LOG_P7         -2.4999993993e-1f
+#define NE10_LOG_P8          3.3333331174e-1f
+/* near-minimax fit of (log(1 + x) - x + x^2 / 2) / x^3 on [sqrt(0.5) - 1, sqrt(2) - 1] */
+#define NE10_LOG_FAST_P0     1.71879890e-1f
+#define NE10_LOG_FAST_P1    -2.64969764e-1f
+#define NE10_LOG_FAST_P2     3.35959521e-1f
+
+#define NE10_FOPI            1.27323954473516f
+#define NE10_SINCOS_DP1     -0.78515625f
+#define NE10_SINCOS_DP2     -2.4187564849853515625e-4f
+#define NE10_SINCOS_DP3     -3.77489497744594108e-8f
+#define NE10_SIN_P0         -1.9515295891e-4f
+#define NE10_SIN_P1          8.3321608736e-3f
+#define NE10_SIN_P2         -1.6666654611e-1f
+#define NE10_COS_P0          2.443315711809948e-5f
+#define NE10_COS_P1         -1.388731625493765e-3f
+#define NE10_COS_P2          4.166664568298827e-2f
+
+#define NE10_TANH_SMALL      0.625f
+#define NE10_TANH_MAX        9.0f
+#define NE10_TANH_P0        -5.70498872745e-3f
+#define NE10_TANH_P1         2.06390887954e-2f
+#define NE10_TANH_P2        -5.37397155531e-2f
+#define NE10_TANH_P3         1.33314422036e-1f
+#define NE10_TANH_P4        -3.33332819422e-1f
+
+#define NE10_ACOS_PI         3.14159265358979324f
+#define NE10_ACOS_PIO2       1.57079632679489662f
+#define NE10_ASIN_P0         4.2163199048e-2f
+#define NE10_ASIN_P1         2.4181311049e-2f
+#define NE10_ASIN_P2         4.5470025998e-2f
+#define NE10_ASIN_P3         7.4953002686e-2f
+#define NE10_ASIN_P4         1.6666752422e-1f
+
+/* 1 / x, for finite non-zero x */
+static inline float32x4_t ne10_recip_kernel_neon (float32x4_t x)
+{
+#ifdef __aarch64__
+    return vdivq_f32 (vdupq_n_f32 (1.0f), x);
+#else
+    float32x4_t est = vrecpeq_f32 (x);
+    est = vmulq_f32 (est, vrecpsq_f32 (x, est));
+    est = vmulq_f32 (est, vrecpsq_f32 (x, est));
+    return est;
+#endif
+}
+
+/* a / b; exact on AArch64, two Newton-Raphson steps on the reciprocal otherwise */
+static inline float32x4_t ne10_div_kernel_neon (float32x4_t a, float32x4_t b)
+{
+#ifdef __aarch64__
+    return vdivq_f32 (a, b);
+#else
+    return vmulq_f32 (a, ne10_recip_kernel_neon (b));
+#endif
+}
+
+/*
+ * 1 / sqrt(x) with one (fast) or two Newton-Raphson steps. The steps would
+ * turn the exact estimates for 0 and inf into NaN, so those lanes keep them.
+ */
+static inline float32x4_t ne10_rsqrt_step_neon (float32x4_t x, float32x4_t est)
+{
+    return vmulq_f32 (est, vrsqrtsq_f32 (vmulq_f32 (x, est), est));
+}
+
+static inline float32x4_t ne10_rsqrt_special_neon (float32x4_t x, float32x4_t est, float32x4_t r)
+{
+    uint32x4_t special = vorrq_u32 (vceqq_f32 (x, vdupq_n_f32 (0.0f)),
+                                    vceqq_f32 (x, vdupq_n_f32 (INFINITY)));
+    return vbslq_f32 (special, est, r);
+}
+
+static inline float32x4_t ne10_rsqrt_fast_kernel_neon (float32x4_t x)
+{
+    float32x4_t est = vrsqrteq_f32 (x);
+    return ne10_rsqrt_special_neon (x, est, ne10_rsqrt_step_neon (x, est));
+}
+
+static inline float32x4_t ne10_rsqrt_kernel_neon (float32x4_t x)
+{
+    float32x4_t est = vrsqrteq_f32 (x);
+    float32x4_t r = ne10_rsqrt_step_neon (x, ne10_rsqrt_step_neon (x, est));
+    return ne10_rsqrt_special_neon (x, est, r);
+}
+
+static inline float32x4_t ne10_sqrt_kernel_neon (float32x4_t x)
+{
+#ifdef __aarch64__
+    return vsqrtq_f32 (x);
+#else
+    float32x4_t r = ne10_rsqrt_step_neon (x, ne10_rsqrt_step_neon (x, vrsqrteq_f32 (x)));
+    float32x4_t s = vmulq_f32 (x, r);
+    uint32x4_t special = vorrq_u32 (vceqq_f32 (x, vdupq_n_f32 (0.0f)),
+                                    vceqq_f32 (x, vdupq_n_f32 (INFINITY)));
+
+    /* one Heron correction on the residual x - s * s */
+    s = vmlaq_f32 (s, vmulq_f32 (r, vdupq_n_f32 (0.5f)), vmlsq_f32 (x, s, s));
+    return vbslq_f32 (special, x, s);
+#endif
+}
+
+/* round-half-away-from-zero of x * log2(e), as an integer and as a float */
+static inline int32x4_t ne10_exp_reduce_neon (float32x4_t x, float32x4_t * fn)
+{
+    float32x4_t t = vmulq_n_f32 (x, NE10_LOG2E);
+    uint32x4_t sign = vandq_u32 (vreinterpretq_u32_f32 (t), vdupq_n_u32 (0x80000000));
+    float32x4_t half = vreinterpretq_f32_u32 (vorrq_u32 (vreinterpretq_u32_f32 (vdupq_n_f32 (0.5f)), sign));
+    int32x4_t n = vcvtq_s32_f32 (vaddq_f32 (t, half));
+
+    *fn = vcvtq_f32_s32 (n);
+    return n;
+}
+
+/* y * 2^n in two steps, so n may range over [-150, 128] and under/overflow comes out as 0/inf */
+static inline float32x4_t ne10_exp_scale_neon (float32x4_t y, int32x4_t n)
+{
+    int32x4_t n1 = vshrq_n_s32 (n, 1);
+    int32x4_t n2 = vsubq_s32 (n, n1);
+    float32x4_t s1 = vreinterpretq_f32_s32 (vshlq_n_s32 (vaddq_s32 (n1, vdupq_n_s32 (127)), 23));
+    float32x4_t s2 = vreinterpretq_f32_s32 (vshlq_n_s32 (vaddq_s32 (n2, vdupq_n_s32 (127)), 23));
+
+    return vmulq_f32 (vmulq_f32 (y, s1), s2);
+}
+
+static inline float32x4_t ne10_exp_kernel_neon (float32x4_t x)
+{
+    float32x4_t fn, z, p;
+    int32x4_t n;
+
+    x = vminq_f32 (vmaxq_f32 (x, vdupq_n_f32 (NE10_EXP_MIN)), vdupq_n_f32 (NE10_EXP_MAX));
+    n = ne10_exp_reduce_neon (x, &fn);
+    x = vmlsq_f32 (x, fn, vdupq_n_f32 (NE10_LN2_HI));
+    x = vmlsq_f32 (x, fn, vdupq_n_f32 (NE10_LN2_LO));
+
+    z = vmulq_f32 (x, x);
+    p = vmlaq_n_f32 (vdupq_n_f32 (NE10_EXP_P1), x, NE10_EXP_P0);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_EXP_P2), p, x);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_EXP_P3), p, x);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_EXP_P4), p, x);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_EXP_P5), p, x);
+    p = vmlaq_f32 (vaddq_f32 (x, vdupq_n_f32 (1.0f)), p, z);
+    return ne10_exp_scale_neon (p, n);
+}
+
+static inline float32x4_t ne10_exp_fast_kernel_neon (float32x4_t x)
+{
+    float32x4_t fn, p;
+    int32x4_t n;
+
+    x = vminq_f32 (vmaxq_f32 (x, vdupq_n_f32 (NE10_EXP_MIN)), vdupq_n_f32 (NE10_EXP_MAX));
+    n = ne10_exp_reduce_neon (x, &fn);
+    x = vmlsq_f32 (x, fn, vdupq_n_f32 (NE10_LN2_HI + NE10_LN2_LO));
+
+    p = vmlaq_n_f32 (vdupq_n_f32 (NE10_EXP_FAST_P1), x, NE10_EXP_FAST_P0);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_EXP_FAST_P2), p, x);
+    p = vmlaq_f32 (vaddq_f32 (x, vdupq_n_f32 (1.0f)), p, vmulq_f32 (x, x));
+    return ne10_exp_scale_neon (p, n);
+}
+
+/*
+ * Splits x into e and m - 1 with x = 2^e * m, m in [sqrt(0.5), sqrt(2)).
+ * Subnormal inputs are treated as the smallest normal number.
+ */
+static inline float32x4_t ne10_log_reduce_neon (float32x4_t x, float32x4_t * fe)
+{
+    uint32x4_t bits = vreinterpretq_u32_f32 (vmaxq_f32 (x, vdupq_n_f32 (1.17549435e-38f)));
+    int32x4_t e = vsubq_s32 (vreinterpretq_s32_u32 (vshrq_n_u32 (bits, 23)), vdupq_n_s32 (126));
+    float32x4_t m = vreinterpretq_f32_u32 (vorrq_u32 (vandq_u32 (bits, vdupq_n_u32 (0x007fffff)),
+                                                      vreinterpretq_u32_f32 (vdupq_n_f32 (0.5f))));
+    uint32x4_t small = vcltq_f32 (m, vdupq_n_f32 (NE10_SQRTHF));
+
+    /* m < sqrt(0.5): use 2m and e - 1 */
+    e = vsubq_s32 (e, vreinterpretq_s32_u32 (vandq_u32 (small, vdupq_n_u32 (1))));
+    m = vaddq_f32 (m, vreinterpretq_f32_u32 (vandq_u32 (small, vreinterpretq_u32_f32 (m))));
+    *fe = vcvtq_f32_s32 (e);
+    return vsubq_f32 (m, vdupq_n_f32 (1.0f));
+}
+
+/* log(0) is -inf, log(+inf) is +inf, negative and NaN inputs give NaN */
+static inline float32x4_t ne10_log_special_neon (float32x4_t x, float32x4_t y)
+{
+    y = vbslq_f32 (vceqq_f32 (x, vdupq_n_f32 (0.0f)), vdupq_n_f32 (-INFINITY), y);
+    y = vbslq_f32 (vceqq_f32 (x, vdupq_n_f32 (INFINITY)), x, y);
+    return vbslq_f32 (vcgeq_f32 (x, vdupq_n_f32 (0.0f)), y, vdupq_n_f32 (NAN));
+}
+
+static inline float32x4_t ne10_log_kernel_neon (float32x4_t x)
+{
+    float32x4_t fe, m, z, p, y;
+
+    m = ne10_log_reduce_neon (x, &fe);
+    z = vmulq_f32 (m, m);
+    p = vmlaq_n_f32 (vdupq_n_f32 (NE10_LOG_P1), m, NE10_LOG_P0);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_LOG_P2), p, m);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_LOG_P3), p, m);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_LOG_P4), p, m);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_LOG_P5), p, m);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_LOG_P6), p, m);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_LOG_P7), p, m);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_LOG_P8), p, m);
+
+    y = vmulq_f32 (vmulq_f32 (p, m), z);
+    y = vmlaq_n_f32 (y, fe, NE10_LN2_LO);
+    y = vmlsq_f32 (y, z, vdupq_n_f32 (0.5f));
+    y = vaddq_f32 (m, y);
+    y = vmlaq_n_f32 (y, fe, NE10_LN2_HI);
+    return ne10_log_special_neon (x, y);
+}
+
+static inline float32x4_t ne10_log_fast_kernel_neon (float32x4_t x)
+{
+    float32x4_t fe, m, z, p, y;
+
+    m = ne10_log_reduce_neon (x, &fe);
+    z = vmulq_f32 (m, m);
+    p = vmlaq_n_f32 (vdupq_n_f32 (NE10_LOG_FAST_P1), m, NE10_LOG_FAST_P0);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_LOG_FAST_P2), p, m);
+
+    y = vmulq_f32 (vmulq_f32 (p, m), z);
+    y = vmlsq_f32 (y, z, vdupq_n_f32 (0.5f));
+    y = vaddq_f32 (m, y);
+    y = vmlaq_n_f32 (y, fe, NE10_LN2_HI + NE10_LN2_LO);
+    return ne10_log_special_neon (x, y);
+}
+
+/* sin and cos together; the reduction by pi/4 is accurate for |x| <= 8192 */
+static inline void ne10_sincos_kernel_neon (float32x4_t x, float32x4_t * s, float32x4_t * c)
+{
+    uint32x4_t sign_sin = vcltq_f32 (x, vdupq_n_f32 (0.0f));
+    uint32x4_t sign_cos, poly_mask, j;
+    float32x4_t y, z, ps, pc;
+
+    x = vabsq_f32 (x);
+    j = vcvtq_u32_f32 (vmulq_n_f32 (x, NE10_FOPI));
+    j = vandq_u32 (vaddq_u32 (j, vdupq_n_u32 (1)), vdupq_n_u32 (~1u));
+    y = vcvtq_f32_u32 (j);
+
+    x = vmlaq_n_f32 (x, y, NE10_SINCOS_DP1);
+    x = vmlaq_n_f32 (x, y, NE10_SINCOS_DP2);
+    x = vmlaq_n_f32 (x, y, NE10_SINCOS_DP3);
+
+    poly_mask = vtstq_u32 (j, vdupq_n_u32 (2));
+    sign_sin = veorq_u32 (sign_sin, vtstq_u32 (j, vdupq_n_u32 (4)));
+    sign_cos = vtstq_u32 (vsubq_u32 (j, vdupq_n_u32 (2)), vdupq_n_u32 (4));
+
+    z = vmulq_f32 (x, x);
+    pc = vmlaq_n_f32 (vdupq_n_f32 (NE10_COS_P1), z, NE10_COS_P0);
+    ps = vmlaq_n_f32 (vdupq_n_f32 (NE10_SIN_P1), z, NE10_SIN_P0);
+    pc = vmlaq_f32 (vdupq_n_f32 (NE10_COS_P2), pc, z);
+    ps = vmlaq_f32 (vdupq_n_f32 (NE10_SIN_P2), ps, z);
+    pc = vmulq_f32 (vmulq_f32 (pc, z), z);
+    pc = vmlsq_f32 (pc, z, vdupq_n_f32 (0.5f));
+    pc = vaddq_f32 (pc, vdupq_n_f32 (1.0f));
+    ps = vmlaq_f32 (x, vmulq_f32 (ps, z), x);
+
+    y = vbslq_f32 (poly_mask, pc, ps);
+    z = vbslq_f32 (poly_mask, ps, pc);
+    *s = vbslq_f32 (sign_sin, vnegq_f32 (y), y);
+    *c = vbslq_f32 (sign_cos, z, vnegq_f32 (z));
+}
+
+static inline float32x4_t ne10_tanh_kernel_neon (float32x4_t x)
+{
+    float32x4_t ax = vabsq_f32 (x);
+    float32x4_t z = vmulq_f32 (x, x);
+    float32x4_t p, e, large;
+    uint32x4_t sign = vandq_u32 (vreinterpretq_u32_f32 (x), vdupq_n_u32 (0x80000000));
+
+    /* |x| < 0.625: odd polynomial */
+    p = vmlaq_n_f32 (vdupq_n_f32 (NE10_TANH_P1), z, NE10_TANH_P0);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_TANH_P2), p, z);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_TANH_P3), p, z);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_TANH_P4), p, z);
+    p = vmlaq_f32 (x, vmulq_f32 (p, z), x);
+
+    /* otherwise 1 - 2 / (e^2|x| + 1), with the sign of x */
+    e = ne10_exp_kernel_neon (vaddq_f32 (vminq_f32 (ax, vdupq_n_f32 (NE10_TANH_MAX)),
+                                         vminq_f32 (ax, vdupq_n_f32 (NE10_TANH_MAX))));
+    large = vmlsq_f32 (vdupq_n_f32 (1.0f), vdupq_n_f32 (2.0f), ne10_recip_kernel_neon (vaddq_f32 (e, vdupq_n_f32 (1.0f))));
+    large = vreinterpretq_f32_u32 (vorrq_u32 (vreinterpretq_u32_f32 (large), sign));
+
+    return vbslq_f32 (vcltq_f32 (ax, vdupq_n_f32 (NE10_TANH_SMALL)), p, large);
+}
+
+/*
+ * acos, with asin on [0, 0.5] as the core: |x| > 0.5 goes through
+ * acos(|x|) = 2 asin(sqrt((1 - |x|) / 2)). |x| > 1 gives NaN.
+ */
+static inline float32x4_t ne10_acos_kernel_neon (float32x4_t x)
+{
+    float32x4_t ax = vabsq_f32 (x);
+    uint32x4_t big = vcgtq_f32 (ax, vdupq_n_f32 (0.5f));
+    uint32x4_t neg = vcltq_f32 (x, vdupq_n_f32 (0.0f));
+    float32x4_t z, s, p, large, small;
+
+    z = vbslq_f32 (big, vmulq_n_f32 (vsubq_f32 (vdupq_n_f32 (1.0f), ax), 0.5f), vmulq_f32 (ax, ax));
+    s = vbslq_f32 (big, ne10_sqrt_kernel_neon (z), ax);
+    p = vmlaq_n_f32 (vdupq_n_f32 (NE10_ASIN_P1), z, NE10_ASIN_P0);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_ASIN_P2), p, z);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_ASIN_P3), p, z);
+    p = vmlaq_f32 (vdupq_n_f32 (NE10_ASIN_P4), p, z);
+    p = vmlaq_f32 (s, vmulq_f32 (p, z), s);
+
+    large = vaddq_f32 (p, p);
+    large = vbslq_f32 (neg, vsubq_f32 (vdupq_n_f32 (NE10_ACOS_PI), large), large);
+    small = vsubq_f32 (vdupq_n_f32 (NE10_ACOS_PIO2), vbslq_f32 (neg, vnegq_f32 (p), p));
+    return vbslq_f32 (big, large, small);
+}
+
+#endif // __NE10_TRANSCENDENTAL_NEON_H__
@@ -35,6 +35,7 @@
 #include <string.h>
 
 #include "NE10_math.h"
+#include "NE10_init.h"
 #include "seatest.h"
 
 //function table
@@ -2717,6 +2718,3842 @@ void test_mulcmatvec_case0()
 #undef MAX_VEC_COMPONENTS
 }
 
+/* complex kernels under test: mul, conj_mul, mul_acc, mag, mag_sqr, phase, to_polar, from_polar */
+#define CPX_FLOAT_FUNC_COUNT 8
+/* Q31 then Q15: mul, conj_mul, mul_acc, mag, mag_sqr */
+#define CPX_INT_FUNC_COUNT 10
+
+/* position of each kernel in its function table (ftbl_3args, ftbl_4args or ftbl_5args) */
+static const ne10_int32_t test_cpx_float_slot[CPX_FLOAT_FUNC_COUNT] = { 0, 1, 0, 0, 1, 2, 2, 3 };
+static const ne10_int32_t test_cpx_int_slot[CPX_INT_FUNC_COUNT] = { 0, 1, 0, 0, 1, 2, 3, 1, 2, 3 };
+
+static void test_cpx_normalize (ne10_float32_t * arr, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    /* the random source is limited to +-1000; scale it to the unit circle range of FFT outputs */
+    for (i = 0; i < count; i++)
+        arr[i] *= 1.0e-3f;
+}
+
+static void test_cpx_float_run (ne10_int32_t func, ne10_int32_t is_neon, ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_int32_t idx = 2 * test_cpx_float_slot[func] + is_neon;
+
+    switch (func)
+    {
+    case 2:
+        ftbl_5args[idx] (dst, acc, src1, src2, count);
+        break;
+    case 3:
+    case 4:
+    case 5:
+        ftbl_3args[idx] (dst, src1, count);
+        break;
+    case 6:
+        /* magnitudes followed by phases */
+        ftbl_4args[idx] (dst, dst + count, src1, count);
+        break;
+    default:
+        ftbl_4args[idx] (dst, src1, src2, count);
+        break;
+    }
+}
+
+static void test_cpx_int_run (ne10_int32_t func, ne10_int32_t is_neon, ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_int32_t idx = 2 * test_cpx_int_slot[func] + is_neon;
+
+    switch (func % 5)
+    {
+    case 2:
+        ftbl_5args[idx] (dst, acc, src1, src2, count);
+        break;
+    case 3:
+    case 4:
+        ftbl_3args[idx] (dst, src1, count);
+        break;
+    default:
+        ftbl_4args[idx] (dst, src1, src2, count);
+        break;
+    }
+}
+
+/* number of ne10_float32_t slots written by a fixed-point kernel */
+static ne10_uint32_t test_cpx_int_out_len (ne10_int32_t func, ne10_uint32_t count)
+{
+    ne10_uint32_t bytes;
+
+    if (func < 5)
+        bytes = (func % 5 < 3) ? count * sizeof (ne10_fft_cpx_int32_t) : count * sizeof (ne10_int32_t);
+    else
+        bytes = (func % 5 < 3) ? count * sizeof (ne10_fft_cpx_int16_t) : count * sizeof (ne10_int16_t);
+    return (bytes + sizeof (ne10_float32_t) - 1) / sizeof (ne10_float32_t);
+}
+
+void test_cpx_case0()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    /* init function table */
+    memset (ftbl_3args, 0, sizeof (ftbl_3args));
+    memset (ftbl_4args, 0, sizeof (ftbl_4args));
+    memset (ftbl_5args, 0, sizeof (ftbl_5args));
+    ftbl_4args[0] = (ne10_func_4args_t) ne10_cpx_mul_float_c;
+    ftbl_4args[1] = (ne10_func_4args_t) ne10_cpx_mul_float_neon;
+    ftbl_4args[2] = (ne10_func_4args_t) ne10_cpx_conj_mul_float_c;
+    ftbl_4args[3] = (ne10_func_4args_t) ne10_cpx_conj_mul_float_neon;
+    ftbl_4args[4] = (ne10_func_4args_t) ne10_cpx_to_polar_float_c;
+    ftbl_4args[5] = (ne10_func_4args_t) ne10_cpx_to_polar_float_neon;
+    ftbl_4args[6] = (ne10_func_4args_t) ne10_cpx_from_polar_float_c;
+    ftbl_4args[7] = (ne10_func_4args_t) ne10_cpx_from_polar_float_neon;
+    ftbl_5args[0] = (ne10_func_5args_t) ne10_cpx_mul_acc_float_c;
+    ftbl_5args[1] = (ne10_func_5args_t) ne10_cpx_mul_acc_float_neon;
+    ftbl_3args[0] = (ne10_func_3args_t) ne10_cpx_mag_float_c;
+    ftbl_3args[1] = (ne10_func_3args_t) ne10_cpx_mag_float_neon;
+    ftbl_3args[2] = (ne10_func_3args_t) ne10_cpx_mag_sqr_float_c;
+    ftbl_3args[3] = (ne10_func_3args_t) ne10_cpx_mag_sqr_float_neon;
+    ftbl_3args[4] = (ne10_func_3args_t) ne10_cpx_phase_float_c;
+    ftbl_3args[5] = (ne10_func_3args_t) ne10_cpx_phase_float_neon;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_int32_t out_size;
+    ne10_int32_t margin;
+    const ne10_uint32_t fixed_length = TEST_ITERATION * 2;
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (theacc, guarded_acc, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    test_cpx_normalize (theacc, fixed_length);
+    test_cpx_normalize (thesrc1, fixed_length);
+    test_cpx_normalize (thesrc2, fixed_length);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, fixed_length);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, fixed_length);
+
+    for (func_loop = 0; func_loop < CPX_FLOAT_FUNC_COUNT; func_loop++)
+    {
+        /* mag, mag_sqr and phase write one real per complex input */
+        out_size = (func_loop >= 3 && func_loop <= 5) ? 1 : 2;
+        /* the NEON phase is a polynomial approximation, |error| <= 1e-5 rad */
+        margin = (func_loop == 5 || func_loop == 6) ? 4 : ERROR_MARGIN_SMALL;
+
+        for (loop = 0; loop < TEST_ITERATION; loop++)
+        {
+            GUARD_ARRAY (thedst_c, loop * out_size);
+            GUARD_ARRAY (thedst_neon, loop * out_size);
+
+            test_cpx_float_run (func_loop, 0, thedst_c, theacc, thesrc1, thesrc2, loop);
+            test_cpx_float_run (func_loop, 1, thedst_neon, theacc, thesrc1, thesrc2, loop);
+
+            assert_true (CHECK_ARRAY_GUARD (thedst_c, loop * out_size));
+            assert_true (CHECK_ARRAY_GUARD (thedst_neon, loop * out_size));
+
+#ifdef DEBUG_TRACE
+            ne10_int32_t i;
+            fprintf (stdout, "func: %d loop count: %d\n", func_loop, loop);
+            for (i = 0; i < loop * 2; i++)
+            {
+                fprintf (stdout, "thesrc1->%d: %e [0x%04X] \n", i, thesrc1[i], * (ne10_uint32_t*) &thesrc1[i]);
+                fprintf (stdout, "thesrc2->%d: %e [0x%04X] \n", i, thesrc2[i], * (ne10_uint32_t*) &thesrc2[i]);
+            }
+#endif
+            assert_float_vec_equal (thedst_c, thedst_neon, margin, loop * out_size);
+        }
+    }
+    free (guarded_acc);
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = PERF_TEST_ITERATION * 2;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_theacc, perftest_guarded_acc, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    test_cpx_normalize (perftest_theacc, perftest_length);
+    test_cpx_normalize (perftest_thesrc1, perftest_length);
+    test_cpx_normalize (perftest_thesrc2, perftest_length);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perftest_length);
+    NE10_DST_ALLOC (perftest_thedst_neon, perftest_guarded_dst_neon, perftest_length);
+
+    for (func_loop = 0; func_loop < CPX_FLOAT_FUNC_COUNT; func_loop++)
+    {
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_cpx_float_run (func_loop, 0, perftest_thedst_c, perftest_theacc, perftest_thesrc1, perftest_thesrc2, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_cpx_float_run (func_loop, 1, perftest_thedst_neon, perftest_theacc, perftest_thesrc1, perftest_thesrc2, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_acc);
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+    free (perftest_guarded_dst_c);
+    free (perftest_guarded_dst_neon);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_cpx_case1()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+    ne10_uint32_t i;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    /* init function table */
+    memset (ftbl_3args, 0, sizeof (ftbl_3args));
+    memset (ftbl_4args, 0, sizeof (ftbl_4args));
+    memset (ftbl_5args, 0, sizeof (ftbl_5args));
+    ftbl_4args[0] = (ne10_func_4args_t) ne10_cpx_mul_int32_c;
+    ftbl_4args[1] = (ne10_func_4args_t) ne10_cpx_mul_int32_neon;
+    ftbl_4args[2] = (ne10_func_4args_t) ne10_cpx_conj_mul_int32_c;
+    ftbl_4args[3] = (ne10_func_4args_t) ne10_cpx_conj_mul_int32_neon;
+    ftbl_4args[4] = (ne10_func_4args_t) ne10_cpx_mul_int16_c;
+    ftbl_4args[5] = (ne10_func_4args_t) ne10_cpx_mul_int16_neon;
+    ftbl_4args[6] = (ne10_func_4args_t) ne10_cpx_conj_mul_int16_c;
+    ftbl_4args[7] = (ne10_func_4args_t) ne10_cpx_conj_mul_int16_neon;
+    ftbl_5args[0] = (ne10_func_5args_t) ne10_cpx_mul_acc_int32_c;
+    ftbl_5args[1] = (ne10_func_5args_t) ne10_cpx_mul_acc_int32_neon;
+    ftbl_5args[2] = (ne10_func_5args_t) ne10_cpx_mul_acc_int16_c;
+    ftbl_5args[3] = (ne10_func_5args_t) ne10_cpx_mul_acc_int16_neon;
+    ftbl_3args[0] = (ne10_func_3args_t) ne10_cpx_mag_int32_c;
+    ftbl_3args[1] = (ne10_func_3args_t) ne10_cpx_mag_int32_neon;
+    ftbl_3args[2] = (ne10_func_3args_t) ne10_cpx_mag_sqr_int32_c;
+    ftbl_3args[3] = (ne10_func_3args_t) ne10_cpx_mag_sqr_int32_neon;
+    ftbl_3args[4] = (ne10_func_3args_t) ne10_cpx_mag_int16_c;
+    ftbl_3args[5] = (ne10_func_3args_t) ne10_cpx_mag_int16_neon;
+    ftbl_3args[6] = (ne10_func_3args_t) ne10_cpx_mag_sqr_int16_c;
+    ftbl_3args[7] = (ne10_func_3args_t) ne10_cpx_mag_sqr_int16_neon;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_uint32_t out_len;
+    ne10_int32_t margin;
+    ne10_int64_t diff;
+    const ne10_uint32_t fixed_length = TEST_ITERATION * 2;
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (theacc, guarded_acc, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, fixed_length);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, fixed_length);
+
+    for (func_loop = 0; func_loop < CPX_INT_FUNC_COUNT; func_loop++)
+    {
+        /* convert the inputs in place: to Q31 for the first five kernels, then Q31 to Q15 */
+        for (i = 0; i < fixed_length && (func_loop == 0 || func_loop == 5); i++)
+        {
+            if (func_loop == 0)
+            {
+                ( (ne10_int32_t*) theacc) [i] = (ne10_int32_t) (theacc[i] * 1.0e-3f * 2147483520.0f);
+                ( (ne10_int32_t*) thesrc1) [i] = (ne10_int32_t) (thesrc1[i] * 1.0e-3f * 2147483520.0f);
+                ( (ne10_int32_t*) thesrc2) [i] = (ne10_int32_t) (thesrc2[i] * 1.0e-3f * 2147483520.0f);
+            }
+            else
+            {
+                /* two Q15 values per slot; the second is derived from the first */
+                ne10_int16_t acc16 = ( (ne10_int32_t*) theacc) [i] >> 16;
+                ne10_int16_t src16_1 = ( (ne10_int32_t*) thesrc1) [i] >> 16;
+                ne10_int16_t src16_2 = ( (ne10_int32_t*) thesrc2) [i] >> 16;
+                ( (ne10_int16_t*) theacc) [2 * i] = acc16;
+                ( (ne10_int16_t*) theacc) [2 * i + 1] = acc16 / 3;
+                ( (ne10_int16_t*) thesrc1) [2 * i] = src16_1;
+                ( (ne10_int16_t*) thesrc1) [2 * i + 1] = - (src16_1 / 2);
+                ( (ne10_int16_t*) thesrc2) [2 * i] = src16_2;
+                ( (ne10_int16_t*) thesrc2) [2 * i + 1] = src16_2 / 5;
+            }
+        }
+
+        /* the Q31 magnitude goes through single precision on NEON */
+        margin = (func_loop == 3) ? (1 << 10) : ( (func_loop == 8) ? 1 : 0);
+
+        for (loop = 0; loop < TEST_ITERATION; loop++)
+        {
+            out_len = test_cpx_int_out_len (func_loop, loop);
+
+            GUARD_ARRAY (thedst_c, out_len);
+            GUARD_ARRAY (thedst_neon, out_len);
+
+            test_cpx_int_run (func_loop, 0, thedst_c, theacc, thesrc1, thesrc2, loop);
+            test_cpx_int_run (func_loop, 1, thedst_neon, theacc, thesrc1, thesrc2, loop);
+
+            assert_true (CHECK_ARRAY_GUARD (thedst_c, out_len));
+            assert_true (CHECK_ARRAY_GUARD (thedst_neon, out_len));
+
+            for (i = 0; i < (ne10_uint32_t) loop * ( (func_loop % 5 < 3) ? 2 : 1); i++)
+            {
+                if (func_loop < 5)
+                    diff = (ne10_int64_t) ( (ne10_int32_t*) thedst_c) [i] - ( (ne10_int32_t*) thedst_neon) [i];
+                else
+                    diff = (ne10_int64_t) ( (ne10_int16_t*) thedst_c) [i] - ( (ne10_int16_t*) thedst_neon) [i];
+#ifdef DEBUG_TRACE
+                if (diff > margin || diff < -margin)
+                    fprintf (stdout, "func: %d loop count: %d position: %d diff: %lld\n", func_loop, loop, i, diff);
+#endif
+                assert_true (diff <= margin && diff >= -margin);
+            }
+        }
+    }
+
+    /*
+     * Full-scale operands: (-1 - 1j) * (-1 - 1j) saturates to 0 + 1j, and
+     * -1 * -1 - a product just under a rounding boundary, where the
+     * saturation decides the last bit.
+     */
+    {
+        static const ne10_int32_t edge1_32[8][2] =
+        {
+            { -2147483647 - 1, -2147483647 - 1 }, { -2147483647 - 1, -2147483647 - 1 }, { -2147483647 - 1, 3 << 15 }, { 2147483647, -2147483647 - 1 },
+            { -2147483647 - 1, 0 }, { -2147483647 - 1, -2147483647 - 1 }, { 12345, -2147483647 - 1 }, { -2147483647 - 1, 2147483647 }
+        };
+        static const ne10_int32_t edge2_32[8][2] =
+        {
+            { -2147483647 - 1, -2147483647 - 1 }, { 2147483647, -2147483647 - 1 }, { -2147483647 - 1, 1 << 15 }, { -2147483647 - 1, -2147483647 - 1 },
+            { -2147483647 - 1, -2147483647 - 1 }, { 0, 0 }, { -2147483647 - 1, -2147483647 - 1 }, { -2147483647 - 1, -2147483647 - 1 }
+        };
+        static const ne10_int16_t edge1_16[8][2] =
+        {
+            { -32768, -32768 }, { -32768, -32768 }, { -32768, 192 }, { 32767, -32768 },
+            { -32768, 0 }, { -32768, -32768 }, { 123, -32768 }, { -32768, 32767 }
+        };
+        static const ne10_int16_t edge2_16[8][2] =
+        {
+            { -32768, -32768 }, { 32767, -32768 }, { -32768, 256 }, { -32768, -32768 },
+            { -32768, -32768 }, { 0, 0 }, { -32768, -32768 }, { -32768, -32768 }
+        };
+        ne10_fft_cpx_int32_t src1_32[8], src2_32[8], acc_32[8], dst_c_32[8], dst_neon_32[8];
+        ne10_fft_cpx_int16_t src1_16[8], src2_16[8], acc_16[8], dst_c_16[8], dst_neon_16[8];
+
+        for (i = 0; i < 8; i++)
+        {
+            src1_32[i].r = edge1_32[i][0];
+            src1_32[i].i = edge1_32[i][1];
+            src2_32[i].r = edge2_32[i][0];
+            src2_32[i].i = edge2_32[i][1];
+            acc_32[i].r = (i & 1) ? 2147483647 : -2147483647 - 1;
+            acc_32[i].i = (i & 2) ? 2147483647 : -1000;
+            src1_16[i].r = edge1_16[i][0];
+            src1_16[i].i = edge1_16[i][1];
+            src2_16[i].r = edge2_16[i][0];
+            src2_16[i].i = edge2_16[i][1];
+            acc_16[i].r = (i & 1) ? 32767 : -32768;
+            acc_16[i].i = (i & 2) ? 32767 : -100;
+        }
+
+        ne10_cpx_mul_int32_c (dst_c_32, src1_32, src2_32, 8);
+        ne10_cpx_mul_int32_neon (dst_neon_32, src1_32, src2_32, 8);
+        assert_int_equal (0, dst_c_32[0].r);
+        assert_int_equal (2147483647, dst_c_32[0].i);
+        assert_true (memcmp (dst_c_32, dst_neon_32, sizeof (dst_c_32)) == 0);
+        ne10_cpx_conj_mul_int32_c (dst_c_32, src1_32, src2_32, 8);
+        ne10_cpx_conj_mul_int32_neon (dst_neon_32, src1_32, src2_32, 8);
+        assert_int_equal (2147483647, dst_c_32[0].r);
+        assert_true (memcmp (dst_c_32, dst_neon_32, sizeof (dst_c_32)) == 0);
+        ne10_cpx_mul_acc_int32_c (dst_c_32, acc_32, src1_32, src2_32, 8);
+        ne10_cpx_mul_acc_int32_neon (dst_neon_32, acc_32, src1_32, src2_32, 8);
+        assert_true (memcmp (dst_c_32, dst_neon_32, sizeof (dst_c_32)) == 0);
+
+        ne10_cpx_mul_int16_c (dst_c_16, src1_16, src2_16, 8);
+        ne10_cpx_mul_int16_neon (dst_neon_16, src1_16, src2_16, 8);
+        assert_int_equal (0, dst_c_16[0].r);
+        assert_int_equal (32767, dst_c_16[0].i);
+        assert_true (memcmp (dst_c_16, dst_neon_16, sizeof (dst_c_16)) == 0);
+        ne10_cpx_conj_mul_int16_c (dst_c_16, src1_16, src2_16, 8);
+        ne10_cpx_conj_mul_int16_neon (dst_neon_16, src1_16, src2_16, 8);
+        assert_true (memcmp (dst_c_16, dst_neon_16, sizeof (dst_c_16)) == 0);
+        ne10_cpx_mul_acc_int16_c (dst_c_16, acc_16, src1_16, src2_16, 8);
+        ne10_cpx_mul_acc_int16_neon (dst_neon_16, acc_16, src1_16, src2_16, 8);
+        assert_true (memcmp (dst_c_16, dst_neon_16, sizeof (dst_c_16)) == 0);
+    }
+    free (guarded_acc);
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = PERF_TEST_ITERATION * 2;
+    /* init src memory; the inputs only need to be valid fixed-point bit patterns here */
+    NE10_SRC_ALLOC_LIMIT (perftest_theacc, perftest_guarded_acc, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perftest_length);
+    NE10_DST_ALLOC (perftest_thedst_neon, perftest_guarded_dst_neon, perftest_length);
+
+    for (func_loop = 0; func_loop < CPX_INT_FUNC_COUNT; func_loop++)
+    {
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_cpx_int_run (func_loop, 0, perftest_thedst_c, perftest_theacc, perftest_thesrc1, perftest_thesrc2, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_cpx_int_run (func_loop, 1, perftest_thedst_neon, perftest_theacc, perftest_thesrc1, perftest_thesrc2, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_acc);
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+    free (perftest_guarded_dst_c);
+    free (perftest_guarded_dst_neon);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+/* transcendental kernels with one input: input scale (negative for |x|) and NEON error bounds */
+typedef struct
+{
+    ne10_func_3args_t func_c;
+    ne10_func_3args_t func_neon;
+    ne10_float32_t scale;
+    ne10_float32_t abs_tol;
+    ne10_float32_t rel_tol;
+} test_transcendental_unary_t;
+
+#define TRANSCENDENTAL_UNARY_FUNC_COUNT 10
+/* pow, then sincos */
+#define TRANSCENDENTAL_BINARY_FUNC_COUNT 2
+
+static const test_transcendental_unary_t test_transcendental_unary[TRANSCENDENTAL_UNARY_FUNC_COUNT] =
+{
+    { (ne10_func_3args_t) ne10_exp_float_c, (ne10_func_3args_t) ne10_exp_float_neon, 0.08f, 0.0f, 5.0e-7f },
+    { (ne10_func_3args_t) ne10_exp_fast_float_c, (ne10_func_3args_t) ne10_exp_fast_float_neon, 0.08f, 0.0f, 2.0e-5f },
+    { (ne10_func_3args_t) ne10_log_float_c, (ne10_func_3args_t) ne10_log_float_neon, -1.0f, 1.0e-7f, 5.0e-7f },
+    { (ne10_func_3args_t) ne10_log_fast_float_c, (ne10_func_3args_t) ne10_log_fast_float_neon, -1.0f, 1.0e-4f, 0.0f },
+    { (ne10_func_3args_t) ne10_sin_float_c, (ne10_func_3args_t) ne10_sin_float_neon, 0.01f, 2.0e-7f, 5.0e-7f },
+    { (ne10_func_3args_t) ne10_cos_float_c, (ne10_func_3args_t) ne10_cos_float_neon, 0.01f, 2.0e-7f, 5.0e-7f },
+    { (ne10_func_3args_t) ne10_tanh_float_c, (ne10_func_3args_t) ne10_tanh_float_neon, 0.01f, 0.0f, 5.0e-7f },
+    { (ne10_func_3args_t) ne10_sqrt_float_c, (ne10_func_3args_t) ne10_sqrt_float_neon, -1.0f, 0.0f, 5.0e-7f },
+    { (ne10_func_3args_t) ne10_rsqrt_float_c, (ne10_func_3args_t) ne10_rsqrt_float_neon, -1.0f, 0.0f, 5.0e-7f },
+    { (ne10_func_3args_t) ne10_rsqrt_fast_float_c, (ne10_func_3args_t) ne10_rsqrt_fast_float_neon, -1.0f, 0.0f, 1.0e-4f },
+};
+
+/* map the random source (|x| in [1e-3, 1e3]) into the domain of a kernel */
+static void test_transcendental_map (ne10_float32_t * dst, ne10_float32_t * src, ne10_float32_t scale, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+        dst[i] = (scale < 0.0f) ? fabsf (src[i]) * -scale : src[i] * scale;
+}
+
+/* pow inputs: positive bases with exponents in [-4, 4], and every fourth base negative with an integer exponent */
+static void test_transcendental_map_pow (ne10_float32_t * base, ne10_float32_t * exponent, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x = src1[i] * 1.0e-2f;
+        ne10_float32_t y = src2[i] * 4.0e-3f;
+
+        base[i] = (i % 4 == 3) ? x : fabsf (x);
+        exponent[i] = (i % 4 == 3) ? (ne10_float32_t) (ne10_int32_t) y : y;
+    }
+}
+
+static void test_transcendental_check (ne10_float32_t * ref, ne10_float32_t * out, ne10_float32_t abs_tol, ne10_float32_t rel_tol, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        /* equal values include matching infinities */
+        if (ref[i] == out[i])
+            continue;
+#ifdef DEBUG_TRACE
+        if (! (fabsf (ref[i] - out[i]) <= abs_tol + rel_tol * fabsf (ref[i])))
+            fprintf (stdout, "position: %d c: %e neon: %e\n", i, ref[i], out[i]);
+#endif
+        assert_true (fabsf (ref[i] - out[i]) <= abs_tol + rel_tol * fabsf (ref[i]));
+    }
+}
+
+static void test_transcendental_binary_run (ne10_int32_t func, ne10_int32_t is_neon, ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    if (func == 0)
+        ftbl_4args[is_neon] (dst, src1, src2, count);
+    else
+        /* sines followed by cosines */
+        ftbl_4args[2 + is_neon] (dst, dst + count, src1, count);
+}
+
+void test_transcendental_case0()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+    const test_transcendental_unary_t * t;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    const ne10_uint32_t fixed_length = TEST_ITERATION;
+
+    /* init src memory; thecst holds the input mapped for each kernel */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_DST_ALLOC (thecst, guarded_cst, fixed_length);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, fixed_length);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, fixed_length);
+
+    for (func_loop = 0; func_loop < TRANSCENDENTAL_UNARY_FUNC_COUNT; func_loop++)
+    {
+        t = &test_transcendental_unary[func_loop];
+        test_transcendental_map (thecst, thesrc1, t->scale, fixed_length);
+
+        for (loop = 0; loop < TEST_ITERATION; loop++)
+        {
+            GUARD_ARRAY (thedst_c, loop);
+            GUARD_ARRAY (thedst_neon, loop);
+
+            t->func_c (thedst_c, thecst, loop);
+            t->func_neon (thedst_neon, thecst, loop);
+
+            assert_true (CHECK_ARRAY_GUARD (thedst_c, loop));
+            assert_true (CHECK_ARRAY_GUARD (thedst_neon, loop));
+
+#ifdef DEBUG_TRACE
+            fprintf (stdout, "func: %d loop count: %d\n", func_loop, loop);
+#endif
+            test_transcendental_check (thedst_c, thedst_neon, t->abs_tol, t->rel_tol, loop);
+        }
+    }
+    free (guarded_src1);
+    free (guarded_cst);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = PERF_TEST_ITERATION;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_DST_ALLOC (perftest_thecst, perftest_guarded_cst, perftest_length);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perftest_length);
+    NE10_DST_ALLOC (perftest_thedst_neon, perftest_guarded_dst_neon, perftest_length);
+
+    for (func_loop = 0; func_loop < TRANSCENDENTAL_UNARY_FUNC_COUNT; func_loop++)
+    {
+        t = &test_transcendental_unary[func_loop];
+        test_transcendental_map (perftest_thecst, perftest_thesrc1, t->scale, perftest_length);
+
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) t->func_c (perftest_thedst_c, perftest_thecst, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) t->func_neon (perftest_thedst_neon, perftest_thecst, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+    free (perftest_guarded_cst);
+    free (perftest_guarded_dst_c);
+    free (perftest_guarded_dst_neon);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_transcendental_case1()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    /* init function table */
+    memset (ftbl_4args, 0, sizeof (ftbl_4args));
+    ftbl_4args[0] = (ne10_func_4args_t) ne10_pow_float_c;
+    ftbl_4args[1] = (ne10_func_4args_t) ne10_pow_float_neon;
+    ftbl_4args[2] = (ne10_func_4args_t) ne10_sincos_float_c;
+    ftbl_4args[3] = (ne10_func_4args_t) ne10_sincos_float_neon;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    const ne10_uint32_t fixed_length = TEST_ITERATION * 2;
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, fixed_length);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, fixed_length);
+
+    for (func_loop = 0; func_loop < TRANSCENDENTAL_BINARY_FUNC_COUNT; func_loop++)
+    {
+        /* the pow bases, in [-10, 10], are then reused as sincos angles */
+        if (func_loop == 0)
+            test_transcendental_map_pow (thesrc1, thesrc2, thesrc1, thesrc2, fixed_length);
+
+        for (loop = 0; loop < TEST_ITERATION; loop++)
+        {
+            GUARD_ARRAY (thedst_c, loop * 2);
+            GUARD_ARRAY (thedst_neon, loop * 2);
+
+            test_transcendental_binary_run (func_loop, 0, thedst_c, thesrc1, thesrc2, loop);
+            test_transcendental_binary_run (func_loop, 1, thedst_neon, thesrc1, thesrc2, loop);
+
+            assert_true (CHECK_ARRAY_GUARD (thedst_c, loop * 2));
+            assert_true (CHECK_ARRAY_GUARD (thedst_neon, loop * 2));
+
+#ifdef DEBUG_TRACE
+            fprintf (stdout, "func: %d loop count: %d\n", func_loop, loop);
+#endif
+            /* the pow error grows with |y * ln|x||, at most 46 here */
+            if (func_loop == 0)
+                test_transcendental_check (thedst_c, thedst_neon, 0.0f, 1.0e-5f, loop);
+            else
+                test_transcendental_check (thedst_c, thedst_neon, 2.0e-7f, 5.0e-7f, loop * 2);
+        }
+    }
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = PERF_TEST_ITERATION * 2;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    test_transcendental_map_pow (perftest_thesrc1, perftest_thesrc2, perftest_thesrc1, perftest_thesrc2, perftest_length);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perftest_length);
+    NE10_DST_ALLOC (perftest_thedst_neon, perftest_guarded_dst_neon, perftest_length);
+
+    for (func_loop = 0; func_loop < TRANSCENDENTAL_BINARY_FUNC_COUNT; func_loop++)
+    {
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_transcendental_binary_run (func_loop, 0, perftest_thedst_c, perftest_thesrc1, perftest_thesrc2, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_transcendental_binary_run (func_loop, 1, perftest_thedst_neon, perftest_thesrc1, perftest_thesrc2, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+    free (perftest_guarded_dst_c);
+    free (perftest_guarded_dst_neon);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+/* float reductions: sum, minmax, argmin, argmax, mean_var, rms, norm_l1, norm_l2, norm_linf */
+#define REDUCE_FLOAT_FUNC_COUNT 9
+/* int32 then int16: sum, minmax, argmin, argmax, norm_l1, norm_linf */
+#define REDUCE_INT_FUNC_COUNT 12
+/* long enough to cover the 32-bit partial sums of the Q15 kernels */
+#define REDUCE_LONG_LENGTH 140005
+
+/* positions holding repeated extremes, so that ties between lanes are exercised */
+static const ne10_uint32_t test_reduce_min_pos[3] = { 2, 6, 50000 };
+static const ne10_uint32_t test_reduce_max_pos[3] = { 3, 9, 139999 };
+
+typedef struct
+{
+    ne10_result_t ret;
+    ne10_float32_t val[2];
+    ne10_int64_t ival[2];
+    ne10_uint32_t index;
+} test_reduce_out_t;
+
+static void test_reduce_float_run (ne10_int32_t func, ne10_int32_t is_neon, test_reduce_out_t * out, ne10_float32_t * src, ne10_uint32_t count)
+{
+    memset (out, 0, sizeof (test_reduce_out_t));
+    switch (func)
+    {
+    case 0:
+        out->ret = (is_neon ? ne10_sum_float_neon : ne10_sum_float_c) (&out->val[0], src, count);
+        break;
+    case 1:
+        out->ret = (is_neon ? ne10_minmax_float_neon : ne10_minmax_float_c) (&out->val[0], &out->val[1], src, count);
+        break;
+    case 2:
+        out->ret = (is_neon ? ne10_argmin_float_neon : ne10_argmin_float_c) (&out->val[0], &out->index, src, count);
+        break;
+    case 3:
+        out->ret = (is_neon ? ne10_argmax_float_neon : ne10_argmax_float_c) (&out->val[0], &out->index, src, count);
+        break;
+    case 4:
+        out->ret = (is_neon ? ne10_mean_var_float_neon : ne10_mean_var_float_c) (&out->val[0], &out->val[1], src, count);
+        break;
+    case 5:
+        out->ret = (is_neon ? ne10_rms_float_neon : ne10_rms_float_c) (&out->val[0], src, count);
+        break;
+    case 6:
+        out->ret = (is_neon ? ne10_norm_l1_float_neon : ne10_norm_l1_float_c) (&out->val[0], src, count);
+        break;
+    case 7:
+        out->ret = (is_neon ? ne10_norm_l2_float_neon : ne10_norm_l2_float_c) (&out->val[0], src, count);
+        break;
+    default:
+        out->ret = (is_neon ? ne10_norm_linf_float_neon : ne10_norm_linf_float_c) (&out->val[0], src, count);
+        break;
+    }
+}
+
+static void test_reduce_int_run (ne10_int32_t func, ne10_int32_t is_neon, test_reduce_out_t * out, void * src, ne10_uint32_t count)
+{
+    ne10_int32_t v32[2] = { 0, 0 };
+    ne10_int16_t v16[2] = { 0, 0 };
+    ne10_uint64_t l1 = 0;
+    ne10_uint32_t linf = 0;
+
+    memset (out, 0, sizeof (test_reduce_out_t));
+    switch (func)
+    {
+    case 0:
+        out->ret = (is_neon ? ne10_sum_int32_neon : ne10_sum_int32_c) (&out->ival[0], src, count);
+        break;
+    case 1:
+        out->ret = (is_neon ? ne10_minmax_int32_neon : ne10_minmax_int32_c) (&v32[0], &v32[1], src, count);
+        break;
+    case 2:
+        out->ret = (is_neon ? ne10_argmin_int32_neon : ne10_argmin_int32_c) (&v32[0], &out->index, src, count);
+        break;
+    case 3:
+        out->ret = (is_neon ? ne10_argmax_int32_neon : ne10_argmax_int32_c) (&v32[0], &out->index, src, count);
+        break;
+    case 4:
+        out->ret = (is_neon ? ne10_norm_l1_int32_neon : ne10_norm_l1_int32_c) (&l1, src, count);
+        break;
+    case 5:
+        out->ret = (is_neon ? ne10_norm_linf_int32_neon : ne10_norm_linf_int32_c) (&linf, src, count);
+        break;
+    case 6:
+        out->ret = (is_neon ? ne10_sum_int16_neon : ne10_sum_int16_c) (&out->ival[0], src, count);
+        break;
+    case 7:
+        out->ret = (is_neon ? ne10_minmax_int16_neon : ne10_minmax_int16_c) (&v16[0], &v16[1], src, count);
+        break;
+    case 8:
+        out->ret = (is_neon ? ne10_argmin_int16_neon : ne10_argmin_int16_c) (&v16[0], &out->index, src, count);
+        break;
+    case 9:
+        out->ret = (is_neon ? ne10_argmax_int16_neon : ne10_argmax_int16_c) (&v16[0], &out->index, src, count);
+        break;
+    case 10:
+        out->ret = (is_neon ? ne10_norm_l1_int16_neon : ne10_norm_l1_int16_c) (&l1, src, count);
+        break;
+    default:
+        out->ret = (is_neon ? ne10_norm_linf_int16_neon : ne10_norm_linf_int16_c) (&linf, src, count);
+        break;
+    }
+    if (func % 6 == 1 || func % 6 == 2 || func % 6 == 3)
+    {
+        out->ival[0] = (func < 6) ? v32[0] : v16[0];
+        out->ival[1] = (func < 6) ? v32[1] : v16[1];
+    }
+    else if (func % 6 == 4)
+        out->ival[0] = (ne10_int64_t) l1;
+    else if (func % 6 == 5)
+        out->ival[0] = linf;
+}
+
+/* the compensated sums of C and NEON differ by the order of accumulation only */
+static void test_reduce_float_check (ne10_int32_t func, test_reduce_out_t * out_c, test_reduce_out_t * out_neon, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_float64_t scale = 0.0;
+    ne10_float32_t tol;
+    ne10_uint32_t i;
+
+    assert_int_equal (out_c->ret, out_neon->ret);
+    if (out_c->ret != NE10_OK)
+        return;
+
+    for (i = 0; i < count; i++)
+        scale += fabs (src[i]);
+
+    switch (func)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 8:
+        /* selections are exact */
+        assert_true (out_c->val[0] == out_neon->val[0]);
+        assert_true (out_c->val[1] == out_neon->val[1]);
+        assert_int_equal (out_c->index, out_neon->index);
+        break;
+    case 4:
+        tol = (ne10_float32_t) (1.0e-6 * scale / count);
+        assert_true (fabsf (out_c->val[0] - out_neon->val[0]) <= tol);
+        assert_true (fabsf (out_c->val[1] - out_neon->val[1]) <= 1.0e-5f * out_c->val[1]);
+        break;
+    case 0:
+        assert_true (fabs (out_c->val[0] - out_neon->val[0]) <= 1.0e-6 * scale);
+        break;
+    default:
+        assert_true (fabsf (out_c->val[0] - out_neon->val[0]) <= 1.0e-6f * out_c->val[0]);
+        break;
+    }
+}
+
+static void test_reduce_float_fill (ne10_float32_t * src, ne10_uint32_t length)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < 3; i++)
+    {
+        if (test_reduce_min_pos[i] < length)
+            src[test_reduce_min_pos[i]] = -1000.5f;
+        if (test_reduce_max_pos[i] < length)
+            src[test_reduce_max_pos[i]] = 1000.5f;
+    }
+}
+
+/* convert the random source in place, to Q31 or to whole Q15 values with many repeats */
+static void test_reduce_int_fill (ne10_float32_t * src, ne10_uint32_t length, ne10_int32_t is_int16)
+{
+    ne10_int32_t * src32 = (ne10_int32_t*) src;
+    ne10_int16_t * src16 = (ne10_int16_t*) src;
+    ne10_uint32_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        if (is_int16)
+            src16[i] = (ne10_int16_t) src[i];
+        else
+            src32[i] = (ne10_int32_t) (src[i] * 1.0e-3f * 2147483520.0f);
+    }
+    for (i = 0; i < 3; i++)
+    {
+        if (test_reduce_min_pos[i] < length)
+        {
+            if (is_int16)
+                src16[test_reduce_min_pos[i]] = -32768;
+            else
+                src32[test_reduce_min_pos[i]] = (ne10_int32_t) 0x80000000;
+        }
+        if (test_reduce_max_pos[i] < length)
+        {
+            if (is_int16)
+                src16[test_reduce_max_pos[i]] = 32767;
+            else
+                src32[test_reduce_max_pos[i]] = 0x7fffffff;
+        }
+    }
+}
+
+void test_reduce_case0()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+    test_reduce_out_t out_c, out_neon;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    const ne10_uint32_t fixed_length = REDUCE_LONG_LENGTH;
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    test_reduce_float_fill (thesrc1, fixed_length);
+
+    for (func_loop = 0; func_loop < REDUCE_FLOAT_FUNC_COUNT; func_loop++)
+    {
+        /* every short length, then the whole array */
+        for (loop = 0; loop <= TEST_ITERATION; loop++)
+        {
+            ne10_uint32_t count = (loop < TEST_ITERATION) ? (ne10_uint32_t) loop : fixed_length;
+
+            test_reduce_float_run (func_loop, 0, &out_c, thesrc1, count);
+            test_reduce_float_run (func_loop, 1, &out_neon, thesrc1, count);
+
+#ifdef DEBUG_TRACE
+            fprintf (stdout, "func: %d count: %d c: %e %e %d neon: %e %e %d\n", func_loop, count,
+                     out_c.val[0], out_c.val[1], out_c.index, out_neon.val[0], out_neon.val[1], out_neon.index);
+#endif
+            test_reduce_float_check (func_loop, &out_c, &out_neon, thesrc1, count);
+        }
+    }
+    free (guarded_src1);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = PERF_TEST_ITERATION;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    for (func_loop = 0; func_loop < REDUCE_FLOAT_FUNC_COUNT; func_loop++)
+    {
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_reduce_float_run (func_loop, 0, &out_c, perftest_thesrc1, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_reduce_float_run (func_loop, 1, &out_neon, perftest_thesrc1, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_reduce_case1()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+    test_reduce_out_t out_c, out_neon;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    const ne10_uint32_t fixed_length = REDUCE_LONG_LENGTH;
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    for (func_loop = 0; func_loop < REDUCE_INT_FUNC_COUNT; func_loop++)
+    {
+        /* the Q15 data is derived from the Q31 data */
+        if (func_loop == 0 || func_loop == 6)
+            test_reduce_int_fill (thesrc1, fixed_length, func_loop == 6);
+
+        for (loop = 0; loop <= TEST_ITERATION; loop++)
+        {
+            ne10_uint32_t count = (loop < TEST_ITERATION) ? (ne10_uint32_t) loop : fixed_length;
+
+            test_reduce_int_run (func_loop, 0, &out_c, thesrc1, count);
+            test_reduce_int_run (func_loop, 1, &out_neon, thesrc1, count);
+
+#ifdef DEBUG_TRACE
+            fprintf (stdout, "func: %d count: %d c: %lld %lld %d neon: %lld %lld %d\n", func_loop, count,
+                     out_c.ival[0], out_c.ival[1], out_c.index, out_neon.ival[0], out_neon.ival[1], out_neon.index);
+#endif
+            /* the fixed-point reductions are exact */
+            assert_int_equal (out_c.ret, out_neon.ret);
+            assert_true (out_c.ival[0] == out_neon.ival[0]);
+            assert_true (out_c.ival[1] == out_neon.ival[1]);
+            assert_int_equal (out_c.index, out_neon.index);
+        }
+    }
+    free (guarded_src1);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = PERF_TEST_ITERATION;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    for (func_loop = 0; func_loop < REDUCE_INT_FUNC_COUNT; func_loop++)
+    {
+        if (func_loop == 0 || func_loop == 6)
+            test_reduce_int_fill (perftest_thesrc1, perftest_length, func_loop == 6);
+
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_reduce_int_run (func_loop, 0, &out_c, perftest_thesrc1, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_reduce_int_run (func_loop, 1, &out_neon, perftest_thesrc1, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+/* m, n, k: odd sizes, sizes crossing the 64 x 256 x 256 cache blocks, and exact tiles */
+#define GEMM_SHAPE_COUNT 7
+static const ne10_uint32_t test_gemm_shape[GEMM_SHAPE_COUNT][3] =
+{
+    { 1, 1, 1 }, { 5, 7, 3 }, { 4, 8, 16 }, { 16, 16, 16 }, { 33, 17, 65 }, { 3, 300, 2 }, { 70, 300, 260 }
+};
+/* alpha, beta */
+#define GEMM_SCALE_COUNT 3
+static const ne10_float32_t test_gemm_scale[GEMM_SCALE_COUNT][2] = { { 1.0f, 0.0f }, { 0.5f, -2.0f }, { -1.5f, 1.0f } };
+/* extra elements per row (or column), so that leading dimensions exceed the sizes */
+#define GEMM_LD_PAD 3
+#define GEMM_POOL_LENGTH (300 * (300 + GEMM_LD_PAD))
+#define GEMM_PAD_VALUE 12345.0f
+
+typedef ne10_result_t (*test_gemm_func_t) (ne10_matrix_layout_t, ne10_matrix_trans_t, ne10_matrix_trans_t, ne10_uint32_t, ne10_uint32_t, ne10_uint32_t,
+        ne10_float32_t, ne10_float32_t *, ne10_uint32_t, ne10_float32_t *, ne10_uint32_t, ne10_float32_t, ne10_float32_t *, ne10_uint32_t);
+typedef ne10_result_t (*test_gemv_func_t) (ne10_matrix_layout_t, ne10_matrix_trans_t, ne10_uint32_t, ne10_uint32_t,
+        ne10_float32_t, ne10_float32_t *, ne10_uint32_t, ne10_float32_t *, ne10_float32_t, ne10_float32_t *);
+
+/* leading dimension of a rows x cols operand */
+static ne10_uint32_t test_gemm_ld (ne10_matrix_layout_t layout, ne10_uint32_t rows, ne10_uint32_t cols)
+{
+    return ( (layout == NE10_ROW_MAJOR) ? cols : rows) + GEMM_LD_PAD;
+}
+
+/* fill an output operand; the padding gets a sentinel, and the data NaN when it must not be read */
+static void test_gemm_fill_out (ne10_float32_t * dst, ne10_float32_t * init, ne10_uint32_t outer, ne10_uint32_t inner, ne10_uint32_t ld, ne10_int32_t unread)
+{
+    ne10_uint32_t i, j;
+
+    for (i = 0; i < outer; i++)
+    {
+        for (j = 0; j < ld; j++)
+            dst[i * ld + j] = (j >= inner) ? GEMM_PAD_VALUE : (unread ? NAN : init[i * ld + j]);
+    }
+}
+
+static void test_gemm_check_out (ne10_float32_t * ref, ne10_float32_t * out, ne10_uint32_t outer, ne10_uint32_t inner, ne10_uint32_t ld, ne10_float32_t tol)
+{
+    ne10_uint32_t i, j;
+
+    for (i = 0; i < outer; i++)
+    {
+        for (j = 0; j < ld; j++)
+        {
+            if (j >= inner)
+            {
+                assert_true (ref[i * ld + j] == GEMM_PAD_VALUE && out[i * ld + j] == GEMM_PAD_VALUE);
+                continue;
+            }
+#ifdef DEBUG_TRACE
+            if (! (fabsf (ref[i * ld + j] - out[i * ld + j]) <= tol))
+                fprintf (stdout, "position: %d %d c: %e neon: %e\n", i, j, ref[i * ld + j], out[i * ld + j]);
+#endif
+            assert_true (fabsf (ref[i * ld + j] - out[i * ld + j]) <= tol);
+        }
+    }
+}
+
+void test_gemm_case0()
+{
+    ne10_int32_t shape, scale, op;
+    ne10_float32_t * init;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    /* init src memory: values in [-1, 1]; the pool provides A, B and the initial C */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, GEMM_POOL_LENGTH); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, GEMM_POOL_LENGTH); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thecst, guarded_cst, GEMM_POOL_LENGTH); // 16 extra bytes at the begining and 16 extra bytes at the end
+    test_cpx_normalize (thesrc1, GEMM_POOL_LENGTH);
+    test_cpx_normalize (thesrc2, GEMM_POOL_LENGTH);
+    test_cpx_normalize (thecst, GEMM_POOL_LENGTH);
+    init = thecst;
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, GEMM_POOL_LENGTH);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, GEMM_POOL_LENGTH);
+
+    for (shape = 0; shape < GEMM_SHAPE_COUNT; shape++)
+    {
+        ne10_uint32_t m = test_gemm_shape[shape][0];
+        ne10_uint32_t n = test_gemm_shape[shape][1];
+        ne10_uint32_t k = test_gemm_shape[shape][2];
+        /* the float rounding grows with the length of the dot products */
+        ne10_float32_t tol = 1.0e-6f * (k + 1);
+
+        /* op bits: layout, trans_a, trans_b */
+        for (op = 0; op < 8; op++)
+        {
+            ne10_matrix_layout_t layout = (op & 1) ? NE10_COL_MAJOR : NE10_ROW_MAJOR;
+            ne10_matrix_trans_t trans_a = (op & 2) ? NE10_TRANS : NE10_NO_TRANS;
+            ne10_matrix_trans_t trans_b = (op & 4) ? NE10_TRANS : NE10_NO_TRANS;
+            ne10_uint32_t lda = (trans_a == NE10_NO_TRANS) ? test_gemm_ld (layout, m, k) : test_gemm_ld (layout, k, m);
+            ne10_uint32_t ldb = (trans_b == NE10_NO_TRANS) ? test_gemm_ld (layout, k, n) : test_gemm_ld (layout, n, k);
+            ne10_uint32_t ldc = test_gemm_ld (layout, m, n);
+            ne10_uint32_t outer = (layout == NE10_ROW_MAJOR) ? m : n;
+            ne10_uint32_t inner = (layout == NE10_ROW_MAJOR) ? n : m;
+
+            for (scale = 0; scale < GEMM_SCALE_COUNT; scale++)
+            {
+                ne10_float32_t alpha = test_gemm_scale[scale][0];
+                ne10_float32_t beta = test_gemm_scale[scale][1];
+
+                test_gemm_fill_out (thedst_c, init, outer, inner, ldc, beta == 0.0f);
+                test_gemm_fill_out (thedst_neon, init, outer, inner, ldc, beta == 0.0f);
+
+                assert_int_equal (NE10_OK, ne10_gemm_f32_c (layout, trans_a, trans_b, m, n, k, alpha, thesrc1, lda, thesrc2, ldb, beta, thedst_c, ldc));
+                assert_int_equal (NE10_OK, ne10_gemm_f32_neon (layout, trans_a, trans_b, m, n, k, alpha, thesrc1, lda, thesrc2, ldb, beta, thedst_neon, ldc));
+
+#ifdef DEBUG_TRACE
+                fprintf (stdout, "m: %d n: %d k: %d op: %d alpha: %f beta: %f\n", m, n, k, op, alpha, beta);
+#endif
+                test_gemm_check_out (thedst_c, thedst_neon, outer, inner, ldc, tol);
+            }
+        }
+    }
+
+    /* leading dimensions shorter than the rows are rejected */
+    assert_int_equal (NE10_ERR, ne10_gemm_f32_c (NE10_ROW_MAJOR, NE10_NO_TRANS, NE10_NO_TRANS, 4, 4, 4, 1.0f, thesrc1, 3, thesrc2, 4, 0.0f, thedst_c, 4));
+    assert_int_equal (NE10_ERR, ne10_gemm_f32_neon (NE10_ROW_MAJOR, NE10_NO_TRANS, NE10_NO_TRANS, 4, 4, 4, 1.0f, thesrc1, 3, thesrc2, 4, 0.0f, thedst_neon, 4));
+
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_cst);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_int32_t loop;
+    ne10_uint32_t size;
+    test_gemm_func_t func_c = ne10_gemm_f32_c;
+    test_gemm_func_t func_neon = ne10_gemm_f32_neon;
+
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Size", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = 256 * 256;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perftest_length);
+    NE10_DST_ALLOC (perftest_thedst_neon, perftest_guarded_dst_neon, perftest_length);
+
+    /* square products against the naive triple loop of the C version */
+    for (size = 16; size <= 256; size *= 4)
+    {
+        ne10_int32_t iterations = (256 / size) * (256 / size) * (256 / size);
+
+        GET_TIME (time_c,
+                  for (loop = 0; loop < iterations; loop++) func_c (NE10_ROW_MAJOR, NE10_NO_TRANS, NE10_NO_TRANS, size, size, size, 1.0f, perftest_thesrc1, size, perftest_thesrc2, size, 0.0f, perftest_thedst_c, size);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < iterations; loop++) func_neon (NE10_ROW_MAJOR, NE10_NO_TRANS, NE10_NO_TRANS, size, size, size, 1.0f, perftest_thesrc1, size, perftest_thesrc2, size, 0.0f, perftest_thedst_neon, size);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", size, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+    free (perftest_guarded_dst_c);
+    free (perftest_guarded_dst_neon);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_gemm_case1()
+{
+    ne10_int32_t shape, scale, op;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    /* init src memory: values in [-1, 1]; thecst holds the initial y */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, GEMM_POOL_LENGTH); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, GEMM_POOL_LENGTH); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thecst, guarded_cst, GEMM_POOL_LENGTH); // 16 extra bytes at the begining and 16 extra bytes at the end
+    test_cpx_normalize (thesrc1, GEMM_POOL_LENGTH);
+    test_cpx_normalize (thesrc2, GEMM_POOL_LENGTH);
+    test_cpx_normalize (thecst, GEMM_POOL_LENGTH);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, GEMM_POOL_LENGTH);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, GEMM_POOL_LENGTH);
+
+    /* m x n matrices taken from the GEMM shapes */
+    for (shape = 0; shape < GEMM_SHAPE_COUNT; shape++)
+    {
+        ne10_uint32_t m = test_gemm_shape[shape][1];
+        ne10_uint32_t n = test_gemm_shape[shape][2];
+
+        /* op bits: layout, trans */
+        for (op = 0; op < 4; op++)
+        {
+            ne10_matrix_layout_t layout = (op & 1) ? NE10_COL_MAJOR : NE10_ROW_MAJOR;
+            ne10_matrix_trans_t trans = (op & 2) ? NE10_TRANS : NE10_NO_TRANS;
+            ne10_uint32_t lda = test_gemm_ld (layout, m, n);
+            ne10_uint32_t len_y = (trans == NE10_NO_TRANS) ? m : n;
+            ne10_uint32_t len_x = (trans == NE10_NO_TRANS) ? n : m;
+            ne10_float32_t tol = 1.0e-6f * (len_x + 1);
+
+            for (scale = 0; scale < GEMM_SCALE_COUNT; scale++)
+            {
+                ne10_float32_t alpha = test_gemm_scale[scale][0];
+                ne10_float32_t beta = test_gemm_scale[scale][1];
+
+                /* y as a single row, followed by a sentinel */
+                test_gemm_fill_out (thedst_c, thecst, 1, len_y, len_y + 1, beta == 0.0f);
+                test_gemm_fill_out (thedst_neon, thecst, 1, len_y, len_y + 1, beta == 0.0f);
+
+                assert_int_equal (NE10_OK, ne10_gemv_f32_c (layout, trans, m, n, alpha, thesrc1, lda, thesrc2, beta, thedst_c));
+                assert_int_equal (NE10_OK, ne10_gemv_f32_neon (layout, trans, m, n, alpha, thesrc1, lda, thesrc2, beta, thedst_neon));
+
+#ifdef DEBUG_TRACE
+                fprintf (stdout, "m: %d n: %d op: %d alpha: %f beta: %f\n", m, n, op, alpha, beta);
+#endif
+                test_gemm_check_out (thedst_c, thedst_neon, 1, len_y, len_y + 1, tol);
+            }
+        }
+    }
+
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_cst);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_int32_t loop;
+    ne10_uint32_t size;
+    test_gemv_func_t func_c = ne10_gemv_f32_c;
+    test_gemv_func_t func_neon = ne10_gemv_f32_neon;
+
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Size", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = 256 * 256;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perftest_length);
+    NE10_DST_ALLOC (perftest_thedst_neon, perftest_guarded_dst_neon, perftest_length);
+
+    /* square matrices, both as stored and transposed */
+    for (op = 0; op < 2; op++)
+    {
+        for (size = 16; size <= 256; size *= 4)
+        {
+            ne10_int32_t iterations = (256 / size) * (256 / size) * 16;
+            ne10_matrix_trans_t trans = op ? NE10_TRANS : NE10_NO_TRANS;
+
+            GET_TIME (time_c,
+                      for (loop = 0; loop < iterations; loop++) func_c (NE10_ROW_MAJOR, trans, size, size, 1.0f, perftest_thesrc1, size, perftest_thesrc2, 0.0f, perftest_thedst_c);
+                     );
+            GET_TIME (time_neon,
+                      for (loop = 0; loop < iterations; loop++) func_neon (NE10_ROW_MAJOR, trans, size, size, 1.0f, perftest_thesrc1, size, perftest_thesrc2, 0.0f, perftest_thedst_neon);
+                     );
+            time_speedup = (ne10_float32_t) time_c / time_neon;
+            time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+            ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", size, time_c, time_neon, time_savings, time_speedup);
+        }
+    }
+
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+    free (perftest_guarded_dst_c);
+    free (perftest_guarded_dst_neon);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+/* the GEMM shapes, and one crossing the 512-deep cache block of k of the int8 version */
+#define GEMM_S8_SHAPE_COUNT (GEMM_SHAPE_COUNT + 1)
+#define GEMM_S8_PAD_VALUE 12345
+#define GEMM_S8_DOT_LENGTH 90001
+
+typedef ne10_result_t (*test_gemm_s8_func_t) (ne10_matrix_layout_t, ne10_matrix_trans_t, ne10_matrix_trans_t, ne10_uint32_t, ne10_uint32_t, ne10_uint32_t,
+        ne10_int8_t *, ne10_uint32_t, ne10_int8_t *, ne10_uint32_t, ne10_int32_t *, ne10_uint32_t);
+typedef ne10_result_t (*test_dot_s8_func_t) (ne10_int32_t *, ne10_int8_t *, ne10_int8_t *, ne10_uint32_t);
+
+/* int8 data from the float pool, with every 7th value at -128 to hit the largest products */
+static void test_gemm_s8_fill (ne10_int8_t * dst, ne10_float32_t * src, ne10_uint32_t length)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < length; i++)
+        dst[i] = (i % 7 == 3) ? -128 : (ne10_int8_t) (src[i] * 1.0e-3f * 127.0f);
+}
+
+static void test_gemm_s8_fill_out (ne10_int32_t * dst, ne10_uint32_t outer, ne10_uint32_t inner, ne10_uint32_t ld)
+{
+    ne10_uint32_t i, j;
+
+    for (i = 0; i < outer; i++)
+    {
+        for (j = 0; j < ld; j++)
+            dst[i * ld + j] = (j >= inner) ? GEMM_S8_PAD_VALUE : (ne10_int32_t) 0xdeadbeef;
+    }
+}
+
+void test_gemm_s8_case0()
+{
+    ne10_int32_t shape, op, loop, alt;
+    ne10_int8_t * a;
+    ne10_int8_t * b;
+    ne10_int32_t dot_c, dot_neon;
+    test_gemm_s8_func_t gemm_neon[2] = { ne10_gemm_s8s8s32_neon, NULL };
+    test_dot_s8_func_t dot_neon_func[2] = { ne10_dot_s8_neon, NULL };
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (__aarch64__)
+    /* the SDOT versions are checked too, where the CPU has them */
+    if (ne10_HasDotProd() == NE10_OK)
+    {
+        gemm_neon[1] = ne10_gemm_s8s8s32_dotprod;
+        dot_neon_func[1] = ne10_dot_s8_dotprod;
+    }
+#endif
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    /* init src memory: A and B as int8 in the float pools, the largest being 9 x 1030 */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, GEMM_POOL_LENGTH); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, GEMM_POOL_LENGTH); // 16 extra bytes at the begining and 16 extra bytes at the end
+    a = (ne10_int8_t*) thesrc1;
+    b = (ne10_int8_t*) thesrc2;
+    test_gemm_s8_fill (a, thesrc1, GEMM_POOL_LENGTH);
+    test_gemm_s8_fill (b, thesrc2, GEMM_POOL_LENGTH);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, GEMM_POOL_LENGTH);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, GEMM_POOL_LENGTH);
+
+    for (alt = 0; alt < 2 && gemm_neon[alt] != NULL; alt++)
+    {
+        for (shape = 0; shape < GEMM_S8_SHAPE_COUNT; shape++)
+        {
+            ne10_uint32_t m = (shape < GEMM_SHAPE_COUNT) ? test_gemm_shape[shape][0] : 9;
+            ne10_uint32_t n = (shape < GEMM_SHAPE_COUNT) ? test_gemm_shape[shape][1] : 20;
+            ne10_uint32_t k = (shape < GEMM_SHAPE_COUNT) ? test_gemm_shape[shape][2] : 1030;
+
+            /* op bits: layout, trans_a, trans_b */
+            for (op = 0; op < 8; op++)
+            {
+                ne10_matrix_layout_t layout = (op & 1) ? NE10_COL_MAJOR : NE10_ROW_MAJOR;
+                ne10_matrix_trans_t trans_a = (op & 2) ? NE10_TRANS : NE10_NO_TRANS;
+                ne10_matrix_trans_t trans_b = (op & 4) ? NE10_TRANS : NE10_NO_TRANS;
+                ne10_uint32_t lda = (trans_a == NE10_NO_TRANS) ? test_gemm_ld (layout, m, k) : test_gemm_ld (layout, k, m);
+                ne10_uint32_t ldb = (trans_b == NE10_NO_TRANS) ? test_gemm_ld (layout, k, n) : test_gemm_ld (layout, n, k);
+                ne10_uint32_t ldc = test_gemm_ld (layout, m, n);
+                ne10_uint32_t outer = (layout == NE10_ROW_MAJOR) ? m : n;
+                ne10_uint32_t inner = (layout == NE10_ROW_MAJOR) ? n : m;
+                ne10_int32_t * c_c = (ne10_int32_t*) thedst_c;
+                ne10_int32_t * c_neon = (ne10_int32_t*) thedst_neon;
+                ne10_uint32_t i, j;
+
+                test_gemm_s8_fill_out (c_c, outer, inner, ldc);
+                test_gemm_s8_fill_out (c_neon, outer, inner, ldc);
+
+                assert_int_equal (NE10_OK, ne10_gemm_s8s8s32_c (layout, trans_a, trans_b, m, n, k, a, lda, b, ldb, c_c, ldc));
+                assert_int_equal (NE10_OK, gemm_neon[alt] (layout, trans_a, trans_b, m, n, k, a, lda, b, ldb, c_neon, ldc));
+
+                /* the integer products are exact, and the padding is left alone */
+                for (i = 0; i < outer; i++)
+                {
+                    for (j = 0; j < ldc; j++)
+                    {
+#ifdef DEBUG_TRACE
+                        if (c_c[i * ldc + j] != c_neon[i * ldc + j])
+                            fprintf (stdout, "m: %d n: %d k: %d op: %d position: %d %d c: %d neon: %d\n", m, n, k, op, i, j, c_c[i * ldc + j], c_neon[i * ldc + j]);
+#endif
+                        assert_int_equal (c_c[i * ldc + j], c_neon[i * ldc + j]);
+                    }
+                }
+            }
+        }
+
+        /* the largest products, -128 * -128, over three cache blocks of k, past the int8 data in the pools */
+        memset (a + GEMM_POOL_LENGTH, -128, 1030);
+        memset (b + GEMM_POOL_LENGTH, -128, 1030);
+        assert_int_equal (NE10_OK, gemm_neon[alt] (NE10_ROW_MAJOR, NE10_NO_TRANS, NE10_TRANS, 1, 1, 1030, a + GEMM_POOL_LENGTH, 1030,
+                          b + GEMM_POOL_LENGTH, 1030, (ne10_int32_t*) thedst_neon, 1));
+        assert_int_equal (16384 * 1030, ((ne10_int32_t*) thedst_neon)[0]);
+
+        /* leading dimensions shorter than the rows are rejected */
+        assert_int_equal (NE10_ERR, gemm_neon[alt] (NE10_ROW_MAJOR, NE10_NO_TRANS, NE10_NO_TRANS, 4, 4, 4, a, 3, b, 4, (ne10_int32_t*) thedst_neon, 4));
+
+        /* dot products of every short length, and a long one */
+        for (loop = 0; loop <= TEST_ITERATION; loop++)
+        {
+            ne10_uint32_t count = (loop < TEST_ITERATION) ? (ne10_uint32_t) loop : GEMM_S8_DOT_LENGTH;
+
+            assert_int_equal (NE10_OK, ne10_dot_s8_c (&dot_c, a, b, count));
+            assert_int_equal (NE10_OK, dot_neon_func[alt] (&dot_neon, a, b, count));
+            assert_int_equal (dot_c, dot_neon);
+        }
+    }
+    assert_int_equal (NE10_ERR, ne10_gemm_s8s8s32_c (NE10_ROW_MAJOR, NE10_NO_TRANS, NE10_NO_TRANS, 4, 4, 4, a, 3, b, 4, (ne10_int32_t*) thedst_c, 4));
+
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint32_t size;
+    test_gemm_s8_func_t func_c = ne10_gemm_s8s8s32_c;
+    test_gemm_s8_func_t func_neon = gemm_neon[ (gemm_neon[1] != NULL) ? 1 : 0];
+
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Size", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = 256 * 256;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    a = (ne10_int8_t*) perftest_thesrc1;
+    b = (ne10_int8_t*) perftest_thesrc2;
+    test_gemm_s8_fill (a, perftest_thesrc1, perftest_length);
+    test_gemm_s8_fill (b, perftest_thesrc2, perftest_length);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perftest_length);
+    NE10_DST_ALLOC (perftest_thedst_neon, perftest_guarded_dst_neon, perftest_length);
+
+    /* square products against the naive triple loop of the C version */
+    for (size = 16; size <= 256; size *= 4)
+    {
+        ne10_int32_t iterations = (256 / size) * (256 / size) * (256 / size);
+
+        GET_TIME (time_c,
+                  for (loop = 0; loop < iterations; loop++) func_c (NE10_ROW_MAJOR, NE10_NO_TRANS, NE10_NO_TRANS, size, size, size, a, size, b, size, (ne10_int32_t*) perftest_thedst_c, size);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < iterations; loop++) func_neon (NE10_ROW_MAJOR, NE10_NO_TRANS, NE10_NO_TRANS, size, size, size, a, size, b, size, (ne10_int32_t*) perftest_thedst_neon, size);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", size, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+    free (perftest_guarded_dst_c);
+    free (perftest_guarded_dst_neon);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+/* channels: a full group of eight, a partial one, and the boundary values of every parameter */
+#define REQUANT_CHANNELS 19
+#define REQUANT_ROWS 5
+
+void test_gemm_s8_case1()
+{
+    ne10_int32_t src[REQUANT_ROWS * (REQUANT_CHANNELS + 1)];
+    ne10_int32_t bias[REQUANT_CHANNELS], multiplier[REQUANT_CHANNELS], shift[REQUANT_CHANNELS];
+    ne10_int8_t dst_c[REQUANT_ROWS * (REQUANT_CHANNELS + 2)], dst_neon[REQUANT_ROWS * (REQUANT_CHANNELS + 2)];
+    const ne10_int8_t zero_points[4] = { 0, -128, 127, 5 };
+    ne10_int32_t loop, zp, use_bias;
+    ne10_uint32_t i, lds = REQUANT_CHANNELS + 1, ldd = REQUANT_CHANNELS + 2;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    /* hand-checked values: 1000 * 0.5 >> 2 = 125, 10 * 0.5 >> 1 rounds 2.5 up to 3, -10 * 0.5 >> 1 rounds -2.5 up to -2 */
+    src[0] = 1000;
+    src[1] = 10;
+    src[2] = -10;
+    multiplier[0] = multiplier[1] = multiplier[2] = 1 << 30;
+    shift[0] = 2;
+    shift[1] = shift[2] = 1;
+    assert_int_equal (NE10_OK, ne10_requantize_s32s8_c (dst_c, 3, src, 3, 1, 3, NULL, multiplier, shift, 0));
+    assert_int_equal (NE10_OK, ne10_requantize_s32s8_neon (dst_neon, 3, src, 3, 1, 3, NULL, multiplier, shift, 0));
+    assert_int_equal (125, dst_c[0]);
+    assert_int_equal (3, dst_c[1]);
+    assert_int_equal (-2, dst_c[2]);
+    assert_int_equal (0, memcmp (dst_c, dst_neon, 3));
+
+    for (loop = 0; loop < TEST_ITERATION; loop++)
+    {
+        for (i = 0; i < REQUANT_ROWS * lds; i++)
+            src[i] = (ne10_int32_t) (rand() * 2u + (rand() & 1));
+        for (i = 0; i < REQUANT_CHANNELS; i++)
+        {
+            bias[i] = (rand() % 2001) - 1000;
+            multiplier[i] = (ne10_int32_t) (rand() * 2u + (rand() & 1));
+            shift[i] = rand() % 32;
+        }
+        /* saturating corners: the multiply of two INT32_MIN, and the bias add at both ends */
+        src[0] = (ne10_int32_t) 0x80000000;
+        multiplier[0] = (ne10_int32_t) 0x80000000;
+        bias[0] = 0;
+        src[1] = 0x7fffffff;
+        bias[1] = 1000;
+        src[2] = (ne10_int32_t) 0x80000000;
+        bias[2] = -1000;
+        shift[3] = 0;
+        shift[4] = 31;
+
+        for (zp = 0; zp < 4; zp++)
+        {
+            for (use_bias = 0; use_bias < 2; use_bias++)
+            {
+                memset (dst_c, 0x55, sizeof (dst_c));
+                memset (dst_neon, 0x55, sizeof (dst_neon));
+                assert_int_equal (NE10_OK, ne10_requantize_s32s8_c (dst_c, ldd, src, lds, REQUANT_ROWS, REQUANT_CHANNELS,
+                                  use_bias ? bias : NULL, multiplier, shift, zero_points[zp]));
+                assert_int_equal (NE10_OK, ne10_requantize_s32s8_neon (dst_neon, ldd, src, lds, REQUANT_ROWS, REQUANT_CHANNELS,
+                                  use_bias ? bias : NULL, multiplier, shift, zero_points[zp]));
+                /* bit-exact, padding included */
+                assert_int_equal (0, memcmp (dst_c, dst_neon, sizeof (dst_c)));
+            }
+        }
+    }
+
+    /* shifts outside [0, 31] are rejected */
+    shift[5] = 32;
+    assert_int_equal (NE10_ERR, ne10_requantize_s32s8_c (dst_c, ldd, src, lds, REQUANT_ROWS, REQUANT_CHANNELS, bias, multiplier, shift, 0));
+    assert_int_equal (NE10_ERR, ne10_requantize_s32s8_neon (dst_neon, ldd, src, lds, REQUANT_ROWS, REQUANT_CHANNELS, bias, multiplier, shift, 0));
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+/* component arrays of a structure-of-arrays set, each with its own guards */
+#define SOA_STRIDE (TEST_ITERATION + 2 * ARRAY_GUARD_LEN)
+#define SOA_FUNC_COUNT 19
+
+typedef struct
+{
+    ne10_func_4args_t func4[3];     /* C, NEON, interleaved C reference */
+    ne10_func_3args_t func3[3];
+    ne10_uint32_t dim;
+    ne10_uint32_t dst_dim;          /* 1 when the result is one float per vector */
+} test_soa_func_t;
+
+static const test_soa_func_t test_soa_func[SOA_FUNC_COUNT] =
+{
+    { { (ne10_func_4args_t) ne10_add_vec2f_soa_c, (ne10_func_4args_t) ne10_add_vec2f_soa_neon, (ne10_func_4args_t) ne10_add_vec2f_c }, { NULL, NULL, NULL }, 2, 2 },
+    { { (ne10_func_4args_t) ne10_add_vec3f_soa_c, (ne10_func_4args_t) ne10_add_vec3f_soa_neon, (ne10_func_4args_t) ne10_add_vec3f_c }, { NULL, NULL, NULL }, 3, 3 },
+    { { (ne10_func_4args_t) ne10_add_vec4f_soa_c, (ne10_func_4args_t) ne10_add_vec4f_soa_neon, (ne10_func_4args_t) ne10_add_vec4f_c }, { NULL, NULL, NULL }, 4, 4 },
+    { { (ne10_func_4args_t) ne10_sub_vec2f_soa_c, (ne10_func_4args_t) ne10_sub_vec2f_soa_neon, (ne10_func_4args_t) ne10_sub_vec2f_c }, { NULL, NULL, NULL }, 2, 2 },
+    { { (ne10_func_4args_t) ne10_sub_vec3f_soa_c, (ne10_func_4args_t) ne10_sub_vec3f_soa_neon, (ne10_func_4args_t) ne10_sub_vec3f_c }, { NULL, NULL, NULL }, 3, 3 },
+    { { (ne10_func_4args_t) ne10_sub_vec4f_soa_c, (ne10_func_4args_t) ne10_sub_vec4f_soa_neon, (ne10_func_4args_t) ne10_sub_vec4f_c }, { NULL, NULL, NULL }, 4, 4 },
+    { { (ne10_func_4args_t) ne10_vmul_vec2f_soa_c, (ne10_func_4args_t) ne10_vmul_vec2f_soa_neon, (ne10_func_4args_t) ne10_vmul_vec2f_c }, { NULL, NULL, NULL }, 2, 2 },
+    { { (ne10_func_4args_t) ne10_vmul_vec3f_soa_c, (ne10_func_4args_t) ne10_vmul_vec3f_soa_neon, (ne10_func_4args_t) ne10_vmul_vec3f_c }, { NULL, NULL, NULL }, 3, 3 },
+    { { (ne10_func_4args_t) ne10_vmul_vec4f_soa_c, (ne10_func_4args_t) ne10_vmul_vec4f_soa_neon, (ne10_func_4args_t) ne10_vmul_vec4f_c }, { NULL, NULL, NULL }, 4, 4 },
+    { { (ne10_func_4args_t) ne10_dot_vec2f_soa_c, (ne10_func_4args_t) ne10_dot_vec2f_soa_neon, (ne10_func_4args_t) ne10_dot_vec2f_c }, { NULL, NULL, NULL }, 2, 1 },
+    { { (ne10_func_4args_t) ne10_dot_vec3f_soa_c, (ne10_func_4args_t) ne10_dot_vec3f_soa_neon, (ne10_func_4args_t) ne10_dot_vec3f_c }, { NULL, NULL, NULL }, 3, 1 },
+    { { (ne10_func_4args_t) ne10_dot_vec4f_soa_c, (ne10_func_4args_t) ne10_dot_vec4f_soa_neon, (ne10_func_4args_t) ne10_dot_vec4f_c }, { NULL, NULL, NULL }, 4, 1 },
+    { { (ne10_func_4args_t) ne10_cross_vec3f_soa_c, (ne10_func_4args_t) ne10_cross_vec3f_soa_neon, (ne10_func_4args_t) ne10_cross_vec3f_c }, { NULL, NULL, NULL }, 3, 3 },
+    { { NULL, NULL, NULL }, { (ne10_func_3args_t) ne10_len_vec2f_soa_c, (ne10_func_3args_t) ne10_len_vec2f_soa_neon, (ne10_func_3args_t) ne10_len_vec2f_c }, 2, 1 },
+    { { NULL, NULL, NULL }, { (ne10_func_3args_t) ne10_len_vec3f_soa_c, (ne10_func_3args_t) ne10_len_vec3f_soa_neon, (ne10_func_3args_t) ne10_len_vec3f_c }, 3, 1 },
+    { { NULL, NULL, NULL }, { (ne10_func_3args_t) ne10_len_vec4f_soa_c, (ne10_func_3args_t) ne10_len_vec4f_soa_neon, (ne10_func_3args_t) ne10_len_vec4f_c }, 4, 1 },
+    { { NULL, NULL, NULL }, { (ne10_func_3args_t) ne10_normalize_vec2f_soa_c, (ne10_func_3args_t) ne10_normalize_vec2f_soa_neon, (ne10_func_3args_t) ne10_normalize_vec2f_c }, 2, 2 },
+    { { NULL, NULL, NULL }, { (ne10_func_3args_t) ne10_normalize_vec3f_soa_c, (ne10_func_3args_t) ne10_normalize_vec3f_soa_neon, (ne10_func_3args_t) ne10_normalize_vec3f_c }, 3, 3 },
+    { { NULL, NULL, NULL }, { (ne10_func_3args_t) ne10_normalize_vec4f_soa_c, (ne10_func_3args_t) ne10_normalize_vec4f_soa_neon, (ne10_func_3args_t) ne10_normalize_vec4f_c }, 4, 4 },
+};
+
+/* aos_to_soa and soa_to_aos for 2, 3 and 4 components: C, NEON */
+static const ne10_func_3args_t test_aos_to_soa[3][2] =
+{
+    { (ne10_func_3args_t) ne10_vec2f_aos_to_soa_c, (ne10_func_3args_t) ne10_vec2f_aos_to_soa_neon },
+    { (ne10_func_3args_t) ne10_vec3f_aos_to_soa_c, (ne10_func_3args_t) ne10_vec3f_aos_to_soa_neon },
+    { (ne10_func_3args_t) ne10_vec4f_aos_to_soa_c, (ne10_func_3args_t) ne10_vec4f_aos_to_soa_neon },
+};
+static const ne10_func_3args_t test_soa_to_aos[3][2] =
+{
+    { (ne10_func_3args_t) ne10_vec2f_soa_to_aos_c, (ne10_func_3args_t) ne10_vec2f_soa_to_aos_neon },
+    { (ne10_func_3args_t) ne10_vec3f_soa_to_aos_c, (ne10_func_3args_t) ne10_vec3f_soa_to_aos_neon },
+    { (ne10_func_3args_t) ne10_vec4f_soa_to_aos_c, (ne10_func_3args_t) ne10_vec4f_soa_to_aos_neon },
+};
+
+/* the vec2f and vec3f sets are leading parts of the vec4f one */
+static void test_soa_view (ne10_vec4f_soa_t * view, ne10_float32_t * buffer, ne10_uint32_t stride)
+{
+    view->x = buffer + ARRAY_GUARD_LEN;
+    view->y = view->x + stride;
+    view->z = view->y + stride;
+    view->w = view->z + stride;
+}
+
+static void test_soa_guard (ne10_vec4f_soa_t * view, ne10_uint32_t dim, ne10_uint32_t count)
+{
+    ne10_float32_t * comp[4] = { view->x, view->y, view->z, view->w };
+    ne10_uint32_t i;
+
+    for (i = 0; i < dim; i++)
+        GUARD_ARRAY (comp[i], count);
+}
+
+static void test_soa_check (ne10_vec4f_soa_t * ref, ne10_vec4f_soa_t * out, ne10_uint32_t dim, ne10_uint32_t count)
+{
+    ne10_float32_t * comp_ref[4] = { ref->x, ref->y, ref->z, ref->w };
+    ne10_float32_t * comp_out[4] = { out->x, out->y, out->z, out->w };
+    ne10_uint32_t i;
+
+    for (i = 0; i < dim; i++)
+    {
+        assert_true (CHECK_ARRAY_GUARD (comp_out[i], count));
+        assert_float_vec_equal (comp_ref[i], comp_out[i], ERROR_MARGIN_SMALL, count);
+    }
+}
+
+void test_soa_case0()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+    ne10_float32_t * guarded_soa_c = NULL;
+    ne10_float32_t * guarded_soa_neon = NULL;
+    ne10_vec4f_soa_t soa_c, soa_neon;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_uint32_t dim;
+    const ne10_uint32_t fixed_length = TEST_ITERATION * 4;
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, fixed_length);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, fixed_length);
+    guarded_soa_c = (ne10_float32_t*) calloc (4 * SOA_STRIDE, sizeof (ne10_float32_t));
+    guarded_soa_neon = (ne10_float32_t*) calloc (4 * SOA_STRIDE, sizeof (ne10_float32_t));
+    test_soa_view (&soa_c, guarded_soa_c, SOA_STRIDE);
+    test_soa_view (&soa_neon, guarded_soa_neon, SOA_STRIDE);
+
+    for (func_loop = 0; func_loop < 3; func_loop++)
+    {
+        dim = func_loop + 2;
+        for (loop = 0; loop < TEST_ITERATION; loop++)
+        {
+            /* split */
+            test_soa_guard (&soa_c, dim, loop);
+            test_soa_guard (&soa_neon, dim, loop);
+            test_aos_to_soa[func_loop][0] (&soa_c, thesrc1, loop);
+            test_aos_to_soa[func_loop][1] (&soa_neon, thesrc1, loop);
+            test_soa_check (&soa_c, &soa_neon, dim, loop);
+
+            /* and back, which must give the source again */
+            GUARD_ARRAY (thedst_c, loop * dim);
+            GUARD_ARRAY (thedst_neon, loop * dim);
+            test_soa_to_aos[func_loop][0] (thedst_c, &soa_c, loop);
+            test_soa_to_aos[func_loop][1] (thedst_neon, &soa_neon, loop);
+            assert_true (CHECK_ARRAY_GUARD (thedst_c, loop * dim));
+            assert_true (CHECK_ARRAY_GUARD (thedst_neon, loop * dim));
+            assert_float_vec_equal (thesrc1, thedst_c, ERROR_MARGIN_SMALL, loop * dim);
+            assert_float_vec_equal (thesrc1, thedst_neon, ERROR_MARGIN_SMALL, loop * dim);
+        }
+    }
+    free (guarded_src1);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+    free (guarded_soa_c);
+    free (guarded_soa_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Components", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = PERF_TEST_ITERATION * 4;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    guarded_soa_c = (ne10_float32_t*) calloc (4 * (PERF_TEST_ITERATION + 2 * ARRAY_GUARD_LEN), sizeof (ne10_float32_t));
+    test_soa_view (&soa_c, guarded_soa_c, PERF_TEST_ITERATION + 2 * ARRAY_GUARD_LEN);
+
+    for (func_loop = 0; func_loop < 3; func_loop++)
+    {
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_aos_to_soa[func_loop][0] (&soa_c, perftest_thesrc1, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_aos_to_soa[func_loop][1] (&soa_c, perftest_thesrc1, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop + 2, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+    free (guarded_soa_c);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_soa_case1()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+    ne10_float32_t * guarded_soa_src1 = NULL;
+    ne10_float32_t * guarded_soa_src2 = NULL;
+    ne10_float32_t * guarded_soa_c = NULL;
+    ne10_float32_t * guarded_soa_neon = NULL;
+    ne10_float32_t * guarded_soa_ref = NULL;
+    ne10_vec4f_soa_t soa_src1, soa_src2, soa_c, soa_neon, soa_ref;
+    const test_soa_func_t * func;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    const ne10_uint32_t fixed_length = TEST_ITERATION * 4;
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (theacc, guarded_acc, fixed_length);
+    guarded_soa_src1 = (ne10_float32_t*) calloc (4 * SOA_STRIDE, sizeof (ne10_float32_t));
+    guarded_soa_src2 = (ne10_float32_t*) calloc (4 * SOA_STRIDE, sizeof (ne10_float32_t));
+    guarded_soa_c = (ne10_float32_t*) calloc (4 * SOA_STRIDE, sizeof (ne10_float32_t));
+    guarded_soa_neon = (ne10_float32_t*) calloc (4 * SOA_STRIDE, sizeof (ne10_float32_t));
+    guarded_soa_ref = (ne10_float32_t*) calloc (4 * SOA_STRIDE, sizeof (ne10_float32_t));
+    test_soa_view (&soa_src1, guarded_soa_src1, SOA_STRIDE);
+    test_soa_view (&soa_src2, guarded_soa_src2, SOA_STRIDE);
+    test_soa_view (&soa_c, guarded_soa_c, SOA_STRIDE);
+    test_soa_view (&soa_neon, guarded_soa_neon, SOA_STRIDE);
+    test_soa_view (&soa_ref, guarded_soa_ref, SOA_STRIDE);
+
+    for (func_loop = 0; func_loop < SOA_FUNC_COUNT; func_loop++)
+    {
+        func = &test_soa_func[func_loop];
+
+        /* the same vectors in both layouts */
+        test_aos_to_soa[func->dim - 2][0] (&soa_src1, thesrc1, TEST_ITERATION);
+        test_aos_to_soa[func->dim - 2][0] (&soa_src2, thesrc2, TEST_ITERATION);
+
+        for (loop = 0; loop < TEST_ITERATION; loop++)
+        {
+            test_soa_guard (&soa_c, func->dst_dim, loop);
+            test_soa_guard (&soa_neon, func->dst_dim, loop);
+
+            /* a one-float result goes to the x array */
+            if (func->func4[0] != NULL)
+            {
+                func->func4[0] ( (func->dst_dim == 1) ? (void*) soa_c.x : (void*) &soa_c, &soa_src1, &soa_src2, loop);
+                func->func4[1] ( (func->dst_dim == 1) ? (void*) soa_neon.x : (void*) &soa_neon, &soa_src1, &soa_src2, loop);
+                func->func4[2] (theacc, thesrc1, thesrc2, loop);
+            }
+            else
+            {
+                func->func3[0] ( (func->dst_dim == 1) ? (void*) soa_c.x : (void*) &soa_c, &soa_src1, loop);
+                func->func3[1] ( (func->dst_dim == 1) ? (void*) soa_neon.x : (void*) &soa_neon, &soa_src1, loop);
+                func->func3[2] (theacc, thesrc1, loop);
+            }
+
+            if (func->dst_dim == 1)
+                memcpy (soa_ref.x, theacc, loop * sizeof (ne10_float32_t));
+            else
+                test_aos_to_soa[func->dst_dim - 2][0] (&soa_ref, theacc, loop);
+
+#ifdef DEBUG_TRACE
+            fprintf (stdout, "func: %d loop count: %d\n", func_loop, loop);
+#endif
+            /* the C version matches the interleaved one, and NEON matches C */
+            test_soa_check (&soa_ref, &soa_c, func->dst_dim, loop);
+            test_soa_check (&soa_c, &soa_neon, func->dst_dim, loop);
+        }
+    }
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_acc);
+    free (guarded_soa_src1);
+    free (guarded_soa_src2);
+    free (guarded_soa_c);
+    free (guarded_soa_neon);
+    free (guarded_soa_ref);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    const ne10_uint32_t perf_stride = PERF_TEST_ITERATION + 2 * ARRAY_GUARD_LEN;
+
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, 4 * perf_stride); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, 4 * perf_stride); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, 4 * perf_stride);
+    test_soa_view (&soa_src1, perftest_thesrc1, perf_stride);
+    test_soa_view (&soa_src2, perftest_thesrc2, perf_stride);
+    test_soa_view (&soa_c, perftest_thedst_c, perf_stride);
+
+    for (func_loop = 0; func_loop < SOA_FUNC_COUNT; func_loop++)
+    {
+        func = &test_soa_func[func_loop];
+        if (func->func4[0] != NULL)
+        {
+            GET_TIME (time_c,
+                      for (loop = 0; loop < PERF_TEST_ITERATION; loop++) func->func4[0] ( (func->dst_dim == 1) ? (void*) soa_c.x : (void*) &soa_c, &soa_src1, &soa_src2, loop);
+                     );
+            GET_TIME (time_neon,
+                      for (loop = 0; loop < PERF_TEST_ITERATION; loop++) func->func4[1] ( (func->dst_dim == 1) ? (void*) soa_c.x : (void*) &soa_c, &soa_src1, &soa_src2, loop);
+                     );
+        }
+        else
+        {
+            GET_TIME (time_c,
+                      for (loop = 0; loop < PERF_TEST_ITERATION; loop++) func->func3[0] ( (func->dst_dim == 1) ? (void*) soa_c.x : (void*) &soa_c, &soa_src1, loop);
+                     );
+            GET_TIME (time_neon,
+                      for (loop = 0; loop < PERF_TEST_ITERATION; loop++) func->func3[1] ( (func->dst_dim == 1) ? (void*) soa_c.x : (void*) &soa_c, &soa_src1, loop);
+                     );
+        }
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+    free (perftest_guarded_dst_c);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+/* timed kernels per size: mulmat, invmat, detmat, mulmatvec */
+#define MAT_X4_FUNC_COUNT 4
+
+typedef struct
+{
+    ne10_uint32_t n;
+    ne10_func_3args_t to_x4[2];     /* C, NEON */
+    ne10_func_3args_t to_aos[2];
+    ne10_func_4args_t mulmat[3];    /* C, NEON, packed C reference */
+    ne10_func_3args_t invmat[3];
+    ne10_func_3args_t transmat[3];
+    ne10_func_3args_t detmat[3];
+    ne10_func_4args_t mulmatvec[3];
+} test_mat_x4_t;
+
+static const test_mat_x4_t test_mat_x4_func[3] =
+{
+    {
+        4,
+        { (ne10_func_3args_t) ne10_mat4x4f_aos_to_x4_c, (ne10_func_3args_t) ne10_mat4x4f_aos_to_x4_neon },
+        { (ne10_func_3args_t) ne10_mat4x4f_x4_to_aos_c, (ne10_func_3args_t) ne10_mat4x4f_x4_to_aos_neon },
+        { (ne10_func_4args_t) ne10_mulmat_4x4f_x4_c, (ne10_func_4args_t) ne10_mulmat_4x4f_x4_neon, (ne10_func_4args_t) ne10_mulmat_4x4f_c },
+        { (ne10_func_3args_t) ne10_invmat_4x4f_x4_c, (ne10_func_3args_t) ne10_invmat_4x4f_x4_neon, (ne10_func_3args_t) ne10_invmat_4x4f_c },
+        { (ne10_func_3args_t) ne10_transmat_4x4f_x4_c, (ne10_func_3args_t) ne10_transmat_4x4f_x4_neon, (ne10_func_3args_t) ne10_transmat_4x4f_c },
+        { (ne10_func_3args_t) ne10_detmat_4x4f_x4_c, (ne10_func_3args_t) ne10_detmat_4x4f_x4_neon, (ne10_func_3args_t) ne10_detmat_4x4f_c },
+        { (ne10_func_4args_t) ne10_mulmatvec_4x4f_v4f_x4_c, (ne10_func_4args_t) ne10_mulmatvec_4x4f_v4f_x4_neon, (ne10_func_4args_t) ne10_mulcmatvec_cm4x4f_v4f_c },
+    },
+    {
+        3,
+        { (ne10_func_3args_t) ne10_mat3x3f_aos_to_x4_c, (ne10_func_3args_t) ne10_mat3x3f_aos_to_x4_neon },
+        { (ne10_func_3args_t) ne10_mat3x3f_x4_to_aos_c, (ne10_func_3args_t) ne10_mat3x3f_x4_to_aos_neon },
+        { (ne10_func_4args_t) ne10_mulmat_3x3f_x4_c, (ne10_func_4args_t) ne10_mulmat_3x3f_x4_neon, (ne10_func_4args_t) ne10_mulmat_3x3f_c },
+        { (ne10_func_3args_t) ne10_invmat_3x3f_x4_c, (ne10_func_3args_t) ne10_invmat_3x3f_x4_neon, (ne10_func_3args_t) ne10_invmat_3x3f_c },
+        { (ne10_func_3args_t) ne10_transmat_3x3f_x4_c, (ne10_func_3args_t) ne10_transmat_3x3f_x4_neon, (ne10_func_3args_t) ne10_transmat_3x3f_c },
+        { (ne10_func_3args_t) ne10_detmat_3x3f_x4_c, (ne10_func_3args_t) ne10_detmat_3x3f_x4_neon, (ne10_func_3args_t) ne10_detmat_3x3f_c },
+        { (ne10_func_4args_t) ne10_mulmatvec_3x3f_v3f_x4_c, (ne10_func_4args_t) ne10_mulmatvec_3x3f_v3f_x4_neon, (ne10_func_4args_t) ne10_mulcmatvec_cm3x3f_v3f_c },
+    },
+    {
+        2,
+        { (ne10_func_3args_t) ne10_mat2x2f_aos_to_x4_c, (ne10_func_3args_t) ne10_mat2x2f_aos_to_x4_neon },
+        { (ne10_func_3args_t) ne10_mat2x2f_x4_to_aos_c, (ne10_func_3args_t) ne10_mat2x2f_x4_to_aos_neon },
+        { (ne10_func_4args_t) ne10_mulmat_2x2f_x4_c, (ne10_func_4args_t) ne10_mulmat_2x2f_x4_neon, (ne10_func_4args_t) ne10_mulmat_2x2f_c },
+        { (ne10_func_3args_t) ne10_invmat_2x2f_x4_c, (ne10_func_3args_t) ne10_invmat_2x2f_x4_neon, (ne10_func_3args_t) ne10_invmat_2x2f_c },
+        { (ne10_func_3args_t) ne10_transmat_2x2f_x4_c, (ne10_func_3args_t) ne10_transmat_2x2f_x4_neon, (ne10_func_3args_t) ne10_transmat_2x2f_c },
+        { (ne10_func_3args_t) ne10_detmat_2x2f_x4_c, (ne10_func_3args_t) ne10_detmat_2x2f_x4_neon, (ne10_func_3args_t) ne10_detmat_2x2f_c },
+        { (ne10_func_4args_t) ne10_mulmatvec_2x2f_v2f_x4_c, (ne10_func_4args_t) ne10_mulmatvec_2x2f_v2f_x4_neon, (ne10_func_4args_t) ne10_mulcmatvec_cm2x2f_v2f_c },
+    },
+};
+
+/* floats taken by the blocks holding count matrices of n x n */
+static ne10_uint32_t test_mat_x4_length (ne10_uint32_t n, ne10_uint32_t count)
+{
+    return (count + NE10_MAT_X4_LANES - 1) / NE10_MAT_X4_LANES * n * n * NE10_MAT_X4_LANES;
+}
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+/* runs a square-matrix kernel on blocks (C and NEON) and on packed matrices (reference) */
+static void test_mat_x4_unary_check (const test_mat_x4_t * t, const ne10_func_3args_t * func, ne10_float32_t * x4_src, ne10_float32_t * x4_c, ne10_float32_t * x4_neon, ne10_uint32_t count)
+{
+    ne10_uint32_t length = test_mat_x4_length (t->n, count);
+
+    GUARD_ARRAY (x4_c, length);
+    GUARD_ARRAY (x4_neon, length);
+    func[0] (x4_c, x4_src, count);
+    func[1] (x4_neon, x4_src, count);
+    assert_true (CHECK_ARRAY_GUARD (x4_c, length));
+    assert_true (CHECK_ARRAY_GUARD (x4_neon, length));
+    assert_float_vec_equal (x4_c, x4_neon, ERROR_MARGIN_LARGE, length);
+
+    func[2] (theacc, thesrc1, count);
+    t->to_aos[0] (thedst_c, x4_c, count);
+    assert_float_vec_equal (theacc, thedst_c, ERROR_MARGIN_LARGE, count * t->n * t->n);
+}
+#endif
+
+void test_mat_x4_case0()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+    ne10_float32_t * guarded_x4_src1 = NULL;
+    ne10_float32_t * guarded_x4_src2 = NULL;
+    ne10_float32_t * guarded_x4_c = NULL;
+    ne10_float32_t * guarded_x4_neon = NULL;
+    ne10_float32_t * x4_src1 = NULL;
+    ne10_float32_t * x4_src2 = NULL;
+    ne10_float32_t * x4_c = NULL;
+    ne10_float32_t * x4_neon = NULL;
+    const test_mat_x4_t * t;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_uint32_t i, e, n, length;
+    const ne10_uint32_t fixed_length = TEST_ITERATION * 16;
+    const ne10_uint32_t x4_length = test_mat_x4_length (4, TEST_ITERATION);
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, fixed_length);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, fixed_length);
+    NE10_DST_ALLOC (theacc, guarded_acc, fixed_length);
+    NE10_DST_ALLOC (x4_src1, guarded_x4_src1, x4_length);
+    NE10_DST_ALLOC (x4_src2, guarded_x4_src2, x4_length);
+    NE10_DST_ALLOC (x4_c, guarded_x4_c, x4_length);
+    NE10_DST_ALLOC (x4_neon, guarded_x4_neon, x4_length);
+
+    for (func_loop = 0; func_loop < 3; func_loop++)
+    {
+        t = &test_mat_x4_func[func_loop];
+        n = t->n;
+        for (loop = 0; loop < TEST_ITERATION; loop++)
+        {
+            length = test_mat_x4_length (n, loop);
+#ifdef DEBUG_TRACE
+            fprintf (stdout, "size: %d loop count: %d\n", n, loop);
+#endif
+            /* interleave, including the identity padding of the last block */
+            GUARD_ARRAY (x4_src1, length);
+            GUARD_ARRAY (x4_neon, length);
+            t->to_x4[0] (x4_src1, thesrc1, loop);
+            t->to_x4[1] (x4_neon, thesrc1, loop);
+            t->to_x4[0] (x4_src2, thesrc2, loop);
+            assert_true (CHECK_ARRAY_GUARD (x4_src1, length));
+            assert_true (CHECK_ARRAY_GUARD (x4_neon, length));
+            assert_float_vec_equal (x4_src1, x4_neon, ERROR_MARGIN_SMALL, length);
+            for (i = loop; i < length / (n * n); i++)
+            {
+                for (e = 0; e < n * n; e++)
+                    assert_true (x4_src1[ (i - i % NE10_MAT_X4_LANES) * n * n + e * NE10_MAT_X4_LANES + i % NE10_MAT_X4_LANES] == ( (e / n == e % n) ? 1.0f : 0.0f));
+            }
+
+            /* and back */
+            GUARD_ARRAY (thedst_neon, loop * n * n);
+            t->to_aos[1] (thedst_neon, x4_src1, loop);
+            assert_true (CHECK_ARRAY_GUARD (thedst_neon, loop * n * n));
+            assert_float_vec_equal (thesrc1, thedst_neon, ERROR_MARGIN_SMALL, loop * n * n);
+
+            test_mat_x4_unary_check (t, t->invmat, x4_src1, x4_c, x4_neon, loop);
+            test_mat_x4_unary_check (t, t->transmat, x4_src1, x4_c, x4_neon, loop);
+
+            /* multiplication */
+            GUARD_ARRAY (x4_c, length);
+            GUARD_ARRAY (x4_neon, length);
+            t->mulmat[0] (x4_c, x4_src1, x4_src2, loop);
+            t->mulmat[1] (x4_neon, x4_src1, x4_src2, loop);
+            assert_true (CHECK_ARRAY_GUARD (x4_c, length));
+            assert_true (CHECK_ARRAY_GUARD (x4_neon, length));
+            assert_float_vec_equal (x4_c, x4_neon, ERROR_MARGIN_LARGE, length);
+            t->mulmat[2] (theacc, thesrc1, thesrc2, loop);
+            t->to_aos[0] (thedst_c, x4_c, loop);
+            assert_float_vec_equal (theacc, thedst_c, ERROR_MARGIN_LARGE, loop * n * n);
+
+            /* determinants */
+            GUARD_ARRAY (thedst_c, loop);
+            GUARD_ARRAY (thedst_neon, loop);
+            t->detmat[0] (thedst_c, x4_src1, loop);
+            t->detmat[1] (thedst_neon, x4_src1, loop);
+            t->detmat[2] (theacc, thesrc1, loop);
+            assert_true (CHECK_ARRAY_GUARD (thedst_c, loop));
+            assert_true (CHECK_ARRAY_GUARD (thedst_neon, loop));
+            assert_float_vec_equal (thedst_c, thedst_neon, ERROR_MARGIN_LARGE, loop);
+            assert_float_vec_equal (theacc, thedst_c, ERROR_MARGIN_LARGE, loop);
+
+            /* matrix-vector products, with the vectors taken from src2 */
+            GUARD_ARRAY (thedst_c, loop * n);
+            GUARD_ARRAY (thedst_neon, loop * n);
+            t->mulmatvec[0] (thedst_c, x4_src1, thesrc2, loop);
+            t->mulmatvec[1] (thedst_neon, x4_src1, thesrc2, loop);
+            for (i = 0; i < (ne10_uint32_t) loop; i++)
+                t->mulmatvec[2] (&theacc[i * n], &thesrc1[i * n * n], &thesrc2[i * n], 1);
+            assert_true (CHECK_ARRAY_GUARD (thedst_c, loop * n));
+            assert_true (CHECK_ARRAY_GUARD (thedst_neon, loop * n));
+            assert_float_vec_equal (thedst_c, thedst_neon, ERROR_MARGIN_LARGE, loop * n);
+            assert_float_vec_equal (theacc, thedst_c, ERROR_MARGIN_LARGE, loop * n);
+        }
+    }
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+    free (guarded_acc);
+    free (guarded_x4_src1);
+    free (guarded_x4_src2);
+    free (guarded_x4_c);
+    free (guarded_x4_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = test_mat_x4_length (4, PERF_TEST_ITERATION);
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perftest_length);
+    NE10_DST_ALLOC (perftest_thedst_neon, perftest_guarded_dst_neon, perftest_length);
+
+    for (func_loop = 0; func_loop < 3 * MAT_X4_FUNC_COUNT; func_loop++)
+    {
+        ne10_int32_t is_neon;
+        ne10_int64_t time[2];
+
+        t = &test_mat_x4_func[func_loop / MAT_X4_FUNC_COUNT];
+        for (is_neon = 0; is_neon < 2; is_neon++)
+        {
+            switch (func_loop % MAT_X4_FUNC_COUNT)
+            {
+            case 0:
+                GET_TIME (time[is_neon],
+                          for (loop = 0; loop < PERF_TEST_ITERATION; loop++) t->mulmat[is_neon] (perftest_thedst_c, perftest_thesrc1, perftest_thesrc2, loop);
+                         );
+                break;
+            case 1:
+                GET_TIME (time[is_neon],
+                          for (loop = 0; loop < PERF_TEST_ITERATION; loop++) t->invmat[is_neon] (perftest_thedst_c, perftest_thesrc1, loop);
+                         );
+                break;
+            case 2:
+                GET_TIME (time[is_neon],
+                          for (loop = 0; loop < PERF_TEST_ITERATION; loop++) t->detmat[is_neon] (perftest_thedst_c, perftest_thesrc1, loop);
+                         );
+                break;
+            default:
+                GET_TIME (time[is_neon],
+                          for (loop = 0; loop < PERF_TEST_ITERATION; loop++) t->mulmatvec[is_neon] (perftest_thedst_c, perftest_thesrc1, perftest_thesrc2, loop);
+                         );
+                break;
+            }
+        }
+        time_c = time[0];
+        time_neon = time[1];
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+    free (perftest_guarded_dst_c);
+    free (perftest_guarded_dst_neon);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+/* quaternion kernels: C, NEON and, for the structure-of-arrays versions, the interleaved C reference */
+#define QUAT_FUNC_COUNT 10
+#define QUAT_SOA_FUNC_COUNT 6
+#define QUAT_SLERP 5
+#define QUAT_FROM_MAT 7
+#define QUAT_T 0.3f
+/* slerp goes through polynomial acos and sin in the NEON version */
+#define QUAT_SLERP_TOL 1e-5f
+
+typedef struct
+{
+    ne10_func_4args_t func4[3];
+    ne10_func_3args_t func3[3];
+    ne10_func_5args_cst_t func5[3];     /* interpolations, with t as the constant */
+    ne10_uint32_t dst_size;             /* floats written per item */
+} test_quat_func_t;
+
+static const test_quat_func_t test_quat_func[QUAT_FUNC_COUNT] =
+{
+    { { (ne10_func_4args_t) ne10_mul_quatf_c, (ne10_func_4args_t) ne10_mul_quatf_neon, NULL }, { NULL, NULL, NULL }, { NULL, NULL, NULL }, 4 },
+    { { NULL, NULL, NULL }, { (ne10_func_3args_t) ne10_conj_quatf_c, (ne10_func_3args_t) ne10_conj_quatf_neon, NULL }, { NULL, NULL, NULL }, 4 },
+    { { NULL, NULL, NULL }, { (ne10_func_3args_t) ne10_normalize_quatf_c, (ne10_func_3args_t) ne10_normalize_quatf_neon, NULL }, { NULL, NULL, NULL }, 4 },
+    { { (ne10_func_4args_t) ne10_rotate_quatf_vec3f_c, (ne10_func_4args_t) ne10_rotate_quatf_vec3f_neon, NULL }, { NULL, NULL, NULL }, { NULL, NULL, NULL }, 3 },
+    { { NULL, NULL, NULL }, { NULL, NULL, NULL }, { (ne10_func_5args_cst_t) ne10_nlerp_quatf_c, (ne10_func_5args_cst_t) ne10_nlerp_quatf_neon, NULL }, 4 },
+    { { NULL, NULL, NULL }, { NULL, NULL, NULL }, { (ne10_func_5args_cst_t) ne10_slerp_quatf_c, (ne10_func_5args_cst_t) ne10_slerp_quatf_neon, NULL }, 4 },
+    { { NULL, NULL, NULL }, { (ne10_func_3args_t) ne10_quatf_to_mat3x3f_c, (ne10_func_3args_t) ne10_quatf_to_mat3x3f_neon, NULL }, { NULL, NULL, NULL }, 9 },
+    { { NULL, NULL, NULL }, { (ne10_func_3args_t) ne10_mat3x3f_to_quatf_c, (ne10_func_3args_t) ne10_mat3x3f_to_quatf_neon, NULL }, { NULL, NULL, NULL }, 4 },
+    { { (ne10_func_4args_t) ne10_mul_dualquatf_c, (ne10_func_4args_t) ne10_mul_dualquatf_neon, NULL }, { NULL, NULL, NULL }, { NULL, NULL, NULL }, 8 },
+    { { (ne10_func_4args_t) ne10_transform_dualquatf_vec3f_c, (ne10_func_4args_t) ne10_transform_dualquatf_vec3f_neon, NULL }, { NULL, NULL, NULL }, { NULL, NULL, NULL }, 3 },
+};
+
+static const test_quat_func_t test_quat_soa_func[QUAT_SOA_FUNC_COUNT] =
+{
+    { { (ne10_func_4args_t) ne10_mul_quatf_soa_c, (ne10_func_4args_t) ne10_mul_quatf_soa_neon, (ne10_func_4args_t) ne10_mul_quatf_c }, { NULL, NULL, NULL }, { NULL, NULL, NULL }, 4 },
+    { { NULL, NULL, NULL }, { (ne10_func_3args_t) ne10_conj_quatf_soa_c, (ne10_func_3args_t) ne10_conj_quatf_soa_neon, (ne10_func_3args_t) ne10_conj_quatf_c }, { NULL, NULL, NULL }, 4 },
+    { { NULL, NULL, NULL }, { (ne10_func_3args_t) ne10_normalize_quatf_soa_c, (ne10_func_3args_t) ne10_normalize_quatf_soa_neon, (ne10_func_3args_t) ne10_normalize_quatf_c }, { NULL, NULL, NULL }, 4 },
+    { { (ne10_func_4args_t) ne10_rotate_quatf_vec3f_soa_c, (ne10_func_4args_t) ne10_rotate_quatf_vec3f_soa_neon, (ne10_func_4args_t) ne10_rotate_quatf_vec3f_c }, { NULL, NULL, NULL }, { NULL, NULL, NULL }, 3 },
+    { { NULL, NULL, NULL }, { NULL, NULL, NULL }, { (ne10_func_5args_cst_t) ne10_nlerp_quatf_soa_c, (ne10_func_5args_cst_t) ne10_nlerp_quatf_soa_neon, (ne10_func_5args_cst_t) ne10_nlerp_quatf_c }, 4 },
+    { { NULL, NULL, NULL }, { NULL, NULL, NULL }, { (ne10_func_5args_cst_t) ne10_slerp_quatf_soa_c, (ne10_func_5args_cst_t) ne10_slerp_quatf_soa_neon, (ne10_func_5args_cst_t) ne10_slerp_quatf_c }, 4 },
+};
+
+/* which: 0 for C, 1 for NEON, 2 for the reference */
+static void test_quat_run (const test_quat_func_t * func, ne10_int32_t which, void * dst, void * src1, void * src2, ne10_uint32_t count)
+{
+    if (func->func4[which] != NULL)
+        func->func4[which] (dst, src1, src2, count);
+    else if (func->func3[which] != NULL)
+        func->func3[which] (dst, src1, count);
+    else
+        func->func5[which] (dst, src1, src2, QUAT_T, count);
+}
+
+/*
+ * Unit quaternions. Every fifth pair is made equal and the following one
+ * opposite, so that the interpolations also take their nlerp path.
+ */
+static void test_quat_inputs (ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_quatf_t * q1 = (ne10_quatf_t *) src1;
+    ne10_quatf_t * q2 = (ne10_quatf_t *) src2;
+    ne10_uint32_t i;
+
+    ne10_normalize_quatf_c (q1, q1, count);
+    ne10_normalize_quatf_c (q2, q2, count);
+    for (i = 0; i + 1 < count; i += 5)
+    {
+        q2[i] = q1[i];
+        q2[i + 1].x = -q1[i + 1].x;
+        q2[i + 1].y = -q1[i + 1].y;
+        q2[i + 1].z = -q1[i + 1].z;
+        q2[i + 1].w = -q1[i + 1].w;
+    }
+}
+
+void test_quat_case0()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+    const test_quat_func_t * func;
+    ne10_float32_t * src;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_uint32_t i, size;
+    ne10_quatf_t * q;
+    ne10_quatf_t * r;
+    const ne10_uint32_t fixed_length = TEST_ITERATION * 9;
+
+    /* init src memory: unit quaternions, dual quaternions with unit real parts, and their rotation matrices */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    test_quat_inputs (thesrc1, thesrc2, 2 * TEST_ITERATION);
+    NE10_DST_ALLOC (theacc, guarded_acc, fixed_length);
+    ne10_quatf_to_mat3x3f_c ( (ne10_mat3x3f_t *) theacc, (ne10_quatf_t *) thesrc1, TEST_ITERATION);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, fixed_length);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, fixed_length);
+
+    for (func_loop = 0; func_loop < QUAT_FUNC_COUNT; func_loop++)
+    {
+        func = &test_quat_func[func_loop];
+        src = (func_loop == QUAT_FROM_MAT) ? theacc : thesrc1;
+        for (loop = 0; loop < TEST_ITERATION; loop++)
+        {
+            size = loop * func->dst_size;
+            GUARD_ARRAY (thedst_c, size);
+            GUARD_ARRAY (thedst_neon, size);
+
+            test_quat_run (func, 0, thedst_c, src, thesrc2, loop);
+            test_quat_run (func, 1, thedst_neon, src, thesrc2, loop);
+
+            assert_true (CHECK_ARRAY_GUARD (thedst_c, size));
+            assert_true (CHECK_ARRAY_GUARD (thedst_neon, size));
+#ifdef DEBUG_TRACE
+            fprintf (stdout, "func: %d loop count: %d\n", func_loop, loop);
+#endif
+            if (func_loop == QUAT_SLERP)
+                test_transcendental_check (thedst_c, thedst_neon, QUAT_SLERP_TOL, QUAT_SLERP_TOL, size);
+            else
+                assert_float_vec_equal (thedst_c, thedst_neon, ERROR_MARGIN_SMALL, size);
+        }
+    }
+
+    /* rotating by a quaternion and by its matrix agree */
+    ne10_rotate_quatf_vec3f_c ( (ne10_vec3f_t *) thedst_c, (ne10_quatf_t *) thesrc1, (ne10_vec3f_t *) thesrc2, TEST_ITERATION);
+    for (i = 0; i < TEST_ITERATION; i++)
+        ne10_mulcmatvec_cm3x3f_v3f_c ( (ne10_vec3f_t *) &thedst_neon[i * 3], (ne10_mat3x3f_t *) &theacc[i * 9], (ne10_vec3f_t *) &thesrc2[i * 3], 1);
+    test_transcendental_check (thedst_neon, thedst_c, 1e-5f, 0.0f, TEST_ITERATION * 3);
+
+    /* and the matrix converts back to the quaternion, up to its sign */
+    ne10_mat3x3f_to_quatf_c ( (ne10_quatf_t *) thedst_c, (ne10_mat3x3f_t *) theacc, TEST_ITERATION);
+    q = (ne10_quatf_t *) thesrc1;
+    r = (ne10_quatf_t *) thedst_c;
+    for (i = 0; i < TEST_ITERATION; i++)
+    {
+        if (q[i].x * r[i].x + q[i].y * r[i].y + q[i].z * r[i].z + q[i].w * r[i].w < 0.0f)
+        {
+            r[i].x = -r[i].x;
+            r[i].y = -r[i].y;
+            r[i].z = -r[i].z;
+            r[i].w = -r[i].w;
+        }
+    }
+    test_transcendental_check (thesrc1, thedst_c, 1e-5f, 0.0f, TEST_ITERATION * 4);
+
+    /* the product of two dual quaternions applies the second transform, then the first */
+    ne10_mul_dualquatf_c ( (ne10_dualquatf_t *) theacc, (ne10_dualquatf_t *) thesrc1, (ne10_dualquatf_t *) thesrc2, TEST_ITERATION);
+    ne10_transform_dualquatf_vec3f_c ( (ne10_vec3f_t *) thedst_c, (ne10_dualquatf_t *) theacc, (ne10_vec3f_t *) thesrc2, TEST_ITERATION);
+    ne10_transform_dualquatf_vec3f_c ( (ne10_vec3f_t *) thedst_neon, (ne10_dualquatf_t *) thesrc2, (ne10_vec3f_t *) thesrc2, TEST_ITERATION);
+    ne10_transform_dualquatf_vec3f_c ( (ne10_vec3f_t *) thedst_neon, (ne10_dualquatf_t *) thesrc1, (ne10_vec3f_t *) thedst_neon, TEST_ITERATION);
+    test_transcendental_check (thedst_c, thedst_neon, 1e-5f, 1e-5f, TEST_ITERATION * 3);
+
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_acc);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = PERF_TEST_ITERATION * 9;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    test_quat_inputs (perftest_thesrc1, perftest_thesrc2, 2 * PERF_TEST_ITERATION);
+    NE10_DST_ALLOC (perftest_theacc, perftest_guarded_acc, perftest_length);
+    ne10_quatf_to_mat3x3f_c ( (ne10_mat3x3f_t *) perftest_theacc, (ne10_quatf_t *) perftest_thesrc1, PERF_TEST_ITERATION);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perftest_length);
+    NE10_DST_ALLOC (perftest_thedst_neon, perftest_guarded_dst_neon, perftest_length);
+
+    for (func_loop = 0; func_loop < QUAT_FUNC_COUNT; func_loop++)
+    {
+        func = &test_quat_func[func_loop];
+        src = (func_loop == QUAT_FROM_MAT) ? perftest_theacc : perftest_thesrc1;
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_quat_run (func, 0, perftest_thedst_c, src, perftest_thesrc2, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_quat_run (func, 1, perftest_thedst_neon, src, perftest_thesrc2, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+    free (perftest_guarded_acc);
+    free (perftest_guarded_dst_c);
+    free (perftest_guarded_dst_neon);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+void test_quat_case1()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+    ne10_float32_t * guarded_soa_src1 = NULL;
+    ne10_float32_t * guarded_soa_src2 = NULL;
+    ne10_float32_t * guarded_soa_c = NULL;
+    ne10_float32_t * guarded_soa_neon = NULL;
+    ne10_float32_t * guarded_soa_ref = NULL;
+    ne10_vec4f_soa_t soa_src1, soa_src2, soa_c, soa_neon, soa_ref;
+    const test_quat_func_t * func;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_uint32_t i;
+    ne10_float32_t * comp_c[4];
+    ne10_float32_t * comp_neon[4];
+    const ne10_uint32_t fixed_length = TEST_ITERATION * 4;
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    test_quat_inputs (thesrc1, thesrc2, TEST_ITERATION);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (theacc, guarded_acc, fixed_length);
+    guarded_soa_src1 = (ne10_float32_t*) calloc (4 * SOA_STRIDE, sizeof (ne10_float32_t));
+    guarded_soa_src2 = (ne10_float32_t*) calloc (4 * SOA_STRIDE, sizeof (ne10_float32_t));
+    guarded_soa_c = (ne10_float32_t*) calloc (4 * SOA_STRIDE, sizeof (ne10_float32_t));
+    guarded_soa_neon = (ne10_float32_t*) calloc (4 * SOA_STRIDE, sizeof (ne10_float32_t));
+    guarded_soa_ref = (ne10_float32_t*) calloc (4 * SOA_STRIDE, sizeof (ne10_float32_t));
+    test_soa_view (&soa_src1, guarded_soa_src1, SOA_STRIDE);
+    test_soa_view (&soa_src2, guarded_soa_src2, SOA_STRIDE);
+    test_soa_view (&soa_c, guarded_soa_c, SOA_STRIDE);
+    test_soa_view (&soa_neon, guarded_soa_neon, SOA_STRIDE);
+    test_soa_view (&soa_ref, guarded_soa_ref, SOA_STRIDE);
+    comp_c[0] = soa_c.x;
+    comp_c[1] = soa_c.y;
+    comp_c[2] = soa_c.z;
+    comp_c[3] = soa_c.w;
+    comp_neon[0] = soa_neon.x;
+    comp_neon[1] = soa_neon.y;
+    comp_neon[2] = soa_neon.z;
+    comp_neon[3] = soa_neon.w;
+
+    /* the same quaternions in both layouts; the rotated vectors are the leading floats of src2 */
+    ne10_vec4f_aos_to_soa_c (&soa_src1, (ne10_vec4f_t *) thesrc1, TEST_ITERATION);
+
+    for (func_loop = 0; func_loop < QUAT_SOA_FUNC_COUNT; func_loop++)
+    {
+        func = &test_quat_soa_func[func_loop];
+        test_aos_to_soa[func->dst_size - 2][0] (&soa_src2, thesrc2, TEST_ITERATION);
+
+        for (loop = 0; loop < TEST_ITERATION; loop++)
+        {
+            test_soa_guard (&soa_c, func->dst_size, loop);
+            test_soa_guard (&soa_neon, func->dst_size, loop);
+
+            test_quat_run (func, 0, &soa_c, &soa_src1, &soa_src2, loop);
+            test_quat_run (func, 1, &soa_neon, &soa_src1, &soa_src2, loop);
+            test_quat_run (func, 2, theacc, thesrc1, thesrc2, loop);
+            test_aos_to_soa[func->dst_size - 2][0] (&soa_ref, theacc, loop);
+
+#ifdef DEBUG_TRACE
+            fprintf (stdout, "func: %d loop count: %d\n", func_loop, loop);
+#endif
+            /* the C version matches the interleaved one, and NEON matches C */
+            test_soa_check (&soa_ref, &soa_c, func->dst_size, loop);
+            if (func_loop == QUAT_SLERP)
+            {
+                for (i = 0; i < func->dst_size; i++)
+                {
+                    assert_true (CHECK_ARRAY_GUARD (comp_neon[i], loop));
+                    test_transcendental_check (comp_c[i], comp_neon[i], QUAT_SLERP_TOL, QUAT_SLERP_TOL, loop);
+                }
+            }
+            else
+                test_soa_check (&soa_c, &soa_neon, func->dst_size, loop);
+        }
+    }
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_acc);
+    free (guarded_soa_src1);
+    free (guarded_soa_src2);
+    free (guarded_soa_c);
+    free (guarded_soa_neon);
+    free (guarded_soa_ref);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    const ne10_uint32_t perf_stride = PERF_TEST_ITERATION + 2 * ARRAY_GUARD_LEN;
+
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, 4 * perf_stride); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, 4 * perf_stride); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, 4 * perf_stride);
+    test_soa_view (&soa_src1, perftest_thesrc1, perf_stride);
+    test_soa_view (&soa_src2, perftest_thesrc2, perf_stride);
+    test_soa_view (&soa_c, perftest_thedst_c, perf_stride);
+    ne10_normalize_quatf_soa_c (&soa_src1, &soa_src1, PERF_TEST_ITERATION);
+    ne10_normalize_quatf_soa_c (&soa_src2, &soa_src2, PERF_TEST_ITERATION);
+
+    for (func_loop = 0; func_loop < QUAT_SOA_FUNC_COUNT; func_loop++)
+    {
+        func = &test_quat_soa_func[func_loop];
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_quat_run (func, 0, &soa_c, &soa_src1, &soa_src2, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_quat_run (func, 1, &soa_c, &soa_src1, &soa_src2, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+    free (perftest_guarded_dst_c);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+#define DECOMP_FUNC_COUNT 5
+#define DECOMP_LU 2
+#define DECOMP_QR 4
+#define DECOMP_LEN (TEST_ITERATION * NE10_DECOMP_MAX_N * NE10_DECOMP_MAX_N)
+#define DECOMP_PERF_N 4
+/* room for the rounding of the NEON reciprocal estimates on ARMv7 */
+#define DECOMP_TOL 1e-4f
+#define SVD_TOL 1e-4f
+
+typedef struct
+{
+    ne10_float32_t * spd;       /* symmetric positive definite matrices */
+    ne10_float32_t * gen;       /* general matrices */
+    ne10_float32_t * chol;      /* Cholesky factors of spd */
+    ne10_float32_t * lu;        /* LU factors of gen */
+    ne10_uint8_t * lu_piv;
+    ne10_float32_t * rhs;
+} test_decomp_inputs_t;
+
+typedef struct
+{
+    ne10_float32_t * dst;
+    ne10_float32_t * dst2;      /* R for the QR factorization */
+    ne10_uint8_t * piv;
+    ne10_int32_t * status;
+} test_decomp_outputs_t;
+
+static ne10_result_t test_decomp_run (ne10_int32_t func, ne10_int32_t is_neon, const test_decomp_outputs_t * out, const test_decomp_inputs_t * in, ne10_uint32_t n, ne10_uint32_t count)
+{
+    switch (func)
+    {
+    case 0:
+        return (is_neon ? ne10_cholesky_f32_neon : ne10_cholesky_f32_c) (out->dst, out->status, in->spd, n, count);
+    case 1:
+        return (is_neon ? ne10_cholesky_solve_f32_neon : ne10_cholesky_solve_f32_c) (out->dst, in->chol, in->rhs, n, count);
+    case DECOMP_LU:
+        return (is_neon ? ne10_lu_f32_neon : ne10_lu_f32_c) (out->dst, out->piv, out->status, in->gen, n, count);
+    case 3:
+        return (is_neon ? ne10_lu_solve_f32_neon : ne10_lu_solve_f32_c) (out->dst, in->lu, in->lu_piv, in->rhs, n, count);
+    default:
+        return (is_neon ? ne10_qr_f32_neon : ne10_qr_f32_c) (out->dst, out->dst2, in->gen, n, count);
+    }
+}
+
+/* column-major n x n matrices: dst = a * b, a^T * b or a * b^T for mode 0, 1 or 2 */
+static void test_decomp_mul (ne10_float32_t * dst, const ne10_float32_t * a, const ne10_float32_t * b, ne10_uint32_t n, ne10_int32_t mode)
+{
+    ne10_uint32_t i, j, k;
+    ne10_float32_t s;
+
+    for (j = 0; j < n; j++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            s = 0.0f;
+            for (k = 0; k < n; k++)
+                s += ( (mode == 1) ? a[i * n + k] : a[k * n + i]) * ( (mode == 2) ? b[k * n + j] : b[j * n + k]);
+            dst[j * n + i] = s;
+        }
+    }
+}
+
+/*
+ * Random matrices scaled to [-1, 1] plus 2n times a cyclic permutation, and
+ * B^T B + n I built from them for Cholesky. The random values span many
+ * orders of magnitude, so the permutation keeps every pivot well away from
+ * zero while partial pivoting still exchanges rows. The factors the
+ * solvers take come from the C versions.
+ */
+static void test_decomp_inputs (const test_decomp_inputs_t * in, ne10_int32_t * status, const ne10_float32_t * raw, ne10_uint32_t n, ne10_uint32_t count)
+{
+    const ne10_float32_t * b;
+    ne10_float32_t * a;
+    ne10_uint32_t m, i;
+
+    for (i = 0; i < count * n * n; i++)
+        in->gen[i] = raw[i] * 1e-3f;
+    for (m = 0; m < count; m++)
+    {
+        for (i = 0; i < n; i++)
+            in->gen[m * n * n + i * n + (i + 1) % n] += 2.0f * n;
+        b = in->gen + m * n * n;
+        a = in->spd + m * n * n;
+        test_decomp_mul (a, b, b, n, 1);
+        for (i = 0; i < n; i++)
+            a[i * n + i] += (ne10_float32_t) n;
+    }
+    ne10_cholesky_f32_c (in->chol, status, in->spd, n, count);
+    ne10_lu_f32_c (in->lu, in->lu_piv, status, in->gen, n, count);
+    for (i = 0; i < count * n; i++)
+        in->rhs[i] = raw[count * n * n - 1 - i] * 1e-3f;
+}
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+/* the largest |A x - b| is small next to |A| |x| + |b|, in the infinity norm */
+static void test_decomp_residual (const ne10_float32_t * a, const ne10_float32_t * x, const ne10_float32_t * b, ne10_uint32_t n, ne10_uint32_t count)
+{
+    ne10_uint32_t m, i, k;
+    ne10_float32_t r, row, r_max, a_max, x_max, b_max;
+
+    for (m = 0; m < count; m++)
+    {
+        r_max = a_max = x_max = b_max = 0.0f;
+        for (i = 0; i < n; i++)
+        {
+            r = -b[i];
+            row = 0.0f;
+            for (k = 0; k < n; k++)
+            {
+                r += a[k * n + i] * x[k];
+                row += fabsf (a[k * n + i]);
+            }
+            r_max = fmaxf (r_max, fabsf (r));
+            a_max = fmaxf (a_max, row);
+            x_max = fmaxf (x_max, fabsf (x[i]));
+            b_max = fmaxf (b_max, fabsf (b[i]));
+        }
+        assert_true (r_max <= DECOMP_TOL * (a_max * x_max + b_max));
+        a += n * n;
+        x += n;
+        b += n;
+    }
+}
+
+/* the matrix product given by ref and by the factors of out agree */
+static void test_decomp_product (ne10_float32_t * prod, ne10_float32_t * ref, const ne10_float32_t * f1, const ne10_float32_t * f2, ne10_uint32_t n, ne10_int32_t mode, ne10_uint32_t count)
+{
+    ne10_uint32_t m;
+
+    for (m = 0; m < count; m++)
+    {
+        test_decomp_mul (prod, f1 + m * n * n, f2 + m * n * n, n, mode);
+        test_transcendental_check (ref + m * n * n, prod, DECOMP_TOL * n, DECOMP_TOL, n * n);
+    }
+}
+#endif
+
+void test_decomp_case0()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+    ne10_uint32_t n;
+    ne10_float32_t * guarded_dst2_c = NULL;
+    ne10_uint8_t * guarded_piv_c = NULL;
+    ne10_int32_t * guarded_status_c = NULL;
+    test_decomp_inputs_t in;
+    test_decomp_outputs_t out_c;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_float32_t * guarded_dst2_neon = NULL;
+    ne10_uint8_t * guarded_piv_neon = NULL;
+    ne10_int32_t * guarded_status_neon = NULL;
+    test_decomp_outputs_t out_neon;
+    ne10_uint32_t i, j, m, size;
+    ne10_result_t result_c, result_neon;
+    const ne10_uint32_t fixed_length = DECOMP_LEN;
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    in.spd = (ne10_float32_t *) malloc (fixed_length * sizeof (ne10_float32_t));
+    in.gen = (ne10_float32_t *) malloc (fixed_length * sizeof (ne10_float32_t));
+    in.chol = (ne10_float32_t *) malloc (fixed_length * sizeof (ne10_float32_t));
+    in.lu = (ne10_float32_t *) malloc (fixed_length * sizeof (ne10_float32_t));
+    in.lu_piv = (ne10_uint8_t *) malloc (fixed_length);
+    in.rhs = (ne10_float32_t *) malloc (fixed_length * sizeof (ne10_float32_t));
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, fixed_length);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, fixed_length);
+    NE10_DST_ALLOC (out_c.dst2, guarded_dst2_c, fixed_length);
+    NE10_DST_ALLOC (out_neon.dst2, guarded_dst2_neon, fixed_length);
+    guarded_piv_c = (ne10_uint8_t *) calloc (fixed_length + 2 * ARRAY_GUARD_LEN, 1);
+    guarded_piv_neon = (ne10_uint8_t *) calloc (fixed_length + 2 * ARRAY_GUARD_LEN, 1);
+    guarded_status_c = (ne10_int32_t *) calloc (TEST_ITERATION + 2, sizeof (ne10_int32_t));
+    guarded_status_neon = (ne10_int32_t *) calloc (TEST_ITERATION + 2, sizeof (ne10_int32_t));
+    out_c.dst = thedst_c;
+    out_c.piv = guarded_piv_c + ARRAY_GUARD_LEN;
+    out_c.status = guarded_status_c + 1;
+    out_neon.dst = thedst_neon;
+    out_neon.piv = guarded_piv_neon + ARRAY_GUARD_LEN;
+    out_neon.status = guarded_status_neon + 1;
+
+    for (n = 2; n <= NE10_DECOMP_MAX_N; n++)
+    {
+        test_decomp_inputs (&in, out_c.status, thesrc1, n, TEST_ITERATION);
+        for (func_loop = 0; func_loop < DECOMP_FUNC_COUNT; func_loop++)
+        {
+            for (loop = 0; loop < TEST_ITERATION; loop++)
+            {
+                /* the solvers write n floats per system */
+                size = loop * ( (func_loop == 1 || func_loop == 3) ? n : n * n);
+                GUARD_ARRAY (thedst_c, size);
+                GUARD_ARRAY (thedst_neon, size);
+                GUARD_ARRAY (out_c.dst2, size);
+                GUARD_ARRAY (out_neon.dst2, size);
+                GUARD_ARRAY_UINT8 (out_c.piv, loop * n);
+                GUARD_ARRAY_UINT8 (out_neon.piv, loop * n);
+                GUARD_ARRAY_UINT8 ( (ne10_uint8_t *) out_c.status, loop * sizeof (ne10_int32_t));
+                GUARD_ARRAY_UINT8 ( (ne10_uint8_t *) out_neon.status, loop * sizeof (ne10_int32_t));
+
+                result_c = test_decomp_run (func_loop, 0, &out_c, &in, n, loop);
+                result_neon = test_decomp_run (func_loop, 1, &out_neon, &in, n, loop);
+
+                assert_true (CHECK_ARRAY_GUARD (thedst_c, size));
+                assert_true (CHECK_ARRAY_GUARD (thedst_neon, size));
+                assert_true (CHECK_ARRAY_GUARD (out_c.dst2, size));
+                assert_true (CHECK_ARRAY_GUARD (out_neon.dst2, size));
+                assert_true (CHECK_ARRAY_GUARD_UINT8 (out_c.piv, loop * n));
+                assert_true (CHECK_ARRAY_GUARD_UINT8 (out_neon.piv, loop * n));
+                assert_true (CHECK_ARRAY_GUARD_UINT8 ( (ne10_uint8_t *) out_c.status, loop * sizeof (ne10_int32_t)));
+                assert_true (CHECK_ARRAY_GUARD_UINT8 ( (ne10_uint8_t *) out_neon.status, loop * sizeof (ne10_int32_t)));
+#ifdef DEBUG_TRACE
+                fprintf (stdout, "func: %d n: %d loop count: %d\n", func_loop, n, loop);
+#endif
+                assert_int_equal (NE10_OK, result_c);
+                assert_int_equal (NE10_OK, result_neon);
+                test_transcendental_check (thedst_c, thedst_neon, DECOMP_TOL, DECOMP_TOL, size);
+                if (func_loop == DECOMP_QR)
+                    test_transcendental_check (out_c.dst2, out_neon.dst2, DECOMP_TOL, DECOMP_TOL, size);
+                if (func_loop == 0 || func_loop == DECOMP_LU)
+                {
+                    for (i = 0; i < (ne10_uint32_t) loop; i++)
+                        assert_int_equal (0, out_neon.status[i]);
+                }
+                if (func_loop == DECOMP_LU)
+                {
+                    for (i = 0; i < loop * n; i++)
+                        assert_int_equal (out_c.piv[i], out_neon.piv[i]);
+                }
+            }
+        }
+
+        /* the factors reproduce the matrices, and the solutions solve the systems */
+        ne10_cholesky_f32_neon (thedst_neon, out_neon.status, in.spd, n, TEST_ITERATION);
+        test_decomp_product (thedst_c, in.spd, thedst_neon, thedst_neon, n, 2, TEST_ITERATION);
+        ne10_cholesky_solve_f32_neon (thedst_neon, in.chol, in.rhs, n, TEST_ITERATION);
+        test_decomp_residual (in.spd, thedst_neon, in.rhs, n, TEST_ITERATION);
+        ne10_lu_solve_f32_neon (thedst_neon, in.lu, in.lu_piv, in.rhs, n, TEST_ITERATION);
+        test_decomp_residual (in.gen, thedst_neon, in.rhs, n, TEST_ITERATION);
+
+        /* Q R = A, Q^T Q = I, and R is upper triangular */
+        ne10_qr_f32_neon (thedst_neon, out_neon.dst2, in.gen, n, TEST_ITERATION);
+        test_decomp_product (thedst_c, in.gen, thedst_neon, out_neon.dst2, n, 0, TEST_ITERATION);
+        for (m = 0; m < TEST_ITERATION; m++)
+        {
+            test_decomp_mul (thedst_c, thedst_neon + m * n * n, thedst_neon + m * n * n, n, 1);
+            for (j = 0; j < n; j++)
+            {
+                for (i = 0; i < n; i++)
+                {
+                    assert_true (fabsf (thedst_c[j * n + i] - ( (i == j) ? 1.0f : 0.0f)) <= DECOMP_TOL);
+                    if (i > j)
+                        assert_true (out_neon.dst2[m * n * n + j * n + i] == 0.0f);
+                }
+            }
+        }
+
+        /*
+         * One matrix in seven made indefinite at its last pivot, one in five
+         * made singular by a zero column and one in five made nearly so by
+         * scaling that column by 2^-30: their status records the pivot, and
+         * the rest of the batch is factorized as before.
+         */
+        for (m = 3; m < TEST_ITERATION; m += 7)
+            in.spd[m * n * n + n * n - 1] = -in.spd[m * n * n + n * n - 1];
+        for (m = 1; m < TEST_ITERATION; m += 5)
+        {
+            for (i = 0; i < n; i++)
+                in.gen[m * n * n + (m % n) * n + i] = 0.0f;
+        }
+        for (m = 3; m < TEST_ITERATION; m += 5)
+        {
+            for (i = 0; i < n; i++)
+                in.gen[m * n * n + (m % n) * n + i] *= 1.0f / 1073741824.0f;
+        }
+        for (func_loop = 0; func_loop <= DECOMP_LU; func_loop += DECOMP_LU)
+        {
+            result_c = test_decomp_run (func_loop, 0, &out_c, &in, n, TEST_ITERATION);
+            result_neon = test_decomp_run (func_loop, 1, &out_neon, &in, n, TEST_ITERATION);
+            assert_int_equal (NE10_ERR, result_c);
+            assert_int_equal (NE10_ERR, result_neon);
+            for (m = 0; m < TEST_ITERATION; m++)
+            {
+                if (func_loop == 0)
+                    size = (m % 7 == 3) ? n : 0;
+                else
+                    size = (m % 5 == 1 || m % 5 == 3) ? (m % n) + 1 : 0;
+                assert_int_equal (size, out_c.status[m]);
+                assert_int_equal (size, out_neon.status[m]);
+                /* a singular matrix is still factorized as far as it goes */
+                if (size == 0 || func_loop == DECOMP_LU)
+                    test_transcendental_check (thedst_c + m * n * n, thedst_neon + m * n * n, DECOMP_TOL, DECOMP_TOL, n * n);
+            }
+        }
+        /* a zero column gets no reflection in QR */
+        test_decomp_run (DECOMP_QR, 0, &out_c, &in, n, TEST_ITERATION);
+        test_decomp_run (DECOMP_QR, 1, &out_neon, &in, n, TEST_ITERATION);
+        test_transcendental_check (thedst_c, thedst_neon, DECOMP_TOL, DECOMP_TOL, TEST_ITERATION * n * n);
+        test_transcendental_check (out_c.dst2, out_neon.dst2, DECOMP_TOL, DECOMP_TOL, TEST_ITERATION * n * n);
+        test_decomp_product (thedst_c, in.gen, thedst_neon, out_neon.dst2, n, 0, TEST_ITERATION);
+    }
+
+    /* orders outside 2 to NE10_DECOMP_MAX_N are rejected */
+    assert_int_equal (NE10_ERR, ne10_cholesky_f32_c (thedst_c, out_c.status, in.spd, 1, 1));
+    assert_int_equal (NE10_ERR, ne10_lu_f32_neon (thedst_neon, out_neon.piv, out_neon.status, in.gen, NE10_DECOMP_MAX_N + 1, 4));
+    assert_int_equal (NE10_ERR, ne10_qr_f32_neon (thedst_neon, out_neon.dst2, in.gen, 0, 4));
+
+    free (guarded_src1);
+    free (in.spd);
+    free (in.gen);
+    free (in.chol);
+    free (in.lu);
+    free (in.lu_piv);
+    free (in.rhs);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+    free (guarded_dst2_c);
+    free (guarded_dst2_neon);
+    free (guarded_piv_c);
+    free (guarded_piv_neon);
+    free (guarded_status_c);
+    free (guarded_status_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    const ne10_uint32_t perf_length = PERF_TEST_ITERATION * NE10_DECOMP_MAX_N * NE10_DECOMP_MAX_N;
+
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perf_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    in.spd = (ne10_float32_t *) malloc (perf_length * sizeof (ne10_float32_t));
+    in.gen = (ne10_float32_t *) malloc (perf_length * sizeof (ne10_float32_t));
+    in.chol = (ne10_float32_t *) malloc (perf_length * sizeof (ne10_float32_t));
+    in.lu = (ne10_float32_t *) malloc (perf_length * sizeof (ne10_float32_t));
+    in.lu_piv = (ne10_uint8_t *) malloc (perf_length);
+    in.rhs = (ne10_float32_t *) malloc (perf_length * sizeof (ne10_float32_t));
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perf_length);
+    NE10_DST_ALLOC (out_c.dst2, guarded_dst2_c, perf_length);
+    guarded_piv_c = (ne10_uint8_t *) malloc (perf_length);
+    guarded_status_c = (ne10_int32_t *) malloc (PERF_TEST_ITERATION * sizeof (ne10_int32_t));
+    out_c.dst = perftest_thedst_c;
+    out_c.piv = guarded_piv_c;
+    out_c.status = guarded_status_c;
+
+    n = DECOMP_PERF_N;
+    test_decomp_inputs (&in, out_c.status, perftest_thesrc1, n, PERF_TEST_ITERATION);
+    for (func_loop = 0; func_loop < DECOMP_FUNC_COUNT; func_loop++)
+    {
+        GET_TIME (time_c,
+                  for (loop = 0; loop < 16; loop++) test_decomp_run (func_loop, 0, &out_c, &in, n, PERF_TEST_ITERATION);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < 16; loop++) test_decomp_run (func_loop, 1, &out_c, &in, n, PERF_TEST_ITERATION);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+    free (in.spd);
+    free (in.gen);
+    free (in.chol);
+    free (in.lu);
+    free (in.lu_piv);
+    free (in.rhs);
+    free (perftest_guarded_dst_c);
+    free (guarded_dst2_c);
+    free (guarded_piv_c);
+    free (guarded_status_c);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+static void test_svd_run (ne10_int32_t is_neon, ne10_float32_t * u, ne10_float32_t * s, ne10_float32_t * v, ne10_float32_t * src, ne10_uint32_t count)
+{
+    (is_neon ? ne10_svd_3x3f_neon : ne10_svd_3x3f_c) ( (ne10_mat3x3f_t *) u, (ne10_vec3f_t *) s, (ne10_mat3x3f_t *) v, (ne10_mat3x3f_t *) src, count);
+}
+
+/*
+ * 3x3 matrices in [-1, 1]. One in six has rank 2, and another one in six
+ * has orthogonal columns, two of them of the same length.
+ */
+static void test_svd_inputs (ne10_float32_t * a, ne10_uint32_t count)
+{
+    ne10_uint32_t m, i;
+
+    for (i = 0; i < count * 9; i++)
+        a[i] *= 1e-3f;
+    for (m = 2; m < count; m += 6)
+    {
+        for (i = 0; i < 3; i++)
+            a[m * 9 + 6 + i] = a[m * 9 + i] + a[m * 9 + 3 + i];
+    }
+    for (m = 4; m < count; m += 6)
+    {
+        for (i = 1; i < 8; i++)
+            a[m * 9 + i] = 0.0f;
+        a[m * 9 + 4] = a[m * 9];
+    }
+}
+
+void test_decomp_case1()
+{
+    ne10_int32_t loop;
+    ne10_float32_t * guarded_s_c = NULL;
+    ne10_float32_t * guarded_v_c = NULL;
+    ne10_float32_t * s_c;
+    ne10_float32_t * v_c;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_float32_t * guarded_s_neon = NULL;
+    ne10_float32_t * guarded_v_neon = NULL;
+    ne10_float32_t * s_neon;
+    ne10_float32_t * v_neon;
+    ne10_uint32_t i, j, m;
+    ne10_float32_t us[9];
+    const ne10_float32_t * s;
+    const ne10_uint32_t fixed_length = TEST_ITERATION * 9;
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    test_svd_inputs (thesrc1, TEST_ITERATION);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, fixed_length);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, fixed_length);
+    NE10_DST_ALLOC (theacc, guarded_acc, fixed_length);
+    NE10_DST_ALLOC (s_c, guarded_s_c, fixed_length);
+    NE10_DST_ALLOC (s_neon, guarded_s_neon, fixed_length);
+    NE10_DST_ALLOC (v_c, guarded_v_c, fixed_length);
+    NE10_DST_ALLOC (v_neon, guarded_v_neon, fixed_length);
+
+    for (loop = 0; loop < TEST_ITERATION; loop++)
+    {
+        GUARD_ARRAY (thedst_c, loop * 9);
+        GUARD_ARRAY (thedst_neon, loop * 9);
+        GUARD_ARRAY (s_c, loop * 3);
+        GUARD_ARRAY (s_neon, loop * 3);
+        GUARD_ARRAY (v_c, loop * 9);
+        GUARD_ARRAY (v_neon, loop * 9);
+
+        test_svd_run (0, thedst_c, s_c, v_c, thesrc1, loop);
+        test_svd_run (1, thedst_neon, s_neon, v_neon, thesrc1, loop);
+
+        assert_true (CHECK_ARRAY_GUARD (thedst_c, loop * 9));
+        assert_true (CHECK_ARRAY_GUARD (thedst_neon, loop * 9));
+        assert_true (CHECK_ARRAY_GUARD (s_c, loop * 3));
+        assert_true (CHECK_ARRAY_GUARD (s_neon, loop * 3));
+        assert_true (CHECK_ARRAY_GUARD (v_c, loop * 9));
+        assert_true (CHECK_ARRAY_GUARD (v_neon, loop * 9));
+#ifdef DEBUG_TRACE
+        fprintf (stdout, "loop count: %d\n", loop);
+#endif
+        test_transcendental_check (thedst_c, thedst_neon, SVD_TOL, SVD_TOL, loop * 9);
+        test_transcendental_check (s_c, s_neon, SVD_TOL, SVD_TOL, loop * 3);
+        test_transcendental_check (v_c, v_neon, SVD_TOL, SVD_TOL, loop * 9);
+    }
+
+    /* U diag(s) V^T = A with orthogonal U and V, even for rank 2, and s in decreasing order */
+    test_svd_run (1, thedst_neon, s_neon, v_neon, thesrc1, TEST_ITERATION);
+    for (m = 0; m < TEST_ITERATION; m++)
+    {
+        s = s_neon + m * 3;
+        assert_true (s[0] >= s[1] && s[1] >= s[2] && s[2] >= 0.0f);
+        for (j = 0; j < 3; j++)
+        {
+            for (i = 0; i < 3; i++)
+                us[j * 3 + i] = thedst_neon[m * 9 + j * 3 + i] * s[j];
+        }
+        test_decomp_mul (theacc, us, v_neon + m * 9, 3, 2);
+        test_transcendental_check (thesrc1 + m * 9, theacc, SVD_TOL * 3, SVD_TOL, 9);
+
+        test_decomp_mul (theacc, thedst_neon + m * 9, thedst_neon + m * 9, 3, 1);
+        test_decomp_mul (theacc + 9, v_neon + m * 9, v_neon + m * 9, 3, 1);
+        for (j = 0; j < 3; j++)
+        {
+            for (i = 0; i < 3; i++)
+            {
+                assert_true (fabsf (theacc[j * 3 + i] - ( (i == j) ? 1.0f : 0.0f)) <= SVD_TOL);
+                assert_true (fabsf (theacc[9 + j * 3 + i] - ( (i == j) ? 1.0f : 0.0f)) <= SVD_TOL);
+            }
+        }
+    }
+
+    free (guarded_src1);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+    free (guarded_acc);
+    free (guarded_s_c);
+    free (guarded_s_neon);
+    free (guarded_v_c);
+    free (guarded_v_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    const ne10_uint32_t perf_length = PERF_TEST_ITERATION * 9;
+
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perf_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    test_svd_inputs (perftest_thesrc1, PERF_TEST_ITERATION);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perf_length);
+    NE10_DST_ALLOC (s_c, guarded_s_c, perf_length);
+    NE10_DST_ALLOC (v_c, guarded_v_c, perf_length);
+
+    GET_TIME (time_c,
+              for (loop = 0; loop < 16; loop++) test_svd_run (0, perftest_thedst_c, s_c, v_c, perftest_thesrc1, PERF_TEST_ITERATION);
+             );
+    GET_TIME (time_neon,
+              for (loop = 0; loop < 16; loop++) test_svd_run (1, perftest_thedst_c, s_c, v_c, perftest_thesrc1, PERF_TEST_ITERATION);
+             );
+    time_speedup = (ne10_float32_t) time_c / time_neon;
+    time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+    ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", 0, time_c, time_neon, time_savings, time_speedup);
+
+    free (perftest_guarded_src1);
+    free (perftest_guarded_dst_c);
+    free (guarded_s_c);
+    free (guarded_v_c);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+#define MAT_F32_FUNC_COUNT 7
+#define MAT_F32_TRANSPOSE 4
+#define MAT_F32_MUL 5
+#define MAT_F32_MULVEC 6
+#define MAT_F32_SCALE -0.75f
+/* rows, cols, inner size of the products: odd sizes, exact tiles, and sizes crossing the 32 x 32 transposition blocks */
+#define MAT_F32_SHAPE_COUNT 7
+static const ne10_uint32_t test_mat_f32_shape[MAT_F32_SHAPE_COUNT][3] =
+{
+    { 1, 1, 1 }, { 3, 5, 2 }, { 4, 4, 4 }, { 7, 9, 6 }, { 32, 32, 32 }, { 33, 70, 17 }, { 65, 35, 40 }
+};
+
+static ne10_result_t test_mat_f32_run (ne10_int32_t func, ne10_int32_t is_neon, ne10_mat_f32_t * dst, ne10_mat_f32_t * src1, ne10_mat_f32_t * src2)
+{
+    switch (func)
+    {
+    case 0:
+        return (is_neon ? ne10_mat_add_f32_neon : ne10_mat_add_f32_c) (dst, src1, src2);
+    case 1:
+        return (is_neon ? ne10_mat_sub_f32_neon : ne10_mat_sub_f32_c) (dst, src1, src2);
+    case 2:
+        return (is_neon ? ne10_mat_mul_elem_f32_neon : ne10_mat_mul_elem_f32_c) (dst, src1, src2);
+    case 3:
+        return (is_neon ? ne10_mat_scale_f32_neon : ne10_mat_scale_f32_c) (dst, src1, MAT_F32_SCALE);
+    case MAT_F32_TRANSPOSE:
+        return (is_neon ? ne10_mat_transpose_f32_neon : ne10_mat_transpose_f32_c) (dst, src1);
+    case MAT_F32_MUL:
+        return (is_neon ? ne10_mat_mul_f32_neon : ne10_mat_mul_f32_c) (dst, src1, src2);
+    default:
+        /* the vector is the first row of src2 */
+        return (is_neon ? ne10_mat_mulvec_f32_neon : ne10_mat_mulvec_f32_c) (dst->data, src1, src2->data);
+    }
+}
+
+/* a rows x cols descriptor over data, with GEMM_LD_PAD spare elements per row */
+static void test_mat_f32_view (ne10_mat_f32_t * m, ne10_float32_t * data, ne10_uint32_t rows, ne10_uint32_t cols)
+{
+    m->rows = rows;
+    m->cols = cols;
+    m->stride = cols + GEMM_LD_PAD;
+    m->data = data;
+}
+
+void test_mat_f32_case0()
+{
+    ne10_int32_t func_loop;
+    ne10_mat_f32_t dst_c, src1, src2;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_int32_t shape;
+    ne10_uint32_t i, j;
+    ne10_mat_f32_t dst_neon;
+
+    /* init src memory: values in [-1, 1] */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, GEMM_POOL_LENGTH); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, GEMM_POOL_LENGTH); // 16 extra bytes at the begining and 16 extra bytes at the end
+    test_cpx_normalize (thesrc1, GEMM_POOL_LENGTH);
+    test_cpx_normalize (thesrc2, GEMM_POOL_LENGTH);
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, GEMM_POOL_LENGTH);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, GEMM_POOL_LENGTH);
+
+    for (shape = 0; shape < MAT_F32_SHAPE_COUNT; shape++)
+    {
+        ne10_uint32_t rows = test_mat_f32_shape[shape][0];
+        ne10_uint32_t cols = test_mat_f32_shape[shape][1];
+        ne10_uint32_t inner = test_mat_f32_shape[shape][2];
+
+        for (func_loop = 0; func_loop < MAT_F32_FUNC_COUNT; func_loop++)
+        {
+            /* the element-wise operations are exact; the products round like the GEMM kernels */
+            ne10_float32_t tol = (func_loop >= MAT_F32_MUL) ? 1.0e-6f * (inner + 1) : 0.0f;
+
+            if (func_loop == MAT_F32_TRANSPOSE)
+            {
+                test_mat_f32_view (&src1, thesrc1, cols, rows);
+                test_mat_f32_view (&dst_c, thedst_c, rows, cols);
+            }
+            else if (func_loop >= MAT_F32_MUL)
+            {
+                test_mat_f32_view (&src1, thesrc1, rows, inner);
+                test_mat_f32_view (&src2, thesrc2, inner, cols);
+                test_mat_f32_view (&dst_c, thedst_c, rows, cols);
+            }
+            else
+            {
+                test_mat_f32_view (&src1, thesrc1, rows, cols);
+                test_mat_f32_view (&src2, thesrc2, rows, cols);
+                test_mat_f32_view (&dst_c, thedst_c, rows, cols);
+            }
+            dst_neon = dst_c;
+            dst_neon.data = thedst_neon;
+
+#ifdef DEBUG_TRACE
+            fprintf (stdout, "func: %d rows: %d cols: %d inner: %d\n", func_loop, rows, cols, inner);
+#endif
+            if (func_loop == MAT_F32_MULVEC)
+            {
+                GUARD_ARRAY (thedst_c, rows);
+                GUARD_ARRAY (thedst_neon, rows);
+                assert_int_equal (NE10_OK, test_mat_f32_run (func_loop, 0, &dst_c, &src1, &src2));
+                assert_int_equal (NE10_OK, test_mat_f32_run (func_loop, 1, &dst_neon, &src1, &src2));
+                assert_true (CHECK_ARRAY_GUARD (thedst_c, rows));
+                assert_true (CHECK_ARRAY_GUARD (thedst_neon, rows));
+                test_gemm_check_out (thedst_c, thedst_neon, 1, rows, rows, tol);
+                continue;
+            }
+
+            /* the padding of the rows must survive */
+            test_gemm_fill_out (thedst_c, NULL, dst_c.rows, dst_c.cols, dst_c.stride, 1);
+            test_gemm_fill_out (thedst_neon, NULL, dst_c.rows, dst_c.cols, dst_c.stride, 1);
+            assert_int_equal (NE10_OK, test_mat_f32_run (func_loop, 0, &dst_c, &src1, &src2));
+            assert_int_equal (NE10_OK, test_mat_f32_run (func_loop, 1, &dst_neon, &src1, &src2));
+            test_gemm_check_out (thedst_c, thedst_neon, dst_c.rows, dst_c.cols, dst_c.stride, tol);
+
+            if (func_loop == MAT_F32_TRANSPOSE)
+            {
+                for (i = 0; i < rows; i++)
+                {
+                    for (j = 0; j < cols; j++)
+                        assert_true (thedst_neon[i * dst_c.stride + j] == thesrc1[j * src1.stride + i]);
+                }
+            }
+            else if (func_loop < MAT_F32_TRANSPOSE)
+            {
+                /* in place, into the first source */
+                memcpy (thedst_neon, thesrc1, rows * src1.stride * sizeof (ne10_float32_t));
+                src1.data = thedst_neon;
+                assert_int_equal (NE10_OK, test_mat_f32_run (func_loop, 1, &dst_neon, &src1, &src2));
+                for (i = 0; i < rows; i++)
+                {
+                    for (j = 0; j < cols; j++)
+                        assert_true (thedst_neon[i * dst_c.stride + j] == thedst_c[i * dst_c.stride + j]);
+                }
+            }
+        }
+    }
+
+    /* mismatched sizes are rejected */
+    test_mat_f32_view (&src1, thesrc1, 4, 5);
+    test_mat_f32_view (&src2, thesrc2, 5, 4);
+    test_mat_f32_view (&dst_c, thedst_c, 4, 5);
+    assert_int_equal (NE10_ERR, ne10_mat_add_f32_c (&dst_c, &src1, &src2));
+    assert_int_equal (NE10_ERR, ne10_mat_add_f32_neon (&dst_c, &src1, &src2));
+    assert_int_equal (NE10_ERR, ne10_mat_transpose_f32_c (&dst_c, &src1));
+    assert_int_equal (NE10_ERR, ne10_mat_transpose_f32_neon (&dst_c, &src1));
+    assert_int_equal (NE10_ERR, ne10_mat_mul_f32_c (&dst_c, &src1, &src2));
+    assert_int_equal (NE10_ERR, ne10_mat_mul_f32_neon (&dst_c, &src1, &src2));
+    /* and so are strides shorter than the rows */
+    src2 = src1;
+    src2.stride = 3;
+    assert_int_equal (NE10_ERR, ne10_mat_scale_f32_c (&dst_c, &src2, 1.0f));
+    assert_int_equal (NE10_ERR, ne10_mat_scale_f32_neon (&dst_c, &src2, 1.0f));
+
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_int32_t loop;
+
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = 256 * 256;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perftest_length);
+
+    /* 256 x 256 matrices; the products against the naive loops of the C versions */
+    src1.rows = src1.cols = src1.stride = 256;
+    src2 = dst_c = src1;
+    src1.data = perftest_thesrc1;
+    src2.data = perftest_thesrc2;
+    dst_c.data = perftest_thedst_c;
+    for (func_loop = 0; func_loop < MAT_F32_FUNC_COUNT; func_loop++)
+    {
+        GET_TIME (time_c,
+                  for (loop = 0; loop < 4; loop++) test_mat_f32_run (func_loop, 0, &dst_c, &src1, &src2);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < 4; loop++) test_mat_f32_run (func_loop, 1, &dst_c, &src1, &src2);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+    free (perftest_guarded_dst_c);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+/* fused kernels under test: axpby, mulcaddc, clamp, lerp, sqdiff_acc, scale_float_s16 */
+#define FUSED_FUNC_COUNT 6
+
+static void test_fused_run (ne10_int32_t func, ne10_int32_t is_neon, ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    switch (func)
+    {
+    case 0:
+        if (is_neon)
+            ne10_axpby_float_neon (dst, src1, src2, 0.75f, -1.25f, count);
+        else
+            ne10_axpby_float_c (dst, src1, src2, 0.75f, -1.25f, count);
+        break;
+    case 1:
+        if (is_neon)
+            ne10_mulcaddc_float_neon (dst, src1, 0.5f, 3.0f, count);
+        else
+            ne10_mulcaddc_float_c (dst, src1, 0.5f, 3.0f, count);
+        break;
+    case 2:
+        if (is_neon)
+            ne10_clamp_float_neon (dst, src1, -100.0f, 250.0f, count);
+        else
+            ne10_clamp_float_c (dst, src1, -100.0f, 250.0f, count);
+        break;
+    case 3:
+        if (is_neon)
+            ne10_lerp_float_neon (dst, src1, src2, 0.3f, count);
+        else
+            ne10_lerp_float_c (dst, src1, src2, 0.3f, count);
+        break;
+    case 4:
+        if (is_neon)
+            ne10_sqdiff_acc_float_neon (dst, acc, src1, src2, count);
+        else
+            ne10_sqdiff_acc_float_c (dst, acc, src1, src2, count);
+        break;
+    default:
+        /* large enough to saturate part of the +-1000 inputs */
+        if (is_neon)
+            ne10_scale_float_s16_neon ( (ne10_int16_t*) dst, src1, 40.0f, count);
+        else
+            ne10_scale_float_s16_c ( (ne10_int16_t*) dst, src1, 40.0f, count);
+        break;
+    }
+}
+
+void test_fused_case0()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_int32_t i;
+    ne10_int32_t is_neon;
+    ne10_int16_t * out_c;
+    ne10_int16_t * out_neon;
+    const ne10_uint32_t fixed_length = TEST_ITERATION;
+    /* ties, saturation and values just below the rounding boundaries, also used to test clamping */
+    static const ne10_float32_t round_src[16] =
+    {
+        0.5f, -0.5f, 1.49f, -1.5f, 2.5f, 40000.0f, -40000.0f, 32767.4f,
+        0.49999997f, -0.49999997f, 100.5f, -100.5f, 32766.5f, -32768.6f, 7.0f, -7.0f
+    };
+    static const ne10_int16_t round_ref[16] =
+    {
+        1, -1, 1, -2, 3, 32767, -32768, 32767,
+        0, 0, 101, -101, 32767, -32768, 7, -7
+    };
+    ne10_float32_t round_dst[16];
+    ne10_float32_t nan_src[5];
+    ne10_int16_t nan_dst[5];
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (theacc, guarded_acc, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, fixed_length);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, fixed_length);
+
+    for (func_loop = 0; func_loop < FUSED_FUNC_COUNT; func_loop++)
+    {
+        for (loop = 0; loop < TEST_ITERATION; loop++)
+        {
+            GUARD_ARRAY (thedst_c, loop);
+            GUARD_ARRAY (thedst_neon, loop);
+
+            test_fused_run (func_loop, 0, thedst_c, theacc, thesrc1, thesrc2, loop);
+            test_fused_run (func_loop, 1, thedst_neon, theacc, thesrc1, thesrc2, loop);
+
+            assert_true (CHECK_ARRAY_GUARD (thedst_c, loop));
+            assert_true (CHECK_ARRAY_GUARD (thedst_neon, loop));
+
+#ifdef DEBUG_TRACE
+            fprintf (stdout, "func: %d loop count: %d\n", func_loop, loop);
+            for (i = 0; i < loop; i++)
+            {
+                fprintf (stdout, "thesrc1->%d: %e [0x%04X] \n", i, thesrc1[i], * (ne10_uint32_t*) &thesrc1[i]);
+                fprintf (stdout, "thesrc2->%d: %e [0x%04X] \n", i, thesrc2[i], * (ne10_uint32_t*) &thesrc2[i]);
+            }
+#endif
+            if (func_loop == FUSED_FUNC_COUNT - 1)
+            {
+                out_c = (ne10_int16_t*) thedst_c;
+                out_neon = (ne10_int16_t*) thedst_neon;
+                for (i = 0; i < loop; i++)
+                    assert_int_equal (out_c[i], out_neon[i]);
+            }
+            else
+                assert_float_vec_equal (thedst_c, thedst_neon, ERROR_MARGIN_SMALL, loop);
+        }
+    }
+
+    /* the fused kernel is a drop-in replacement for mulc followed by addc */
+    ne10_mulc_float_c (thedst_c, thesrc1, 0.5f, fixed_length);
+    ne10_addc_float_c (thedst_c, thedst_c, 3.0f, fixed_length);
+    ne10_mulcaddc_float_c (thedst_neon, thesrc1, 0.5f, 3.0f, fixed_length);
+    assert_float_vec_equal (thedst_c, thedst_neon, ERROR_MARGIN_SMALL, fixed_length);
+
+    for (is_neon = 0; is_neon < 2; is_neon++)
+    {
+        /* clamping on both sides, in the vector loop and in the tail */
+        for (loop = 15; loop <= 16; loop++)
+        {
+            if (is_neon)
+                ne10_clamp_float_neon (round_dst, (ne10_float32_t*) round_src, -100.0f, 250.0f, loop);
+            else
+                ne10_clamp_float_c (round_dst, (ne10_float32_t*) round_src, -100.0f, 250.0f, loop);
+            for (i = 0; i < loop; i++)
+            {
+                if (round_src[i] < -100.0f)
+                    assert_true (round_dst[i] == -100.0f);
+                else if (round_src[i] > 250.0f)
+                    assert_true (round_dst[i] == 250.0f);
+                else
+                    assert_true (round_dst[i] == round_src[i]);
+            }
+        }
+
+        /* rounding and saturation of the conversion, through both the vector loop and the tail */
+        for (loop = 8; loop <= 16; loop += 4)
+        {
+            memset (round_dst, 0, sizeof (round_dst));
+            if (is_neon)
+                ne10_scale_float_s16_neon ( (ne10_int16_t*) round_dst, (ne10_float32_t*) round_src, 1.0f, loop);
+            else
+                ne10_scale_float_s16_c ( (ne10_int16_t*) round_dst, (ne10_float32_t*) round_src, 1.0f, loop);
+            for (i = 0; i < loop; i++)
+                assert_int_equal (round_ref[i], ( (ne10_int16_t*) round_dst) [i]);
+        }
+
+        /* NaN converts to 0, in the vector loop and in the tail */
+        for (i = 0; i < 5; i++)
+        {
+            nan_src[i] = NAN;
+            nan_dst[i] = -1;
+        }
+        if (is_neon)
+            ne10_scale_float_s16_neon (nan_dst, nan_src, 1.0f, 5);
+        else
+            ne10_scale_float_s16_c (nan_dst, nan_src, 1.0f, 5);
+        for (i = 0; i < 5; i++)
+            assert_int_equal (0, nan_dst[i]);
+    }
+
+    free (guarded_acc);
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = PERF_TEST_ITERATION;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_theacc, perftest_guarded_acc, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perftest_length);
+    NE10_DST_ALLOC (perftest_thedst_neon, perftest_guarded_dst_neon, perftest_length);
+
+    for (func_loop = 0; func_loop < FUSED_FUNC_COUNT; func_loop++)
+    {
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_fused_run (func_loop, 0, perftest_thedst_c, perftest_theacc, perftest_thesrc1, perftest_thesrc2, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_fused_run (func_loop, 1, perftest_thedst_neon, perftest_theacc, perftest_thesrc1, perftest_thesrc2, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    /* logged after the kernels: mulcaddc against the two NEON passes it replaces */
+    GET_TIME (time_c,
+              for (loop = 0; loop < PERF_TEST_ITERATION; loop++)
+              {
+                  ne10_mulc_float_neon (perftest_thedst_c, perftest_thesrc1, 0.5f, loop);
+                  ne10_addc_float_neon (perftest_thedst_c, perftest_thedst_c, 3.0f, loop);
+              }
+             );
+    GET_TIME (time_neon,
+              for (loop = 0; loop < PERF_TEST_ITERATION; loop++) ne10_mulcaddc_float_neon (perftest_thedst_neon, perftest_thesrc1, 0.5f, 3.0f, loop);
+             );
+    time_speedup = (ne10_float32_t) time_c / time_neon;
+    time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+    ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", FUSED_FUNC_COUNT, time_c, time_neon, time_savings, time_speedup);
+
+    free (perftest_guarded_acc);
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+    free (perftest_guarded_dst_c);
+    free (perftest_guarded_dst_neon);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+/* conversions under test: float_q15, float_q31, float_u8, q15_float, q31_float, u8_float, float_f16, f16_float, int16_int32, int32_int16 */
+#define CONVERT_FUNC_COUNT 10
+
+/* bytes written per converted item */
+static const ne10_uint32_t test_convert_dst_size[CONVERT_FUNC_COUNT] = { 2, 4, 1, 4, 4, 4, 2, 4, 4, 2 };
+
+/*
+ * The float to integer conversions are run in each rounding mode, and the
+ * integer conversions with a shift of 1, 8 or 15, selected by variant.
+ */
+static ne10_result_t test_convert_run (ne10_int32_t func, ne10_int32_t variant, ne10_int32_t is_neon, void * dst, void * src, ne10_uint32_t count)
+{
+    ne10_round_mode_t mode = (ne10_round_mode_t) variant;
+    ne10_uint32_t shift = variant * 7 + 1;
+
+    switch (func)
+    {
+    case 0:
+        return is_neon ? ne10_convert_float_q15_neon (dst, src, 40.0f, mode, count)
+                       : ne10_convert_float_q15_c (dst, src, 40.0f, mode, count);
+    case 1:
+        return is_neon ? ne10_convert_float_q31_neon (dst, src, 2097152.0f, mode, count)
+                       : ne10_convert_float_q31_c (dst, src, 2097152.0f, mode, count);
+    case 2:
+        return is_neon ? ne10_convert_float_u8_neon (dst, src, 0.5f, mode, count)
+                       : ne10_convert_float_u8_c (dst, src, 0.5f, mode, count);
+    case 3:
+        return is_neon ? ne10_convert_q15_float_neon (dst, src, 1.0f / 32768.0f, count)
+                       : ne10_convert_q15_float_c (dst, src, 1.0f / 32768.0f, count);
+    case 4:
+        return is_neon ? ne10_convert_q31_float_neon (dst, src, 1.0f / 2147483648.0f, count)
+                       : ne10_convert_q31_float_c (dst, src, 1.0f / 2147483648.0f, count);
+    case 5:
+        return is_neon ? ne10_convert_u8_float_neon (dst, src, 1.0f / 255.0f, count)
+                       : ne10_convert_u8_float_c (dst, src, 1.0f / 255.0f, count);
+    case 6:
+        return is_neon ? ne10_convert_float_f16_neon (dst, src, count)
+                       : ne10_convert_float_f16_c (dst, src, count);
+    case 7:
+        return is_neon ? ne10_convert_f16_float_neon (dst, src, count)
+                       : ne10_convert_f16_float_c (dst, src, count);
+    case 8:
+        return is_neon ? ne10_convert_int16_int32_neon (dst, src, shift, count)
+                       : ne10_convert_int16_int32_c (dst, src, shift, count);
+    default:
+        return is_neon ? ne10_convert_int32_int16_neon (dst, src, shift, count)
+                       : ne10_convert_int32_int16_c (dst, src, shift, count);
+    }
+}
+
+void test_convert_case0()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+    ne10_int32_t variant;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_int32_t i;
+    ne10_int32_t is_neon;
+    ne10_uint32_t bytes;
+    const ne10_uint32_t fixed_length = TEST_ITERATION;
+    /* ties, values just below them, saturation, an odd integer above 2^23 and a negative subnormal */
+    static const ne10_float32_t round_src[16] =
+    {
+        0.49999997f, -0.49999997f, 0.5f, -0.5f, 2.5f, -2.5f, 3.0e9f, -3.0e9f,
+        8388609.0f, -8388609.0f, 1.75f, -1.75f, -1.0e-40f, 100.25f, -100.25f, 5.0f
+    };
+    static const ne10_int32_t round_ref[3][16] =
+    {
+        /* NE10_ROUND_NEAREST */
+        { 0, 0, 1, -1, 3, -3, 2147483647, -2147483647 - 1, 8388609, -8388609, 2, -2, 0, 100, -100, 5 },
+        /* NE10_ROUND_ZERO */
+        { 0, 0, 0, 0, 2, -2, 2147483647, -2147483647 - 1, 8388609, -8388609, 1, -1, 0, 100, -100, 5 },
+        /* NE10_ROUND_FLOOR */
+        { 0, -1, 0, -1, 2, -3, 2147483647, -2147483647 - 1, 8388609, -8388609, 1, -2, 0, 100, -101, 5 }
+    };
+    /* overflow, ties to even in the normal and subnormal ranges, underflow and signed zero */
+    static const ne10_uint32_t f16_src[8] =
+    {
+        0x477ff000, 0x477fefff, 0x33000000, 0x33c00000, 0x3f801000, 0x3f803000, 0x2edbe6ff, 0x80000000
+    };
+    static const ne10_float16_t f16_ref[8] = { 0x7c00, 0x7bff, 0x0000, 0x0002, 0x3c00, 0x3c02, 0x0000, 0x8000 };
+    /* one, the smallest and largest subnormals, the smallest normal, -65504, infinity and -0 */
+    static const ne10_float16_t half_src[8] = { 0x3c00, 0x0001, 0x03ff, 0x0400, 0x3555, 0xfbff, 0x7c00, 0x8000 };
+    static const ne10_uint32_t half_ref[8] =
+    {
+        0x3f800000, 0x33800000, 0x387fc000, 0x38800000, 0x3eaaa000, 0xc77fe000, 0x7f800000, 0x80000000
+    };
+    static const ne10_int32_t narrow_src[8] = { 2147483647, -2147483647 - 1, 0x8000, -0x8000, 0x17fff, -0x18000, 0x10000, -1 };
+    static const ne10_int16_t narrow_ref[8] = { 32767, -32768, 1, 0, 1, -1, 1, 0 };
+    ne10_int32_t out32[16];
+    ne10_int16_t out16[16];
+    ne10_uint8_t out8[16];
+    ne10_float32_t mid[8];
+    ne10_uint32_t bits;
+    ne10_float16_t h;
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, fixed_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, fixed_length);
+    NE10_DST_ALLOC (thedst_neon, guarded_dst_neon, fixed_length);
+
+    for (func_loop = 0; func_loop < CONVERT_FUNC_COUNT; func_loop++)
+    {
+        for (variant = 0; variant < 3; variant++)
+        {
+            for (loop = 0; loop < TEST_ITERATION; loop++)
+            {
+                bytes = loop * test_convert_dst_size[func_loop];
+                GUARD_ARRAY_UINT8 ( (ne10_uint8_t*) thedst_c, bytes);
+                GUARD_ARRAY_UINT8 ( (ne10_uint8_t*) thedst_neon, bytes);
+
+                /* the integer and half precision sources are the bit patterns of the random floats */
+                assert_int_equal (NE10_OK, test_convert_run (func_loop, variant, 0, thedst_c, thesrc1, loop));
+                assert_int_equal (NE10_OK, test_convert_run (func_loop, variant, 1, thedst_neon, thesrc1, loop));
+
+                assert_true (CHECK_ARRAY_GUARD_UINT8 ( (ne10_uint8_t*) thedst_c, bytes));
+                assert_true (CHECK_ARRAY_GUARD_UINT8 ( (ne10_uint8_t*) thedst_neon, bytes));
+
+#ifdef DEBUG_TRACE
+                fprintf (stdout, "func: %d variant: %d loop count: %d\n", func_loop, variant, loop);
+                for (i = 0; i < loop; i++)
+                    fprintf (stdout, "thesrc1->%d: %e [0x%04X] \n", i, thesrc1[i], * (ne10_uint32_t*) &thesrc1[i]);
+#endif
+                /* the results, including NaNs, are bit exact */
+                assert_true (memcmp (thedst_c, thedst_neon, bytes) == 0);
+            }
+        }
+    }
+
+    for (is_neon = 0; is_neon < 2; is_neon++)
+    {
+        /* rounding modes and saturation, through the vector loops and the tails */
+        for (variant = 0; variant < 3; variant++)
+        {
+            for (loop = 14; loop <= 16; loop += 2)
+            {
+                if (is_neon)
+                {
+                    ne10_convert_float_q31_neon (out32, (ne10_float32_t*) round_src, 1.0f, (ne10_round_mode_t) variant, loop);
+                    ne10_convert_float_q15_neon (out16, (ne10_float32_t*) round_src, 1.0f, (ne10_round_mode_t) variant, loop);
+                    ne10_convert_float_u8_neon (out8, (ne10_float32_t*) round_src, 1.0f, (ne10_round_mode_t) variant, loop);
+                }
+                else
+                {
+                    ne10_convert_float_q31_c (out32, (ne10_float32_t*) round_src, 1.0f, (ne10_round_mode_t) variant, loop);
+                    ne10_convert_float_q15_c (out16, (ne10_float32_t*) round_src, 1.0f, (ne10_round_mode_t) variant, loop);
+                    ne10_convert_float_u8_c (out8, (ne10_float32_t*) round_src, 1.0f, (ne10_round_mode_t) variant, loop);
+                }
+                for (i = 0; i < loop; i++)
+                {
+                    ne10_int32_t ref = round_ref[variant][i];
+                    assert_int_equal (ref, out32[i]);
+                    assert_int_equal (ref > 32767 ? 32767 : (ref < -32768 ? -32768 : ref), out16[i]);
+                    assert_int_equal (ref > 255 ? 255 : (ref < 0 ? 0 : ref), out8[i]);
+                }
+            }
+        }
+
+        /* every half precision value converts exactly and back, NaNs to the quiet NaN */
+        for (i = 0; i < 65536; i += 8)
+        {
+            ne10_float16_t in[8];
+            ne10_float16_t out[8];
+            ne10_int32_t j;
+
+            for (j = 0; j < 8; j++)
+                in[j] = (ne10_float16_t) (i + j);
+            if (is_neon)
+            {
+                ne10_convert_f16_float_neon (mid, in, 8);
+                ne10_convert_float_f16_neon (out, mid, 8);
+            }
+            else
+            {
+                ne10_convert_f16_float_c (mid, in, 8);
+                ne10_convert_float_f16_c (out, mid, 8);
+            }
+            for (j = 0; j < 8; j++)
+            {
+                h = in[j];
+                if ( (h & 0x7fff) > 0x7c00)
+                    h = (h & 0x8000) | 0x7e00;
+                assert_int_equal (h, out[j]);
+            }
+        }
+
+        if (is_neon)
+        {
+            ne10_convert_float_f16_neon ( (ne10_float16_t*) out16, (ne10_float32_t*) f16_src, 8);
+            ne10_convert_f16_float_neon (mid, (ne10_float16_t*) half_src, 8);
+        }
+        else
+        {
+            ne10_convert_float_f16_c ( (ne10_float16_t*) out16, (ne10_float32_t*) f16_src, 8);
+            ne10_convert_f16_float_c (mid, (ne10_float16_t*) half_src, 8);
+        }
+        for (i = 0; i < 8; i++)
+        {
+            assert_int_equal (f16_ref[i], (ne10_float16_t) out16[i]);
+            memcpy (&bits, &mid[i], sizeof (bits));
+            assert_int_equal (half_ref[i], bits);
+        }
+
+        if (is_neon)
+        {
+            ne10_convert_int32_int16_neon (out16, (ne10_int32_t*) narrow_src, 16, 8);
+            ne10_convert_int16_int32_neon (out32, out16, 16, 8);
+        }
+        else
+        {
+            ne10_convert_int32_int16_c (out16, (ne10_int32_t*) narrow_src, 16, 8);
+            ne10_convert_int16_int32_c (out32, out16, 16, 8);
+        }
+        for (i = 0; i < 8; i++)
+        {
+            assert_int_equal (narrow_ref[i], out16[i]);
+            assert_int_equal (narrow_ref[i] * 65536, out32[i]);
+        }
+    }
+
+    /* invalid rounding modes and shifts */
+    assert_int_equal (NE10_ERR, ne10_convert_float_q15_neon (out16, thesrc1, 1.0f, (ne10_round_mode_t) 3, 8));
+    assert_int_equal (NE10_ERR, ne10_convert_float_q31_c (out32, thesrc1, 1.0f, (ne10_round_mode_t) 3, 8));
+    assert_int_equal (NE10_ERR, ne10_convert_float_u8_neon (out8, thesrc1, 1.0f, (ne10_round_mode_t) 3, 8));
+    assert_int_equal (NE10_ERR, ne10_convert_int16_int32_neon (out32, out16, 17, 8));
+    assert_int_equal (NE10_ERR, ne10_convert_int32_int16_c (out16, out32, 32, 8));
+
+    free (guarded_src1);
+    free (guarded_dst_c);
+    free (guarded_dst_neon);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = PERF_TEST_ITERATION;
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    /* init dst memory */
+    NE10_DST_ALLOC (perftest_thedst_c, perftest_guarded_dst_c, perftest_length);
+    NE10_DST_ALLOC (perftest_thedst_neon, perftest_guarded_dst_neon, perftest_length);
+
+    for (func_loop = 0; func_loop < CONVERT_FUNC_COUNT; func_loop++)
+    {
+        variant = 0;
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_convert_run (func_loop, variant, 0, perftest_thedst_c, perftest_thesrc1, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_convert_run (func_loop, variant, 1, perftest_thedst_neon, perftest_thesrc1, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    free (perftest_guarded_src1);
+    free (perftest_guarded_dst_c);
+    free (perftest_guarded_dst_neon);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+/* aligned kernels under test: addc, subc, mulc, mlac, setc, add, sub, mul, mla */
+#define ALIGNED_FUNC_COUNT 9
+
+/*
+ * Runs a kernel in one of four versions: 0 for the general C function, 1 for the
+ * aligned C function, 2 for the aligned NEON function and 3 for the general NEON
+ * function. The general functions are given the padded count, as the aligned
+ * ones process it.
+ */
+static void test_aligned_run (ne10_int32_t func, ne10_int32_t version, ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    static ne10_result_t (*const dst_src_cst[4][3]) (ne10_float32_t *, ne10_float32_t *, const ne10_float32_t, ne10_uint32_t) =
+    {
+        { ne10_addc_float_c, ne10_subc_float_c, ne10_mulc_float_c },
+        { ne10_addc_float_aligned_c, ne10_subc_float_aligned_c, ne10_mulc_float_aligned_c },
+        { ne10_addc_float_aligned_neon, ne10_subc_float_aligned_neon, ne10_mulc_float_aligned_neon },
+        { ne10_addc_float_neon, ne10_subc_float_neon, ne10_mulc_float_neon }
+    };
+    static ne10_result_t (*const dst_src1_src2[4][3]) (ne10_float32_t *, ne10_float32_t *, ne10_float32_t *, ne10_uint32_t) =
+    {
+        { ne10_add_float_c, ne10_sub_float_c, ne10_mul_float_c },
+        { ne10_add_float_aligned_c, ne10_sub_float_aligned_c, ne10_mul_float_aligned_c },
+        { ne10_add_float_aligned_neon, ne10_sub_float_aligned_neon, ne10_mul_float_aligned_neon },
+        { ne10_add_float_neon, ne10_sub_float_neon, ne10_mul_float_neon }
+    };
+    static ne10_result_t (*const mlac[4]) (ne10_float32_t *, ne10_float32_t *, ne10_float32_t *, const ne10_float32_t, ne10_uint32_t) =
+    {
+        ne10_mlac_float_c, ne10_mlac_float_aligned_c, ne10_mlac_float_aligned_neon, ne10_mlac_float_neon
+    };
+    static ne10_result_t (*const setc[4]) (ne10_float32_t *, const ne10_float32_t, ne10_uint32_t) =
+    {
+        ne10_setc_float_c, ne10_setc_float_aligned_c, ne10_setc_float_aligned_neon, ne10_setc_float_neon
+    };
+    static ne10_result_t (*const mla[4]) (ne10_float32_t *, ne10_float32_t *, ne10_float32_t *, ne10_float32_t *, ne10_uint32_t) =
+    {
+        ne10_mla_float_c, ne10_mla_float_aligned_c, ne10_mla_float_aligned_neon, ne10_mla_float_neon
+    };
+
+    if (version == 0 || version == 3)
+        count = NE10_ALIGNED_COUNT (count);
+
+    switch (func)
+    {
+    case 0:
+    case 1:
+    case 2:
+        dst_src_cst[version][func] (dst, src1, 1.5f, count);
+        break;
+    case 3:
+        mlac[version] (dst, acc, src1, -0.75f, count);
+        break;
+    case 4:
+        setc[version] (dst, 2.5f, count);
+        break;
+    case 5:
+    case 6:
+    case 7:
+        dst_src1_src2[version][func - 5] (dst, src1, src2, count);
+        break;
+    default:
+        mla[version] (dst, acc, src1, src2, count);
+        break;
+    }
+}
+
+void test_aligned_case0()
+{
+    ne10_int32_t loop;
+    ne10_int32_t func_loop;
+    ne10_float32_t * acc;
+    ne10_float32_t * src1;
+    ne10_float32_t * src2;
+    ne10_float32_t * dst_ref;
+    ne10_float32_t * dst;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_int32_t version;
+    ne10_int32_t i;
+    const ne10_uint32_t fixed_length = TEST_ITERATION;
+    /* one block more than the last loop needs, to check that the next block is left untouched */
+    const ne10_uint32_t aligned_length = NE10_ALIGNED_COUNT (fixed_length) + NE10_ALIGNED_BLOCK;
+
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (theacc, guarded_acc, aligned_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, aligned_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, aligned_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    acc = (ne10_float32_t*) ne10_malloc_aligned (aligned_length * sizeof (ne10_float32_t));
+    src1 = (ne10_float32_t*) ne10_malloc_aligned (aligned_length * sizeof (ne10_float32_t));
+    src2 = (ne10_float32_t*) ne10_malloc_aligned (aligned_length * sizeof (ne10_float32_t));
+    dst_ref = (ne10_float32_t*) ne10_malloc_aligned (aligned_length * sizeof (ne10_float32_t));
+    /* an odd size, which is padded up to a whole block */
+    dst = (ne10_float32_t*) ne10_malloc_aligned (aligned_length * sizeof (ne10_float32_t) - 5);
+    assert_true (acc != NULL && src1 != NULL && src2 != NULL && dst_ref != NULL && dst != NULL);
+    assert_true ( ( (uintptr_t) acc % NE10_MALLOC_ALIGNMENT) == 0);
+    assert_true ( ( (uintptr_t) src1 % NE10_MALLOC_ALIGNMENT) == 0);
+    assert_true ( ( (uintptr_t) src2 % NE10_MALLOC_ALIGNMENT) == 0);
+    assert_true ( ( (uintptr_t) dst_ref % NE10_MALLOC_ALIGNMENT) == 0);
+    assert_true ( ( (uintptr_t) dst % NE10_MALLOC_ALIGNMENT) == 0);
+
+    memcpy (acc, theacc, aligned_length * sizeof (ne10_float32_t));
+    memcpy (src1, thesrc1, aligned_length * sizeof (ne10_float32_t));
+    memcpy (src2, thesrc2, aligned_length * sizeof (ne10_float32_t));
+
+    for (func_loop = 0; func_loop < ALIGNED_FUNC_COUNT; func_loop++)
+    {
+        for (loop = 0; loop < TEST_ITERATION; loop++)
+        {
+            memset (dst_ref, 0, aligned_length * sizeof (ne10_float32_t));
+            test_aligned_run (func_loop, 0, dst_ref, acc, src1, src2, loop);
+
+            for (version = 1; version <= 2; version++)
+            {
+                /* the items past the processed blocks must not be written */
+                memset (dst, 0, aligned_length * sizeof (ne10_float32_t));
+                test_aligned_run (func_loop, version, dst, acc, src1, src2, loop);
+
+#ifdef DEBUG_TRACE
+                fprintf (stdout, "func: %d version: %d loop count: %d\n", func_loop, version, loop);
+                for (i = 0; i < loop; i++)
+                {
+                    fprintf (stdout, "src1->%d: %e [0x%04X] \n", i, src1[i], * (ne10_uint32_t*) &src1[i]);
+                    fprintf (stdout, "src2->%d: %e [0x%04X] \n", i, src2[i], * (ne10_uint32_t*) &src2[i]);
+                }
+#endif
+                assert_float_vec_equal (dst_ref, dst, ERROR_MARGIN_SMALL, aligned_length);
+            }
+        }
+    }
+
+    /* in place, on the first source, over the padded length */
+    for (version = 1; version <= 2; version++)
+    {
+        memcpy (dst, src1, aligned_length * sizeof (ne10_float32_t));
+        test_aligned_run (5, version, dst, acc, dst, src2, fixed_length);
+        test_aligned_run (5, 0, dst_ref, acc, src1, src2, fixed_length);
+        assert_float_vec_equal (dst_ref, dst, ERROR_MARGIN_SMALL, NE10_ALIGNED_COUNT (fixed_length));
+        for (i = NE10_ALIGNED_COUNT (fixed_length); i < (ne10_int32_t) aligned_length; i++)
+            assert_true (dst[i] == src1[i]);
+    }
+
+    ne10_free_aligned (acc);
+    ne10_free_aligned (src1);
+    ne10_free_aligned (src2);
+    ne10_free_aligned (dst_ref);
+    ne10_free_aligned (dst);
+    ne10_free_aligned (NULL);
+    free (guarded_acc);
+    free (guarded_src1);
+    free (guarded_src2);
+#endif
+
+#ifdef PERFORMANCE_TEST
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "Function", "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+    perftest_length = NE10_ALIGNED_COUNT (PERF_TEST_ITERATION);
+    /* init src memory */
+    NE10_SRC_ALLOC_LIMIT (perftest_theacc, perftest_guarded_acc, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc1, perftest_guarded_src1, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+    NE10_SRC_ALLOC_LIMIT (perftest_thesrc2, perftest_guarded_src2, perftest_length); // 16 extra bytes at the begining and 16 extra bytes at the end
+
+    acc = (ne10_float32_t*) ne10_malloc_aligned (perftest_length * sizeof (ne10_float32_t));
+    src1 = (ne10_float32_t*) ne10_malloc_aligned (perftest_length * sizeof (ne10_float32_t));
+    src2 = (ne10_float32_t*) ne10_malloc_aligned (perftest_length * sizeof (ne10_float32_t));
+    dst_ref = (ne10_float32_t*) ne10_malloc_aligned (perftest_length * sizeof (ne10_float32_t));
+    dst = (ne10_float32_t*) ne10_malloc_aligned (perftest_length * sizeof (ne10_float32_t));
+    memcpy (acc, perftest_theacc, perftest_length * sizeof (ne10_float32_t));
+    memcpy (src1, perftest_thesrc1, perftest_length * sizeof (ne10_float32_t));
+    memcpy (src2, perftest_thesrc2, perftest_length * sizeof (ne10_float32_t));
+
+    for (func_loop = 0; func_loop < ALIGNED_FUNC_COUNT; func_loop++)
+    {
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_aligned_run (func_loop, 1, dst_ref, acc, src1, src2, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_aligned_run (func_loop, 2, dst, acc, src1, src2, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    /* logged after the kernels, numbered from ALIGNED_FUNC_COUNT: the general NEON functions against the aligned ones */
+    for (func_loop = 0; func_loop < ALIGNED_FUNC_COUNT; func_loop++)
+    {
+        GET_TIME (time_c,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_aligned_run (func_loop, 3, dst_ref, acc, src1, src2, loop);
+                 );
+        GET_TIME (time_neon,
+                  for (loop = 0; loop < PERF_TEST_ITERATION; loop++) test_aligned_run (func_loop, 2, dst, acc, src1, src2, loop);
+                 );
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", ALIGNED_FUNC_COUNT + func_loop, time_c, time_neon, time_savings, time_speedup);
+    }
+
+    ne10_free_aligned (acc);
+    ne10_free_aligned (src1);
+    ne10_free_aligned (src2);
+    ne10_free_aligned (dst_ref);
+    ne10_free_aligned (dst);
+    free (perftest_guarded_acc);
+    free (perftest_guarded_src1);
+    free (perftest_guarded_src2);
+#endif
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
 void test_abs()
 {
     test_abs_case0();
@@ -2841,6 +6678,79 @@ void test_transmat()
     test_transmat_case0();
 }
 
+void test_cpx()
+{
+    test_cpx_case0();
+    test_cpx_case1();
+}
+
+void test_transcendental()
+{
+    test_transcendental_case0();
+    test_transcendental_case1();
+}
+
+void test_reduce()
+{
+    test_reduce_case0();
+    test_reduce_case1();
+}
+
+void test_gemm()
+{
+    test_gemm_case0();
+    test_gemm_case1();
+}
+
+void test_gemm_s8()
+{
+    test_gemm_s8_case0();
+    test_gemm_s8_case1();
+}
+
+void test_soa()
+{
+    test_soa_case0();
+    test_soa_case1();
+}
+
+void test_mat_x4()
+{
+    test_mat_x4_case0();
+}
+
+void test_quat()
+{
+    test_quat_case0();
+    test_quat_case1();
+}
+
+void test_decomp()
+{
+    test_decomp_case0();
+    test_decomp_case1();
+}
+
+void test_mat_f32()
+{
+    test_mat_f32_case0();
+}
+
+void test_fused()
+{
+    test_fused_case0();
+}
+
+void test_convert()
+{
+    test_convert_case0();
+}
+
+void test_aligned()
+{
+    test_aligned_case0();
+}
+
 static void my_test_setup (void)
 {
     //printf("------%-30s start\r\n", __FUNCTION__);
@@ -2884,6 +6794,19 @@ void test_fixture_math (void)
     run_test (test_mulcmatvec);
     run_test (test_submat);
     run_test (test_transmat);
+    run_test (test_cpx);
+    run_test (test_transcendental);
+    run_test (test_reduce);
+    run_test (test_gemm);
+    run_test (test_gemm_s8);
+    run_test (test_soa);
+    run_test (test_mat_x4);
+    run_test (test_quat);
+    run_test (test_decomp);
+    run_test (test_mat_f32);
+    run_test (test_fused);
+    run_test (test_convert);
+    run_test (test_aligned);
 
     test_fixture_end();                 // ends a fixture
 }